@@ -0,0 +1,56 @@
+#ifndef CBOR_WRITER_H
+#define CBOR_WRITER_H
+
+// Streaming CBOR (RFC 8949) emitter, the binary counterpart of core/json_writer.
+//
+// Same model: items are encoded into a caller-supplied buffer that is handed to the sink when it fills
+// and on cbor_writer_finish(). Maps and arrays use indefinite-length encoding, so nothing needs counting
+// up front; values inside a map take a key, values inside an array take NULL. Integers use the shortest
+// head, doubles go out as float32 when that is exact and as integers when integral.
+//
+// Only the C library is used, so it also builds on Linux (scripts/host/live_state_check).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "managers/sd_writer.h"
+
+#define CBOR_WRITER_MAX_DEPTH 16
+
+// Same shape as json_writer_sink_fn, so one sink serves both encoders
+typedef esp_err_t (*cbor_writer_sink_fn)(void* ctx, const char* data, size_t len);
+
+typedef struct {
+    cbor_writer_sink_fn sink;
+    void* ctx;
+    uint8_t* buf;
+    size_t cap;
+    size_t len;
+    size_t total;                // Bytes produced so far, flushed or not
+    esp_err_t err;
+    uint8_t depth;
+    uint16_t in_array;           // Bit per nesting level
+} cbor_writer_t;
+
+void cbor_writer_init(cbor_writer_t* w, void* buf, size_t cap, cbor_writer_sink_fn sink, void* ctx);
+
+// Open a map or array; key is NULL at the top level and inside arrays
+void cbor_writer_map(cbor_writer_t* w, const char* key);
+void cbor_writer_array(cbor_writer_t* w, const char* key);
+
+// Close the innermost map or array
+void cbor_writer_end(cbor_writer_t* w);
+
+void cbor_writer_string(cbor_writer_t* w, const char* key, const char* value);    // NULL writes null
+void cbor_writer_string_len(cbor_writer_t* w, const char* key, const char* value, size_t len);
+void cbor_writer_bytes(cbor_writer_t* w, const char* key, const void* data, size_t len);
+void cbor_writer_int(cbor_writer_t* w, const char* key, int64_t value);
+void cbor_writer_uint(cbor_writer_t* w, const char* key, uint64_t value);
+void cbor_writer_double(cbor_writer_t* w, const char* key, double value);
+void cbor_writer_bool(cbor_writer_t* w, const char* key, bool value);
+void cbor_writer_null(cbor_writer_t* w, const char* key);
+
+// Pass what is buffered to the sink; ESP_OK or the first error. Does not check the nesting is closed.
+esp_err_t cbor_writer_finish(cbor_writer_t* w);
+
+#endif // CBOR_WRITER_H
@@ -0,0 +1,29 @@
+#ifndef CENSUS_SKETCH_H
+#define CENSUS_SKETCH_H
+
+// The counting behind core/probe_census: a HyperLogLog sketch of distinct 64-bit hashes, and the hash
+// that turns a probe request into a device identity.
+//
+// Only the C library is used, so it also builds on Linux (scripts/host/census_bench).
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define PROBE_CENSUS_HLL_PRECISION 10                               // 2^10 registers, ~3.3% standard error
+#define PROBE_CENSUS_HLL_REGISTERS (1 << PROBE_CENSUS_HLL_PRECISION)
+
+// HyperLogLog sketch over 64-bit hashes, usable on its own
+typedef struct {
+    uint8_t registers[PROBE_CENSUS_HLL_REGISTERS];
+} hll_sketch_t;
+
+void hll_reset(hll_sketch_t* sketch);
+void hll_add_hash(hll_sketch_t* sketch, uint64_t hash);
+void hll_merge(hll_sketch_t* dst, const hll_sketch_t* src);
+uint32_t hll_estimate(const hll_sketch_t* sketch);
+
+// Hash a probe request (802.11 header and IEs, no FCS) into a device identity: the MAC for global
+// addresses, the IE fingerprint for random ones
+uint64_t probe_census_fingerprint(const uint8_t* frame, size_t len);
+
+#endif // CENSUS_SKETCH_H
@@ -0,0 +1,72 @@
+#ifndef COMMAND_JOBS_H
+#define COMMAND_JOBS_H
+
+// Commands submitted over the web API, each with its own output.
+//
+// A submitted command takes one of COMMAND_JOB_SLOTS slots and gets a request id. The serial task runs
+// queued jobs in order, and while a job runs whatever the task prints is appended to that job's output
+// window (the last COMMAND_JOB_OUTPUT_MAX bytes) and handed to the job's sink, if it has one. Finished
+// jobs stay readable by id until their slot is needed again, which for a job whose output nobody has
+// collected yet is at least COMMAND_JOB_KEEP_MS. Submitting never waits: when no slot can be taken the
+// caller gets ESP_ERR_NO_MEM and should answer "busy".
+//
+// Only pthread calls are used, so it also builds on Linux (scripts/host/command_jobs_stress).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "managers/sd_writer.h"
+
+#define COMMAND_JOB_SLOTS 8
+#define COMMAND_JOB_TEXT_MAX 512           // Longest command line, including the terminator
+#define COMMAND_JOB_OUTPUT_MAX 1024        // Output kept per job; earlier bytes are reported as skipped
+#define COMMAND_JOB_KEEP_MS 3000           // How long a finished job waits to be polled before it can go
+
+typedef enum {
+    COMMAND_JOB_QUEUED,
+    COMMAND_JOB_RUNNING,
+    COMMAND_JOB_DONE,
+} command_job_state_t;
+
+// Called on the running task for each piece of output, then once with done set and the command's
+// result. It runs while the job still counts as running, so its slot can't be reused underneath it.
+typedef void (*command_job_sink_fn)(void* ctx, uint32_t id, const char* data, size_t len, bool done, int result);
+
+typedef struct {
+    uint32_t id;
+    command_job_state_t state;
+    int result;                  // Valid once done
+    uint32_t produced;           // Output bytes written so far
+    uint32_t skipped;            // Bytes before the requested offset that fell out of the window
+    uint32_t next;               // Offset to continue reading from
+} command_job_info_t;
+
+typedef struct {
+    uint32_t submitted;
+    uint32_t rejected_busy;
+    uint32_t completed;
+    uint32_t queued;
+    uint32_t output_bytes;
+    uint32_t output_skipped;     // Output that fell out of a job's window
+} command_jobs_stats_t;
+
+// Queue a command. The sink (optional) is called from the running task, never from here.
+esp_err_t command_jobs_submit(const char* command, command_job_sink_fn sink, void* sink_ctx, uint32_t* id);
+
+// For the task that runs commands: take the oldest queued job, if any, and mark it running
+bool command_jobs_next(char* command, size_t command_len, uint32_t* id);
+
+// Output of the running job; ignored when no job runs. Only call from the task that runs commands.
+void command_jobs_output(const char* data, size_t len);
+
+void command_jobs_finish(uint32_t id, int result);
+
+// Copy a job's output from offset on. ESP_ERR_NOT_FOUND once the id is unknown or its slot was reused.
+esp_err_t command_jobs_read(uint32_t id, uint32_t offset, char* out, size_t out_len, size_t* copied,
+                            command_job_info_t* info);
+
+void command_jobs_get_stats(command_jobs_stats_t* stats);
+
+const char* command_jobs_state_name(command_job_state_t state);
+
+#endif // COMMAND_JOBS_H
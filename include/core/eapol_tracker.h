@@ -0,0 +1,55 @@
+#ifndef EAPOL_TRACKER_H
+#define EAPOL_TRACKER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/time.h>
+#include "managers/sd_writer.h"
+
+#define EAPOL_TRACKER_MAX_SESSIONS 8    // Concurrent (BSSID, STA) exchanges being assembled
+#define EAPOL_TRACKER_MAX_APS 16        // Beacons cached so each handshake can be paired with its network
+#define EAPOL_TRACKER_MAX_FRAME_LEN 320 // Longest EAPOL-Key frame kept per message (M3 with GTK fits)
+#define EAPOL_TRACKER_MAX_BEACON_LEN 512
+#define EAPOL_TRACKER_MAX_EAPOL_LEN 256 // Longest EAPOL PDU that can go into a 22000 line
+// Finished hashes waiting for the output thread (~360 bytes each). A deauth burst brings back the clients
+// of a busy AP within a second, while the thread may sit behind a slow card write; a hash that finds the
+// queue full is lost, so it holds that burst rather than the steady rate
+#define EAPOL_TRACKER_HASH_QUEUE 32
+
+// Message pair identifiers as defined by the hashcat 22000 / hccapx format
+typedef enum {
+    EAPOL_PAIR_M1M2_M2 = 0,  // ANonce from M1, EAPOL + MIC from M2
+    EAPOL_PAIR_M1M4_M4 = 1,  // ANonce from M1, EAPOL + MIC from M4
+    EAPOL_PAIR_M2M3_M2 = 2,  // ANonce from M3, EAPOL + MIC from M2 (authorized)
+    EAPOL_PAIR_NONE = 0xFF
+} eapol_message_pair_t;
+
+typedef struct {
+    uint32_t frames_seen;        // EAPOL-Key frames parsed
+    uint32_t frames_malformed;   // Frames that claimed to be EAPOL but failed length checks
+    uint32_t duplicates_dropped; // Retransmissions of an already stored message
+    uint32_t handshakes_emitted; // Usable exchanges written to pcap + 22000
+    uint32_t pmkids_emitted;     // PMKIDs written to 22000
+    uint32_t sessions_evicted;   // Incomplete sessions dropped to make room
+    uint32_t hashes_dropped;     // 22000 lines lost to a full output queue or an over-long EAPOL PDU
+} eapol_tracker_stats_t;
+
+// Allocate tracker state and start the thread that writes the 22000 lines; call after pcap_file_open()
+// so the 22000 file is named after the open pcap
+esp_err_t eapol_tracker_start(void);
+
+// Write out the queued hashes, stop the thread and free all tracker state; call once frames stop arriving
+void eapol_tracker_stop(void);
+
+// Feed one raw 802.11 frame from the promiscuous callback; beacons and EAPOL-Key frames are consumed.
+// Frames of a finished exchange go to the pcap; its 22000 line is queued for the output thread.
+void eapol_tracker_process_frame(const uint8_t* frame, size_t len, const struct timeval* ts);
+
+// Returns true if the frame is an 802.11 data frame carrying an EAPOL PDU (bounds checked)
+bool eapol_tracker_is_eapol_frame(const uint8_t* frame, size_t len);
+
+// Counters of the running capture, or of the last one once it stopped; safe from any task
+void eapol_tracker_get_stats(eapol_tracker_stats_t* out);
+
+#endif // EAPOL_TRACKER_H
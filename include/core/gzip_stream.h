@@ -0,0 +1,46 @@
+#ifndef GZIP_STREAM_H
+#define GZIP_STREAM_H
+
+// Small streaming gzip (RFC 1952) encoder.
+//
+// LZ77 over a 4 KB window with hash chains, coded with the fixed DEFLATE Huffman tables, so no
+// per-block statistics or tree building are needed and the whole state is about 26 KB. Output is
+// a standard .gz stream that gunzip, zlib and browsers (Content-Encoding: gzip) decode directly.
+// Only POSIX/libc calls are used, so it also builds on Linux.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "managers/sd_writer.h"
+
+#define GZIP_STREAM_WINDOW_BITS 12
+#define GZIP_STREAM_HASH_BITS 11
+#define GZIP_STREAM_OUT_SIZE 4096      // Compressed bytes are handed to write_fn in blocks of this size
+#define GZIP_STREAM_DEFAULT_LEVEL 4
+
+typedef struct gzip_stream gzip_stream_t;
+
+// Compressed output sink; return ESP_OK to continue
+typedef esp_err_t (*gzip_stream_write_fn)(void* ctx, const uint8_t* data, size_t len);
+
+// level 1 (fastest) to 9 (smallest) bounds the hash chain search
+gzip_stream_t* gzip_stream_create(int level, gzip_stream_write_fn write_fn, void* ctx);
+
+esp_err_t gzip_stream_write(gzip_stream_t* gz, const void* data, size_t len);
+
+// Compress what is left, write the trailer and flush everything to write_fn
+esp_err_t gzip_stream_finish(gzip_stream_t* gz);
+
+// Finish the current gzip member and start another. Everything written so far is then a complete
+// .gz on its own; gunzip, zlib and Wireshark read concatenated members as one stream.
+esp_err_t gzip_stream_new_member(gzip_stream_t* gz);
+
+void gzip_stream_destroy(gzip_stream_t* gz);
+
+uint64_t gzip_stream_bytes_in(const gzip_stream_t* gz);
+uint64_t gzip_stream_bytes_out(const gzip_stream_t* gz);
+
+// zlib-compatible CRC-32; start with crc = 0
+uint32_t gzip_crc32(uint32_t crc, const void* data, size_t len);
+
+#endif // GZIP_STREAM_H
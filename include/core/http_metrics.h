@@ -0,0 +1,61 @@
+#ifndef HTTP_METRICS_H
+#define HTTP_METRICS_H
+
+// Per-endpoint request timing for the web server.
+//
+// Each registered endpoint gets a slot holding request and error counts, how many requests are in its
+// handler right now, and a histogram of handler times with fixed bucket bounds, from which p50/p99 are
+// estimated. Requests run on a worker also record how long they waited for one. Slots are found by
+// method and URI, so registering the same endpoint again (server restart) keeps its counters.
+//
+// Only pthread calls are used, so it also builds on Linux (scripts/host/http_metrics_check).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "managers/sd_writer.h"
+
+#define HTTP_METRICS_MAX_ENDPOINTS 32
+#define HTTP_METRICS_URI_MAX 32
+#define HTTP_METRICS_LATENCY_BOUNDS_MS {1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000}
+#define HTTP_METRICS_LATENCY_BUCKETS 13     // The last bucket has no upper bound
+
+typedef struct {
+    char uri[HTTP_METRICS_URI_MAX];
+    char method[8];
+    bool async;                             // Runs on a worker rather than the server task
+    uint32_t requests;
+    uint32_t errors;                        // Handler failed; the connection was closed
+    uint32_t active;
+    uint32_t max_active;
+    uint32_t rejected_busy;                 // Answered 503 because no worker was free; not in requests
+    uint64_t total_us;
+    uint32_t max_us;
+    uint64_t wait_total_us;                 // Queued for a worker
+    uint32_t wait_max_us;
+    uint32_t latency_hist[HTTP_METRICS_LATENCY_BUCKETS];
+} http_metrics_endpoint_t;
+
+// Slot for an endpoint, created on first use; -1 when every slot is taken
+int http_metrics_endpoint(const char* method, const char* uri, bool async);
+
+// A request entered its handler
+void http_metrics_begin(int endpoint);
+
+// It finished: elapsed_us from arrival to completion, wait_us of that spent queued for a worker
+void http_metrics_end(int endpoint, uint32_t elapsed_us, uint32_t wait_us, bool ok);
+
+// It was turned away before reaching its handler
+void http_metrics_rejected(int endpoint);
+
+// Copy of one slot; false past the last endpoint in use
+bool http_metrics_get(int endpoint, http_metrics_endpoint_t* out);
+
+// Estimated latency in ms at percentile pct (0-100) from a slot's histogram, interpolated within the
+// bucket holding that rank; never above the slot's maximum. 0 without requests.
+uint32_t http_metrics_percentile_ms(const http_metrics_endpoint_t* endpoint, unsigned pct);
+
+// Clear every counter, keeping the endpoints
+void http_metrics_reset(void);
+
+#endif // HTTP_METRICS_H
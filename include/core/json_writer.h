@@ -0,0 +1,65 @@
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+// Streaming JSON emitter.
+//
+// Values are formatted straight into a caller-supplied buffer, which is handed to the sink whenever it
+// fills and once more on json_writer_finish(), so a response never exists as a tree or as one big
+// string. The writer tracks nesting and commas itself; values inside an object take a key, values inside
+// an array take NULL. Keys are written as given and must not need escaping (they are literals in our
+// code); string values are escaped. The first sink error sticks and later output is dropped.
+//
+// Sinks: httpd_resp_send_chunk in the web handlers, json_writer_file_sink for a FILE* (stdout is the
+// serial console). Without a sink the buffer is the whole output and overflowing it is an error.
+//
+// Only the C library is used, so it also builds on Linux (scripts/host/json_bench).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "managers/sd_writer.h"
+
+#define JSON_WRITER_MAX_DEPTH 16
+
+typedef esp_err_t (*json_writer_sink_fn)(void* ctx, const char* data, size_t len);
+
+typedef struct {
+    json_writer_sink_fn sink;
+    void* ctx;
+    char* buf;
+    size_t cap;
+    size_t len;
+    size_t total;                // Bytes produced so far, flushed or not
+    esp_err_t err;
+    uint8_t depth;
+    uint16_t in_array;           // Bit per nesting level
+    uint16_t has_items;          // Bit per nesting level: the next value needs a comma
+} json_writer_t;
+
+void json_writer_init(json_writer_t* w, char* buf, size_t cap, json_writer_sink_fn sink, void* ctx);
+
+// Open an object or array; key is NULL at the top level and inside arrays
+void json_writer_object(json_writer_t* w, const char* key);
+void json_writer_array(json_writer_t* w, const char* key);
+
+// Close the innermost object or array
+void json_writer_end(json_writer_t* w);
+
+void json_writer_string(json_writer_t* w, const char* key, const char* value);    // NULL writes null
+void json_writer_string_len(json_writer_t* w, const char* key, const char* value, size_t len);
+void json_writer_int(json_writer_t* w, const char* key, int64_t value);
+void json_writer_uint(json_writer_t* w, const char* key, uint64_t value);
+void json_writer_double(json_writer_t* w, const char* key, double value);         // NaN and inf write null
+void json_writer_bool(json_writer_t* w, const char* key, bool value);
+void json_writer_null(json_writer_t* w, const char* key);
+
+// Already formatted JSON, taken as one value
+void json_writer_raw(json_writer_t* w, const char* key, const char* json, size_t len);
+
+// Pass what is buffered to the sink; ESP_OK or the first error. Does not check the nesting is closed.
+esp_err_t json_writer_finish(json_writer_t* w);
+
+// Sink writing to the FILE* in ctx
+esp_err_t json_writer_file_sink(void* ctx, const char* data, size_t len);
+
+#endif // JSON_WRITER_H
@@ -0,0 +1,123 @@
+#ifndef LIVE_STATE_H
+#define LIVE_STATE_H
+
+// Versioned snapshot of what the radio sees, for the web API (/api/state).
+//
+// The AP table (last scan), station table (data frames seen by the station sniffer), capture counters and
+// GPS fix live in fixed tables. Every change takes the next value of one global version counter and
+// stamps it on the row or section it touched; removed rows go to a short log with their version. A client
+// passes the version of its last reply and gets only what changed after it, removals first:
+//
+//   apply "removed", then "changed"; store "version"; ask again with since=version&boot=boot
+//
+// The reply says reset when the client has to drop its copy and take the full tables instead: first
+// query (since=0), another boot, or removals older than the log. "version" is written last and is 0 when
+// the log overflowed while the reply was being sent, which makes the next query a reset.
+//
+// Rows are copied out a few at a time under a short lock and encoded outside it, so a query never holds
+// up the sniffer for a whole reply.
+//
+// Encodings: JSON (MACs as "AA:BB:..") or CBOR (MACs as 6-byte strings), streamed through a sink.
+// Only the C library and pthreads are used, so it also builds on Linux (scripts/host/live_state_check).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "managers/sd_writer.h"
+
+#define LIVE_STATE_MAX_APS 64
+#define LIVE_STATE_MAX_STATIONS 64
+#define LIVE_STATE_REMOVED_LOG 64
+
+// A station row takes a new version when it moves, its RSSI moves this far, or this long after the last one
+#define LIVE_STATE_STATION_RSSI_STEP 6
+#define LIVE_STATE_STATION_REFRESH_MS 5000
+
+// A full station table only makes room by dropping a station silent for this long, so a busy area does not
+// churn the table (and every client's copy) one frame at a time
+#define LIVE_STATE_STATION_EXPIRE_MS 60000
+
+#define LIVE_STATE_APS (1u << 0)
+#define LIVE_STATE_STATIONS (1u << 1)
+#define LIVE_STATE_CAPTURE (1u << 2)
+#define LIVE_STATE_GPS (1u << 3)
+#define LIVE_STATE_ALL (LIVE_STATE_APS | LIVE_STATE_STATIONS | LIVE_STATE_CAPTURE | LIVE_STATE_GPS)
+
+typedef enum {
+    LIVE_STATE_JSON,
+    LIVE_STATE_CBOR,
+} live_state_format_t;
+
+typedef struct {
+    uint32_t frames_seen;        // pcap capture policy counters
+    uint32_t frames_written;
+    uint32_t frames_sampled_out;
+    uint32_t write_errors;
+    uint32_t handshakes;         // EAPOL tracker output
+    uint32_t pmkids;
+    uint64_t sd_bytes_written;   // Shared SD writer
+    uint64_t sd_bytes_dropped;
+} live_state_capture_t;
+
+typedef struct {
+    bool valid;
+    uint8_t fix;                 // 0 none, 1 GPS, 2 DGPS
+    uint8_t fix_mode;            // 1 none, 2 2D, 3 3D
+    uint8_t sats_in_use;
+    uint8_t sats_in_view;
+    float latitude;
+    float longitude;
+    float altitude;
+    float speed;                 // m/s
+    float course;                // Degrees over ground
+    float dop_h;
+    uint32_t utc_date;           // YYYYMMDD, 0 when unknown
+    uint32_t utc_time;           // HHMMSS
+} live_state_gps_t;
+
+// Called at query time to refresh the capture section; counters are pulled rather than pushed per frame
+typedef void (*live_state_capture_fn)(live_state_capture_t* out);
+
+// Same shape as json_writer_sink_fn and cbor_writer_sink_fn
+typedef esp_err_t (*live_state_sink_fn)(void* ctx, const char* data, size_t len);
+
+typedef struct {
+    uint32_t boot;               // Boot id from the client's last reply, 0 if none
+    uint32_t since;              // Version from the client's last reply, 0 for everything
+    unsigned sections;           // LIVE_STATE_* bits
+    live_state_format_t format;
+} live_state_query_t;
+
+typedef struct {
+    uint32_t version;
+    uint32_t queries;
+    uint32_t resets;             // Replies that sent the full tables
+    uint32_t aps;
+    uint32_t stations;
+    uint32_t aps_dropped;        // Scan results past LIVE_STATE_MAX_APS
+    uint32_t stations_evicted;   // Expired stations dropped to make room
+    uint32_t stations_dropped;   // New stations not taken because the table was full of active ones
+} live_state_stats_t;
+
+// boot identifies this run to clients; capture may be NULL
+void live_state_init(uint32_t boot, live_state_capture_fn capture);
+
+// Replace the AP table with a scan: begin, one put per result, commit. APs missing from the scan are removed.
+void live_state_aps_begin(void);
+void live_state_aps_put(const uint8_t bssid[6], const char* ssid, uint8_t channel, int8_t rssi, uint8_t auth);
+void live_state_aps_commit(void);
+
+// A station sending to bssid; cheap enough for the promiscuous callback
+void live_state_station_seen(const uint8_t mac[6], const uint8_t bssid[6], int8_t rssi, uint8_t channel);
+
+void live_state_clear_stations(void);
+
+// New GPS fix; only a changed fix takes a version
+void live_state_update_gps(const live_state_gps_t* fix);
+
+// Encode what changed since q->since and pass it to sink
+esp_err_t live_state_write(const live_state_query_t* q, live_state_sink_fn sink, void* ctx);
+
+void live_state_get_stats(live_state_stats_t* out);
+
+#endif // LIVE_STATE_H
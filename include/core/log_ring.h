@@ -0,0 +1,55 @@
+#ifndef LOG_RING_H
+#define LOG_RING_H
+
+// Lock-free, multi-reader line log.
+//
+// Every line gets the next 32-bit sequence number and lands in slot seq % LOG_RING_SLOTS. Producers
+// claim a number with one atomic add and copy the line in under a per-slot stamp, so they never wait
+// on readers or on each other. Readers keep their own cursor (the next sequence they want) and copy
+// lines out seqlock-style: a line overwritten while being read is counted as lost rather than returned
+// torn. Any number of readers can follow the same ring without taking lines from one another.
+//
+// Only C11 atomics are used, so it also builds on Linux (scripts/host/log_ring_stress).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdatomic.h>
+
+#define LOG_RING_SLOTS 64              // Power of two
+#define LOG_RING_LINE_MAX 96           // Longer lines are split over several slots
+
+typedef struct {
+    _Atomic uint32_t stamp;            // 2 * seq + 1 while written, 2 * seq + 2 once complete, 0 if unused
+    uint8_t len;
+    char text[LOG_RING_LINE_MAX];
+} log_ring_slot_t;
+
+typedef struct {
+    _Atomic uint32_t head;             // Next sequence number to hand out
+    _Atomic uint32_t floor;            // Lines before this were cleared
+    log_ring_slot_t slots[LOG_RING_SLOTS];
+} log_ring_t;
+
+// Called once per line in sequence order; return false to stop early (the line is not consumed)
+typedef bool (*log_ring_visit_fn)(void* ctx, uint32_t seq, const char* text, size_t len);
+
+// Split text at newlines (and every LOG_RING_LINE_MAX bytes) and append the non-empty lines.
+// Returns the sequence number after the last line added.
+uint32_t log_ring_append(log_ring_t* ring, const char* text, size_t len);
+
+// Sequence number the next line will get
+uint32_t log_ring_head(log_ring_t* ring);
+
+// Oldest sequence number still held (or not yet cleared)
+uint32_t log_ring_oldest(log_ring_t* ring);
+
+// Hide every line written so far from readers, without touching their cursors
+void log_ring_clear(log_ring_t* ring);
+
+// Deliver the lines from *cursor on and advance it past the last one delivered. Stops at a line still
+// being written. Returns how many lines the reader missed: overwritten before it got to them, or
+// while they were being copied.
+uint32_t log_ring_read(log_ring_t* ring, uint32_t* cursor, log_ring_visit_fn visit, void* ctx);
+
+#endif // LOG_RING_H
@@ -0,0 +1,47 @@
+#ifndef LZ4_STREAM_H
+#define LZ4_STREAM_H
+
+// Small streaming LZ4 frame encoder.
+//
+// Input is cut into independent blocks of LZ4_STREAM_BLOCK_SIZE and each block is compressed with the
+// single-probe hash table LZ4 uses in its fast mode, so the whole state is about 24 KB and nothing is
+// kept between blocks. Output is a standard LZ4 frame (.lz4) that `lz4 -d`, python-lz4 and Wireshark
+// read directly. Blocks that don't shrink are stored as-is. Only libc calls are used, so it also
+// builds on Linux.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "managers/sd_writer.h"
+
+#ifndef LZ4_STREAM_BLOCK_SIZE
+#define LZ4_STREAM_BLOCK_SIZE 8192     // Larger blocks find more repeats but cost twice their size in RAM
+#endif
+#define LZ4_STREAM_HASH_BITS 12
+#define LZ4_STREAM_DEFAULT_LEVEL 9
+#define LZ4_STREAM_END_MARK_LEN 4
+
+typedef struct lz4_stream lz4_stream_t;
+
+// Compressed output sink; return ESP_OK to continue
+typedef esp_err_t (*lz4_stream_write_fn)(void* ctx, const uint8_t* data, size_t len);
+
+// level 9 probes every position like stock LZ4; lower levels skip ahead faster through data that
+// doesn't match, down to level 1 which is roughly LZ4's --fast=8
+lz4_stream_t* lz4_stream_create(int level, lz4_stream_write_fn write_fn, void* ctx);
+
+esp_err_t lz4_stream_write(lz4_stream_t* lz, const void* data, size_t len);
+
+// Compress the partial block and hand it to write_fn. The output so far plus an end mark
+// (LZ4_STREAM_END_MARK_LEN zero bytes) is a complete frame.
+esp_err_t lz4_stream_flush(lz4_stream_t* lz);
+
+// Flush and write the end mark
+esp_err_t lz4_stream_finish(lz4_stream_t* lz);
+
+void lz4_stream_destroy(lz4_stream_t* lz);
+
+uint64_t lz4_stream_bytes_in(const lz4_stream_t* lz);
+uint64_t lz4_stream_bytes_out(const lz4_stream_t* lz);
+
+#endif // LZ4_STREAM_H
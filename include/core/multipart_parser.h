@@ -0,0 +1,49 @@
+#ifndef MULTIPART_PARSER_H
+#define MULTIPART_PARSER_H
+
+// Incremental multipart/form-data (RFC 7578) parser.
+//
+// Data can be fed in pieces of any size; delimiters and part headers may straddle pieces. Part bodies
+// are scanned for the delimiter with Boyer-Moore-Horspool and handed to on_part_data in the largest
+// runs possible. Only the few bytes that could still be the start of a delimiter are held back between
+// pieces. Bodies are treated as binary; nothing relies on NUL termination.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "managers/sd_writer.h"
+
+#define MULTIPART_BOUNDARY_MAX 70          // RFC 2046 limit
+#define MULTIPART_HEADER_MAX 1024          // Header block of a single part
+#define MULTIPART_FIELD_MAX 128
+
+typedef struct multipart_parser multipart_parser_t;
+
+typedef struct {
+    char name[MULTIPART_FIELD_MAX];        // Form field name
+    char filename[MULTIPART_FIELD_MAX];    // Empty for plain fields
+    char content_type[MULTIPART_FIELD_MAX];
+    bool is_file;
+} multipart_part_t;
+
+// Any callback returning an error stops the parser and is returned from multipart_parser_feed()
+typedef struct {
+    esp_err_t (*on_part_begin)(void* ctx, const multipart_part_t* part);
+    esp_err_t (*on_part_data)(void* ctx, const uint8_t* data, size_t len);
+    esp_err_t (*on_part_end)(void* ctx);
+} multipart_callbacks_t;
+
+// Pull the boundary out of a "multipart/form-data; boundary=..." Content-Type value
+bool multipart_parse_boundary(const char* content_type, char* out, size_t out_len);
+
+multipart_parser_t* multipart_parser_create(const char* boundary, const multipart_callbacks_t* callbacks, void* ctx);
+
+// ESP_ERR_INVALID_ARG for malformed input, or the first error returned by a callback
+esp_err_t multipart_parser_feed(multipart_parser_t* parser, const void* data, size_t len);
+
+// ESP_OK once the closing delimiter has been seen, ESP_ERR_INVALID_STATE for a truncated body
+esp_err_t multipart_parser_finish(multipart_parser_t* parser);
+
+void multipart_parser_destroy(multipart_parser_t* parser);
+
+#endif // MULTIPART_PARSER_H
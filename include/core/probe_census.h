@@ -0,0 +1,40 @@
+#ifndef PROBE_CENSUS_H
+#define PROBE_CENSUS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <time.h>
+#include "esp_err.h"
+#include "core/census_sketch.h"
+
+#define PROBE_CENSUS_BUCKET_SECONDS 60
+#define PROBE_CENSUS_HISTORY_LEN 60                                 // Minutes kept in RAM for the web API
+#define PROBE_CENSUS_DIR "/mnt/ghostesp/census"
+
+typedef struct {
+    time_t start;           // Wall clock at bucket start (0 if the clock was never set)
+    uint32_t uptime_s;      // Seconds since boot at bucket start
+    uint32_t devices;       // Estimated distinct devices seen in the bucket
+    uint32_t probes;        // Probe requests counted
+    uint32_t randomized;    // Probe requests sent from a locally administered (random) MAC
+} probe_census_bucket_t;
+
+// Start counting; opens a CSV under PROBE_CENSUS_DIR when an SD card is present, serial otherwise
+esp_err_t probe_census_start(void);
+
+// Export the running bucket and stop the minute task
+void probe_census_stop(void);
+
+bool probe_census_is_running(void);
+
+// Feed one raw 802.11 frame from the promiscuous callback; only probe requests are counted
+void probe_census_process_frame(const uint8_t* frame, size_t len);
+
+// Snapshot of the running bucket plus the distinct devices over the whole session
+void probe_census_get_current(probe_census_bucket_t* current, uint32_t* session_devices);
+
+// Copy completed buckets, oldest first; returns the number written
+size_t probe_census_get_history(probe_census_bucket_t* out, size_t max);
+
+#endif // PROBE_CENSUS_H
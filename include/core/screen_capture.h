@@ -0,0 +1,78 @@
+#ifndef SCREEN_CAPTURE_H
+#define SCREEN_CAPTURE_H
+
+// Screen capture for the display mirror: encodes what the display driver flushes into frames of
+// dirty rectangles.
+//
+// There is no copy of the screen to read from, so pixels are taken as LVGL flushes them. The sender
+// arms a capture a few times a second; the next refresh is encoded (core/screen_codec) into one of two
+// buffers as its areas are flushed, and the refresh's last flush closes the frame for the sender to
+// take. Flushes between captures, and rows that do not fit in the buffer, are only noted as pending
+// areas (a few, merged as LVGL merges invalidated areas). While armed, the render task asks for about a
+// buffer's worth of those to redraw, so the mirror catches up a capture at a time without ever holding
+// up local drawing for long. A new client makes the whole screen pending.
+//
+// Frame layout, little-endian, rectangles back to back:
+//
+//   u8 1, u16 x, u16 y, u16 w, u16 h, u32 len, len bytes of screen_codec data
+//
+// and the hello a client gets first: u8 0, u16 width, u16 height.
+//
+// Only the C library and pthreads are used, so it also builds on Linux (scripts/host/mirror_bench).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "managers/sd_writer.h"
+
+#define SCREEN_CAPTURE_HELLO 0
+#define SCREEN_CAPTURE_RECT 1
+#define SCREEN_CAPTURE_HELLO_LEN 5
+#define SCREEN_CAPTURE_RECT_HEADER 13
+#define SCREEN_CAPTURE_PENDING_AREAS 8
+
+typedef struct {
+    int x1, y1, x2, y2;     // Inclusive, as lv_area_t
+} screen_capture_area_t;
+
+typedef struct {
+    uint32_t frames;
+    uint32_t rects;
+    uint64_t pixels;        // Encoded
+    uint64_t bytes;         // Frame bytes taken by the sender
+    uint32_t deferred;      // Flushes, or rows of them, left pending
+} screen_capture_stats_t;
+
+// Screen size and pixel order (swapped for LV_COLOR_16_SWAP); buffer_size is per frame buffer
+void screen_capture_init(int width, int height, size_t buffer_size, bool swapped);
+
+// Start capturing (allocates the buffers the first time), with the whole screen pending
+esp_err_t screen_capture_start(void);
+
+// Stop capturing and drop anything buffered or pending
+void screen_capture_stop(void);
+
+bool screen_capture_running(void);
+
+// Make the whole screen pending again (a client joined)
+void screen_capture_request_full(void);
+
+// Display driver flush: the area x1..x2, y1..y2 about to be drawn from pixels; last for the final
+// flush of a refresh. Returns at once when not running.
+void screen_capture_tee(int x1, int y1, int x2, int y2, const uint16_t* pixels, bool last);
+
+// Render task, before each refresh: true with the next pending area (or band of one) to invalidate
+// now; call until false
+bool screen_capture_next_invalidation(screen_capture_area_t* area);
+
+// Sender: capture the next refresh, unless the last frame has not been taken yet
+void screen_capture_arm(void);
+
+// Sender: the finished frame, if any; *data stays valid until the next call. 0 when none is ready.
+size_t screen_capture_take(const uint8_t** data);
+
+void screen_capture_hello(uint8_t out[SCREEN_CAPTURE_HELLO_LEN]);
+
+void screen_capture_get_stats(screen_capture_stats_t* out);
+
+#endif // SCREEN_CAPTURE_H
@@ -0,0 +1,39 @@
+#ifndef SCREEN_CODEC_H
+#define SCREEN_CODEC_H
+
+// Lossless codec for rectangles of RGB565 pixels, for streaming the screen to the web UI.
+//
+// A byte stream in the style of QOI, with the operations cut down to 5-6-5 components. Each pixel is
+// coded against the one before it and a 64-entry table of recently seen colours:
+//
+//   00iiiiii             INDEX  colour at table slot i
+//   01rrggbb             DIFF   r, g, b each changed by -2..1 (biased by 2)
+//   110ggggg RRRRBBBB    LUMA   g changed by -16..15; r and b by that plus -8..7 (biased by 16 and 8)
+//   10nnnnnn             RUN    previous colour n+1 times (1..64)
+//   11111110 nn nn       RUN    previous colour n+1 times, n little-endian
+//   11111111 pp pp       RAW    RGB565, little-endian
+//
+// The table slot of a colour is (r * 3 + g * 5 + b * 7) % 64. Every rectangle starts from black with
+// an empty table, so rectangles decode on their own, and runs stop at the end of each row, so a
+// rectangle can be cut after any whole row.
+//
+// Only the C library is used, so it also builds on Linux (scripts/host/mirror_bench).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Worst case output per pixel (RAW)
+#define SCREEN_CODEC_MAX_PIXEL_BYTES 3
+
+// Encode the w x h rectangle at pixels (stride pixels per row) into out. swapped says the pixels are
+// stored byte-swapped (LV_COLOR_16_SWAP). Stops at the last whole row that fits in cap: returns the
+// bytes written for *rows rows, 0 when not even one row fits.
+size_t screen_codec_encode(const uint16_t* pixels, int w, int h, int stride, bool swapped, uint8_t* out,
+                           size_t cap, int* rows);
+
+// Decode w x h pixels (RGB565, native order) from in into out (stride pixels per row). Returns the
+// bytes consumed, 0 when in is truncated or malformed.
+size_t screen_codec_decode(const uint8_t* in, size_t len, int w, int h, uint16_t* out, int stride);
+
+#endif // SCREEN_CODEC_H
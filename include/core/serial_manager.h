@@ -4,6 +4,7 @@
 #define SERIAL_MANAGER_H
 
 #include <esp_types.h>
+#include <esp_err.h>
 #include <managers/display_manager.h>
 
 // Initialize the SerialManager
@@ -14,7 +15,8 @@ void serial_task(void *pvParameter);
 
 int handle_serial_command(const char *input);
 
-void simulateCommand(const char* commandString);
+// Queue a command for the serial task; ESP_ERR_TIMEOUT when the queue is full
+esp_err_t simulateCommand(const char* commandString);
 
 QueueHandle_tt commandQueue;
 
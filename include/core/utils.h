@@ -55,6 +55,8 @@ int get_query_param_value(const char *query, const char *key, char *value, size_
 
 int get_next_pcap_file_index(const char* base_name);
 
+int get_next_census_file_index(const char* base_name);
+
 
 #define WRAP_MESSAGE(msg) wrap_message(msg, __FILE__, __LINE__)
 
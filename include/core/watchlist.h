@@ -0,0 +1,61 @@
+#ifndef WATCHLIST_H
+#define WATCHLIST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "core/watchlist_set.h"
+
+#define WATCHLIST_DEFAULT_PATH "/mnt/ghostesp/watchlist.txt"
+#define WATCHLIST_EVENT_HISTORY 32      // Hits kept in RAM for the web API
+#define WATCHLIST_ALERT_COOLDOWN_S 60   // Repeat alerts for the same entry are suppressed this long
+
+typedef struct {
+    uint32_t seq;                 // Monotonic, lets web clients ask for events after the last one they saw
+    uint32_t uptime_s;
+    watchlist_match_type_t type;
+    uint8_t mac[6];               // Address that matched (the full address for OUI hits)
+    char ssid[33];
+    int8_t rssi;
+    uint8_t channel;
+} watchlist_event_t;
+
+typedef struct {
+    uint32_t macs;
+    uint32_t ouis;
+    uint32_t ssids;
+    uint32_t rejected_lines;
+    uint32_t bloom_bits;
+    uint32_t frames_checked;
+    uint32_t bloom_hits;          // Candidate matches, including false positives
+    uint32_t confirmed_hits;
+    uint32_t events_dropped;      // Alert queue was full
+} watchlist_stats_t;
+
+// Load a watchlist file, replacing the current one. One entry per line:
+//   AA:BB:CC:DD:EE:FF   full MAC / BSSID
+//   AA:BB:CC            OUI
+//   ssid:Name           exact SSID
+// Blank lines and lines starting with '#' are ignored.
+esp_err_t watchlist_load(const char* path);
+
+// Drop the list; both this and a reload wait for lookups still using the old list before freeing it
+void watchlist_clear(void);
+
+bool watchlist_is_loaded(void);
+
+// Check one raw 802.11 frame from the promiscuous callback. Every address and any SSID element is tested
+// against the bloom filter; candidates are confirmed by binary search and alerts are raised off the RX path.
+void watchlist_check_frame(const uint8_t* frame, size_t len, int8_t rssi, uint8_t channel);
+
+// Exact lookups, usable without a frame
+bool watchlist_contains_mac(const uint8_t mac[6]);
+bool watchlist_contains_ssid(const char* ssid, size_t len);
+
+void watchlist_get_stats(watchlist_stats_t* out);
+
+// Copy events with seq > since_seq, oldest first; returns the number written
+size_t watchlist_get_events(uint32_t since_seq, watchlist_event_t* out, size_t max);
+
+#endif // WATCHLIST_H
@@ -0,0 +1,51 @@
+#ifndef WATCHLIST_SET_H
+#define WATCHLIST_SET_H
+
+// The lookup structure behind the watchlist: a bloom filter over every entry, with sorted arrays of
+// MACs, OUIs and SSIDs to confirm its candidates by binary search.
+//
+// A set is built once from a file and never changed afterwards, so any number of tasks can read it
+// without locking; core/watchlist.c decides when an old set is no longer read and can be freed.
+//
+// Only the C library is used (PSRAM allocation aside), so it also builds on Linux
+// (scripts/host/watchlist_bench).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "managers/sd_writer.h"
+
+typedef enum {
+    WATCHLIST_MATCH_MAC = 0,
+    WATCHLIST_MATCH_OUI,
+    WATCHLIST_MATCH_SSID,
+} watchlist_match_type_t;
+
+typedef struct {
+    uint8_t* bloom;
+    uint32_t bloom_mask;          // Bit count - 1, the bit count is a power of two
+    uint8_t* macs;                // Sorted, 6 bytes per entry
+    uint32_t mac_count;
+    uint8_t* ouis;                // Sorted, 3 bytes per entry
+    uint32_t oui_count;
+    char** ssids;                 // Sorted by length then bytes, each points into ssid_pool
+    uint32_t ssid_count;
+    char* ssid_pool;
+    uint32_t rejected_lines;
+} watchlist_set_t;
+
+// Build a set from a watchlist file (format in core/watchlist.h). ESP_ERR_NOT_FOUND when the file
+// can't be opened, ESP_ERR_INVALID_SIZE when it has no valid entry.
+esp_err_t watchlist_set_load(const char* path, watchlist_set_t** out);
+
+void watchlist_set_free(watchlist_set_t* set);
+
+// Bloom filter test: false means the entry is certainly not in the set
+bool watchlist_set_maybe(const watchlist_set_t* set, watchlist_match_type_t type, const uint8_t* data, size_t len);
+
+// Exact lookups; has_oui looks at the first 3 bytes of mac
+bool watchlist_set_has_mac(const watchlist_set_t* set, const uint8_t* mac);
+bool watchlist_set_has_oui(const watchlist_set_t* set, const uint8_t* mac);
+bool watchlist_set_has_ssid(const watchlist_set_t* set, const char* ssid, size_t len);
+
+#endif // WATCHLIST_SET_H
@@ -0,0 +1,98 @@
+#ifndef WPS_SURVEY_H
+#define WPS_SURVEY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+#define WPS_SURVEY_INITIAL_CAPACITY 16   // Doubled by a task ahead of need, never on the RX path
+
+// Share of the free heap (PSRAM included) the table may grow into; the limit is set when a survey
+// starts, so a flood of spoofed BSSIDs stops there rather than at an empty heap
+#ifdef CONFIG_WPS_SURVEY_HEAP_PERCENT
+#define WPS_SURVEY_HEAP_PERCENT CONFIG_WPS_SURVEY_HEAP_PERCENT
+#else
+#define WPS_SURVEY_HEAP_PERCENT 50
+#endif
+#define WPS_SURVEY_EXPORT_DIR "/mnt/ghostesp/scans"
+
+typedef enum {
+    WPS_MODE_NONE = 0,   // No WPS support
+    WPS_MODE_PBC,        // Push Button Configuration (PBC)
+    WPS_MODE_PIN         // PIN method (Display or Keypad)
+} wps_modes_t;
+
+typedef enum {
+    WPS_SURVEY_NEW = 0,      // First WPS frame from this BSSID, parsed and stored
+    WPS_SURVEY_UPDATED,      // Known BSSID, sighting counters updated
+    WPS_SURVEY_NOT_WPS,      // No WPS element in the frame
+    WPS_SURVEY_SKIPPED,      // Table busy (being read or grown), or full; at the limit counted in dropped_new
+} wps_survey_result_t;
+
+typedef enum {
+    WPS_SURVEY_FORMAT_CSV = 0,
+    WPS_SURVEY_FORMAT_JSON,
+} wps_survey_format_t;
+
+typedef struct {
+    uint8_t bssid[6];
+    char ssid[33];
+    uint8_t version;          // 0x10 = 1.0, 0x20 = 2.0 (from the WFA vendor extension)
+    uint8_t state;            // 1 = not configured, 2 = configured
+    bool ap_setup_locked;
+    bool selected_registrar;
+    uint16_t config_methods;
+    wps_modes_t mode;
+    char device_name[33];
+    char manufacturer[65];
+    char model_name[33];
+    char model_number[33];
+    int8_t rssi;              // Strongest seen
+    uint8_t channel;
+    uint32_t first_seen_s;    // Uptime
+    uint32_t last_seen_s;
+    uint32_t seen_count;
+} wps_survey_entry_t;
+
+typedef struct {
+    uint32_t count;
+    uint32_t capacity;        // Allocated now
+    uint32_t max_entries;     // Limit set from the free heap when the survey started
+    uint32_t dropped_new;     // Networks not stored because the limit was reached (at least)
+} wps_survey_stats_t;
+
+// Sink used by exports; return ESP_OK to continue
+typedef esp_err_t (*wps_survey_write_fn)(void* ctx, const char* data, size_t len);
+
+// Create the table lock and the task that grows the table; call once at startup, before monitor mode
+// can feed frames
+esp_err_t wps_survey_init(void);
+
+// Drop every entry, set the size limit from the free heap and allocate the first block; called when a
+// new survey starts
+void wps_survey_reset(void);
+
+// Feed a beacon or probe response (without FCS). Safe to call from the promiscuous callback: never
+// waits for the lock. When out is given, the stored entry is copied there for NEW and UPDATED.
+wps_survey_result_t wps_survey_observe(const uint8_t* frame, size_t len, int8_t rssi, uint8_t channel,
+                                       wps_survey_entry_t* out);
+
+size_t wps_survey_count(void);
+
+void wps_survey_get_stats(wps_survey_stats_t* out);
+
+// Copy entry at index (insertion order); returns false past the end
+bool wps_survey_get(size_t index, wps_survey_entry_t* out);
+
+// Serialize all entries through write_fn, one row / object at a time. JSON is an object with the
+// entries under "networks" and the table's "max_entries" and "dropped_new"; CSV ends in a "#" comment
+// line with the same counts.
+esp_err_t wps_survey_export(wps_survey_format_t format, wps_survey_write_fn write_fn, void* ctx);
+
+// Write the table to WPS_SURVEY_EXPORT_DIR/wps_<n>.<csv|json>; the chosen path is copied to path_out if given
+esp_err_t wps_survey_export_file(wps_survey_format_t format, char* path_out, size_t path_out_len);
+
+const char* wps_survey_mode_str(wps_modes_t mode);
+
+#endif // WPS_SURVEY_H
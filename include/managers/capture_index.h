@@ -0,0 +1,69 @@
+#ifndef CAPTURE_INDEX_H
+#define CAPTURE_INDEX_H
+
+// Persisted per-directory catalog of capture files.
+//
+// Each indexed directory keeps a ".index" file of fixed-size slots next to its captures. The catalog
+// is loaded once, kept in RAM and updated one slot at a time as files are created, closed or deleted,
+// so picking the next "<base>_<n>.<ext>" name and listing a directory no longer walk it with readdir.
+// A missing or corrupt index is rebuilt with a single directory scan. The index file of each loaded
+// directory stays open, so it takes one of the SD mount's max_files.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "managers/sd_writer.h"
+
+#define CAPTURE_INDEX_FILE ".index"
+#define CAPTURE_INDEX_MAX_DIRS 6
+#define CAPTURE_INDEX_MAX_BASES 16
+#define CAPTURE_INDEX_NAME_LEN 48
+
+typedef enum {
+    CAPTURE_FILE_OTHER = 0,
+    CAPTURE_FILE_PCAP,
+    CAPTURE_FILE_CSV,
+    CAPTURE_FILE_TEXT,
+} capture_file_type_t;
+
+typedef struct {
+    char name[CAPTURE_INDEX_NAME_LEN];
+    capture_file_type_t type;
+    bool open;                   // Created but not closed yet; size and records are provisional
+    uint32_t seq;                // The <n> in <base>_<n>.<ext>, 0 for names that don't follow the pattern
+    uint32_t start_time;         // Unix time at creation (file mtime for rebuilt entries)
+    uint32_t records;            // Packets or lines, 0 when unknown
+    uint64_t size;
+} capture_index_entry_t;
+
+typedef void (*capture_index_visit_fn)(void* ctx, const capture_index_entry_t* entry);
+
+// Load (or rebuild) the index of dir. Entries left open by a crash are refreshed with stat().
+esp_err_t capture_index_load(const char* dir);
+
+// Drop the in-memory catalogs; the next access reloads from the card
+void capture_index_unload(void);
+
+// Reserve the next free "<dir>/<base>_<n>.<ext>" name, record it as an open entry and return n (-1 on error)
+int capture_index_create(const char* dir, const char* base, const char* ext, char* path_out, size_t path_len);
+
+// Next sequence number that capture_index_create would use, without reserving it
+int capture_index_peek_seq(const char* dir, const char* base, const char* ext);
+
+// Record the final size and record count of a file and mark it closed; unknown files are added
+esp_err_t capture_index_update(const char* path, uint64_t size, uint32_t records);
+
+// Forget a deleted file. Paths outside indexed directories are ignored.
+esp_err_t capture_index_remove(const char* path);
+
+// Rescan dir and rewrite its index
+esp_err_t capture_index_rebuild(const char* dir);
+
+bool capture_index_is_indexed(const char* dir);
+
+// Visit every entry of dir in slot order; returns ESP_ERR_NOT_FOUND if dir isn't indexed
+esp_err_t capture_index_foreach(const char* dir, capture_index_visit_fn fn, void* ctx);
+
+const char* capture_index_type_str(capture_file_type_t type);
+
+#endif // CAPTURE_INDEX_H
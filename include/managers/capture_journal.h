@@ -0,0 +1,102 @@
+#ifndef CAPTURE_JOURNAL_H
+#define CAPTURE_JOURNAL_H
+
+// Crash recovery for capture files.
+//
+// Every capture that is open gets a line in CAPTURE_JOURNAL_PATH holding its path, kind and the last
+// checkpointed size (a record boundary that is known to be on the card). A clean close removes the
+// line. On boot, capture_journal_recover() repairs only the files still listed, and only re-validates
+// the data written after their last checkpoint, so recovery time is bounded by the checkpoint policy.
+//
+// Like sd_writer, this only uses POSIX calls and builds on Linux for testing.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "managers/sd_writer.h"
+
+#ifdef CONFIG_CAPTURE_CHECKPOINT_INTERVAL_MS
+#define CAPTURE_CHECKPOINT_INTERVAL_MS CONFIG_CAPTURE_CHECKPOINT_INTERVAL_MS
+#define CAPTURE_CHECKPOINT_BYTES (CONFIG_CAPTURE_CHECKPOINT_KB * 1024)
+#else
+#define CAPTURE_CHECKPOINT_INTERVAL_MS 5000
+#define CAPTURE_CHECKPOINT_BYTES (64 * 1024)
+#endif
+
+#if defined(CONFIG_CAPTURE_COMPRESSION_LZ4)
+#define CAPTURE_DEFAULT_CODEC SD_WRITER_CODEC_LZ4
+#elif defined(CONFIG_CAPTURE_COMPRESSION_GZIP)
+#define CAPTURE_DEFAULT_CODEC SD_WRITER_CODEC_GZIP
+#else
+#define CAPTURE_DEFAULT_CODEC SD_WRITER_CODEC_NONE
+#endif
+#ifdef CONFIG_CAPTURE_COMPRESSION_LEVEL
+#define CAPTURE_DEFAULT_CODEC_LEVEL CONFIG_CAPTURE_COMPRESSION_LEVEL
+#else
+#define CAPTURE_DEFAULT_CODEC_LEVEL 0
+#endif
+
+#ifndef CAPTURE_JOURNAL_PATH
+#define CAPTURE_JOURNAL_PATH "/mnt/ghostesp/.capture_journal"
+#endif
+#define CAPTURE_JOURNAL_MAX_ENTRIES 8
+
+typedef enum {
+    CAPTURE_KIND_PCAP = 0,
+    CAPTURE_KIND_TEXT,          // Line oriented (CSV, hashcat 22000)
+} capture_kind_t;
+
+typedef enum {
+    CAPTURE_RECOVERY_INTACT = 0,
+    CAPTURE_RECOVERY_TRUNCATED,  // Partial trailing record or line removed
+    CAPTURE_RECOVERY_REMOVED,    // Nothing usable, file deleted
+    CAPTURE_RECOVERY_MISSING,
+    CAPTURE_RECOVERY_ERROR,
+} capture_recovery_action_t;
+
+typedef struct {
+    capture_recovery_action_t action;
+    uint64_t original_size;
+    uint64_t recovered_size;
+    uint32_t records_checked;    // Records or lines validated after the checkpoint
+} capture_recovery_result_t;
+
+// Producer-side checkpoint state, one per open capture
+typedef struct {
+    sd_writer_stream_t* stream;
+    char path[160];
+    int64_t last_us;
+    uint64_t last_offset;
+} capture_checkpoint_t;
+
+// Register an open capture; the file is considered dirty until capture_journal_close()
+esp_err_t capture_journal_open(capture_checkpoint_t* cp, sd_writer_stream_t* stream, const char* path, capture_kind_t kind);
+
+// Call after each complete record. Requests a writer checkpoint once the interval or byte budget is spent.
+void capture_journal_tick(capture_checkpoint_t* cp);
+
+// Call after sd_writer_close(); the file is complete and leaves the journal
+void capture_journal_close(capture_checkpoint_t* cp);
+
+// Repair a single file. checkpoint is a known good record boundary (0 to validate from the start).
+capture_recovery_result_t capture_recover_pcap(const char* path, uint64_t checkpoint);
+capture_recovery_result_t capture_recover_text(const char* path, uint64_t checkpoint);
+
+// Files written with sd_writer preallocation end in whatever the extra clusters held before, so
+// nothing past the checkpoint can be trusted; they are cut back to it
+capture_recovery_result_t capture_recover_preallocated(const char* path, capture_kind_t kind, uint64_t checkpoint);
+
+// Compressed files are cut back to the checkpoint, where the writer ended an LZ4 block or gzip member.
+// An LZ4 file then gets its end mark so the frame is complete again.
+capture_recovery_result_t capture_recover_compressed(const char* path, sd_writer_codec_t codec, uint64_t checkpoint);
+
+// Repair every file left open in the journal, then clear it. Returns the number of files repaired.
+int capture_journal_recover(void);
+
+const char* capture_recovery_action_str(capture_recovery_action_t action);
+
+// Compression for capture files opened from now on (pcap and GPS CSV); level 0 is the codec's default
+void capture_set_compression(sd_writer_codec_t codec, uint8_t level);
+sd_writer_codec_t capture_get_compression(uint8_t* level);
+
+#endif // CAPTURE_JOURNAL_H
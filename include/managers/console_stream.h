@@ -0,0 +1,65 @@
+#ifndef CONSOLE_STREAM_H
+#define CONSOLE_STREAM_H
+
+// Live console for the web UI.
+//
+// Console lines (the serial task's stdout, ESP_LOG output and ap_manager_add_log()) go into a
+// lock-free line ring; watchlist alerts go into a second one. GET /api/console hands its request to
+// one streaming task that keeps the connection open as Server-Sent Events and pushes whatever is new:
+// lines arriving within CONSOLE_STREAM_BATCH_MS leave as one chunk, capture counters follow every
+// second while a capture runs, and an idle stream gets a keepalive comment. A client that can't keep
+// up blocks only the streaming task, for at most the socket send timeout, and is then dropped;
+// producers never wait, and a client that falls behind the ring gets a "gap" event with the count.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <esp_err.h>
+#include <esp_http_server.h>
+#include "core/log_ring.h"
+
+#define CONSOLE_STREAM_MAX_CLIENTS 2
+#define CONSOLE_STREAM_BATCH_MS 25
+#define CONSOLE_STREAM_KEEPALIVE_MS 15000
+#define CONSOLE_STREAM_COUNTERS_MS 1000
+
+typedef struct {
+    uint32_t clients;
+    uint32_t clients_dropped;    // Send failed or timed out
+    uint32_t lines_sent;
+    uint32_t lines_lost;         // Reported to clients as gaps
+    uint32_t chunks_sent;
+    uint64_t bytes_sent;
+    uint32_t latency_us_last;    // First unsent line to its chunk being on the socket
+    uint32_t latency_us_max;
+    uint64_t latency_us_total;
+    uint32_t latency_samples;
+    uint64_t task_us_total;      // Time the streaming task spent formatting and sending
+} console_stream_stats_t;
+
+// Hook ESP_LOG output into the console ring
+void console_stream_init(void);
+
+typedef void (*console_stream_tee_fn)(const char* data, size_t len);
+
+// Mirror the calling task's stdout into the console ring (call from the task that runs commands);
+// also, if given, sees the same output
+void console_stream_capture_stdout(console_stream_tee_fn also);
+
+// Add text to the console ring. Safe from any task; never blocks.
+void console_stream_write(const char* text, size_t len);
+
+// Add text to the ring and print it on the serial console without going through a mirrored stdout
+void console_stream_log(const char* text);
+
+void console_stream_alert(const char* text);
+
+// Ring behind the one-shot /api/logs endpoint
+log_ring_t* console_stream_ring(void);
+
+// Take over a GET request and stream the console from cursor on. The handler returns right after;
+// ESP_ERR_NO_MEM means every client slot is taken.
+esp_err_t console_stream_attach(httpd_req_t* req, uint32_t cursor);
+
+void console_stream_get_stats(console_stream_stats_t* stats);
+
+#endif // CONSOLE_STREAM_H
@@ -0,0 +1,41 @@
+#ifndef DISPLAY_MIRROR_H
+#define DISPLAY_MIRROR_H
+
+// Remote view of the screen for the web UI's Screen tab, over a WebSocket at /ws/display.
+//
+// The display driver's flush callback hands every area it draws to display_mirror_flush(), which
+// returns at once unless a browser is connected; then core/screen_capture encodes a refresh
+// CONFIG_DISPLAY_MIRROR_FPS times a second and a task of its own sends each frame to every client as
+// one binary message, so a slow client never holds up drawing. Clients get a hello with the screen size
+// first and the whole screen over the next captures.
+//
+// Clients send input back as binary messages, queued to the current view like local input:
+//
+//   u8 0, u16 x, u16 y     touch at screen coordinates
+//   u8 1, u8 button        joystick button (0 left, 1 select, 2 up, 3 right, 4 down)
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <esp_err.h>
+#include <esp_http_server.h>
+#include "lvgl.h"
+
+#define DISPLAY_MIRROR_MAX_CLIENTS 2
+#define DISPLAY_MIRROR_TASK_STACK 3072
+
+#define DISPLAY_MIRROR_INPUT_TOUCH 0
+#define DISPLAY_MIRROR_INPUT_BUTTON 1
+
+// After the display driver is registered: sizes the capture for the default display, starts the task
+esp_err_t display_mirror_init(void);
+
+// Flush callbacks, before drawing (and before any in-place byte swap of pixels)
+void display_mirror_flush(lv_disp_drv_t* drv, const lv_area_t* area, const lv_color_t* pixels);
+
+// Render task, before lv_timer_handler(): redraw the next part of the screen the mirror is missing
+void display_mirror_poll(void);
+
+// GET /ws/display (is_websocket)
+esp_err_t display_mirror_ws_handler(httpd_req_t* req);
+
+#endif // DISPLAY_MIRROR_H
@@ -0,0 +1,86 @@
+#ifndef FILE_DOWNLOAD_H
+#define FILE_DOWNLOAD_H
+
+// Streams SD card files to HTTP clients.
+//
+// file_download_serve() writes a complete HTTP/1.1 response (status line, headers and body) through a
+// raw send callback, so the body goes out with a real Content-Length instead of chunked framing. It
+// handles single byte ranges (206/416), ETag/Last-Modified validators with 304 and If-Range, and
+// optionally gzips text files on the fly. The file is read in large aligned blocks by a helper thread
+// into two buffers, so the next SD read overlaps the socket send of the previous block.
+//
+// Only POSIX calls are used; scripts/host/file_server.c serves a directory with it on Linux.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <time.h>
+#include "managers/sd_writer.h"
+
+#ifdef CONFIG_DOWNLOAD_CHUNK_SIZE
+#define FILE_DOWNLOAD_CHUNK_SIZE CONFIG_DOWNLOAD_CHUNK_SIZE
+#else
+#define FILE_DOWNLOAD_CHUNK_SIZE (16 * 1024)
+#endif
+
+#ifdef CONFIG_DOWNLOAD_GZIP
+#define FILE_DOWNLOAD_GZIP 1
+#elif defined(ESP_PLATFORM)
+#define FILE_DOWNLOAD_GZIP 0
+#else
+#define FILE_DOWNLOAD_GZIP 1
+#endif
+
+#define FILE_DOWNLOAD_ALIGN 4096       // Reads after the first start on a cluster boundary
+#define FILE_DOWNLOAD_ETAG_LEN 40
+#define FILE_DOWNLOAD_DATE_LEN 32
+
+// Raw socket sink; must send all len bytes or fail
+typedef esp_err_t (*file_download_send_fn)(void* ctx, const char* data, size_t len);
+
+typedef struct {
+    const char* path;
+    const char* range;               // Request headers, NULL when absent
+    const char* if_range;
+    const char* if_none_match;
+    const char* if_modified_since;
+    const char* accept_encoding;
+    bool head_only;                  // Send the headers only
+    size_t chunk_size;               // 0 uses FILE_DOWNLOAD_CHUNK_SIZE
+    bool no_prefetch;                // Read and send from one buffer on the calling thread
+} file_download_request_t;
+
+typedef struct {
+    int status;
+    bool gzip;
+    uint64_t file_bytes;             // Bytes read from the file
+    uint64_t body_bytes;             // Bytes of body sent, after compression
+} file_download_result_t;
+
+typedef enum {
+    FILE_DOWNLOAD_RANGE_NONE = 0,    // No usable Range header, send the whole file
+    FILE_DOWNLOAD_RANGE_OK,
+    FILE_DOWNLOAD_RANGE_UNSATISFIABLE,
+} file_download_range_t;
+
+// Send the response for req. Fails only when the connection broke; HTTP errors are sent as responses.
+esp_err_t file_download_serve(const file_download_request_t* req, file_download_send_fn send_fn, void* ctx,
+                              file_download_result_t* result);
+
+// Parse a single "bytes=first-last", "bytes=first-" or "bytes=-suffix" range against size
+file_download_range_t file_download_parse_range(const char* header, uint64_t size, uint64_t* first, uint64_t* last);
+
+// Strong validator built from size and modification time
+void file_download_etag(uint64_t size, time_t mtime, char* out, size_t out_len);
+
+// True when an If-None-Match list holds etag or "*" (weak comparison)
+bool file_download_etag_matches(const char* list, const char* etag);
+
+// True when an Accept-Encoding value allows gzip: listed, or covered by "*", with a q above 0
+bool file_download_accepts_gzip(const char* accept_encoding);
+
+// RFC 7231 IMF-fixdate, e.g. "Sun, 06 Nov 1994 08:49:37 GMT"
+void file_download_http_date(time_t t, char* out, size_t out_len);
+bool file_download_parse_http_date(const char* str, time_t* out);
+
+#endif // FILE_DOWNLOAD_H
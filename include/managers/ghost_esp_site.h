@@ -1,3687 +1,1104 @@
 /* Generated by bin2c, do not edit manually */
 
-/* Contents of file ghost_site.html */
-const long int ghost_site_html_size = 58885;
-const unsigned char ghost_site_html[58885] = {
-    0x3C, 0x21, 0x44, 0x4F, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A,
-    0x3C, 0x68, 0x74, 0x6D, 0x6C, 0x20, 0x6C, 0x61, 0x6E, 0x67, 0x3D, 0x22, 0x65, 0x6E, 0x22, 0x3E,
-    0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6D, 0x65, 0x74,
-    0x61, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3D, 0x22, 0x55, 0x54, 0x46, 0x2D, 0x38,
-    0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x47, 0x68,
-    0x6F, 0x73, 0x74, 0x20, 0x45, 0x53, 0x50, 0x3C, 0x2F, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x6D, 0x65, 0x74, 0x61, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x22,
-    0x76, 0x69, 0x65, 0x77, 0x70, 0x6F, 0x72, 0x74, 0x22, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E,
-    0x74, 0x3D, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2D,
-    0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x69, 0x61, 0x6C, 0x2D, 0x73,
-    0x63, 0x61, 0x6C, 0x65, 0x3D, 0x31, 0x2E, 0x30, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x73, 0x74, 0x79, 0x6C, 0x65, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F,
-    0x2A, 0x20, 0x43, 0x53, 0x53, 0x20, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x20,
-    0x66, 0x6F, 0x72, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x46,
-    0x6F, 0x6E, 0x74, 0x73, 0x20, 0x2A, 0x2F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3A, 0x72, 0x6F, 0x6F, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64,
-    0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x70,
-    0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x66,
-    0x66, 0x35, 0x35, 0x30, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x2D, 0x2D, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x61, 0x72, 0x79, 0x2D, 0x63,
-    0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x31, 0x31, 0x30, 0x38, 0x30, 0x30, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x70, 0x72, 0x69,
-    0x6D, 0x61, 0x72, 0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2D, 0x66, 0x61, 0x64, 0x65, 0x64,
-    0x3A, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x35, 0x2C, 0x20, 0x38, 0x35, 0x2C, 0x20,
-    0x30, 0x2C, 0x20, 0x30, 0x2E, 0x37, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x2D, 0x63, 0x6F,
-    0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x35, 0x2C, 0x20, 0x38,
-    0x35, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x33, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74,
-    0x2D, 0x74, 0x6F, 0x6E, 0x65, 0x3A, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x35, 0x2C,
-    0x20, 0x38, 0x35, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x32, 0x29, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74,
-    0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x66, 0x66, 0x35, 0x35, 0x30, 0x30, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x62,
-    0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x66, 0x66,
-    0x35, 0x35, 0x30, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x2D, 0x2D, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x2D, 0x62, 0x67, 0x3A, 0x20,
-    0x23, 0x34, 0x30, 0x31, 0x38, 0x30, 0x35, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x2D, 0x74,
-    0x65, 0x78, 0x74, 0x3A, 0x20, 0x23, 0x66, 0x66, 0x35, 0x35, 0x30, 0x30, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x69, 0x6E, 0x70, 0x75,
-    0x74, 0x2D, 0x62, 0x67, 0x3A, 0x20, 0x23, 0x31, 0x31, 0x30, 0x38, 0x30, 0x30, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x69, 0x6E, 0x70,
-    0x75, 0x74, 0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x23, 0x66, 0x66, 0x35, 0x35,
-    0x30, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x2D, 0x2D, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x66, 0x61, 0x6D, 0x69, 0x6C, 0x79, 0x3A, 0x20, 0x27,
-    0x53, 0x65, 0x67, 0x6F, 0x65, 0x20, 0x55, 0x49, 0x27, 0x2C, 0x20, 0x54, 0x61, 0x68, 0x6F, 0x6D,
-    0x61, 0x2C, 0x20, 0x47, 0x65, 0x6E, 0x65, 0x76, 0x61, 0x2C, 0x20, 0x56, 0x65, 0x72, 0x64, 0x61,
-    0x6E, 0x61, 0x2C, 0x20, 0x73, 0x61, 0x6E, 0x73, 0x2D, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x66, 0x6F,
-    0x72, 0x65, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79,
-    0x3A, 0x20, 0x31, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x3A, 0x3A, 0x2D,
-    0x77, 0x65, 0x62, 0x6B, 0x69, 0x74, 0x2D, 0x6F, 0x75, 0x74, 0x65, 0x72, 0x2D, 0x73, 0x70, 0x69,
-    0x6E, 0x2D, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x3A, 0x3A, 0x2D, 0x77, 0x65, 0x62, 0x6B, 0x69, 0x74,
-    0x2D, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x2D, 0x73, 0x70, 0x69, 0x6E, 0x2D, 0x62, 0x75, 0x74, 0x74,
-    0x6F, 0x6E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x2D, 0x77, 0x65, 0x62, 0x6B, 0x69, 0x74, 0x2D, 0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x61,
-    0x6E, 0x63, 0x65, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x61, 0x6E, 0x63,
-    0x65, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x3A, 0x20, 0x30, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x2F, 0x2A, 0x20, 0x47, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x20, 0x53, 0x74, 0x79,
-    0x6C, 0x65, 0x73, 0x20, 0x2A, 0x2F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
-    0x6F, 0x64, 0x79, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x66, 0x61,
-    0x6D, 0x69, 0x6C, 0x79, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x66, 0x6F, 0x6E, 0x74,
-    0x2D, 0x66, 0x61, 0x6D, 0x69, 0x6C, 0x79, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64,
-    0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x61,
-    0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C,
-    0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x63,
-    0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x2D, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20,
-    0x31, 0x2E, 0x36, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E,
-    0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x6D, 0x61, 0x78, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x39, 0x30, 0x30, 0x70,
-    0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D,
-    0x61, 0x72, 0x67, 0x69, 0x6E, 0x3A, 0x20, 0x30, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69,
-    0x6E, 0x67, 0x3A, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x31, 0x2C,
-    0x20, 0x68, 0x32, 0x2C, 0x20, 0x68, 0x33, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x61, 0x6C, 0x69, 0x67, 0x6E,
-    0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72,
-    0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
-    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D,
-    0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x74, 0x6F, 0x70, 0x3A, 0x20, 0x35, 0x36, 0x70, 0x78, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72,
-    0x67, 0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x32, 0x34, 0x70, 0x78,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2A, 0x20, 0x54, 0x61, 0x62, 0x73, 0x20, 0x53, 0x74, 0x79,
-    0x6C, 0x69, 0x6E, 0x67, 0x20, 0x2A, 0x2F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x2E, 0x74, 0x61, 0x62, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6A, 0x75,
-    0x73, 0x74, 0x69, 0x66, 0x79, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3A, 0x20, 0x73,
-    0x70, 0x61, 0x63, 0x65, 0x2D, 0x61, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A,
-    0x20, 0x32, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D,
-    0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72,
-    0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x31, 0x32, 0x70, 0x78,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61,
-    0x72, 0x67, 0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x33, 0x30, 0x70,
-    0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70,
-    0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x34, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x2E, 0x74, 0x61, 0x62, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x7B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x78, 0x2D, 0x77, 0x69,
-    0x64, 0x74, 0x68, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3A, 0x20, 0x31, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B,
-    0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72,
-    0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75,
-    0x73, 0x3A, 0x20, 0x36, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x6F, 0x75, 0x74, 0x6C, 0x69, 0x6E, 0x65, 0x3A, 0x20, 0x6E, 0x6F, 0x6E,
-    0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
-    0x75, 0x72, 0x73, 0x6F, 0x72, 0x3A, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64,
-    0x69, 0x6E, 0x67, 0x3A, 0x20, 0x31, 0x35, 0x70, 0x78, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x3A,
-    0x20, 0x30, 0x20, 0x32, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20, 0x31,
-    0x38, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72,
-    0x69, 0x6D, 0x61, 0x72, 0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72,
-    0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28,
-    0x2D, 0x2D, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x61, 0x72, 0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F,
-    0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x62, 0x61, 0x63, 0x6B,
-    0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x30, 0x2E, 0x33,
-    0x73, 0x2C, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x30, 0x2E, 0x33, 0x73, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x2E, 0x74, 0x61, 0x62, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3A, 0x66, 0x69,
-    0x72, 0x73, 0x74, 0x2D, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x6C,
-    0x65, 0x66, 0x74, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x61, 0x62, 0x20,
-    0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3A, 0x6C, 0x61, 0x73, 0x74, 0x2D, 0x63, 0x68, 0x69, 0x6C,
-    0x64, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x30, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x61, 0x62, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3A,
-    0x68, 0x6F, 0x76, 0x65, 0x72, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E,
-    0x74, 0x61, 0x62, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x2E, 0x61, 0x63, 0x74, 0x69, 0x76,
-    0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
-    0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x2D, 0x74,
-    0x6F, 0x6E, 0x65, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2A, 0x20, 0x54, 0x61, 0x62, 0x20, 0x43, 0x6F, 0x6E, 0x74,
-    0x65, 0x6E, 0x74, 0x20, 0x2A, 0x2F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E,
-    0x74, 0x61, 0x62, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79,
-    0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x61, 0x6E, 0x69, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x66,
-    0x61, 0x64, 0x65, 0x45, 0x66, 0x66, 0x65, 0x63, 0x74, 0x20, 0x30, 0x2E, 0x35, 0x73, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x2E, 0x74, 0x61, 0x62, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2E, 0x73,
-    0x68, 0x6F, 0x77, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x6B, 0x65, 0x79, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x20,
-    0x66, 0x61, 0x64, 0x65, 0x45, 0x66, 0x66, 0x65, 0x63, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x7B, 0x6F,
-    0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3A, 0x20, 0x30, 0x3B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x20, 0x7B, 0x6F, 0x70, 0x61, 0x63,
-    0x69, 0x74, 0x79, 0x3A, 0x20, 0x31, 0x3B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x62, 0x72, 0x65,
-    0x61, 0x64, 0x63, 0x72, 0x75, 0x6D, 0x62, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66,
-    0x6C, 0x65, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x66, 0x6C, 0x65, 0x78, 0x2D, 0x77, 0x72, 0x61, 0x70, 0x3A, 0x20, 0x77, 0x72, 0x61, 0x70,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C,
-    0x69, 0x67, 0x6E, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65,
-    0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D,
-    0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x32, 0x30,
-    0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x62, 0x72, 0x65, 0x61, 0x64, 0x63, 0x72, 0x75,
-    0x6D, 0x62, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72,
-    0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
-    0x2D, 0x66, 0x61, 0x64, 0x65, 0x64, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6F, 0x72, 0x3A, 0x20, 0x70, 0x6F, 0x69,
-    0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20,
-    0x38, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74,
-    0x69, 0x76, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x34, 0x70, 0x78, 0x20, 0x30, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E,
-    0x74, 0x2D, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x62, 0x6F, 0x6C, 0x64, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E,
-    0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x30, 0x2E,
-    0x33, 0x73, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x62, 0x72, 0x65, 0x61, 0x64, 0x63, 0x72, 0x75,
-    0x6D, 0x62, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x3A, 0x68, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x7B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F,
-    0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79,
-    0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x62, 0x72, 0x65,
-    0x61, 0x64, 0x63, 0x72, 0x75, 0x6D, 0x62, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x3A, 0x3A, 0x61, 0x66,
-    0x74, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3A, 0x20, 0x27, 0x2F, 0x27, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67,
-    0x69, 0x6E, 0x2D, 0x6C, 0x65, 0x66, 0x74, 0x3A, 0x20, 0x38, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-    0x20, 0x23, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x37, 0x66, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E,
-    0x62, 0x72, 0x65, 0x61, 0x64, 0x63, 0x72, 0x75, 0x6D, 0x62, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x3A,
-    0x6C, 0x61, 0x73, 0x74, 0x2D, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x3A, 0x3A, 0x61, 0x66, 0x74, 0x65,
-    0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3A, 0x20, 0x27, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x2E, 0x62, 0x72, 0x65, 0x61, 0x64, 0x63, 0x72, 0x75, 0x6D, 0x62, 0x2D, 0x69, 0x74, 0x65, 0x6D,
-    0x3A, 0x6C, 0x61, 0x73, 0x74, 0x2D, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x20, 0x7B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6F, 0x72,
-    0x3A, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D,
-    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2A, 0x20, 0x46, 0x69, 0x6C,
-    0x65, 0x20, 0x45, 0x78, 0x70, 0x6C, 0x6F, 0x72, 0x65, 0x72, 0x20, 0x53, 0x74, 0x79, 0x6C, 0x69,
-    0x6E, 0x67, 0x20, 0x2A, 0x2F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x66,
-    0x69, 0x6C, 0x65, 0x2D, 0x65, 0x78, 0x70, 0x6C, 0x6F, 0x72, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x2D,
-    0x73, 0x74, 0x79, 0x6C, 0x65, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61,
-    0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x66, 0x69,
-    0x6C, 0x65, 0x2D, 0x65, 0x78, 0x70, 0x6C, 0x6F, 0x72, 0x65, 0x72, 0x20, 0x6C, 0x69, 0x20, 0x7B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69,
-    0x67, 0x68, 0x74, 0x3A, 0x20, 0x33, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20,
-    0x66, 0x6C, 0x65, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x3A, 0x20, 0x63,
-    0x65, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x6A, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65,
-    0x6E, 0x74, 0x3A, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x2D, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65,
-    0x6E, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70,
-    0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x31, 0x35, 0x70,
-    0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70,
-    0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76,
-    0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
-    0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-    0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x61, 0x72, 0x79,
-    0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x6C, 0x65, 0x66, 0x74,
-    0x3A, 0x20, 0x32, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28,
-    0x2D, 0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72,
-    0x64, 0x65, 0x72, 0x2D, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x32, 0x70, 0x78, 0x20, 0x73,
-    0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65,
-    0x72, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x74, 0x6F, 0x70,
-    0x3A, 0x20, 0x30, 0x2E, 0x35, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61,
-    0x72, 0x28, 0x2D, 0x2D, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
-    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
-    0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x30, 0x2E,
-    0x35, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D,
-    0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65,
-    0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D,
-    0x6C, 0x69, 0x2D, 0x62, 0x72, 0x2D, 0x74, 0x6F, 0x70, 0x29, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D,
-    0x2D, 0x6C, 0x69, 0x2D, 0x62, 0x72, 0x2D, 0x74, 0x6F, 0x70, 0x29, 0x20, 0x76, 0x61, 0x72, 0x28,
-    0x2D, 0x2D, 0x6C, 0x69, 0x2D, 0x62, 0x72, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x29, 0x20,
-    0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x6C, 0x69, 0x2D, 0x62, 0x72, 0x2D, 0x62, 0x6F, 0x74, 0x74,
-    0x6F, 0x6D, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x62, 0x61, 0x63,
-    0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x30, 0x2E,
-    0x33, 0x73, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x2D, 0x2D, 0x6C, 0x69, 0x2D, 0x62, 0x72, 0x2D, 0x74, 0x6F, 0x70, 0x3A, 0x20, 0x30, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x6C, 0x69,
-    0x2D, 0x62, 0x72, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x2E, 0x66, 0x69, 0x6C, 0x65, 0x2D, 0x65, 0x78, 0x70, 0x6C, 0x6F, 0x72, 0x65, 0x72,
-    0x20, 0x6C, 0x69, 0x3A, 0x68, 0x6F, 0x76, 0x65, 0x72, 0x3A, 0x68, 0x61, 0x73, 0x28, 0x2E, 0x66,
-    0x69, 0x6C, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x2E, 0x66, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x29,
-    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
-    0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-    0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x2D, 0x74, 0x6F,
-    0x6E, 0x65, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x63, 0x75, 0x72, 0x73, 0x6F, 0x72, 0x3A, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x66, 0x69, 0x6C, 0x65, 0x2D, 0x65, 0x78, 0x70, 0x6C, 0x6F,
-    0x72, 0x65, 0x72, 0x20, 0x6C, 0x69, 0x3A, 0x66, 0x69, 0x72, 0x73, 0x74, 0x2D, 0x63, 0x68, 0x69,
-    0x6C, 0x64, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x74, 0x6F, 0x70, 0x3A, 0x20, 0x32, 0x70, 0x78,
-    0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x6F, 0x72,
-    0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x6C, 0x69, 0x2D, 0x62, 0x72, 0x2D,
-    0x74, 0x6F, 0x70, 0x3A, 0x20, 0x38, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x66, 0x69,
-    0x6C, 0x65, 0x2D, 0x65, 0x78, 0x70, 0x6C, 0x6F, 0x72, 0x65, 0x72, 0x20, 0x6C, 0x69, 0x3A, 0x6C,
-    0x61, 0x73, 0x74, 0x2D, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x62,
-    0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x32, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64,
-    0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F,
-    0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x2D, 0x2D, 0x6C, 0x69, 0x2D, 0x62, 0x72, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D,
-    0x3A, 0x20, 0x38, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D,
-    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x66, 0x69, 0x6C, 0x65, 0x2D,
-    0x65, 0x78, 0x70, 0x6C, 0x6F, 0x72, 0x65, 0x72, 0x20, 0x6C, 0x69, 0x3A, 0x62, 0x65, 0x66, 0x6F,
-    0x72, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3A, 0x20, 0x27, 0x27, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69,
-    0x6F, 0x6E, 0x3A, 0x20, 0x61, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3A,
-    0x20, 0x31, 0x35, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x74, 0x6F, 0x70, 0x3A, 0x20, 0x35, 0x34, 0x25, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F,
-    0x72, 0x6D, 0x3A, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x59, 0x28, 0x2D,
-    0x35, 0x30, 0x25, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x2D, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x73,
-    0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D,
-    0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E,
-    0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20, 0x31, 0x34, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x2E, 0x66, 0x69, 0x6C, 0x65, 0x2D, 0x65, 0x78, 0x70, 0x6C, 0x6F, 0x72, 0x65, 0x72, 0x20,
-    0x6C, 0x69, 0x3A, 0x68, 0x61, 0x73, 0x28, 0x2E, 0x66, 0x69, 0x6C, 0x65, 0x2D, 0x6E, 0x61, 0x6D,
-    0x65, 0x2E, 0x66, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x29, 0x3A, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65,
-    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
-    0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3A, 0x20, 0x27, 0x5C, 0x32, 0x35, 0x42, 0x36, 0x27, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x2E, 0x66, 0x69, 0x6C, 0x65, 0x2D, 0x65, 0x78, 0x70, 0x6C, 0x6F, 0x72,
-    0x65, 0x72, 0x20, 0x6C, 0x69, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x7B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69,
-    0x6E, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x66, 0x69, 0x6C, 0x65, 0x2D, 0x65,
-    0x78, 0x70, 0x6C, 0x6F, 0x72, 0x65, 0x72, 0x20, 0x2E, 0x66, 0x69, 0x6C, 0x65, 0x2D, 0x6E, 0x61,
-    0x6D, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x69, 0x67,
-    0x6E, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72,
-    0x73, 0x6F, 0x72, 0x3A, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x2E, 0x66, 0x69, 0x6C, 0x65, 0x2D, 0x65, 0x78, 0x70, 0x6C, 0x6F, 0x72, 0x65, 0x72, 0x20,
-    0x2E, 0x66, 0x69, 0x6C, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x2E, 0x66, 0x6F, 0x6C, 0x64, 0x65,
-    0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x63, 0x75, 0x72, 0x73, 0x6F, 0x72, 0x3A, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C,
-    0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72,
-    0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x66, 0x69,
-    0x6C, 0x65, 0x2D, 0x65, 0x78, 0x70, 0x6C, 0x6F, 0x72, 0x65, 0x72, 0x20, 0x2E, 0x66, 0x69, 0x6C,
-    0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x2E, 0x66, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x3A, 0x3A, 0x62,
-    0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3A, 0x20, 0x27, 0xF0, 0x9F,
-    0x93, 0x81, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x31,
-    0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x66, 0x69, 0x6C, 0x65, 0x2D, 0x65, 0x78,
-    0x70, 0x6C, 0x6F, 0x72, 0x65, 0x72, 0x20, 0x2E, 0x66, 0x69, 0x6C, 0x65, 0x2D, 0x6E, 0x61, 0x6D,
-    0x65, 0x2E, 0x66, 0x69, 0x6C, 0x65, 0x3A, 0x3A, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x7B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E,
-    0x74, 0x65, 0x6E, 0x74, 0x3A, 0x20, 0x27, 0xF0, 0x9F, 0x93, 0x84, 0x27, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E,
-    0x2D, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x2E, 0x66, 0x69, 0x6C, 0x65, 0x2D, 0x65, 0x78, 0x70, 0x6C, 0x6F, 0x72, 0x65, 0x72, 0x20,
-    0x2E, 0x66, 0x69, 0x6C, 0x65, 0x2D, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x7B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70,
-    0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3A, 0x20, 0x31, 0x35, 0x70, 0x78,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2A, 0x20, 0x55, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x53,
-    0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x53, 0x74, 0x79, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x2A,
-    0x2F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x75, 0x70, 0x6C, 0x6F, 0x61,
-    0x64, 0x2D, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x74,
-    0x6F, 0x70, 0x3A, 0x20, 0x33, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x32,
-    0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F,
-    0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x61,
-    0x72, 0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x32,
-    0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62,
-    0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72,
-    0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x38, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x2E, 0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x2D, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E,
-    0x20, 0x3E, 0x20, 0x3A, 0x66, 0x69, 0x72, 0x73, 0x74, 0x2D, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x20,
-    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61,
-    0x72, 0x67, 0x69, 0x6E, 0x2D, 0x74, 0x6F, 0x70, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x2E, 0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x2D, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
-    0x3E, 0x20, 0x3A, 0x6C, 0x61, 0x73, 0x74, 0x2D, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x20, 0x7B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67,
-    0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x2E, 0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x2D, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E,
-    0x20, 0x68, 0x33, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x3A, 0x20, 0x63, 0x65,
-    0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70,
-    0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69,
-    0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x2E, 0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x2D, 0x73, 0x65, 0x63, 0x74, 0x69,
-    0x6F, 0x6E, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x5B, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x66,
-    0x69, 0x6C, 0x65, 0x22, 0x5D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x31, 0x30, 0x70,
-    0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
-    0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20, 0x31, 0x36, 0x70, 0x78, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B,
-    0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61,
-    0x72, 0x28, 0x2D, 0x2D, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x62, 0x67, 0x29, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65,
-    0x72, 0x3A, 0x20, 0x32, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72,
-    0x28, 0x2D, 0x2D, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x29,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F,
-    0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x2D,
-    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75,
-    0x73, 0x3A, 0x20, 0x36, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20,
-    0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x30, 0x2E, 0x33,
-    0x73, 0x2C, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F,
-    0x6C, 0x6F, 0x72, 0x20, 0x30, 0x2E, 0x33, 0x73, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x75, 0x70,
-    0x6C, 0x6F, 0x61, 0x64, 0x2D, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x6E, 0x70,
-    0x75, 0x74, 0x5B, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x66, 0x69, 0x6C, 0x65, 0x22, 0x5D, 0x3A,
-    0x66, 0x6F, 0x63, 0x75, 0x73, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
-    0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x2D,
-    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63,
-    0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x31, 0x61, 0x30, 0x64, 0x30, 0x30, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x75, 0x74, 0x6C, 0x69,
-    0x6E, 0x65, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x75, 0x70,
-    0x6C, 0x6F, 0x61, 0x64, 0x2D, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x75, 0x74,
-    0x74, 0x6F, 0x6E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x31, 0x35, 0x30, 0x70, 0x78, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x2F, 0x2A, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x47,
-    0x72, 0x69, 0x64, 0x20, 0x2A, 0x2F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E,
-    0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2D, 0x67, 0x72, 0x69, 0x64, 0x20, 0x7B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70,
-    0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x2D, 0x77, 0x72, 0x61, 0x70,
-    0x3A, 0x20, 0x77, 0x72, 0x61, 0x70, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3A, 0x20, 0x32, 0x38, 0x70, 0x78, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x2E, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2D, 0x73, 0x65, 0x63, 0x74,
-    0x69, 0x6F, 0x6E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3A, 0x20, 0x31, 0x20, 0x31, 0x20, 0x63, 0x61, 0x6C, 0x63,
-    0x28, 0x35, 0x30, 0x25, 0x20, 0x2D, 0x20, 0x32, 0x30, 0x70, 0x78, 0x29, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72,
-    0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28,
-    0x2D, 0x2D, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x61, 0x72, 0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F,
-    0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x32, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69,
-    0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x63,
-    0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x32, 0x30, 0x70, 0x78,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F,
-    0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x31, 0x32, 0x70,
-    0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70,
-    0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76,
-    0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2D,
-    0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3E, 0x20, 0x3A, 0x66, 0x69, 0x72, 0x73, 0x74,
-    0x2D, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x74, 0x6F, 0x70, 0x3A,
-    0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73,
-    0x2D, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3E, 0x20, 0x3A, 0x6C, 0x61, 0x73, 0x74,
-    0x2D, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74,
-    0x6F, 0x6D, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D,
-    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x6D, 0x65, 0x64, 0x69, 0x61,
-    0x20, 0x28, 0x6D, 0x61, 0x78, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x37, 0x36, 0x38,
-    0x70, 0x78, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x2E, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2D, 0x73, 0x65, 0x63, 0x74,
-    0x69, 0x6F, 0x6E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3A, 0x20, 0x31, 0x20, 0x31, 0x20,
-    0x31, 0x30, 0x30, 0x25, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x7B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C,
-    0x61, 0x79, 0x3A, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x62, 0x6F,
-    0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x34, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65,
-    0x3A, 0x20, 0x31, 0x36, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x69, 0x6E, 0x70, 0x75,
-    0x74, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74,
-    0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x32, 0x34, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x61, 0x6C, 0x69, 0x67,
-    0x6E, 0x3A, 0x20, 0x6C, 0x65, 0x66, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x69, 0x6E, 0x70,
-    0x75, 0x74, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x3A, 0x68, 0x61, 0x73, 0x28, 0x69, 0x6E, 0x70,
-    0x75, 0x74, 0x5B, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x66, 0x69, 0x6C, 0x65, 0x22, 0x5D, 0x29,
-    0x2C, 0x20, 0x2E, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x3A, 0x68,
-    0x61, 0x73, 0x28, 0x2E, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x2D, 0x73, 0x77, 0x69, 0x74, 0x63,
-    0x68, 0x29, 0x2C, 0x20, 0x2E, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70,
-    0x3A, 0x68, 0x61, 0x73, 0x28, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x2D, 0x77, 0x72, 0x61,
-    0x70, 0x70, 0x65, 0x72, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65,
-    0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6A,
-    0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3A, 0x20,
-    0x73, 0x70, 0x61, 0x63, 0x65, 0x2D, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x5B, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x6E, 0x75,
-    0x6D, 0x62, 0x65, 0x72, 0x22, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x69, 0x6E, 0x70, 0x75, 0x74, 0x5B, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74,
-    0x22, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x70, 0x75,
-    0x74, 0x5B, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x22, 0x5D, 0x2C,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x2C,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x61, 0x72, 0x65,
-    0x61, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67,
-    0x3A, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x31, 0x35, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x66, 0x61,
-    0x6D, 0x69, 0x6C, 0x79, 0x3A, 0x20, 0x69, 0x6E, 0x68, 0x65, 0x72, 0x69, 0x74, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D,
-    0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20, 0x31, 0x36, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75,
-    0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D,
-    0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x62, 0x67, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x32,
-    0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x69,
-    0x6E, 0x70, 0x75, 0x74, 0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-    0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x63, 0x6F, 0x6C, 0x6F,
-    0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x36,
-    0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x74, 0x6F, 0x70, 0x3A, 0x20, 0x34, 0x70, 0x78, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x78,
-    0x2D, 0x73, 0x69, 0x7A, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D,
-    0x62, 0x6F, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x62, 0x6F, 0x72,
-    0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x30, 0x2E, 0x33, 0x73, 0x2C, 0x20,
-    0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
-    0x20, 0x30, 0x2E, 0x33, 0x73, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D,
-    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x5B,
-    0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x5D, 0x3A, 0x66,
-    0x6F, 0x63, 0x75, 0x73, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E,
-    0x70, 0x75, 0x74, 0x5B, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x5D,
-    0x3A, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x69, 0x6E, 0x70, 0x75, 0x74, 0x5B, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x63, 0x6F, 0x6C, 0x6F,
-    0x72, 0x22, 0x5D, 0x3A, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x3A, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x2C,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x61, 0x72, 0x65,
-    0x61, 0x3A, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F, 0x6C,
-    0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72,
-    0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64,
-    0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x31, 0x61, 0x30, 0x64, 0x30, 0x30, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x75, 0x74,
-    0x6C, 0x69, 0x6E, 0x65, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F,
-    0x2A, 0x20, 0x54, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x20, 0x53, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20,
-    0x2A, 0x2F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x6F, 0x67, 0x67,
-    0x6C, 0x65, 0x2D, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E,
-    0x3A, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x36,
-    0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x33, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69,
-    0x6E, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65,
-    0x2D, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x7B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x70, 0x61, 0x63,
-    0x69, 0x74, 0x79, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74,
-    0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x73, 0x6C, 0x69, 0x64, 0x65, 0x72, 0x20,
-    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F,
-    0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x61, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75,
-    0x72, 0x73, 0x6F, 0x72, 0x3A, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67,
-    0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72,
-    0x28, 0x2D, 0x2D, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F,
-    0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x33, 0x34, 0x70,
-    0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74,
-    0x6F, 0x70, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x6C, 0x65, 0x66, 0x74, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x30,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F,
-    0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A,
-    0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F,
-    0x72, 0x20, 0x30, 0x2E, 0x34, 0x73, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x73, 0x6C, 0x69, 0x64,
-    0x65, 0x72, 0x3A, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E,
-    0x3A, 0x20, 0x61, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3A,
-    0x20, 0x22, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x32, 0x32, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72,
-    0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28,
-    0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F,
-    0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x35, 0x30, 0x25,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x65,
-    0x66, 0x74, 0x3A, 0x20, 0x34, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x34, 0x70, 0x78,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73,
-    0x70, 0x65, 0x63, 0x74, 0x2D, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x3A, 0x20, 0x31, 0x20, 0x2F, 0x20,
-    0x31, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74,
-    0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73,
-    0x66, 0x6F, 0x72, 0x6D, 0x20, 0x30, 0x2E, 0x34, 0x73, 0x2C, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67,
-    0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x30, 0x2E, 0x34, 0x73,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x3A, 0x63, 0x68, 0x65, 0x63, 0x6B,
-    0x65, 0x64, 0x20, 0x2B, 0x20, 0x2E, 0x73, 0x6C, 0x69, 0x64, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67,
-    0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72,
-    0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
-    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x3A, 0x63, 0x68, 0x65, 0x63,
-    0x6B, 0x65, 0x64, 0x20, 0x2B, 0x20, 0x2E, 0x73, 0x6C, 0x69, 0x64, 0x65, 0x72, 0x3A, 0x62, 0x65,
-    0x66, 0x6F, 0x72, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F,
-    0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x61, 0x63, 0x6B, 0x67,
-    0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66,
-    0x6F, 0x72, 0x6D, 0x3A, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x58, 0x28,
-    0x32, 0x38, 0x70, 0x78, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D,
-    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2A, 0x20, 0x42, 0x75, 0x74,
-    0x74, 0x6F, 0x6E, 0x73, 0x20, 0x2A, 0x2F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D,
-    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x73, 0x65, 0x63,
-    0x6F, 0x6E, 0x64, 0x61, 0x72, 0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
-    0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x2D,
-    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x31, 0x32, 0x70,
-    0x78, 0x20, 0x32, 0x35, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x32, 0x70, 0x78, 0x20,
-    0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x6F, 0x72, 0x64,
-    0x65, 0x72, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61,
-    0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x36, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6F, 0x72, 0x3A, 0x20, 0x70,
-    0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20, 0x31,
-    0x36, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x36, 0x30,
-    0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D,
-    0x61, 0x72, 0x67, 0x69, 0x6E, 0x3A, 0x20, 0x33, 0x32, 0x70, 0x78, 0x20, 0x61, 0x75, 0x74, 0x6F,
-    0x20, 0x32, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x62, 0x6C, 0x6F, 0x63,
-    0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74,
-    0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67,
-    0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x30, 0x2E, 0x33, 0x73,
-    0x2C, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x30, 0x2E, 0x33, 0x73, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x78, 0x2D, 0x77, 0x69,
-    0x64, 0x74, 0x68, 0x3A, 0x20, 0x32, 0x32, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x31,
-    0x30, 0x30, 0x25, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3A, 0x68,
-    0x6F, 0x76, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F,
-    0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x61, 0x63, 0x63, 0x65, 0x6E,
-    0x74, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x2E,
-    0x73, 0x6D, 0x61, 0x6C, 0x6C, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x36, 0x70, 0x78,
-    0x20, 0x32, 0x35, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74,
-    0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20, 0x31, 0x34, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x2F, 0x2A, 0x20, 0x54, 0x65, 0x78, 0x74, 0x61, 0x72, 0x65, 0x61, 0x20, 0x2A, 0x2F, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x61, 0x72, 0x65, 0x61, 0x20,
-    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
-    0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6C, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x69, 0x6E, 0x2D,
-    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x38, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x2F, 0x2A, 0x20, 0x53, 0x44, 0x20, 0x43, 0x61, 0x72, 0x64, 0x20, 0x45, 0x78, 0x70, 0x6C,
-    0x6F, 0x72, 0x65, 0x72, 0x20, 0x2A, 0x2F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x23, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x2E, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F,
-    0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D,
-    0x2D, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x61, 0x72, 0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
-    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
-    0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D,
-    0x61, 0x72, 0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A,
-    0x20, 0x32, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x33, 0x30, 0x30, 0x70, 0x78,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x76,
-    0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x2D, 0x79, 0x3A, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74,
-    0x2D, 0x66, 0x61, 0x6D, 0x69, 0x6C, 0x79, 0x3A, 0x20, 0x27, 0x43, 0x6F, 0x75, 0x72, 0x69, 0x65,
-    0x72, 0x20, 0x4E, 0x65, 0x77, 0x27, 0x2C, 0x20, 0x43, 0x6F, 0x75, 0x72, 0x69, 0x65, 0x72, 0x2C,
-    0x20, 0x6D, 0x6F, 0x6E, 0x6F, 0x73, 0x70, 0x61, 0x63, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x74, 0x65, 0x2D, 0x73, 0x70,
-    0x61, 0x63, 0x65, 0x3A, 0x20, 0x70, 0x72, 0x65, 0x2D, 0x77, 0x72, 0x61, 0x70, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65,
-    0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x38, 0x70, 0x78, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69,
-    0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64,
-    0x65, 0x72, 0x3A, 0x20, 0x32, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61,
-    0x72, 0x28, 0x2D, 0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
-    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2A, 0x20, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20,
-    0x57, 0x72, 0x61, 0x70, 0x70, 0x65, 0x72, 0x20, 0x2A, 0x2F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x2D, 0x77, 0x72, 0x61, 0x70, 0x70,
-    0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74,
-    0x69, 0x76, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x78, 0x2D, 0x77, 0x69,
-    0x64, 0x74, 0x68, 0x3A, 0x20, 0x33, 0x30, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x3A, 0x20,
-    0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x2D, 0x77, 0x72,
-    0x61, 0x70, 0x70, 0x65, 0x72, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x7B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68,
-    0x3A, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x31, 0x30, 0x70,
-    0x78, 0x20, 0x31, 0x35, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20, 0x31,
-    0x36, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F,
-    0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x62,
-    0x67, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x32, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69,
-    0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x62, 0x6F,
-    0x72, 0x64, 0x65, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D,
-    0x74, 0x65, 0x78, 0x74, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D,
-    0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x36, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x61,
-    0x6E, 0x63, 0x65, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6F, 0x72, 0x3A, 0x20, 0x70,
-    0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x2D, 0x77, 0x65, 0x62, 0x6B, 0x69, 0x74, 0x2D, 0x61, 0x70, 0x70, 0x65,
-    0x61, 0x72, 0x61, 0x6E, 0x63, 0x65, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x6D, 0x6F, 0x7A, 0x2D, 0x61,
-    0x70, 0x70, 0x65, 0x61, 0x72, 0x61, 0x6E, 0x63, 0x65, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63,
-    0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x3A, 0x20, 0x6E,
-    0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x62, 0x6F, 0x72,
-    0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x30, 0x2E, 0x33, 0x73, 0x2C, 0x20,
-    0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
-    0x20, 0x30, 0x2E, 0x33, 0x73, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D,
-    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63,
-    0x74, 0x2D, 0x77, 0x72, 0x61, 0x70, 0x70, 0x65, 0x72, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74,
-    0x3A, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F, 0x6C, 0x6F,
-    0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79,
-    0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D,
-    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x31, 0x61, 0x30, 0x64, 0x30, 0x30, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x75, 0x74, 0x6C,
-    0x69, 0x6E, 0x65, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x73,
-    0x65, 0x6C, 0x65, 0x63, 0x74, 0x2D, 0x77, 0x72, 0x61, 0x70, 0x70, 0x65, 0x72, 0x3A, 0x3A, 0x61,
-    0x66, 0x74, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3A, 0x20, 0x27, 0x5C, 0x32, 0x35,
-    0x42, 0x43, 0x27, 0x3B, 0x20, 0x2F, 0x2A, 0x20, 0x44, 0x6F, 0x77, 0x6E, 0x20, 0x61, 0x72, 0x72,
-    0x6F, 0x77, 0x20, 0x2A, 0x2F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x61, 0x62, 0x73, 0x6F,
-    0x6C, 0x75, 0x74, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x31, 0x35, 0x70, 0x78, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x70, 0x3A, 0x20,
-    0x35, 0x34, 0x25, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x3A, 0x20, 0x74, 0x72, 0x61, 0x6E,
-    0x73, 0x6C, 0x61, 0x74, 0x65, 0x59, 0x28, 0x2D, 0x35, 0x30, 0x25, 0x29, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65,
-    0x72, 0x2D, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x73, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F,
-    0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79,
-    0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20,
-    0x31, 0x34, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x66, 0x69, 0x6C, 0x65, 0x2D, 0x77,
-    0x72, 0x61, 0x70, 0x70, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C,
-    0x65, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x3A, 0x20, 0x63, 0x65, 0x6E,
-    0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x66, 0x69, 0x6C, 0x65, 0x2D, 0x77, 0x72,
-    0x61, 0x70, 0x70, 0x65, 0x72, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x7B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69,
-    0x6E, 0x3A, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x2E, 0x66, 0x69, 0x6C, 0x65, 0x2D, 0x77, 0x72, 0x61, 0x70, 0x70, 0x65, 0x72, 0x20,
-    0x69, 0x6E, 0x70, 0x75, 0x74, 0x5B, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x66, 0x69, 0x6C, 0x65,
-    0x22, 0x5D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x2E, 0x66, 0x69, 0x6C, 0x65, 0x2D, 0x77, 0x72, 0x61, 0x70, 0x70, 0x65, 0x72,
-    0x20, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x37, 0x66, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x6D, 0x61, 0x78, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x32, 0x30, 0x30,
-    0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2A, 0x20, 0x54, 0x6F, 0x6F, 0x6C, 0x74, 0x69,
-    0x70, 0x20, 0x53, 0x74, 0x79, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x2A, 0x2F, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x20, 0x7B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x73, 0x69,
-    0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70,
-    0x6C, 0x61, 0x79, 0x3A, 0x20, 0x69, 0x6E, 0x6C, 0x69, 0x6E, 0x65, 0x2D, 0x62, 0x6C, 0x6F, 0x63,
-    0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
-    0x75, 0x72, 0x73, 0x6F, 0x72, 0x3A, 0x20, 0x68, 0x65, 0x6C, 0x70, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D,
-    0x6C, 0x65, 0x66, 0x74, 0x3A, 0x20, 0x35, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74,
-    0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x20, 0x2E, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x74,
-    0x65, 0x78, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x76, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x3A, 0x20, 0x68, 0x69,
-    0x64, 0x64, 0x65, 0x6E, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x32, 0x32, 0x30, 0x70, 0x78, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B,
-    0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61,
-    0x72, 0x28, 0x2D, 0x2D, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x2D, 0x62, 0x67, 0x29, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C,
-    0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69,
-    0x70, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x3A,
-    0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69,
-    0x75, 0x73, 0x3A, 0x20, 0x36, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x32, 0x70, 0x78,
-    0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69,
-    0x6D, 0x61, 0x72, 0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x3A,
-    0x20, 0x64, 0x72, 0x6F, 0x70, 0x2D, 0x73, 0x68, 0x61, 0x64, 0x6F, 0x77, 0x28, 0x30, 0x20, 0x30,
-    0x20, 0x31, 0x33, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x28, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20,
-    0x2F, 0x20, 0x30, 0x2E, 0x33, 0x29, 0x29, 0x20, 0x64, 0x72, 0x6F, 0x70, 0x2D, 0x73, 0x68, 0x61,
-    0x64, 0x6F, 0x77, 0x28, 0x30, 0x20, 0x30, 0x20, 0x35, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x28,
-    0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x2F, 0x20, 0x30, 0x2E, 0x38, 0x29, 0x29, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69,
-    0x6E, 0x67, 0x3A, 0x20, 0x38, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x61,
-    0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x7A, 0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x3A, 0x20, 0x31, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x74,
-    0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x31, 0x32, 0x35, 0x25, 0x3B, 0x20, 0x2F, 0x2A, 0x20, 0x50, 0x6F,
-    0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x62, 0x6F, 0x76, 0x65, 0x20, 0x2A, 0x2F, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x65, 0x66, 0x74,
-    0x3A, 0x20, 0x35, 0x30, 0x25, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x3A, 0x20, 0x74, 0x72,
-    0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x58, 0x28, 0x2D, 0x35, 0x30, 0x25, 0x29, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x70, 0x61, 0x63,
-    0x69, 0x74, 0x79, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20,
-    0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x20, 0x30, 0x2E, 0x33, 0x73, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x2E, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x20, 0x2E, 0x74, 0x6F, 0x6F, 0x6C, 0x74,
-    0x69, 0x70, 0x74, 0x65, 0x78, 0x74, 0x3A, 0x3A, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x7B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74,
-    0x65, 0x6E, 0x74, 0x3A, 0x20, 0x22, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x61,
-    0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x70, 0x3A, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3B, 0x20,
-    0x2F, 0x2A, 0x20, 0x42, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x6F, 0x6F,
-    0x6C, 0x74, 0x69, 0x70, 0x20, 0x2A, 0x2F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x6C, 0x65, 0x66, 0x74, 0x3A, 0x20, 0x35, 0x30, 0x25, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73,
-    0x66, 0x6F, 0x72, 0x6D, 0x3A, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x58,
-    0x28, 0x2D, 0x35, 0x30, 0x25, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68,
-    0x3A, 0x20, 0x35, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A,
-    0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
-    0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x2D,
-    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x70, 0x61, 0x72, 0x65,
-    0x6E, 0x74, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x74,
-    0x72, 0x61, 0x6E, 0x73, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E,
-    0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x3A, 0x68, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x2E, 0x74,
-    0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x74, 0x65, 0x78, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6C,
-    0x69, 0x74, 0x79, 0x3A, 0x20, 0x76, 0x69, 0x73, 0x69, 0x62, 0x6C, 0x65, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x70, 0x61, 0x63, 0x69, 0x74,
-    0x79, 0x3A, 0x20, 0x31, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2A, 0x20, 0x44, 0x69, 0x73, 0x61,
-    0x62, 0x6C, 0x65, 0x64, 0x20, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x53, 0x74, 0x79,
-    0x6C, 0x69, 0x6E, 0x67, 0x20, 0x2A, 0x2F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x2E, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2D, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F,
-    0x6E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3A, 0x20, 0x30, 0x2E, 0x36, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65,
-    0x72, 0x2D, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x73, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x73, 0x69,
-    0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x2E, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2D, 0x6F, 0x76, 0x65,
-    0x72, 0x6C, 0x61, 0x79, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x61, 0x62, 0x73,
-    0x6F, 0x6C, 0x75, 0x74, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x74, 0x6F, 0x70, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x65, 0x66, 0x74, 0x3A, 0x20, 0x30, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74,
-    0x68, 0x3A, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x31, 0x30, 0x30,
-    0x25, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
-    0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-    0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30,
-    0x2E, 0x37, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20,
-    0x38, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x69, 0x67,
-    0x6E, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6A, 0x75, 0x73,
-    0x74, 0x69, 0x66, 0x79, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3A, 0x20, 0x63, 0x65,
-    0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70,
-    0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D,
-    0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x2D,
-    0x65, 0x76, 0x65, 0x6E, 0x74, 0x73, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x2F, 0x2A, 0x20, 0x44, 0x72, 0x6F, 0x70, 0x7A, 0x6F, 0x6E, 0x65, 0x20, 0x53, 0x74, 0x79,
-    0x6C, 0x69, 0x6E, 0x67, 0x20, 0x2A, 0x2F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x2E, 0x64, 0x72, 0x6F, 0x70, 0x7A, 0x6F, 0x6E, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20,
-    0x33, 0x70, 0x78, 0x20, 0x64, 0x61, 0x73, 0x68, 0x65, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D,
-    0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64,
-    0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x33, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x61, 0x6C, 0x69,
-    0x67, 0x6E, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76,
-    0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x2D, 0x63, 0x6F, 0x6C,
-    0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F,
-    0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x61,
-    0x72, 0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61,
-    0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x38, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6F, 0x72, 0x3A, 0x20, 0x70,
-    0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20,
-    0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
-    0x20, 0x30, 0x2E, 0x33, 0x73, 0x2C, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F,
-    0x6C, 0x6F, 0x72, 0x20, 0x30, 0x2E, 0x33, 0x73, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x64, 0x72,
-    0x6F, 0x70, 0x7A, 0x6F, 0x6E, 0x65, 0x2E, 0x64, 0x72, 0x61, 0x67, 0x6F, 0x76, 0x65, 0x72, 0x20,
-    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61,
-    0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20,
-    0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x2D, 0x63, 0x6F, 0x6C,
-    0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2A, 0x20, 0x48, 0x65,
-    0x6C, 0x70, 0x20, 0x4C, 0x69, 0x73, 0x74, 0x20, 0x53, 0x74, 0x79, 0x6C, 0x69, 0x6E, 0x67, 0x20,
-    0x2A, 0x2F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x68, 0x65, 0x6C, 0x70,
-    0x2D, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x2D, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2D, 0x74,
-    0x79, 0x70, 0x65, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20,
-    0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x68, 0x65, 0x6C, 0x70, 0x2D, 0x6C, 0x69, 0x73, 0x74,
-    0x20, 0x6C, 0x69, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C,
-    0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64,
-    0x61, 0x72, 0x79, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20,
-    0x32, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D,
-    0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65,
-    0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x31, 0x32, 0x70, 0x78, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64,
-    0x69, 0x6E, 0x67, 0x3A, 0x20, 0x31, 0x36, 0x70, 0x78, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67,
-    0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x31, 0x35, 0x70, 0x78, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x2E, 0x68, 0x65, 0x6C, 0x70, 0x2D, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x63,
-    0x6F, 0x64, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C,
-    0x6F, 0x72, 0x3A, 0x20, 0x23, 0x31, 0x61, 0x30, 0x64, 0x30, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67,
-    0x3A, 0x20, 0x32, 0x70, 0x78, 0x20, 0x34, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61,
-    0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x34, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D,
-    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2A, 0x20, 0x52, 0x65, 0x73,
-    0x70, 0x6F, 0x6E, 0x73, 0x69, 0x76, 0x65, 0x20, 0x45, 0x6E, 0x68, 0x61, 0x6E, 0x63, 0x65, 0x6D,
-    0x65, 0x6E, 0x74, 0x73, 0x20, 0x2A, 0x2F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x40, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x20, 0x28, 0x6D, 0x61, 0x78, 0x2D, 0x77, 0x69, 0x64, 0x74,
-    0x68, 0x3A, 0x20, 0x36, 0x30, 0x30, 0x70, 0x78, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x61, 0x62, 0x20, 0x62, 0x75, 0x74,
-    0x74, 0x6F, 0x6E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A,
-    0x20, 0x31, 0x36, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20,
-    0x31, 0x32, 0x70, 0x78, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64,
-    0x69, 0x6E, 0x67, 0x3A, 0x20, 0x31, 0x32, 0x70, 0x78, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20, 0x31, 0x34, 0x70, 0x78, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x73, 0x65, 0x6C,
-    0x65, 0x63, 0x74, 0x2D, 0x77, 0x72, 0x61, 0x70, 0x70, 0x65, 0x72, 0x3A, 0x3A, 0x61, 0x66, 0x74,
-    0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20,
-    0x31, 0x34, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x2F, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3E, 0x0A, 0x3C, 0x2F, 0x68, 0x65, 0x61,
-    0x64, 0x3E, 0x0A, 0x3C, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64,
-    0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69,
-    0x6E, 0x65, 0x72, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68,
-    0x31, 0x3E, 0x47, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x45, 0x53, 0x50, 0x20, 0x76, 0x41, 0x31, 0x2E,
-    0x34, 0x2E, 0x33, 0x3C, 0x2F, 0x68, 0x31, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x54, 0x61, 0x62, 0x20, 0x4E, 0x61, 0x76, 0x69, 0x67, 0x61,
-    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x2D, 0x2D, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x61, 0x62,
-    0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x61,
-    0x62, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x22, 0x20, 0x6F,
-    0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x6F, 0x70, 0x65, 0x6E, 0x54, 0x61, 0x62, 0x28,
-    0x65, 0x76, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x27, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73,
-    0x27, 0x29, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x54,
-    0x61, 0x62, 0x22, 0x3E, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x3C, 0x2F, 0x62, 0x75,
-    0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
-    0x22, 0x74, 0x61, 0x62, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x22, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69,
-    0x63, 0x6B, 0x3D, 0x22, 0x6F, 0x70, 0x65, 0x6E, 0x54, 0x61, 0x62, 0x28, 0x65, 0x76, 0x65, 0x6E,
-    0x74, 0x2C, 0x20, 0x27, 0x48, 0x65, 0x6C, 0x70, 0x27, 0x29, 0x22, 0x3E, 0x48, 0x65, 0x6C, 0x70,
-    0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x63, 0x6C,
-    0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x61, 0x62, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x22, 0x20, 0x6F,
-    0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x6F, 0x70, 0x65, 0x6E, 0x54, 0x61, 0x62, 0x28,
-    0x65, 0x76, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x27, 0x53, 0x44, 0x43, 0x61, 0x72, 0x64, 0x27, 0x29,
-    0x22, 0x3E, 0x53, 0x44, 0x20, 0x43, 0x61, 0x72, 0x64, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F,
-    0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x53,
-    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x54, 0x61, 0x62, 0x20, 0x43, 0x6F, 0x6E, 0x74,
-    0x65, 0x6E, 0x74, 0x20, 0x2D, 0x2D, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67,
-    0x73, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x61, 0x62, 0x63, 0x6F, 0x6E,
-    0x74, 0x65, 0x6E, 0x74, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61,
-    0x73, 0x73, 0x3D, 0x22, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2D, 0x67, 0x72, 0x69,
-    0x64, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x57, 0x69, 0x46, 0x69, 0x2F, 0x42, 0x4C,
-    0x45, 0x20, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x2D, 0x2D, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64,
-    0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E,
-    0x67, 0x73, 0x2D, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22,
-    0x6D, 0x69, 0x73, 0x63, 0x65, 0x6C, 0x6C, 0x61, 0x6E, 0x65, 0x6F, 0x75, 0x73, 0x5F, 0x73, 0x65,
-    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x32, 0x3E,
-    0x4D, 0x69, 0x73, 0x63, 0x65, 0x6C, 0x6C, 0x61, 0x6E, 0x65, 0x6F, 0x75, 0x73, 0x20, 0x53, 0x65,
-    0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x3C, 0x2F, 0x68, 0x32, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x54, 0x69, 0x6D, 0x65, 0x7A, 0x6F, 0x6E, 0x65, 0x20, 0x53,
-    0x65, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x2D, 0x2D, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x69, 0x6E, 0x70,
-    0x75, 0x74, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x74,
-    0x69, 0x6D, 0x65, 0x7A, 0x6F, 0x6E, 0x65, 0x5F, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x22, 0x3E,
-    0x54, 0x69, 0x6D, 0x65, 0x7A, 0x6F, 0x6E, 0x65, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73,
-    0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x22, 0x3E, 0x3F, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73,
-    0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74,
-    0x69, 0x70, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x79,
-    0x6F, 0x75, 0x72, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x7A, 0x6F, 0x6E, 0x65, 0x2E, 0x20, 0x54, 0x68,
-    0x69, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20,
-    0x74, 0x6F, 0x20, 0x61, 0x64, 0x6A, 0x75, 0x73, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65,
-    0x76, 0x69, 0x63, 0x65, 0x20, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x2E, 0x3C, 0x2F, 0x73, 0x70, 0x61,
-    0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x74, 0x69, 0x6D, 0x65,
-    0x7A, 0x6F, 0x6E, 0x65, 0x5F, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x22, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6F, 0x70, 0x74, 0x69, 0x6F,
-    0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22, 0x55, 0x54, 0x43, 0x30, 0x22, 0x3E, 0x55,
-    0x54, 0x43, 0x3C, 0x2F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20,
-    0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22, 0x4D, 0x53, 0x54, 0x37, 0x4D, 0x44, 0x54, 0x2C, 0x4D,
-    0x33, 0x2E, 0x32, 0x2E, 0x30, 0x2C, 0x4D, 0x31, 0x31, 0x2E, 0x31, 0x2E, 0x30, 0x22, 0x3E, 0x4D,
-    0x6F, 0x75, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x20, 0x54, 0x69, 0x6D, 0x65, 0x20, 0x28, 0x4D, 0x53,
-    0x54, 0x2F, 0x4D, 0x44, 0x54, 0x29, 0x3C, 0x2F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6F, 0x70, 0x74,
-    0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22, 0x45, 0x53, 0x54, 0x35, 0x45,
-    0x44, 0x54, 0x2C, 0x4D, 0x33, 0x2E, 0x32, 0x2E, 0x30, 0x2C, 0x4D, 0x31, 0x31, 0x2E, 0x31, 0x2E,
-    0x30, 0x22, 0x3E, 0x45, 0x61, 0x73, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x54, 0x69, 0x6D, 0x65, 0x20,
-    0x28, 0x45, 0x53, 0x54, 0x2F, 0x45, 0x44, 0x54, 0x29, 0x3C, 0x2F, 0x6F, 0x70, 0x74, 0x69, 0x6F,
-    0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22, 0x50, 0x53,
-    0x54, 0x38, 0x50, 0x44, 0x54, 0x2C, 0x4D, 0x33, 0x2E, 0x32, 0x2E, 0x30, 0x2C, 0x4D, 0x31, 0x31,
-    0x2E, 0x31, 0x2E, 0x30, 0x22, 0x3E, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x20, 0x54, 0x69,
-    0x6D, 0x65, 0x20, 0x28, 0x50, 0x53, 0x54, 0x2F, 0x50, 0x44, 0x54, 0x29, 0x3C, 0x2F, 0x6F, 0x70,
-    0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D,
-    0x22, 0x43, 0x53, 0x54, 0x36, 0x43, 0x44, 0x54, 0x2C, 0x4D, 0x33, 0x2E, 0x32, 0x2E, 0x30, 0x2C,
-    0x4D, 0x31, 0x31, 0x2E, 0x31, 0x2E, 0x30, 0x22, 0x3E, 0x43, 0x65, 0x6E, 0x74, 0x72, 0x61, 0x6C,
-    0x20, 0x54, 0x69, 0x6D, 0x65, 0x20, 0x28, 0x43, 0x53, 0x54, 0x2F, 0x43, 0x44, 0x54, 0x29, 0x3C,
-    0x2F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C,
-    0x75, 0x65, 0x3D, 0x22, 0x49, 0x53, 0x54, 0x2D, 0x35, 0x3A, 0x33, 0x30, 0x22, 0x3E, 0x49, 0x6E,
-    0x64, 0x69, 0x61, 0x20, 0x53, 0x74, 0x61, 0x6E, 0x64, 0x61, 0x72, 0x64, 0x20, 0x54, 0x69, 0x6D,
-    0x65, 0x20, 0x28, 0x49, 0x53, 0x54, 0x29, 0x3C, 0x2F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6F, 0x70,
-    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22, 0x47, 0x4D, 0x54, 0x30,
-    0x42, 0x53, 0x54, 0x2C, 0x4D, 0x33, 0x2E, 0x35, 0x2E, 0x30, 0x2F, 0x31, 0x2C, 0x4D, 0x31, 0x30,
-    0x2E, 0x35, 0x2E, 0x30, 0x2F, 0x32, 0x22, 0x3E, 0x42, 0x72, 0x69, 0x74, 0x69, 0x73, 0x68, 0x20,
-    0x53, 0x75, 0x6D, 0x6D, 0x65, 0x72, 0x20, 0x54, 0x69, 0x6D, 0x65, 0x20, 0x28, 0x47, 0x4D, 0x54,
-    0x2F, 0x42, 0x53, 0x54, 0x29, 0x3C, 0x2F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x69, 0x6E, 0x70,
-    0x75, 0x74, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x67,
-    0x70, 0x73, 0x5F, 0x72, 0x78, 0x5F, 0x70, 0x69, 0x6E, 0x22, 0x3E, 0x47, 0x50, 0x53, 0x20, 0x52,
-    0x58, 0x20, 0x50, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74,
-    0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x22, 0x3E, 0x3F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20,
-    0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x74, 0x65,
-    0x78, 0x74, 0x22, 0x3E, 0x50, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
-    0x47, 0x50, 0x53, 0x20, 0x52, 0x58, 0x20, 0x50, 0x69, 0x6E, 0x20, 0x46, 0x6F, 0x72, 0x20, 0x74,
-    0x68, 0x65, 0x20, 0x46, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x2E, 0x20, 0x4F, 0x6E, 0x6C,
-    0x79, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x6F, 0x73, 0x65, 0x20, 0x77, 0x68, 0x6F, 0x20,
-    0x68, 0x61, 0x76, 0x65, 0x20, 0x61, 0x20, 0x77, 0x6F, 0x72, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x47,
-    0x50, 0x53, 0x20, 0x49, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x3C, 0x2F, 0x73, 0x70,
-    0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x6E, 0x75,
-    0x6D, 0x62, 0x65, 0x72, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x67, 0x70, 0x73, 0x5F, 0x72, 0x78,
-    0x5F, 0x70, 0x69, 0x6E, 0x22, 0x20, 0x6D, 0x69, 0x6E, 0x3D, 0x22, 0x30, 0x22, 0x20, 0x6D, 0x61,
-    0x78, 0x3D, 0x22, 0x35, 0x30, 0x22, 0x20, 0x73, 0x74, 0x65, 0x70, 0x3D, 0x22, 0x31, 0x22, 0x20,
-    0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x3D, 0x22, 0x30, 0x20, 0x2D,
-    0x20, 0x35, 0x30, 0x22, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74,
-    0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x62, 0x72, 0x6F,
-    0x61, 0x64, 0x63, 0x61, 0x73, 0x74, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x22, 0x3E, 0x42, 0x72,
-    0x6F, 0x61, 0x64, 0x63, 0x61, 0x73, 0x74, 0x20, 0x53, 0x70, 0x65, 0x65, 0x64, 0x20, 0x28, 0x6D,
-    0x73, 0x29, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F,
-    0x6C, 0x74, 0x69, 0x70, 0x22, 0x3E, 0x3F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C,
-    0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x74, 0x65, 0x78, 0x74,
-    0x22, 0x3E, 0x53, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20,
-    0x61, 0x74, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x62, 0x72, 0x6F, 0x61, 0x64, 0x63, 0x61,
-    0x73, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x69, 0x6E,
-    0x20, 0x6D, 0x69, 0x6C, 0x6C, 0x69, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x73, 0x20, 0x28, 0x35,
-    0x20, 0x2D, 0x20, 0x31, 0x30, 0x30, 0x30, 0x20, 0x6D, 0x73, 0x29, 0x2E, 0x3C, 0x2F, 0x73, 0x70,
-    0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x6E, 0x75,
-    0x6D, 0x62, 0x65, 0x72, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x62, 0x72, 0x6F, 0x61, 0x64, 0x63,
-    0x61, 0x73, 0x74, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x22, 0x20, 0x6D, 0x69, 0x6E, 0x3D, 0x22,
-    0x35, 0x22, 0x20, 0x6D, 0x61, 0x78, 0x3D, 0x22, 0x31, 0x30, 0x30, 0x30, 0x22, 0x20, 0x73, 0x74,
-    0x65, 0x70, 0x3D, 0x22, 0x31, 0x22, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C, 0x64,
-    0x65, 0x72, 0x3D, 0x22, 0x35, 0x20, 0x2D, 0x20, 0x31, 0x30, 0x30, 0x30, 0x20, 0x6D, 0x73, 0x22,
-    0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74,
-    0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x61, 0x63, 0x63,
-    0x65, 0x6E, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72,
-    0x22, 0x3E, 0x41, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61,
-    0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70,
-    0x22, 0x3E, 0x3F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
-    0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3E, 0x50, 0x69,
-    0x63, 0x6B, 0x20, 0x61, 0x20, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x20, 0x61, 0x63, 0x63, 0x65,
-    0x6E, 0x74, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65,
-    0x20, 0x66, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x2E, 0x20, 0x55, 0x73, 0x65, 0x20, 0x74,
-    0x68, 0x65, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20,
-    0x74, 0x6F, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x79, 0x6F, 0x75, 0x72, 0x20, 0x70,
-    0x72, 0x65, 0x66, 0x65, 0x72, 0x72, 0x65, 0x64, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x3C,
-    0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D,
-    0x22, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x61, 0x63, 0x63, 0x65,
-    0x6E, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x22,
-    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22, 0x23, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x22,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20,
-    0x69, 0x64, 0x3D, 0x22, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
-    0x5F, 0x68, 0x65, 0x78, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x6D, 0x61, 0x72,
-    0x67, 0x69, 0x6E, 0x2D, 0x6C, 0x65, 0x66, 0x74, 0x3A, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3B, 0x22,
-    0x3E, 0x23, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x43, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x20, 0x74,
-    0x6F, 0x20, 0x57, 0x69, 0x46, 0x69, 0x20, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x28,
-    0x44, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x29, 0x20, 0x2D, 0x2D, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64,
-    0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E,
-    0x67, 0x73, 0x2D, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22,
-    0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x2D, 0x77, 0x69, 0x66, 0x69, 0x2D, 0x73, 0x65, 0x63,
-    0x74, 0x69, 0x6F, 0x6E, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x32, 0x3E, 0x57,
-    0x69, 0x46, 0x69, 0x20, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3C, 0x2F, 0x68, 0x32, 0x3E, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
-    0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72,
-    0x3D, 0x22, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x69, 0x70, 0x22, 0x3E, 0x45, 0x53,
-    0x50, 0x33, 0x32, 0x20, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x49, 0x50, 0x3A, 0x3C,
-    0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78,
-    0x74, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x69,
-    0x70, 0x22, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x3D, 0x22,
-    0x4E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 0x20, 0x72,
-    0x65, 0x61, 0x64, 0x6F, 0x6E, 0x6C, 0x79, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64,
-    0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x32, 0x3E, 0x43, 0x6F, 0x6E, 0x6E,
-    0x65, 0x63, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x57, 0x69, 0x46, 0x69, 0x20, 0x4E, 0x65, 0x74, 0x77,
-    0x6F, 0x72, 0x6B, 0x3C, 0x2F, 0x68, 0x32, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69,
-    0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x67,
-    0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x77, 0x69, 0x66, 0x69, 0x5F,
-    0x73, 0x73, 0x69, 0x64, 0x22, 0x3E, 0x57, 0x69, 0x46, 0x69, 0x20, 0x53, 0x53, 0x49, 0x44, 0x20,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70,
-    0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69,
-    0x70, 0x22, 0x3E, 0x3F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73,
-    0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3E, 0x45,
-    0x6E, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x53, 0x49, 0x44, 0x20, 0x6F, 0x66,
-    0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x69, 0x46, 0x69, 0x20, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72,
-    0x6B, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x77, 0x61, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6F,
-    0x6E, 0x6E, 0x65, 0x63, 0x74, 0x20, 0x74, 0x6F, 0x2E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73,
-    0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C,
-    0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69,
-    0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22,
-    0x20, 0x69, 0x64, 0x3D, 0x22, 0x77, 0x69, 0x66, 0x69, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x22, 0x20,
-    0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x3D, 0x22, 0x45, 0x6E, 0x74,
-    0x65, 0x72, 0x20, 0x57, 0x69, 0x46, 0x69, 0x20, 0x53, 0x53, 0x49, 0x44, 0x22, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64,
-    0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D,
-    0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x77, 0x69, 0x66, 0x69,
-    0x5F, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x22, 0x3E, 0x57, 0x69, 0x46, 0x69, 0x20,
-    0x50, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73,
-    0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x22, 0x3E, 0x3F, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73,
-    0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74,
-    0x69, 0x70, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3E, 0x45, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68,
-    0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
-    0x65, 0x20, 0x57, 0x69, 0x46, 0x69, 0x20, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x20, 0x79,
-    0x6F, 0x75, 0x20, 0x77, 0x61, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65,
-    0x63, 0x74, 0x20, 0x74, 0x6F, 0x2E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65,
-    0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69, 0x6E, 0x70, 0x75,
-    0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64,
-    0x3D, 0x22, 0x77, 0x69, 0x66, 0x69, 0x5F, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x22,
-    0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x3D, 0x22, 0x45, 0x6E,
-    0x74, 0x65, 0x72, 0x20, 0x57, 0x69, 0x46, 0x69, 0x20, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72,
-    0x64, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69,
-    0x63, 0x6B, 0x3D, 0x22, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x54, 0x6F, 0x57, 0x69, 0x46,
-    0x69, 0x28, 0x29, 0x22, 0x3E, 0x43, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x3C, 0x2F, 0x62, 0x75,
-    0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x21, 0x2D,
-    0x2D, 0x20, 0x45, 0x76, 0x69, 0x6C, 0x20, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x20, 0x53, 0x65,
-    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x2D, 0x2D, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63,
-    0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2D, 0x73,
-    0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x65, 0x76, 0x69, 0x6C,
-    0x2D, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x2D, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x22,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x32, 0x3E, 0x45, 0x76, 0x69, 0x6C, 0x20, 0x50,
-    0x6F, 0x72, 0x74, 0x61, 0x6C, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x3C, 0x2F,
-    0x68, 0x32, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61,
-    0x73, 0x73, 0x3D, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C,
-    0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x6F, 0x66, 0x66,
-    0x6C, 0x69, 0x6E, 0x65, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x22, 0x3E, 0x4F, 0x66, 0x66, 0x6C, 0x69,
-    0x6E, 0x65, 0x20, 0x4D, 0x6F, 0x64, 0x65, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73,
-    0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x22, 0x3E, 0x3F, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70,
-    0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69,
-    0x70, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3E, 0x54, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x20, 0x6F, 0x66,
-    0x66, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74,
-    0x68, 0x65, 0x20, 0x45, 0x76, 0x69, 0x6C, 0x20, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x2E, 0x3C,
-    0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73,
-    0x3D, 0x22, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x2D, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x22,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69,
-    0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B,
-    0x62, 0x6F, 0x78, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F,
-    0x6F, 0x66, 0x66, 0x6C, 0x69, 0x6E, 0x65, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x22, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E,
-    0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x73, 0x6C, 0x69, 0x64, 0x65, 0x72, 0x22, 0x3E,
-    0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64,
-    0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61,
-    0x73, 0x73, 0x3D, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C,
-    0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x75, 0x72, 0x6C,
-    0x22, 0x3E, 0x57, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x20, 0x55, 0x52, 0x4C, 0x20, 0x6F, 0x72,
-    0x20, 0x46, 0x69, 0x6C, 0x65, 0x20, 0x50, 0x61, 0x74, 0x68, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C,
-    0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x22, 0x3E, 0x3F, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F,
-    0x6C, 0x74, 0x69, 0x70, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3E, 0x45, 0x6E, 0x74, 0x65, 0x72, 0x20,
-    0x74, 0x68, 0x65, 0x20, 0x55, 0x52, 0x4C, 0x20, 0x6F, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20,
-    0x70, 0x61, 0x74, 0x68, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x45, 0x76, 0x69,
-    0x6C, 0x20, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x2E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73,
-    0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C,
-    0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69,
-    0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22,
-    0x20, 0x69, 0x64, 0x3D, 0x22, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x75, 0x72, 0x6C, 0x22,
-    0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x3D, 0x22, 0x45, 0x6E,
-    0x74, 0x65, 0x72, 0x20, 0x55, 0x52, 0x4C, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F,
-    0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C,
-    0x61, 0x73, 0x73, 0x3D, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70,
-    0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65,
-    0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x73, 0x73,
-    0x69, 0x64, 0x22, 0x3E, 0x57, 0x69, 0x46, 0x69, 0x20, 0x53, 0x53, 0x49, 0x44, 0x20, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E,
-    0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x22,
-    0x3E, 0x3F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
-    0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3E, 0x45, 0x6E, 0x74,
-    0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x53, 0x49, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x20,
-    0x74, 0x68, 0x65, 0x20, 0x57, 0x69, 0x46, 0x69, 0x20, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B,
-    0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x45, 0x76, 0x69,
-    0x6C, 0x20, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x2E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73,
-    0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C,
-    0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69,
-    0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22,
-    0x20, 0x69, 0x64, 0x3D, 0x22, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x73, 0x73, 0x69, 0x64,
-    0x22, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x3D, 0x22, 0x45,
-    0x6E, 0x74, 0x65, 0x72, 0x20, 0x57, 0x69, 0x46, 0x69, 0x20, 0x53, 0x53, 0x49, 0x44, 0x22, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x69, 0x6E, 0x70, 0x75,
-    0x74, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x70, 0x6F,
-    0x72, 0x74, 0x61, 0x6C, 0x5F, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x22, 0x3E, 0x57,
-    0x69, 0x46, 0x69, 0x20, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x20, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20,
-    0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x22, 0x3E,
-    0x3F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74,
-    0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3E, 0x45, 0x6E, 0x74, 0x65,
-    0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x20, 0x66,
-    0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x69, 0x46, 0x69, 0x20, 0x6E, 0x65, 0x74, 0x77,
-    0x6F, 0x72, 0x6B, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20,
-    0x45, 0x76, 0x69, 0x6C, 0x20, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x2E, 0x3C, 0x2F, 0x73, 0x70,
-    0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65,
-    0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x70,
-    0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x22, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F,
-    0x6C, 0x64, 0x65, 0x72, 0x3D, 0x22, 0x45, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x57, 0x69, 0x46, 0x69,
-    0x20, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20,
-    0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x67, 0x72, 0x6F,
-    0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61,
-    0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F,
-    0x61, 0x70, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x22, 0x3E, 0x45, 0x76, 0x69, 0x6C, 0x20, 0x50, 0x6F,
-    0x72, 0x74, 0x61, 0x6C, 0x20, 0x41, 0x50, 0x20, 0x53, 0x53, 0x49, 0x44, 0x20, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20,
-    0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x22, 0x3E,
-    0x3F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74,
-    0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3E, 0x45, 0x6E, 0x74, 0x65,
-    0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x53, 0x49, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74,
-    0x68, 0x65, 0x20, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x50, 0x6F, 0x69, 0x6E, 0x74, 0x20,
-    0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x45, 0x76, 0x69, 0x6C, 0x20, 0x50, 0x6F, 0x72, 0x74,
-    0x61, 0x6C, 0x2E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74,
-    0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x70,
-    0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x61, 0x70, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x22, 0x20, 0x70,
-    0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x3D, 0x22, 0x45, 0x6E, 0x74, 0x65,
-    0x72, 0x20, 0x45, 0x76, 0x69, 0x6C, 0x20, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x20, 0x41, 0x50,
-    0x20, 0x53, 0x53, 0x49, 0x44, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69,
-    0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73,
-    0x73, 0x3D, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20,
-    0x66, 0x6F, 0x72, 0x3D, 0x22, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x64, 0x6F, 0x6D, 0x61,
-    0x69, 0x6E, 0x22, 0x3E, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x20, 0x44, 0x6F, 0x6D, 0x61, 0x69,
-    0x6E, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C,
-    0x74, 0x69, 0x70, 0x22, 0x3E, 0x3F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61,
-    0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x74, 0x65, 0x78, 0x74, 0x22,
-    0x3E, 0x45, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x6F, 0x6D, 0x61, 0x69,
-    0x6E, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x45,
-    0x76, 0x69, 0x6C, 0x20, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x2E, 0x3C, 0x2F, 0x73, 0x70, 0x61,
-    0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78,
-    0x74, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x64, 0x6F,
-    0x6D, 0x61, 0x69, 0x6E, 0x22, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C, 0x64, 0x65,
-    0x72, 0x3D, 0x22, 0x45, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x44, 0x6F, 0x6D, 0x61, 0x69, 0x6E, 0x22,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B,
-    0x3D, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 0x65, 0x76, 0x69, 0x6C, 0x70, 0x6F, 0x72, 0x74, 0x61,
-    0x6C, 0x28, 0x29, 0x22, 0x3E, 0x53, 0x74, 0x61, 0x72, 0x74, 0x20, 0x45, 0x76, 0x69, 0x6C, 0x20,
-    0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x50, 0x6F, 0x77, 0x65,
-    0x72, 0x20, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6F,
-    0x6E, 0x20, 0x2D, 0x2D, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73,
-    0x3D, 0x22, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2D, 0x73, 0x65, 0x63, 0x74, 0x69,
-    0x6F, 0x6E, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x70, 0x6F, 0x77, 0x65, 0x72, 0x2D, 0x70, 0x72,
-    0x69, 0x6E, 0x74, 0x65, 0x72, 0x2D, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x3E, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x32, 0x3E, 0x50, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x50, 0x72,
-    0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x3C, 0x2F,
-    0x68, 0x32, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61,
-    0x73, 0x73, 0x3D, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C,
-    0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x5F, 0x69, 0x70,
-    0x22, 0x3E, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x49, 0x50, 0x20, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20,
-    0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x22, 0x3E,
-    0x3F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74,
-    0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3E, 0x45, 0x6E, 0x74, 0x65,
-    0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x49, 0x50, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73,
-    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x2E,
-    0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65,
-    0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x70, 0x72, 0x69, 0x6E,
-    0x74, 0x65, 0x72, 0x5F, 0x69, 0x70, 0x22, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C,
-    0x64, 0x65, 0x72, 0x3D, 0x22, 0x45, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x50, 0x72, 0x69, 0x6E, 0x74,
-    0x65, 0x72, 0x20, 0x49, 0x50, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69,
-    0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73,
-    0x73, 0x3D, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20,
-    0x66, 0x6F, 0x72, 0x3D, 0x22, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x5F, 0x74, 0x65, 0x78,
-    0x74, 0x22, 0x3E, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x54, 0x65, 0x78, 0x74, 0x20,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70,
-    0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69,
-    0x70, 0x22, 0x3E, 0x3F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73,
-    0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3E, 0x45,
-    0x6E, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x74, 0x6F,
-    0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72,
-    0x69, 0x6E, 0x74, 0x65, 0x72, 0x2E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65,
-    0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x74, 0x65, 0x78, 0x74,
-    0x61, 0x72, 0x65, 0x61, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72,
-    0x5F, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C, 0x64,
-    0x65, 0x72, 0x3D, 0x22, 0x45, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x54, 0x65, 0x78, 0x74, 0x20, 0x74,
-    0x6F, 0x20, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x74, 0x65, 0x78, 0x74, 0x61,
-    0x72, 0x65, 0x61, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
-    0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72,
-    0x3D, 0x22, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x5F, 0x66, 0x6F, 0x6E, 0x74, 0x5F, 0x73,
-    0x69, 0x7A, 0x65, 0x22, 0x3E, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x46, 0x6F, 0x6E,
-    0x74, 0x20, 0x53, 0x69, 0x7A, 0x65, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
-    0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x22, 0x3E, 0x3F, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61,
-    0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70,
-    0x74, 0x65, 0x78, 0x74, 0x22, 0x3E, 0x53, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F,
-    0x6E, 0x74, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
-    0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x64, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x28, 0x31, 0x30,
-    0x20, 0x2D, 0x20, 0x37, 0x32, 0x29, 0x2E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x70, 0x61,
-    0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x61, 0x62,
-    0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69, 0x6E, 0x70,
-    0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22,
-    0x20, 0x69, 0x64, 0x3D, 0x22, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x5F, 0x66, 0x6F, 0x6E,
-    0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x22, 0x20, 0x6D, 0x69, 0x6E, 0x3D, 0x22, 0x31, 0x30, 0x22,
-    0x20, 0x6D, 0x61, 0x78, 0x3D, 0x22, 0x37, 0x32, 0x22, 0x20, 0x73, 0x74, 0x65, 0x70, 0x3D, 0x22,
-    0x31, 0x22, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x3D, 0x22,
-    0x31, 0x30, 0x20, 0x2D, 0x20, 0x37, 0x32, 0x22, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65,
-    0x64, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x69, 0x6E,
-    0x70, 0x75, 0x74, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22,
-    0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x5F, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x6D, 0x65, 0x6E,
-    0x74, 0x22, 0x3E, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x41, 0x6C, 0x69, 0x67, 0x6E,
-    0x6D, 0x65, 0x6E, 0x74, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74,
-    0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x22, 0x3E, 0x3F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20,
-    0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x74, 0x65,
-    0x78, 0x74, 0x22, 0x3E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
-    0x6C, 0x69, 0x67, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65,
-    0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x64, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2E, 0x3C, 0x2F,
-    0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x73,
-    0x65, 0x6C, 0x65, 0x63, 0x74, 0x2D, 0x77, 0x72, 0x61, 0x70, 0x70, 0x65, 0x72, 0x22, 0x3E, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x65, 0x6C,
-    0x65, 0x63, 0x74, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x5F,
-    0x61, 0x6C, 0x69, 0x67, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6F, 0x70, 0x74,
-    0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22, 0x30, 0x22, 0x3E, 0x43, 0x65,
-    0x6E, 0x74, 0x65, 0x72, 0x20, 0x4D, 0x69, 0x64, 0x64, 0x6C, 0x65, 0x3C, 0x2F, 0x6F, 0x70, 0x74,
-    0x69, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C,
-    0x75, 0x65, 0x3D, 0x22, 0x31, 0x22, 0x3E, 0x54, 0x6F, 0x70, 0x20, 0x4C, 0x65, 0x66, 0x74, 0x3C,
-    0x2F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E,
-    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22, 0x32, 0x22, 0x3E, 0x54, 0x6F, 0x70, 0x20, 0x52,
-    0x69, 0x67, 0x68, 0x74, 0x3C, 0x2F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6F,
-    0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22, 0x33, 0x22, 0x3E,
-    0x42, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x20, 0x52, 0x69, 0x67, 0x68, 0x74, 0x3C, 0x2F, 0x6F, 0x70,
-    0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61,
-    0x6C, 0x75, 0x65, 0x3D, 0x22, 0x34, 0x22, 0x3E, 0x42, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x20, 0x4C,
-    0x65, 0x66, 0x74, 0x3C, 0x2F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x65, 0x6C, 0x65, 0x63,
-    0x74, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B,
-    0x3D, 0x22, 0x73, 0x65, 0x6E, 0x64, 0x74, 0x6F, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x28,
-    0x29, 0x22, 0x3E, 0x53, 0x65, 0x6E, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x50, 0x72, 0x69, 0x6E, 0x74,
-    0x65, 0x72, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69,
-    0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x52, 0x47, 0x42, 0x20, 0x53, 0x65, 0x63, 0x74,
-    0x69, 0x6F, 0x6E, 0x20, 0x2D, 0x2D, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61,
-    0x73, 0x73, 0x3D, 0x22, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2D, 0x73, 0x65, 0x63,
-    0x74, 0x69, 0x6F, 0x6E, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x72, 0x67, 0x62, 0x2D, 0x73, 0x65,
-    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x32, 0x3E,
-    0x52, 0x47, 0x42, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x3C, 0x2F, 0x68, 0x32,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73,
-    0x3D, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66,
-    0x6F, 0x72, 0x3D, 0x22, 0x72, 0x61, 0x69, 0x6E, 0x62, 0x6F, 0x77, 0x5F, 0x6D, 0x6F, 0x64, 0x65,
-    0x22, 0x3E, 0x52, 0x61, 0x69, 0x6E, 0x62, 0x6F, 0x77, 0x20, 0x4D, 0x6F, 0x64, 0x65, 0x20, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61,
-    0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70,
-    0x22, 0x3E, 0x3F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
-    0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3E, 0x54, 0x6F,
-    0x67, 0x67, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x61, 0x69, 0x6E, 0x62, 0x6F, 0x77,
-    0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20,
-    0x74, 0x68, 0x65, 0x20, 0x52, 0x47, 0x42, 0x20, 0x4C, 0x45, 0x44, 0x73, 0x2E, 0x3C, 0x2F, 0x73,
-    0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
-    0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x2D, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x22, 0x3E, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69, 0x6E, 0x70,
-    0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F,
-    0x78, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x72, 0x61, 0x69, 0x6E, 0x62, 0x6F, 0x77, 0x5F, 0x6D,
-    0x6F, 0x64, 0x65, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x73,
-    0x6C, 0x69, 0x64, 0x65, 0x72, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74,
-    0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x72, 0x67, 0x62,
-    0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x22, 0x3E, 0x52, 0x47, 0x42, 0x20, 0x53, 0x70, 0x65, 0x65,
-    0x64, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C,
-    0x74, 0x69, 0x70, 0x22, 0x3E, 0x3F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61,
-    0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x74, 0x65, 0x78, 0x74, 0x22,
-    0x3E, 0x53, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20, 0x6F,
-    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x52, 0x47, 0x42, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20,
-    0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x28, 0x31, 0x35, 0x20, 0x2D, 0x20, 0x35, 0x30, 0x29,
-    0x2E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70,
-    0x65, 0x3D, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x72,
-    0x67, 0x62, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x22, 0x20, 0x6D, 0x69, 0x6E, 0x3D, 0x22, 0x31,
-    0x35, 0x22, 0x20, 0x6D, 0x61, 0x78, 0x3D, 0x22, 0x35, 0x30, 0x22, 0x20, 0x73, 0x74, 0x65, 0x70,
-    0x3D, 0x22, 0x31, 0x22, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C, 0x64, 0x65, 0x72,
-    0x3D, 0x22, 0x31, 0x35, 0x20, 0x2D, 0x20, 0x35, 0x30, 0x22, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69,
-    0x72, 0x65, 0x64, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x46, 0x6C, 0x61, 0x70,
-    0x70, 0x79, 0x20, 0x47, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E,
-    0x20, 0x2D, 0x2D, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
-    0x22, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2D, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F,
-    0x6E, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x66, 0x6C, 0x61, 0x70, 0x70, 0x79, 0x5F, 0x67, 0x68,
-    0x6F, 0x73, 0x74, 0x5F, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x68, 0x32, 0x3E, 0x46, 0x6C, 0x61, 0x70, 0x70, 0x79, 0x20, 0x47, 0x68, 0x6F,
-    0x73, 0x74, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x3C, 0x2F, 0x68, 0x32, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
-    0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F,
-    0x72, 0x3D, 0x22, 0x66, 0x6C, 0x61, 0x70, 0x70, 0x79, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x5F, 0x74,
-    0x65, 0x78, 0x74, 0x22, 0x3E, 0x4E, 0x61, 0x6D, 0x65, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61,
-    0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x22, 0x3E, 0x3F, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C,
-    0x74, 0x69, 0x70, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3E, 0x45, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x74,
-    0x68, 0x65, 0x20, 0x4E, 0x61, 0x6D, 0x65, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x77, 0x61, 0x6E, 0x74,
-    0x20, 0x74, 0x6F, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
-    0x46, 0x6C, 0x61, 0x70, 0x70, 0x79, 0x20, 0x47, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x6C, 0x65, 0x61,
-    0x64, 0x65, 0x72, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x73, 0x2E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F,
-    0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F,
-    0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x74, 0x65, 0x78, 0x74, 0x61, 0x72, 0x65, 0x61, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x66, 0x6C, 0x61,
-    0x70, 0x70, 0x79, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x5F, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x70,
-    0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x3D, 0x22, 0x45, 0x6E, 0x74, 0x65,
-    0x72, 0x20, 0x4E, 0x61, 0x6D, 0x65, 0x22, 0x3E, 0x3C, 0x2F, 0x74, 0x65, 0x78, 0x74, 0x61, 0x72,
-    0x65, 0x61, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63,
-    0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x73, 0x61, 0x76, 0x65, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E,
-    0x67, 0x73, 0x28, 0x29, 0x22, 0x3E, 0x53, 0x61, 0x76, 0x65, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69,
-    0x6E, 0x67, 0x73, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x48, 0x65, 0x6C, 0x70, 0x20, 0x54, 0x61,
-    0x62, 0x20, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x2D, 0x2D, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x48,
-    0x65, 0x6C, 0x70, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x61, 0x62, 0x63,
-    0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x32, 0x3E, 0x45, 0x53, 0x50, 0x33, 0x32, 0x20, 0x43,
-    0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x73, 0x3C, 0x2F, 0x68, 0x32, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x75, 0x6C, 0x20, 0x63, 0x6C, 0x61,
-    0x73, 0x73, 0x3D, 0x22, 0x68, 0x65, 0x6C, 0x70, 0x2D, 0x6C, 0x69, 0x73, 0x74, 0x22, 0x3E, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67,
-    0x3E, 0x68, 0x65, 0x6C, 0x70, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x3A, 0x20,
-    0x44, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x68, 0x65, 0x6C,
-    0x70, 0x20, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x2E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x55, 0x73, 0x61, 0x67, 0x65,
-    0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65,
-    0x3E, 0x68, 0x65, 0x6C, 0x70, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C,
-    0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72,
-    0x6F, 0x6E, 0x67, 0x3E, 0x73, 0x63, 0x61, 0x6E, 0x61, 0x70, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F,
-    0x6E, 0x67, 0x3E, 0x3A, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x20, 0x61, 0x20, 0x57, 0x69, 0x2D,
-    0x46, 0x69, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20,
-    0x28, 0x41, 0x50, 0x29, 0x20, 0x73, 0x63, 0x61, 0x6E, 0x2E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x55, 0x73, 0x61, 0x67, 0x65,
-    0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65,
-    0x3E, 0x73, 0x63, 0x61, 0x6E, 0x61, 0x70, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x2F, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73,
-    0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x73, 0x63, 0x61, 0x6E, 0x73, 0x74, 0x61, 0x3C, 0x2F, 0x73,
-    0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x3A, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x20, 0x73, 0x63,
-    0x61, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x57, 0x69, 0x2D, 0x46, 0x69,
-    0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x55, 0x73, 0x61, 0x67, 0x65,
-    0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65,
-    0x3E, 0x73, 0x63, 0x61, 0x6E, 0x73, 0x74, 0x61, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x73, 0x74, 0x6F, 0x70, 0x73, 0x63, 0x61, 0x6E, 0x3C,
-    0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x3A, 0x20, 0x53, 0x74, 0x6F, 0x70, 0x20, 0x61,
-    0x6E, 0x79, 0x20, 0x6F, 0x6E, 0x67, 0x6F, 0x69, 0x6E, 0x67, 0x20, 0x57, 0x69, 0x2D, 0x46, 0x69,
-    0x20, 0x73, 0x63, 0x61, 0x6E, 0x2E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x55, 0x73, 0x61, 0x67, 0x65, 0x3A, 0x3C, 0x2F, 0x73,
-    0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x73, 0x74, 0x6F,
-    0x70, 0x73, 0x63, 0x61, 0x6E, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C,
-    0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72,
-    0x6F, 0x6E, 0x67, 0x3E, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6B, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F,
-    0x6E, 0x67, 0x3E, 0x3A, 0x20, 0x4C, 0x61, 0x75, 0x6E, 0x63, 0x68, 0x20, 0x61, 0x6E, 0x20, 0x61,
-    0x74, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x28, 0x65, 0x2E, 0x67, 0x2E, 0x2C, 0x20, 0x64, 0x65, 0x61,
-    0x75, 0x74, 0x68, 0x65, 0x6E, 0x74, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x74,
-    0x74, 0x61, 0x63, 0x6B, 0x29, 0x2E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x55, 0x73, 0x61, 0x67, 0x65, 0x3A, 0x3C, 0x2F, 0x73,
-    0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x61, 0x74, 0x74,
-    0x61, 0x63, 0x6B, 0x20, 0x2D, 0x64, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3C, 0x62, 0x72,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x41, 0x72,
-    0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67,
-    0x3E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E,
-    0x2D, 0x64, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3A, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74,
-    0x20, 0x64, 0x65, 0x61, 0x75, 0x74, 0x68, 0x20, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x2F, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73,
-    0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x6C, 0x69, 0x73, 0x74, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F,
-    0x6E, 0x67, 0x3E, 0x3A, 0x20, 0x4C, 0x69, 0x73, 0x74, 0x20, 0x57, 0x69, 0x2D, 0x46, 0x69, 0x20,
-    0x73, 0x63, 0x61, 0x6E, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x73, 0x20, 0x6F, 0x72, 0x20,
-    0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F,
-    0x6E, 0x73, 0x2E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72,
-    0x6F, 0x6E, 0x67, 0x3E, 0x55, 0x73, 0x61, 0x67, 0x65, 0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F,
-    0x6E, 0x67, 0x3E, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x2D,
-    0x61, 0x20, 0x7C, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x2D, 0x73, 0x3C, 0x2F, 0x63, 0x6F, 0x64,
-    0x65, 0x3E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F,
-    0x6E, 0x67, 0x3E, 0x41, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x3A, 0x3C, 0x2F, 0x73,
-    0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x63, 0x6F, 0x64, 0x65, 0x3E, 0x2D, 0x61, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3A, 0x20,
-    0x53, 0x68, 0x6F, 0x77, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x70, 0x6F, 0x69, 0x6E,
-    0x74, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x57, 0x69, 0x2D, 0x46, 0x69, 0x20, 0x73, 0x63,
-    0x61, 0x6E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65,
-    0x3E, 0x2D, 0x73, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3A, 0x20, 0x4C, 0x69, 0x73, 0x74,
-    0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69,
-    0x6F, 0x6E, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x69, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x62, 0x65, 0x61, 0x63, 0x6F,
-    0x6E, 0x73, 0x70, 0x61, 0x6D, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x3A, 0x20,
-    0x53, 0x74, 0x61, 0x72, 0x74, 0x20, 0x62, 0x65, 0x61, 0x63, 0x6F, 0x6E, 0x20, 0x73, 0x70, 0x61,
-    0x6D, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x74,
-    0x20, 0x6D, 0x6F, 0x64, 0x65, 0x73, 0x2E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x55, 0x73, 0x61, 0x67, 0x65, 0x3A, 0x3C, 0x2F,
-    0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x62, 0x65,
-    0x61, 0x63, 0x6F, 0x6E, 0x73, 0x70, 0x61, 0x6D, 0x20, 0x5B, 0x4F, 0x50, 0x54, 0x49, 0x4F, 0x4E,
-    0x5D, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x41, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E,
-    0x74, 0x73, 0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x3C, 0x62, 0x72, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x2D, 0x72, 0x3C, 0x2F, 0x63,
-    0x6F, 0x64, 0x65, 0x3E, 0x3A, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x20, 0x72, 0x61, 0x6E, 0x64,
-    0x6F, 0x6D, 0x20, 0x62, 0x65, 0x61, 0x63, 0x6F, 0x6E, 0x20, 0x73, 0x70, 0x61, 0x6D, 0x3C, 0x62,
-    0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x2D, 0x72, 0x72,
-    0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3A, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x20, 0x52,
-    0x69, 0x63, 0x6B, 0x72, 0x6F, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x61, 0x63, 0x6F, 0x6E, 0x20, 0x73,
-    0x70, 0x61, 0x6D, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x63, 0x6F, 0x64,
-    0x65, 0x3E, 0x2D, 0x6C, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3A, 0x20, 0x53, 0x74, 0x61,
-    0x72, 0x74, 0x20, 0x41, 0x50, 0x20, 0x4C, 0x69, 0x73, 0x74, 0x20, 0x62, 0x65, 0x61, 0x63, 0x6F,
-    0x6E, 0x20, 0x73, 0x70, 0x61, 0x6D, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x63, 0x6F, 0x64, 0x65, 0x3E, 0x5B, 0x53, 0x53, 0x49, 0x44, 0x5D, 0x3C, 0x2F, 0x63, 0x6F, 0x64,
-    0x65, 0x3E, 0x3A, 0x20, 0x55, 0x73, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65,
-    0x64, 0x20, 0x53, 0x53, 0x49, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x62, 0x65, 0x61, 0x63, 0x6F,
-    0x6E, 0x20, 0x73, 0x70, 0x61, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x69,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x73, 0x74,
-    0x6F, 0x70, 0x73, 0x70, 0x61, 0x6D, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x3A,
-    0x20, 0x53, 0x74, 0x6F, 0x70, 0x20, 0x6F, 0x6E, 0x67, 0x6F, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x65,
-    0x61, 0x63, 0x6F, 0x6E, 0x20, 0x73, 0x70, 0x61, 0x6D, 0x2E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x55, 0x73, 0x61, 0x67, 0x65,
-    0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65,
-    0x3E, 0x73, 0x74, 0x6F, 0x70, 0x73, 0x70, 0x61, 0x6D, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x73, 0x74, 0x6F, 0x70, 0x64, 0x65, 0x61, 0x75,
-    0x74, 0x68, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x3A, 0x20, 0x53, 0x74, 0x6F,
-    0x70, 0x20, 0x6F, 0x6E, 0x67, 0x6F, 0x69, 0x6E, 0x67, 0x20, 0x64, 0x65, 0x61, 0x75, 0x74, 0x68,
-    0x65, 0x6E, 0x74, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x74, 0x74, 0x61, 0x63,
-    0x6B, 0x2E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F,
-    0x6E, 0x67, 0x3E, 0x55, 0x73, 0x61, 0x67, 0x65, 0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E,
-    0x67, 0x3E, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x73, 0x74, 0x6F, 0x70, 0x64, 0x65, 0x61,
-    0x75, 0x74, 0x68, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x69, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E,
-    0x67, 0x3E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67,
-    0x3E, 0x3A, 0x20, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x63, 0x63,
-    0x65, 0x73, 0x73, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20, 0x62, 0x79, 0x20, 0x69, 0x6E, 0x64,
-    0x65, 0x78, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x63, 0x61, 0x6E,
-    0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x73, 0x2E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x55, 0x73, 0x61, 0x67, 0x65, 0x3A,
-    0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E,
-    0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x2D, 0x61, 0x20, 0x26, 0x6C, 0x74, 0x3B, 0x6E, 0x75,
-    0x6D, 0x62, 0x65, 0x72, 0x26, 0x67, 0x74, 0x3B, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3C,
-    0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E,
-    0x41, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F,
-    0x6E, 0x67, 0x3E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x63, 0x6F, 0x64,
-    0x65, 0x3E, 0x2D, 0x61, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3A, 0x20, 0x41, 0x50, 0x20,
-    0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20,
-    0x28, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x64,
-    0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E,
-    0x73, 0x74, 0x61, 0x72, 0x74, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x3C, 0x2F, 0x73, 0x74, 0x72,
-    0x6F, 0x6E, 0x67, 0x3E, 0x3A, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x20, 0x61, 0x20, 0x70, 0x6F,
-    0x72, 0x74, 0x61, 0x6C, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66,
-    0x69, 0x65, 0x64, 0x20, 0x53, 0x53, 0x49, 0x44, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x61, 0x73,
-    0x73, 0x77, 0x6F, 0x72, 0x64, 0x2E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x55, 0x73, 0x61, 0x67, 0x65, 0x3A, 0x3C, 0x2F, 0x73,
-    0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x73, 0x74, 0x61,
-    0x72, 0x74, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x20, 0x26, 0x6C, 0x74, 0x3B, 0x55, 0x52, 0x4C,
-    0x26, 0x67, 0x74, 0x3B, 0x20, 0x26, 0x6C, 0x74, 0x3B, 0x53, 0x53, 0x49, 0x44, 0x26, 0x67, 0x74,
-    0x3B, 0x20, 0x26, 0x6C, 0x74, 0x3B, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x26, 0x67,
-    0x74, 0x3B, 0x20, 0x26, 0x6C, 0x74, 0x3B, 0x41, 0x50, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x26, 0x67,
-    0x74, 0x3B, 0x20, 0x26, 0x6C, 0x74, 0x3B, 0x44, 0x6F, 0x6D, 0x61, 0x69, 0x6E, 0x26, 0x67, 0x74,
-    0x3B, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x41, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E,
-    0x74, 0x73, 0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x3C, 0x62, 0x72, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x26, 0x6C, 0x74, 0x3B, 0x55,
-    0x52, 0x4C, 0x26, 0x67, 0x74, 0x3B, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3A, 0x20, 0x55,
-    0x52, 0x4C, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6F, 0x72, 0x74, 0x61,
-    0x6C, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E,
-    0x26, 0x6C, 0x74, 0x3B, 0x53, 0x53, 0x49, 0x44, 0x26, 0x67, 0x74, 0x3B, 0x3C, 0x2F, 0x63, 0x6F,
-    0x64, 0x65, 0x3E, 0x3A, 0x20, 0x57, 0x69, 0x2D, 0x46, 0x69, 0x20, 0x53, 0x53, 0x49, 0x44, 0x20,
-    0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x3C, 0x62,
-    0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x26, 0x6C, 0x74,
-    0x3B, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x26, 0x67, 0x74, 0x3B, 0x3C, 0x2F, 0x63,
-    0x6F, 0x64, 0x65, 0x3E, 0x3A, 0x20, 0x57, 0x69, 0x2D, 0x46, 0x69, 0x20, 0x70, 0x61, 0x73, 0x73,
-    0x77, 0x6F, 0x72, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6F, 0x72,
-    0x74, 0x61, 0x6C, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x63, 0x6F, 0x64,
-    0x65, 0x3E, 0x26, 0x6C, 0x74, 0x3B, 0x41, 0x50, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x26, 0x67, 0x74,
-    0x3B, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3A, 0x20, 0x53, 0x53, 0x49, 0x44, 0x20, 0x66,
-    0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x70, 0x6F,
-    0x69, 0x6E, 0x74, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x63, 0x6F, 0x64,
-    0x65, 0x3E, 0x26, 0x6C, 0x74, 0x3B, 0x44, 0x6F, 0x6D, 0x61, 0x69, 0x6E, 0x26, 0x67, 0x74, 0x3B,
-    0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3A, 0x20, 0x43, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x20,
-    0x64, 0x6F, 0x6D, 0x61, 0x69, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x70, 0x6F, 0x6F, 0x66, 0x20,
-    0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0x62,
-    0x61, 0x72, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x65, 0x6D, 0x3E, 0x4F,
-    0x52, 0x3C, 0x2F, 0x65, 0x6D, 0x3E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x4F, 0x66, 0x66, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x55,
-    0x73, 0x61, 0x67, 0x65, 0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x3C,
-    0x63, 0x6F, 0x64, 0x65, 0x3E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C,
-    0x20, 0x26, 0x6C, 0x74, 0x3B, 0x46, 0x69, 0x6C, 0x65, 0x50, 0x61, 0x74, 0x68, 0x26, 0x67, 0x74,
-    0x3B, 0x20, 0x26, 0x6C, 0x74, 0x3B, 0x41, 0x50, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x26, 0x67, 0x74,
-    0x3B, 0x20, 0x26, 0x6C, 0x74, 0x3B, 0x44, 0x6F, 0x6D, 0x61, 0x69, 0x6E, 0x26, 0x67, 0x74, 0x3B,
-    0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C,
-    0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x73,
-    0x74, 0x6F, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E,
-    0x67, 0x3E, 0x3A, 0x20, 0x53, 0x74, 0x6F, 0x70, 0x20, 0x74, 0x68, 0x65, 0x20, 0x45, 0x76, 0x69,
-    0x6C, 0x20, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x2E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x55, 0x73, 0x61, 0x67, 0x65, 0x3A,
-    0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E,
-    0x73, 0x74, 0x6F, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x62, 0x6C, 0x65, 0x73, 0x63, 0x61, 0x6E,
-    0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x3A, 0x20, 0x48, 0x61, 0x6E, 0x64, 0x6C,
-    0x65, 0x20, 0x42, 0x4C, 0x45, 0x20, 0x73, 0x63, 0x61, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x77,
-    0x69, 0x74, 0x68, 0x20, 0x76, 0x61, 0x72, 0x69, 0x6F, 0x75, 0x73, 0x20, 0x6D, 0x6F, 0x64, 0x65,
-    0x73, 0x2E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F,
-    0x6E, 0x67, 0x3E, 0x55, 0x73, 0x61, 0x67, 0x65, 0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E,
-    0x67, 0x3E, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x62, 0x6C, 0x65, 0x73, 0x63, 0x61, 0x6E,
-    0x20, 0x5B, 0x4F, 0x50, 0x54, 0x49, 0x4F, 0x4E, 0x5D, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E,
-    0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67,
-    0x3E, 0x41, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72,
-    0x6F, 0x6E, 0x67, 0x3E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x63, 0x6F,
-    0x64, 0x65, 0x3E, 0x2D, 0x66, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3A, 0x20, 0x53, 0x74,
-    0x61, 0x72, 0x74, 0x20, 0x27, 0x46, 0x69, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x46, 0x6C,
-    0x69, 0x70, 0x70, 0x65, 0x72, 0x73, 0x27, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x3C, 0x62, 0x72, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x2D, 0x64, 0x73, 0x3C, 0x2F,
-    0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3A, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x20, 0x42, 0x4C, 0x45,
-    0x20, 0x73, 0x70, 0x61, 0x6D, 0x20, 0x64, 0x65, 0x74, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x3C, 0x62,
-    0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x2D, 0x61, 0x3C,
-    0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3A, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x20, 0x41, 0x69,
-    0x72, 0x54, 0x61, 0x67, 0x20, 0x73, 0x63, 0x61, 0x6E, 0x6E, 0x65, 0x72, 0x3C, 0x62, 0x72, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x2D, 0x72, 0x3C, 0x2F, 0x63,
-    0x6F, 0x64, 0x65, 0x3E, 0x3A, 0x20, 0x53, 0x63, 0x61, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x72,
-    0x61, 0x77, 0x20, 0x42, 0x4C, 0x45, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x65, 0x74, 0x73, 0x3C, 0x62,
-    0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x2D, 0x73, 0x3C,
-    0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3A, 0x20, 0x53, 0x74, 0x6F, 0x70, 0x20, 0x42, 0x4C, 0x45,
-    0x20, 0x73, 0x63, 0x61, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67,
-    0x3E, 0x63, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67,
-    0x3E, 0x3A, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x20, 0x61, 0x20, 0x57, 0x69, 0x2D, 0x46, 0x69,
-    0x20, 0x63, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x20, 0x28, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72,
-    0x65, 0x73, 0x20, 0x53, 0x44, 0x20, 0x63, 0x61, 0x72, 0x64, 0x20, 0x6F, 0x72, 0x20, 0x46, 0x6C,
-    0x69, 0x70, 0x70, 0x65, 0x72, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x29, 0x2E, 0x3C, 0x62,
-    0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x55,
-    0x73, 0x61, 0x67, 0x65, 0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x3C,
-    0x63, 0x6F, 0x64, 0x65, 0x3E, 0x63, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x20, 0x5B, 0x4F, 0x50,
-    0x54, 0x49, 0x4F, 0x4E, 0x5D, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3C, 0x62, 0x72, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x41, 0x72, 0x67,
-    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E,
-    0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x2D,
-    0x70, 0x72, 0x6F, 0x62, 0x65, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3A, 0x20, 0x53, 0x74,
-    0x61, 0x72, 0x74, 0x20, 0x63, 0x61, 0x70, 0x74, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x72,
-    0x6F, 0x62, 0x65, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x65, 0x74, 0x73, 0x3C, 0x62, 0x72, 0x3E, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x2D, 0x62, 0x65, 0x61, 0x63, 0x6F,
-    0x6E, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3A, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x20,
-    0x63, 0x61, 0x70, 0x74, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x65, 0x61, 0x63, 0x6F, 0x6E,
-    0x20, 0x70, 0x61, 0x63, 0x6B, 0x65, 0x74, 0x73, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x2D, 0x64, 0x65, 0x61, 0x75, 0x74, 0x68, 0x3C, 0x2F,
-    0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3A, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x20, 0x63, 0x61, 0x70,
-    0x74, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x64, 0x65, 0x61, 0x75, 0x74, 0x68, 0x20, 0x70, 0x61,
-    0x63, 0x6B, 0x65, 0x74, 0x73, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x63,
-    0x6F, 0x64, 0x65, 0x3E, 0x2D, 0x72, 0x61, 0x77, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3A,
-    0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x20, 0x63, 0x61, 0x70, 0x74, 0x75, 0x72, 0x69, 0x6E, 0x67,
-    0x20, 0x72, 0x61, 0x77, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x65, 0x74, 0x73, 0x3C, 0x62, 0x72, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x2D, 0x77, 0x70, 0x73, 0x3C,
-    0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x3A, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x20, 0x63, 0x61,
-    0x70, 0x74, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x57, 0x50, 0x53, 0x20, 0x70, 0x61, 0x63, 0x6B,
-    0x65, 0x74, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x61, 0x75,
-    0x74, 0x68, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x2D, 0x70, 0x77, 0x6E, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65,
-    0x3E, 0x3A, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x20, 0x63, 0x61, 0x70, 0x74, 0x75, 0x72, 0x69,
-    0x6E, 0x67, 0x20, 0x50, 0x77, 0x6E, 0x61, 0x67, 0x6F, 0x74, 0x63, 0x68, 0x69, 0x20, 0x70, 0x61,
-    0x63, 0x6B, 0x65, 0x74, 0x73, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x63,
-    0x6F, 0x64, 0x65, 0x3E, 0x2D, 0x73, 0x74, 0x6F, 0x70, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E,
-    0x3A, 0x20, 0x53, 0x74, 0x6F, 0x70, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76,
-    0x65, 0x20, 0x63, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67,
-    0x3E, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67,
-    0x3E, 0x3A, 0x20, 0x43, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20,
-    0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x20, 0x57, 0x69, 0x2D, 0x46, 0x69, 0x20, 0x6E,
-    0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x2E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x55, 0x73, 0x61, 0x67, 0x65, 0x3A, 0x3C, 0x2F,
-    0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x63, 0x6F,
-    0x6E, 0x6E, 0x65, 0x63, 0x74, 0x20, 0x26, 0x6C, 0x74, 0x3B, 0x53, 0x53, 0x49, 0x44, 0x26, 0x67,
-    0x74, 0x3B, 0x20, 0x26, 0x6C, 0x74, 0x3B, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x26,
-    0x67, 0x74, 0x3B, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x69, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E,
-    0x67, 0x3E, 0x64, 0x69, 0x61, 0x6C, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x3C, 0x2F, 0x73,
-    0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x3A, 0x20, 0x43, 0x61, 0x73, 0x74, 0x20, 0x61, 0x20, 0x72,
-    0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x20, 0x59, 0x6F, 0x75, 0x54, 0x75, 0x62, 0x65, 0x20, 0x76, 0x69,
-    0x64, 0x65, 0x6F, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x73, 0x6D, 0x61, 0x72, 0x74,
-    0x20, 0x54, 0x56, 0x73, 0x20, 0x6F, 0x6E, 0x20, 0x79, 0x6F, 0x75, 0x72, 0x20, 0x4C, 0x41, 0x4E,
-    0x20, 0x28, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x73, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x74,
-    0x6F, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x63, 0x6F, 0x6E, 0x6E,
-    0x65, 0x63, 0x74, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74,
-    0x29, 0x2E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F,
-    0x6E, 0x67, 0x3E, 0x55, 0x73, 0x61, 0x67, 0x65, 0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E,
-    0x67, 0x3E, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x64, 0x69, 0x61, 0x6C, 0x63, 0x6F, 0x6E,
-    0x6E, 0x65, 0x63, 0x74, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x69,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F,
-    0x6E, 0x67, 0x3E, 0x70, 0x6F, 0x77, 0x65, 0x72, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x3C,
-    0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x3A, 0x20, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x20,
-    0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x61,
-    0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x6F, 0x6E, 0x20, 0x79, 0x6F, 0x75, 0x72,
-    0x20, 0x4C, 0x41, 0x4E, 0x20, 0x28, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x73, 0x20, 0x79,
-    0x6F, 0x75, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E,
-    0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x3C, 0x2F, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x20, 0x66,
-    0x69, 0x72, 0x73, 0x74, 0x29, 0x2E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x55, 0x73, 0x61, 0x67, 0x65, 0x3A, 0x3C, 0x2F, 0x73,
-    0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x3C, 0x63, 0x6F, 0x64, 0x65, 0x3E, 0x70, 0x6F, 0x77,
-    0x65, 0x72, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x26, 0x6C, 0x74, 0x3B, 0x50, 0x72,
-    0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x49, 0x50, 0x26, 0x67, 0x74, 0x3B, 0x20, 0x26, 0x6C, 0x74,
-    0x3B, 0x54, 0x65, 0x78, 0x74, 0x26, 0x67, 0x74, 0x3B, 0x20, 0x26, 0x6C, 0x74, 0x3B, 0x46, 0x6F,
-    0x6E, 0x74, 0x53, 0x69, 0x7A, 0x65, 0x26, 0x67, 0x74, 0x3B, 0x20, 0x26, 0x6C, 0x74, 0x3B, 0x41,
-    0x6C, 0x69, 0x67, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x26, 0x67, 0x74, 0x3B, 0x3C, 0x2F, 0x63, 0x6F,
-    0x64, 0x65, 0x3E, 0x3C, 0x62, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72,
-    0x6F, 0x6E, 0x67, 0x3E, 0x41, 0x6C, 0x69, 0x67, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x6F, 0x70,
-    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20,
-    0x43, 0x4D, 0x20, 0x3D, 0x20, 0x43, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x4D, 0x69, 0x64, 0x64,
-    0x6C, 0x65, 0x2C, 0x20, 0x54, 0x4C, 0x20, 0x3D, 0x20, 0x54, 0x6F, 0x70, 0x20, 0x4C, 0x65, 0x66,
-    0x74, 0x2C, 0x20, 0x54, 0x52, 0x20, 0x3D, 0x20, 0x54, 0x6F, 0x70, 0x20, 0x52, 0x69, 0x67, 0x68,
-    0x74, 0x2C, 0x20, 0x42, 0x52, 0x20, 0x3D, 0x20, 0x42, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x20, 0x52,
-    0x69, 0x67, 0x68, 0x74, 0x2C, 0x20, 0x42, 0x4C, 0x20, 0x3D, 0x20, 0x42, 0x6F, 0x74, 0x74, 0x6F,
-    0x6D, 0x20, 0x4C, 0x65, 0x66, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x75, 0x6C, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x53, 0x44, 0x20, 0x43,
-    0x61, 0x72, 0x64, 0x20, 0x54, 0x61, 0x62, 0x20, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20,
-    0x2D, 0x2D, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76,
-    0x20, 0x69, 0x64, 0x3D, 0x22, 0x53, 0x44, 0x43, 0x61, 0x72, 0x64, 0x22, 0x20, 0x63, 0x6C, 0x61,
-    0x73, 0x73, 0x3D, 0x22, 0x74, 0x61, 0x62, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x22, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x32,
-    0x3E, 0x53, 0x44, 0x20, 0x43, 0x61, 0x72, 0x64, 0x20, 0x46, 0x69, 0x6C, 0x65, 0x20, 0x45, 0x78,
-    0x70, 0x6C, 0x6F, 0x72, 0x65, 0x72, 0x3C, 0x2F, 0x68, 0x32, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x42, 0x72, 0x65, 0x61, 0x64, 0x63,
-    0x72, 0x75, 0x6D, 0x62, 0x20, 0x4E, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20,
-    0x2D, 0x2D, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x6E, 0x61, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x62, 0x72, 0x65, 0x61,
-    0x64, 0x63, 0x72, 0x75, 0x6D, 0x62, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x62, 0x72, 0x65, 0x61,
-    0x64, 0x63, 0x72, 0x75, 0x6D, 0x62, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63,
-    0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x62, 0x72, 0x65, 0x61, 0x64, 0x63, 0x72, 0x75, 0x6D, 0x62,
-    0x2D, 0x69, 0x74, 0x65, 0x6D, 0x22, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22,
-    0x6E, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x65, 0x54, 0x6F, 0x42, 0x72, 0x65, 0x61, 0x64, 0x63,
-    0x72, 0x75, 0x6D, 0x62, 0x28, 0x30, 0x29, 0x22, 0x3E, 0x52, 0x6F, 0x6F, 0x74, 0x3C, 0x2F, 0x73,
-    0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x2F, 0x6E, 0x61, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x53, 0x44, 0x20, 0x43, 0x61, 0x72, 0x64, 0x20, 0x53, 0x74,
-    0x61, 0x74, 0x75, 0x73, 0x20, 0x2D, 0x2D, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x64,
-    0x63, 0x61, 0x72, 0x64, 0x2D, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x22, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4C, 0x6F,
-    0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x53, 0x44, 0x20, 0x63, 0x61, 0x72, 0x64, 0x20, 0x64, 0x61,
-    0x74, 0x61, 0x2E, 0x2E, 0x2E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x53, 0x44, 0x20, 0x43, 0x61, 0x72, 0x64, 0x20, 0x53,
-    0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x2D, 0x2D, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64,
-    0x3D, 0x22, 0x73, 0x64, 0x63, 0x61, 0x72, 0x64, 0x2D, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75,
-    0x72, 0x65, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x53, 0x44, 0x20, 0x43, 0x61, 0x72,
-    0x64, 0x20, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C,
-    0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x64, 0x20, 0x68, 0x65, 0x72,
-    0x65, 0x20, 0x2D, 0x2D, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x55, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x46, 0x69,
-    0x6C, 0x65, 0x20, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x2D, 0x2D, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20,
-    0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x2D, 0x73, 0x65,
-    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x32, 0x3E, 0x55, 0x70, 0x6C, 0x6F,
-    0x61, 0x64, 0x20, 0x46, 0x69, 0x6C, 0x65, 0x3C, 0x2F, 0x68, 0x32, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69,
-    0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x67,
-    0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65,
-    0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x73, 0x64, 0x63, 0x61, 0x72, 0x64, 0x2D, 0x75, 0x70,
-    0x6C, 0x6F, 0x61, 0x64, 0x22, 0x3E, 0x43, 0x68, 0x6F, 0x6F, 0x73, 0x65, 0x20, 0x46, 0x69, 0x6C,
-    0x65, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E,
-    0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x22,
-    0x3E, 0x3F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F, 0x6F, 0x6C,
-    0x74, 0x69, 0x70, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20,
-    0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64,
-    0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20,
-    0x66, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x44,
-    0x20, 0x43, 0x61, 0x72, 0x64, 0x2E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x69, 0x6C, 0x65, 0x2D,
-    0x77, 0x72, 0x61, 0x70, 0x70, 0x65, 0x72, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x75, 0x70, 0x6C, 0x6F,
-    0x61, 0x64, 0x2D, 0x66, 0x69, 0x6C, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x22, 0x3E, 0x4E, 0x6F,
-    0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3C,
-    0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x73, 0x6D,
-    0x61, 0x6C, 0x6C, 0x22, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x64, 0x6F,
-    0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
-    0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x73, 0x64, 0x63, 0x61, 0x72, 0x64, 0x2D, 0x75, 0x70,
-    0x6C, 0x6F, 0x61, 0x64, 0x27, 0x29, 0x2E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x28, 0x29, 0x22, 0x3E,
-    0x55, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74,
-    0x79, 0x70, 0x65, 0x3D, 0x22, 0x66, 0x69, 0x6C, 0x65, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73,
-    0x64, 0x63, 0x61, 0x72, 0x64, 0x2D, 0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x22, 0x20, 0x61, 0x63,
-    0x63, 0x65, 0x70, 0x74, 0x3D, 0x22, 0x2A, 0x2F, 0x2A, 0x22, 0x20, 0x6F, 0x6E, 0x63, 0x68, 0x61,
-    0x6E, 0x67, 0x65, 0x3D, 0x22, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65,
-    0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x75, 0x70,
-    0x6C, 0x6F, 0x61, 0x64, 0x2D, 0x66, 0x69, 0x6C, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x27, 0x29,
-    0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x54, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x74, 0x68, 0x69,
-    0x73, 0x2E, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x5B, 0x30, 0x5D, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x22,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64,
-    0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C,
-    0x69, 0x63, 0x6B, 0x3D, 0x22, 0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x46, 0x69, 0x6C, 0x65, 0x28,
-    0x29, 0x22, 0x3E, 0x55, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F,
-    0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F,
-    0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x21, 0x2D,
-    0x2D, 0x20, 0x4A, 0x61, 0x76, 0x61, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x66, 0x6F, 0x72,
-    0x20, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x61, 0x63, 0x74, 0x69, 0x76, 0x69, 0x74, 0x79, 0x20, 0x2D,
-    0x2D, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x65, 0x74, 0x20, 0x73, 0x64, 0x43,
-    0x61, 0x72, 0x64, 0x44, 0x61, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x5B, 0x5D, 0x3B, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x53, 0x74, 0x6F, 0x72, 0x65, 0x73,
-    0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x74, 0x69, 0x72, 0x65, 0x20, 0x53, 0x44, 0x20, 0x43,
-    0x61, 0x72, 0x64, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x65, 0x74, 0x20, 0x6E, 0x61, 0x76, 0x69, 0x67, 0x61,
-    0x74, 0x69, 0x6F, 0x6E, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x3D, 0x20, 0x5B, 0x5D, 0x3B, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x4B, 0x65, 0x65, 0x70, 0x73, 0x20, 0x74, 0x72, 0x61,
-    0x63, 0x6B, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x61, 0x76, 0x69, 0x67, 0x61,
-    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x61, 0x74, 0x68, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
-    0x6E, 0x20, 0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x46, 0x69, 0x6C, 0x65, 0x28, 0x29, 0x20, 0x7B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E,
-    0x73, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x3D, 0x20, 0x64,
-    0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65,
-    0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x73, 0x64, 0x63, 0x61, 0x72, 0x64, 0x2D, 0x75,
-    0x70, 0x6C, 0x6F, 0x61, 0x64, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20,
-    0x3D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x66, 0x69, 0x6C, 0x65,
-    0x73, 0x5B, 0x30, 0x5D, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x66, 0x69, 0x6C, 0x65, 0x29, 0x20, 0x7B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x27, 0x50, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x73, 0x65,
-    0x6C, 0x65, 0x63, 0x74, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x75,
-    0x70, 0x6C, 0x6F, 0x61, 0x64, 0x2E, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E,
-    0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x44, 0x61, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x6E, 0x65,
-    0x77, 0x20, 0x46, 0x6F, 0x72, 0x6D, 0x44, 0x61, 0x74, 0x61, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x44, 0x61,
-    0x74, 0x61, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x28, 0x27, 0x66, 0x69, 0x6C, 0x65, 0x27,
-    0x2C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x44, 0x65, 0x74, 0x65, 0x72, 0x6D, 0x69,
-    0x6E, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x70, 0x61,
-    0x74, 0x68, 0x20, 0x62, 0x61, 0x73, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
-    0x6E, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E,
-    0x73, 0x74, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x46, 0x6F, 0x6C, 0x64, 0x65, 0x72,
-    0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x46, 0x6F, 0x6C,
-    0x64, 0x65, 0x72, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x6C, 0x65, 0x74, 0x20, 0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x50, 0x61, 0x74,
-    0x68, 0x20, 0x3D, 0x20, 0x27, 0x2F, 0x6D, 0x6E, 0x74, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x61, 0x76, 0x69,
-    0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x2E, 0x6C, 0x65, 0x6E, 0x67,
-    0x74, 0x68, 0x20, 0x3E, 0x20, 0x31, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20,
-    0x70, 0x61, 0x74, 0x68, 0x50, 0x61, 0x72, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x6E, 0x61, 0x76, 0x69,
-    0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x2E, 0x73, 0x6C, 0x69, 0x63,
-    0x65, 0x28, 0x31, 0x29, 0x2E, 0x6D, 0x61, 0x70, 0x28, 0x66, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x20,
-    0x3D, 0x3E, 0x20, 0x66, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x29, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x50, 0x61, 0x74, 0x68, 0x20, 0x3D, 0x20, 0x70, 0x61,
-    0x74, 0x68, 0x2E, 0x6A, 0x6F, 0x69, 0x6E, 0x28, 0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x50, 0x61,
-    0x74, 0x68, 0x2C, 0x20, 0x2E, 0x2E, 0x2E, 0x70, 0x61, 0x74, 0x68, 0x50, 0x61, 0x72, 0x74, 0x73,
-    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D,
-    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F,
-    0x72, 0x6D, 0x44, 0x61, 0x74, 0x61, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x28, 0x27, 0x70,
-    0x61, 0x74, 0x68, 0x27, 0x2C, 0x20, 0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x50, 0x61, 0x74, 0x68,
-    0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x74, 0x72, 0x79, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x53, 0x68, 0x6F, 0x77, 0x20, 0x75, 0x70,
-    0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
-    0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x45, 0x6C, 0x65, 0x6D, 0x65,
-    0x6E, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65,
-    0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x73, 0x64,
-    0x63, 0x61, 0x72, 0x64, 0x2D, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x27, 0x29, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
-    0x74, 0x61, 0x74, 0x75, 0x73, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x74, 0x65, 0x78,
-    0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x27, 0x55, 0x70, 0x6C, 0x6F,
-    0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x2E, 0x2E, 0x27, 0x3B, 0x0A,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x20,
-    0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F,
-    0x61, 0x70, 0x69, 0x2F, 0x73, 0x64, 0x63, 0x61, 0x72, 0x64, 0x2F, 0x75, 0x70, 0x6C, 0x6F, 0x61,
-    0x64, 0x27, 0x2C, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64,
-    0x3A, 0x20, 0x27, 0x50, 0x4F, 0x53, 0x54, 0x27, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F,
-    0x64, 0x79, 0x3A, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x44, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x29, 0x3B,
-    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x3D,
-    0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E,
-    0x6A, 0x73, 0x6F, 0x6E, 0x28, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x72, 0x65, 0x73,
-    0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x27, 0x46, 0x69, 0x6C, 0x65, 0x20, 0x75, 0x70, 0x6C, 0x6F,
-    0x61, 0x64, 0x65, 0x64, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x66, 0x75, 0x6C, 0x6C,
-    0x79, 0x21, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x53,
-    0x44, 0x43, 0x61, 0x72, 0x64, 0x44, 0x61, 0x74, 0x61, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x74,
-    0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x27, 0x46, 0x69,
-    0x6C, 0x65, 0x20, 0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x20, 0x73, 0x75, 0x63, 0x63,
-    0x65, 0x73, 0x73, 0x66, 0x75, 0x6C, 0x6C, 0x79, 0x2E, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x66, 0x69, 0x6C, 0x65, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
-    0x3D, 0x20, 0x27, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x45, 0x72, 0x72,
-    0x6F, 0x72, 0x28, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67,
-    0x65, 0x20, 0x7C, 0x7C, 0x20, 0x27, 0x46, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20,
-    0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E,
-    0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72,
-    0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x2E, 0x65, 0x72, 0x72, 0x6F,
-    0x72, 0x28, 0x27, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x69,
-    0x6E, 0x67, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x3A, 0x27, 0x2C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72,
-    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x60, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20,
-    0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x3A, 0x20,
-    0x24, 0x7B, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x7D,
-    0x60, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
-    0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65,
-    0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49,
-    0x64, 0x28, 0x27, 0x73, 0x64, 0x63, 0x61, 0x72, 0x64, 0x2D, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
-    0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
-    0x74, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20,
-    0x60, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x3A, 0x20, 0x24, 0x7B, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x2E,
-    0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x7D, 0x60, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75,
-    0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42,
-    0x79, 0x49, 0x64, 0x28, 0x27, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F,
-    0x72, 0x5F, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x27, 0x29, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76,
-    0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x27, 0x69, 0x6E, 0x70,
-    0x75, 0x74, 0x27, 0x2C, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x28, 0x65,
-    0x76, 0x65, 0x6E, 0x74, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x68, 0x65, 0x78, 0x43, 0x6F, 0x6C,
-    0x6F, 0x72, 0x20, 0x3D, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x74, 0x61, 0x72, 0x67, 0x65,
-    0x74, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65,
-    0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x61, 0x63,
-    0x63, 0x65, 0x6E, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x68, 0x65, 0x78, 0x27, 0x29,
-    0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x68,
-    0x65, 0x78, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x7D, 0x29, 0x3B, 0x0A, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61,
-    0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x65,
-    0x74, 0x63, 0x68, 0x53, 0x44, 0x43, 0x61, 0x72, 0x64, 0x44, 0x61, 0x74, 0x61, 0x28, 0x29, 0x20,
-    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F,
-    0x6E, 0x73, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
-    0x74, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74,
-    0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x73, 0x64, 0x63,
-    0x61, 0x72, 0x64, 0x2D, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x79, 0x20, 0x7B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x20, 0x3D,
-    0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x22, 0x2F, 0x61,
-    0x70, 0x69, 0x2F, 0x73, 0x64, 0x63, 0x61, 0x72, 0x64, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E,
-    0x73, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20,
-    0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x28, 0x29, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6F,
-    0x6B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x64, 0x43, 0x61, 0x72, 0x64, 0x44,
-    0x61, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x3B, 0x20, 0x2F, 0x2F, 0x20, 0x53,
-    0x74, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x74, 0x69, 0x72, 0x65, 0x20,
-    0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x61,
-    0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x3D, 0x20,
-    0x5B, 0x20, 0x7B, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x20, 0x22, 0x52, 0x6F, 0x6F, 0x74, 0x22,
-    0x2C, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x20, 0x22, 0x66, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x22,
-    0x2C, 0x20, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x20, 0x73, 0x64, 0x43, 0x61,
-    0x72, 0x64, 0x44, 0x61, 0x74, 0x61, 0x20, 0x7D, 0x20, 0x5D, 0x3B, 0x20, 0x2F, 0x2F, 0x20, 0x49,
-    0x6E, 0x69, 0x74, 0x69, 0x61, 0x6C, 0x69, 0x7A, 0x65, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x20,
-    0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x6F, 0x6F, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
-    0x6E, 0x64, 0x65, 0x72, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x46, 0x6F, 0x6C, 0x64, 0x65,
-    0x72, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x45,
-    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65,
-    0x6E, 0x74, 0x20, 0x3D, 0x20, 0x22, 0x53, 0x44, 0x20, 0x63, 0x61, 0x72, 0x64, 0x20, 0x64, 0x61,
-    0x74, 0x61, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73,
-    0x73, 0x66, 0x75, 0x6C, 0x6C, 0x79, 0x2E, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65,
-    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x6E, 0x65, 0x77,
-    0x20, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x6D, 0x65, 0x73, 0x73,
-    0x61, 0x67, 0x65, 0x20, 0x7C, 0x7C, 0x20, 0x22, 0x46, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x74,
-    0x6F, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x20, 0x53, 0x44, 0x20, 0x63, 0x61, 0x72, 0x64, 0x20,
-    0x64, 0x61, 0x74, 0x61, 0x2E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28,
-    0x65, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x45,
-    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65,
-    0x6E, 0x74, 0x20, 0x3D, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61,
-    0x67, 0x65, 0x20, 0x7C, 0x7C, 0x20, 0x22, 0x46, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F,
-    0x20, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x53, 0x44, 0x20, 0x63, 0x61, 0x72, 0x64, 0x20, 0x64, 0x61,
-    0x74, 0x61, 0x2E, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x2E, 0x65, 0x72,
-    0x72, 0x6F, 0x72, 0x28, 0x22, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68,
-    0x69, 0x6E, 0x67, 0x20, 0x53, 0x44, 0x20, 0x43, 0x61, 0x72, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61,
-    0x3A, 0x22, 0x2C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
-    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x67, 0x65, 0x74, 0x43, 0x75, 0x72, 0x72, 0x65,
-    0x6E, 0x74, 0x46, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20,
-    0x6E, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x5B,
-    0x6E, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x2E,
-    0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x2D, 0x20, 0x31, 0x5D, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x43,
-    0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x46, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x28, 0x29, 0x20, 0x7B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E,
-    0x73, 0x74, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x46, 0x6F, 0x6C, 0x64, 0x65, 0x72,
-    0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x46, 0x6F, 0x6C,
-    0x64, 0x65, 0x72, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75,
-    0x72, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75,
-    0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42,
-    0x79, 0x49, 0x64, 0x28, 0x22, 0x73, 0x64, 0x63, 0x61, 0x72, 0x64, 0x2D, 0x73, 0x74, 0x72, 0x75,
-    0x63, 0x74, 0x75, 0x72, 0x65, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x45, 0x6C,
-    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20,
-    0x3D, 0x20, 0x22, 0x22, 0x3B, 0x20, 0x2F, 0x2F, 0x20, 0x43, 0x6C, 0x65, 0x61, 0x72, 0x20, 0x65,
-    0x78, 0x69, 0x73, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x73,
-    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
-    0x20, 0x28, 0x21, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x46, 0x6F, 0x6C, 0x64, 0x65, 0x72,
-    0x2E, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x20, 0x7C, 0x7C, 0x20, 0x63, 0x75, 0x72,
-    0x72, 0x65, 0x6E, 0x74, 0x46, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x2E, 0x63, 0x68, 0x69, 0x6C, 0x64,
-    0x72, 0x65, 0x6E, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x30,
-    0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x45, 0x6C, 0x65,
-    0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74,
-    0x20, 0x3D, 0x20, 0x22, 0x54, 0x68, 0x69, 0x73, 0x20, 0x66, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x20,
-    0x69, 0x73, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2E, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75,
-    0x72, 0x6E, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
-    0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x6C, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65,
-    0x6E, 0x74, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
-    0x28, 0x22, 0x75, 0x6C, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x75, 0x6C, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74,
-    0x2E, 0x61, 0x64, 0x64, 0x28, 0x22, 0x66, 0x69, 0x6C, 0x65, 0x2D, 0x65, 0x78, 0x70, 0x6C, 0x6F,
-    0x72, 0x65, 0x72, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x46, 0x6F, 0x6C, 0x64, 0x65,
-    0x72, 0x2E, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x2E, 0x66, 0x6F, 0x72, 0x45, 0x61,
-    0x63, 0x68, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E,
-    0x73, 0x74, 0x20, 0x6C, 0x69, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
-    0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x22,
-    0x6C, 0x69, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x66, 0x69, 0x6C,
-    0x65, 0x4E, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
-    0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x22,
-    0x73, 0x70, 0x61, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x4E, 0x61, 0x6D, 0x65,
-    0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x22,
-    0x66, 0x69, 0x6C, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x6C,
-    0x65, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E,
-    0x74, 0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x3B, 0x0A, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x69, 0x66, 0x20, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x3D,
-    0x3D, 0x20, 0x22, 0x66, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x22, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73,
-    0x4C, 0x69, 0x73, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x22, 0x66, 0x6F, 0x6C, 0x64, 0x65, 0x72,
-    0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x4E, 0x61, 0x6D, 0x65,
-    0x2E, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x20, 0x3D, 0x20, 0x28, 0x29, 0x20, 0x3D, 0x3E,
-    0x20, 0x6E, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x65, 0x49, 0x6E, 0x74, 0x6F, 0x46, 0x6F, 0x6C,
-    0x64, 0x65, 0x72, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73,
-    0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x4E, 0x61, 0x6D, 0x65,
-    0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x22,
-    0x66, 0x69, 0x6C, 0x65, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x69, 0x2E, 0x61, 0x70,
-    0x70, 0x65, 0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x4E, 0x61,
-    0x6D, 0x65, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x74,
-    0x79, 0x70, 0x65, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x22, 0x66, 0x69, 0x6C, 0x65, 0x22, 0x29, 0x20,
-    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x61, 0x63, 0x74, 0x69,
-    0x6F, 0x6E, 0x43, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x64, 0x6F,
-    0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65,
-    0x6D, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x43, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x65, 0x72,
-    0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x22,
-    0x66, 0x69, 0x6C, 0x65, 0x2D, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x22, 0x29, 0x3B, 0x0A,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x64, 0x6F, 0x77, 0x6E, 0x6C,
-    0x6F, 0x61, 0x64, 0x42, 0x74, 0x6E, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E,
-    0x74, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28,
-    0x22, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64,
-    0x6F, 0x77, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x42, 0x74, 0x6E, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43,
-    0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x22, 0x44, 0x6F, 0x77, 0x6E, 0x6C, 0x6F,
-    0x61, 0x64, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x77, 0x6E, 0x6C, 0x6F, 0x61,
-    0x64, 0x42, 0x74, 0x6E, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x61,
-    0x64, 0x64, 0x28, 0x22, 0x73, 0x6D, 0x61, 0x6C, 0x6C, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x64, 0x6F, 0x77, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x42, 0x74, 0x6E, 0x2E, 0x63, 0x6C, 0x61,
-    0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x22, 0x64, 0x6F, 0x77, 0x6E,
-    0x6C, 0x6F, 0x61, 0x64, 0x2D, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x64, 0x6F, 0x77, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x42, 0x74, 0x6E, 0x2E, 0x6F,
-    0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x20, 0x3D, 0x20, 0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x64,
-    0x6F, 0x77, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x46, 0x69, 0x6C, 0x65, 0x28, 0x69, 0x74, 0x65, 0x6D,
-    0x2E, 0x70, 0x61, 0x74, 0x68, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69,
-    0x6F, 0x6E, 0x43, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x65, 0x72, 0x2E, 0x61, 0x70, 0x70, 0x65,
-    0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x64, 0x6F, 0x77, 0x6E, 0x6C, 0x6F, 0x61, 0x64,
-    0x42, 0x74, 0x6E, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74,
-    0x20, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x42, 0x74, 0x6E, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63,
-    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D,
-    0x65, 0x6E, 0x74, 0x28, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x42, 0x74, 0x6E, 0x2E, 0x74, 0x65, 0x78,
-    0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x22, 0x44, 0x65, 0x6C, 0x65,
-    0x74, 0x65, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x42,
-    0x74, 0x6E, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x61, 0x64, 0x64,
-    0x28, 0x22, 0x73, 0x6D, 0x61, 0x6C, 0x6C, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64,
-    0x65, 0x6C, 0x65, 0x74, 0x65, 0x42, 0x74, 0x6E, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69,
-    0x73, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x22, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x2D, 0x62,
-    0x75, 0x74, 0x74, 0x6F, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x6C,
-    0x65, 0x74, 0x65, 0x42, 0x74, 0x6E, 0x2E, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x20, 0x3D,
-    0x20, 0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x46, 0x69, 0x6C,
-    0x65, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x2C, 0x20, 0x69, 0x74, 0x65,
-    0x6D, 0x2E, 0x70, 0x61, 0x74, 0x68, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74,
-    0x69, 0x6F, 0x6E, 0x43, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x65, 0x72, 0x2E, 0x61, 0x70, 0x70,
-    0x65, 0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x42,
-    0x74, 0x6E, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x69, 0x2E, 0x61, 0x70, 0x70,
-    0x65, 0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x43,
-    0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x65, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6C,
-    0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x6C, 0x69, 0x29,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x29,
-    0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
-    0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E,
-    0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x75, 0x6C, 0x29, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64,
-    0x61, 0x74, 0x65, 0x42, 0x72, 0x65, 0x61, 0x64, 0x63, 0x72, 0x75, 0x6D, 0x62, 0x28, 0x29, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x75, 0x70,
-    0x64, 0x61, 0x74, 0x65, 0x42, 0x72, 0x65, 0x61, 0x64, 0x63, 0x72, 0x75, 0x6D, 0x62, 0x28, 0x29,
-    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
-    0x6F, 0x6E, 0x73, 0x74, 0x20, 0x62, 0x72, 0x65, 0x61, 0x64, 0x63, 0x72, 0x75, 0x6D, 0x62, 0x20,
-    0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C,
-    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x62, 0x72, 0x65, 0x61, 0x64,
-    0x63, 0x72, 0x75, 0x6D, 0x62, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x64, 0x63, 0x72, 0x75, 0x6D, 0x62, 0x2E,
-    0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x22, 0x22, 0x3B, 0x20,
-    0x2F, 0x2F, 0x20, 0x43, 0x6C, 0x65, 0x61, 0x72, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x69, 0x6E,
-    0x67, 0x20, 0x62, 0x72, 0x65, 0x61, 0x64, 0x63, 0x72, 0x75, 0x6D, 0x62, 0x73, 0x0A, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x61, 0x76, 0x69, 0x67,
-    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x2E, 0x66, 0x6F, 0x72, 0x45, 0x61,
-    0x63, 0x68, 0x28, 0x28, 0x66, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x2C, 0x20, 0x69, 0x6E, 0x64, 0x65,
-    0x78, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x72,
-    0x75, 0x6D, 0x62, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x63,
-    0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x73, 0x70,
-    0x61, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x72, 0x75, 0x6D, 0x62, 0x2E, 0x63, 0x6C, 0x61, 0x73,
-    0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x22, 0x62, 0x72, 0x65, 0x61, 0x64,
-    0x63, 0x72, 0x75, 0x6D, 0x62, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x72,
-    0x75, 0x6D, 0x62, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20,
-    0x3D, 0x20, 0x66, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x3B, 0x0A, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x69, 0x66, 0x20, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3C, 0x20, 0x6E, 0x61, 0x76, 0x69,
-    0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x2E, 0x6C, 0x65, 0x6E, 0x67,
-    0x74, 0x68, 0x20, 0x2D, 0x20, 0x31, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x72,
-    0x75, 0x6D, 0x62, 0x2E, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x20, 0x3D, 0x20, 0x28, 0x29,
-    0x20, 0x3D, 0x3E, 0x20, 0x6E, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x65, 0x54, 0x6F, 0x42, 0x72,
-    0x65, 0x61, 0x64, 0x63, 0x72, 0x75, 0x6D, 0x62, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F,
-    0x20, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x66, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x20,
-    0x2D, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x61, 0x62, 0x6C, 0x65, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x72, 0x75, 0x6D, 0x62, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E,
-    0x63, 0x75, 0x72, 0x73, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x27, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C,
-    0x74, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x72, 0x75, 0x6D, 0x62, 0x2E, 0x73, 0x74,
-    0x79, 0x6C, 0x65, 0x2E, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x27, 0x23, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x64, 0x63,
-    0x72, 0x75, 0x6D, 0x62, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64,
-    0x28, 0x63, 0x72, 0x75, 0x6D, 0x62, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63,
-    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x65, 0x49, 0x6E, 0x74,
-    0x6F, 0x46, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x28, 0x66, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x29, 0x20,
-    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x61,
-    0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x2E, 0x70, 0x75,
-    0x73, 0x68, 0x28, 0x66, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x43, 0x75,
-    0x72, 0x72, 0x65, 0x6E, 0x74, 0x46, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x28, 0x29, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x61, 0x76, 0x69, 0x67,
-    0x61, 0x74, 0x65, 0x54, 0x6F, 0x42, 0x72, 0x65, 0x61, 0x64, 0x63, 0x72, 0x75, 0x6D, 0x62, 0x28,
-    0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x52, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x20, 0x66,
-    0x6F, 0x6C, 0x64, 0x65, 0x72, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20,
-    0x73, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
-    0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x62, 0x72, 0x65, 0x61, 0x64, 0x63, 0x72,
-    0x75, 0x6D, 0x62, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x6E, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x20,
-    0x3D, 0x20, 0x6E, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x74, 0x61, 0x63,
-    0x6B, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x30, 0x2C, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78,
-    0x20, 0x2B, 0x20, 0x31, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74,
-    0x46, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E,
-    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x61, 0x73, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x28, 0x70,
-    0x61, 0x74, 0x68, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2E, 0x73,
-    0x70, 0x6C, 0x69, 0x74, 0x28, 0x27, 0x2F, 0x27, 0x29, 0x2E, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73,
-    0x65, 0x28, 0x29, 0x5B, 0x30, 0x5D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63,
-    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x6F, 0x77, 0x6E, 0x6C, 0x6F,
-    0x61, 0x64, 0x46, 0x69, 0x6C, 0x65, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x50, 0x61, 0x74, 0x68, 0x29,
-    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
-    0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x20, 0x3D, 0x20,
-    0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x22, 0x2F, 0x61, 0x70,
-    0x69, 0x2F, 0x73, 0x64, 0x63, 0x61, 0x72, 0x64, 0x2F, 0x64, 0x6F, 0x77, 0x6E, 0x6C, 0x6F, 0x61,
-    0x64, 0x22, 0x2C, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x22, 0x50,
-    0x4F, 0x53, 0x54, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x3A, 0x20, 0x7B,
-    0x20, 0x22, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 0x54, 0x79, 0x70, 0x65, 0x22, 0x3A,
-    0x20, 0x22, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x73,
-    0x6F, 0x6E, 0x22, 0x20, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x3A, 0x20, 0x4A, 0x53, 0x4F,
-    0x4E, 0x2E, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x69, 0x66, 0x79, 0x28, 0x7B, 0x20, 0x70, 0x61,
-    0x74, 0x68, 0x3A, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x50, 0x61, 0x74, 0x68, 0x20, 0x7D, 0x29, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x29, 0x3B, 0x0A,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
-    0x28, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x7B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x62, 0x6C, 0x6F, 0x62, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61,
-    0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x62, 0x6C, 0x6F, 0x62,
-    0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x72, 0x6C, 0x20, 0x3D, 0x20,
-    0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x55, 0x52, 0x4C, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74,
-    0x65, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x55, 0x52, 0x4C, 0x28, 0x62, 0x6C, 0x6F, 0x62, 0x29,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x61, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75,
-    0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65,
-    0x6E, 0x74, 0x28, 0x22, 0x61, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x2E, 0x68, 0x72, 0x65, 0x66, 0x20,
-    0x3D, 0x20, 0x75, 0x72, 0x6C, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x2E, 0x64, 0x6F, 0x77, 0x6E, 0x6C, 0x6F, 0x61,
-    0x64, 0x20, 0x3D, 0x20, 0x62, 0x61, 0x73, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x28, 0x66, 0x69, 0x6C,
-    0x65, 0x50, 0x61, 0x74, 0x68, 0x29, 0x3B, 0x20, 0x2F, 0x2F, 0x20, 0x55, 0x73, 0x65, 0x20, 0x74,
-    0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x66, 0x72, 0x6F,
-    0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x2E, 0x63, 0x6C, 0x69,
-    0x63, 0x6B, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x55, 0x52, 0x4C,
-    0x2E, 0x72, 0x65, 0x76, 0x6F, 0x6B, 0x65, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x55, 0x52, 0x4C,
-    0x28, 0x75, 0x72, 0x6C, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73,
-    0x74, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x44, 0x61, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x61, 0x77,
-    0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6A, 0x73, 0x6F,
-    0x6E, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72,
-    0x44, 0x61, 0x74, 0x61, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x20, 0x7C, 0x7C, 0x20,
-    0x22, 0x46, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x6F, 0x77, 0x6E, 0x6C,
-    0x6F, 0x61, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x22, 0x29, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
-    0x20, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x46, 0x69, 0x6C, 0x65, 0x28, 0x66, 0x69, 0x6C, 0x65,
-    0x4E, 0x61, 0x6D, 0x65, 0x2C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x50, 0x61, 0x74, 0x68, 0x29, 0x20,
-    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F,
-    0x6E, 0x73, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x72, 0x6D, 0x44, 0x65, 0x6C, 0x65, 0x74,
-    0x65, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x72, 0x6D, 0x28, 0x22, 0x41, 0x72, 0x65,
-    0x20, 0x79, 0x6F, 0x75, 0x20, 0x73, 0x75, 0x72, 0x65, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x77, 0x61,
-    0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x22, 0x20, 0x2B,
-    0x20, 0x66, 0x69, 0x6C, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x20, 0x2B, 0x20, 0x22, 0x3F, 0x22, 0x29,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
-    0x20, 0x28, 0x21, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x72, 0x6D, 0x44, 0x65, 0x6C, 0x65, 0x74, 0x65,
-    0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73,
-    0x70, 0x6F, 0x6E, 0x73, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65,
-    0x74, 0x63, 0x68, 0x28, 0x22, 0x2F, 0x61, 0x70, 0x69, 0x2F, 0x73, 0x64, 0x63, 0x61, 0x72, 0x64,
-    0x3F, 0x70, 0x61, 0x74, 0x68, 0x3D, 0x22, 0x20, 0x2B, 0x20, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x65,
-    0x55, 0x52, 0x49, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x50, 0x61, 0x74, 0x68, 0x29, 0x2C, 0x20, 0x7B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x22, 0x44, 0x45, 0x4C, 0x45, 0x54, 0x45,
-    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x3A, 0x20, 0x7B, 0x20, 0x22, 0x43,
-    0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 0x54, 0x79, 0x70, 0x65, 0x22, 0x3A, 0x20, 0x22, 0x61,
-    0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x22,
-    0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D,
-    0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x69, 0x66, 0x20, 0x28, 0x21, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6F, 0x6B,
-    0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x44,
-    0x61, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70,
-    0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x65,
-    0x72, 0x74, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x44, 0x61, 0x74, 0x61, 0x2E, 0x6D, 0x65, 0x73,
-    0x73, 0x61, 0x67, 0x65, 0x20, 0x7C, 0x7C, 0x20, 0x22, 0x46, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x20,
-    0x74, 0x6F, 0x20, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
-    0x6C, 0x65, 0x2E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x53, 0x44, 0x43, 0x61, 0x72,
-    0x64, 0x44, 0x61, 0x74, 0x61, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x46,
-    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C,
-    0x65, 0x20, 0x74, 0x61, 0x62, 0x20, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
-    0x20, 0x6F, 0x70, 0x65, 0x6E, 0x54, 0x61, 0x62, 0x28, 0x65, 0x76, 0x74, 0x2C, 0x20, 0x74, 0x61,
-    0x62, 0x4E, 0x61, 0x6D, 0x65, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x74, 0x61, 0x62, 0x63, 0x6F,
-    0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
-    0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x43, 0x6C,
-    0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x22, 0x74, 0x61, 0x62, 0x63, 0x6F, 0x6E, 0x74,
-    0x65, 0x6E, 0x74, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x6C, 0x65, 0x74, 0x20, 0x69, 0x20, 0x3D, 0x20,
-    0x30, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x74, 0x61, 0x62, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E,
-    0x74, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x74, 0x61, 0x62, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x5B, 0x69, 0x5D, 0x2E, 0x63,
-    0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28,
-    0x22, 0x73, 0x68, 0x6F, 0x77, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x69, 0x6E, 0x6B,
-    0x73, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74,
-    0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x4E,
-    0x61, 0x6D, 0x65, 0x28, 0x22, 0x74, 0x61, 0x62, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x22, 0x29, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72,
-    0x20, 0x28, 0x6C, 0x65, 0x74, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x20, 0x69, 0x20, 0x3C,
-    0x20, 0x74, 0x61, 0x62, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68,
-    0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x69, 0x6E, 0x6B,
-    0x73, 0x5B, 0x69, 0x5D, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x72,
-    0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x22, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x22, 0x29, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D,
-    0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79,
-    0x49, 0x64, 0x28, 0x74, 0x61, 0x62, 0x4E, 0x61, 0x6D, 0x65, 0x29, 0x2E, 0x63, 0x6C, 0x61, 0x73,
-    0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x22, 0x73, 0x68, 0x6F, 0x77, 0x22,
-    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65,
-    0x76, 0x74, 0x2E, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x54, 0x61, 0x72, 0x67, 0x65, 0x74,
-    0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x22,
-    0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x61, 0x62, 0x4E, 0x61,
-    0x6D, 0x65, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x22, 0x53, 0x44, 0x43, 0x61, 0x72, 0x64, 0x22, 0x29,
-    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x53, 0x44, 0x43, 0x61, 0x72, 0x64, 0x44, 0x61,
-    0x74, 0x61, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x53, 0x65, 0x74, 0x20, 0x74, 0x68,
-    0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x74, 0x61, 0x62, 0x20, 0x74, 0x6F,
-    0x20, 0x6F, 0x70, 0x65, 0x6E, 0x20, 0x6F, 0x6E, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x6C, 0x6F,
-    0x61, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D,
-    0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79,
-    0x49, 0x64, 0x28, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x54, 0x61, 0x62, 0x22, 0x29,
-    0x2E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x28, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74,
-    0x6F, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x73,
-    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65,
-    0x20, 0x45, 0x53, 0x50, 0x33, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
-    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x53, 0x65, 0x74, 0x74,
-    0x69, 0x6E, 0x67, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x61, 0x70, 0x69,
-    0x2F, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x68, 0x65,
-    0x6E, 0x28, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x20, 0x3D, 0x3E, 0x20, 0x72, 0x65,
-    0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x28, 0x29, 0x29, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E,
-    0x74, 0x68, 0x65, 0x6E, 0x28, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x57, 0x69, 0x46, 0x69, 0x2F, 0x42, 0x4C, 0x45, 0x20, 0x53,
-    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75,
-    0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42,
-    0x79, 0x49, 0x64, 0x28, 0x27, 0x62, 0x72, 0x6F, 0x61, 0x64, 0x63, 0x61, 0x73, 0x74, 0x5F, 0x73,
-    0x70, 0x65, 0x65, 0x64, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x64,
-    0x61, 0x74, 0x61, 0x2E, 0x62, 0x72, 0x6F, 0x61, 0x64, 0x63, 0x61, 0x73, 0x74, 0x5F, 0x73, 0x70,
-    0x65, 0x65, 0x64, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x52, 0x47, 0x42,
-    0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F,
-    0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
-    0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x72, 0x61, 0x69, 0x6E, 0x62, 0x6F, 0x77, 0x5F, 0x6D,
-    0x6F, 0x64, 0x65, 0x27, 0x29, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x20, 0x3D, 0x20,
-    0x64, 0x61, 0x74, 0x61, 0x2E, 0x72, 0x61, 0x69, 0x6E, 0x62, 0x6F, 0x77, 0x5F, 0x6D, 0x6F, 0x64,
-    0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E,
-    0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27,
-    0x72, 0x67, 0x62, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75,
-    0x65, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x72, 0x67, 0x62, 0x5F, 0x73, 0x70, 0x65,
-    0x65, 0x64, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x45, 0x76, 0x69, 0x6C,
-    0x20, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65,
-    0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x6F,
-    0x72, 0x74, 0x61, 0x6C, 0x5F, 0x75, 0x72, 0x6C, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65,
-    0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x75,
-    0x72, 0x6C, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
-    0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28,
-    0x27, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x27, 0x29, 0x2E, 0x76,
-    0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x70, 0x6F, 0x72, 0x74,
-    0x61, 0x6C, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63,
-    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
-    0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x70, 0x61, 0x73,
-    0x73, 0x77, 0x6F, 0x72, 0x64, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20,
-    0x64, 0x61, 0x74, 0x61, 0x2E, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x70, 0x61, 0x73, 0x73,
-    0x77, 0x6F, 0x72, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65,
-    0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49,
-    0x64, 0x28, 0x27, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x61, 0x70, 0x5F, 0x73, 0x73, 0x69,
-    0x64, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61,
-    0x2E, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x61, 0x70, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65,
-    0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x6F,
-    0x72, 0x74, 0x61, 0x6C, 0x5F, 0x64, 0x6F, 0x6D, 0x61, 0x69, 0x6E, 0x27, 0x29, 0x2E, 0x76, 0x61,
-    0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x70, 0x6F, 0x72, 0x74, 0x61,
-    0x6C, 0x5F, 0x64, 0x6F, 0x6D, 0x61, 0x69, 0x6E, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F,
-    0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
-    0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x6F, 0x66,
-    0x66, 0x6C, 0x69, 0x6E, 0x65, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x27, 0x29, 0x2E, 0x63, 0x68, 0x65,
-    0x63, 0x6B, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x70, 0x6F, 0x72, 0x74,
-    0x61, 0x6C, 0x5F, 0x6F, 0x66, 0x66, 0x6C, 0x69, 0x6E, 0x65, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x3B,
-    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x50, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x50,
-    0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74,
-    0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x72, 0x69,
-    0x6E, 0x74, 0x65, 0x72, 0x5F, 0x69, 0x70, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
-    0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x5F, 0x69,
-    0x70, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E,
-    0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27,
-    0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x5F, 0x74, 0x65, 0x78, 0x74, 0x27, 0x29, 0x2E, 0x76,
-    0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x70, 0x72, 0x69, 0x6E,
-    0x74, 0x65, 0x72, 0x5F, 0x74, 0x65, 0x78, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F,
-    0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
-    0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x5F, 0x66,
-    0x6F, 0x6E, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65,
-    0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x5F,
-    0x66, 0x6F, 0x6E, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64,
-    0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65,
-    0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x5F,
-    0x61, 0x6C, 0x69, 0x67, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75,
-    0x65, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72,
-    0x5F, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x3B, 0x0A, 0x0A, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x2F, 0x2F, 0x20, 0x46, 0x6C, 0x61, 0x70, 0x70, 0x79, 0x20, 0x47, 0x68, 0x6F, 0x73,
-    0x74, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64,
-    0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65,
-    0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x66, 0x6C, 0x61, 0x70, 0x70, 0x79, 0x5F, 0x6E,
-    0x61, 0x6D, 0x65, 0x5F, 0x74, 0x65, 0x78, 0x74, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65,
-    0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x66, 0x6C, 0x61, 0x70, 0x70, 0x79, 0x5F, 0x67,
-    0x68, 0x6F, 0x73, 0x74, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x7C, 0x7C, 0x20, 0x27, 0x27, 0x3B,
-    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67,
-    0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x61,
-    0x63, 0x63, 0x65, 0x6E, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x68, 0x65, 0x78, 0x27,
-    0x29, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20,
-    0x64, 0x61, 0x74, 0x61, 0x2E, 0x68, 0x65, 0x78, 0x5F, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x5F,
-    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D,
-    0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79,
-    0x49, 0x64, 0x28, 0x27, 0x74, 0x69, 0x6D, 0x65, 0x7A, 0x6F, 0x6E, 0x65, 0x5F, 0x73, 0x65, 0x6C,
-    0x65, 0x63, 0x74, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x64, 0x61,
-    0x74, 0x61, 0x2E, 0x74, 0x69, 0x6D, 0x65, 0x7A, 0x6F, 0x6E, 0x65, 0x5F, 0x73, 0x74, 0x72, 0x3B,
-    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x73,
-    0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x69, 0x70, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65,
-    0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x73, 0x74,
-    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x69, 0x70, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65,
-    0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x5F,
-    0x69, 0x70, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E,
-    0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64,
-    0x28, 0x27, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x69, 0x70, 0x27, 0x29, 0x2E, 0x76,
-    0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x27, 0x4E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x6E,
-    0x65, 0x63, 0x74, 0x65, 0x64, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x29,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x2E, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x3D, 0x3E,
-    0x20, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x2E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x27,
-    0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x73,
-    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x3A, 0x27, 0x2C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72,
-    0x29, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69,
-    0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69,
-    0x6E, 0x67, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x45, 0x53, 0x50, 0x33, 0x32,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
-    0x6E, 0x20, 0x73, 0x61, 0x76, 0x65, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x28, 0x29,
-    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
-    0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x3D, 0x20,
-    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x2F, 0x2F, 0x20, 0x57, 0x69, 0x46, 0x69, 0x2F, 0x42, 0x4C, 0x45, 0x20, 0x53, 0x65,
-    0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x6F, 0x61, 0x64, 0x63, 0x61, 0x73, 0x74,
-    0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x3A, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6E, 0x74,
-    0x28, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65,
-    0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x62, 0x72, 0x6F, 0x61, 0x64, 0x63,
-    0x61, 0x73, 0x74, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75,
-    0x65, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x3A, 0x20, 0x22, 0x47, 0x68,
-    0x6F, 0x73, 0x74, 0x4E, 0x65, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x5F, 0x70, 0x61, 0x73, 0x73,
-    0x77, 0x6F, 0x72, 0x64, 0x3A, 0x20, 0x22, 0x47, 0x68, 0x6F, 0x73, 0x74, 0x4E, 0x65, 0x74, 0x22,
-    0x2C, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x52, 0x47, 0x42, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E,
-    0x67, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x72, 0x61, 0x69, 0x6E, 0x62, 0x6F, 0x77, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x3A,
-    0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65,
-    0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x72, 0x61, 0x69, 0x6E, 0x62, 0x6F,
-    0x77, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x27, 0x29, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64,
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x72, 0x67, 0x62, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x3A, 0x20, 0x70, 0x61, 0x72,
-    0x73, 0x65, 0x49, 0x6E, 0x74, 0x28, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67,
-    0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x72,
-    0x67, 0x62, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65,
-    0x29, 0x2C, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x45, 0x76, 0x69, 0x6C, 0x20, 0x50, 0x6F, 0x72, 0x74,
-    0x61, 0x6C, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x72, 0x74,
-    0x61, 0x6C, 0x5F, 0x75, 0x72, 0x6C, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
-    0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28,
-    0x27, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x75, 0x72, 0x6C, 0x27, 0x29, 0x2E, 0x76, 0x61,
-    0x6C, 0x75, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x73, 0x73, 0x69, 0x64,
-    0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C,
-    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x6F, 0x72, 0x74, 0x61,
-    0x6C, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2C, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x3A,
-    0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65,
-    0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C,
-    0x5F, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75,
-    0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x61, 0x70, 0x5F, 0x73, 0x73, 0x69,
-    0x64, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45,
-    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x6F, 0x72, 0x74,
-    0x61, 0x6C, 0x5F, 0x61, 0x70, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C,
-    0x75, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x64, 0x6F, 0x6D, 0x61, 0x69,
-    0x6E, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45,
-    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x6F, 0x72, 0x74,
-    0x61, 0x6C, 0x5F, 0x64, 0x6F, 0x6D, 0x61, 0x69, 0x6E, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75,
-    0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x6F, 0x66, 0x66, 0x6C, 0x69, 0x6E,
-    0x65, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
-    0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28,
-    0x27, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x6F, 0x66, 0x66, 0x6C, 0x69, 0x6E, 0x65, 0x5F,
-    0x6D, 0x6F, 0x64, 0x65, 0x27, 0x29, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x2C, 0x0A,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x2F, 0x2F, 0x20, 0x50, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x65,
-    0x72, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74,
-    0x65, 0x72, 0x5F, 0x69, 0x70, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E,
-    0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27,
-    0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x5F, 0x69, 0x70, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C,
-    0x75, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x5F, 0x74, 0x65, 0x78, 0x74,
-    0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C,
-    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x72, 0x69, 0x6E, 0x74,
-    0x65, 0x72, 0x5F, 0x74, 0x65, 0x78, 0x74, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2C,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x5F, 0x66, 0x6F, 0x6E, 0x74, 0x5F, 0x73, 0x69,
-    0x7A, 0x65, 0x3A, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6E, 0x74, 0x28, 0x64, 0x6F, 0x63,
-    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
-    0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x5F, 0x66, 0x6F,
-    0x6E, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29,
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x5F, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x6D,
-    0x65, 0x6E, 0x74, 0x3A, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6E, 0x74, 0x28, 0x64, 0x6F,
-    0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
-    0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x5F, 0x61,
-    0x6C, 0x69, 0x67, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65,
-    0x29, 0x2C, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x46, 0x6C, 0x61, 0x70, 0x70, 0x79, 0x20, 0x47, 0x68,
-    0x6F, 0x73, 0x74, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x61,
-    0x70, 0x70, 0x79, 0x5F, 0x67, 0x68, 0x6F, 0x73, 0x74, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x20,
-    0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D,
-    0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x66, 0x6C, 0x61, 0x70, 0x70, 0x79, 0x5F,
-    0x6E, 0x61, 0x6D, 0x65, 0x5F, 0x74, 0x65, 0x78, 0x74, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75,
-    0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x68, 0x65, 0x78, 0x5F, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x5F, 0x63, 0x6F,
-    0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65,
-    0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x61, 0x63,
-    0x63, 0x65, 0x6E, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x68, 0x65, 0x78, 0x27, 0x29,
-    0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2C, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x69,
-    0x6D, 0x65, 0x7A, 0x6F, 0x6E, 0x65, 0x5F, 0x73, 0x74, 0x72, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75,
-    0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42,
-    0x79, 0x49, 0x64, 0x28, 0x27, 0x74, 0x69, 0x6D, 0x65, 0x7A, 0x6F, 0x6E, 0x65, 0x5F, 0x73, 0x65,
-    0x6C, 0x65, 0x63, 0x74, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2C, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x3B, 0x0A, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20,
-    0x76, 0x61, 0x6C, 0x69, 0x64, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x73,
-    0x20, 0x3D, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x61, 0x74, 0x65, 0x53, 0x65, 0x74, 0x74, 0x69,
-    0x6E, 0x67, 0x73, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x29, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x76,
-    0x61, 0x6C, 0x69, 0x64, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E,
-    0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x3E, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C,
-    0x65, 0x72, 0x74, 0x28, 0x27, 0x50, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x63, 0x6F, 0x72, 0x72,
-    0x65, 0x63, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x69, 0x6E,
-    0x67, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x3A, 0x5C, 0x6E, 0x27, 0x20, 0x2B, 0x20, 0x76,
-    0x61, 0x6C, 0x69, 0x64, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E,
-    0x6A, 0x6F, 0x69, 0x6E, 0x28, 0x27, 0x5C, 0x6E, 0x27, 0x29, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74,
-    0x75, 0x72, 0x6E, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x61, 0x70, 0x69, 0x2F, 0x73, 0x65, 0x74, 0x74,
-    0x69, 0x6E, 0x67, 0x73, 0x27, 0x2C, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A,
-    0x20, 0x27, 0x50, 0x4F, 0x53, 0x54, 0x27, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73,
-    0x3A, 0x20, 0x7B, 0x27, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 0x54, 0x79, 0x70, 0x65,
-    0x27, 0x3A, 0x20, 0x27, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F,
-    0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x3A, 0x20, 0x4A, 0x53,
-    0x4F, 0x4E, 0x2E, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x69, 0x66, 0x79, 0x28, 0x73, 0x65, 0x74,
-    0x74, 0x69, 0x6E, 0x67, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x7D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65,
-    0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E,
-    0x73, 0x65, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x65,
-    0x72, 0x74, 0x28, 0x27, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x73, 0x61, 0x76,
-    0x65, 0x64, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x66, 0x75, 0x6C, 0x6C, 0x79, 0x21,
-    0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x27, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x73, 0x61,
-    0x76, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x27, 0x29,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x7D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E,
-    0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x3D, 0x3E, 0x20, 0x63,
-    0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x2E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x27, 0x45, 0x72,
-    0x72, 0x6F, 0x72, 0x20, 0x73, 0x61, 0x76, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69,
-    0x6E, 0x67, 0x73, 0x3A, 0x27, 0x2C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x29, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74,
-    0x6F, 0x20, 0x73, 0x65, 0x6E, 0x64, 0x20, 0x45, 0x76, 0x69, 0x6C, 0x20, 0x50, 0x6F, 0x72, 0x74,
-    0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68,
-    0x65, 0x20, 0x45, 0x53, 0x50, 0x33, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x65, 0x76,
-    0x69, 0x6C, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x50,
-    0x6F, 0x72, 0x74, 0x61, 0x6C, 0x55, 0x52, 0x4C, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D,
-    0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79,
-    0x49, 0x64, 0x28, 0x27, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x5F, 0x75, 0x72, 0x6C, 0x27, 0x29,
-    0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x6C, 0x65, 0x74, 0x20, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x53, 0x53,
-    0x49, 0x44, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65,
-    0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x6F,
-    0x72, 0x74, 0x61, 0x6C, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75,
-    0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C,
-    0x65, 0x74, 0x20, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72,
-    0x64, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74,
-    0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x6F, 0x72,
-    0x74, 0x61, 0x6C, 0x5F, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x27, 0x29, 0x2E, 0x76,
-    0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x6C, 0x65, 0x74, 0x20, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x41, 0x50, 0x53, 0x53,
-    0x49, 0x44, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65,
-    0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x6F,
-    0x72, 0x74, 0x61, 0x6C, 0x5F, 0x61, 0x70, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x27, 0x29, 0x2E, 0x76,
-    0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x6C, 0x65, 0x74, 0x20, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x44, 0x6F, 0x6D, 0x61,
-    0x69, 0x6E, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65,
-    0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x6F,
-    0x72, 0x74, 0x61, 0x6C, 0x5F, 0x64, 0x6F, 0x6D, 0x61, 0x69, 0x6E, 0x27, 0x29, 0x2E, 0x76, 0x61,
-    0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x2F, 0x2F, 0x20, 0x56, 0x61, 0x6C, 0x69, 0x64, 0x61, 0x74, 0x65, 0x20, 0x69, 0x6E,
-    0x70, 0x75, 0x74, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x20, 0x3D, 0x20,
-    0x5B, 0x5D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x69, 0x66, 0x20, 0x28, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x55, 0x52, 0x4C, 0x20, 0x3D, 0x3D,
-    0x3D, 0x20, 0x27, 0x27, 0x29, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E, 0x70, 0x75, 0x73,
-    0x68, 0x28, 0x27, 0x50, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20,
-    0x61, 0x20, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x20, 0x55, 0x52, 0x4C, 0x20, 0x6F, 0x72, 0x20,
-    0x46, 0x69, 0x6C, 0x65, 0x20, 0x50, 0x61, 0x74, 0x68, 0x2E, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x50, 0x6F,
-    0x72, 0x74, 0x61, 0x6C, 0x53, 0x53, 0x49, 0x44, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x27, 0x27, 0x29,
-    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x27, 0x50, 0x6C,
-    0x65, 0x61, 0x73, 0x65, 0x20, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20, 0x50, 0x6F, 0x72,
-    0x74, 0x61, 0x6C, 0x20, 0x53, 0x53, 0x49, 0x44, 0x2E, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x50, 0x6F, 0x72,
-    0x74, 0x61, 0x6C, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x20, 0x3D, 0x3D, 0x3D, 0x20,
-    0x27, 0x27, 0x29, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28,
-    0x27, 0x50, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20,
-    0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x20, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x2E,
-    0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x69, 0x66, 0x20, 0x28, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x41, 0x50, 0x53, 0x53, 0x49, 0x44,
-    0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x27, 0x27, 0x29, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E,
-    0x70, 0x75, 0x73, 0x68, 0x28, 0x27, 0x50, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x65, 0x6E, 0x74,
-    0x65, 0x72, 0x20, 0x61, 0x20, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x20, 0x41, 0x50, 0x20, 0x53,
-    0x53, 0x49, 0x44, 0x2E, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x44, 0x6F,
-    0x6D, 0x61, 0x69, 0x6E, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x27, 0x27, 0x29, 0x20, 0x65, 0x72, 0x72,
-    0x6F, 0x72, 0x73, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x27, 0x50, 0x6C, 0x65, 0x61, 0x73, 0x65,
-    0x20, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x20,
-    0x44, 0x6F, 0x6D, 0x61, 0x69, 0x6E, 0x2E, 0x27, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x65, 0x72, 0x72, 0x6F,
-    0x72, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x3E, 0x20, 0x30, 0x29, 0x20, 0x7B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x27, 0x50, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x63,
-    0x6F, 0x72, 0x72, 0x65, 0x63, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F,
-    0x77, 0x69, 0x6E, 0x67, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x3A, 0x5C, 0x6E, 0x27, 0x20,
-    0x2B, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E, 0x6A, 0x6F, 0x69, 0x6E, 0x28, 0x27, 0x5C,
-    0x6E, 0x27, 0x29, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x57, 0x72, 0x61, 0x70,
-    0x20, 0x70, 0x61, 0x72, 0x61, 0x6D, 0x65, 0x74, 0x65, 0x72, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x64,
-    0x6F, 0x75, 0x62, 0x6C, 0x65, 0x20, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x20, 0x69, 0x66, 0x20,
-    0x74, 0x68, 0x65, 0x79, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x20, 0x73, 0x70, 0x61,
-    0x63, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x53, 0x53, 0x49, 0x44, 0x20, 0x3D, 0x20, 0x77, 0x72, 0x61,
-    0x70, 0x49, 0x6E, 0x51, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x49, 0x66, 0x4E, 0x65, 0x65, 0x64, 0x65,
-    0x64, 0x28, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x53, 0x53, 0x49, 0x44, 0x29, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x6F, 0x72, 0x74, 0x61,
-    0x6C, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x20, 0x3D, 0x20, 0x77, 0x72, 0x61, 0x70,
-    0x49, 0x6E, 0x51, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x49, 0x66, 0x4E, 0x65, 0x65, 0x64, 0x65, 0x64,
-    0x28, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x29,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x6F,
-    0x72, 0x74, 0x61, 0x6C, 0x41, 0x50, 0x53, 0x53, 0x49, 0x44, 0x20, 0x3D, 0x20, 0x77, 0x72, 0x61,
-    0x70, 0x49, 0x6E, 0x51, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x49, 0x66, 0x4E, 0x65, 0x65, 0x64, 0x65,
-    0x64, 0x28, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x41, 0x50, 0x53, 0x53, 0x49, 0x44, 0x29, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x6F, 0x72,
-    0x74, 0x61, 0x6C, 0x44, 0x6F, 0x6D, 0x61, 0x69, 0x6E, 0x20, 0x3D, 0x20, 0x77, 0x72, 0x61, 0x70,
-    0x49, 0x6E, 0x51, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x49, 0x66, 0x4E, 0x65, 0x65, 0x64, 0x65, 0x64,
-    0x28, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x44, 0x6F, 0x6D, 0x61, 0x69, 0x6E, 0x29, 0x3B, 0x0A,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E,
-    0x73, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x3D, 0x20, 0x60, 0x73, 0x74,
-    0x61, 0x72, 0x74, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x20, 0x24, 0x7B, 0x50, 0x6F, 0x72, 0x74,
-    0x61, 0x6C, 0x55, 0x52, 0x4C, 0x7D, 0x20, 0x24, 0x7B, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x53,
-    0x53, 0x49, 0x44, 0x7D, 0x20, 0x24, 0x7B, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x50, 0x61, 0x73,
-    0x73, 0x77, 0x6F, 0x72, 0x64, 0x7D, 0x20, 0x24, 0x7B, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x41,
-    0x50, 0x53, 0x53, 0x49, 0x44, 0x7D, 0x20, 0x24, 0x7B, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x44,
-    0x6F, 0x6D, 0x61, 0x69, 0x6E, 0x7D, 0x60, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x61, 0x70,
-    0x69, 0x2F, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x27, 0x2C, 0x20, 0x7B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x65,
-    0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x27, 0x50, 0x4F, 0x53, 0x54, 0x27, 0x2C, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65,
-    0x61, 0x64, 0x65, 0x72, 0x73, 0x3A, 0x20, 0x7B, 0x20, 0x27, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E,
-    0x74, 0x2D, 0x54, 0x79, 0x70, 0x65, 0x27, 0x3A, 0x20, 0x27, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63,
-    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x20, 0x7D, 0x2C, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
-    0x6F, 0x64, 0x79, 0x3A, 0x20, 0x4A, 0x53, 0x4F, 0x4E, 0x2E, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
-    0x69, 0x66, 0x79, 0x28, 0x7B, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x3A, 0x20, 0x63,
-    0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x7D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x72, 0x65, 0x73, 0x70, 0x6F,
-    0x6E, 0x73, 0x65, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x72, 0x65, 0x73,
-    0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x27, 0x45, 0x76, 0x69, 0x6C, 0x20, 0x50, 0x6F, 0x72, 0x74,
-    0x61, 0x6C, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x64, 0x20, 0x53, 0x75, 0x63, 0x63,
-    0x65, 0x73, 0x73, 0x66, 0x75, 0x6C, 0x6C, 0x79, 0x2E, 0x2E, 0x2E, 0x20, 0x59, 0x6F, 0x75, 0x20,
-    0x41, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x77, 0x20, 0x44, 0x69, 0x73, 0x63, 0x6F, 0x6E, 0x6E, 0x65,
-    0x63, 0x74, 0x65, 0x64, 0x20, 0x46, 0x72, 0x6F, 0x6D, 0x20, 0x47, 0x68, 0x6F, 0x73, 0x74, 0x4E,
-    0x65, 0x74, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x27, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20,
-    0x53, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x45, 0x76, 0x69, 0x6C, 0x20, 0x50, 0x6F, 0x72,
-    0x74, 0x61, 0x6C, 0x20, 0x43, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E, 0x2E, 0x2E, 0x27, 0x29,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x7D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E,
-    0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x3D, 0x3E, 0x20, 0x63,
-    0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x2E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x27, 0x45, 0x72,
-    0x72, 0x6F, 0x72, 0x20, 0x53, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x45, 0x76, 0x69, 0x6C,
-    0x20, 0x50, 0x6F, 0x72, 0x74, 0x61, 0x6C, 0x20, 0x43, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E,
-    0x2E, 0x2E, 0x27, 0x2C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x29, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x2F, 0x2F, 0x20, 0x48, 0x65, 0x6C, 0x70, 0x65, 0x72, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
-    0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x77, 0x72, 0x61, 0x70, 0x20, 0x73, 0x74, 0x72, 0x69,
-    0x6E, 0x67, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x20, 0x69, 0x66,
-    0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x20, 0x73, 0x70,
-    0x61, 0x63, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E,
-    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x53, 0x70, 0x61,
-    0x63, 0x65, 0x73, 0x57, 0x69, 0x74, 0x68, 0x41, 0x73, 0x74, 0x65, 0x72, 0x69, 0x73, 0x6B, 0x28,
-    0x73, 0x74, 0x72, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x74, 0x72, 0x2E, 0x69, 0x6E,
-    0x63, 0x6C, 0x75, 0x64, 0x65, 0x73, 0x28, 0x27, 0x20, 0x27, 0x29, 0x20, 0x3F, 0x20, 0x60, 0x22,
-    0x24, 0x7B, 0x73, 0x74, 0x72, 0x7D, 0x22, 0x60, 0x20, 0x3A, 0x20, 0x73, 0x74, 0x72, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74,
-    0x6F, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x61, 0x74, 0x65, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69,
-    0x6E, 0x67, 0x73, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x73, 0x61, 0x76, 0x69, 0x6E,
-    0x67, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
-    0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x61, 0x74, 0x65, 0x53, 0x65, 0x74, 0x74, 0x69,
-    0x6E, 0x67, 0x73, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x29, 0x20, 0x7B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73,
-    0x74, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x5B, 0x5D, 0x3B, 0x0A, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x42,
-    0x72, 0x6F, 0x61, 0x64, 0x63, 0x61, 0x73, 0x74, 0x20, 0x53, 0x70, 0x65, 0x65, 0x64, 0x3A, 0x20,
-    0x35, 0x20, 0x2D, 0x20, 0x31, 0x30, 0x30, 0x30, 0x20, 0x6D, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x28, 0x73, 0x65,
-    0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x62, 0x72, 0x6F, 0x61, 0x64, 0x63, 0x61, 0x73, 0x74,
-    0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20, 0x3E, 0x3D, 0x20, 0x35, 0x20, 0x26, 0x26, 0x20, 0x73,
-    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x62, 0x72, 0x6F, 0x61, 0x64, 0x63, 0x61, 0x73,
-    0x74, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20, 0x3C, 0x3D, 0x20, 0x31, 0x30, 0x30, 0x30, 0x29,
-    0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28,
-    0x27, 0x42, 0x72, 0x6F, 0x61, 0x64, 0x63, 0x61, 0x73, 0x74, 0x20, 0x53, 0x70, 0x65, 0x65, 0x64,
-    0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E,
-    0x20, 0x35, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x31, 0x30, 0x30, 0x30, 0x20, 0x6D, 0x73, 0x2E, 0x27,
-    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D,
-    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F,
-    0x20, 0x52, 0x47, 0x42, 0x20, 0x53, 0x70, 0x65, 0x65, 0x64, 0x3A, 0x20, 0x31, 0x35, 0x20, 0x2D,
-    0x20, 0x35, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x69, 0x66, 0x20, 0x28, 0x21, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x72,
-    0x67, 0x62, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20, 0x3E, 0x3D, 0x20, 0x31, 0x35, 0x20, 0x26,
-    0x26, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x72, 0x67, 0x62, 0x5F, 0x73,
-    0x70, 0x65, 0x65, 0x64, 0x20, 0x3C, 0x3D, 0x20, 0x35, 0x30, 0x29, 0x29, 0x20, 0x7B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65,
-    0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x27, 0x52, 0x47, 0x42, 0x20,
-    0x53, 0x70, 0x65, 0x65, 0x64, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x62, 0x65,
-    0x74, 0x77, 0x65, 0x65, 0x6E, 0x20, 0x31, 0x35, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x35, 0x30, 0x2E,
-    0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F,
-    0x2F, 0x20, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x46, 0x6F, 0x6E, 0x74, 0x20, 0x53,
-    0x69, 0x7A, 0x65, 0x3A, 0x20, 0x31, 0x30, 0x20, 0x2D, 0x20, 0x37, 0x32, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x28, 0x73,
-    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x5F,
-    0x66, 0x6F, 0x6E, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3E, 0x3D, 0x20, 0x31, 0x30, 0x20,
-    0x26, 0x26, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x70, 0x72, 0x69, 0x6E,
-    0x74, 0x65, 0x72, 0x5F, 0x66, 0x6F, 0x6E, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3C, 0x3D,
-    0x20, 0x37, 0x32, 0x29, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E, 0x70,
-    0x75, 0x73, 0x68, 0x28, 0x27, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x46, 0x6F, 0x6E,
-    0x74, 0x20, 0x53, 0x69, 0x7A, 0x65, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x62,
-    0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x20, 0x31, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x37, 0x32,
-    0x2E, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x2F, 0x2F, 0x20, 0x41, 0x64, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x76, 0x61,
-    0x6C, 0x69, 0x64, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65,
-    0x20, 0x61, 0x64, 0x64, 0x65, 0x64, 0x20, 0x68, 0x65, 0x72, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20,
-    0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x46, 0x75,
-    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x65, 0x6E, 0x64, 0x20, 0x74,
-    0x65, 0x78, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74,
-    0x65, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
-    0x69, 0x6F, 0x6E, 0x20, 0x73, 0x65, 0x6E, 0x64, 0x74, 0x6F, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65,
-    0x72, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x69,
-    0x70, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74,
-    0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x72, 0x69,
-    0x6E, 0x74, 0x65, 0x72, 0x5F, 0x69, 0x70, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E,
-    0x74, 0x72, 0x69, 0x6D, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65,
-    0x72, 0x74, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
-    0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28,
-    0x27, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x5F, 0x74, 0x65, 0x78, 0x74, 0x27, 0x29, 0x2E,
-    0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x74, 0x72, 0x69, 0x6D, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20,
-    0x66, 0x6F, 0x6E, 0x74, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65,
-    0x49, 0x6E, 0x74, 0x28, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74,
-    0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x72, 0x69,
-    0x6E, 0x74, 0x65, 0x72, 0x5F, 0x66, 0x6F, 0x6E, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x27, 0x29,
-    0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E,
-    0x6D, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x65,
-    0x72, 0x41, 0x6C, 0x69, 0x67, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x29, 0x3B, 0x0A, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74,
-    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x5B, 0x5D, 0x3B, 0x0A, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70,
-    0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x69, 0x70, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x27, 0x27, 0x29,
-    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x27, 0x50, 0x6C,
-    0x65, 0x61, 0x73, 0x65, 0x20, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20, 0x50, 0x72, 0x69,
-    0x6E, 0x74, 0x65, 0x72, 0x20, 0x49, 0x50, 0x2E, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x72, 0x69, 0x6E,
-    0x74, 0x65, 0x72, 0x74, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x27, 0x27, 0x29, 0x20,
-    0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x27, 0x50, 0x6C, 0x65,
-    0x61, 0x73, 0x65, 0x20, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x74,
-    0x6F, 0x20, 0x73, 0x65, 0x6E, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72,
-    0x69, 0x6E, 0x74, 0x65, 0x72, 0x2E, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x69, 0x73, 0x4E, 0x61, 0x4E, 0x28,
-    0x66, 0x6F, 0x6E, 0x74, 0x73, 0x69, 0x7A, 0x65, 0x29, 0x20, 0x7C, 0x7C, 0x20, 0x66, 0x6F, 0x6E,
-    0x74, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3C, 0x20, 0x31, 0x30, 0x20, 0x7C, 0x7C, 0x20, 0x66, 0x6F,
-    0x6E, 0x74, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3E, 0x20, 0x37, 0x32, 0x29, 0x20, 0x65, 0x72, 0x72,
-    0x6F, 0x72, 0x73, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x27, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x65,
-    0x72, 0x20, 0x46, 0x6F, 0x6E, 0x74, 0x20, 0x53, 0x69, 0x7A, 0x65, 0x20, 0x6D, 0x75, 0x73, 0x74,
-    0x20, 0x62, 0x65, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x20, 0x31, 0x30, 0x20, 0x61,
-    0x6E, 0x64, 0x20, 0x37, 0x32, 0x2E, 0x27, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72,
-    0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x3E, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x27, 0x50, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x63, 0x6F,
-    0x72, 0x72, 0x65, 0x63, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77,
-    0x69, 0x6E, 0x67, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x3A, 0x5C, 0x6E, 0x27, 0x20, 0x2B,
-    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E, 0x6A, 0x6F, 0x69, 0x6E, 0x28, 0x27, 0x5C, 0x6E,
-    0x27, 0x29, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x66, 0x69,
-    0x6E, 0x61, 0x6C, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x74, 0x65, 0x78, 0x74, 0x20, 0x3D,
-    0x20, 0x77, 0x72, 0x61, 0x70, 0x49, 0x6E, 0x51, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x49, 0x66, 0x4E,
-    0x65, 0x65, 0x64, 0x65, 0x64, 0x28, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x74, 0x65, 0x78,
-    0x74, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x3D, 0x20,
-    0x60, 0x70, 0x6F, 0x77, 0x65, 0x72, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x24, 0x7B,
-    0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x69, 0x70, 0x7D, 0x20, 0x24, 0x7B, 0x66, 0x69, 0x6E,
-    0x61, 0x6C, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x74, 0x65, 0x78, 0x74, 0x7D, 0x20, 0x24,
-    0x7B, 0x66, 0x6F, 0x6E, 0x74, 0x73, 0x69, 0x7A, 0x65, 0x7D, 0x20, 0x24, 0x7B, 0x61, 0x6C, 0x69,
-    0x67, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x7D, 0x60, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x61,
-    0x70, 0x69, 0x2F, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x27, 0x2C, 0x20, 0x7B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D,
-    0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x27, 0x50, 0x4F, 0x53, 0x54, 0x27, 0x2C, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68,
-    0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x3A, 0x20, 0x7B, 0x20, 0x27, 0x43, 0x6F, 0x6E, 0x74, 0x65,
-    0x6E, 0x74, 0x2D, 0x54, 0x79, 0x70, 0x65, 0x27, 0x3A, 0x20, 0x27, 0x61, 0x70, 0x70, 0x6C, 0x69,
-    0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x20, 0x7D, 0x2C, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x62, 0x6F, 0x64, 0x79, 0x3A, 0x20, 0x4A, 0x53, 0x4F, 0x4E, 0x2E, 0x73, 0x74, 0x72, 0x69, 0x6E,
-    0x67, 0x69, 0x66, 0x79, 0x28, 0x7B, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x3A, 0x20,
-    0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x7D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x72, 0x65, 0x73, 0x70,
-    0x6F, 0x6E, 0x73, 0x65, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x72, 0x65,
-    0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x27, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20,
-    0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61,
-    0x6E, 0x64, 0x20, 0x73, 0x65, 0x6E, 0x74, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x66,
-    0x75, 0x6C, 0x6C, 0x79, 0x21, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74,
-    0x54, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x28, 0x6C, 0x6F, 0x61, 0x64, 0x53, 0x65, 0x74, 0x74,
-    0x69, 0x6E, 0x67, 0x73, 0x2C, 0x20, 0x33, 0x30, 0x30, 0x30, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65,
-    0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28,
-    0x27, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x73, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x50,
-    0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F,
-    0x6E, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x29, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x63, 0x61, 0x74, 0x63,
-    0x68, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x3D, 0x3E, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x6F,
-    0x6C, 0x65, 0x2E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x27, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20,
-    0x73, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20,
-    0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61,
-    0x6E, 0x64, 0x3A, 0x27, 0x2C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x29, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x2F, 0x2F, 0x20, 0x48, 0x65, 0x6C, 0x70, 0x65, 0x72, 0x20, 0x66, 0x75, 0x6E, 0x63,
-    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x67, 0x65, 0x74, 0x20, 0x70, 0x72, 0x69, 0x6E,
-    0x74, 0x65, 0x72, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x62, 0x61,
-    0x73, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20,
-    0x76, 0x61, 0x6C, 0x75, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75,
-    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x67, 0x65, 0x74, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x65,
-    0x72, 0x41, 0x6C, 0x69, 0x67, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74,
-    0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x4D, 0x61, 0x70, 0x20, 0x3D, 0x20,
-    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x22, 0x30, 0x22, 0x3A, 0x20, 0x22, 0x43, 0x4D, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x31, 0x22,
-    0x3A, 0x20, 0x22, 0x54, 0x4C, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x32, 0x22, 0x3A, 0x20, 0x22, 0x54, 0x52,
-    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x22, 0x33, 0x22, 0x3A, 0x20, 0x22, 0x42, 0x52, 0x22, 0x2C, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x34,
-    0x22, 0x3A, 0x20, 0x22, 0x42, 0x4C, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x7D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D,
-    0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65,
-    0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65,
-    0x72, 0x5F, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x27, 0x29, 0x2E, 0x76, 0x61,
-    0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x6D, 0x65, 0x6E,
-    0x74, 0x4D, 0x61, 0x70, 0x5B, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x5D, 0x20, 0x7C, 0x7C, 0x20, 0x22,
-    0x43, 0x4D, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x46, 0x75, 0x6E, 0x63, 0x74,
-    0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x20, 0x74,
-    0x6F, 0x20, 0x57, 0x69, 0x46, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
-    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x54,
-    0x6F, 0x57, 0x69, 0x46, 0x69, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x73, 0x69, 0x64,
-    0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45,
-    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x77, 0x69, 0x66, 0x69,
-    0x5F, 0x73, 0x73, 0x69, 0x64, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x74, 0x72,
-    0x69, 0x6D, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64,
-    0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45,
-    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x77, 0x69, 0x66, 0x69,
-    0x5F, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75,
-    0x65, 0x2E, 0x74, 0x72, 0x69, 0x6D, 0x28, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x65, 0x72, 0x72,
-    0x6F, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x5B, 0x5D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x73, 0x69, 0x64, 0x20, 0x3D,
-    0x3D, 0x3D, 0x20, 0x27, 0x27, 0x29, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E, 0x70, 0x75,
-    0x73, 0x68, 0x28, 0x27, 0x50, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x65, 0x6E, 0x74, 0x65, 0x72,
-    0x20, 0x61, 0x20, 0x57, 0x69, 0x46, 0x69, 0x20, 0x53, 0x53, 0x49, 0x44, 0x2E, 0x27, 0x29, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
-    0x28, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x27, 0x27,
-    0x29, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x27, 0x50,
-    0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20, 0x57, 0x69,
-    0x46, 0x69, 0x20, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x2E, 0x27, 0x29, 0x3B, 0x0A,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
-    0x28, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x3E,
-    0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x27, 0x50, 0x6C, 0x65,
-    0x61, 0x73, 0x65, 0x20, 0x63, 0x6F, 0x72, 0x72, 0x65, 0x63, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
-    0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x69, 0x6E, 0x67, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73,
-    0x3A, 0x5C, 0x6E, 0x27, 0x20, 0x2B, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E, 0x6A, 0x6F,
-    0x69, 0x6E, 0x28, 0x27, 0x5C, 0x6E, 0x27, 0x29, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
-    0x6E, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D,
-    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F,
-    0x6E, 0x73, 0x74, 0x20, 0x66, 0x69, 0x6E, 0x61, 0x6C, 0x73, 0x73, 0x69, 0x64, 0x20, 0x3D, 0x20,
-    0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x53, 0x70, 0x61, 0x63, 0x65, 0x73, 0x57, 0x69, 0x74,
-    0x68, 0x41, 0x73, 0x74, 0x65, 0x72, 0x69, 0x73, 0x6B, 0x28, 0x73, 0x73, 0x69, 0x64, 0x29, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E,
-    0x73, 0x74, 0x20, 0x66, 0x69, 0x6E, 0x61, 0x6C, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64,
-    0x20, 0x3D, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x53, 0x70, 0x61, 0x63, 0x65, 0x73,
-    0x57, 0x69, 0x74, 0x68, 0x41, 0x73, 0x74, 0x65, 0x72, 0x69, 0x73, 0x6B, 0x28, 0x70, 0x61, 0x73,
-    0x73, 0x77, 0x6F, 0x72, 0x64, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E,
-    0x64, 0x20, 0x3D, 0x20, 0x60, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x20, 0x24, 0x7B, 0x66,
-    0x69, 0x6E, 0x61, 0x6C, 0x73, 0x73, 0x69, 0x64, 0x7D, 0x20, 0x24, 0x7B, 0x66, 0x69, 0x6E, 0x61,
-    0x6C, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x7D, 0x60, 0x3B, 0x0A, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28,
-    0x27, 0x2F, 0x61, 0x70, 0x69, 0x2F, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x27, 0x2C, 0x20,
-    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x27, 0x50, 0x4F, 0x53, 0x54, 0x27,
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x3A, 0x20, 0x7B, 0x20, 0x27, 0x43, 0x6F,
-    0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 0x54, 0x79, 0x70, 0x65, 0x27, 0x3A, 0x20, 0x27, 0x61, 0x70,
-    0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x20,
-    0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x3A, 0x20, 0x4A, 0x53, 0x4F, 0x4E, 0x2E, 0x73, 0x74,
-    0x72, 0x69, 0x6E, 0x67, 0x69, 0x66, 0x79, 0x28, 0x7B, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E,
-    0x64, 0x3A, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x7D, 0x29, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x29, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x72,
-    0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
-    0x28, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x7B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x27, 0x57, 0x69, 0x46, 0x69, 0x20,
-    0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61,
-    0x6E, 0x64, 0x20, 0x73, 0x65, 0x6E, 0x74, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x66,
-    0x75, 0x6C, 0x6C, 0x79, 0x21, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74,
-    0x54, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x28, 0x6C, 0x6F, 0x61, 0x64, 0x53, 0x65, 0x74, 0x74,
-    0x69, 0x6E, 0x67, 0x73, 0x2C, 0x20, 0x33, 0x30, 0x30, 0x30, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65,
-    0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28,
-    0x27, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x73, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x57,
-    0x69, 0x46, 0x69, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63,
-    0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65,
-    0x72, 0x72, 0x6F, 0x72, 0x20, 0x3D, 0x3E, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x2E,
-    0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x27, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x73, 0x65, 0x6E,
-    0x64, 0x69, 0x6E, 0x67, 0x20, 0x57, 0x69, 0x46, 0x69, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63,
-    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x3A, 0x27, 0x2C, 0x20,
-    0x65, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x4C,
-    0x6F, 0x61, 0x64, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x6F, 0x6E, 0x20,
-    0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x6F, 0x6E, 0x6C, 0x6F, 0x61,
-    0x64, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x20, 0x7B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x61,
-    0x64, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x63,
-    0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x3C, 0x2F,
-    0x68, 0x74, 0x6D, 0x6C, 0x3E
+/* Contents of file ghost_site.html, gzip -9 */
+#define GHOST_SITE_ETAG "\"69df208bc94904b6\""
+#define GHOST_SITE_ETAG_GZ "\"69df208bc94904b6-gz\""
+const long int ghost_site_html_size = 88605;
+const long int ghost_site_html_gz_size = 17514;
+const unsigned char ghost_site_html_gz[17514] = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xED, 0x7D, 0xEB, 0x7A, 0xDB, 0x38,
+    0xB2, 0xE0, 0xFF, 0x7E, 0x0A, 0x0C, 0x67, 0xA6, 0x2D, 0x4D, 0x24, 0x59, 0x92, 0x2D, 0x5F, 0xE4,
+    0x4B, 0x1F, 0xC7, 0x71, 0xBA, 0xB3, 0xE3, 0x24, 0xDE, 0xD8, 0x99, 0x9E, 0xD9, 0x9C, 0xAC, 0x9B,
+    0x22, 0x21, 0x89, 0x13, 0x4A, 0xD4, 0x21, 0x29, 0xCB, 0x9E, 0x3E, 0xD9, 0xEF, 0xDB, 0xEF, 0xDB,
+    0x37, 0xD8, 0x07, 0xD8, 0x57, 0xDC, 0x47, 0xD8, 0xAA, 0x02, 0x78, 0x07, 0x48, 0x4A, 0x76, 0x92,
+    0x9E, 0xB3, 0x27, 0x73, 0x31, 0x45, 0x02, 0x85, 0x42, 0xA1, 0x50, 0xA8, 0x2A, 0x14, 0x0A, 0xC7,
+    0xBF, 0x7B, 0xF1, 0xF6, 0xFC, 0xE6, 0x6F, 0x57, 0x17, 0x6C, 0x1A, 0xCE, 0xDC, 0xD3, 0xEF, 0x8E,
+    0xF1, 0x0F, 0x73, 0xCD, 0xF9, 0xE4, 0xC4, 0xE0, 0x73, 0x03, 0x5F, 0x70, 0xD3, 0x3E, 0xFD, 0x8E,
+    0xC1, 0xBF, 0xE3, 0x19, 0x0F, 0x4D, 0x66, 0x4D, 0x4D, 0x3F, 0xE0, 0xE1, 0x89, 0xF1, 0xFE, 0xE6,
+    0x65, 0xFB, 0xC0, 0x90, 0x9F, 0x42, 0x27, 0x74, 0xF9, 0xE9, 0x8F, 0x53, 0x2F, 0x08, 0xD9, 0xC5,
+    0xF5, 0xD5, 0xF1, 0xB6, 0x78, 0x91, 0xAA, 0x37, 0x37, 0x67, 0xFC, 0xC4, 0xB8, 0x73, 0xF8, 0x6A,
+    0xE1, 0xF9, 0xA1, 0xC1, 0x2C, 0x6F, 0x1E, 0xF2, 0x39, 0xC0, 0x59, 0x39, 0x76, 0x38, 0x3D, 0xB1,
+    0xF9, 0x9D, 0x63, 0xF1, 0x36, 0xFD, 0x68, 0x31, 0x67, 0xEE, 0x84, 0x8E, 0xE9, 0xB6, 0x03, 0xCB,
+    0x74, 0xF9, 0x49, 0xAF, 0xD3, 0x8D, 0xDA, 0x09, 0xC2, 0x87, 0x08, 0x2C, 0xFE, 0xDB, 0xFE, 0x13,
+    0x3B, 0xBF, 0xBE, 0x66, 0x7F, 0x31, 0x7D, 0xC7, 0x1C, 0xB9, 0x3C, 0x60, 0x63, 0xCF, 0x67, 0xE7,
+    0x9E, 0xEB, 0xF9, 0x01, 0x33, 0xE7, 0x36, 0x7B, 0x09, 0x8D, 0x04, 0xEC, 0x4F, 0xDB, 0x71, 0x85,
+    0xA1, 0xEF, 0x79, 0x21, 0xFB, 0x35, 0xFE, 0x8D, 0xFF, 0xDA, 0xED, 0x91, 0x69, 0x7D, 0x9A, 0xF8,
+    0xDE, 0x72, 0x6E, 0xB7, 0x2D, 0xAC, 0x3C, 0x64, 0xBF, 0xEF, 0xD2, 0xBF, 0xA3, 0x5C, 0xC1, 0x85,
+    0xEF, 0xCC, 0x4C, 0xFF, 0x21, 0x2E, 0x35, 0x1E, 0x0F, 0x06, 0xC5, 0x52, 0x01, 0x87, 0xCE, 0xD9,
+    0xE9, 0x72, 0xBD, 0x5E, 0xF7, 0xA0, 0x02, 0x5A, 0x7B, 0x6C, 0xDA, 0xDC, 0x1E, 0x32, 0x7F, 0x32,
+    0x32, 0x1B, 0xFD, 0xC1, 0xA0, 0xC5, 0x0E, 0xE0, 0x7F, 0x5D, 0xF8, 0x6F, 0x67, 0xBF, 0x99, 0xAF,
+    0x69, 0x5A, 0x16, 0xD0, 0x2E, 0x02, 0xAF, 0xA8, 0xB2, 0xA3, 0xAB, 0x12, 0x7A, 0x73, 0xAE, 0xAC,
+    0xD1, 0x2F, 0xD4, 0x08, 0xF9, 0x7D, 0x58, 0xD1, 0xD3, 0x91, 0xE7, 0xDB, 0xDC, 0xAF, 0x28, 0x14,
+    0x7A, 0x9E, 0x1B, 0x3A, 0x8B, 0xF6, 0x68, 0x02, 0x45, 0x76, 0xBB, 0xBD, 0x83, 0xEE, 0x40, 0x57,
+    0x04, 0x9B, 0xD4, 0xC2, 0x71, 0xE6, 0x8B, 0x65, 0x28, 0xA0, 0xA8, 0xE9, 0x29, 0x0B, 0x10, 0x4E,
+    0x5A, 0x28, 0x63, 0x60, 0x09, 0xA0, 0xF5, 0xCC, 0x71, 0x1F, 0x86, 0x6C, 0xEB, 0x9A, 0x4F, 0x3C,
+    0xCE, 0xDE, 0xBF, 0xDA, 0x6A, 0xB1, 0x1B, 0x73, 0xEA, 0xCD, 0xCC, 0x16, 0xFB, 0x91, 0xCF, 0xF9,
+    0x1D, 0xFC, 0xFD, 0x0B, 0xF7, 0x6D, 0x73, 0x0E, 0x0F, 0x81, 0x39, 0x0F, 0x60, 0x4C, 0x7D, 0x67,
+    0x5C, 0x84, 0xE5, 0x73, 0xC9, 0x37, 0xDE, 0xC2, 0xB4, 0x9C, 0x10, 0x40, 0xF6, 0x92, 0x42, 0x9F,
+    0xBF, 0x8B, 0x1F, 0x09, 0xB5, 0xE1, 0xB0, 0xBD, 0xE2, 0xA3, 0x4F, 0x4E, 0xD8, 0xF6, 0x96, 0x21,
+    0x90, 0x2D, 0x58, 0x38, 0xF3, 0xF6, 0x68, 0x19, 0xC2, 0x98, 0xB4, 0x74, 0x25, 0x9D, 0xF9, 0x3C,
+    0x5B, 0x32, 0xCF, 0xBC, 0xB2, 0x9C, 0xB9, 0x58, 0x70, 0xD3, 0x37, 0xE7, 0x16, 0x8C, 0xEE, 0x1C,
+    0xC6, 0x38, 0x8B, 0x6A, 0xF9, 0x57, 0x60, 0xC2, 0x89, 0x33, 0x1F, 0xB2, 0xAE, 0x12, 0x75, 0x98,
+    0x63, 0x3F, 0xBA, 0xDE, 0xC8, 0x74, 0xD9, 0x35, 0x4E, 0xBE, 0xCC, 0x74, 0x1A, 0x79, 0xF6, 0x43,
+    0x0E, 0x21, 0x05, 0x30, 0xFC, 0x97, 0x21, 0xFB, 0x9D, 0xE9, 0x37, 0x32, 0x23, 0x91, 0xE3, 0xBD,
+    0xE2, 0x7C, 0x14, 0x35, 0xF2, 0xEF, 0x73, 0xD5, 0x32, 0x65, 0x13, 0xEE, 0xCD, 0x95, 0x72, 0x9D,
+    0x39, 0x6F, 0x4F, 0xB9, 0x33, 0x99, 0x02, 0xAB, 0xF5, 0x3A, 0x7B, 0xCA, 0x4E, 0x77, 0x50, 0x3C,
+    0x99, 0x50, 0xD2, 0x2F, 0x74, 0xEF, 0x5E, 0x08, 0xA9, 0x21, 0x3B, 0xEC, 0x76, 0x17, 0xF7, 0x1A,
+    0x4A, 0x32, 0x73, 0x19, 0x7A, 0xD9, 0x6F, 0x0B, 0xD3, 0xB6, 0x9D, 0x39, 0x70, 0x6F, 0x3F, 0x53,
+    0x2D, 0xD5, 0xE8, 0xB4, 0xD7, 0x62, 0xD3, 0x3E, 0xFC, 0x6F, 0x27, 0xD7, 0x28, 0xF5, 0xC5, 0x74,
+    0x9D, 0x09, 0x80, 0xC6, 0x59, 0xCC, 0xFD, 0x92, 0x8E, 0x67, 0xA4, 0x4A, 0x53, 0x85, 0x1F, 0x4C,
+    0xB7, 0xC5, 0x90, 0x0D, 0xF6, 0xD4, 0xD8, 0xC3, 0x04, 0x02, 0x3E, 0x9B, 0x01, 0x9E, 0xBB, 0x1A,
+    0x3C, 0x81, 0x23, 0x6E, 0xCC, 0x51, 0x40, 0xFC, 0x00, 0x3D, 0x4A, 0x33, 0x44, 0x27, 0x34, 0x47,
+    0x39, 0xE4, 0x6D, 0x27, 0x58, 0xB8, 0x26, 0x8C, 0xFA, 0xD8, 0xE5, 0xB9, 0x06, 0xFF, 0xBE, 0x0C,
+    0x42, 0x67, 0x8C, 0xA8, 0xD2, 0x5A, 0x30, 0x64, 0x01, 0xCC, 0x22, 0xDE, 0x36, 0x69, 0x88, 0x73,
+    0x2C, 0x21, 0x67, 0x75, 0x7F, 0x71, 0xCF, 0x02, 0xCF, 0x75, 0xEC, 0x1A, 0xBD, 0x95, 0xD2, 0xC9,
+    0x37, 0x6D, 0x67, 0x19, 0xC0, 0x58, 0xF7, 0x2B, 0x3A, 0xBC, 0x53, 0x18, 0xCF, 0x78, 0xCC, 0x74,
+    0xA4, 0xA0, 0xFE, 0x2A, 0x27, 0x66, 0x8A, 0x51, 0x8A, 0x33, 0x0E, 0x49, 0x91, 0x11, 0x15, 0x59,
+    0xAE, 0x57, 0x55, 0x89, 0x08, 0xA0, 0xFB, 0x12, 0x77, 0xB3, 0x30, 0xAC, 0x20, 0x6C, 0x90, 0xE7,
+    0x55, 0x55, 0xAD, 0xA5, 0x1F, 0x20, 0xE7, 0x2C, 0x3C, 0xA7, 0xC8, 0x55, 0x71, 0xE7, 0x7B, 0x03,
+    0x20, 0x7A, 0x57, 0xC7, 0xE9, 0x05, 0xAA, 0xD2, 0xBC, 0x0E, 0x9C, 0x7F, 0x40, 0x8B, 0xBD, 0x83,
+    0xFC, 0xC7, 0xDA, 0xAC, 0xAA, 0x93, 0x01, 0xB9, 0xC5, 0x35, 0x57, 0x2B, 0x04, 0x21, 0x17, 0x80,
+    0xEE, 0xE0, 0x01, 0x6A, 0x79, 0x08, 0xB8, 0x2C, 0x06, 0x2D, 0x96, 0x3C, 0x57, 0x8D, 0xE8, 0x70,
+    0xEC, 0xF8, 0x01, 0x08, 0x91, 0xA9, 0xE3, 0xDA, 0x4A, 0x29, 0xD7, 0x76, 0xF9, 0x38, 0xD4, 0xC9,
+    0xCD, 0x34, 0x20, 0xD7, 0x2C, 0x87, 0xE3, 0x0B, 0x69, 0x54, 0x0D, 0x68, 0xEA, 0xDD, 0x71, 0xBF,
+    0xA5, 0xFA, 0xD4, 0x31, 0xAD, 0xD0, 0xB9, 0xE3, 0x39, 0xF8, 0x3A, 0x2A, 0xA6, 0xB4, 0x01, 0xB5,
+    0x10, 0x85, 0xD5, 0x13, 0xFF, 0x95, 0xCC, 0x7F, 0xD0, 0xB3, 0x68, 0xD6, 0xE6, 0xA7, 0xBF, 0x9C,
+    0xCC, 0x3A, 0x29, 0xA0, 0x58, 0x9C, 0xE6, 0xC0, 0x05, 0x62, 0xC8, 0x50, 0x07, 0xBA, 0x18, 0x8F,
+    0xB9, 0x15, 0xC2, 0x00, 0x0D, 0xF4, 0x03, 0x24, 0xDB, 0xE8, 0x04, 0x53, 0x6F, 0xA5, 0x6B, 0x68,
+    0xE4, 0x7A, 0xD6, 0x27, 0x25, 0x84, 0x7F, 0xF9, 0xC4, 0x1F, 0xC6, 0x3E, 0xE8, 0xA3, 0x41, 0xBA,
+    0xC1, 0x2C, 0x98, 0xB1, 0xEF, 0xCD, 0xD8, 0xAF, 0xF1, 0xAA, 0xDE, 0x3D, 0xFA, 0x9C, 0xE5, 0x33,
+    0x2F, 0xF5, 0xB1, 0x97, 0xFA, 0x98, 0x46, 0x74, 0xE4, 0x83, 0xEE, 0x6C, 0xF9, 0xCB, 0xD9, 0x1A,
+    0x22, 0x11, 0xDF, 0xB4, 0x57, 0xBE, 0x09, 0x02, 0x1A, 0xFF, 0x3F, 0x47, 0x29, 0x5C, 0x02, 0xDA,
+    0x4E, 0xC8, 0x67, 0x81, 0x7A, 0x21, 0xC8, 0x4B, 0x70, 0xDD, 0x4A, 0x93, 0x42, 0x8D, 0xC0, 0xE5,
+    0xF0, 0xD3, 0x4F, 0x52, 0xA1, 0xA5, 0x36, 0xD7, 0x90, 0x22, 0x59, 0x0E, 0x2F, 0xC8, 0x83, 0x85,
+    0x17, 0x4D, 0x57, 0x9F, 0xBB, 0x26, 0x72, 0xB0, 0x5E, 0x02, 0x2B, 0x75, 0x8A, 0x95, 0x5C, 0xC9,
+    0x47, 0x9E, 0x6B, 0xEB, 0x65, 0x41, 0xD5, 0xA4, 0xCF, 0xD1, 0x43, 0xCC, 0xB3, 0xDA, 0x54, 0x69,
+    0xD6, 0x03, 0x3A, 0x34, 0xC7, 0xA1, 0x02, 0xAA, 0x5C, 0xFB, 0xB6, 0xB6, 0xB7, 0x8E, 0xF4, 0x32,
+    0x46, 0x27, 0x48, 0xE5, 0x3C, 0xDD, 0x1F, 0xD7, 0x43, 0x21, 0x11, 0x44, 0x55, 0xD8, 0x6C, 0xAD,
+    0x0B, 0x30, 0x0F, 0x49, 0x32, 0x85, 0xCD, 0xC7, 0xE6, 0xD2, 0x0D, 0x37, 0x11, 0x32, 0x97, 0x28,
+    0xCF, 0x00, 0x23, 0x58, 0xEF, 0x79, 0x46, 0xCA, 0xC8, 0x77, 0xA8, 0x46, 0x83, 0xB2, 0x9C, 0x6B,
+    0x38, 0x52, 0xED, 0x76, 0xF6, 0x0A, 0xCB, 0x39, 0x0E, 0xEA, 0xD8, 0xF5, 0x56, 0x6D, 0x98, 0x7A,
+    0x45, 0x05, 0x2D, 0x59, 0xD2, 0xBA, 0xAC, 0xD7, 0x2D, 0xB2, 0x5B, 0xB2, 0x1E, 0x16, 0x00, 0xD7,
+    0x34, 0x20, 0xA3, 0x35, 0xBC, 0x97, 0x53, 0x62, 0xD2, 0x66, 0x94, 0x46, 0x1C, 0x77, 0xBB, 0xE3,
+    0x71, 0xB7, 0x4C, 0xA7, 0x9E, 0x79, 0x73, 0x8F, 0xD4, 0x27, 0xFD, 0x62, 0x5C, 0x58, 0xA9, 0x57,
+    0x53, 0x18, 0xC3, 0x36, 0xD5, 0x82, 0xD9, 0xEB, 0xF3, 0x76, 0x51, 0xE4, 0xAC, 0x00, 0xB5, 0x36,
+    0x0E, 0xFA, 0x27, 0x98, 0x62, 0xF8, 0x07, 0xF4, 0x50, 0x57, 0xAB, 0x32, 0xA7, 0x47, 0xA5, 0x03,
+    0xA6, 0xBB, 0x1F, 0xAA, 0xE7, 0x10, 0xD9, 0x66, 0x83, 0x41, 0x3D, 0x38, 0x13, 0x73, 0xA1, 0x81,
+    0x72, 0x40, 0xFF, 0x4A, 0xD9, 0xE7, 0xEC, 0x8A, 0x6D, 0xB3, 0x20, 0xA4, 0xF5, 0x85, 0x85, 0xC2,
+    0x49, 0x90, 0x66, 0x25, 0x17, 0x0A, 0xB5, 0xE9, 0x7D, 0xAE, 0x0D, 0xA9, 0xBB, 0xF5, 0xBA, 0xDD,
+    0x3F, 0x2A, 0xD5, 0x2D, 0xC0, 0xC1, 0x35, 0x17, 0x01, 0x27, 0xD9, 0x42, 0x4F, 0xA5, 0xA2, 0x18,
+    0x75, 0xA8, 0x27, 0x1C, 0xBD, 0x34, 0xBD, 0x52, 0x5D, 0x08, 0xA7, 0x2D, 0xF5, 0xFB, 0xFC, 0xEC,
+    0xCC, 0x88, 0xD5, 0x82, 0xC6, 0x28, 0xBB, 0x18, 0xE3, 0x5E, 0x9F, 0x5D, 0xD3, 0x96, 0x0A, 0x0A,
+    0x2E, 0xDD, 0xD8, 0x5C, 0x5B, 0x3E, 0xE7, 0x73, 0x36, 0x73, 0x7C, 0x1F, 0xE4, 0x72, 0x7A, 0x40,
+    0x02, 0xFA, 0xD2, 0xB6, 0xCC, 0xF9, 0x9D, 0x19, 0xD4, 0x5C, 0xDB, 0x4B, 0xC7, 0x2B, 0xA5, 0x88,
+    0xEF, 0x1E, 0x94, 0x58, 0x6C, 0xEA, 0x49, 0xFF, 0xE5, 0x66, 0x36, 0xAC, 0x1F, 0x13, 0xDE, 0xF6,
+    0xF9, 0x1C, 0x0A, 0xD0, 0x50, 0x2C, 0x9C, 0x7B, 0x5C, 0x02, 0x79, 0x7E, 0x19, 0xF3, 0x96, 0xD6,
+    0xB4, 0x8D, 0xDA, 0x1D, 0x2E, 0x64, 0x7A, 0x1D, 0xDE, 0xF2, 0xBD, 0x20, 0x98, 0x9A, 0x8E, 0xAF,
+    0xE6, 0x12, 0x49, 0x57, 0xA1, 0x2C, 0x06, 0x1A, 0x9B, 0x05, 0x18, 0x36, 0x22, 0x55, 0x89, 0xF1,
+    0xF7, 0xD2, 0x01, 0x96, 0xBA, 0xB8, 0x5F, 0x40, 0x9F, 0x60, 0x01, 0x51, 0x59, 0x81, 0x63, 0x28,
+    0xD1, 0xE6, 0x51, 0x89, 0x5F, 0x73, 0xF6, 0x37, 0xAC, 0x18, 0xE4, 0xC7, 0x6B, 0x87, 0x0F, 0x0B,
+    0xA5, 0x59, 0x12, 0x73, 0xA7, 0x46, 0x21, 0xCE, 0x82, 0x77, 0x1D, 0xDD, 0x0A, 0x50, 0x18, 0xED,
+    0x12, 0xC5, 0xAB, 0x52, 0xB7, 0xD2, 0x18, 0xAB, 0x23, 0x1E, 0xAE, 0x80, 0xB0, 0x25, 0x4B, 0x85,
+    0x62, 0xEE, 0x57, 0x69, 0x3D, 0x9B, 0x19, 0x3F, 0x92, 0xD9, 0x84, 0xC2, 0xD0, 0xAF, 0xCF, 0x89,
+    0x91, 0x01, 0x29, 0xA8, 0xB6, 0x7E, 0x45, 0x72, 0x27, 0x80, 0xBE, 0x9E, 0xAB, 0x98, 0x76, 0x52,
+    0x36, 0x4B, 0x05, 0xCC, 0x26, 0x75, 0x23, 0x73, 0x57, 0x94, 0x77, 0x1D, 0x58, 0xA4, 0x10, 0x91,
+    0x66, 0xF9, 0x0B, 0xD1, 0xA2, 0xF2, 0xDD, 0x9A, 0x86, 0x64, 0xDE, 0x17, 0x18, 0x37, 0x58, 0x70,
+    0x7D, 0x65, 0xDB, 0xA9, 0xCD, 0xD4, 0x42, 0x07, 0x1D, 0x4E, 0xCD, 0xA0, 0x21, 0xBE, 0xA1, 0x07,
+    0xBD, 0x33, 0x06, 0x35, 0x97, 0xFB, 0xCD, 0xC7, 0x9B, 0x79, 0x3A, 0x9D, 0xBD, 0x14, 0x25, 0xBD,
+    0x41, 0x9C, 0x66, 0x85, 0x35, 0x38, 0x28, 0x43, 0xB7, 0x03, 0xDD, 0x0A, 0x57, 0xC0, 0x43, 0xAB,
+    0x75, 0xE6, 0x18, 0x6B, 0x03, 0x4C, 0xA2, 0xAA, 0xF5, 0x91, 0x19, 0x71, 0xF4, 0x03, 0xD7, 0x51,
+    0xA4, 0xB3, 0x53, 0xDF, 0x1C, 0x01, 0x6A, 0xCB, 0x30, 0x37, 0xF5, 0xE5, 0x2C, 0x2C, 0xCA, 0x0C,
+    0xE1, 0xB4, 0xDB, 0xFD, 0xA3, 0x82, 0x4F, 0xA1, 0x7D, 0xC0, 0x98, 0x1E, 0x71, 0x01, 0xF9, 0x5B,
+    0xA3, 0x3D, 0xE8, 0xFE, 0xB1, 0x99, 0x6F, 0x97, 0x06, 0xBA, 0xCD, 0xEF, 0x00, 0xAD, 0x40, 0xB9,
+    0x90, 0xD4, 0x75, 0xCD, 0xA4, 0xB5, 0x92, 0xDD, 0xDA, 0x64, 0x52, 0x33, 0x72, 0x15, 0xF5, 0xFE,
+    0xB5, 0x3F, 0x78, 0xBE, 0xB7, 0x55, 0x73, 0x19, 0xD0, 0x38, 0xE2, 0xCA, 0xBC, 0xDB, 0x39, 0x20,
+    0x09, 0x82, 0xF5, 0x4D, 0xF6, 0xCA, 0x95, 0x43, 0x6B, 0x0A, 0xD5, 0xC1, 0x43, 0x12, 0x4A, 0x63,
+    0x5D, 0x29, 0x4D, 0xEE, 0xB5, 0x0D, 0xD5, 0x8A, 0xB6, 0x87, 0x55, 0x83, 0xF4, 0x7F, 0xFF, 0xCF,
+    0xFF, 0xFE, 0x9F, 0x5B, 0x65, 0x66, 0x7F, 0xAF, 0x5B, 0x8F, 0x4D, 0xD2, 0x4D, 0xC3, 0x53, 0x9D,
+    0x86, 0xFF, 0xD7, 0x13, 0x36, 0x2C, 0x94, 0xAC, 0xA0, 0xFE, 0xD0, 0x4F, 0xD0, 0x4F, 0x93, 0x9D,
+    0xAA, 0x59, 0x55, 0xE9, 0x3D, 0xC0, 0x37, 0x6D, 0x76, 0xCD, 0x09, 0xB2, 0x52, 0x57, 0x5A, 0x52,
+    0x11, 0x5C, 0xDA, 0xA9, 0xC8, 0xAF, 0x5A, 0x87, 0x7D, 0x89, 0x7B, 0xBA, 0x5F, 0xC3, 0x22, 0xAD,
+    0xAF, 0x41, 0x6C, 0xA4, 0x3C, 0xC8, 0xE5, 0x58, 0x2B, 0x36, 0x73, 0xDD, 0x3C, 0x65, 0xD5, 0xDE,
+    0xD5, 0xFC, 0x62, 0x5A, 0x0E, 0xAE, 0xCA, 0xC7, 0x5A, 0xB1, 0xFC, 0xE6, 0x00, 0x7E, 0xF1, 0x3D,
+    0x98, 0x6A, 0x1F, 0x5D, 0x0E, 0x23, 0xDA, 0x18, 0xFC, 0x80, 0x2A, 0xF3, 0x89, 0x81, 0xDC, 0x6A,
+    0x7C, 0xD4, 0xD9, 0x74, 0x45, 0xFF, 0x44, 0x5A, 0x62, 0xEF, 0xD5, 0x65, 0x95, 0x68, 0xBF, 0xB5,
+    0x26, 0x8F, 0xA4, 0x77, 0x5F, 0x37, 0xDA, 0x98, 0xAB, 0xDA, 0xC7, 0xC8, 0xA8, 0x64, 0x29, 0x86,
+    0x94, 0x7E, 0xFD, 0x0A, 0x2D, 0x6D, 0x2D, 0xCA, 0x0E, 0xC7, 0x9E, 0xB5, 0x0C, 0xD4, 0xBA, 0xC5,
+    0x23, 0x76, 0x30, 0x7E, 0xDF, 0x33, 0xBB, 0x76, 0xDE, 0x74, 0xD4, 0x6C, 0xCF, 0x94, 0xE0, 0xAB,
+    0x5C, 0xE6, 0x22, 0xFB, 0x77, 0xD0, 0xD5, 0x4B, 0xA3, 0x6B, 0x1E, 0x86, 0xC0, 0x21, 0x01, 0xFB,
+    0xD1, 0x87, 0x61, 0xCB, 0x58, 0xDD, 0xF2, 0x4B, 0x7B, 0x82, 0x5F, 0x9E, 0xC6, 0x5B, 0x4D, 0xC2,
+    0xB1, 0xAF, 0x15, 0x08, 0x71, 0x93, 0x6A, 0xC9, 0x27, 0xB7, 0xC8, 0xE0, 0x3F, 0x96, 0xE9, 0x5A,
+    0x0D, 0x50, 0x68, 0x58, 0x9B, 0x26, 0x4B, 0xF3, 0x1B, 0x09, 0xBA, 0x32, 0x61, 0x5B, 0xB5, 0xD1,
+    0x58, 0x66, 0xEF, 0x95, 0xD2, 0xE4, 0xB1, 0x62, 0x52, 0x05, 0xF0, 0x71, 0x82, 0xF2, 0x5F, 0x66,
+    0xDC, 0x76, 0x4C, 0xD6, 0x48, 0xB9, 0x55, 0xF6, 0xF7, 0x60, 0x90, 0xF3, 0x26, 0x49, 0xD5, 0xF8,
+    0x66, 0xC7, 0xB8, 0xE8, 0xB6, 0x51, 0x6E, 0xA9, 0xB8, 0xE6, 0x88, 0xBB, 0x6B, 0x38, 0x85, 0x72,
+    0x3D, 0xDA, 0xAD, 0x2D, 0x17, 0xD3, 0x34, 0x14, 0x82, 0x0D, 0x79, 0x6C, 0x51, 0x4E, 0xB0, 0x7E,
+    0x01, 0x7E, 0x2D, 0x77, 0x58, 0xBA, 0x01, 0xD2, 0x92, 0x8B, 0xF2, 0xA8, 0xD9, 0x2A, 0x96, 0xEA,
+    0x84, 0xDE, 0x64, 0x02, 0x4A, 0x4B, 0xB0, 0x72, 0x42, 0x6B, 0xAA, 0x2C, 0x11, 0x70, 0x17, 0x68,
+    0x4F, 0x13, 0x74, 0x51, 0x34, 0x1A, 0xD7, 0xDF, 0x98, 0x2F, 0xF8, 0x3A, 0xF2, 0x11, 0x2E, 0x12,
+    0xE9, 0xF9, 0x72, 0x36, 0xE2, 0xBE, 0xF1, 0xB1, 0xA5, 0xFC, 0x8A, 0x44, 0xD1, 0x7D, 0xA3, 0x89,
+    0x97, 0xFE, 0x28, 0xBA, 0x90, 0xFC, 0xC6, 0xCA, 0xA6, 0xCF, 0xCD, 0xBA, 0xDE, 0xDA, 0x2A, 0x4F,
+    0x4C, 0xC6, 0x0B, 0xEB, 0xCC, 0xA7, 0xDC, 0x77, 0xC2, 0xFF, 0x80, 0x6B, 0x67, 0x5A, 0x54, 0xEC,
+    0x16, 0xC5, 0xD7, 0x3D, 0x76, 0x90, 0xC8, 0x14, 0x1B, 0xD0, 0x5F, 0x6A, 0xF1, 0x55, 0xF1, 0x89,
+    0x58, 0x6E, 0xCB, 0xB8, 0xA5, 0xAC, 0x84, 0xE4, 0x99, 0x7C, 0x11, 0xC1, 0x39, 0xF9, 0xB7, 0x11,
+    0xFF, 0xFC, 0xB6, 0x56, 0x78, 0xDC, 0x51, 0xA7, 0xD9, 0xCC, 0xAE, 0x69, 0x36, 0x67, 0xF7, 0xD4,
+    0xD3, 0xF3, 0x3C, 0xAF, 0xF3, 0x55, 0x38, 0x12, 0xE5, 0xBC, 0x28, 0x6E, 0x85, 0xE9, 0x7D, 0xA4,
+    0x15, 0xF6, 0x72, 0x16, 0x1B, 0x1A, 0x87, 0x1C, 0x4E, 0xA9, 0x4D, 0x73, 0x15, 0x2E, 0x5D, 0x35,
+    0x22, 0xBA, 0x05, 0x0C, 0x26, 0x49, 0xC1, 0xFA, 0xAD, 0xF2, 0xA1, 0x94, 0x5A, 0xC7, 0x15, 0xBE,
+    0xB2, 0x1A, 0xB3, 0x6B, 0x67, 0x57, 0xE9, 0x9B, 0xC9, 0x75, 0xAC, 0x10, 0x1B, 0x92, 0xF2, 0xEE,
+    0x14, 0x76, 0x0F, 0x0A, 0x2B, 0x6E, 0x0D, 0x1F, 0xE4, 0x6E, 0x50, 0x46, 0x32, 0xB5, 0xE9, 0x5C,
+    0x49, 0xB9, 0x48, 0xE0, 0x1B, 0x86, 0x72, 0xF0, 0xFA, 0xFD, 0xBA, 0x12, 0x70, 0x8D, 0xC0, 0xAC,
+    0x41, 0x5E, 0x68, 0x0B, 0xD2, 0x29, 0xE4, 0x94, 0x66, 0x19, 0x37, 0x83, 0x05, 0xAE, 0x73, 0x3E,
+    0xEE, 0xF2, 0xA1, 0x3E, 0xB1, 0x9D, 0x0F, 0xAD, 0x4A, 0x53, 0x32, 0xF6, 0x98, 0x11, 0x09, 0x5B,
+    0x6B, 0x50, 0x56, 0x84, 0x66, 0x5A, 0x53, 0x6E, 0x7D, 0xE2, 0x36, 0x7B, 0xA6, 0x61, 0xCE, 0x75,
+    0x09, 0x52, 0xDD, 0x80, 0x7A, 0x28, 0x37, 0x0C, 0x92, 0x54, 0x39, 0x0C, 0xFF, 0xDA, 0x40, 0x35,
+    0xBD, 0xA9, 0x13, 0x4D, 0xCF, 0xE5, 0x9E, 0x51, 0x3A, 0xF0, 0x53, 0x65, 0x82, 0x6C, 0xA6, 0x8A,
+    0xD7, 0xE6, 0x9A, 0x64, 0x29, 0xC7, 0xE5, 0xB3, 0x3F, 0x50, 0x6B, 0xE1, 0x8F, 0x71, 0x5E, 0x14,
+    0x96, 0xCD, 0x52, 0x41, 0x52, 0xAA, 0x18, 0x64, 0x62, 0x53, 0xF6, 0xBA, 0x9A, 0xE8, 0xB9, 0x1D,
+    0xC4, 0x15, 0x23, 0x11, 0x14, 0x46, 0x45, 0x99, 0x5E, 0xBB, 0x61, 0x98, 0x5B, 0x6E, 0x3B, 0xB4,
+    0x5F, 0x6C, 0x54, 0xA9, 0x47, 0xA5, 0xB8, 0x21, 0x1D, 0x86, 0xB6, 0xDE, 0x1E, 0x44, 0x59, 0x70,
+    0x43, 0x49, 0x18, 0x88, 0x0C, 0x6E, 0x0B, 0x66, 0xA6, 0xEB, 0xEA, 0xFC, 0x1D, 0x7B, 0x4A, 0x76,
+    0x90, 0x5D, 0x29, 0xC6, 0x79, 0xD4, 0x71, 0x5F, 0xE3, 0x82, 0x1C, 0x69, 0x9A, 0x29, 0xB6, 0xD7,
+    0x68, 0x9F, 0x3E, 0x17, 0xE0, 0x80, 0x28, 0xA1, 0x03, 0xE6, 0xEA, 0x51, 0x61, 0x57, 0x35, 0x5A,
+    0xE5, 0x0E, 0xCA, 0xAC, 0xF3, 0x17, 0xEC, 0xDC, 0xF4, 0xED, 0x64, 0x67, 0x35, 0xD5, 0xF0, 0xEF,
+    0x65, 0x50, 0x44, 0xAB, 0x10, 0x26, 0xF1, 0x8D, 0xE6, 0x60, 0xBF, 0x44, 0xA3, 0x58, 0x33, 0xEE,
+    0x26, 0x1B, 0x91, 0x7F, 0xEE, 0x2D, 0x7D, 0x07, 0x3A, 0xFF, 0x86, 0xAF, 0xB6, 0x5A, 0x4C, 0xFE,
+    0x6A, 0xE9, 0x02, 0x24, 0x6A, 0x44, 0xB0, 0x94, 0x39, 0x28, 0x2B, 0xFD, 0x71, 0x1B, 0xC8, 0x95,
+    0xBC, 0xCB, 0x05, 0xB5, 0x50, 0xF6, 0xB3, 0x30, 0xC1, 0x72, 0x3E, 0x97, 0xB4, 0x75, 0xB6, 0x99,
+    0x62, 0x57, 0x1A, 0xEE, 0xB0, 0xD3, 0x5D, 0x57, 0xB9, 0xCB, 0xA1, 0x24, 0x7E, 0x3E, 0xA9, 0xA9,
+    0xF5, 0xCF, 0x6E, 0x48, 0x95, 0x9F, 0xA4, 0x28, 0x5D, 0x2F, 0xEA, 0x1D, 0xD5, 0x68, 0xCF, 0xBC,
+    0x7F, 0x54, 0x14, 0x49, 0xD1, 0x8A, 0x82, 0x48, 0x54, 0x65, 0x9E, 0xCE, 0x59, 0xAA, 0xE4, 0x89,
+    0xDF, 0x98, 0x83, 0x34, 0x8B, 0x63, 0x55, 0x68, 0x23, 0xEE, 0x29, 0x9E, 0x6F, 0x1D, 0xE1, 0xF4,
+    0x7C, 0xE1, 0xAD, 0xE6, 0xCC, 0xF4, 0x7D, 0x6F, 0x95, 0x9E, 0x9A, 0xFF, 0xDF, 0xED, 0xD3, 0xAA,
+    0x65, 0xD0, 0xA6, 0x7B, 0x9E, 0x5A, 0xF0, 0xE5, 0xFB, 0xB3, 0xF4, 0x9F, 0x7E, 0xB7, 0x16, 0xA2,
+    0x95, 0x9B, 0x21, 0x9A, 0x78, 0x73, 0x2D, 0x40, 0x58, 0x42, 0xE6, 0xDA, 0x58, 0xC5, 0x7C, 0x84,
+    0x6D, 0x5E, 0x8F, 0xEA, 0x96, 0xAC, 0xEA, 0x37, 0xE2, 0x68, 0x9B, 0xFA, 0xB0, 0x8C, 0xFC, 0xB6,
+    0x9E, 0xE8, 0x8F, 0xBB, 0xE6, 0xCC, 0xE9, 0x2C, 0x93, 0x42, 0x3F, 0x8C, 0xE4, 0xD0, 0x94, 0xBB,
+    0x8B, 0x92, 0xA0, 0xE2, 0x81, 0xF6, 0x54, 0x8B, 0x44, 0x2C, 0x7A, 0x40, 0x71, 0x99, 0xC3, 0xF2,
+    0xCE, 0x09, 0x9C, 0x91, 0xE3, 0x92, 0xA1, 0x3F, 0x75, 0x6C, 0x3B, 0x1F, 0x02, 0xA5, 0xD7, 0x31,
+    0x75, 0xA2, 0x3E, 0x39, 0x27, 0x58, 0x2A, 0xB9, 0x53, 0x47, 0x05, 0x4B, 0x82, 0x0F, 0x55, 0x5B,
+    0x74, 0x55, 0xB2, 0x7D, 0x93, 0x33, 0x46, 0xC0, 0x44, 0x21, 0xD6, 0xB1, 0x7D, 0x6F, 0xD1, 0x0E,
+    0xA6, 0xA6, 0xED, 0xAD, 0x1A, 0x14, 0x4B, 0xB8, 0x03, 0x40, 0xFC, 0xC9, 0xA8, 0x21, 0xD8, 0x7A,
+    0x9B, 0xCE, 0x64, 0x36, 0x0B, 0xC5, 0x06, 0x85, 0x52, 0x07, 0x4D, 0x9D, 0xCA, 0x55, 0x12, 0x3B,
+    0xAF, 0x16, 0x51, 0xFF, 0x80, 0xE5, 0xD0, 0x56, 0x1D, 0x34, 0x8A, 0xE2, 0x3A, 0xFB, 0x83, 0x3F,
+    0x92, 0x14, 0xBC, 0x92, 0x80, 0x00, 0x0E, 0xA8, 0x6A, 0x79, 0x49, 0x28, 0x79, 0xA5, 0xFB, 0xC7,
+    0x3A, 0x86, 0xA4, 0x42, 0xA2, 0xE9, 0xFC, 0x41, 0xE9, 0x25, 0x4A, 0x96, 0x29, 0x3B, 0x96, 0xA3,
+    0x60, 0xC9, 0x0A, 0x41, 0x9F, 0xF7, 0x61, 0x54, 0xD1, 0x8B, 0x24, 0x37, 0xE9, 0x35, 0x64, 0xF5,
+    0x12, 0x95, 0x98, 0x37, 0x66, 0x51, 0xD3, 0x4F, 0x4C, 0x17, 0xC9, 0x8E, 0x72, 0xA2, 0x68, 0xCC,
+    0x59, 0x11, 0x29, 0x39, 0x14, 0xFC, 0x78, 0xB4, 0xE6, 0x72, 0x2B, 0x10, 0x58, 0x80, 0xC5, 0x32,
+    0x0F, 0x75, 0xCF, 0xA5, 0xD4, 0x96, 0x86, 0x5E, 0x4D, 0x31, 0x40, 0xCF, 0x2E, 0xD7, 0x8C, 0x7E,
+    0x4F, 0x27, 0x21, 0x5F, 0x38, 0x01, 0x06, 0x29, 0x97, 0x47, 0x49, 0xD8, 0xB2, 0x90, 0x66, 0x37,
+    0x29, 0xE1, 0xB1, 0xF4, 0x81, 0xCE, 0x7A, 0xEB, 0x69, 0xDD, 0xCD, 0xB9, 0x18, 0x05, 0xA4, 0x09,
+    0x08, 0xE0, 0x35, 0x5D, 0x6B, 0xB5, 0x7D, 0x84, 0x5A, 0x05, 0x3B, 0x3E, 0xB4, 0x5A, 0x8C, 0x49,
+    0x2F, 0x88, 0x54, 0x3A, 0xE1, 0xDD, 0x15, 0x67, 0xBB, 0x55, 0x67, 0xC8, 0xAB, 0xAC, 0xA2, 0x27,
+    0x8D, 0x94, 0x7D, 0x54, 0xBC, 0x44, 0x4A, 0x8B, 0x29, 0xAE, 0x25, 0xE5, 0xA3, 0x9B, 0xE3, 0x33,
+    0x90, 0xBD, 0xFF, 0x80, 0xEF, 0x6A, 0xFE, 0x8A, 0x3E, 0xFE, 0xAA, 0x5C, 0x12, 0x50, 0x9A, 0xDB,
+    0x66, 0x30, 0xE5, 0xF6, 0x3A, 0x46, 0x72, 0xD1, 0xB9, 0xFE, 0x64, 0x51, 0x24, 0x8F, 0x8A, 0x10,
+    0xD6, 0x8E, 0x7A, 0xA9, 0xFD, 0x52, 0xC3, 0xE9, 0x54, 0xB0, 0x34, 0x34, 0x33, 0x49, 0x12, 0x1B,
+    0x1E, 0xCC, 0xC9, 0xD3, 0xB8, 0x92, 0x0A, 0x99, 0x08, 0xCA, 0x0E, 0x16, 0xFD, 0x04, 0x6A, 0x11,
+    0xBB, 0x74, 0x82, 0x50, 0xC9, 0x0A, 0xA8, 0x34, 0xB5, 0x31, 0x4A, 0xFD, 0xE9, 0x03, 0xD7, 0x13,
+    0xD0, 0x85, 0xA0, 0xF5, 0x6F, 0x15, 0xB0, 0xA5, 0x08, 0x56, 0x88, 0xED, 0x78, 0x72, 0xAC, 0x75,
+    0x2B, 0x1C, 0x26, 0xDA, 0xF0, 0xB7, 0x54, 0x6F, 0x2D, 0xCF, 0xAE, 0x76, 0x54, 0x29, 0x8D, 0xBF,
+    0xC4, 0xE1, 0x04, 0xB8, 0xEC, 0x56, 0x04, 0x5E, 0xEC, 0x96, 0x1F, 0x92, 0xD3, 0xB1, 0xC3, 0x3B,
+    0x1E, 0x2C, 0x3C, 0x60, 0x6D, 0x50, 0x7D, 0x2E, 0xE6, 0x53, 0xB4, 0xBA, 0x67, 0x3C, 0x97, 0x37,
+    0x44, 0x11, 0xF5, 0xB0, 0x87, 0x5A, 0x7F, 0x21, 0xEA, 0x41, 0x7B, 0x1E, 0xBC, 0xD2, 0x03, 0x52,
+    0x74, 0x71, 0x77, 0xF3, 0x11, 0x11, 0xD9, 0xBE, 0xEB, 0x5A, 0xC9, 0xF9, 0xC9, 0xBB, 0xAA, 0x86,
+    0xB4, 0xA6, 0xA1, 0xA2, 0xA1, 0x5A, 0xD6, 0x75, 0x0D, 0xA0, 0xD9, 0xA7, 0xE3, 0x6D, 0x99, 0xCB,
+    0xE5, 0x78, 0x5B, 0xA4, 0x98, 0x39, 0xC6, 0x64, 0x12, 0x32, 0xCD, 0x8B, 0xED, 0xDC, 0x31, 0xCB,
+    0x35, 0x83, 0x00, 0x77, 0x77, 0x65, 0x22, 0x06, 0x23, 0x49, 0xFB, 0x72, 0x3C, 0xED, 0x25, 0xB9,
+    0x66, 0xD8, 0xDD, 0x59, 0xAF, 0xB3, 0xDB, 0xD9, 0x01, 0x38, 0xBD, 0x54, 0x91, 0xDF, 0xB5, 0xDB,
+    0x74, 0x4A, 0xF9, 0x8D, 0x79, 0xE7, 0x4C, 0xC4, 0xF1, 0xAF, 0x76, 0x3B, 0xF5, 0x3D, 0xD5, 0x04,
+    0x8C, 0x59, 0x0A, 0x38, 0x7D, 0x95, 0xC4, 0x4D, 0x0A, 0x80, 0x94, 0xF8, 0x14, 0x30, 0x71, 0xC6,
+    0xDA, 0x60, 0xDE, 0xDC, 0x72, 0x1D, 0xEB, 0xD3, 0x89, 0xE1, 0x2D, 0xF8, 0x1C, 0x5A, 0x69, 0xD0,
+    0xFA, 0xD3, 0xC2, 0x7C, 0x22, 0x22, 0xE8, 0x65, 0xAB, 0x69, 0x30, 0xC7, 0x3E, 0x31, 0x64, 0xC8,
+    0xEF, 0x0D, 0xB6, 0x10, 0x7D, 0x3B, 0xDE, 0x16, 0xD0, 0x6B, 0x35, 0x59, 0xD2, 0x16, 0x4A, 0x31,
+    0x68, 0xE7, 0x14, 0xFF, 0x3E, 0x15, 0xCC, 0xEB, 0x17, 0xE8, 0x82, 0x46, 0xA8, 0xD2, 0x1B, 0xFD,
+    0x54, 0x80, 0xCF, 0x85, 0xB7, 0x1A, 0x21, 0xCB, 0xC7, 0xA7, 0x82, 0x8C, 0xC7, 0xFC, 0x10, 0x2C,
+    0xFE, 0x7D, 0x32, 0x32, 0xD0, 0x61, 0x29, 0x22, 0x03, 0x3D, 0x3D, 0x15, 0xDC, 0xF7, 0x0B, 0x1B,
+    0xAC, 0x01, 0x84, 0x2B, 0x9E, 0x8A, 0x70, 0x8F, 0xB7, 0x81, 0x31, 0x73, 0x6C, 0x1C, 0x87, 0xED,
+    0xA5, 0x4F, 0xDD, 0x17, 0x98, 0x19, 0xD9, 0x2D, 0x2A, 0x69, 0xA4, 0x70, 0x8A, 0xCE, 0xE3, 0xE3,
+    0x59, 0xF9, 0x3C, 0x9B, 0xA7, 0x26, 0x41, 0x26, 0x02, 0x30, 0x57, 0x2E, 0xC6, 0xE4, 0x67, 0xE7,
+    0xA5, 0xB3, 0xFD, 0xFC, 0xF2, 0x22, 0x56, 0xD5, 0xD3, 0x58, 0x94, 0x42, 0x95, 0x6A, 0xBB, 0x98,
+    0x15, 0x33, 0x27, 0xB0, 0xB8, 0xEB, 0x9A, 0x73, 0xEE, 0x2D, 0x83, 0xDB, 0xE8, 0x53, 0x11, 0x92,
+    0x98, 0xEB, 0xFD, 0xD3, 0xD7, 0xE9, 0xF2, 0x2C, 0x99, 0x47, 0xF0, 0xA9, 0x50, 0x47, 0x0D, 0x84,
+    0xA4, 0x81, 0x33, 0xE3, 0x42, 0xFF, 0x23, 0x79, 0xA6, 0x43, 0x3F, 0xDF, 0x85, 0x54, 0x54, 0x95,
+    0x06, 0x45, 0xAA, 0x21, 0x42, 0xD3, 0xC0, 0xEE, 0x03, 0xA2, 0xCB, 0x86, 0x6E, 0x85, 0xE0, 0x34,
+    0x4E, 0xE3, 0x96, 0xB5, 0xD5, 0x09, 0x04, 0xF9, 0xA0, 0xA2, 0x81, 0x13, 0x16, 0x97, 0x71, 0xFA,
+    0x43, 0x69, 0x1D, 0x5D, 0x3D, 0x8A, 0x9A, 0x39, 0x95, 0x9B, 0x0F, 0x0F, 0xDE, 0xD2, 0x67, 0x11,
+    0x52, 0x1D, 0x76, 0x33, 0x75, 0x02, 0x30, 0x32, 0x5C, 0x97, 0x8D, 0x38, 0x5B, 0x06, 0xA0, 0xD2,
+    0x86, 0x1E, 0x33, 0x6D, 0xD4, 0xDA, 0x59, 0x38, 0xE5, 0x4C, 0xA4, 0xE2, 0x02, 0x80, 0x9E, 0xF5,
+    0xA9, 0x03, 0x62, 0x1A, 0xA0, 0x9F, 0x96, 0x23, 0x5E, 0x51, 0xE6, 0x78, 0x9B, 0x88, 0x53, 0x52,
+    0x40, 0x6E, 0x34, 0x20, 0x6F, 0x14, 0x88, 0x57, 0xDE, 0xB4, 0xB7, 0xA0, 0x81, 0xBC, 0x33, 0xDD,
+    0x25, 0xC7, 0x9C, 0x64, 0xE7, 0x5D, 0x98, 0x5B, 0x37, 0xE7, 0xC7, 0xDB, 0xE2, 0xC3, 0x5A, 0xB5,
+    0x5F, 0x5F, 0xDF, 0xEC, 0xBF, 0x7E, 0x71, 0xD3, 0x7A, 0xBD, 0xD3, 0xE9, 0x77, 0xBA, 0xAD, 0xD7,
+    0xBD, 0x5E, 0x87, 0x52, 0x8F, 0xBD, 0x06, 0x2D, 0x05, 0xD7, 0x20, 0xE2, 0x20, 0xD6, 0x80, 0x62,
+    0xDB, 0x50, 0xAC, 0xB9, 0x51, 0x1B, 0x17, 0xD7, 0x37, 0x83, 0x0B, 0x45, 0x1B, 0x17, 0x66, 0x00,
+    0x8B, 0x6A, 0xD4, 0x04, 0x94, 0xDA, 0xBE, 0xD8, 0xB4, 0x89, 0xAB, 0xEB, 0x9B, 0x83, 0x2B, 0x45,
+    0x13, 0x57, 0x60, 0x22, 0x8F, 0x1D, 0x4B, 0x36, 0x01, 0xA5, 0xB6, 0xAF, 0x36, 0x6D, 0xE2, 0xFC,
+    0xFA, 0x66, 0xEF, 0x5C, 0xD1, 0xC4, 0x39, 0x08, 0x1A, 0xDF, 0x74, 0x65, 0x13, 0x50, 0x6A, 0xFB,
+    0x7C, 0xD3, 0x26, 0x5E, 0x5D, 0xDF, 0xB4, 0x07, 0xC3, 0x1D, 0x00, 0xFA, 0x6A, 0x8E, 0xAA, 0xD7,
+    0x75, 0x68, 0xA2, 0x1A, 0x6C, 0x4B, 0xD8, 0xF0, 0x79, 0x33, 0xB8, 0x3F, 0xBE, 0xBE, 0xE9, 0x3E,
+    0xBF, 0x26, 0xD4, 0x07, 0x9D, 0xEE, 0x76, 0x0F, 0x90, 0xEF, 0xD2, 0x53, 0xDF, 0x38, 0x7D, 0xEE,
+    0x83, 0x79, 0x13, 0x4C, 0xD9, 0xF5, 0x72, 0x36, 0x03, 0x0D, 0x47, 0xB4, 0x04, 0x15, 0xB6, 0x9F,
+    0xD7, 0x6A, 0x0D, 0xE6, 0x01, 0xF1, 0xAC, 0x46, 0xA6, 0x08, 0xC9, 0xFE, 0x05, 0xE4, 0xCD, 0x64,
+    0x11, 0xDC, 0xFA, 0xF7, 0xB7, 0x0B, 0x07, 0x64, 0xE8, 0x8F, 0x57, 0xD7, 0xEC, 0xDD, 0x5F, 0xD9,
+    0x95, 0x33, 0xFF, 0xCA, 0xB2, 0xE6, 0xCA, 0xF7, 0xEE, 0x1C, 0x9B, 0x93, 0x04, 0x49, 0x90, 0x60,
+    0x2F, 0xC1, 0x10, 0xC4, 0x57, 0x2F, 0x1D, 0x7F, 0xB6, 0x32, 0x7D, 0x10, 0x3F, 0x6F, 0xE7, 0xEE,
+    0x03, 0xE5, 0xE9, 0x0B, 0x41, 0x83, 0xE3, 0x6C, 0x35, 0xF5, 0xD8, 0xD4, 0x04, 0xD5, 0xDB, 0xC4,
+    0x5C, 0x03, 0x9F, 0xD0, 0x18, 0xC3, 0xEA, 0xAF, 0xE6, 0x41, 0x68, 0xBA, 0x2E, 0xB7, 0xBF, 0x8E,
+    0x00, 0x12, 0x71, 0x6C, 0x99, 0xA8, 0x44, 0x92, 0x46, 0x29, 0xD2, 0xE2, 0x3E, 0xFE, 0x89, 0xD1,
+    0x35, 0xD0, 0xF3, 0x7F, 0x62, 0x0C, 0xE0, 0x01, 0x66, 0xEC, 0xE2, 0xC4, 0xE8, 0x19, 0x6C, 0xE1,
+    0x9A, 0x16, 0x9F, 0xD2, 0x59, 0x29, 0x28, 0xC1, 0xDA, 0x0C, 0xBF, 0xFA, 0xFC, 0xDF, 0x96, 0x8E,
+    0xCF, 0xED, 0xAF, 0xCD, 0x0D, 0x23, 0xDF, 0x33, 0x6D, 0x0B, 0xC4, 0xC9, 0x6D, 0xB0, 0xE0, 0xDC,
+    0x46, 0xAE, 0x96, 0x2F, 0xD8, 0x35, 0xBE, 0x00, 0x23, 0x26, 0x68, 0x7E, 0xFD, 0x95, 0x48, 0xAC,
+    0x2D, 0x84, 0x12, 0x33, 0x43, 0xDC, 0xB8, 0xB7, 0xA6, 0x2C, 0xC6, 0x15, 0x54, 0x6B, 0x1F, 0xBE,
+    0x92, 0x96, 0xE4, 0x60, 0x5E, 0x00, 0x17, 0xEC, 0x46, 0xB2, 0x7C, 0x03, 0xD6, 0x18, 0x00, 0x45,
+    0x7B, 0xDD, 0x6E, 0x97, 0x01, 0xE2, 0x9D, 0x6F, 0xCB, 0x0F, 0x79, 0xE2, 0x0A, 0xA6, 0x18, 0x48,
+    0xA6, 0x40, 0x24, 0x75, 0x6C, 0x91, 0xEA, 0x44, 0x4D, 0xDE, 0x50, 0x7D, 0xFA, 0x02, 0xFC, 0x22,
+    0x9C, 0x2A, 0xB7, 0x64, 0x2A, 0x03, 0xA3, 0x5B, 0x9F, 0xD0, 0xD4, 0x3A, 0xA3, 0x97, 0x22, 0x95,
+    0xE6, 0xD7, 0xE6, 0x95, 0x2B, 0xC0, 0x01, 0xA4, 0x81, 0x05, 0xFA, 0x88, 0x37, 0x63, 0x02, 0x3D,
+    0x19, 0xCE, 0x34, 0x96, 0xD2, 0x64, 0x1C, 0x4B, 0x93, 0xF7, 0x81, 0x10, 0x39, 0xE2, 0xBB, 0x40,
+    0x1F, 0xF5, 0x99, 0x20, 0xA5, 0xFA, 0x2C, 0x7C, 0x3E, 0xE6, 0x3E, 0x90, 0x5B, 0x94, 0xFA, 0x06,
+    0x2C, 0x24, 0x42, 0x94, 0x89, 0x83, 0x54, 0xE4, 0x8E, 0xD6, 0x26, 0xE9, 0xA7, 0x28, 0x1B, 0x38,
+    0xA2, 0x5A, 0x01, 0xCE, 0x94, 0xDF, 0x23, 0xDF, 0x81, 0x3D, 0x0D, 0xCA, 0x75, 0x7A, 0x87, 0x8F,
+    0x8E, 0x82, 0x19, 0xA7, 0x12, 0x70, 0x59, 0xA7, 0x34, 0x4C, 0xA7, 0x7B, 0x8D, 0x0A, 0x35, 0x98,
+    0x22, 0x73, 0x24, 0x32, 0x90, 0x1B, 0x0D, 0x83, 0xD8, 0x28, 0x68, 0x44, 0x1E, 0xFD, 0xE6, 0x86,
+    0xF6, 0x81, 0x25, 0x00, 0xB7, 0x57, 0xA0, 0xAF, 0xB4, 0xAB, 0xCD, 0x03, 0xD1, 0x78, 0x68, 0x86,
+    0x4B, 0x8D, 0x4D, 0xF0, 0xF8, 0x49, 0x22, 0x33, 0xC8, 0xDC, 0x22, 0x6F, 0x5F, 0x5C, 0x5F, 0xED,
+    0xF4, 0xA9, 0x3D, 0xEC, 0xEC, 0xAB, 0xAB, 0xE1, 0x7A, 0xBC, 0x40, 0x4C, 0x4E, 0xDD, 0x4C, 0x01,
+    0xCD, 0xCA, 0x8A, 0x37, 0x1E, 0x32, 0x3C, 0xD1, 0x00, 0x65, 0x0C, 0xA6, 0x5C, 0xF2, 0x60, 0xD5,
+    0x5C, 0x5B, 0x5A, 0x20, 0x71, 0xF2, 0x83, 0xF4, 0x86, 0x87, 0xB8, 0xCE, 0x7E, 0x29, 0x42, 0xE1,
+    0x90, 0xDD, 0x06, 0x01, 0x9A, 0x90, 0x62, 0x58, 0xAE, 0x5F, 0xBD, 0xF8, 0xDA, 0x02, 0xE4, 0x02,
+    0x7D, 0xD7, 0x24, 0x15, 0xA8, 0x75, 0xDC, 0xC1, 0x83, 0x67, 0x42, 0x67, 0x2E, 0x7A, 0x8F, 0x72,
+    0x81, 0xAD, 0xCC, 0x39, 0x91, 0xC5, 0x8A, 0x29, 0xF4, 0x0D, 0x24, 0x43, 0xC2, 0x0D, 0x09, 0xE5,
+    0xB2, 0xCC, 0x20, 0x7A, 0x13, 0x13, 0xD3, 0x58, 0x9F, 0x0B, 0x1E, 0x3F, 0xA0, 0x0B, 0xA8, 0x8C,
+    0x99, 0xA0, 0xE4, 0xA0, 0x5E, 0xC9, 0x9F, 0xDF, 0x6E, 0x60, 0x23, 0x84, 0xFE, 0xA9, 0x06, 0x37,
+    0xA6, 0xA2, 0x76, 0x80, 0xAF, 0x62, 0x3A, 0xAF, 0x3D, 0xC8, 0xD2, 0x17, 0x15, 0xBB, 0x9E, 0x64,
+    0xC7, 0x6F, 0x3C, 0x04, 0xDC, 0x10, 0x6E, 0x37, 0x7C, 0xA1, 0x76, 0x65, 0x55, 0x89, 0xFA, 0x8B,
+    0x3B, 0xC7, 0x65, 0x57, 0x9E, 0x1F, 0x62, 0x1A, 0xE0, 0x47, 0xF9, 0x7E, 0x38, 0x40, 0x6A, 0x2F,
+    0x08, 0x52, 0x0D, 0xD1, 0x9E, 0x6D, 0xB7, 0xCC, 0xEF, 0xF3, 0x78, 0x4E, 0x17, 0x48, 0xDD, 0x7A,
+    0xE3, 0x31, 0x86, 0xD5, 0xDC, 0xCE, 0x3C, 0x9B, 0x1B, 0xA7, 0x6F, 0xC5, 0x2F, 0xF6, 0x1A, 0x77,
+    0x30, 0xBE, 0x32, 0xBB, 0xCB, 0x23, 0x41, 0x12, 0x21, 0x86, 0x08, 0xC5, 0x1A, 0x50, 0x8A, 0x30,
+    0x5F, 0x89, 0xB1, 0x05, 0xA5, 0x62, 0x3C, 0x53, 0xA7, 0x80, 0xAA, 0x7C, 0x34, 0x19, 0x4D, 0x08,
+    0x0F, 0x37, 0x8C, 0xBC, 0x7B, 0xC1, 0x0C, 0x4A, 0x92, 0xD7, 0xA7, 0xB2, 0x38, 0x1E, 0x61, 0x9C,
+    0x3E, 0xAA, 0x73, 0x5F, 0x4C, 0x72, 0xCA, 0xCE, 0x2D, 0x7D, 0x17, 0xC4, 0x26, 0x1F, 0x05, 0x4E,
+    0xC8, 0xD9, 0xFB, 0x77, 0x97, 0x0C, 0x46, 0x90, 0x32, 0x68, 0x5D, 0x99, 0xE1, 0xF4, 0xDB, 0x49,
+    0x50, 0x89, 0x09, 0x06, 0xC1, 0x81, 0x34, 0x05, 0x4C, 0xBE, 0x1D, 0x67, 0xA9, 0x45, 0x66, 0x8A,
+    0x7C, 0x2A, 0x79, 0x09, 0xF8, 0x1B, 0xDF, 0x66, 0x40, 0x7F, 0x5B, 0xDA, 0x4D, 0x34, 0x6C, 0x99,
+    0x15, 0x90, 0xBC, 0xBA, 0xA3, 0x87, 0xDF, 0xE2, 0x78, 0xFE, 0xF6, 0x34, 0x1C, 0x89, 0xD8, 0x6F,
+    0x57, 0xC7, 0xF9, 0x67, 0x1B, 0xE2, 0x2F, 0xAA, 0xE7, 0x3C, 0xC5, 0x50, 0x9B, 0x0B, 0x39, 0x89,
+    0xD3, 0xEA, 0xC5, 0xD9, 0xD5, 0x6F, 0x69, 0x3A, 0xA3, 0x03, 0x26, 0x08, 0x00, 0x37, 0x07, 0xF4,
+    0x58, 0xA9, 0xE4, 0xFE, 0xC6, 0x86, 0x39, 0xA2, 0xA2, 0x6A, 0x94, 0x15, 0x84, 0xFD, 0x46, 0x63,
+    0x6D, 0x7B, 0x33, 0x13, 0x1D, 0xE3, 0x12, 0x99, 0x17, 0xF4, 0xF3, 0xDB, 0x0D, 0xB2, 0x40, 0x87,
+    0x6E, 0xC3, 0xF9, 0xAD, 0xAE, 0xB8, 0x92, 0x62, 0xAA, 0x61, 0x7D, 0x21, 0x89, 0xF9, 0x68, 0xEB,
+    0x24, 0x08, 0x4D, 0x3F, 0x44, 0x53, 0x40, 0xB4, 0x89, 0xF6, 0xC9, 0x35, 0xBE, 0x4A, 0xD3, 0x62,
+    0x33, 0x4B, 0xE5, 0xCA, 0x5B, 0x01, 0xA2, 0x57, 0x3E, 0x05, 0xB0, 0x3D, 0xD2, 0x56, 0x59, 0x20,
+    0x2C, 0x0C, 0xC3, 0xA3, 0x18, 0xC3, 0x6A, 0x6B, 0x25, 0xDF, 0xF6, 0x17, 0xB6, 0x57, 0x44, 0x3B,
+    0xE4, 0x93, 0x8A, 0xDA, 0x7C, 0x75, 0xF5, 0xED, 0x58, 0x1B, 0xDA, 0x36, 0x6D, 0xDB, 0x47, 0xB1,
+    0x25, 0x05, 0x96, 0xC4, 0xF0, 0xDB, 0x32, 0x75, 0x42, 0x25, 0x15, 0x47, 0x27, 0x84, 0xFB, 0xEA,
+    0xF2, 0x49, 0x22, 0x16, 0x6D, 0x9F, 0x09, 0x3C, 0xF0, 0xD4, 0xE9, 0xB7, 0x1B, 0x42, 0x0A, 0xF0,
+    0x0E, 0x3D, 0x31, 0x70, 0x0C, 0x33, 0x66, 0x7F, 0xF5, 0x51, 0x8C, 0x8F, 0xD8, 0xA6, 0x07, 0x4F,
+    0x0C, 0xA7, 0x62, 0xF8, 0x6E, 0x24, 0xC2, 0x44, 0x3E, 0x34, 0x04, 0xA3, 0xEA, 0xDF, 0x68, 0x30,
+    0x31, 0x04, 0xEE, 0x16, 0x43, 0xE0, 0x92, 0x11, 0xC5, 0x3B, 0xC8, 0xD8, 0x35, 0xBC, 0xFA, 0x56,
+    0x7B, 0x6E, 0x88, 0x13, 0x43, 0x9C, 0xE2, 0x05, 0x47, 0x60, 0x6B, 0x8B, 0xE1, 0x6E, 0xF4, 0x70,
+    0xC7, 0x72, 0xBF, 0xFF, 0xAD, 0xB7, 0xD6, 0x8A, 0x24, 0x14, 0x9B, 0x6B, 0xBD, 0x68, 0xCB, 0x75,
+    0xBF, 0xAF, 0xDB, 0x5B, 0x93, 0x3D, 0x78, 0xC4, 0xBE, 0xDA, 0xD3, 0x8C, 0x3E, 0x05, 0x76, 0x63,
+    0xEC, 0x68, 0x32, 0xFA, 0x67, 0xD1, 0xAB, 0x6F, 0x14, 0xFB, 0x83, 0xC3, 0x1D, 0xA3, 0xA5, 0x64,
+    0x80, 0xAF, 0x34, 0xEC, 0x99, 0xC5, 0x36, 0x1D, 0x4F, 0x5A, 0xE9, 0xF0, 0x49, 0x62, 0x83, 0x14,
+    0x74, 0xAE, 0xA6, 0x50, 0x36, 0xFC, 0x43, 0x06, 0xA9, 0xC0, 0xC8, 0xBC, 0x76, 0x6C, 0x1B, 0xA3,
+    0x10, 0xEB, 0xC4, 0x90, 0x28, 0x00, 0xF5, 0xD0, 0x3F, 0xB7, 0x60, 0x97, 0x7C, 0x1C, 0x6E, 0x0C,
+    0xA3, 0x2F, 0x60, 0xBC, 0xC3, 0x63, 0x1D, 0x1B, 0x03, 0xD9, 0x31, 0x4E, 0xE5, 0x51, 0xA5, 0xC7,
+    0xC1, 0xD9, 0x8D, 0xE1, 0xD4, 0xEF, 0x53, 0x79, 0xC4, 0x4B, 0xD5, 0x9C, 0x5B, 0x47, 0x5F, 0xE4,
+    0x73, 0x3B, 0xF4, 0xE4, 0xF8, 0x93, 0xB6, 0x08, 0x2F, 0x62, 0xC1, 0xCF, 0xFD, 0xCD, 0x74, 0xC5,
+    0x77, 0x3F, 0x3E, 0x7F, 0xA4, 0x86, 0xE8, 0x4F, 0x46, 0x35, 0xF4, 0x42, 0xD1, 0xCE, 0x97, 0xD5,
+    0x06, 0x7D, 0x50, 0xCC, 0x47, 0xDE, 0x4A, 0xFA, 0x50, 0xDF, 0x89, 0x5F, 0xDF, 0xD2, 0x6D, 0x8D,
+    0x72, 0x46, 0x22, 0x25, 0x77, 0xE7, 0x33, 0x0E, 0x6C, 0xA4, 0xC9, 0xE5, 0xC5, 0x8B, 0xE0, 0x9F,
+    0xD8, 0x7B, 0x9D, 0x25, 0xF9, 0x7F, 0x14, 0xB7, 0x35, 0xB0, 0x74, 0x14, 0x39, 0x44, 0x7C, 0x4B,
+    0x11, 0x3B, 0xDF, 0x34, 0x5C, 0x48, 0x5A, 0x13, 0x88, 0x8D, 0x60, 0x24, 0x6B, 0x6A, 0xCE, 0x27,
+    0x1C, 0x34, 0x97, 0x01, 0xC5, 0x5A, 0x7D, 0x6B, 0xCD, 0x25, 0xA1, 0x98, 0xD4, 0x58, 0x06, 0x95,
+    0x41, 0x62, 0x12, 0xF3, 0x0D, 0x35, 0x96, 0x32, 0x99, 0xF6, 0xD2, 0x85, 0x55, 0xF5, 0x81, 0x89,
+    0xE3, 0x11, 0x8F, 0x13, 0x6E, 0x63, 0x02, 0x75, 0x3B, 0x41, 0x50, 0x35, 0xA2, 0xB4, 0x73, 0x2D,
+    0x7F, 0x59, 0x71, 0x27, 0x71, 0x43, 0x3F, 0x8A, 0xB4, 0xA0, 0xDE, 0xA0, 0x4B, 0xE5, 0x9B, 0x59,
+    0x4E, 0xD4, 0x7A, 0x7A, 0xE3, 0x99, 0x62, 0x1A, 0xA5, 0x05, 0x95, 0xA1, 0x8C, 0xCB, 0x4D, 0x60,
+    0x81, 0x91, 0x67, 0xFA, 0x76, 0xF0, 0x2D, 0x6C, 0xAA, 0x02, 0xE5, 0x54, 0x76, 0x15, 0x76, 0x67,
+    0x63, 0x73, 0x4A, 0xF1, 0x5A, 0xF5, 0xAA, 0xB0, 0xC6, 0x03, 0xC5, 0x22, 0xB6, 0xA1, 0x25, 0x1E,
+    0x29, 0xA8, 0x3F, 0x34, 0xA3, 0x3A, 0x29, 0x41, 0x07, 0xFB, 0x2A, 0x4F, 0x49, 0x60, 0x29, 0xC5,
+    0x09, 0x89, 0xFC, 0xE1, 0x08, 0xDC, 0x7E, 0xA6, 0x50, 0x9F, 0x73, 0x6F, 0x36, 0x33, 0xE7, 0xB6,
+    0x82, 0x97, 0x8F, 0x97, 0xF1, 0x9A, 0x12, 0x1F, 0x76, 0x53, 0x9D, 0x9D, 0x70, 0x1D, 0x0D, 0x01,
+    0x83, 0xD0, 0xF7, 0xE6, 0x93, 0xD3, 0x29, 0x1D, 0xE1, 0x91, 0x3F, 0x86, 0x78, 0x22, 0x1A, 0x0F,
+    0xDF, 0x02, 0xEF, 0x38, 0x01, 0xE5, 0x70, 0x60, 0x33, 0x1E, 0x04, 0xE6, 0x84, 0x77, 0x8E, 0x47,
+    0x7E, 0x39, 0xA4, 0xF7, 0x58, 0x6C, 0x18, 0xC3, 0x62, 0xC7, 0x78, 0xF4, 0x4E, 0xC2, 0xA7, 0x47,
+    0xC5, 0x68, 0xA9, 0xB0, 0xAB, 0x44, 0x39, 0xB0, 0xCC, 0xB9, 0x99, 0x46, 0x5A, 0xF8, 0xEF, 0x4C,
+    0xF6, 0xB3, 0xD3, 0x7E, 0xE9, 0x50, 0xD8, 0x5E, 0x10, 0x88, 0x83, 0xA4, 0xAC, 0x71, 0x76, 0xD5,
+    0x64, 0x58, 0x61, 0x53, 0xFC, 0xA3, 0xC6, 0x9E, 0xBC, 0x07, 0x41, 0x68, 0x16, 0xBA, 0x80, 0xEF,
+    0xE7, 0x18, 0x87, 0x8C, 0xAA, 0x8A, 0xE8, 0x8D, 0x8C, 0xD4, 0x0A, 0x1E, 0x83, 0x3F, 0x35, 0xF5,
+    0xB4, 0x1D, 0x00, 0x8D, 0x18, 0x21, 0x67, 0x7A, 0x00, 0xF6, 0x84, 0x39, 0x7F, 0x80, 0x59, 0x35,
+    0xF1, 0xB0, 0x0F, 0x12, 0xFF, 0xC7, 0xD0, 0x3E, 0x6E, 0xE5, 0x49, 0x91, 0x37, 0xC3, 0xD0, 0xB4,
+    0x3E, 0xA5, 0x50, 0xBF, 0x34, 0x97, 0x73, 0x6B, 0x0A, 0xC8, 0x33, 0xF1, 0x89, 0x35, 0x78, 0x67,
+    0xD2, 0x69, 0x31, 0x9B, 0x9B, 0x4B, 0x10, 0xA2, 0x73, 0xCC, 0xAC, 0x26, 0x92, 0x54, 0xD0, 0xE7,
+    0xE6, 0xA6, 0xFD, 0x91, 0xD0, 0xDB, 0xB6, 0xEC, 0x50, 0x25, 0x98, 0x33, 0x7F, 0xB2, 0xA4, 0x03,
+    0xA1, 0x09, 0x28, 0x7D, 0x1D, 0x02, 0x19, 0xC3, 0x8E, 0x58, 0x4A, 0xF4, 0x41, 0x62, 0xFE, 0x54,
+    0x14, 0x44, 0x61, 0x93, 0xA6, 0x1F, 0x1E, 0xB4, 0x4D, 0x86, 0x1B, 0x93, 0xD2, 0x2D, 0xDD, 0x30,
+    0xC0, 0x4D, 0xFE, 0x38, 0x96, 0xF0, 0xD1, 0x8C, 0x4C, 0xA7, 0x79, 0xDB, 0x26, 0xFB, 0x77, 0x26,
+    0x9E, 0x82, 0x2F, 0x48, 0x44, 0x33, 0x21, 0x22, 0x5E, 0xF3, 0x9A, 0x96, 0x28, 0x81, 0xB8, 0x9F,
+    0x35, 0xE9, 0x6D, 0x15, 0xAC, 0x20, 0x86, 0x75, 0x29, 0xCE, 0x23, 0xE7, 0x09, 0xF2, 0x54, 0x83,
+    0x32, 0xE2, 0x26, 0x26, 0xE6, 0x5B, 0x98, 0xB3, 0x82, 0x5C, 0x11, 0x9F, 0x30, 0xD3, 0xD0, 0x8C,
+    0x81, 0xE5, 0x31, 0x65, 0xB6, 0x33, 0x1E, 0x73, 0xCA, 0xC7, 0x81, 0x16, 0xC4, 0xC6, 0x63, 0x92,
+    0x34, 0xC9, 0x3E, 0xBC, 0xBD, 0xBA, 0x79, 0xF5, 0xF6, 0xCD, 0xC7, 0x2F, 0x38, 0x2A, 0x7E, 0x8E,
+    0xB5, 0x7D, 0x58, 0x19, 0x61, 0x28, 0x52, 0x9D, 0xAB, 0x84, 0x90, 0x07, 0xF1, 0x0E, 0x96, 0x7F,
+    0xDF, 0xA3, 0xF3, 0x68, 0xB5, 0x81, 0xB8, 0x39, 0x18, 0x67, 0x57, 0x62, 0x64, 0xEB, 0x83, 0xF8,
+    0x80, 0x9B, 0x92, 0x1F, 0x63, 0x30, 0x18, 0x48, 0x8E, 0x69, 0x64, 0x9D, 0xB1, 0x83, 0xA9, 0x48,
+    0xA2, 0xBD, 0xD8, 0x14, 0xBC, 0x27, 0x15, 0xDB, 0x79, 0x06, 0x01, 0xB1, 0x1D, 0x89, 0xEC, 0x54,
+    0x93, 0x8F, 0x92, 0xD9, 0xD4, 0xC4, 0x93, 0x2F, 0x38, 0x42, 0x94, 0xE9, 0x70, 0xD7, 0x08, 0xEB,
+    0xC7, 0xF4, 0x23, 0x6A, 0xF0, 0x69, 0x7B, 0x42, 0x6E, 0xAB, 0x74, 0x2F, 0x84, 0x97, 0x11, 0x57,
+    0x9F, 0xB4, 0xE6, 0x32, 0x7A, 0x60, 0x94, 0x43, 0x49, 0xC8, 0x1B, 0x32, 0x49, 0x53, 0xB2, 0x75,
+    0xE3, 0x6E, 0x89, 0xC6, 0x40, 0x8E, 0x7E, 0xEF, 0x86, 0x47, 0xC2, 0x94, 0xFC, 0x7E, 0x12, 0x1E,
+    0x7D, 0x15, 0x61, 0x0A, 0x33, 0x25, 0x88, 0x0F, 0xC0, 0x8A, 0xCE, 0x35, 0x66, 0x4B, 0x9A, 0x3A,
+    0xA0, 0xBD, 0xDD, 0x99, 0x98, 0x44, 0x42, 0xA0, 0xD4, 0x7C, 0x3A, 0xBE, 0x81, 0x29, 0xBA, 0x90,
+    0x9B, 0xBA, 0x05, 0x85, 0x51, 0x7C, 0x10, 0x22, 0x31, 0x37, 0x03, 0x41, 0xB6, 0xC4, 0x61, 0x30,
+    0x9B, 0xF3, 0x50, 0xDC, 0x38, 0x91, 0xFB, 0xFD, 0xBB, 0x4B, 0xA4, 0x35, 0x3D, 0x63, 0x23, 0xF1,
+    0x8F, 0x28, 0x28, 0x25, 0x7E, 0x71, 0x76, 0x45, 0x01, 0x0E, 0xF1, 0x6F, 0xB1, 0xFB, 0xFD, 0x65,
+    0x07, 0x2A, 0x85, 0x61, 0x22, 0x9A, 0xDE, 0x5D, 0x26, 0x9E, 0x7B, 0x41, 0xC5, 0x6A, 0x20, 0x51,
+    0xD7, 0x62, 0x28, 0x62, 0xB1, 0xCC, 0x04, 0x99, 0xD4, 0x06, 0x96, 0x26, 0x4D, 0x0E, 0x60, 0x21,
+    0x4A, 0xA9, 0x36, 0xD0, 0x14, 0x79, 0x13, 0x61, 0x9E, 0x46, 0x2F, 0x3D, 0x13, 0x6B, 0xC0, 0x2B,
+    0x0C, 0xCF, 0x90, 0x9D, 0x8B, 0x33, 0x44, 0x32, 0xE8, 0x02, 0x8F, 0x05, 0x2D, 0x3C, 0x6F, 0x8C,
+    0x27, 0xCC, 0x08, 0xBE, 0xDC, 0xAD, 0x1E, 0x99, 0xBE, 0x1E, 0x3C, 0x9F, 0x9D, 0xBE, 0x7D, 0x77,
+    0xBC, 0x0D, 0x7F, 0x2A, 0x47, 0x3B, 0x8A, 0x15, 0xAE, 0xC7, 0x87, 0x18, 0x03, 0x8A, 0x21, 0xA0,
+    0xF5, 0xD9, 0xED, 0x29, 0xC5, 0xB8, 0x62, 0x36, 0x82, 0x18, 0x2F, 0x44, 0xA3, 0x6C, 0x2E, 0xB6,
+    0xA3, 0x06, 0x9E, 0x14, 0x73, 0xBC, 0xBE, 0x39, 0x6B, 0xF0, 0xFC, 0x04, 0x22, 0xC2, 0xE5, 0x0C,
+    0x73, 0x12, 0xC4, 0x76, 0x1B, 0x49, 0x92, 0x3B, 0xD3, 0x77, 0x30, 0x5B, 0xC0, 0xE3, 0x54, 0x2B,
+    0xD1, 0xDE, 0xD7, 0xD0, 0xAB, 0xC6, 0x39, 0x85, 0x66, 0xEB, 0xA5, 0x83, 0x3B, 0x1C, 0xE4, 0x3D,
+    0x72, 0x70, 0x9F, 0x2C, 0xD8, 0xA2, 0xBE, 0x54, 0x9A, 0x1E, 0x41, 0x0E, 0x10, 0x91, 0x06, 0x95,
+    0x43, 0x9B, 0x87, 0x20, 0xF5, 0x3D, 0x7F, 0x0D, 0xBD, 0x5B, 0xA8, 0x56, 0x8E, 0x7F, 0x63, 0x4E,
+    0x04, 0x79, 0xB9, 0xBF, 0x86, 0x7E, 0x88, 0x94, 0xC3, 0xB9, 0xEC, 0x9B, 0x2B, 0xC2, 0x62, 0x01,
+    0x9A, 0x00, 0x0F, 0x83, 0xFA, 0xBA, 0x3A, 0xF1, 0x64, 0x7A, 0x68, 0x9F, 0x8A, 0x8F, 0x2C, 0x73,
+    0x11, 0x2E, 0x7D, 0xAE, 0xF5, 0x5E, 0xC8, 0xEF, 0xAC, 0x21, 0xDD, 0xB3, 0x01, 0x26, 0xE7, 0xB6,
+    0xF0, 0xF4, 0x39, 0x06, 0x6F, 0x8B, 0xF1, 0x90, 0x79, 0x12, 0x36, 0xB6, 0x43, 0xA3, 0x36, 0xBE,
+    0x02, 0x6F, 0x2D, 0x7C, 0x6F, 0xC4, 0x73, 0xA3, 0x2A, 0x9A, 0xC7, 0xE9, 0x42, 0x5F, 0xEB, 0x0E,
+    0x8E, 0x50, 0x4E, 0xB5, 0xB0, 0xA4, 0xEE, 0x5A, 0x13, 0x58, 0x46, 0xB5, 0x2B, 0x02, 0x93, 0x56,
+    0x73, 0x4D, 0x60, 0xC0, 0x65, 0x5A, 0x48, 0xC8, 0x81, 0x35, 0xC1, 0xAC, 0x16, 0x81, 0x16, 0xCC,
+    0xCF, 0x57, 0xD7, 0x11, 0x18, 0x52, 0x4D, 0x60, 0x76, 0x3A, 0x3E, 0x23, 0x24, 0x71, 0x57, 0xA0,
+    0x72, 0x18, 0x56, 0x7A, 0xC2, 0x5D, 0xAD, 0xE6, 0xE6, 0xC4, 0x0B, 0xAD, 0xA9, 0x53, 0x7B, 0x9A,
+    0xC0, 0xE4, 0xC8, 0xCE, 0x14, 0xB1, 0x66, 0x62, 0x86, 0xA2, 0x88, 0x81, 0x9F, 0x6C, 0xBE, 0x44,
+    0x67, 0x87, 0xE2, 0xF9, 0x92, 0x3A, 0x56, 0x68, 0x46, 0x5A, 0x9B, 0x25, 0x67, 0x8F, 0x0C, 0x51,
+    0xDE, 0x78, 0x62, 0x48, 0xD0, 0xA5, 0x0A, 0xDA, 0x13, 0x2F, 0x2C, 0xB6, 0x63, 0xBA, 0x8A, 0x4E,
+    0xE2, 0xA1, 0x79, 0x33, 0x32, 0x71, 0xFF, 0xE6, 0x2D, 0x6F, 0x96, 0x30, 0x53, 0x30, 0xCD, 0x81,
+    0x87, 0xAE, 0x7D, 0xBC, 0x92, 0x20, 0x98, 0xE1, 0x38, 0xDE, 0xFC, 0x25, 0xC0, 0x17, 0x74, 0xDA,
+    0xF8, 0xF2, 0xEC, 0x4D, 0x4A, 0x6E, 0xE0, 0x96, 0x00, 0xD0, 0xC8, 0x5F, 0xCE, 0xB3, 0xBD, 0x93,
+    0xF8, 0x33, 0xBA, 0xDD, 0x6D, 0x63, 0x19, 0x92, 0x41, 0xFB, 0x49, 0x09, 0x42, 0xA1, 0x8F, 0x8B,
+    0x68, 0x73, 0x3D, 0xA6, 0x08, 0x6D, 0xB7, 0x47, 0x47, 0xB3, 0xA3, 0x68, 0x31, 0x33, 0x0A, 0x11,
+    0xFB, 0x26, 0x34, 0x48, 0x63, 0x2A, 0xD8, 0x24, 0x0E, 0xE9, 0x8B, 0x39, 0x07, 0xC3, 0xC4, 0xE2,
+    0x1F, 0x18, 0x90, 0x85, 0xF1, 0x58, 0x89, 0xE2, 0x15, 0x85, 0x93, 0xAC, 0xA5, 0xDA, 0xC7, 0x41,
+    0x35, 0x22, 0x50, 0x22, 0x25, 0x8E, 0xD9, 0xF9, 0x6B, 0x76, 0xC2, 0x32, 0x61, 0x26, 0x2D, 0x76,
+    0x73, 0x09, 0xEF, 0xA2, 0x88, 0x11, 0xF8, 0xF9, 0x4E, 0xFE, 0xA4, 0xA0, 0x8D, 0x16, 0x7B, 0x8E,
+    0xBF, 0xD3, 0x71, 0x1C, 0xF0, 0xEA, 0x32, 0x79, 0x85, 0x95, 0x6A, 0x0C, 0xED, 0xF1, 0xF6, 0xD2,
+    0x2D, 0xEC, 0x90, 0xE4, 0x92, 0x49, 0xC9, 0x5B, 0x26, 0xAA, 0x73, 0x49, 0x51, 0x2A, 0xB0, 0x7A,
+    0xFB, 0x24, 0x11, 0x50, 0x3A, 0xD7, 0x14, 0xDD, 0x5F, 0x51, 0xDC, 0x2E, 0xF9, 0xAE, 0xB0, 0x5B,
+    0xF9, 0x1C, 0xCF, 0x36, 0x5B, 0x3E, 0x98, 0x9B, 0xBA, 0x44, 0x6D, 0x54, 0x74, 0x6E, 0xC6, 0x5B,
+    0x85, 0xA3, 0xB8, 0x46, 0x94, 0x91, 0x21, 0xFE, 0xAD, 0x60, 0xF3, 0xF4, 0xCE, 0x5D, 0x52, 0x92,
+    0x92, 0x97, 0xA6, 0xD2, 0x74, 0xCD, 0x45, 0xD3, 0xFC, 0xC6, 0x4B, 0xF0, 0x69, 0x74, 0x9B, 0xC6,
+    0xE9, 0x3B, 0xCF, 0x0B, 0x55, 0xDB, 0x6F, 0xC7, 0xDB, 0x50, 0xA5, 0xAA, 0x6F, 0x11, 0x51, 0xC4,
+    0xC9, 0xF4, 0x62, 0xA7, 0x22, 0x42, 0x07, 0x36, 0x6A, 0x16, 0xED, 0x80, 0x8A, 0x29, 0x3A, 0x71,
+    0xE9, 0x99, 0x98, 0xCF, 0x2F, 0x56, 0x41, 0x6C, 0x33, 0x34, 0x3B, 0x9D, 0x4E, 0xD5, 0xFE, 0x5A,
+    0x19, 0x42, 0xFE, 0xD2, 0x22, 0xDD, 0xA3, 0x1A, 0x27, 0x59, 0x52, 0x97, 0x10, 0xAC, 0x08, 0x32,
+    0x4A, 0x2C, 0xE5, 0xF3, 0xB9, 0xCD, 0x31, 0xE7, 0xC2, 0x94, 0xAB, 0x1A, 0xAA, 0x83, 0xAF, 0xBC,
+    0x3C, 0x99, 0x98, 0x4A, 0xB7, 0x93, 0x9D, 0xDE, 0x45, 0xCE, 0x5E, 0x93, 0xAA, 0x42, 0x19, 0x18,
+    0x32, 0x05, 0x54, 0xBD, 0x37, 0xBD, 0xDE, 0xBE, 0x74, 0x26, 0x49, 0x80, 0x20, 0x9A, 0x40, 0xC3,
+    0x38, 0x3D, 0x9F, 0x7A, 0x98, 0xE0, 0x86, 0xD0, 0xFF, 0xEE, 0x29, 0xF7, 0xA4, 0x2B, 0x83, 0xFE,
+    0x30, 0xD5, 0x18, 0xC5, 0xDB, 0xF8, 0x9C, 0x0E, 0xF8, 0x05, 0x28, 0x7E, 0x05, 0x5A, 0xF8, 0x44,
+    0xF9, 0x32, 0x96, 0xBE, 0x2F, 0x22, 0x02, 0xE9, 0x76, 0x71, 0xB9, 0x51, 0x2D, 0x87, 0xB3, 0x53,
+    0xBD, 0xE5, 0x5C, 0x96, 0x48, 0xA2, 0x2C, 0x6A, 0x25, 0x45, 0xDC, 0x74, 0xFE, 0xFD, 0x5A, 0x29,
+    0x2F, 0xE4, 0xF8, 0xC6, 0x77, 0x84, 0x1B, 0xA7, 0x6F, 0x3C, 0xD9, 0x3F, 0xE1, 0xD1, 0xAA, 0xCE,
+    0x16, 0x94, 0x4B, 0xD9, 0x47, 0xD7, 0x0A, 0xA5, 0x04, 0x81, 0xED, 0x59, 0xA4, 0x5B, 0x77, 0x26,
+    0x3C, 0xBC, 0x70, 0x29, 0x0D, 0xE8, 0xF3, 0x87, 0x57, 0x76, 0x63, 0x2B, 0x33, 0xB4, 0x5B, 0xCD,
+    0x0E, 0x95, 0x6F, 0x50, 0x1E, 0x3F, 0x7C, 0xA3, 0x0F, 0x3F, 0x53, 0x06, 0x8F, 0xD0, 0x8D, 0x05,
+    0xE9, 0x79, 0x26, 0x59, 0x86, 0x3C, 0x1E, 0x8B, 0xF0, 0xC4, 0xF8, 0xD3, 0xF6, 0x9F, 0x0C, 0x36,
+    0x5B, 0xE2, 0xC0, 0xE2, 0x01, 0xE0, 0xB9, 0x08, 0x78, 0x29, 0xC1, 0x2F, 0x4F, 0x1A, 0x40, 0xD1,
+    0x41, 0x6B, 0x8D, 0xE2, 0xA3, 0x4F, 0x68, 0x23, 0x99, 0xEE, 0x3B, 0x08, 0x3A, 0x2E, 0x9F, 0x4F,
+    0x40, 0x5F, 0x3D, 0x65, 0x3D, 0xF6, 0x83, 0xE2, 0xFD, 0x33, 0xB6, 0x25, 0x48, 0xBA, 0xC5, 0x86,
+    0xA9, 0xCF, 0x1F, 0xBA, 0x1F, 0x3B, 0x82, 0xE4, 0x4F, 0x11, 0xA7, 0x92, 0xDF, 0xF9, 0x17, 0xD8,
+    0xE3, 0x44, 0xA9, 0x22, 0x69, 0x7E, 0xD3, 0x5F, 0xB5, 0xC2, 0xC9, 0xFC, 0x92, 0xD5, 0x2B, 0x9C,
+    0x2C, 0x58, 0x6F, 0x89, 0x8B, 0xB3, 0x56, 0x16, 0x62, 0x00, 0x22, 0x70, 0xF2, 0x42, 0xA6, 0x58,
+    0x90, 0xBF, 0x70, 0x82, 0x78, 0x9F, 0x49, 0x15, 0xFF, 0xB0, 0x80, 0xD9, 0x99, 0xAE, 0xE7, 0x2D,
+    0x43, 0x60, 0x11, 0x23, 0x95, 0xF8, 0x34, 0xFD, 0xFA, 0xF4, 0x78, 0x1B, 0x2A, 0xE8, 0x85, 0x5F,
+    0xB9, 0xA8, 0xD2, 0x1C, 0x8E, 0x88, 0xDA, 0xB0, 0x44, 0x84, 0x43, 0x2E, 0x14, 0x44, 0xC6, 0x3D,
+    0xB4, 0x18, 0x6E, 0xC4, 0x32, 0xB1, 0x07, 0x8F, 0x93, 0xE5, 0x13, 0x7F, 0xB0, 0xBD, 0xD5, 0x1C,
+    0xDA, 0x1C, 0x33, 0x91, 0xDA, 0xB2, 0x03, 0xAF, 0xD8, 0xC9, 0xC9, 0x09, 0xDB, 0xA2, 0xF0, 0x91,
+    0xAD, 0x26, 0xA6, 0x72, 0xB2, 0x25, 0xC9, 0x24, 0x18, 0x1C, 0xDA, 0xF5, 0x63, 0x42, 0x94, 0x60,
+    0x30, 0xF8, 0xB3, 0x3C, 0x25, 0x67, 0x0C, 0x60, 0xCC, 0xC1, 0xA6, 0x6A, 0x6C, 0x6D, 0x9B, 0x0B,
+    0x67, 0xDB, 0x72, 0xB9, 0xE9, 0xDF, 0xBA, 0x1E, 0xA6, 0x67, 0x3D, 0x62, 0xDA, 0xB9, 0x94, 0x25,
+    0x3C, 0xCC, 0x24, 0xA4, 0x57, 0xC4, 0x48, 0xD0, 0xC5, 0xAD, 0x23, 0x90, 0xED, 0x08, 0x4A, 0x1B,
+    0x93, 0x92, 0xE5, 0x47, 0x4C, 0x4C, 0x5A, 0xCD, 0x8C, 0x97, 0x94, 0x58, 0xB6, 0x0E, 0x27, 0x8A,
+    0x44, 0xA7, 0x5A, 0x36, 0x74, 0xE1, 0x73, 0xCC, 0x83, 0x98, 0x49, 0x66, 0xE1, 0xB9, 0x98, 0xE3,
+    0x5A, 0x45, 0xEE, 0x4C, 0x9D, 0xC9, 0x22, 0x40, 0x2E, 0x2B, 0x96, 0x9A, 0xEE, 0x9C, 0x9E, 0x65,
+    0x36, 0x5F, 0x1B, 0x78, 0x85, 0x34, 0x31, 0x44, 0x13, 0x10, 0xD9, 0xC9, 0x15, 0xC7, 0x3C, 0xA8,
+    0x3C, 0xEA, 0x09, 0x41, 0xA6, 0x37, 0x2A, 0xAE, 0x0C, 0x29, 0xF5, 0xEF, 0x71, 0xE8, 0xC3, 0xFF,
+    0xA6, 0xA7, 0x68, 0xEC, 0x1D, 0x6F, 0xC3, 0x03, 0xFE, 0x78, 0x9E, 0xF9, 0x75, 0xFE, 0x53, 0xFC,
+    0xF8, 0x0E, 0x3E, 0xC4, 0x3F, 0xCE, 0xC8, 0x7F, 0x80, 0x3F, 0xB6, 0x11, 0xC8, 0xB6, 0x00, 0xA8,
+    0x68, 0x08, 0x93, 0x0B, 0x27, 0x5D, 0x35, 0x45, 0x57, 0xC3, 0x24, 0xE5, 0x70, 0x32, 0x82, 0x84,
+    0x6C, 0x91, 0x02, 0x32, 0xDF, 0x4F, 0xF0, 0x94, 0x1D, 0x7E, 0x7D, 0x76, 0x9E, 0xF4, 0xE4, 0xAA,
+    0xB2, 0xB3, 0x2F, 0x7D, 0x90, 0xC0, 0xC1, 0x06, 0xDD, 0x8D, 0x36, 0xB9, 0xEB, 0xF6, 0x59, 0x6D,
+    0x38, 0x50, 0x26, 0x5C, 0xB0, 0x67, 0x7C, 0x1F, 0x74, 0x8B, 0x6A, 0xF3, 0x81, 0x8A, 0xD7, 0x34,
+    0x1F, 0x64, 0x92, 0x5D, 0x2D, 0x4F, 0x07, 0x54, 0x20, 0xC3, 0xD5, 0xA5, 0xA2, 0x15, 0x38, 0xF3,
+    0xCE, 0x0C, 0xD2, 0x55, 0xC5, 0x9B, 0x18, 0x9D, 0xDC, 0x5B, 0x4A, 0xE9, 0x7D, 0x62, 0xF4, 0x77,
+    0xBB, 0x86, 0xBC, 0x65, 0xE1, 0xC4, 0xD8, 0xE9, 0xC3, 0x0F, 0x40, 0x9B, 0xB6, 0xC8, 0xE8, 0xE0,
+    0x00, 0x98, 0x86, 0x54, 0xBE, 0x24, 0x89, 0xAE, 0x00, 0x2B, 0xC4, 0x82, 0x4A, 0x97, 0xAF, 0xD0,
+    0x3F, 0x50, 0xDC, 0x09, 0x62, 0x88, 0x3B, 0x37, 0xD1, 0x08, 0x61, 0xA1, 0x13, 0x62, 0x5E, 0x2F,
+    0x34, 0x01, 0x8D, 0xD3, 0xEF, 0x7F, 0x7F, 0xB8, 0xB7, 0xB7, 0x7B, 0x54, 0x12, 0xEF, 0xBE, 0x66,
+    0x0B, 0xFD, 0xA4, 0x85, 0xF7, 0x0B, 0x01, 0x7F, 0xD0, 0x7D, 0x42, 0xF8, 0xBD, 0x04, 0xFE, 0xB5,
+    0xCC, 0xE8, 0xFA, 0xF6, 0xCF, 0x4F, 0x07, 0x7E, 0x37, 0x01, 0x8F, 0x77, 0x79, 0x49, 0x02, 0x3D,
+    0x65, 0x07, 0x76, 0x92, 0x16, 0xC8, 0x30, 0x97, 0x34, 0xD2, 0x8D, 0x41, 0x1D, 0x0D, 0x25, 0x4A,
+    0x86, 0xC9, 0x44, 0x16, 0xE8, 0xEA, 0xC9, 0x24, 0xCA, 0xD5, 0x9B, 0x4C, 0x39, 0xE0, 0x25, 0xB3,
+    0xCA, 0x0B, 0xCD, 0x78, 0x4A, 0x45, 0x46, 0x66, 0x94, 0x59, 0x8F, 0x89, 0x0F, 0x60, 0x67, 0xEA,
+    0xD6, 0x8D, 0x75, 0x8C, 0x2E, 0x99, 0xCD, 0x33, 0xEE, 0xF8, 0x53, 0x5B, 0x5E, 0xD8, 0x13, 0xBA,
+    0x0A, 0xCF, 0x48, 0xBA, 0xFF, 0x0A, 0x7F, 0x7F, 0x25, 0xBB, 0xEB, 0x06, 0x3D, 0xAF, 0x8B, 0x85,
+    0x1B, 0x45, 0x3D, 0x10, 0x2E, 0x49, 0xCC, 0xC0, 0x68, 0xE9, 0xB8, 0x36, 0x6B, 0xD0, 0x9F, 0x6D,
+    0x8A, 0x02, 0xBE, 0xBD, 0xB8, 0xBE, 0xBA, 0x7D, 0xF5, 0xE2, 0x65, 0x07, 0xC4, 0x4B, 0xB3, 0xC5,
+    0xE6, 0x9E, 0x88, 0x77, 0x9F, 0x71, 0x7F, 0x02, 0x26, 0xF3, 0x18, 0x9A, 0x98, 0x0A, 0x20, 0xBF,
+    0x51, 0x53, 0x2C, 0x26, 0x78, 0xD6, 0x10, 0xFB, 0xE2, 0x76, 0x58, 0xDC, 0x6E, 0xDA, 0x06, 0x13,
+    0x86, 0xF6, 0xC6, 0x36, 0x58, 0xC2, 0x3C, 0xB1, 0xFD, 0x85, 0xC3, 0x62, 0xD4, 0xB1, 0xBB, 0xB2,
+    0x74, 0xD0, 0x5A, 0x5D, 0x4F, 0x6B, 0x3E, 0x3D, 0x6A, 0x9A, 0x04, 0xCE, 0x64, 0x6E, 0x0A, 0x97,
+    0xCE, 0x75, 0xF4, 0xF8, 0x95, 0x66, 0xC9, 0x8B, 0x8B, 0x77, 0x2C, 0x6E, 0x3E, 0x3A, 0xD5, 0x21,
+    0xA6, 0x4A, 0x03, 0x33, 0xE5, 0x07, 0x81, 0xCB, 0xEC, 0x09, 0x85, 0x15, 0x4E, 0xCD, 0xFE, 0x60,
+    0x8F, 0x11, 0xB2, 0x4D, 0x99, 0x32, 0x78, 0xCE, 0xB9, 0x0D, 0x73, 0x63, 0x35, 0xE5, 0xF3, 0x4C,
+    0x0E, 0x50, 0x16, 0xFB, 0x99, 0xB1, 0x34, 0x94, 0x58, 0x92, 0xDC, 0x0B, 0x7E, 0xC3, 0x33, 0x27,
+    0x26, 0xC2, 0x37, 0x98, 0x3D, 0x71, 0xDB, 0x4F, 0x3C, 0x83, 0x12, 0xBE, 0x4A, 0x66, 0x11, 0xBC,
+    0x6B, 0x75, 0xF0, 0xA8, 0x53, 0xDD, 0xA9, 0x94, 0x25, 0xCC, 0x57, 0x9A, 0x4E, 0x92, 0x98, 0x51,
+    0x47, 0xC4, 0x4F, 0xA3, 0xE8, 0x9D, 0x10, 0xEC, 0x86, 0xE4, 0x8A, 0x96, 0x33, 0xDC, 0x03, 0x7C,
+    0xC7, 0x29, 0xB0, 0x63, 0x1D, 0x65, 0x20, 0xE3, 0xF1, 0x4C, 0xBD, 0x23, 0xDD, 0xE0, 0xBF, 0x98,
+    0x77, 0x26, 0xE8, 0x1F, 0x30, 0x67, 0x68, 0xEF, 0xFC, 0x15, 0xDA, 0xD3, 0xB4, 0xA9, 0x87, 0xD7,
+    0xE3, 0x45, 0xCA, 0xC1, 0x71, 0x40, 0x25, 0x52, 0x7A, 0x05, 0x1A, 0xAD, 0x21, 0xBB, 0x7E, 0x71,
+    0x7B, 0x75, 0xF6, 0xE3, 0xC5, 0xED, 0xF5, 0xAB, 0xFF, 0x76, 0x01, 0x14, 0xEB, 0x75, 0xBB, 0x47,
+    0xF4, 0x75, 0x7B, 0x9B, 0x81, 0x61, 0xEE, 0x3B, 0x30, 0x49, 0x70, 0xB6, 0x00, 0xCA, 0x30, 0x4F,
+    0x70, 0x0F, 0x1B, 0xA3, 0x78, 0x69, 0x0F, 0x38, 0xBD, 0x56, 0xBA, 0x3C, 0x64, 0xF3, 0xD8, 0x1B,
+    0x7F, 0x4D, 0xE1, 0xD2, 0x27, 0xEC, 0xC3, 0xC7, 0x18, 0xD6, 0x4B, 0x72, 0x10, 0x04, 0xC9, 0x02,
+    0xE7, 0x7B, 0x5E, 0x18, 0x79, 0x16, 0xD1, 0xF9, 0x38, 0xE2, 0x08, 0x14, 0x6F, 0x9C, 0x98, 0x27,
+    0x28, 0x9A, 0xC1, 0xC3, 0xDC, 0x62, 0xE3, 0xE5, 0x5C, 0x78, 0x72, 0xD3, 0x4E, 0x9F, 0xE2, 0x0D,
+    0x7E, 0xD0, 0x19, 0x1C, 0xEA, 0x57, 0xC4, 0x6F, 0x27, 0xAC, 0xAE, 0x63, 0xEE, 0x48, 0x03, 0x27,
+    0x00, 0x18, 0x67, 0xBE, 0x6F, 0x3E, 0x74, 0x10, 0xE7, 0x46, 0x0C, 0x5A, 0xF0, 0x13, 0x54, 0xCB,
+    0xD4, 0x43, 0xBF, 0xC6, 0xEF, 0xD2, 0x6E, 0xB1, 0xA6, 0xE2, 0xB6, 0x1B, 0xD3, 0xE5, 0x7E, 0xD8,
+    0xD8, 0xBA, 0x72, 0xB9, 0x19, 0x44, 0x53, 0x97, 0x99, 0x62, 0x22, 0xC7, 0xEE, 0xD6, 0x4E, 0x1E,
+    0x25, 0xFC, 0xE7, 0x73, 0x60, 0xF1, 0x79, 0xE9, 0x9D, 0x3B, 0x12, 0x73, 0xCF, 0x9F, 0xBD, 0x30,
+    0x43, 0x13, 0x90, 0x9F, 0xF3, 0x15, 0xE6, 0x52, 0xA7, 0x9F, 0x8D, 0xE2, 0x1D, 0x94, 0x80, 0x29,
+    0x14, 0xBE, 0x30, 0xAD, 0x29, 0xF5, 0x8D, 0x9D, 0x9C, 0xC6, 0x95, 0x3B, 0x28, 0x9B, 0xE6, 0x40,
+    0x2A, 0xFC, 0xB0, 0xD5, 0xA2, 0xD2, 0xCD, 0x7C, 0x8F, 0x61, 0x50, 0xA5, 0x63, 0x1C, 0x0C, 0x7C,
+    0x4F, 0xA6, 0x0D, 0x20, 0xCF, 0x70, 0x7A, 0x28, 0x8B, 0x18, 0x8A, 0x5E, 0x52, 0x26, 0xBB, 0x93,
+    0x3C, 0xCF, 0x44, 0x2E, 0xC5, 0x1F, 0x18, 0x0C, 0xDA, 0xB9, 0xF0, 0x37, 0x0B, 0xCE, 0x69, 0x34,
+    0x3B, 0x94, 0x72, 0x6E, 0xC8, 0xB6, 0xB6, 0x67, 0xF3, 0x70, 0x2B, 0x87, 0x4C, 0xE8, 0x3F, 0x28,
+    0xE8, 0x0D, 0x28, 0x52, 0x1C, 0xB8, 0x68, 0x92, 0x90, 0x22, 0x15, 0xB5, 0x50, 0x50, 0x60, 0x26,
+    0x3E, 0x4A, 0x5E, 0xA9, 0xC1, 0x41, 0xA2, 0xBC, 0x6A, 0xB8, 0x32, 0x90, 0x72, 0xCE, 0x20, 0x85,
+    0x4F, 0xF5, 0x97, 0xF7, 0x31, 0x82, 0x7F, 0xF8, 0x35, 0xFD, 0xFD, 0xB3, 0x2C, 0xDD, 0xE9, 0xFC,
+    0x82, 0x3D, 0x4F, 0x8A, 0xE1, 0x6B, 0x78, 0x9B, 0x27, 0x43, 0xD2, 0x17, 0x5F, 0x5C, 0x50, 0x05,
+    0xC3, 0xCA, 0xCC, 0x95, 0xE9, 0x00, 0x63, 0xA4, 0xBC, 0x5A, 0x02, 0xFF, 0x6D, 0x41, 0x96, 0x1F,
+    0x90, 0xAE, 0x27, 0x5B, 0xEC, 0x19, 0xE3, 0x73, 0xDC, 0xC7, 0x7C, 0xFF, 0xEE, 0xD5, 0xB9, 0x37,
+    0x83, 0xCA, 0x80, 0x6E, 0x23, 0x19, 0x2C, 0x50, 0x39, 0x7F, 0x55, 0x8A, 0xCE, 0x19, 0x0F, 0xA7,
+    0x9E, 0x0D, 0xD8, 0x5D, 0xBD, 0xBD, 0xBE, 0xD9, 0x6A, 0x29, 0xCB, 0xA0, 0x03, 0x61, 0x18, 0xB3,
+    0x57, 0xA1, 0xC8, 0xE7, 0x66, 0x59, 0x3F, 0x96, 0x6E, 0x18, 0xF7, 0x22, 0xEA, 0x56, 0xE7, 0xEF,
+    0x01, 0xD8, 0x59, 0xAA, 0x6A, 0x38, 0x11, 0xE3, 0x52, 0xDE, 0xA7, 0xA6, 0x06, 0x6B, 0x01, 0x5D,
+    0x9E, 0x91, 0x02, 0xF0, 0xA2, 0x1D, 0x31, 0xB7, 0xA3, 0x51, 0xF9, 0xC3, 0xAF, 0xE9, 0xB7, 0x72,
+    0x2C, 0x24, 0x33, 0xE1, 0x39, 0x80, 0x25, 0x79, 0xB8, 0xC6, 0x4B, 0xD7, 0x7D, 0x10, 0xE3, 0x43,
+    0xFB, 0x36, 0xEA, 0xEF, 0x5B, 0x47, 0x4A, 0x34, 0x84, 0x44, 0x90, 0x68, 0x34, 0xD5, 0x65, 0x48,
+    0xE6, 0x89, 0x49, 0x50, 0x9C, 0x15, 0x30, 0x39, 0x4D, 0x37, 0xD0, 0x55, 0x2D, 0xE3, 0x43, 0xD9,
+    0xA8, 0xBA, 0x62, 0x22, 0xED, 0xE8, 0xA8, 0xBF, 0xF0, 0x61, 0x2A, 0x4B, 0x6E, 0xBA, 0xBF, 0xB0,
+    0x55, 0xD8, 0x88, 0x51, 0x34, 0xF0, 0x99, 0x71, 0xE8, 0x9C, 0x66, 0x08, 0xC3, 0x29, 0xDE, 0xC1,
+    0x8D, 0x52, 0xEE, 0x02, 0xFD, 0x4B, 0x0D, 0x39, 0x58, 0x9C, 0x9C, 0x4D, 0xFF, 0xFE, 0xEF, 0xD1,
+    0x90, 0x46, 0x63, 0x0C, 0x6F, 0xB6, 0x5E, 0x9A, 0x8E, 0x2B, 0x2E, 0xAF, 0x89, 0xB6, 0xB6, 0xA6,
+    0x62, 0xBB, 0x4B, 0x29, 0x74, 0x3F, 0x67, 0xC5, 0x2D, 0x03, 0x4B, 0xCD, 0x9A, 0xB2, 0x06, 0x35,
+    0xA0, 0xE2, 0x2B, 0xE9, 0x05, 0x16, 0x18, 0x34, 0xB6, 0x08, 0xAB, 0x94, 0xEC, 0xC1, 0x76, 0x86,
+    0x20, 0x4D, 0x45, 0xFD, 0x23, 0xCD, 0xEA, 0xF0, 0x8B, 0xB2, 0x1A, 0xC8, 0x05, 0xAA, 0x16, 0xF5,
+    0xE6, 0xF3, 0x2F, 0x0A, 0x00, 0x5F, 0x53, 0x8A, 0x09, 0x34, 0x15, 0x78, 0xE9, 0xAF, 0x70, 0xD3,
+    0xAD, 0xEA, 0xD8, 0xD1, 0xB7, 0xA1, 0x29, 0xF6, 0xBC, 0x35, 0x0B, 0x7B, 0xDD, 0x4E, 0xA5, 0x1D,
+    0x14, 0xF9, 0xAB, 0x9E, 0x95, 0x4B, 0x44, 0xA9, 0xB4, 0x34, 0x48, 0x5A, 0x02, 0x48, 0xA3, 0x84,
+    0xDA, 0x7A, 0xD9, 0x54, 0x98, 0xC8, 0x78, 0x44, 0x5D, 0x70, 0xFF, 0x2F, 0xEF, 0x96, 0x22, 0xF0,
+    0xF4, 0x0F, 0xBF, 0x06, 0x30, 0xC7, 0x40, 0x33, 0x02, 0x4A, 0x7C, 0x16, 0xDA, 0x11, 0xBD, 0x5A,
+    0x80, 0x82, 0x48, 0x17, 0x67, 0x7E, 0xFE, 0x05, 0x24, 0x73, 0x03, 0xDF, 0xC0, 0x8A, 0x0C, 0x35,
+    0x6E, 0xA1, 0xB0, 0x33, 0x7E, 0x00, 0xF9, 0x64, 0x80, 0x09, 0x04, 0x76, 0x8D, 0xEF, 0x98, 0xAE,
+    0x70, 0x07, 0x3C, 0x70, 0xF2, 0x71, 0xA2, 0x95, 0xC3, 0xED, 0xA6, 0xC1, 0xF0, 0x3A, 0xE3, 0x26,
+    0x7B, 0x56, 0x66, 0x7A, 0x21, 0xE0, 0xC0, 0xF5, 0x44, 0xF6, 0x1C, 0x94, 0x79, 0x1D, 0x76, 0x69,
+    0xFA, 0x13, 0xD0, 0xF6, 0x84, 0x95, 0x85, 0x03, 0x8C, 0x62, 0xDB, 0xA4, 0xF0, 0x97, 0x4C, 0xE9,
+    0xE6, 0xE7, 0xCE, 0x2F, 0x95, 0xE7, 0xA0, 0xE3, 0x7F, 0x80, 0x8B, 0xBC, 0x46, 0x8A, 0x8E, 0x31,
+    0x6F, 0x05, 0x2C, 0xEE, 0x21, 0x13, 0xCE, 0xF0, 0xA9, 0x19, 0x40, 0x2F, 0xA4, 0x29, 0xC6, 0xB0,
+    0x99, 0x23, 0xE9, 0xD5, 0x90, 0xD6, 0x19, 0xA3, 0x6B, 0x3F, 0xDF, 0x5F, 0x3F, 0xEF, 0xA8, 0x86,
+    0x03, 0xE5, 0x3E, 0xA0, 0x87, 0x87, 0x82, 0xB8, 0x7D, 0x8B, 0x57, 0x45, 0xDE, 0x4A, 0xB2, 0xEA,
+    0x96, 0x00, 0x1A, 0x8A, 0x67, 0x30, 0x16, 0xEC, 0x2F, 0xA2, 0xA0, 0xA0, 0xBC, 0x02, 0x02, 0x0C,
+    0x8C, 0x10, 0x1C, 0x4E, 0x18, 0x08, 0x82, 0x93, 0x1E, 0xBF, 0x02, 0x8C, 0x45, 0x69, 0xBA, 0x9A,
+    0xB2, 0xF3, 0x4B, 0x95, 0x08, 0x49, 0xE1, 0x89, 0x3C, 0xCA, 0x69, 0xFF, 0xCB, 0x10, 0xB0, 0x8D,
+    0x6A, 0x34, 0x2F, 0x4D, 0x52, 0x9F, 0x88, 0x3E, 0xA2, 0xD2, 0x50, 0xA0, 0x4C, 0x53, 0xF0, 0xF3,
+    0x7A, 0xED, 0x47, 0x66, 0xD3, 0x6D, 0x94, 0x4E, 0xA0, 0xAA, 0x7D, 0x43, 0x7A, 0x07, 0x03, 0x16,
+    0x1D, 0xFD, 0x10, 0xC6, 0x73, 0xC7, 0xA8, 0xD3, 0x6C, 0x99, 0x2C, 0xC1, 0x5F, 0x3A, 0x95, 0x17,
+    0x2A, 0x1E, 0xAD, 0x29, 0x86, 0xCB, 0x9A, 0x32, 0xCE, 0xBD, 0xA5, 0x6B, 0xD3, 0x6C, 0xC1, 0xB0,
+    0x9D, 0xAC, 0x57, 0x40, 0xFA, 0x2F, 0x0D, 0x2D, 0x2E, 0x73, 0x58, 0xCA, 0x6B, 0xC8, 0xB7, 0x58,
+    0xB2, 0x8D, 0x96, 0x78, 0x5A, 0xEF, 0xC6, 0xFB, 0x89, 0xDF, 0x37, 0xC4, 0x73, 0x1E, 0x5F, 0x09,
+    0x38, 0x65, 0x67, 0xE0, 0x7A, 0xF6, 0x1E, 0x34, 0xEA, 0x03, 0x7A, 0x17, 0x55, 0x6B, 0xB1, 0x11,
+    0x2A, 0xE8, 0xA3, 0x4E, 0xE8, 0x5D, 0x87, 0x18, 0xFD, 0xD9, 0xE8, 0xED, 0xA1, 0x46, 0x6C, 0x53,
+    0x50, 0x68, 0xA3, 0xDF, 0x62, 0x46, 0xD7, 0x68, 0x36, 0x3B, 0x7F, 0xF7, 0x9C, 0x79, 0xC3, 0x48,
+    0xCF, 0x8F, 0xF4, 0xBD, 0xA5, 0xA0, 0x0E, 0xFF, 0x74, 0xD6, 0x46, 0x37, 0x89, 0x37, 0xC6, 0x73,
+    0x4B, 0xD4, 0xC4, 0x73, 0x6A, 0x01, 0x84, 0x32, 0x9B, 0xF2, 0xFB, 0x0E, 0xB3, 0xFC, 0x87, 0x45,
+    0xE8, 0x75, 0x82, 0xE5, 0x28, 0xA4, 0x38, 0x02, 0xF7, 0x81, 0xF1, 0x7B, 0x07, 0xAF, 0xDB, 0x81,
+    0x0E, 0x4D, 0xC3, 0x70, 0x11, 0x90, 0xE5, 0x17, 0xB4, 0xA2, 0x70, 0x56, 0x19, 0xD4, 0x9C, 0x6E,
+    0x25, 0xE0, 0xFE, 0x1D, 0xF0, 0xC9, 0xC2, 0xC5, 0x23, 0x14, 0x58, 0xA7, 0xC5, 0x02, 0x4F, 0x1C,
+    0x4D, 0x07, 0x6D, 0xC5, 0x0D, 0x68, 0xBA, 0xC8, 0x38, 0x50, 0x74, 0x44, 0x80, 0xAC, 0x59, 0x88,
+    0xE1, 0x12, 0xBE, 0x50, 0x3C, 0x6F, 0x81, 0x0D, 0xA6, 0xEC, 0x87, 0xDC, 0x9A, 0x21, 0xBC, 0x3D,
+    0x7A, 0xBA, 0x22, 0x97, 0xAF, 0x9C, 0xB9, 0xED, 0xAD, 0x3A, 0xA2, 0x43, 0xEC, 0xFB, 0xEF, 0xB3,
+    0x5D, 0x53, 0x71, 0x8E, 0x1C, 0x8D, 0xF4, 0xB0, 0x09, 0xD1, 0x9E, 0xA9, 0xD9, 0xB1, 0x1D, 0x14,
+    0x90, 0x0D, 0x43, 0x12, 0xD3, 0x68, 0xC9, 0x1A, 0xCD, 0xA6, 0x8E, 0x39, 0x92, 0xF5, 0xE2, 0xCF,
+    0x68, 0x16, 0x17, 0x1A, 0xEE, 0xDE, 0xEF, 0xF6, 0x0F, 0xCC, 0xFE, 0xF8, 0xF0, 0xA0, 0x05, 0xCF,
+    0xFB, 0xBD, 0x9D, 0xFD, 0xDD, 0xDD, 0xC3, 0x1E, 0x3E, 0x8F, 0x06, 0x56, 0x77, 0x3C, 0xB2, 0xC6,
+    0xF8, 0xCC, 0x0F, 0x47, 0x03, 0x7B, 0x64, 0x0E, 0xF0, 0x79, 0xE7, 0x70, 0xB0, 0x67, 0xF5, 0x07,
+    0x23, 0x7C, 0x1E, 0x1C, 0x8E, 0x7B, 0xBD, 0xDE, 0x98, 0xCA, 0x1F, 0xF6, 0x77, 0xC6, 0x07, 0x7D,
+    0x73, 0x17, 0x9F, 0xCD, 0x51, 0xCF, 0x1A, 0x70, 0x7B, 0xD0, 0x52, 0xB4, 0x67, 0x1F, 0x74, 0xF7,
+    0x4D, 0x53, 0xB4, 0xD7, 0xEB, 0x1F, 0xEC, 0x0C, 0x46, 0x5D, 0xAA, 0xDF, 0xDF, 0xDD, 0xE9, 0x1D,
+    0x0C, 0x46, 0x9C, 0xE0, 0x0E, 0xBA, 0xD6, 0xBE, 0x6D, 0xED, 0x10, 0x4E, 0xFD, 0x11, 0x1F, 0xD8,
+    0xFB, 0x04, 0xF7, 0xA0, 0x6B, 0xF3, 0x51, 0x6F, 0x4C, 0x65, 0x0E, 0x47, 0xB6, 0xD5, 0xDD, 0x33,
+    0xF7, 0xF1, 0xD9, 0xEA, 0x1D, 0x8E, 0xC6, 0x3D, 0x28, 0xA3, 0x68, 0x8F, 0xEF, 0x1E, 0x8E, 0xF6,
+    0x0E, 0x2D, 0x6A, 0x83, 0x8F, 0x47, 0x7C, 0x77, 0xFF, 0x60, 0x0F, 0x9F, 0xBB, 0x63, 0xA8, 0x65,
+    0x5B, 0x7B, 0xA2, 0xED, 0xAE, 0x65, 0xF6, 0x2C, 0x8B, 0x9E, 0x6D, 0x7E, 0xD8, 0xB7, 0xF6, 0xA8,
+    0xDF, 0xBB, 0xE6, 0xFE, 0xEE, 0xC1, 0xAE, 0x69, 0x12, 0x4E, 0xD6, 0xA8, 0x6B, 0x42, 0x05, 0xC2,
+    0x69, 0x0F, 0x08, 0x76, 0x60, 0x9B, 0xAA, 0xF6, 0x0E, 0x0F, 0x76, 0xF8, 0xA0, 0x37, 0xE8, 0x13,
+    0x1D, 0x0E, 0x76, 0x7A, 0xD6, 0xDE, 0x9E, 0x4D, 0xF4, 0xEC, 0x76, 0x77, 0xFA, 0xFB, 0x16, 0xF5,
+    0x7B, 0x34, 0x1E, 0x1C, 0xEE, 0x8F, 0x2D, 0x81, 0xFB, 0x1E, 0xEF, 0x76, 0x47, 0x63, 0xEA, 0xAB,
+    0x3D, 0x30, 0xF7, 0x0F, 0x7B, 0xBB, 0xF4, 0xBE, 0xBB, 0x67, 0x99, 0x7B, 0x3B, 0x03, 0xC2, 0xBB,
+    0xB7, 0xDB, 0x3F, 0xEC, 0x1F, 0xEE, 0xED, 0xAB, 0xDA, 0xEB, 0xEF, 0x8F, 0xF6, 0xBB, 0xE6, 0x01,
+    0x8D, 0x4D, 0x9F, 0xF7, 0x46, 0xFD, 0xDE, 0x0E, 0xB5, 0xB1, 0x6B, 0x43, 0x2F, 0xEC, 0x31, 0xE1,
+    0x3B, 0xD8, 0xD9, 0x01, 0xD2, 0xF5, 0xA8, 0x8D, 0xBD, 0x41, 0xD7, 0xDC, 0xDF, 0x19, 0xEC, 0x8A,
+    0x7E, 0xEC, 0x99, 0x5D, 0x73, 0x44, 0x63, 0x79, 0xD0, 0xB3, 0xFA, 0xD6, 0x61, 0x5F, 0xD0, 0xB6,
+    0xBF, 0xDF, 0xEF, 0x5B, 0x07, 0xCA, 0xF1, 0x33, 0xFB, 0xA3, 0x31, 0x3F, 0x30, 0x7B, 0xA2, 0x7F,
+    0x3D, 0x73, 0x6F, 0x6F, 0x97, 0xEA, 0x5B, 0xFD, 0xDD, 0xD1, 0x01, 0xA0, 0x42, 0xCF, 0xFB, 0x7B,
+    0xD6, 0xA0, 0x67, 0x8A, 0x3E, 0xF5, 0x00, 0xE8, 0x41, 0xEF, 0x90, 0x9E, 0xF7, 0x0E, 0x0F, 0xBB,
+    0x7B, 0x7D, 0x6A, 0x7B, 0xBC, 0xDB, 0xE5, 0x3B, 0x03, 0x81, 0x77, 0x0F, 0x06, 0xD2, 0xEC, 0x42,
+    0x5D, 0x45, 0x7B, 0xBD, 0x43, 0x73, 0xD7, 0xEA, 0xF5, 0x68, 0x9C, 0x7A, 0x7C, 0x07, 0x20, 0x77,
+    0xA9, 0x7F, 0x7D, 0x18, 0x9A, 0xFD, 0xFD, 0x5D, 0xEA, 0xDF, 0xCE, 0xEE, 0xA8, 0x3B, 0xB2, 0x46,
+    0x92, 0x3F, 0x7B, 0x56, 0xD7, 0x1A, 0x51, 0xDB, 0xBB, 0xDC, 0x3E, 0x30, 0xCD, 0x5D, 0x31, 0x7E,
+    0xA3, 0x43, 0xCB, 0x32, 0x77, 0x69, 0x5C, 0xF7, 0x0E, 0xFA, 0x7C, 0x6F, 0x0C, 0x34, 0x57, 0xB4,
+    0x07, 0x60, 0x81, 0x8F, 0x39, 0xD1, 0x61, 0xFF, 0xC0, 0x1C, 0xEC, 0xED, 0x08, 0x5E, 0x38, 0xD8,
+    0xB5, 0x0E, 0xF6, 0x0F, 0x7A, 0x82, 0x0F, 0x2D, 0x6B, 0xBF, 0xDB, 0x17, 0x78, 0x1C, 0x76, 0x47,
+    0x7C, 0x3C, 0x1E, 0x53, 0x1B, 0xE6, 0xEE, 0x00, 0x86, 0x8D, 0x13, 0x3D, 0xE0, 0xED, 0xA1, 0xB9,
+    0x33, 0x96, 0x63, 0xBC, 0xDF, 0xDB, 0x3F, 0x18, 0xF7, 0x3F, 0x1E, 0x69, 0x34, 0x4C, 0xD4, 0xFF,
+    0x3E, 0x00, 0x5E, 0x66, 0xF7, 0x90, 0xEF, 0xED, 0x51, 0x9D, 0xD1, 0x68, 0x6F, 0xDF, 0xE4, 0x82,
+    0x3E, 0x3B, 0xC0, 0x24, 0xE3, 0x9D, 0x7D, 0xC1, 0x53, 0x83, 0xDD, 0xF1, 0x78, 0xB0, 0x23, 0xFA,
+    0xD4, 0xEB, 0xF2, 0x41, 0x7F, 0x7F, 0x2C, 0xE6, 0x43, 0x77, 0xB0, 0x77, 0x70, 0x40, 0xF4, 0xE8,
+    0x8D, 0x0F, 0x76, 0xEC, 0x43, 0x53, 0xCC, 0xD1, 0x11, 0xEF, 0x5A, 0x30, 0x08, 0xCA, 0xB6, 0xED,
+    0xC4, 0x61, 0x53, 0x14, 0xFD, 0x47, 0x79, 0xAF, 0xCB, 0x6B, 0xA1, 0x6A, 0x8B, 0x99, 0xD8, 0x62,
+    0xFF, 0xE0, 0xBE, 0x07, 0xD2, 0x38, 0x8C, 0x9C, 0xDC, 0x23, 0x07, 0x13, 0xC6, 0x90, 0x77, 0x41,
+    0x1E, 0x5A, 0xA3, 0xD0, 0x8B, 0x03, 0x36, 0x7A, 0x20, 0x25, 0x6A, 0x2C, 0x17, 0xBD, 0x39, 0x68,
+    0x31, 0x23, 0xBC, 0xB0, 0x53, 0x81, 0x10, 0xDE, 0x07, 0x0D, 0x5A, 0x4D, 0x01, 0xA5, 0xD7, 0x66,
+    0x38, 0xED, 0x58, 0xDC, 0x71, 0x1B, 0x0D, 0x0A, 0x29, 0x8D, 0x23, 0xC0, 0x0E, 0x9B, 0x6C, 0x9B,
+    0xED, 0xED, 0x36, 0xD9, 0x9F, 0xF0, 0xFF, 0x8B, 0xF7, 0x71, 0x83, 0x9A, 0x10, 0xF0, 0x90, 0x2A,
+    0x29, 0xBF, 0x7E, 0x48, 0x81, 0xFB, 0x08, 0xED, 0x62, 0xD7, 0x54, 0x94, 0xBA, 0x73, 0x00, 0x21,
+    0x81, 0x16, 0x7A, 0x12, 0xFE, 0x02, 0x3F, 0x1B, 0x12, 0xBE, 0x92, 0x5C, 0x58, 0x1E, 0x5B, 0xC6,
+    0x3E, 0xEC, 0xF4, 0xA3, 0xA2, 0x12, 0xED, 0x36, 0x03, 0xD6, 0xA1, 0x2E, 0x8D, 0x5D, 0x0F, 0x2C,
+    0xB6, 0x74, 0x97, 0xB6, 0x91, 0xB7, 0xBB, 0xE2, 0x5F, 0x73, 0x3D, 0xA0, 0xC0, 0x9B, 0x19, 0x50,
+    0x7F, 0x62, 0x07, 0x4D, 0x76, 0x7A, 0x7A, 0xCA, 0xBA, 0x4A, 0x5F, 0xE3, 0x2A, 0x45, 0xE6, 0x9D,
+    0xBE, 0xA0, 0x73, 0x81, 0x86, 0xD2, 0x4C, 0xF1, 0x42, 0x1F, 0x4A, 0x37, 0xEE, 0x41, 0xDF, 0x6F,
+    0xA2, 0x3E, 0xD0, 0xB8, 0x27, 0xC0, 0xF0, 0xE3, 0xDF, 0xF1, 0xF9, 0xF8, 0x98, 0x35, 0x76, 0xFA,
+    0x80, 0xC2, 0x3C, 0x8F, 0x32, 0xFA, 0x85, 0x1B, 0x68, 0x7F, 0x78, 0xE3, 0x31, 0x92, 0xF7, 0x88,
+    0x1E, 0x8E, 0x59, 0x06, 0x77, 0xF1, 0x12, 0x54, 0x3D, 0x1C, 0x48, 0xD5, 0x5D, 0xDD, 0x12, 0x86,
+    0x23, 0x20, 0x38, 0x50, 0xBF, 0xB7, 0x07, 0x7F, 0x9F, 0x3D, 0xD3, 0xE9, 0x8E, 0xAB, 0x0F, 0x0E,
+    0x8E, 0x26, 0x11, 0x6C, 0x12, 0x13, 0x8C, 0x5A, 0x61, 0xBB, 0x40, 0x18, 0xA7, 0x59, 0x47, 0x77,
+    0xCC, 0x34, 0x4C, 0x2D, 0x42, 0xCB, 0x7B, 0xBB, 0xA5, 0x2D, 0xCB, 0x49, 0xDD, 0x45, 0xD7, 0x0E,
+    0x50, 0xAD, 0x01, 0x98, 0xE0, 0x6D, 0x7A, 0x83, 0x8F, 0x2D, 0xB6, 0xDF, 0x64, 0xFF, 0xBD, 0xF0,
+    0xB2, 0x77, 0x80, 0x6F, 0x93, 0x37, 0x44, 0xD7, 0x1D, 0x8D, 0x5B, 0x45, 0x02, 0xEF, 0x65, 0x81,
+    0xF7, 0x11, 0x4C, 0x1E, 0x38, 0xBD, 0x3C, 0x4C, 0xC1, 0xEE, 0x0B, 0xD0, 0xBD, 0xAE, 0x06, 0xB6,
+    0x24, 0x59, 0x84, 0xC9, 0xDE, 0x47, 0x20, 0x15, 0x74, 0xE3, 0x19, 0x13, 0x2F, 0xF6, 0xE9, 0x77,
+    0x4F, 0x32, 0x54, 0x1D, 0xEA, 0x21, 0xE1, 0x3E, 0x80, 0x9C, 0x02, 0x31, 0x04, 0x52, 0x09, 0x43,
+    0xF3, 0x5A, 0x0C, 0x44, 0xD5, 0xA4, 0xC5, 0x68, 0xA6, 0x91, 0xDC, 0x3B, 0xAA, 0x35, 0xD8, 0xB5,
+    0x48, 0x1E, 0x22, 0x55, 0x1A, 0x28, 0x13, 0x1A, 0x44, 0x06, 0x68, 0x6D, 0x2F, 0xA6, 0x09, 0xFC,
+    0xE8, 0xF5, 0xD2, 0xBF, 0xFA, 0x83, 0x66, 0x13, 0x8B, 0x36, 0x38, 0xFB, 0x9E, 0x8D, 0x89, 0x4C,
+    0xFF, 0x03, 0x1F, 0x27, 0xF4, 0xFA, 0xCF, 0x48, 0x0B, 0xEA, 0xF9, 0x47, 0x6D, 0x87, 0x53, 0x2D,
+    0xF7, 0xB1, 0x65, 0xD1, 0x2A, 0xF4, 0xB7, 0x1F, 0xB7, 0x03, 0x3F, 0x7A, 0x3B, 0xE9, 0x5F, 0xFD,
+    0xBE, 0x6C, 0xD5, 0x84, 0xA6, 0x46, 0xD4, 0x2A, 0x3E, 0x59, 0xF4, 0x34, 0xA2, 0xA7, 0x66, 0x69,
+    0x83, 0xE8, 0xBA, 0x9E, 0x1C, 0xB1, 0x09, 0xBA, 0x73, 0xC1, 0x4A, 0x85, 0x3F, 0xFC, 0x88, 0xE1,
+    0xEA, 0xD1, 0xB0, 0x01, 0x6E, 0xD8, 0x2B, 0xAD, 0x8C, 0x72, 0xD5, 0x3A, 0x62, 0x16, 0xFC, 0x19,
+    0x1D, 0xA1, 0x5E, 0xCF, 0xCC, 0x23, 0x86, 0xF2, 0xBF, 0x01, 0xB4, 0x83, 0xDA, 0xFD, 0x35, 0x06,
+    0x57, 0x37, 0xB0, 0xB1, 0x6B, 0xBF, 0x71, 0xD7, 0x82, 0x59, 0x86, 0xB2, 0xE2, 0x57, 0x31, 0xD4,
+    0x92, 0xBD, 0xE2, 0xE7, 0x67, 0xEC, 0x2E, 0x6A, 0x8F, 0xFC, 0xB0, 0xFA, 0xF6, 0x62, 0x83, 0x0C,
+    0x6A, 0x76, 0x66, 0xE6, 0xA2, 0x71, 0x87, 0x60, 0xEF, 0x34, 0x26, 0xC9, 0x41, 0x5D, 0x93, 0xE4,
+    0x26, 0xDE, 0xD1, 0x9D, 0x78, 0xE4, 0x5E, 0x45, 0x53, 0x44, 0x64, 0x82, 0x5C, 0x45, 0x5B, 0x4F,
+    0xE4, 0x40, 0x16, 0x87, 0x74, 0xD1, 0x30, 0x90, 0x8A, 0xF7, 0x51, 0xFA, 0xEE, 0xE9, 0xA9, 0x19,
+    0x4C, 0xA1, 0xFA, 0x6A, 0x6A, 0x02, 0xCF, 0x82, 0x54, 0xF5, 0x1D, 0x5C, 0xED, 0xC0, 0x46, 0x49,
+    0xB7, 0xE5, 0xF3, 0xF1, 0x32, 0xE0, 0x41, 0x6A, 0x17, 0xD9, 0x11, 0xCB, 0x61, 0xB8, 0xF2, 0x64,
+    0x6E, 0x95, 0xAA, 0xBD, 0xA7, 0x68, 0x4B, 0x4F, 0xE9, 0xA6, 0x12, 0x30, 0x2B, 0xDC, 0x53, 0x22,
+    0x70, 0xA0, 0x19, 0xEF, 0x4B, 0x2A, 0xB5, 0x91, 0x78, 0xCF, 0xBB, 0xCA, 0xD7, 0x15, 0xEF, 0xA1,
+    0x56, 0x00, 0x7C, 0xBC, 0x03, 0x8D, 0xB6, 0xB8, 0x08, 0x79, 0xFD, 0xDE, 0x96, 0x51, 0xDC, 0xDB,
+    0x92, 0xC6, 0xB5, 0x08, 0x4D, 0x31, 0x6A, 0xEF, 0x6D, 0xD5, 0x76, 0x44, 0xFE, 0x04, 0x03, 0x2F,
+    0x3C, 0x69, 0xA2, 0x09, 0xF4, 0x35, 0x7F, 0xC6, 0x1D, 0x93, 0x2C, 0x44, 0x94, 0x65, 0x4B, 0xDF,
+    0x45, 0x1F, 0x40, 0xE4, 0xD5, 0xFB, 0x41, 0x58, 0x91, 0x27, 0x06, 0x4C, 0x02, 0x61, 0xE7, 0x25,
+    0x66, 0xA5, 0xF8, 0x2D, 0x20, 0x9A, 0x89, 0x99, 0xDC, 0x68, 0x2A, 0x88, 0x12, 0x8F, 0x81, 0x8A,
+    0x2E, 0xD8, 0x26, 0x7A, 0x4F, 0xBE, 0x87, 0x52, 0xD4, 0x52, 0xD1, 0xBA, 0x8C, 0xEB, 0x97, 0xB6,
+    0xA4, 0xDC, 0xEE, 0x93, 0x1B, 0xD1, 0x15, 0xE3, 0x29, 0xF7, 0xA7, 0x73, 0x00, 0xC5, 0x5B, 0xB0,
+    0x66, 0xC5, 0xCD, 0x9B, 0xE8, 0x88, 0xF1, 0x97, 0x5C, 0xC5, 0x3C, 0xF7, 0x53, 0x5F, 0x2A, 0x29,
+    0x7F, 0x7D, 0x7D, 0xF9, 0x13, 0xD8, 0xF3, 0xEF, 0xC4, 0xB4, 0xCC, 0x3B, 0x39, 0xA1, 0x5C, 0x07,
+    0xA3, 0x32, 0x80, 0x0D, 0xDE, 0x5E, 0xDF, 0x80, 0x5D, 0x0C, 0x9D, 0x57, 0x14, 0x91, 0xFB, 0x9C,
+    0xDE, 0x7C, 0xE1, 0x7B, 0x13, 0x4A, 0xA7, 0x70, 0x22, 0x83, 0xC2, 0x85, 0xA0, 0x52, 0xFA, 0xAC,
+    0x44, 0xD0, 0xB8, 0x50, 0x54, 0x70, 0x7F, 0x6A, 0x49, 0x5E, 0x43, 0xDD, 0x5A, 0x54, 0xCA, 0x31,
+    0xE9, 0xDD, 0xB6, 0x14, 0xCF, 0xA0, 0x33, 0x2D, 0xA5, 0x0D, 0xCA, 0x06, 0xC5, 0x5E, 0xCE, 0x9F,
+    0x70, 0x63, 0x1C, 0x94, 0x42, 0xF1, 0x32, 0x04, 0xA2, 0xBA, 0xCD, 0xCF, 0x7F, 0xAC, 0x74, 0xB8,
+    0x7D, 0x56, 0xD0, 0x67, 0x4E, 0x1B, 0x0F, 0xD0, 0x63, 0x4D, 0x67, 0x91, 0x51, 0xE3, 0x5D, 0xAF,
+    0x5F, 0x3F, 0x17, 0x9B, 0x20, 0x47, 0x76, 0x52, 0xE4, 0xBF, 0x5C, 0xBF, 0x7D, 0x83, 0xEE, 0xE2,
+    0x80, 0x37, 0x10, 0x7E, 0xE4, 0x85, 0xC6, 0x6D, 0x96, 0xE6, 0x51, 0xCA, 0x5D, 0x06, 0xA4, 0xD2,
+    0xB8, 0x03, 0xB1, 0x9A, 0x20, 0x18, 0x39, 0x24, 0x41, 0xED, 0xDD, 0x88, 0xAC, 0x89, 0x17, 0x55,
+    0xEE, 0xBC, 0xC4, 0xDE, 0xD3, 0x20, 0xF4, 0xF0, 0x58, 0x57, 0x23, 0xF2, 0x3E, 0xC5, 0x25, 0xC4,
+    0x7C, 0xFB, 0xDC, 0xEC, 0x44, 0x31, 0x11, 0x30, 0x28, 0xC5, 0xA9, 0x1B, 0xB7, 0xCE, 0x43, 0xBC,
+    0x5F, 0xDD, 0x5B, 0x86, 0x0D, 0x9C, 0x37, 0x2F, 0x3D, 0x5F, 0xD6, 0x6A, 0xB1, 0x01, 0xAA, 0xE9,
+    0x6B, 0xEE, 0x1F, 0x55, 0xF0, 0x48, 0xCE, 0xCD, 0x5A, 0xBD, 0xBB, 0x94, 0x90, 0xF1, 0xB3, 0xA6,
+    0x03, 0xC5, 0x19, 0x47, 0x9B, 0x77, 0x1B, 0x71, 0x91, 0x40, 0x44, 0xCF, 0x46, 0xA5, 0x5E, 0xD0,
+    0x5C, 0xEF, 0x64, 0x60, 0xB4, 0xD8, 0x8C, 0x09, 0x42, 0x95, 0x07, 0xB4, 0x16, 0xEA, 0x0A, 0x44,
+    0x31, 0x36, 0xB6, 0x21, 0x16, 0x0D, 0x9D, 0x02, 0x70, 0x85, 0x79, 0xBC, 0x96, 0xF3, 0xD0, 0x71,
+    0xD3, 0xEB, 0xB9, 0x39, 0x0F, 0x56, 0x18, 0x30, 0x62, 0x4E, 0xD0, 0x89, 0x48, 0x4B, 0x3F, 0x7E,
+    0x45, 0x21, 0xE4, 0x64, 0xC2, 0x34, 0x73, 0xEB, 0x74, 0x96, 0x33, 0x1A, 0x2A, 0xC7, 0xA0, 0x90,
+    0xBA, 0xB9, 0x6D, 0x27, 0x15, 0xCB, 0xD7, 0x12, 0xAA, 0x55, 0x34, 0xD1, 0xB1, 0x60, 0x09, 0x37,
+    0xF7, 0x8B, 0xDC, 0xAC, 0x74, 0x34, 0x6B, 0xB7, 0xF6, 0x14, 0x37, 0x46, 0x6F, 0x35, 0x3B, 0x60,
+    0xEB, 0x5D, 0xA0, 0xFC, 0xC2, 0xAC, 0x67, 0x1C, 0x18, 0xA8, 0xB1, 0x45, 0xB1, 0x59, 0x18, 0xE0,
+    0x11, 0x51, 0x2F, 0x12, 0xC3, 0x2A, 0xE5, 0x66, 0xCA, 0xEF, 0xC5, 0xE5, 0xDE, 0x27, 0x91, 0x18,
+    0xC4, 0x9D, 0x22, 0xB9, 0x43, 0x9C, 0xC5, 0xB6, 0x1E, 0x62, 0x00, 0xB0, 0x70, 0x54, 0x26, 0x6A,
+    0x24, 0xC5, 0x2C, 0xB8, 0xCB, 0xAF, 0x1B, 0x6D, 0xDA, 0xA7, 0x13, 0xC7, 0x8E, 0x45, 0x98, 0x4B,
+    0x0E, 0x73, 0x45, 0x4C, 0x12, 0x88, 0x41, 0x14, 0xF7, 0x43, 0x66, 0xE0, 0x51, 0x5D, 0x58, 0xA4,
+    0x30, 0xFE, 0x01, 0x7E, 0x61, 0x58, 0x09, 0xFC, 0xC2, 0x40, 0x35, 0xF8, 0x25, 0x42, 0x59, 0xE0,
+    0xB7, 0x35, 0x75, 0x5C, 0xDB, 0xE7, 0xF3, 0x21, 0xFB, 0x00, 0xA6, 0xDC, 0x1C, 0x90, 0x1D, 0xD2,
+    0x3E, 0x00, 0x0C, 0x6C, 0x4E, 0xD1, 0x4A, 0xD8, 0x6A, 0x8D, 0xDD, 0xFA, 0xEC, 0x54, 0x78, 0x89,
+    0xDD, 0xA1, 0x70, 0x28, 0xF4, 0xB1, 0x93, 0x97, 0x5E, 0x06, 0xD5, 0x1C, 0xD1, 0xD1, 0xCC, 0x13,
+    0x5C, 0xA1, 0x99, 0x88, 0xCE, 0x09, 0xE4, 0x8D, 0x6F, 0x50, 0xCE, 0x1C, 0x47, 0x39, 0x85, 0xB9,
+    0x0C, 0xD9, 0x32, 0x5D, 0xDC, 0xDE, 0x78, 0xC8, 0x05, 0xE1, 0x28, 0x36, 0x5E, 0x25, 0x66, 0xA2,
+    0x91, 0x16, 0x35, 0xF2, 0xC8, 0x1D, 0xD8, 0xEC, 0xD9, 0xE4, 0x66, 0xB9, 0x16, 0x26, 0x0A, 0x8B,
+    0x10, 0x14, 0x43, 0x1D, 0x82, 0x22, 0x50, 0xA3, 0xE8, 0x1F, 0x34, 0xDA, 0x40, 0x91, 0xF2, 0xFC,
+    0xF0, 0x04, 0x87, 0xF0, 0x7B, 0xD7, 0x99, 0x39, 0x21, 0xD5, 0x4B, 0x47, 0xB1, 0x15, 0x15, 0x34,
+    0x3A, 0xD5, 0xFA, 0xFD, 0xF7, 0x92, 0x94, 0x1D, 0x1C, 0xC4, 0x52, 0x55, 0x8D, 0xE8, 0x59, 0x81,
+    0x0F, 0x01, 0x29, 0x53, 0x5A, 0xD5, 0xFB, 0xCD, 0xA5, 0x62, 0x59, 0x73, 0x6C, 0xDB, 0x38, 0x5A,
+    0x6F, 0xDB, 0xBA, 0xA8, 0x75, 0x15, 0x5C, 0x8D, 0x4F, 0x1C, 0x4D, 0x23, 0x69, 0x12, 0xCD, 0x15,
+    0x8C, 0x2E, 0x41, 0x92, 0xFF, 0x90, 0xFF, 0xD0, 0x01, 0x24, 0x40, 0x1F, 0x11, 0xEE, 0x31, 0xC9,
+    0xAB, 0x4D, 0x36, 0x64, 0xE9, 0xDF, 0x47, 0x65, 0x2D, 0xCC, 0xC5, 0xF6, 0x39, 0x95, 0x9F, 0x2B,
+    0xB7, 0x0D, 0x53, 0x85, 0x49, 0x4D, 0x8B, 0x4A, 0xD3, 0x0F, 0x75, 0x71, 0xEC, 0xA4, 0x0C, 0x5D,
+    0x43, 0xFD, 0xA7, 0x38, 0x6D, 0x75, 0xDD, 0x16, 0xD6, 0x0B, 0x1E, 0x5A, 0xCF, 0x55, 0x50, 0xB7,
+    0xF3, 0x79, 0x6D, 0x35, 0xC4, 0x48, 0x73, 0x02, 0x53, 0xC5, 0x15, 0x19, 0x8F, 0x0C, 0x9A, 0x21,
+    0xDA, 0xA4, 0x94, 0x18, 0x23, 0x09, 0x91, 0x21, 0x66, 0xCA, 0xF2, 0xA2, 0xF1, 0x04, 0x51, 0x32,
+    0x65, 0xFD, 0xCD, 0xC4, 0x92, 0xE4, 0xD0, 0x21, 0xB5, 0x39, 0x8B, 0xCD, 0x51, 0x45, 0x08, 0x8E,
+    0x21, 0x62, 0x69, 0xA8, 0x23, 0x72, 0x5E, 0x9D, 0x47, 0xB5, 0x87, 0x86, 0x3A, 0x12, 0xA7, 0x7C,
+    0x47, 0x37, 0x15, 0x0B, 0x41, 0xEE, 0x74, 0x95, 0x7A, 0x21, 0xFC, 0xEC, 0xC7, 0x60, 0x31, 0xF4,
+    0x77, 0x9B, 0xF1, 0x9E, 0x22, 0xBD, 0x04, 0xF1, 0xC5, 0x9E, 0x1B, 0x47, 0xA5, 0x55, 0xC8, 0xD6,
+    0x48, 0xD5, 0x94, 0x1F, 0xB7, 0xC5, 0x5B, 0xE0, 0xE3, 0x97, 0xCE, 0x3D, 0xB7, 0x1B, 0x3D, 0x12,
+    0x86, 0xEC, 0xCF, 0x79, 0x70, 0xF9, 0x5A, 0x8D, 0x34, 0xCC, 0x42, 0xF5, 0xD7, 0xE9, 0xEA, 0xAA,
+    0x0E, 0x17, 0x27, 0x83, 0x7A, 0x07, 0x3B, 0xB7, 0xD0, 0x7E, 0xD0, 0x04, 0x76, 0xB6, 0x59, 0xEF,
+    0x63, 0x79, 0x83, 0xCA, 0xF9, 0xA4, 0x5C, 0x91, 0xAC, 0x74, 0x19, 0xA6, 0x9A, 0xB7, 0x6A, 0x47,
+    0x88, 0x4C, 0x3B, 0xB1, 0xCE, 0x52, 0x16, 0xA5, 0xB4, 0xC8, 0x41, 0xCC, 0xC3, 0x12, 0x01, 0x6E,
+    0x3F, 0xDD, 0xBC, 0xC6, 0x34, 0x2C, 0x86, 0x71, 0x84, 0x4B, 0x3A, 0x1D, 0xFB, 0x15, 0x5B, 0xE8,
+    0xC8, 0x82, 0xF2, 0x10, 0x56, 0x36, 0x04, 0x55, 0xC4, 0x74, 0xA4, 0x12, 0x89, 0x28, 0xA3, 0x8B,
+    0x33, 0xFD, 0x4D, 0x64, 0x2D, 0xCC, 0x12, 0xF5, 0x97, 0x88, 0xE6, 0x28, 0xD3, 0xBA, 0xEA, 0x99,
+    0x98, 0x43, 0x3F, 0x27, 0x7C, 0x28, 0x5C, 0x47, 0x0A, 0x46, 0x78, 0xE2, 0xB3, 0x45, 0xF8, 0xA0,
+    0x8F, 0x8E, 0xA8, 0xE1, 0xAD, 0x58, 0xBA, 0x69, 0x6A, 0x5B, 0xD0, 0xDF, 0x30, 0x6A, 0xBB, 0x61,
+    0x2C, 0xDD, 0x3C, 0x79, 0x97, 0x6E, 0x87, 0x8E, 0x2B, 0xA0, 0xBE, 0x8A, 0xCA, 0x6B, 0x43, 0x1C,
+    0x9D, 0xE0, 0x32, 0x59, 0x8C, 0x91, 0xA7, 0x92, 0x86, 0x0C, 0x91, 0x2B, 0x14, 0x33, 0xB8, 0xA8,
+    0x6D, 0x25, 0x81, 0x9D, 0xEB, 0x94, 0x60, 0xE7, 0x3A, 0x86, 0x3E, 0x48, 0x15, 0xD1, 0xA2, 0xDB,
+    0x1C, 0xF4, 0xF5, 0xF1, 0x74, 0x86, 0x4A, 0x7A, 0x46, 0x55, 0x95, 0x3D, 0xA5, 0x03, 0x0B, 0x65,
+    0x95, 0xB2, 0x03, 0x86, 0x1D, 0x24, 0x57, 0x86, 0x66, 0x21, 0xA7, 0xEF, 0xA8, 0xDF, 0xCA, 0xB8,
+    0x23, 0xA1, 0xE2, 0x6A, 0xD7, 0x74, 0x1D, 0x66, 0xB2, 0xDA, 0x51, 0x79, 0x2D, 0x79, 0x16, 0x22,
+    0xB6, 0x50, 0xA3, 0x84, 0x39, 0xAF, 0xE6, 0x20, 0x82, 0xC4, 0xFC, 0x44, 0x7C, 0xD6, 0x35, 0xDA,
+    0xCB, 0xE8, 0x55, 0x89, 0x53, 0x9A, 0x5C, 0x14, 0xD1, 0xD4, 0x40, 0x1D, 0x2F, 0x25, 0xD3, 0x89,
+    0x42, 0x14, 0xDC, 0x86, 0xD2, 0xB1, 0xA9, 0x8C, 0x6C, 0x2A, 0x3A, 0x6C, 0x1C, 0x19, 0x2F, 0x7F,
+    0x8E, 0x1C, 0xD7, 0x88, 0x5A, 0x6B, 0xD6, 0x1C, 0x05, 0x42, 0xBC, 0x74, 0x4B, 0xC5, 0x24, 0xC9,
+    0x88, 0x88, 0x83, 0x29, 0x4C, 0xA2, 0x4E, 0xC7, 0x65, 0xB6, 0x73, 0xA7, 0x23, 0x42, 0x0E, 0x88,
+    0x92, 0xDF, 0x44, 0x99, 0x40, 0xC9, 0xE9, 0x29, 0x15, 0x12, 0x4C, 0x0A, 0x5C, 0x8C, 0x9F, 0x87,
+    0xF3, 0x12, 0x54, 0xD4, 0x3E, 0xC7, 0xC4, 0x40, 0x8C, 0x61, 0xE4, 0xA5, 0xCE, 0x0B, 0xF9, 0xC9,
+    0xA8, 0xAE, 0x99, 0xEB, 0x83, 0x38, 0xD4, 0xD4, 0x5C, 0xBB, 0x5E, 0xF4, 0xA9, 0x5D, 0x1F, 0xE7,
+    0x3C, 0x77, 0x47, 0xDF, 0xE8, 0x6C, 0x0A, 0x8D, 0x30, 0xD9, 0x2B, 0xF5, 0x86, 0x22, 0xCD, 0x3D,
+    0xA9, 0x46, 0x74, 0xA3, 0x10, 0x33, 0x11, 0x4E, 0xF5, 0x0E, 0x5A, 0x82, 0x3F, 0x3B, 0xE1, 0xB4,
+    0x61, 0x74, 0x16, 0x96, 0xB9, 0x30, 0x4A, 0x95, 0x55, 0x31, 0x80, 0x40, 0x6F, 0x3C, 0x1F, 0xF4,
+    0x98, 0xF1, 0xC3, 0x7F, 0x09, 0x98, 0xFC, 0x10, 0x5E, 0x88, 0x2F, 0x46, 0xAD, 0xBA, 0xEB, 0x0C,
+    0x62, 0x79, 0xD5, 0x9A, 0xE3, 0x98, 0x03, 0x92, 0x1F, 0x4A, 0xF9, 0xA9, 0xD6, 0x48, 0x56, 0x8D,
+    0x66, 0xD2, 0x8C, 0xD6, 0x24, 0x28, 0x9B, 0x68, 0x1C, 0xCC, 0x65, 0xFE, 0xA8, 0x69, 0x16, 0x41,
+    0x28, 0x4C, 0x32, 0xFA, 0x60, 0x54, 0xD5, 0x5A, 0x6B, 0x82, 0xE9, 0x6A, 0x89, 0x0F, 0xED, 0xBA,
+    0x98, 0x16, 0xA6, 0x16, 0x7D, 0x49, 0x86, 0x03, 0xB9, 0xBE, 0xC5, 0x1E, 0x35, 0xC7, 0xA2, 0xB6,
+    0x74, 0x33, 0x2C, 0x27, 0xD1, 0x73, 0xB0, 0x9A, 0xB5, 0x56, 0x05, 0x50, 0x5E, 0xD2, 0x30, 0xDC,
+    0x7C, 0xA8, 0x43, 0xE1, 0xCC, 0x4B, 0x41, 0x1B, 0x4B, 0x57, 0x5F, 0xBA, 0x2A, 0x95, 0x30, 0xAB,
+    0xF0, 0xE8, 0xDC, 0x1A, 0xF2, 0xA8, 0x0B, 0xA8, 0x4C, 0x9B, 0xB2, 0x92, 0xAC, 0xAB, 0x72, 0x57,
+    0x08, 0x43, 0x9F, 0xD6, 0xD1, 0x72, 0x2D, 0x14, 0xAD, 0x0D, 0x6F, 0xCC, 0x8A, 0x05, 0x85, 0x95,
+    0xAE, 0x59, 0x6E, 0xA3, 0x96, 0xEB, 0x32, 0x62, 0x54, 0x3E, 0xCF, 0x44, 0x29, 0x57, 0x57, 0xA6,
+    0xF5, 0x16, 0xED, 0x79, 0x29, 0xCF, 0x3E, 0x94, 0x8C, 0x86, 0x6C, 0xA5, 0xCC, 0x72, 0x2C, 0x1A,
+    0x36, 0x45, 0x25, 0x5F, 0x69, 0xD5, 0x24, 0x29, 0x07, 0xCB, 0x2C, 0x93, 0x54, 0x0A, 0xC3, 0xFC,
+    0xAE, 0x5E, 0xFC, 0xA5, 0x86, 0x35, 0x92, 0x14, 0x0E, 0xBE, 0x2B, 0xF3, 0x9B, 0x26, 0xE1, 0x04,
+    0x91, 0xA3, 0x90, 0x52, 0x9C, 0x34, 0xCB, 0xD4, 0xE9, 0x42, 0x1F, 0x6A, 0x6A, 0xC4, 0x02, 0xF7,
+    0xDC, 0x80, 0xE7, 0x13, 0x31, 0x6A, 0xEB, 0xE5, 0xCE, 0xDA, 0xC9, 0x99, 0x51, 0xA2, 0x13, 0xD3,
+    0x6D, 0x06, 0xC7, 0x4C, 0x6F, 0xAF, 0x6A, 0x75, 0x33, 0x6A, 0x4F, 0xA7, 0xE6, 0x66, 0xF2, 0x42,
+    0x0A, 0x62, 0xAD, 0xA9, 0xE9, 0xE2, 0x68, 0x65, 0x33, 0xEE, 0xB5, 0x29, 0x6E, 0x9D, 0xDA, 0xC3,
+    0x0D, 0x87, 0x12, 0xAC, 0x82, 0xF0, 0xC1, 0x05, 0x15, 0x79, 0xE9, 0x07, 0xE4, 0xAE, 0xDF, 0xB2,
+    0xF9, 0xD8, 0x5C, 0xBA, 0xA1, 0xE6, 0x08, 0x57, 0xA6, 0x8E, 0xF4, 0xF0, 0x6F, 0xFD, 0x7E, 0x4C,
+    0xFF, 0xB6, 0x6A, 0x09, 0xBB, 0x14, 0xD3, 0xA5, 0xE7, 0x09, 0xBD, 0x51, 0xC8, 0xBD, 0x32, 0xFB,
+    0x5F, 0x61, 0x27, 0x88, 0xEE, 0xE7, 0xC7, 0x21, 0x75, 0xA8, 0x18, 0xE3, 0x0B, 0xF0, 0x58, 0x32,
+    0x5E, 0xFC, 0x38, 0x87, 0x05, 0x43, 0xA4, 0x20, 0x43, 0x37, 0xBA, 0xCB, 0xEF, 0xB8, 0xCB, 0x4C,
+    0x8C, 0x44, 0x08, 0x9D, 0x19, 0x57, 0xCC, 0x37, 0xF4, 0x3A, 0x3E, 0xE0, 0x4E, 0xAB, 0xDC, 0x15,
+    0x48, 0xB1, 0x4C, 0xB4, 0x35, 0x90, 0xF2, 0x40, 0xAF, 0xB3, 0x3F, 0x70, 0x54, 0x3A, 0xA3, 0x16,
+    0xCB, 0x60, 0xDA, 0xA0, 0xC6, 0x9B, 0x79, 0x07, 0x4E, 0xA5, 0x43, 0x31, 0x25, 0xCD, 0x08, 0x42,
+    0xE9, 0xB6, 0x42, 0x81, 0xB2, 0x0A, 0xD6, 0x2C, 0x92, 0xF6, 0x1D, 0x9F, 0x79, 0x77, 0xD1, 0x89,
+    0xDE, 0xD4, 0xB1, 0xED, 0x80, 0xB6, 0x51, 0x92, 0x0D, 0x87, 0xE8, 0xF0, 0x5E, 0x8A, 0x05, 0x2A,
+    0x36, 0x60, 0xF2, 0x84, 0x08, 0x80, 0x9F, 0x79, 0xA3, 0x2B, 0x45, 0x0A, 0x2C, 0x04, 0x3D, 0x7D,
+    0x6F, 0xD7, 0xDC, 0x51, 0x49, 0x0E, 0x62, 0x98, 0x01, 0xC7, 0x11, 0x6D, 0x88, 0x5D, 0x04, 0xA5,
+    0x07, 0x0B, 0x3F, 0x75, 0x82, 0x85, 0xEB, 0x84, 0x8D, 0xAD, 0xED, 0xAD, 0x66, 0xC7, 0xE7, 0xB8,
+    0x7F, 0xCD, 0x1B, 0xCD, 0x4C, 0x44, 0x8D, 0x0A, 0x7A, 0x46, 0xF9, 0x1F, 0xCB, 0x3B, 0x1A, 0x14,
+    0x34, 0x3D, 0x93, 0x27, 0x22, 0x5C, 0x67, 0xFE, 0x09, 0x77, 0x42, 0xC4, 0x0E, 0xCE, 0xC8, 0xF7,
+    0x56, 0x01, 0x50, 0x13, 0x56, 0x1C, 0x6E, 0xCE, 0xD0, 0xD3, 0x69, 0x3B, 0xC1, 0x27, 0x3A, 0x5D,
+    0x81, 0x7B, 0xCC, 0x33, 0xCE, 0x28, 0x37, 0xB1, 0xBF, 0x5C, 0x20, 0x99, 0xA3, 0xB6, 0x02, 0x05,
+    0x2B, 0x9B, 0x25, 0xD2, 0xB6, 0x70, 0x84, 0xCD, 0xEC, 0x4C, 0x7D, 0x3E, 0xCE, 0x6D, 0xC4, 0x6C,
+    0x47, 0xE0, 0xCB, 0x77, 0x64, 0xA2, 0x2E, 0xE6, 0x21, 0x46, 0xB5, 0x31, 0xB2, 0x2D, 0xA2, 0xB8,
+    0xA6, 0x70, 0x8C, 0x27, 0x46, 0x76, 0x65, 0xB5, 0xAD, 0x02, 0x58, 0x99, 0x73, 0x22, 0xFF, 0xDA,
+    0x27, 0x16, 0x6D, 0x54, 0x0C, 0x7D, 0x5A, 0x9D, 0x2F, 0x19, 0x1B, 0xF8, 0x1E, 0x52, 0xEE, 0xD9,
+    0x60, 0x39, 0x6A, 0xCB, 0x54, 0xE8, 0x99, 0xF8, 0xB2, 0x80, 0xF3, 0x4F, 0x01, 0xB9, 0xCF, 0x97,
+    0x13, 0xB1, 0x15, 0x2D, 0x4B, 0x6D, 0x05, 0xAC, 0xE3, 0xD8, 0xF7, 0x2C, 0x70, 0x6C, 0x0E, 0x34,
+    0x14, 0xD9, 0x46, 0x9C, 0x90, 0xCE, 0xB3, 0x01, 0xBD, 0x54, 0x4B, 0x3C, 0xDE, 0xD9, 0x01, 0x34,
+    0x5A, 0xC0, 0xA4, 0x5A, 0xC0, 0xD8, 0x50, 0xDE, 0x3A, 0x1C, 0xF8, 0x4F, 0x9C, 0x2F, 0x58, 0xC3,
+    0x34, 0x87, 0xA3, 0xD1, 0xD0, 0xB2, 0x86, 0xB6, 0x3D, 0xE4, 0x7C, 0x38, 0x1E, 0xE3, 0xE9, 0x1F,
+    0xD7, 0x04, 0x9E, 0xC1, 0xA0, 0x4C, 0x73, 0xFE, 0x80, 0xAE, 0x6B, 0x43, 0x15, 0x9D, 0x25, 0x01,
+    0x9F, 0x9C, 0x90, 0x04, 0x6A, 0x2A, 0x1D, 0x73, 0x32, 0x56, 0x12, 0xA4, 0x58, 0x90, 0x42, 0x81,
+    0xF2, 0xC4, 0xC9, 0xB7, 0x74, 0x89, 0x9E, 0x4C, 0xCB, 0xDF, 0x12, 0x09, 0xF5, 0x5B, 0x14, 0xB8,
+    0x9D, 0x41, 0xC3, 0x75, 0xB5, 0x68, 0x48, 0xE0, 0x05, 0x34, 0x6A, 0xEC, 0x04, 0x6E, 0xCB, 0xE1,
+    0xDA, 0x84, 0xFF, 0x62, 0x0A, 0x74, 0x42, 0xDF, 0x99, 0xE1, 0xAE, 0x4D, 0xBC, 0xA1, 0x47, 0xAF,
+    0x75, 0xE0, 0x32, 0x75, 0x34, 0xBD, 0x29, 0x82, 0x14, 0x09, 0x4D, 0xD4, 0x10, 0x33, 0x55, 0x8E,
+    0x9E, 0x6C, 0xA6, 0x42, 0xDB, 0x6B, 0xCD, 0x38, 0x98, 0x21, 0x94, 0x9C, 0xB3, 0xB1, 0xFD, 0xAF,
+    0xE4, 0x1B, 0xF8, 0xC3, 0x36, 0x0C, 0xD8, 0xED, 0x58, 0x72, 0xBA, 0x74, 0x17, 0x7C, 0xDD, 0x69,
+    0x99, 0xDB, 0x81, 0x4E, 0xD9, 0x76, 0x91, 0xDB, 0x4C, 0x64, 0x9B, 0x50, 0xCD, 0x52, 0xA9, 0x56,
+    0x8A, 0x03, 0xAE, 0xC2, 0x80, 0xC5, 0x48, 0x5A, 0xF1, 0xBB, 0x61, 0x9C, 0xF9, 0xE2, 0x36, 0xDD,
+    0x60, 0xE9, 0x67, 0xAF, 0xD5, 0x15, 0x8D, 0x90, 0xE5, 0x11, 0x3B, 0x6A, 0xC1, 0xDC, 0xF8, 0x41,
+    0x19, 0xDF, 0x98, 0x01, 0xAF, 0x61, 0xDD, 0x1A, 0x67, 0x86, 0xB5, 0xFB, 0xDA, 0xC9, 0xE8, 0xA8,
+    0xF2, 0x29, 0x44, 0xB9, 0x14, 0x8C, 0x17, 0x17, 0x97, 0x17, 0x37, 0x17, 0x46, 0xF1, 0x64, 0xCC,
+    0x94, 0xAE, 0x02, 0x0E, 0x86, 0xA0, 0xAF, 0x18, 0x52, 0xCF, 0x6D, 0xDF, 0x00, 0xBB, 0x19, 0x50,
+    0x29, 0x95, 0x4E, 0x6C, 0x1B, 0x77, 0x74, 0x8D, 0xFC, 0xDE, 0x9C, 0x72, 0x5B, 0xA1, 0x62, 0x7B,
+    0x57, 0x6A, 0x49, 0xB8, 0x53, 0xF6, 0xA2, 0x74, 0xEF, 0x58, 0x1D, 0x10, 0x1A, 0x57, 0xD4, 0xEC,
+    0xEA, 0xC9, 0xC1, 0x89, 0xCF, 0xE1, 0x1B, 0xA5, 0x7B, 0xEA, 0xA8, 0x2E, 0x7F, 0xF7, 0xC8, 0xFC,
+    0x08, 0xB9, 0x88, 0x8B, 0x88, 0x15, 0xE9, 0xFE, 0x65, 0xBA, 0x18, 0x28, 0x34, 0x47, 0x4C, 0xDC,
+    0xF3, 0x9E, 0xBE, 0x3E, 0x26, 0xE6, 0x59, 0x0C, 0x70, 0xBC, 0x31, 0x47, 0x0D, 0x7E, 0x17, 0xB6,
+    0xB0, 0x2C, 0xF9, 0x7A, 0x95, 0xAC, 0x9A, 0xE4, 0xDC, 0x53, 0x9B, 0x72, 0xC1, 0xF3, 0x87, 0x73,
+    0x34, 0x73, 0x10, 0x42, 0x23, 0x9D, 0xA1, 0x4F, 0x77, 0x78, 0x23, 0x15, 0x8B, 0x9F, 0x94, 0x8E,
+    0x0F, 0x6F, 0x68, 0x42, 0xF3, 0x93, 0x92, 0x1F, 0x9C, 0x8F, 0x29, 0xBB, 0x4A, 0xCE, 0x53, 0x03,
+    0x43, 0x44, 0x8C, 0x1A, 0x27, 0x17, 0x31, 0xDE, 0x12, 0x14, 0x97, 0xA0, 0x66, 0x5F, 0xA8, 0x6C,
+    0xCD, 0x9E, 0x50, 0xD9, 0x1A, 0xFD, 0xA0, 0x72, 0xEA, 0x5E, 0x88, 0x4B, 0x4C, 0xCA, 0xFB, 0xA1,
+    0xB3, 0xA6, 0xA3, 0x41, 0x2C, 0x78, 0x19, 0x14, 0x94, 0x81, 0x51, 0xEF, 0x48, 0x0F, 0xC2, 0x8D,
+    0x08, 0x7F, 0xCA, 0x55, 0x4A, 0x10, 0x29, 0xAE, 0x24, 0xA2, 0x1D, 0xE1, 0xF7, 0x97, 0x77, 0x25,
+    0x28, 0x0F, 0xDA, 0xE4, 0x83, 0x9A, 0xCA, 0x3A, 0x25, 0x23, 0xE8, 0x63, 0x2D, 0x85, 0x4E, 0xDE,
+    0xD2, 0xB1, 0x5D, 0x13, 0x06, 0x6E, 0x49, 0xC9, 0xC0, 0xC7, 0xD1, 0xBE, 0xB8, 0x54, 0x32, 0x03,
+    0x3A, 0x8F, 0x8B, 0x39, 0x9B, 0xC9, 0x48, 0xFA, 0x3B, 0x9E, 0xE7, 0x5E, 0x4D, 0x29, 0x0B, 0xD1,
+    0x54, 0xF0, 0xBF, 0x13, 0x10, 0x9F, 0x97, 0x77, 0x21, 0x4A, 0x86, 0xAD, 0xEA, 0x03, 0xD6, 0x96,
+    0xDF, 0x0B, 0xF8, 0xEB, 0xAC, 0x5E, 0xCB, 0xF5, 0x02, 0xAE, 0xAB, 0x54, 0x8E, 0x8A, 0xCC, 0x76,
+    0xA9, 0xC2, 0x24, 0x17, 0xE7, 0xB7, 0x16, 0x58, 0xCA, 0xB0, 0xAC, 0x09, 0x62, 0xF0, 0x43, 0xFC,
+    0x5A, 0xBB, 0x73, 0x78, 0xF7, 0x8E, 0xB2, 0x42, 0x05, 0x9B, 0x88, 0x9C, 0xB8, 0x3A, 0x12, 0x8B,
+    0xCF, 0xEB, 0x51, 0x58, 0x53, 0x47, 0x23, 0x20, 0xCF, 0xBD, 0xC5, 0x43, 0x74, 0x68, 0x50, 0x30,
+    0x19, 0x28, 0xBC, 0x67, 0x57, 0xDB, 0x32, 0x41, 0xB0, 0x48, 0xDE, 0x00, 0x0C, 0xF5, 0x89, 0x2F,
+    0xC2, 0xE4, 0x8A, 0x00, 0x34, 0x17, 0xC5, 0x42, 0x48, 0xC7, 0x2A, 0x41, 0xCA, 0x87, 0x66, 0x90,
+    0xCB, 0x3C, 0x76, 0xF9, 0xEA, 0x2F, 0x17, 0xB7, 0x57, 0x6F, 0x2F, 0x2F, 0x6F, 0x5F, 0x5F, 0x33,
+    0x0A, 0x3B, 0x4E, 0x1D, 0x79, 0x11, 0x45, 0xCE, 0xDE, 0xDF, 0xFC, 0x74, 0xFB, 0xE6, 0xEC, 0xF5,
+    0x05, 0x16, 0xF8, 0x60, 0xBC, 0x85, 0x1E, 0xA3, 0xD2, 0xF9, 0xF3, 0xC5, 0x15, 0xFD, 0xB9, 0x3A,
+    0x93, 0x7F, 0xFA, 0xF2, 0xEF, 0x76, 0xEA, 0xB9, 0xDF, 0xBE, 0xA0, 0x80, 0x3E, 0x7C, 0xDE, 0x89,
+    0xDE, 0x6D, 0xC7, 0x3F, 0xCE, 0xAE, 0x5E, 0x19, 0xAD, 0xD2, 0xFC, 0x15, 0xC6, 0xDB, 0x9F, 0x2F,
+    0xA2, 0xFA, 0x04, 0xEB, 0x63, 0x1E, 0x3D, 0xCC, 0x94, 0x4C, 0xAE, 0x83, 0x91, 0xE7, 0x81, 0xD9,
+    0x0F, 0x36, 0xAC, 0x0C, 0x79, 0xA6, 0x67, 0x73, 0x01, 0xCB, 0x34, 0x46, 0xDA, 0xBC, 0x36, 0x17,
+    0xB8, 0x10, 0x45, 0x29, 0x95, 0x33, 0x2F, 0xA5, 0x11, 0x21, 0x7C, 0x06, 0x2D, 0x36, 0xA1, 0x3A,
+    0xF4, 0x88, 0xFE, 0x0A, 0x3F, 0xF1, 0x25, 0x14, 0x17, 0x22, 0x5C, 0xEE, 0x1F, 0x90, 0xA5, 0x6E,
+    0x70, 0x08, 0x1A, 0x34, 0x10, 0x2D, 0x4A, 0xAB, 0x81, 0xA3, 0xF1, 0xA0, 0x0A, 0x4D, 0xF9, 0x1D,
+    0x7E, 0x55, 0xDB, 0x05, 0x0D, 0xFC, 0x24, 0xC5, 0xA9, 0x8D, 0x8B, 0xF4, 0x87, 0x8F, 0xCD, 0xC4,
+    0xED, 0xF7, 0x89, 0x9C, 0x5B, 0xD4, 0x44, 0x47, 0x2C, 0xD9, 0xF0, 0xAA, 0x70, 0x92, 0x13, 0x00,
+    0x88, 0x9C, 0x7D, 0x76, 0x52, 0x13, 0xAC, 0xDB, 0x54, 0x5D, 0x3C, 0x04, 0x0A, 0x6F, 0x3E, 0x00,
+    0x7E, 0x1F, 0x5B, 0x0C, 0xBF, 0xD5, 0xD2, 0x13, 0x31, 0x1F, 0xB9, 0x98, 0x3C, 0xB9, 0x4E, 0x6D,
+    0x9C, 0xD4, 0x85, 0xF8, 0xF2, 0x87, 0xC0, 0x99, 0x5B, 0x42, 0x8B, 0xC7, 0xA1, 0x8C, 0x02, 0xD6,
+    0x29, 0xCA, 0x10, 0x87, 0x34, 0xF9, 0x82, 0xBF, 0x4A, 0x33, 0xEE, 0xF0, 0xFA, 0x8A, 0x91, 0xC8,
+    0xC0, 0x81, 0x87, 0xA8, 0xA0, 0x28, 0x0F, 0x75, 0xFE, 0x45, 0x6A, 0x17, 0x78, 0xA8, 0x43, 0x39,
+    0xE8, 0x75, 0x31, 0x65, 0x54, 0x2A, 0xBE, 0xA2, 0xBB, 0xBA, 0x68, 0x74, 0x85, 0xDC, 0x89, 0x22,
+    0x99, 0x45, 0xA6, 0x20, 0x70, 0xA2, 0xB6, 0x50, 0x31, 0x90, 0x2D, 0xC7, 0x8B, 0x11, 0xEE, 0x2D,
+    0x79, 0x5A, 0x8C, 0x1E, 0x0D, 0x32, 0xB4, 0x54, 0xAE, 0x5B, 0x55, 0xED, 0xA8, 0x4F, 0x11, 0x88,
+    0xE4, 0xB7, 0x31, 0x33, 0x2D, 0xA3, 0x94, 0xAE, 0xB2, 0x93, 0xCD, 0x7C, 0x97, 0x33, 0x5F, 0xCB,
+    0x00, 0x40, 0xE7, 0x9B, 0x69, 0x32, 0xC4, 0x6F, 0x15, 0x49, 0x7D, 0x22, 0xF6, 0x88, 0x8B, 0xE1,
+    0x0F, 0x4D, 0xB9, 0x88, 0xC1, 0xA2, 0xA2, 0xF2, 0xB7, 0x2A, 0xA4, 0x06, 0x9D, 0x80, 0xEA, 0x05,
+    0xA6, 0x2A, 0xC0, 0x4E, 0xBB, 0x69, 0x90, 0x4E, 0xF3, 0x9F, 0x8F, 0xBB, 0x36, 0x28, 0x0A, 0x3F,
+    0x3A, 0x10, 0x40, 0x26, 0x0B, 0xC2, 0x5F, 0x2B, 0x36, 0xCE, 0x71, 0xDD, 0x77, 0xDE, 0x2A, 0x68,
+    0x50, 0xBE, 0x78, 0x9A, 0xDD, 0x30, 0x5A, 0x16, 0x77, 0xDD, 0x42, 0x98, 0x1C, 0x95, 0xC8, 0x63,
+    0x90, 0x0F, 0x64, 0x83, 0xEA, 0x1D, 0x8C, 0xF5, 0x6D, 0xE0, 0x91, 0xCD, 0x51, 0x53, 0xE4, 0x3F,
+    0xF1, 0x81, 0x87, 0x58, 0x1B, 0xCD, 0x4C, 0x78, 0x68, 0x16, 0xC5, 0x8C, 0x4E, 0x18, 0x84, 0x65,
+    0x61, 0x13, 0xA1, 0x32, 0x9C, 0x85, 0x30, 0x27, 0xC0, 0xA9, 0xD3, 0x94, 0x18, 0xEB, 0xAE, 0x69,
+    0x28, 0xD5, 0x98, 0x5D, 0xD6, 0x98, 0xAD, 0xDB, 0x03, 0x0D, 0xED, 0x1C, 0x49, 0x14, 0x91, 0xF5,
+    0x89, 0xE0, 0xCB, 0x58, 0xE7, 0xA1, 0xAD, 0xDA, 0x5E, 0x50, 0xBC, 0x0B, 0x0B, 0x86, 0x7D, 0xE8,
+    0xAF, 0xE9, 0xA1, 0x4F, 0xF3, 0xA6, 0xDA, 0x44, 0x07, 0xD4, 0xD3, 0x33, 0xAF, 0xDE, 0xD9, 0x80,
+    0x52, 0xF6, 0x8C, 0x85, 0x21, 0xE5, 0xA9, 0xC2, 0xBD, 0xC4, 0xB3, 0x2B, 0x14, 0x05, 0x91, 0x7C,
+    0x8E, 0x25, 0xA0, 0xF8, 0x5E, 0xE8, 0xB6, 0x11, 0xAF, 0xBE, 0x58, 0xA5, 0x61, 0x61, 0xFA, 0xAC,
+    0xA3, 0xF8, 0xCE, 0x4E, 0xDA, 0x94, 0xEC, 0x8C, 0xE9, 0xAE, 0x84, 0x5B, 0x3C, 0x39, 0x0A, 0xAD,
+    0x62, 0x23, 0xDB, 0x99, 0x0F, 0x01, 0x17, 0x6F, 0x99, 0xF8, 0xDD, 0x92, 0xD5, 0xD0, 0x6A, 0x0C,
+    0xA6, 0xE6, 0x27, 0x0C, 0xEF, 0x54, 0xB4, 0x9B, 0x7C, 0x16, 0x15, 0x52, 0xD1, 0x46, 0x56, 0x27,
+    0xB0, 0x6F, 0x29, 0x4E, 0x33, 0x6A, 0x54, 0x04, 0x65, 0x82, 0x29, 0x7A, 0xFD, 0x42, 0xA6, 0xEF,
+    0x52, 0x79, 0x8F, 0x26, 0x11, 0x41, 0x0A, 0x02, 0xA9, 0x9C, 0xB6, 0x78, 0x5B, 0x47, 0x9E, 0xB0,
+    0xBF, 0x9B, 0x20, 0x29, 0xB0, 0xB1, 0x49, 0x47, 0x5C, 0xE4, 0x5D, 0x4C, 0xD5, 0x6C, 0xFC, 0x78,
+    0x75, 0x4D, 0xB8, 0x4F, 0x3A, 0xAE, 0x19, 0xC6, 0x21, 0xA4, 0x7B, 0x84, 0x6D, 0x2B, 0xFA, 0xE2,
+    0xCD, 0x73, 0x5F, 0xC4, 0xAE, 0xF0, 0xA4, 0x13, 0x98, 0x61, 0x70, 0xEB, 0xCC, 0x6F, 0x97, 0x81,
+    0x18, 0x39, 0xFC, 0xDD, 0x62, 0x3F, 0xBD, 0x78, 0x7B, 0x25, 0xAB, 0x4E, 0x6D, 0x6F, 0x21, 0x36,
+    0x80, 0xD9, 0x50, 0xD9, 0xF8, 0x10, 0x13, 0x83, 0x8D, 0x9D, 0xFB, 0x3C, 0x44, 0xCA, 0x06, 0x11,
+    0x81, 0xC4, 0x6C, 0x17, 0xF8, 0x22, 0xBF, 0x8D, 0x1C, 0x8B, 0xA5, 0x72, 0xE2, 0xE0, 0xFD, 0x1E,
+    0xA0, 0x8F, 0x7D, 0xE8, 0x74, 0x3A, 0x31, 0xB3, 0xD1, 0xFC, 0x03, 0x9B, 0xE1, 0x63, 0x51, 0x51,
+    0x6C, 0x98, 0x0B, 0x12, 0x03, 0x1F, 0xCC, 0x45, 0x87, 0xBC, 0xAE, 0xE8, 0xD6, 0x68, 0x4C, 0x1D,
+    0xDB, 0x86, 0x51, 0x34, 0x50, 0xF9, 0xEB, 0xD0, 0x72, 0x47, 0x4F, 0xA8, 0x14, 0xCD, 0xB9, 0x4B,
+    0xCF, 0x28, 0xB7, 0x5A, 0x29, 0xC5, 0x16, 0x01, 0xA0, 0x8B, 0xF5, 0x23, 0x42, 0x88, 0x9E, 0x9B,
+    0x1B, 0x75, 0x21, 0x66, 0xF1, 0x74, 0x3F, 0xE2, 0x99, 0x51, 0xD6, 0x19, 0x28, 0x24, 0x7A, 0x13,
+    0xA0, 0xA3, 0xC6, 0xB4, 0x68, 0xD1, 0x8D, 0x3A, 0x80, 0x8F, 0x71, 0x0F, 0xF0, 0x87, 0xE8, 0x02,
+    0x3E, 0x89, 0x99, 0xF0, 0xB1, 0x42, 0x60, 0xA4, 0x8C, 0x25, 0x85, 0x4E, 0x4A, 0x58, 0x92, 0xB2,
+    0xAB, 0x56, 0x4C, 0x13, 0xDD, 0x2F, 0xB7, 0x2D, 0x14, 0xD7, 0xC3, 0xE5, 0x94, 0x87, 0x94, 0xF6,
+    0x18, 0x3A, 0xD9, 0x88, 0x2A, 0xB4, 0x32, 0x16, 0x46, 0x25, 0x8E, 0x91, 0x79, 0x96, 0x17, 0x69,
+    0xA8, 0x52, 0xC5, 0xB0, 0x53, 0xC8, 0x96, 0x60, 0x93, 0xD5, 0x9A, 0x72, 0x19, 0xB8, 0xC4, 0x9D,
+    0x28, 0x33, 0x47, 0xE4, 0x4F, 0xCC, 0xEC, 0x30, 0xE0, 0xA1, 0x1E, 0x93, 0x4D, 0x61, 0xDD, 0xF1,
+    0x92, 0x13, 0x6F, 0xE2, 0x82, 0x10, 0x86, 0x82, 0x4D, 0x66, 0x79, 0x11, 0x54, 0x47, 0xA3, 0xEC,
+    0xDD, 0x8F, 0xCF, 0x07, 0x7B, 0x03, 0x20, 0x9B, 0x15, 0x82, 0xDA, 0x8D, 0xC9, 0x34, 0x9D, 0x79,
+    0xBA, 0x31, 0x3C, 0x2C, 0x2F, 0xEB, 0xA3, 0xFF, 0xD1, 0x02, 0xC9, 0xE7, 0xF9, 0x7C, 0x5B, 0xBC,
+    0xBA, 0xA5, 0x57, 0x9D, 0x69, 0xF3, 0x08, 0x24, 0xCE, 0xD2, 0x9A, 0x8A, 0xE3, 0xF2, 0xF2, 0xA4,
+    0x5F, 0xC0, 0x26, 0x9E, 0x4C, 0xD3, 0x85, 0x38, 0xA0, 0x3D, 0xBA, 0x32, 0x1F, 0xF2, 0xB9, 0xA3,
+    0xCF, 0xDF, 0x5D, 0x5C, 0xBC, 0xB9, 0x7D, 0xFE, 0xFE, 0xE6, 0xE6, 0xED, 0x9B, 0xDB, 0x3F, 0x5F,
+    0xFC, 0xED, 0x9A, 0xAC, 0xA1, 0x33, 0xE8, 0xDA, 0x0A, 0xEF, 0x1E, 0x21, 0x33, 0x88, 0xAE, 0x77,
+    0x1A, 0xB2, 0x1E, 0x0A, 0x0A, 0x83, 0xFE, 0xD2, 0xF7, 0xF7, 0x8B, 0x21, 0xEB, 0xCB, 0x67, 0xBA,
+    0x24, 0x63, 0xC8, 0x76, 0xE4, 0x4F, 0x8C, 0x00, 0x1C, 0xB2, 0xDD, 0xF4, 0x0E, 0xAA, 0x54, 0xB4,
+    0x45, 0x57, 0xB0, 0x8D, 0xC0, 0xC3, 0x1B, 0x6F, 0x23, 0x5B, 0x49, 0x50, 0x84, 0x9A, 0x23, 0x79,
+    0x4A, 0x4F, 0x29, 0x03, 0xAA, 0x45, 0xE4, 0x2B, 0x33, 0xA6, 0xD2, 0xC6, 0xB4, 0x82, 0x49, 0x45,
+    0xCB, 0x1D, 0xD1, 0x6A, 0xD9, 0xC6, 0x4A, 0x74, 0x8E, 0xB6, 0x24, 0xA8, 0x3C, 0x73, 0x31, 0x4D,
+    0x21, 0xA2, 0x9C, 0x52, 0xD0, 0x15, 0x92, 0xD6, 0x89, 0xF3, 0x99, 0x74, 0x38, 0xD6, 0x50, 0x26,
+    0x91, 0x09, 0xE4, 0x01, 0xED, 0x9F, 0xF9, 0xE8, 0x9A, 0x90, 0x6C, 0x34, 0x5C, 0x4F, 0xF8, 0x82,
+    0x3B, 0x0B, 0xDF, 0x0B, 0x3D, 0xCB, 0x73, 0x85, 0x47, 0x81, 0x72, 0xB8, 0x0D, 0x0D, 0x14, 0xFB,
+    0xAB, 0x20, 0x18, 0x6E, 0x6F, 0xD3, 0x4A, 0xB3, 0xA2, 0x27, 0x94, 0xDB, 0x71, 0x35, 0xBC, 0x74,
+    0x82, 0x56, 0xC1, 0x55, 0xB0, 0x6D, 0x3B, 0xC1, 0xC2, 0x35, 0x1F, 0xF2, 0xE8, 0x82, 0x86, 0x36,
+    0x72, 0xE6, 0xA6, 0xFF, 0x70, 0x43, 0xF1, 0xAC, 0xCC, 0xA0, 0x03, 0xEC, 0xE2, 0x84, 0xBB, 0x51,
+    0x28, 0xEA, 0xCD, 0x93, 0x7C, 0xBB, 0xA5, 0xE7, 0xBD, 0x65, 0xC4, 0x52, 0x30, 0x29, 0x66, 0x20,
+    0x12, 0x27, 0x0F, 0x15, 0x79, 0x84, 0x88, 0x7A, 0x62, 0x94, 0xE4, 0x59, 0x8B, 0x13, 0x84, 0x10,
+    0x79, 0x15, 0x95, 0xCA, 0x3E, 0x7C, 0xFF, 0xD0, 0xFD, 0x28, 0x02, 0xE4, 0xF1, 0x7C, 0x58, 0x52,
+    0x9E, 0x9D, 0x9E, 0xB0, 0x41, 0xC9, 0x29, 0x68, 0x3F, 0x94, 0xCC, 0x82, 0x20, 0x7A, 0x20, 0xBB,
+    0xB1, 0xEE, 0x87, 0xFE, 0x47, 0x4C, 0xC1, 0x73, 0xD0, 0xA2, 0x1F, 0x3B, 0xD1, 0xDB, 0x5D, 0xF1,
+    0x76, 0xED, 0xE3, 0xC9, 0xA2, 0x33, 0x82, 0xB5, 0x9F, 0x3D, 0xD3, 0x84, 0xCD, 0xF9, 0xE6, 0x4A,
+    0x60, 0x42, 0x3B, 0x78, 0x88, 0x4E, 0x73, 0xCD, 0xE3, 0xC4, 0x34, 0x30, 0xE4, 0x18, 0x2A, 0x39,
+    0x4D, 0x5C, 0x98, 0x03, 0xEC, 0x77, 0x40, 0xB4, 0x55, 0xA0, 0x9E, 0x0A, 0x29, 0xF4, 0x65, 0x69,
+    0x9D, 0x25, 0x99, 0x95, 0xAE, 0xB2, 0x8E, 0x4A, 0xBE, 0xEA, 0x27, 0x47, 0xFA, 0xCE, 0xBC, 0x0E,
+    0x7B, 0x8E, 0xD9, 0x45, 0x03, 0x92, 0x9E, 0xDE, 0x12, 0x37, 0xDA, 0xA4, 0xCC, 0x98, 0x9A, 0x77,
+    0x1C, 0xB5, 0x08, 0x21, 0x77, 0x65, 0xF2, 0xC2, 0x95, 0x47, 0x1A, 0x03, 0x85, 0x90, 0x60, 0x84,
+    0x1C, 0xEE, 0xCC, 0xF9, 0xD2, 0x89, 0x5A, 0xC8, 0x6B, 0x99, 0x23, 0x5B, 0xBE, 0x7F, 0xAB, 0xA0,
+    0x7C, 0x81, 0xC9, 0xB8, 0xDE, 0x94, 0x6A, 0x33, 0xCD, 0xE1, 0x0C, 0xD8, 0xF2, 0x16, 0x8B, 0x14,
+    0xAD, 0x4D, 0x4D, 0x4A, 0x8F, 0x08, 0x83, 0xB7, 0x42, 0x97, 0x81, 0x17, 0x54, 0x6E, 0xA2, 0xA7,
+    0x39, 0x9E, 0x2E, 0xBE, 0x6A, 0xC9, 0x3B, 0xAF, 0x34, 0x06, 0x80, 0xB8, 0x4B, 0xAB, 0x5A, 0x08,
+    0xCA, 0xCB, 0xB4, 0xF2, 0x5A, 0x2E, 0xBD, 0xED, 0x50, 0x43, 0x48, 0x59, 0xFC, 0xAB, 0x2C, 0x21,
+    0x70, 0xA0, 0x53, 0xC3, 0xF8, 0xA0, 0x12, 0x8C, 0x56, 0x78, 0x8F, 0x9B, 0x84, 0xA2, 0x3C, 0x6E,
+    0x0F, 0x21, 0xE3, 0xDC, 0x83, 0x19, 0xD6, 0x2F, 0x98, 0x61, 0x50, 0x14, 0x53, 0xA8, 0xB8, 0xD7,
+    0x18, 0x08, 0x85, 0x9C, 0xF5, 0x7B, 0x91, 0xFE, 0xCB, 0x50, 0x17, 0x7B, 0x07, 0x1C, 0x87, 0x61,
+    0x2B, 0xF0, 0xDF, 0x2C, 0x49, 0xD4, 0xA3, 0x86, 0x76, 0x89, 0xEC, 0x0B, 0x0A, 0xD5, 0x7B, 0xD4,
+    0x64, 0x55, 0x68, 0x67, 0xA6, 0x3D, 0xED, 0x92, 0x7C, 0xA7, 0x15, 0x71, 0x85, 0xAF, 0xB5, 0x19,
+    0x20, 0xFD, 0x29, 0xA7, 0x3E, 0xE9, 0x44, 0x40, 0xDD, 0x05, 0x2D, 0x37, 0x3F, 0xD3, 0xFD, 0x8F,
+    0xCD, 0x85, 0x6C, 0x27, 0xD5, 0x19, 0x8A, 0x23, 0x3B, 0x6B, 0x5B, 0x1A, 0x4E, 0x8D, 0x4C, 0xD7,
+    0xB5, 0xC7, 0xE1, 0xB6, 0x03, 0x43, 0x2B, 0x8C, 0x74, 0x44, 0xAD, 0x26, 0xEC, 0xE7, 0x16, 0x26,
+    0x00, 0xE9, 0x56, 0x4C, 0x13, 0x95, 0x34, 0x56, 0x4F, 0x10, 0xE2, 0xCA, 0xBA, 0xB3, 0xA3, 0x82,
+    0x6F, 0x71, 0x3F, 0x6D, 0xE1, 0x29, 0x90, 0x16, 0x5B, 0x3A, 0x0D, 0xFC, 0xF6, 0x8C, 0xF5, 0x76,
+    0xD8, 0x71, 0x7A, 0x45, 0x94, 0xEB, 0xDD, 0x07, 0xF8, 0x2A, 0x56, 0xC0, 0x9E, 0x7E, 0xF7, 0x17,
+    0x91, 0x95, 0x65, 0x11, 0x52, 0xB4, 0xB0, 0x89, 0x9F, 0xF1, 0xA2, 0xF7, 0x90, 0x29, 0xB5, 0x93,
+    0x2D, 0x25, 0x17, 0x41, 0x9D, 0x0B, 0x75, 0x95, 0xA9, 0x3B, 0xC8, 0xD6, 0xDD, 0x8B, 0x5A, 0x98,
+    0x66, 0x4A, 0xED, 0x67, 0x4B, 0x1D, 0x94, 0xB7, 0xE0, 0x92, 0xE2, 0xD8, 0x48, 0xCA, 0x1F, 0x66,
+    0xAB, 0xF7, 0xBA, 0xA2, 0x7E, 0xF6, 0x65, 0x8F, 0x5E, 0xF6, 0xF6, 0xB2, 0x6F, 0x45, 0x97, 0xF1,
+    0x8C, 0xA6, 0x26, 0x51, 0x17, 0x95, 0x03, 0x92, 0xEE, 0xE8, 0xB0, 0x89, 0x13, 0x45, 0x71, 0x54,
+    0xC2, 0x05, 0xCF, 0x90, 0x40, 0xC1, 0x01, 0x0A, 0x96, 0x23, 0xD2, 0xA3, 0x70, 0xE4, 0x5A, 0x02,
+    0x16, 0xA2, 0x0F, 0x56, 0xDD, 0x0A, 0x68, 0xA0, 0xF1, 0x7C, 0xEA, 0x33, 0x33, 0x29, 0xCE, 0xC5,
+    0x3E, 0x37, 0xED, 0x68, 0x61, 0x8C, 0x6D, 0x07, 0x98, 0x9A, 0xF7, 0x30, 0x88, 0xDA, 0x46, 0x74,
+    0x27, 0xFD, 0xD4, 0x0E, 0x61, 0x94, 0x92, 0x8B, 0x65, 0x48, 0x37, 0xAA, 0xD1, 0x26, 0x26, 0xA1,
+    0x27, 0x9A, 0x68, 0x6A, 0x09, 0x06, 0xBD, 0xAC, 0xB7, 0x2B, 0x25, 0xAF, 0x94, 0x04, 0x13, 0x28,
+    0x6D, 0xCB, 0xDC, 0x0A, 0x72, 0xE2, 0xBE, 0x0A, 0xDD, 0x49, 0x02, 0xE6, 0xD1, 0x99, 0x62, 0x96,
+    0xE6, 0x69, 0x8E, 0xDA, 0xA4, 0xEC, 0xB6, 0x2A, 0x8D, 0xB0, 0xD4, 0x0F, 0xC1, 0x3C, 0x8F, 0xCF,
+    0x52, 0x6A, 0xF3, 0x41, 0x67, 0x47, 0x17, 0x75, 0xD7, 0x84, 0x02, 0x0A, 0xBA, 0x8A, 0xE2, 0x1E,
+    0xDD, 0x57, 0x23, 0x32, 0x11, 0x21, 0x2E, 0x4A, 0x90, 0x14, 0x1C, 0x99, 0xA8, 0xC3, 0xBD, 0x3D,
+    0x4D, 0xA6, 0x48, 0x92, 0x06, 0x3E, 0xBF, 0x43, 0x71, 0xD0, 0x8A, 0xE4, 0x42, 0x8B, 0x79, 0x8A,
+    0xC5, 0x42, 0xA4, 0xFA, 0xA4, 0xC6, 0x1B, 0x8B, 0xF2, 0x60, 0x6E, 0x5C, 0x24, 0x16, 0x98, 0x6C,
+    0x12, 0xA6, 0x44, 0x8B, 0x1C, 0x50, 0x0D, 0xF1, 0x13, 0x94, 0xE4, 0xEF, 0xD9, 0xDE, 0x0E, 0xE5,
+    0xA7, 0xC6, 0x12, 0xDF, 0xB3, 0x9D, 0x5E, 0x71, 0x78, 0xA1, 0x87, 0x1F, 0xBC, 0x67, 0xCF, 0x30,
+    0xF3, 0x9C, 0x8F, 0x53, 0x67, 0x07, 0xE6, 0x93, 0x8F, 0xD5, 0xFB, 0xA5, 0x65, 0x27, 0x34, 0xCD,
+    0xA0, 0xEC, 0x04, 0xCB, 0xEE, 0x96, 0x96, 0x1D, 0x45, 0x70, 0x47, 0xD5, 0x70, 0xFB, 0x83, 0x41,
+    0xA9, 0x6E, 0x27, 0x4F, 0x75, 0xFA, 0xDE, 0xEC, 0x0A, 0xF4, 0x1E, 0x4A, 0x4F, 0xE5, 0x53, 0x62,
+    0x3D, 0xE1, 0x85, 0x6E, 0xF8, 0xD4, 0xCD, 0x26, 0x89, 0x86, 0x1E, 0xA6, 0xDE, 0x9C, 0x10, 0x11,
+    0xE8, 0xC5, 0x00, 0x7F, 0x8F, 0x44, 0x01, 0x4D, 0xF0, 0xC3, 0x83, 0x08, 0x7E, 0x78, 0x60, 0xC7,
+    0x6C, 0x0A, 0x7F, 0xD4, 0xE1, 0x0E, 0x58, 0xF0, 0x5E, 0xBD, 0x54, 0x49, 0xB9, 0x8E, 0x61, 0xEB,
+    0x2B, 0xDD, 0x84, 0x47, 0xCE, 0xC5, 0xC1, 0x3F, 0x95, 0xE9, 0x0F, 0xA2, 0x4B, 0x89, 0xB4, 0x9C,
+    0x9B, 0x63, 0xC9, 0x85, 0xCC, 0x9B, 0x80, 0x22, 0x0F, 0x88, 0xA6, 0xD9, 0x28, 0x42, 0x5E, 0x83,
+    0x19, 0xED, 0x2F, 0xE7, 0x6A, 0x4C, 0x23, 0x4C, 0x00, 0xDC, 0x31, 0x26, 0x02, 0xEE, 0x96, 0x1D,
+    0x4E, 0x5B, 0x60, 0x77, 0x89, 0xCF, 0x3F, 0x78, 0x0B, 0x4D, 0x8B, 0xD2, 0x62, 0x4A, 0xC1, 0x3C,
+    0xA8, 0x86, 0x19, 0x0F, 0x64, 0xA3, 0x41, 0x33, 0x83, 0xB8, 0x58, 0x24, 0x80, 0x04, 0x20, 0xC8,
+    0x59, 0xC8, 0xC4, 0x30, 0x7C, 0x6D, 0xF4, 0x48, 0x24, 0x85, 0x24, 0x6F, 0xA7, 0x4B, 0xF6, 0x53,
+    0x25, 0x4B, 0x37, 0x8F, 0x05, 0x10, 0xC1, 0x26, 0xCF, 0x08, 0xD9, 0xA8, 0x5E, 0xB3, 0x6E, 0xCF,
+    0xCE, 0x4B, 0x7B, 0x26, 0x68, 0x2E, 0x00, 0x0B, 0x1C, 0x7B, 0x75, 0x01, 0x5F, 0x94, 0x02, 0xDE,
+    0x98, 0x73, 0x52, 0x07, 0xD7, 0x26, 0x31, 0x6A, 0xD8, 0x7F, 0x4C, 0x63, 0x0A, 0x4C, 0x32, 0xAA,
+    0xC3, 0x52, 0xD5, 0x83, 0x06, 0xC0, 0x31, 0xB7, 0xE8, 0x48, 0x0E, 0x1C, 0x25, 0xF1, 0x55, 0x8E,
+    0x99, 0x3D, 0x59, 0x67, 0x88, 0x62, 0xB0, 0xDF, 0xB3, 0xDE, 0x80, 0xC0, 0xD6, 0x1A, 0x28, 0x5A,
+    0x10, 0xEE, 0x5F, 0x5E, 0xE0, 0xF2, 0x90, 0xFC, 0x7C, 0x59, 0x87, 0xC0, 0xA0, 0x3A, 0xB1, 0xD3,
+    0x8D, 0x69, 0x7C, 0x97, 0xA2, 0x26, 0x6A, 0x32, 0xD1, 0xB3, 0x50, 0xD0, 0xD4, 0x9A, 0x50, 0x6E,
+    0xB5, 0xED, 0x1F, 0x95, 0xE2, 0x98, 0xE9, 0x0E, 0x8D, 0xC9, 0xDD, 0x91, 0xE8, 0xBB, 0xE0, 0xBD,
+    0xBB, 0x4A, 0x9E, 0x2B, 0xCB, 0x9A, 0x52, 0xD1, 0xD1, 0xCF, 0x5A, 0x59, 0x02, 0x8D, 0x57, 0x51,
+    0x17, 0xF1, 0x3B, 0x05, 0x9D, 0xB2, 0xCD, 0xEE, 0x6B, 0xD2, 0x54, 0x15, 0x98, 0x06, 0x50, 0x64,
+    0x30, 0x1A, 0xAC, 0x91, 0xC4, 0x2C, 0x25, 0xA7, 0x40, 0xEF, 0x91, 0xA0, 0x58, 0xA3, 0x6C, 0xD8,
+    0x42, 0x67, 0xAE, 0xDB, 0xCF, 0xD3, 0xF4, 0x97, 0xA4, 0x61, 0xA3, 0x11, 0x2D, 0xBD, 0x98, 0x5F,
+    0x7B, 0x87, 0xC4, 0x51, 0x66, 0xF5, 0xC5, 0xD7, 0x03, 0x7C, 0x2D, 0x17, 0x60, 0xFC, 0xBD, 0x2F,
+    0x3E, 0x7D, 0xA4, 0x65, 0x59, 0xDD, 0xA6, 0x54, 0x13, 0xB4, 0x9F, 0xB1, 0xD7, 0xF7, 0x9A, 0x3E,
+    0xDF, 0xAB, 0x3C, 0x52, 0x9F, 0xAB, 0xB3, 0xC7, 0x92, 0x96, 0x53, 0xE1, 0x6C, 0x88, 0xAF, 0x53,
+    0xA6, 0x1B, 0xA8, 0xF4, 0x89, 0x56, 0xB2, 0x0E, 0x11, 0xB0, 0x67, 0x32, 0x2F, 0x3A, 0x94, 0x01,
+    0xEB, 0x3A, 0xBE, 0x67, 0x25, 0xF6, 0x8C, 0x76, 0xDE, 0x5E, 0x5D, 0xBC, 0x51, 0x06, 0x75, 0x65,
+    0xAA, 0x53, 0xE6, 0xBA, 0x7C, 0x4A, 0x76, 0x42, 0x65, 0xAD, 0x8C, 0x31, 0x85, 0xCB, 0xA1, 0x85,
+    0x7F, 0x3D, 0xDF, 0x7E, 0xBE, 0xD3, 0x1F, 0x7A, 0x2D, 0xE9, 0x89, 0xD7, 0xEC, 0xAE, 0xD4, 0x36,
+    0x1E, 0x0B, 0x59, 0xDF, 0x8C, 0x85, 0x47, 0x27, 0x4A, 0x30, 0x76, 0x1C, 0x94, 0x7E, 0xAD, 0x27,
+    0x36, 0xE7, 0xCB, 0x11, 0x9E, 0xD7, 0x4C, 0xEC, 0xA3, 0x32, 0x47, 0x39, 0xE6, 0x7D, 0x4D, 0x7B,
+    0x5C, 0x9E, 0x7B, 0x4B, 0xBA, 0xB8, 0xE8, 0xDC, 0x75, 0xA0, 0x22, 0x29, 0xDC, 0x4A, 0x2D, 0x18,
+    0x05, 0x0C, 0xA5, 0xDF, 0x9C, 0x39, 0xF3, 0x46, 0xC6, 0x05, 0xD4, 0xC6, 0x4D, 0x83, 0x54, 0x66,
+    0x4E, 0xE9, 0x04, 0xB6, 0x08, 0xE0, 0x5F, 0xE1, 0x33, 0xB6, 0x09, 0x32, 0x74, 0x1C, 0x22, 0xE3,
+    0x67, 0xAA, 0x6E, 0x8B, 0x6F, 0xF4, 0x43, 0x1D, 0x8A, 0xFF, 0xA0, 0x68, 0x56, 0xFA, 0x95, 0x4A,
+    0xDB, 0xFD, 0x5B, 0xD4, 0x6E, 0xE8, 0x2D, 0x52, 0xCD, 0xCA, 0xAA, 0xB2, 0x5D, 0xE9, 0x11, 0x52,
+    0xFB, 0xB7, 0xC6, 0x30, 0x82, 0x85, 0x80, 0xC4, 0x02, 0x1F, 0x80, 0xEE, 0x8E, 0x93, 0x1A, 0x54,
+    0x56, 0x7C, 0x80, 0x39, 0x4F, 0x96, 0xB6, 0x7C, 0xF1, 0x40, 0x2F, 0x32, 0x1C, 0x92, 0x0E, 0x3C,
+    0x7D, 0x04, 0x8F, 0x7C, 0xE2, 0x0F, 0xF5, 0xF8, 0x23, 0xCE, 0x40, 0x5B, 0xDC, 0x0C, 0xFA, 0x20,
+    0xE8, 0x85, 0xB1, 0x5E, 0x8A, 0x93, 0x1A, 0xB2, 0x1E, 0xCC, 0x4C, 0xE0, 0x0F, 0x3E, 0x76, 0xE6,
+    0x78, 0x05, 0x91, 0xCA, 0xC0, 0x14, 0x50, 0x50, 0x58, 0xC1, 0xDF, 0x17, 0xE2, 0x24, 0xA3, 0x9E,
+    0x6C, 0xD9, 0x59, 0xA6, 0x21, 0x8C, 0x2B, 0x6E, 0xCA, 0x42, 0x93, 0xF8, 0xDA, 0x5B, 0xFA, 0x56,
+    0x31, 0x1E, 0x4A, 0x74, 0xEE, 0xFC, 0xED, 0x9B, 0xEB, 0xB7, 0x97, 0x17, 0xB7, 0xAF, 0xCF, 0xFE,
+    0x7A, 0x7B, 0xF9, 0xEA, 0x0D, 0x85, 0x21, 0x0E, 0x30, 0x4C, 0x51, 0x19, 0x8D, 0x87, 0x21, 0x15,
+    0x02, 0xE8, 0x25, 0xF4, 0xA6, 0x81, 0xFE, 0x9A, 0x16, 0xB3, 0x8A, 0xD1, 0x2F, 0xB1, 0xD5, 0x57,
+    0x7E, 0x51, 0xA9, 0x21, 0x31, 0x6C, 0x8B, 0x92, 0xEA, 0x58, 0x00, 0x13, 0xE6, 0x17, 0xF4, 0x74,
+    0x06, 0x70, 0x44, 0xB1, 0x0E, 0x8C, 0xAD, 0xE7, 0xBA, 0x37, 0xB4, 0xA5, 0x2E, 0x5F, 0x09, 0x8E,
+    0xFD, 0x49, 0xB0, 0xE6, 0x69, 0xAE, 0xE4, 0x4F, 0x11, 0xB3, 0xEF, 0xAA, 0xE0, 0xBB, 0xD0, 0x93,
+    0xF5, 0x12, 0x8E, 0x60, 0x8D, 0xCA, 0x0B, 0x9E, 0xE8, 0xF4, 0xBA, 0x4B, 0x41, 0x56, 0xF3, 0x7C,
+    0x2E, 0x17, 0x7C, 0x9F, 0x2D, 0x2D, 0xF1, 0xCD, 0x9E, 0xA7, 0x9F, 0xE7, 0x8F, 0x6D, 0x4B, 0xB3,
+    0x28, 0xEA, 0x33, 0x16, 0x7B, 0x03, 0x86, 0x7E, 0xEA, 0xAE, 0xCD, 0xC2, 0x70, 0x2A, 0xC3, 0x6A,
+    0x45, 0x7D, 0x11, 0x09, 0x29, 0x1A, 0x93, 0xAF, 0xC6, 0x8E, 0x1F, 0x84, 0xF4, 0xA6, 0x32, 0x86,
+    0x37, 0x1A, 0x96, 0x66, 0x71, 0x54, 0x94, 0xE4, 0x2F, 0x5F, 0x11, 0x33, 0xC1, 0xD4, 0x8A, 0x85,
+    0x30, 0xC3, 0xCA, 0x8F, 0xDB, 0x9D, 0x8C, 0x78, 0x4E, 0xBD, 0x3D, 0x89, 0xD9, 0x5A, 0x97, 0xC1,
+    0x14, 0xCF, 0xD9, 0xE2, 0x5D, 0x6C, 0x74, 0xC2, 0xD6, 0x9B, 0x4F, 0xDA, 0xB8, 0xFB, 0x6D, 0xA7,
+    0xD2, 0xC8, 0x1E, 0x31, 0x12, 0x27, 0x72, 0x6E, 0x81, 0x28, 0x14, 0x5F, 0xC4, 0xBE, 0x0C, 0xDD,
+    0x63, 0xD6, 0xA6, 0x02, 0xED, 0x57, 0x2F, 0xD8, 0xE8, 0x01, 0xB7, 0xA9, 0xB9, 0x3B, 0xFE, 0x4E,
+    0xE1, 0xB0, 0x4A, 0x66, 0x27, 0x66, 0xAC, 0x4B, 0x60, 0xCA, 0x28, 0x4E, 0x2B, 0x8A, 0x40, 0x3F,
+    0xD2, 0x57, 0xEE, 0x78, 0x73, 0xA4, 0x5F, 0xB2, 0xB9, 0x55, 0xBE, 0xC9, 0xCA, 0x6D, 0xE3, 0x48,
+    0xE5, 0x0F, 0x48, 0xC3, 0xCB, 0xE5, 0xDE, 0xD5, 0x00, 0x7C, 0x17, 0x75, 0x3B, 0xDA, 0xB7, 0xAD,
+    0x02, 0x9B, 0xDE, 0x1D, 0x25, 0xC8, 0x45, 0x99, 0xC2, 0x55, 0x5B, 0x9F, 0x59, 0x38, 0x45, 0x59,
+    0x3E, 0x31, 0x17, 0x24, 0xC7, 0x35, 0x30, 0x8D, 0x0F, 0x14, 0xEE, 0x47, 0x90, 0xC9, 0x89, 0x8E,
+    0x73, 0x2B, 0x60, 0x33, 0x27, 0x08, 0xB8, 0xFD, 0x11, 0x3D, 0xF6, 0x13, 0xCA, 0x2B, 0xB3, 0x5E,
+    0xA3, 0x74, 0xFC, 0xA7, 0xB4, 0xD9, 0xB3, 0xCB, 0x8B, 0x77, 0x37, 0x2C, 0x69, 0x1B, 0x1A, 0x12,
+    0x95, 0xD6, 0x6D, 0xCA, 0x02, 0x0D, 0x03, 0xF4, 0x99, 0x20, 0x69, 0x4D, 0x9B, 0x93, 0x20, 0x9B,
+    0x2F, 0x9B, 0x6B, 0x37, 0x92, 0xD5, 0x1C, 0x42, 0xE1, 0x62, 0x98, 0x37, 0x81, 0xF2, 0xB8, 0x47,
+    0xE7, 0xED, 0x2C, 0x4A, 0xBC, 0x4F, 0xFB, 0x0F, 0xC3, 0xB5, 0x42, 0xC9, 0x4A, 0xB7, 0x3D, 0x14,
+    0xD1, 0x62, 0x8A, 0x50, 0x31, 0xF9, 0x43, 0x5B, 0xD8, 0xF6, 0x3D, 0x20, 0xBC, 0x2D, 0x0A, 0xCB,
+    0x1F, 0xC6, 0x7A, 0xE1, 0x7E, 0xD9, 0x53, 0x19, 0xAA, 0xA0, 0xF2, 0x9A, 0xE2, 0x27, 0x19, 0xC2,
+    0xC2, 0x9E, 0xA3, 0x72, 0xC6, 0x17, 0x0C, 0xB6, 0xDA, 0x42, 0xAB, 0x6C, 0x8B, 0xD8, 0xA8, 0x36,
+    0x3E, 0x64, 0x67, 0xCF, 0xBD, 0x19, 0x26, 0x12, 0xD0, 0x5D, 0xF5, 0x30, 0xAF, 0xB9, 0x7A, 0x5B,
+    0x02, 0x8C, 0x7A, 0xF9, 0x96, 0x1F, 0xC9, 0xF1, 0x15, 0xDF, 0xB6, 0x2B, 0x4F, 0x8E, 0x2A, 0x56,
+    0xCC, 0xA8, 0x34, 0xC6, 0x71, 0x18, 0x6A, 0x4A, 0x2B, 0x26, 0xDA, 0xA9, 0xE0, 0x4A, 0x51, 0x39,
+    0x0F, 0x36, 0x73, 0xC9, 0x6F, 0x3E, 0x06, 0x37, 0x7D, 0x69, 0xB4, 0xAC, 0xBF, 0x55, 0x76, 0x6E,
+    0x51, 0x77, 0x07, 0x74, 0xEA, 0xD4, 0xE2, 0x56, 0xFA, 0xD4, 0xE2, 0x16, 0x54, 0xC9, 0x9F, 0x5A,
+    0xDC, 0x62, 0x9F, 0x8B, 0x00, 0xC4, 0x05, 0xD2, 0x34, 0x75, 0x03, 0xBA, 0x6C, 0xC4, 0x19, 0x3F,
+    0x34, 0x7E, 0x8D, 0xFA, 0x34, 0x8C, 0xE9, 0xF8, 0xB9, 0x99, 0xE3, 0xED, 0xCC, 0xCF, 0x0E, 0x86,
+    0x4F, 0x35, 0x92, 0x73, 0x01, 0xBA, 0x48, 0x87, 0x38, 0x84, 0x3F, 0x95, 0x15, 0x7F, 0xD0, 0xDD,
+    0xD1, 0xB9, 0x1D, 0x14, 0x24, 0x97, 0xBC, 0xC3, 0xFE, 0x6D, 0xC9, 0x81, 0xB0, 0xA3, 0x65, 0xF0,
+    0xD0, 0xA2, 0xB3, 0x0A, 0x94, 0xCD, 0xDC, 0x48, 0x24, 0x5D, 0xA5, 0x0D, 0x9D, 0xEB, 0x00, 0xC5,
+    0x7E, 0x37, 0xE4, 0xFA, 0xA3, 0x94, 0xAA, 0x22, 0xE5, 0x69, 0x20, 0x2E, 0x8B, 0x4D, 0x08, 0x14,
+    0x47, 0x74, 0x2B, 0xA5, 0x6C, 0x2E, 0x44, 0x0D, 0xEF, 0xA9, 0xA5, 0xB8, 0x34, 0xD2, 0xB5, 0xE9,
+    0x40, 0x58, 0xE8, 0x91, 0x16, 0x82, 0xF9, 0x35, 0x28, 0xE5, 0x34, 0x9E, 0xAA, 0xAA, 0xB6, 0x33,
+    0x24, 0x84, 0x1B, 0x73, 0x64, 0x34, 0x93, 0xF3, 0xC2, 0xBA, 0xF3, 0x97, 0x74, 0x90, 0x39, 0x3A,
+    0x42, 0x14, 0xF0, 0x10, 0x17, 0xCE, 0x54, 0xEA, 0x89, 0x8B, 0xEB, 0xAB, 0x9D, 0x7E, 0x71, 0xC6,
+    0x62, 0xAD, 0x6B, 0x59, 0xB8, 0x30, 0x57, 0x33, 0xB7, 0x9E, 0xCB, 0x42, 0x5B, 0xCD, 0x02, 0xD1,
+    0x8B, 0x8C, 0x91, 0x3B, 0xC5, 0xA1, 0xAB, 0x22, 0xD2, 0x29, 0x9F, 0xEA, 0x53, 0xB8, 0xFC, 0xEC,
+    0xBC, 0x74, 0xB6, 0x9F, 0x5F, 0x5E, 0xB0, 0x08, 0xC5, 0xF5, 0x2E, 0xD1, 0x1E, 0xF9, 0xD0, 0x3B,
+    0x0B, 0xF4, 0xA5, 0xDB, 0x60, 0xC1, 0xB9, 0xBD, 0xD5, 0x8C, 0xA7, 0x2A, 0xF9, 0x0D, 0x73, 0x9F,
+    0x35, 0xE9, 0xAC, 0x30, 0x9D, 0xC7, 0x8F, 0xCF, 0x37, 0xC4, 0xC0, 0x07, 0x86, 0x1D, 0x79, 0xAB,
+    0xDB, 0x19, 0xA8, 0xD2, 0xD0, 0xBC, 0x35, 0xE5, 0xD6, 0x27, 0xCA, 0x75, 0x4F, 0x08, 0xA4, 0xBF,
+    0xAE, 0x79, 0x3F, 0xB8, 0x3F, 0x19, 0xA9, 0x3B, 0x15, 0x7F, 0xD0, 0x77, 0xE7, 0xE2, 0xCE, 0x71,
+    0xD9, 0x95, 0xE7, 0x63, 0xE6, 0xA8, 0xCD, 0xBA, 0xB5, 0xA0, 0xCA, 0xB7, 0x4B, 0xDF, 0xCD, 0x37,
+    0x9F, 0x7C, 0x39, 0xDA, 0x08, 0x24, 0x06, 0xCD, 0x6A, 0x60, 0xE2, 0xA7, 0xCD, 0x80, 0x2E, 0xC0,
+    0x40, 0x5A, 0x79, 0xBE, 0x0E, 0x70, 0xF4, 0x79, 0x33, 0xE0, 0xE6, 0xA2, 0x0C, 0x69, 0xF9, 0x75,
+    0x33, 0xD0, 0xB6, 0x37, 0x03, 0x0E, 0xD1, 0x40, 0x16, 0x1F, 0x37, 0x03, 0xEC, 0x8D, 0xC7, 0xA8,
+    0xA6, 0x6A, 0xD8, 0x52, 0x51, 0x48, 0xCF, 0x4C, 0x57, 0xDE, 0x0A, 0x6C, 0x99, 0x2B, 0x9F, 0x9C,
+    0x62, 0x9B, 0xB2, 0x93, 0xA8, 0x7D, 0xEB, 0x2C, 0x0A, 0x7D, 0x8D, 0xBF, 0x1C, 0x6D, 0x06, 0x12,
+    0x75, 0x19, 0x1D, 0xD0, 0x50, 0x9B, 0x02, 0xBD, 0x12, 0xEC, 0x18, 0x96, 0x61, 0xBA, 0xC7, 0x5B,
+    0x07, 0x3B, 0x2E, 0xB0, 0x61, 0x03, 0xA6, 0xEB, 0x4C, 0xE6, 0xF8, 0x5A, 0xD7, 0x40, 0x5C, 0x20,
+    0x7D, 0xBF, 0x43, 0x6E, 0x6C, 0x5E, 0xBA, 0xB0, 0xC4, 0x3D, 0xB0, 0x1F, 0x29, 0x16, 0x75, 0xB3,
+    0xA1, 0x19, 0x13, 0x88, 0x5B, 0x54, 0xD5, 0x95, 0xB4, 0x94, 0xDF, 0x27, 0xD8, 0x04, 0x95, 0xC2,
+    0xAD, 0x9C, 0xAD, 0x2D, 0x0D, 0xBF, 0x6C, 0x7E, 0xB3, 0x05, 0x35, 0x06, 0x1F, 0x6E, 0xD3, 0x25,
+    0xD7, 0xA4, 0x2D, 0xC6, 0x6B, 0xFD, 0x03, 0xEC, 0xCF, 0x5B, 0x91, 0x76, 0x29, 0xDF, 0x95, 0xE4,
+    0x73, 0xE8, 0x97, 0x24, 0x0F, 0xA5, 0xB2, 0xF2, 0x5C, 0x00, 0xF0, 0x65, 0xD9, 0x6E, 0x8A, 0x16,
+    0x93, 0xA4, 0x7A, 0x1E, 0x89, 0xE4, 0xCB, 0x86, 0x7B, 0x43, 0xEB, 0xB5, 0xB9, 0xF5, 0xC6, 0x0B,
+    0x59, 0xAC, 0xDD, 0x6F, 0xD5, 0xDD, 0x5D, 0xF9, 0xAC, 0x58, 0xD1, 0x73, 0xCA, 0x55, 0x36, 0x66,
+    0x66, 0x2B, 0x97, 0x4B, 0x3E, 0xD2, 0x26, 0x86, 0x5B, 0x51, 0x1E, 0xF9, 0x5A, 0x39, 0x26, 0x02,
+    0x8C, 0x43, 0x8D, 0x75, 0x9B, 0xD0, 0x2B, 0xD3, 0x6C, 0xB0, 0xAC, 0x56, 0xB3, 0x91, 0x0E, 0x9D,
+    0x08, 0xD2, 0x89, 0x82, 0xA0, 0xB5, 0xD4, 0x8F, 0x9C, 0x0A, 0x31, 0x64, 0x64, 0x1A, 0xBF, 0x9A,
+    0x87, 0x8D, 0x75, 0x95, 0x92, 0x66, 0x4B, 0x71, 0xB0, 0x93, 0xD6, 0x0E, 0x50, 0x3F, 0x69, 0x06,
+    0xBF, 0xE1, 0xA1, 0xA1, 0x2C, 0x14, 0xAD, 0x5F, 0xD9, 0x82, 0xDF, 0xAD, 0xAB, 0xC8, 0xA4, 0xB5,
+    0x91, 0xE1, 0xBA, 0x2A, 0x4D, 0x11, 0xB1, 0x58, 0x11, 0xA9, 0x43, 0x94, 0x82, 0x3A, 0xD3, 0x54,
+    0x77, 0xA0, 0x96, 0xEA, 0x92, 0xE8, 0x20, 0xC3, 0x75, 0x54, 0x98, 0x96, 0x0E, 0x90, 0x18, 0x84,
+    0x75, 0x34, 0x17, 0x2D, 0xA8, 0x64, 0xA8, 0xD6, 0xD5, 0x59, 0xB4, 0x20, 0x63, 0x2E, 0x59, 0x53,
+    0x51, 0xD1, 0x02, 0x14, 0x8A, 0xC5, 0x70, 0x4D, 0xED, 0x44, 0x0B, 0x2E, 0xAD, 0x46, 0x0C, 0x37,
+    0xD4, 0x4C, 0xD4, 0xCC, 0x50, 0x53, 0xF5, 0x48, 0x74, 0x88, 0xE1, 0x3A, 0x2A, 0x48, 0x4B, 0x0B,
+    0x28, 0xA4, 0x34, 0x85, 0x6B, 0xA9, 0x1E, 0x7A, 0x60, 0xB1, 0xA2, 0x50, 0x67, 0x9A, 0x68, 0xD5,
+    0x8F, 0xA6, 0xBE, 0x81, 0x58, 0x51, 0x58, 0xA7, 0x81, 0x82, 0xFA, 0xA1, 0x99, 0x8F, 0xF5, 0x34,
+    0x8C, 0x82, 0x92, 0x30, 0x5C, 0x5F, 0xE1, 0x50, 0xB9, 0x45, 0xB2, 0xDA, 0xC0, 0x70, 0x53, 0xF5,
+    0xA2, 0x08, 0x3A, 0xAD, 0x0A, 0x0C, 0xD7, 0x56, 0x28, 0x5A, 0xF9, 0xE8, 0x38, 0xD5, 0x55, 0xDC,
+    0x78, 0x5A, 0x94, 0x16, 0x64, 0x5A, 0x19, 0x03, 0x71, 0x5E, 0x19, 0x5F, 0x25, 0x8B, 0x56, 0xB4,
+    0x3C, 0x29, 0x7C, 0x59, 0xF9, 0xEA, 0xC9, 0x2E, 0x4D, 0x57, 0x7F, 0xBD, 0xE8, 0x96, 0xBC, 0x5E,
+    0xD4, 0xF2, 0x7C, 0xDA, 0x67, 0xA6, 0xB4, 0x51, 0x9E, 0xEB, 0x7A, 0x2B, 0x5C, 0x92, 0x69, 0x19,
+    0x0E, 0x86, 0xFF, 0x3A, 0xDF, 0xC2, 0x5B, 0x6D, 0xF3, 0xF0, 0xE9, 0x1E, 0xDA, 0x2D, 0xF8, 0xD8,
+    0x6C, 0x6E, 0x74, 0x85, 0x85, 0xD2, 0x95, 0xF0, 0x38, 0x67, 0x58, 0xB5, 0x2F, 0xAC, 0xAE, 0x2B,
+    0x2C, 0x26, 0xF4, 0x93, 0xBA, 0xBF, 0xF4, 0x17, 0x3E, 0xC9, 0xE1, 0x88, 0x06, 0x9A, 0x54, 0x95,
+    0xEC, 0xCD, 0x44, 0xBF, 0xDB, 0x5A, 0xF7, 0xC0, 0x93, 0x84, 0x29, 0x1D, 0x58, 0xE6, 0x5D, 0x5A,
+    0xCB, 0xEA, 0x6C, 0x3D, 0xD6, 0x55, 0xA6, 0xD4, 0xE6, 0x72, 0xAD, 0xAC, 0xAB, 0xCB, 0xF1, 0xB9,
+    0x9D, 0x59, 0xCF, 0x23, 0x2F, 0x64, 0x85, 0x5A, 0x87, 0x87, 0x69, 0x38, 0x54, 0x13, 0x0B, 0x86,
+    0x46, 0xB3, 0x13, 0x20, 0xDF, 0xBF, 0xBB, 0x2C, 0xF1, 0x31, 0x2B, 0x54, 0x80, 0x62, 0x30, 0xB0,
+    0x00, 0x44, 0x29, 0x26, 0x4F, 0xD6, 0x52, 0x01, 0x74, 0xA0, 0xAE, 0xE4, 0xBA, 0x5E, 0x03, 0x5C,
+    0x5E, 0x05, 0xD0, 0x81, 0x3C, 0xBB, 0xAA, 0x89, 0x5F, 0x4E, 0x03, 0xD0, 0xC1, 0x7B, 0x41, 0x0B,
+    0x7B, 0x0D, 0x78, 0x59, 0x0D, 0x20, 0x27, 0xE7, 0x60, 0xB8, 0xFF, 0x22, 0x25, 0x9A, 0xF0, 0x93,
+    0xAB, 0x92, 0xAE, 0xF2, 0x48, 0xF8, 0x7D, 0x50, 0x04, 0x39, 0xA4, 0x06, 0xF1, 0x04, 0x4C, 0x95,
+    0xAD, 0xA6, 0x2C, 0x2E, 0xB2, 0xFF, 0x46, 0xD2, 0x8C, 0xD3, 0xEA, 0x6F, 0x46, 0x5C, 0x84, 0xC5,
+    0x81, 0x37, 0x31, 0x2B, 0x22, 0xC3, 0x4C, 0x81, 0x05, 0xDE, 0x4F, 0x20, 0x0B, 0xAA, 0xD5, 0x07,
+    0x8D, 0xE5, 0x4B, 0xC0, 0x25, 0x23, 0x5B, 0x1F, 0x64, 0x54, 0xA7, 0x04, 0x6C, 0x34, 0xBA, 0xF5,
+    0x81, 0x9E, 0x5D, 0x55, 0xA1, 0x1A, 0x8D, 0x70, 0x7D, 0x98, 0xA2, 0x06, 0x81, 0x2C, 0xC0, 0xE4,
+    0x5F, 0x64, 0x09, 0xE2, 0x4F, 0xB3, 0xF0, 0xA0, 0x19, 0xE7, 0x9B, 0x0B, 0xD4, 0x7D, 0x40, 0xA5,
+    0xC0, 0x8D, 0x4E, 0x4C, 0x75, 0x60, 0x7B, 0xCB, 0x11, 0x30, 0xC8, 0xBF, 0x2D, 0x3D, 0x3C, 0xB0,
+    0x24, 0xAE, 0x31, 0x7F, 0xA0, 0x20, 0x43, 0xA4, 0x4B, 0xB0, 0x30, 0x41, 0x12, 0x67, 0xC0, 0x64,
+    0xE4, 0xC0, 0x0A, 0x00, 0xBE, 0x9A, 0xFF, 0x57, 0xAA, 0xFC, 0x6A, 0xFC, 0x06, 0xCC, 0x16, 0x6E,
+    0xA7, 0x78, 0x2A, 0x87, 0x68, 0x61, 0xDE, 0x97, 0x54, 0x8F, 0x4A, 0x29, 0x41, 0xC4, 0xF3, 0xBC,
+    0x04, 0x80, 0x28, 0xA3, 0xAC, 0x1E, 0x4F, 0xEB, 0x92, 0xEA, 0xA2, 0x4C, 0x53, 0xA9, 0xB2, 0x24,
+    0xBB, 0x6D, 0xBF, 0x90, 0x10, 0x16, 0x42, 0x80, 0xFD, 0xE1, 0xD7, 0x78, 0x9E, 0x7E, 0x8E, 0x7F,
+    0x20, 0x12, 0xC9, 0xAF, 0xA8, 0x57, 0xC9, 0x1B, 0x81, 0x66, 0xF2, 0x5B, 0xB4, 0x8B, 0x37, 0xFF,
+    0xFE, 0xE7, 0x0E, 0xDA, 0x3A, 0x2A, 0x44, 0x7A, 0xFD, 0xBC, 0xB8, 0xE7, 0xD6, 0x12, 0xB3, 0x5C,
+    0x5F, 0xA7, 0xAF, 0x38, 0xEC, 0x74, 0xD8, 0xDF, 0xBC, 0x25, 0xC3, 0xFC, 0xAE, 0x73, 0x6F, 0xC5,
+    0xD2, 0x9B, 0xB9, 0xEC, 0x25, 0x6E, 0x0E, 0x45, 0x2E, 0x83, 0xC7, 0x69, 0x1C, 0xD7, 0x72, 0xCB,
+    0x2C, 0x8D, 0x90, 0xDC, 0xC6, 0x03, 0x14, 0xBE, 0x8C, 0xFE, 0x51, 0xD1, 0x66, 0xA5, 0x36, 0xF2,
+    0x13, 0x77, 0x17, 0x20, 0xE3, 0xC6, 0x29, 0xA5, 0x04, 0xA7, 0x06, 0x13, 0x23, 0x4C, 0x72, 0xA2,
+    0x9E, 0x80, 0x48, 0x25, 0xF7, 0xA1, 0x94, 0xC1, 0xD7, 0xF4, 0x19, 0xEF, 0x15, 0x3A, 0x0B, 0x40,
+    0xE2, 0x38, 0xC1, 0xA7, 0x06, 0xC0, 0xD4, 0x64, 0x4E, 0x87, 0x2F, 0x1D, 0x67, 0x6E, 0xB9, 0x4B,
+    0x9B, 0x07, 0x8D, 0x2D, 0x06, 0xE2, 0xF8, 0x07, 0xF6, 0x8B, 0xF1, 0x87, 0x5F, 0xE1, 0xFD, 0x67,
+    0xE3, 0x17, 0x36, 0x64, 0xE4, 0x8E, 0xAC, 0xD6, 0xA7, 0x22, 0xF3, 0x21, 0xF1, 0x6A, 0x8D, 0xF8,
+    0x18, 0xAF, 0x17, 0x11, 0x6A, 0x5A, 0x11, 0x59, 0xBD, 0xBD, 0xA1, 0x54, 0xA9, 0x32, 0x4B, 0x75,
+    0x5E, 0xC4, 0x3E, 0x8F, 0x9C, 0x5A, 0xEC, 0x5A, 0xB8, 0x7C, 0x06, 0x18, 0xFF, 0xD9, 0xED, 0x76,
+    0xD9, 0x2C, 0x28, 0x86, 0x3C, 0xC4, 0x2D, 0xE5, 0xB7, 0xE0, 0x28, 0x71, 0x00, 0xC5, 0x22, 0xEB,
+    0x0A, 0x1C, 0x9F, 0x88, 0xA3, 0xA4, 0xAA, 0x79, 0x91, 0x59, 0xC6, 0x72, 0x18, 0xB1, 0x19, 0xA6,
+    0xE9, 0x1C, 0x71, 0xF8, 0x6F, 0xB8, 0xC2, 0xF8, 0x91, 0x01, 0x1D, 0x62, 0x97, 0x28, 0x16, 0x18,
+    0xB4, 0xB8, 0x88, 0x90, 0xEB, 0x4C, 0xF4, 0xAD, 0x87, 0x9D, 0x1B, 0x74, 0xCB, 0xFA, 0x15, 0xFB,
+    0xB3, 0xB0, 0x47, 0xBD, 0x6C, 0x97, 0x92, 0x6F, 0xC7, 0xB8, 0x31, 0x5E, 0xDD, 0x95, 0xB8, 0xE9,
+    0x42, 0x27, 0x7A, 0xA2, 0x17, 0x83, 0x6E, 0x8D, 0x0E, 0x44, 0x7E, 0x92, 0x97, 0xC0, 0xC3, 0xEC,
+    0x9A, 0x1C, 0x0E, 0xBD, 0x2E, 0x74, 0x64, 0xBF, 0x5F, 0xD6, 0x91, 0x82, 0xC7, 0x81, 0x3A, 0xD4,
+    0xCD, 0x74, 0xA8, 0x58, 0x06, 0x3A, 0xB6, 0xDF, 0xAF, 0xEE, 0x58, 0x01, 0xA5, 0x62, 0x07, 0xBB,
+    0xD4, 0xC1, 0xFD, 0x7E, 0x8D, 0x0E, 0x9E, 0xD9, 0xB6, 0x83, 0x8C, 0x0D, 0x52, 0x20, 0x31, 0x5F,
+    0x03, 0x8C, 0x17, 0x46, 0x88, 0xA6, 0x8D, 0xB7, 0xBF, 0x4E, 0xB9, 0xCF, 0xBF, 0x53, 0xCD, 0x42,
+    0x81, 0x57, 0x6D, 0xBB, 0x05, 0xBD, 0x07, 0x91, 0xA1, 0x22, 0xBB, 0xAF, 0x8E, 0x86, 0x09, 0x3D,
+    0xF9, 0x59, 0x63, 0xA8, 0xC8, 0xAF, 0xCE, 0xA2, 0x54, 0xDD, 0x2E, 0x38, 0xA7, 0x94, 0x41, 0x2E,
+    0x19, 0x88, 0xA1, 0xBC, 0xEB, 0x77, 0x1D, 0x2F, 0x55, 0x09, 0x54, 0x1C, 0x5B, 0x79, 0x0A, 0xFF,
+    0x31, 0x6E, 0x2A, 0x65, 0x10, 0x6E, 0xE4, 0x6B, 0x12, 0xB7, 0x90, 0x4A, 0xA6, 0x38, 0x8B, 0xDE,
+    0x36, 0xD4, 0xDA, 0x88, 0x5E, 0x1C, 0xD1, 0x09, 0xA1, 0x84, 0xAC, 0x75, 0x74, 0x5C, 0xC9, 0x87,
+    0xAF, 0xAE, 0x94, 0x3A, 0x73, 0x86, 0xA2, 0x95, 0xE0, 0x22, 0xD6, 0x10, 0x7C, 0x92, 0x61, 0x11,
+    0x25, 0x74, 0x27, 0x78, 0x63, 0xBE, 0x69, 0x44, 0xF4, 0x6D, 0xE2, 0xFE, 0x59, 0x4C, 0x6C, 0xBC,
+    0xD3, 0x36, 0xF3, 0xE2, 0x14, 0xE7, 0xD5, 0xE3, 0x26, 0xD1, 0x3F, 0x97, 0xFA, 0x1E, 0x5D, 0x11,
+    0x0A, 0xB3, 0x3A, 0xCB, 0xD8, 0x4A, 0x25, 0x36, 0x55, 0xA4, 0x22, 0x60, 0xEC, 0x97, 0x05, 0x3A,
+    0x8F, 0x65, 0x79, 0x50, 0x43, 0x63, 0x86, 0x41, 0x9D, 0x34, 0xDF, 0x1C, 0xBD, 0x93, 0x43, 0x80,
+    0xCF, 0x31, 0xC7, 0xFE, 0xA7, 0xC2, 0xBA, 0xAE, 0xC2, 0x1A, 0x71, 0x6B, 0x12, 0xED, 0x1C, 0xA3,
+    0x12, 0x50, 0xE0, 0x52, 0x95, 0x13, 0x4C, 0x9C, 0x57, 0x08, 0x6F, 0x9C, 0x19, 0xF7, 0x96, 0x61,
+    0x23, 0x1D, 0xBF, 0xD4, 0x62, 0x3B, 0xD9, 0x2C, 0x13, 0x1B, 0x38, 0xCE, 0xA4, 0x4A, 0xA9, 0x47,
+    0xF3, 0x4B, 0xF9, 0xD2, 0x2A, 0x1B, 0x1E, 0x6E, 0xA4, 0xD0, 0x4E, 0x78, 0xBC, 0x22, 0xA4, 0x04,
+    0x2D, 0x46, 0xDF, 0xD2, 0x6D, 0x4F, 0xF1, 0x05, 0x44, 0x24, 0x9E, 0x95, 0x17, 0x58, 0x17, 0xE5,
+    0xB1, 0x72, 0x21, 0x8B, 0x81, 0xBF, 0x36, 0x17, 0xCA, 0xFD, 0x54, 0xA3, 0x8B, 0x01, 0xBE, 0xE7,
+    0xAF, 0x15, 0x7B, 0x98, 0x46, 0x0F, 0x3F, 0xDD, 0x5C, 0xAA, 0x3E, 0xF5, 0xE9, 0xD3, 0x3B, 0xD5,
+    0xA7, 0x1D, 0xFC, 0xF4, 0x5C, 0xF9, 0x69, 0x97, 0x3E, 0x5D, 0x1A, 0xD5, 0xE7, 0xD4, 0xE3, 0xDD,
+    0xF7, 0xB5, 0xB7, 0x44, 0x94, 0x37, 0x87, 0xA7, 0xC9, 0xF0, 0x81, 0x8A, 0x51, 0x6A, 0x42, 0xEC,
+    0x77, 0x1D, 0xE5, 0x42, 0x0E, 0x3B, 0x3E, 0xE2, 0xE6, 0xB3, 0x22, 0x9E, 0x58, 0x14, 0xB8, 0xF1,
+    0xF0, 0xB3, 0x6E, 0x5B, 0x5B, 0x5C, 0x90, 0xA3, 0xED, 0xD1, 0xCA, 0x19, 0x3B, 0x19, 0x47, 0x60,
+    0x99, 0x36, 0x51, 0xC3, 0x5D, 0x49, 0xF0, 0xF2, 0xCE, 0xCA, 0x18, 0xE6, 0xBA, 0x5E, 0xBF, 0xF8,
+    0x16, 0x9E, 0xAA, 0x55, 0x1B, 0x29, 0xA0, 0x77, 0x74, 0x2D, 0xD6, 0xF1, 0xC6, 0x11, 0xA8, 0x45,
+    0xDA, 0x17, 0xF7, 0x4F, 0xBB, 0x4A, 0xCA, 0xC1, 0x2F, 0xB1, 0x44, 0xA1, 0x80, 0x5A, 0xC5, 0xA3,
+    0x55, 0x2F, 0x19, 0x6F, 0x3D, 0x88, 0x85, 0xDA, 0x4B, 0x55, 0x58, 0x63, 0x23, 0x6E, 0x96, 0x2B,
+    0x2A, 0xB6, 0x9C, 0x2C, 0xAF, 0x91, 0x4F, 0xE8, 0x3F, 0x97, 0xD0, 0x35, 0x97, 0x50, 0x62, 0xD6,
+    0xDF, 0xF8, 0xFA, 0xA9, 0xC1, 0xF1, 0x0B, 0x2F, 0x9E, 0x9A, 0x56, 0x6B, 0xAC, 0x9C, 0x74, 0x19,
+    0x6B, 0xEC, 0x38, 0x81, 0xAA, 0x30, 0x55, 0x6D, 0x6F, 0x95, 0x0D, 0xD4, 0x16, 0xEF, 0x3A, 0x5E,
+    0x74, 0x67, 0x54, 0x24, 0x94, 0x0B, 0x62, 0x38, 0x1B, 0x54, 0x9D, 0x6A, 0x53, 0x3C, 0x1E, 0x63,
+    0x0A, 0x51, 0x67, 0x11, 0x9E, 0x7E, 0x77, 0xBC, 0x8D, 0x4C, 0x86, 0x7F, 0xA7, 0xE1, 0xCC, 0x3D,
+    0xFD, 0x7F, 0x15, 0x5B, 0x6D, 0x99, 0x1D, 0x5A, 0x01, 0x00
 };
\ No newline at end of file
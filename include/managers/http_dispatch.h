@@ -0,0 +1,49 @@
+#ifndef HTTP_DISPATCH_H
+#define HTTP_DISPATCH_H
+
+// Handler registration for the web server, with timing and worker tasks.
+//
+// esp_http_server runs every handler on its one task, so a file download or upload holds up every
+// other request until it is done. Endpoints registered with HTTP_DISPATCH_ASYNC are instead handed to
+// one of HTTP_DISPATCH_WORKERS worker tasks (httpd_req_async_handler_begin) and the server task goes
+// back to serving the rest. When every worker is busy the request is answered 503 with Retry-After at
+// once (and its connection closed if it has a body) rather than tying up the server task.
+// Every endpoint, async or not, is timed into core/http_metrics, which GET /api/metrics reports.
+//
+// Handlers that take over the request themselves (console stream, command replies) must not be
+// registered async.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <esp_err.h>
+#include <esp_http_server.h>
+
+#define HTTP_DISPATCH_WORKERS 2
+// The extract handler keeps ~2 KB of query and path buffers under the sidecar walk, FatFs and lwip; an
+// update ends in an ECDSA verify in mbedtls
+#define HTTP_DISPATCH_WORKER_STACK 8192
+#define HTTP_DISPATCH_QUEUE_LEN HTTP_DISPATCH_WORKERS   // Requests beyond this are answered 503
+
+#define HTTP_DISPATCH_ASYNC 0x1
+
+typedef struct {
+    uint32_t workers_busy;
+    uint32_t queued;
+    uint32_t dispatched;       // Requests handed to a worker
+    uint32_t ran_inline;       // Async requests run on the server task because the workers never started
+    uint32_t rejected_busy;    // Async requests answered 503 because no worker was free
+} http_dispatch_stats_t;
+
+// Tuned server settings: socket count from CONFIG_LWIP_MAX_SOCKETS, LRU purge, TCP keepalive
+void http_dispatch_config(httpd_config_t* config);
+
+// Start the worker tasks; requests registered async run on the server task until this has succeeded
+esp_err_t http_dispatch_start(void);
+
+// Register uri (copied) with its handler wrapped for timing, and for flags & HTTP_DISPATCH_ASYNC run
+// on a worker
+esp_err_t http_dispatch_register(httpd_handle_t server, const httpd_uri_t* uri, uint32_t flags);
+
+void http_dispatch_get_stats(http_dispatch_stats_t* out);
+
+#endif // HTTP_DISPATCH_H
@@ -0,0 +1,78 @@
+#ifndef OTA_MANAGER_H
+#define OTA_MANAGER_H
+
+// Firmware updates over the web API, into the spare slot of the two-slot partition table.
+// Boards flashed with a single factory partition (partitions.csv on 4 MB boards) have no spare slot:
+// ota_manager_begin() returns ESP_ERR_NOT_FOUND and the status reports a slot_size of 0.
+//
+// The image (build/<project>.bin) is written with esp_ota_write() as it arrives; nothing beyond one
+// receive buffer is held in RAM. The header is checked against this chip before the first byte reaches
+// flash. While it streams, a SHA-256 of the whole file is kept; at the end it must match the digest the
+// client sent with the request, and with CONFIG_OTA_REQUIRE_SIGNATURE it must carry an ECDSA signature
+// by the key built in from ota_signing_key.pem. Only then is the slot made the boot partition.
+//
+// The new image boots on trial (bootloader rollback). ota_manager_boot_check() runs a self-test once
+// startup is done and confirms the image OTA_CONFIRM_DELAY_MS later; failing the test, or resetting
+// before the confirmation, boots the previous image again.
+//
+// Calls may come from any task. Only one update runs at a time: a second ota_manager_begin() while one
+// is receiving gets ESP_ERR_INVALID_STATE.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <esp_err.h>
+
+#define OTA_SHA256_LEN 32
+#define OTA_MAX_SIGNATURE_LEN 128        // DER ECDSA; P-256 needs at most 72
+#define OTA_CONFIRM_DELAY_MS 20000
+#define OTA_MIN_FREE_HEAP 16384          // Self-test: heap left once everything has started
+
+typedef enum {
+    OTA_STATE_IDLE,
+    OTA_STATE_RECEIVING,
+    OTA_STATE_READY,                     // Stored and set to boot; waiting for the restart
+    OTA_STATE_FAILED,
+} ota_state_t;
+
+typedef struct {
+    ota_state_t state;
+    uint32_t received;
+    uint32_t total;
+    char error[64];                      // Why the last update failed
+    char new_version[32];                // Version of the image being received or stored
+    uint8_t sha256[OTA_SHA256_LEN];      // Digest of the last complete upload
+
+    char version[32];                    // Running image
+    char partition[17];
+    uint32_t slot_size;                  // Largest image that fits the spare slot
+    bool pending_verify;                 // Running image is on trial and not yet confirmed
+    char rolled_back_version[32];        // Image that failed its trial, empty if none
+    bool signature_required;
+} ota_status_t;
+
+// Start an update of image_size bytes. sha256 is the digest the finished image must have.
+// ESP_ERR_INVALID_STATE: another update is running. ESP_ERR_INVALID_SIZE: larger than the slot.
+// ESP_ERR_INVALID_ARG: no digest. ESP_ERR_NOT_SUPPORTED: a signature is required and none was given.
+esp_err_t ota_manager_begin(size_t image_size, const uint8_t* sha256, const uint8_t* signature, size_t signature_len);
+
+// ESP_ERR_INVALID_ARG: not an app image for this chip, or more bytes than announced
+esp_err_t ota_manager_write(const void* data, size_t len);
+
+// Check the digest and signature, validate the image and make it the boot partition.
+// ESP_ERR_INVALID_SIZE: short image. ESP_ERR_INVALID_CRC: digest mismatch. ESP_ERR_NOT_ALLOWED: bad
+// signature. ESP_ERR_OTA_VALIDATE_FAILED: the image does not verify.
+esp_err_t ota_manager_finish(void);
+
+// Drop an update that could not be received
+void ota_manager_abort(const char* reason);
+
+// Restart into the new image after delay_ms, leaving time to send the reply
+void ota_manager_restart_after(uint32_t delay_ms);
+
+// Once startup is done: confirm an image on trial if it passes the self-test, otherwise roll back
+void ota_manager_boot_check(bool web_server_ok);
+
+void ota_manager_get_status(ota_status_t* out);
+
+#endif // OTA_MANAGER_H
@@ -0,0 +1,91 @@
+#ifndef PCAP_SIDECAR_H
+#define PCAP_SIDECAR_H
+
+// Seek index written next to a pcap capture ("<capture>.pcap.idx").
+//
+// While a capture is written, records are grouped into blocks of at most PCAP_SIDECAR_BLOCK_BYTES or
+// PCAP_SIDECAR_BLOCK_MS of capture time. Each block is logged with its file offset, time range, the
+// frame types it holds and the short ids of the BSSIDs seen in it; ids are defined once per file as
+// BSSIDs first appear. Per record this costs a frame-control check and one hash probe.
+//
+// Extraction reads the sidecar, then only the blocks that can hold matching frames, so pulling one
+// network out of a long rawscan touches a small fraction of the file. A capture without a sidecar, or
+// the tail of one whose sidecar was cut short by a crash, is scanned linearly instead.
+//
+// Only POSIX calls are used; scripts/host/pcap_extract builds the same code on a PC.
+//
+// Sidecar layout (little endian): 16-byte header "GIDX", u16 version, u16 reserved, u32 block bytes,
+// u32 block ms; then tagged entries:
+//   'B' u16 id, u8 bssid[6]
+//   'K' u64 offset, u32 length, u32 records, u32 first_sec, u32 first_usec, u32 last_sec, u32 last_usec,
+//       u64 type mask, u8 flags, u16 id count, u16 ids[count]
+//   'E' u32 blocks, u32 bssids, u64 records (written on a clean close)
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "managers/sd_writer.h"
+
+#define PCAP_SIDECAR_SUFFIX ".idx"
+#define PCAP_SIDECAR_BLOCK_BYTES (64 * 1024)
+#define PCAP_SIDECAR_BLOCK_MS 10000
+#define PCAP_SIDECAR_MAX_BSSIDS 512       // Later BSSIDs are untracked; blocks holding them are always read
+#define PCAP_SIDECAR_BLOCK_IDS 96         // More distinct BSSIDs in one block mark it as holding any
+
+// Frame type bits: bit (type << 4 | subtype) for management (0), control (1) and data (2) frames
+#define PCAP_TYPE_BIT(type, subtype) (1ull << (((type) << 4) | (subtype)))
+#define PCAP_TYPE_MGMT 0x000000000000FFFFull
+#define PCAP_TYPE_CTRL 0x00000000FFFF0000ull
+#define PCAP_TYPE_DATA 0x0000FFFF00000000ull
+
+typedef struct pcap_sidecar_writer pcap_sidecar_writer_t;
+
+// Start the sidecar for pcap_path. Entries go through the SD writer and never block the caller.
+pcap_sidecar_writer_t* pcap_sidecar_open(const char* pcap_path);
+
+// Account one record that was queued at offset; frame is the 802.11 frame, record_len includes the
+// 16-byte record header
+void pcap_sidecar_add(pcap_sidecar_writer_t* w, uint64_t offset, uint32_t ts_sec, uint32_t ts_usec,
+                      const uint8_t* frame, size_t frame_len, size_t record_len);
+
+// Close the last block and write the end marker. A sidecar that lost entries to backpressure is
+// deleted rather than left pointing past data it doesn't describe.
+void pcap_sidecar_close(pcap_sidecar_writer_t* w);
+
+typedef struct {
+    bool has_bssid;
+    uint8_t bssid[6];
+    uint32_t from_sec;           // Inclusive; 0 for no lower bound
+    uint32_t to_sec;             // Inclusive; 0 for no upper bound
+    uint64_t type_mask;          // PCAP_TYPE_* bits, 0 for every type
+} pcap_filter_t;
+
+typedef struct {
+    bool used_index;
+    uint32_t blocks_total;
+    uint32_t blocks_read;
+    uint64_t bytes_read;         // pcap bytes read, not counting the sidecar
+    uint64_t records_scanned;
+    uint64_t records_matched;
+} pcap_extract_stats_t;
+
+typedef esp_err_t (*pcap_extract_write_fn)(void* ctx, const uint8_t* data, size_t len);
+
+// "aa:bb:cc:dd:ee:ff"
+bool pcap_filter_parse_bssid(const char* text, uint8_t bssid[6]);
+
+// Comma separated names: mgmt, ctrl, data, beacon, probe, probereq, proberesp, auth, deauth, assoc,
+// disassoc, action. Returns false on an unknown name.
+bool pcap_filter_parse_types(const char* text, uint64_t* mask);
+
+// BSSID of an 802.11 frame (addr3 for management, by ToDS/FromDS for data); NULL when it has none
+const uint8_t* pcap_frame_bssid(const uint8_t* frame, size_t len);
+
+bool pcap_filter_match(const pcap_filter_t* filter, const uint8_t* frame, size_t len, uint32_t ts_sec);
+
+// Write a pcap holding the global header of pcap_path and every record matching filter. Uses the
+// sidecar when there is one. stats may be NULL.
+esp_err_t pcap_sidecar_extract(const char* pcap_path, const pcap_filter_t* filter, pcap_extract_write_fn write_fn,
+                               void* ctx, pcap_extract_stats_t* stats);
+
+#endif // PCAP_SIDECAR_H
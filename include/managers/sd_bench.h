@@ -0,0 +1,93 @@
+#ifndef SD_BENCH_H
+#define SD_BENCH_H
+
+// SD card / filesystem benchmark behind the `sdbench` command and /api/sdbench.
+//
+// Measures sequential write and read throughput at several block sizes, the latency distribution of
+// small appends, file create/readdir/unlink cost and free-space layout, then suggests a coalescing
+// buffer size for the SD writer. A simulated capture is then written through the SD writer with and
+// without preallocation to compare the write latency histograms. All I/O goes through POSIX calls on scratch files in a ".sdbench"
+// directory, so the same code runs on Linux against tmpfs/ext4 for baselines:
+//   make -C scripts/host sdbench && scripts/host/sdbench /tmp
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "managers/sd_writer.h"
+
+#define SD_BENCH_MAX_BLOCKS 6
+
+typedef struct {
+    const char* dir;             // Scratch files go in <dir>/.sdbench; NULL uses /mnt
+    size_t file_bytes;           // Written and read back once per block size
+    uint32_t append_count;       // Small appends timed individually
+    size_t append_size;
+    uint32_t create_count;       // Files created, listed and removed
+    size_t capture_bytes;        // Simulated capture per preallocation setting, 0 skips it
+} sd_bench_config_t;
+
+typedef struct {
+    size_t block_size;
+    uint32_t write_kbps;         // KB/s, including the final fsync
+    uint32_t read_kbps;
+    uint32_t write_us_max;       // Slowest single write() of this size
+} sd_bench_seq_t;
+
+typedef struct {
+    uint32_t prealloc_bytes;
+    uint32_t kbps;
+    uint32_t prealloc_extents;
+    uint32_t write_latency_hist[SD_WRITER_LATENCY_BUCKETS];  // Buckets as in sd_writer_metrics_t
+} sd_bench_capture_t;
+
+typedef struct {
+    uint64_t total_bytes;
+    uint64_t free_bytes;
+    uint32_t cluster_size;
+    uint32_t free_clusters;
+    uint32_t free_extents;       // Runs of contiguous free clusters, 0 when the FAT was not scanned
+    uint32_t largest_free_extent;// Clusters
+    uint8_t fat_type;            // 12, 16 or 32; 0 when not FAT
+} sd_bench_fs_t;
+
+typedef struct {
+    sd_bench_seq_t seq[SD_BENCH_MAX_BLOCKS];
+    size_t seq_count;
+    uint32_t append_p50_us;
+    uint32_t append_p90_us;
+    uint32_t append_p99_us;
+    uint32_t append_max_us;
+    uint32_t create_us;          // Average per file
+    uint32_t readdir_us;         // Average per entry
+    uint32_t unlink_us;          // Average per file
+    sd_bench_capture_t capture[2];// Without, then with preallocation
+    size_t capture_count;
+    sd_bench_fs_t fs;
+    bool fs_valid;
+    size_t recommended_buffer_size;
+    uint32_t recommended_buffer_count;
+    uint32_t duration_ms;
+} sd_bench_result_t;
+
+typedef enum {
+    SD_BENCH_IDLE = 0,
+    SD_BENCH_RUNNING,
+    SD_BENCH_DONE,
+    SD_BENCH_FAILED,
+} sd_bench_state_t;
+
+// Fill cfg with sizes suited to the platform (a few MB per block size on the card)
+void sd_bench_default_config(sd_bench_config_t* cfg);
+
+// Run the whole benchmark on the calling thread
+esp_err_t sd_bench_run(const sd_bench_config_t* cfg, sd_bench_result_t* result);
+
+// Run on a helper thread and print the report when done. ESP_ERR_INVALID_STATE while one is running.
+esp_err_t sd_bench_start(const sd_bench_config_t* cfg);
+
+// State of the last background run; result is filled once it is SD_BENCH_DONE
+sd_bench_state_t sd_bench_get(sd_bench_result_t* result);
+
+void sd_bench_print(const sd_bench_result_t* result);
+
+#endif // SD_BENCH_H
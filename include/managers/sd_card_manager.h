@@ -5,6 +5,7 @@
 #include "driver/sdmmc_host.h"
 #include "driver/sdmmc_types.h"
 #include <stdbool.h>
+#include "managers/sd_bench.h"
 
 
 typedef struct {
@@ -37,5 +38,8 @@ esp_err_t sd_card_create_directory(const char* path);
 bool sd_card_exists(const char* path);
 esp_err_t sd_card_setup_directory_structure();
 
+// Size, cluster size and, with scan_fat, free-space fragmentation read from the FAT itself
+esp_err_t sd_card_get_fs_stats(bool scan_fat, sd_bench_fs_t* out);
+
 
 #endif // SD_CARD_MANAGER_H
\ No newline at end of file
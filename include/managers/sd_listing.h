@@ -0,0 +1,46 @@
+#ifndef SD_LISTING_H
+#define SD_LISTING_H
+
+// Paged, streamed JSON listing of a single SD card directory for the web file browser.
+//
+// Only one directory level is listed per request; folders are expanded by requesting their path.
+// Sorted pages keep at most offset + limit entries in a bounded heap, so memory does not grow with
+// the directory. Pages past SD_LISTING_MAX_WINDOW are reached with the "next" cursor of the previous
+// page. Files in indexed capture directories are served from capture_index without a stat per file;
+// their subfolders still come from readdir.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "managers/sd_writer.h"
+
+#define SD_LISTING_DEFAULT_LIMIT 100
+#define SD_LISTING_MAX_LIMIT 200
+#define SD_LISTING_MAX_WINDOW 400      // offset + limit for one page
+#define SD_LISTING_CURSOR_LEN 160
+
+typedef enum {
+    SD_LISTING_SORT_NONE = 0,          // Directory order, cheapest
+    SD_LISTING_SORT_NAME,
+    SD_LISTING_SORT_SIZE,
+    SD_LISTING_SORT_TIME,
+} sd_listing_sort_t;
+
+typedef struct {
+    const char* path;
+    uint32_t offset;
+    uint32_t limit;
+    sd_listing_sort_t sort;
+    bool descending;
+    const char* after;                 // Cursor from a previous page, NULL or "" to start at the top
+} sd_listing_query_t;
+
+// Output sink; return ESP_OK to continue
+typedef esp_err_t (*sd_listing_write_fn)(void* ctx, const char* data, size_t len);
+
+// Stream {"path","offset","limit","total","entries":[...],"next"} through write_fn
+esp_err_t sd_listing_stream(const sd_listing_query_t* query, sd_listing_write_fn write_fn, void* ctx);
+
+sd_listing_sort_t sd_listing_parse_sort(const char* name);
+
+#endif // SD_LISTING_H
@@ -0,0 +1,40 @@
+#ifndef SD_UPLOAD_H
+#define SD_UPLOAD_H
+
+// Writes the files of a multipart/form-data upload into an SD card directory.
+//
+// The request body is fed in whatever pieces httpd_req_recv() returns. Every file part is written to
+// "<name>.part" through a large buffer and renamed over "<name>" once its closing delimiter has been
+// seen, so a broken upload never replaces an existing file. Plain form fields are ignored.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "managers/sd_writer.h"
+
+#ifdef CONFIG_UPLOAD_BUFFER_SIZE
+#define SD_UPLOAD_BUFFER_SIZE CONFIG_UPLOAD_BUFFER_SIZE
+#else
+#define SD_UPLOAD_BUFFER_SIZE (16 * 1024)
+#endif
+
+typedef struct sd_upload sd_upload_t;
+
+typedef struct {
+    uint32_t files;
+    uint64_t bytes;
+} sd_upload_result_t;
+
+// ESP_ERR_INVALID_ARG when content_type is not multipart/form-data with a boundary
+esp_err_t sd_upload_begin(const char* dir, const char* content_type, sd_upload_t** out);
+
+// ESP_ERR_INVALID_ARG for a malformed body, ESP_FAIL when the card write fails
+esp_err_t sd_upload_feed(sd_upload_t* upload, const void* data, size_t len);
+
+// Check the body was complete and release the upload. On error any partial file is removed.
+esp_err_t sd_upload_finish(sd_upload_t* upload, sd_upload_result_t* result);
+
+// Drop a failed upload and its partial file
+void sd_upload_abort(sd_upload_t* upload);
+
+#endif // SD_UPLOAD_H
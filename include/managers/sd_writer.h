@@ -0,0 +1,166 @@
+#ifndef SD_WRITER_H
+#define SD_WRITER_H
+
+// Asynchronous SD card writer shared by the pcap, CSV and log producers.
+//
+// Producers copy into a per-stream buffer taken from a fixed pool; full buffers are queued to a single
+// writer thread that issues cluster-aligned writes and applies the stream's fsync policy. When every
+// buffer is in flight, writes fail fast (or wait up to a timeout) and the bytes are counted as dropped,
+// so capture callbacks never stall on the card. Streams can be compressed (LZ4 frame or gzip) on the
+// writer thread, which keeps the CPU cost out of the capture path.
+//
+// The service only uses POSIX file and pthread calls, so it also builds on Linux against a plain
+// directory for benchmarking:
+//   gcc -O2 -Iinclude main/managers/sd_writer.c main/core/gzip_stream.c main/core/lz4_stream.c <bench>.c -lpthread
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#include "esp_err.h"
+#else
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_NO_MEM 0x101
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_INVALID_STATE 0x103
+#define ESP_ERR_INVALID_SIZE 0x104
+#define ESP_ERR_NOT_FOUND 0x105
+#define ESP_ERR_TIMEOUT 0x107
+#define ESP_ERR_INVALID_CRC 0x109
+#endif
+
+#ifdef CONFIG_SD_WRITER_BUFFER_SIZE
+#define SD_WRITER_DEFAULT_BUFFER_SIZE CONFIG_SD_WRITER_BUFFER_SIZE
+#define SD_WRITER_DEFAULT_BUFFER_COUNT CONFIG_SD_WRITER_BUFFER_COUNT
+#define SD_WRITER_DEFAULT_MAX_LATENCY_MS CONFIG_SD_WRITER_MAX_LATENCY_MS
+#else
+#define SD_WRITER_DEFAULT_BUFFER_SIZE (16 * 1024)
+#define SD_WRITER_DEFAULT_BUFFER_COUNT 3
+#define SD_WRITER_DEFAULT_MAX_LATENCY_MS 2000
+#endif
+
+#ifdef CONFIG_SD_WRITER_PREALLOC_KB
+#define SD_WRITER_DEFAULT_PREALLOC (CONFIG_SD_WRITER_PREALLOC_KB * 1024)
+#else
+#define SD_WRITER_DEFAULT_PREALLOC (1024 * 1024)
+#endif
+
+#define SD_WRITER_DEFAULT_CLUSTER_SIZE 4096   // Used when the volume's cluster size can't be read
+
+// Write latency histogram: bucket i counts writes faster than the i-th bound, the last one the rest
+#define SD_WRITER_LATENCY_BOUNDS_MS {1, 2, 5, 10, 20, 50, 100, 200, 500}
+#define SD_WRITER_LATENCY_BUCKETS 10
+
+typedef struct sd_writer_stream sd_writer_stream_t;
+
+// Optional compression done on the writer thread, so producers only pay for the copy
+typedef enum {
+    SD_WRITER_CODEC_NONE = 0,
+    SD_WRITER_CODEC_LZ4,         // LZ4 frame (.lz4), ~24 KB of state, fastest
+    SD_WRITER_CODEC_GZIP,        // gzip (.gz), ~26 KB of state, smaller output at several times the CPU
+} sd_writer_codec_t;
+
+typedef struct {
+    size_t buffer_size;          // Coalescing size, also the upper bound of a single write
+    size_t buffer_count;         // Pool size; bounds the queue and the RAM used
+    uint32_t max_latency_ms;     // Partial buffers older than this are written out
+    int task_priority;           // Writer thread priority (ESP only)
+    size_t stack_size;
+} sd_writer_config_t;
+
+typedef struct {
+    size_t cluster_size;         // Writes end on multiples of this; 0 uses the volume's cluster size
+    uint32_t sync_interval_ms;   // fsync at most this often while data is flowing, 0 disables
+    uint32_t sync_bytes;         // fsync after this many bytes, 0 disables
+    bool sync_on_close;
+    uint32_t prealloc_bytes;     // Grow the file ahead of the data in extents of this size and truncate
+                                 // to the written size on close; 0 lets the file grow per write
+    sd_writer_codec_t codec;
+    uint8_t codec_level;         // 1 (fastest) to 9 (smallest), 0 for the codec's default
+} sd_writer_stream_config_t;
+
+typedef struct {
+    uint64_t bytes_submitted;
+    uint64_t bytes_written;
+    uint64_t bytes_dropped;      // Rejected by backpressure or lost to write errors
+    uint32_t writes;
+    uint32_t partial_writes;     // Buffers flushed early by the latency timer, flush or close
+    uint32_t write_errors;
+    uint32_t fsyncs;
+    uint64_t write_us_total;
+    uint32_t write_us_max;
+    uint64_t fsync_us_total;
+    uint32_t fsync_us_max;
+    uint32_t queue_depth;        // Buffers waiting for the writer right now
+    uint32_t queue_high_water;
+    uint32_t backpressure_events;
+    uint32_t write_latency_hist[SD_WRITER_LATENCY_BUCKETS];
+    uint32_t prealloc_extents;   // File extensions done ahead of the data
+    uint64_t prealloc_us_total;
+    uint32_t prealloc_us_max;
+    uint64_t codec_bytes_in;     // Compressed streams only: bytes taken in and written out by the codec
+    uint64_t codec_bytes_out;
+    uint64_t codec_us_total;     // Time spent compressing, excluding the writes
+} sd_writer_metrics_t;
+
+// Start the writer thread and allocate the buffer pool. NULL uses the Kconfig defaults. Safe to call twice.
+esp_err_t sd_writer_init(const sd_writer_config_t* config);
+
+// Flush and close every stream, then stop the thread and free the pool
+void sd_writer_deinit(void);
+
+// Open a file through the writer. mode is "w" (truncate) or "a" (append). config may be NULL.
+sd_writer_stream_t* sd_writer_open(const char* path, const char* mode, const sd_writer_stream_config_t* config);
+
+typedef struct {
+    const void* data;
+    size_t len;
+} sd_writer_iov_t;
+
+// Copy data into the stream. timeout_ms is how long to wait for buffer space; 0 never blocks.
+// Returns ESP_ERR_TIMEOUT when the queue is saturated (the data is counted as dropped).
+esp_err_t sd_writer_write(sd_writer_stream_t* stream, const void* data, size_t len, uint32_t timeout_ms);
+
+// Gathered write that is queued all or nothing, so a record header is never written without its body
+esp_err_t sd_writer_writev(sd_writer_stream_t* stream, const sd_writer_iov_t* iov, int iovcnt, uint32_t timeout_ms);
+
+// Queue the partially filled buffer; with wait, return once it is on the card (and synced if sync is set).
+// Compressed streams hold back up to a block of output until the next checkpoint or close.
+esp_err_t sd_writer_flush(sd_writer_stream_t* stream, bool wait, bool sync);
+
+// Called from the writer thread once everything up to offset is written and synced. For compressed
+// streams offset is the size of the compressed file at that point.
+typedef void (*sd_writer_checkpoint_fn)(void* ctx, uint64_t offset);
+
+// Mark the current end of the stream as a checkpoint. The writer queues the partial buffer, fsyncs
+// once the data is on the card and then calls fn. Never blocks, so it is safe from capture callbacks.
+// A compressed stream ends a block (LZ4) or a member (gzip) there, so the file cut at the checkpoint
+// is still readable.
+esp_err_t sd_writer_checkpoint(sd_writer_stream_t* stream, sd_writer_checkpoint_fn fn, void* ctx);
+
+// Flush, apply the close sync policy and close the file. The stream pointer is invalid afterwards.
+esp_err_t sd_writer_close(sd_writer_stream_t* stream);
+
+// Current file size including data still queued; uncompressed size for compressed streams
+uint64_t sd_writer_stream_size(const sd_writer_stream_t* stream);
+
+sd_writer_codec_t sd_writer_stream_codec(const sd_writer_stream_t* stream);
+
+// "none", "lz4" or "gzip", and the file name suffix the codec's output should get ("", ".lz4", ".gz")
+const char* sd_writer_codec_name(sd_writer_codec_t codec);
+const char* sd_writer_codec_suffix(sd_writer_codec_t codec);
+
+// True when the file on the card may extend past the data until the stream is closed
+bool sd_writer_stream_preallocated(const sd_writer_stream_t* stream);
+
+// True while fewer than a quarter of the buffers are free; producers can shed optional data
+bool sd_writer_backpressure(void);
+
+void sd_writer_get_metrics(sd_writer_metrics_t* out);
+void sd_writer_reset_metrics(void);
+
+#endif // SD_WRITER_H
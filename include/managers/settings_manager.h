@@ -5,6 +5,7 @@
 #include <stdbool.h>
 #include <nvs_flash.h>
 #include "core/utils.h"
+#include "managers/settings_store.h"
 #include <nvs.h>
 
 // Enum for RGB Modes
@@ -81,6 +82,10 @@ void settings_load(FSettings* settings);
 void settings_save(const FSettings* settings);
 void settings_set_defaults(FSettings* settings);
 
+// Writes any pending change now instead of after the debounce (before a restart)
+esp_err_t settings_flush(void);
+void settings_get_store_stats(settings_store_stats_t* out);
+
 // Getters and Setters for core settings
 void settings_set_rgb_mode(FSettings* settings, RGBMode mode);
 RGBMode settings_get_rgb_mode(const FSettings* settings);
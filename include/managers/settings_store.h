@@ -0,0 +1,125 @@
+#ifndef SETTINGS_STORE_H
+#define SETTINGS_STORE_H
+
+// Persists a settings struct as a versioned NVS record instead of one key per field.
+//
+// The struct is described by a field table (offset, size, and the per-field key it was stored under
+// before the record existed). Scalars of up to 8 bytes are packed in table order into 64-bit NVS
+// integers; strings (and larger raw fields) each get a key of their own, stored without their unused
+// tail. A small header blob (magic, schema, each field's stored size, CRC-32) says how to read them back.
+// Loading takes every field it knows and leaves the rest at their defaults, so fields can be appended to
+// the table without a migration step; never reorder or reuse an index.
+//
+// settings_store_update() copies the struct, compares it field by field with what was last persisted and
+// only returns; a flush thread writes once updates have been quiet for debounce_ms, or at the latest
+// max_delay_ms after the first unsaved change, so a burst of changes costs one write per changed key and
+// one commit. Only the words and strings that changed are written, so a save never takes more NVS entries
+// than the per-field keys did. Nothing is written when no field changed. A power loss during a flush can
+// leave some of its fields written and others not, as with the per-field keys; each one is whole.
+//
+// When there is no record yet, load reads the legacy per-field keys, writes the record and then erases
+// them.
+//
+// NVS is reached through settings_store_nvs_t, so it also builds on Linux against an emulation
+// (scripts/host/settings_store_check).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "managers/sd_writer.h"
+
+#define SETTINGS_STORE_MAX_FIELDS 64
+#define SETTINGS_STORE_KEY_MAX 11       // Leaves room for the ".w63" / ".f63" suffixes within NVS's 15
+#define SETTINGS_STORE_DEFAULT_DEBOUNCE_MS 1500
+#define SETTINGS_STORE_DEFAULT_MAX_DELAY_MS 10000
+#define SETTINGS_STORE_RETRY_MS 5000
+
+typedef enum {
+    SETTINGS_FIELD_RAW,          // Fixed-size value (integer, enum, bool, float), stored as its bytes
+    SETTINGS_FIELD_STR,          // NUL-terminated string in a char array of the field's size
+} settings_field_kind_t;
+
+// How the field was stored before the record
+typedef enum {
+    SETTINGS_LEGACY_NONE,
+    SETTINGS_LEGACY_U8,          // nvs_set_u8, widened into the field
+    SETTINGS_LEGACY_U16,         // nvs_set_u16, widened into the field
+    SETTINGS_LEGACY_BLOB,        // nvs_set_blob of the field's bytes
+    SETTINGS_LEGACY_STR,         // nvs_set_str
+} settings_legacy_type_t;
+
+typedef struct {
+    uint16_t offset;
+    uint16_t size;
+    settings_field_kind_t kind;
+    const char* legacy_key;      // NULL when the field never had its own key
+    settings_legacy_type_t legacy_type;
+} settings_field_t;
+
+// The subset of the NVS API the store needs, bound to an open handle. get_blob and get_str with
+// out == NULL return the stored length, like nvs_get_blob and nvs_get_str.
+typedef struct {
+    void* ctx;
+    esp_err_t (*get_blob)(void* ctx, const char* key, void* out, size_t* len);
+    esp_err_t (*set_blob)(void* ctx, const char* key, const void* data, size_t len);
+    esp_err_t (*get_u8)(void* ctx, const char* key, uint8_t* out);
+    esp_err_t (*get_u16)(void* ctx, const char* key, uint16_t* out);
+    esp_err_t (*get_u64)(void* ctx, const char* key, uint64_t* out);
+    esp_err_t (*set_u64)(void* ctx, const char* key, uint64_t value);
+    esp_err_t (*get_str)(void* ctx, const char* key, char* out, size_t* len);
+    esp_err_t (*set_str)(void* ctx, const char* key, const char* value);
+    esp_err_t (*erase_key)(void* ctx, const char* key);
+    esp_err_t (*commit)(void* ctx);
+} settings_store_nvs_t;
+
+typedef struct {
+    const char* key;             // NVS key of the record header, at most SETTINGS_STORE_KEY_MAX characters
+    uint16_t schema;             // Bump when the table changes; an older record is rewritten on the next flush
+    const settings_field_t* fields;
+    size_t field_count;
+    size_t data_size;            // sizeof the settings struct
+    settings_store_nvs_t nvs;
+    uint32_t debounce_ms;        // 0 for SETTINGS_STORE_DEFAULT_DEBOUNCE_MS
+    uint32_t max_delay_ms;       // 0 for SETTINGS_STORE_DEFAULT_MAX_DELAY_MS
+    size_t stack_size;           // Flush thread; 0 for the pthread default
+} settings_store_config_t;
+
+typedef enum {
+    SETTINGS_STORE_LOADED_DEFAULTS,
+    SETTINGS_STORE_LOADED_RECORD,
+    SETTINGS_STORE_LOADED_LEGACY,
+} settings_store_source_t;
+
+typedef struct {
+    settings_store_source_t source;
+    uint16_t record_schema;      // Schema of the record that was loaded
+    uint32_t updates;            // settings_store_update calls
+    uint32_t updates_unchanged;  // ... that changed nothing
+    uint32_t flushes;            // Flushes written and committed
+    uint32_t flush_errors;
+    uint32_t bytes_written;
+    uint32_t record_size;        // Bytes the header and all values take, as last loaded or written
+    uint32_t corrupt_records;    // Records ignored for a bad header, length or CRC
+    uint64_t dirty;              // Fields changed since the last flush, by table index
+} settings_store_stats_t;
+
+typedef struct settings_store settings_store_t;
+
+// Starts the flush thread. Returns NULL on a bad table or when out of memory.
+settings_store_t* settings_store_create(const settings_store_config_t* config);
+
+// Flushes anything pending, stops the thread and frees the store
+void settings_store_destroy(settings_store_t* store);
+
+// Fill data (already set to defaults) from the record, or from the legacy keys when there is none
+esp_err_t settings_store_load(settings_store_t* store, void* data);
+
+// Take a copy of data and schedule a write if any field differs from what is stored. Does not block on NVS.
+void settings_store_update(settings_store_t* store, const void* data);
+
+// Write pending changes now (before a restart, for example)
+esp_err_t settings_store_flush(settings_store_t* store);
+
+void settings_store_get_stats(settings_store_t* store, settings_store_stats_t* out);
+
+#endif // SETTINGS_STORE_H
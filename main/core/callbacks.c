@@ -5,36 +5,74 @@
 #include "vendor/pcap.h"
 #include "vendor/GPS/gps_logger.h"
 #include "managers/gps_manager.h"
+#include "core/eapol_tracker.h"
+#include "core/probe_census.h"
+#include "core/wps_survey.h"
+#include "core/live_state.h"
+#include "managers/sd_writer.h"
+#include "managers/views/terminal_screen.h"
+#include <sys/time.h>
 
-#define WPS_OUI 0x0050f204 
 #define TAG "WIFI_MONITOR"
-#define WPS_CONF_METHODS_PBC        0x0080
-#define WPS_CONF_METHODS_PIN_DISPLAY 0x0004
-#define WPS_CONF_METHODS_PIN_KEYPAD  0x0008
 #define WIFI_PKT_DEAUTH 0x0C // Deauth subtype
 #define WIFI_PKT_BEACON 0x08 // Beacon subtype
 #define WIFI_PKT_PROBE_REQ 0x04  // Probe Request subtype
 #define WIFI_PKT_PROBE_RESP 0x05 // Probe Response subtype
 #define WIFI_PKT_EAPOL 0x80
 
-wps_network_t detected_wps_networks[MAX_WPS_NETWORKS];
-int detected_network_count = 0;
 esp_timer_handle_t stop_timer;
-int should_store_wps = 1;
 gps_t *gps = NULL;
 
 void gps_event_handler(void *event_handler_arg, esp_event_base_t event_base, int32_t event_id, void *event_data)
 {
     switch (event_id) {
-    case GPS_UPDATE:
+    case GPS_UPDATE: {
         gps = (gps_t *)event_data;
+        live_state_gps_t fix = {
+            .valid = gps->valid,
+            .fix = (uint8_t)gps->fix,
+            .fix_mode = (uint8_t)gps->fix_mode,
+            .sats_in_use = gps->sats_in_use,
+            .sats_in_view = gps->sats_in_view,
+            .latitude = gps->latitude,
+            .longitude = gps->longitude,
+            .altitude = gps->altitude,
+            .speed = gps->speed,
+            .course = gps->cog,
+            .dop_h = gps->dop_h,
+            .utc_time = gps->tim.hour * 10000u + gps->tim.minute * 100u + gps->tim.second,
+        };
+        if (gps->date.month != 0) {
+            uint32_t year = gps->date.year < 100 ? 2000u + gps->date.year : gps->date.year;
+            fix.utc_date = year * 10000u + gps->date.month * 100u + gps->date.day;
+        }
+        live_state_update_gps(&fix);
         break;
+    }
     default:
         break;
     }
 }
 
 
+// Capture section of /api/state, pulled when a client asks
+void wifi_capture_counters(live_state_capture_t* out) {
+    pcap_capture_stats_t pcap;
+    eapol_tracker_stats_t eapol;
+    sd_writer_metrics_t sd;
+    pcap_get_capture_stats(&pcap);
+    eapol_tracker_get_stats(&eapol);
+    sd_writer_get_metrics(&sd);
+    out->frames_seen = pcap.frames_seen;
+    out->frames_written = pcap.frames_written;
+    out->frames_sampled_out = pcap.frames_sampled_out;
+    out->write_errors = pcap.write_errors;
+    out->handshakes = eapol.handshakes_emitted;
+    out->pmkids = eapol.pmkids_emitted;
+    out->sd_bytes_written = sd.bytes_written;
+    out->sd_bytes_dropped = sd.bytes_dropped;
+}
+
 bool compare_bssid(const uint8_t *bssid1, const uint8_t *bssid2) {
     for (int i = 0; i < 6; i++) {
         if (bssid1[i] != bssid2[i]) {
@@ -44,15 +82,6 @@ bool compare_bssid(const uint8_t *bssid1, const uint8_t *bssid2) {
     return true;
 }
 
-bool is_network_duplicate(const char *ssid, const uint8_t *bssid) {
-    for (int i = 0; i < detected_network_count; i++) {
-        if (strcmp(detected_wps_networks[i].ssid, ssid) == 0 && compare_bssid(detected_wps_networks[i].bssid, bssid)) {
-            return true;
-        }
-    }
-    return false;
-}
-
 void get_frame_type_and_subtype(const wifi_promiscuous_pkt_t *pkt, uint8_t *frame_type, uint8_t *frame_subtype) {
     if (pkt->rx_ctrl.sig_len < 24) {
         *frame_type = 0xFF;
@@ -97,15 +126,7 @@ bool is_probe_response(const wifi_promiscuous_pkt_t *pkt) {
 }
 
 bool is_eapol_response(const wifi_promiscuous_pkt_t *pkt) {
-    const uint8_t *frame = pkt->payload;
-
-    
-    if ((frame[30] == 0x88 && frame[31] == 0x8E) || 
-        (frame[32] == 0x88 && frame[33] == 0x8E)) {
-        return true;
-    }
-
-    return false;
+    return eapol_tracker_is_eapol_frame(pkt->payload, pkt->rx_ctrl.sig_len);
 }
 
 bool is_pwn_response(const wifi_promiscuous_pkt_t *pkt) {
@@ -124,7 +145,7 @@ void wifi_raw_scan_callback(void* buf, wifi_promiscuous_pkt_type_t type)
 {
     wifi_promiscuous_pkt_t *pkt = (wifi_promiscuous_pkt_t *)buf;
 
-    esp_err_t ret = pcap_write_packet_to_buffer(pkt->payload, pkt->rx_ctrl.sig_len);
+    esp_err_t ret = pcap_capture_frame(pkt->payload, pkt->rx_ctrl.sig_len);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Failed to write Raw packet to PCAP buffer.");
     }
@@ -220,13 +241,15 @@ void wardriving_scan_callback(void *buf, wifi_promiscuous_pkt_type_t type) {
 void wifi_eapol_scan_callback(void* buf, wifi_promiscuous_pkt_type_t type)
 {
     wifi_promiscuous_pkt_t *pkt = (wifi_promiscuous_pkt_t *)buf;
-    if (is_eapol_response(pkt))
-    {
-        esp_err_t ret = pcap_write_packet_to_buffer(pkt->payload, pkt->rx_ctrl.sig_len);
-        if (ret != ESP_OK) {
-            printf("Failed to write EAPOL packet to PCAP buffer.");
-        }
+    if (type != WIFI_PKT_MGMT && type != WIFI_PKT_DATA) {
+        return;
     }
+
+    // The tracker pairs handshake messages per BSSID/STA and writes each usable exchange once,
+    // together with the network's beacon, so retransmissions and fragments don't bloat the pcap
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    eapol_tracker_process_frame(pkt->payload, pkt->rx_ctrl.sig_len, &tv);
 }
 
 void wifi_probe_scan_callback(void* buf, wifi_promiscuous_pkt_type_t type) {
@@ -236,13 +259,23 @@ void wifi_probe_scan_callback(void* buf, wifi_promiscuous_pkt_type_t type) {
     if (is_probe_request(pkt) || is_probe_response(pkt)) {
         printf("Probe packet detected, length: %d", pkt->rx_ctrl.sig_len);
         
-        esp_err_t ret = pcap_write_packet_to_buffer(pkt->payload, pkt->rx_ctrl.sig_len);
+        esp_err_t ret = pcap_capture_frame(pkt->payload, pkt->rx_ctrl.sig_len);
         if (ret != ESP_OK) {
             printf("Failed to write Probe packet to PCAP buffer.");
         }
     }
 }
 
+void wifi_probe_census_callback(void* buf, wifi_promiscuous_pkt_type_t type) {
+    wifi_promiscuous_pkt_t *pkt = (wifi_promiscuous_pkt_t *)buf;
+    if (type != WIFI_PKT_MGMT || pkt->rx_ctrl.sig_len <= 4) {
+        return;
+    }
+
+    // sig_len includes the FCS, which must not leak into the IE fingerprint
+    probe_census_process_frame(pkt->payload, pkt->rx_ctrl.sig_len - 4);
+}
+
 
 void wifi_beacon_scan_callback(void* buf, wifi_promiscuous_pkt_type_t type) {
     wifi_promiscuous_pkt_t *pkt = (wifi_promiscuous_pkt_t *)buf;
@@ -252,7 +285,7 @@ void wifi_beacon_scan_callback(void* buf, wifi_promiscuous_pkt_type_t type) {
         printf("Beacon packet detected, length: %d", pkt->rx_ctrl.sig_len);
 
         
-        esp_err_t ret = pcap_write_packet_to_buffer(pkt->payload, pkt->rx_ctrl.sig_len);
+        esp_err_t ret = pcap_capture_frame(pkt->payload, pkt->rx_ctrl.sig_len);
         if (ret != ESP_OK) {
             printf("Failed to write beacon packet to PCAP buffer.");
         }
@@ -268,7 +301,7 @@ void wifi_pwn_scan_callback(void* buf, wifi_promiscuous_pkt_type_t type) {
         printf("Pwn packet detected, length: %d", pkt->rx_ctrl.sig_len);
 
         
-        esp_err_t ret = pcap_write_packet_to_buffer(pkt->payload, pkt->rx_ctrl.sig_len);
+        esp_err_t ret = pcap_capture_frame(pkt->payload, pkt->rx_ctrl.sig_len);
         if (ret != ESP_OK) {
             printf("Failed to write pwn packet to PCAP buffer.");
         }
@@ -283,7 +316,7 @@ void wifi_deauth_scan_callback(void* buf, wifi_promiscuous_pkt_type_t type) {
     if (is_deauth_packet(pkt)) {
         printf("Deauth packet detected, length: %d", pkt->rx_ctrl.sig_len);
         
-        esp_err_t ret = pcap_write_packet_to_buffer(pkt->payload, pkt->rx_ctrl.sig_len);
+        esp_err_t ret = pcap_capture_frame(pkt->payload, pkt->rx_ctrl.sig_len);
         if (ret != ESP_OK) {
             printf("Failed to write deauth packet to PCAP buffer.");
         }
@@ -296,115 +329,23 @@ void wifi_wps_detection_callback(void *buf, wifi_promiscuous_pkt_type_t type) {
     }
 
     const wifi_promiscuous_pkt_t *pkt = (wifi_promiscuous_pkt_t *)buf;
-    const wifi_ieee80211_packet_t *ipkt = (wifi_ieee80211_packet_t *)pkt->payload;
-    const wifi_ieee80211_mac_hdr_t *hdr = &ipkt->hdr;
-
     const uint8_t *payload = pkt->payload;
-    int len = pkt->rx_ctrl.sig_len;
+    int len = pkt->rx_ctrl.sig_len - 4;  // sig_len includes the FCS
 
-   
-    uint8_t frame_type = hdr->frame_ctrl & 0xFC;
-    if (frame_type != 0x80 && frame_type != 0x50) {
+    uint8_t frame_type = payload[0] & 0xFC;
+    if (len < 36 || (frame_type != 0x80 && frame_type != 0x50)) {
         return;
     }
 
-    
-    int index = 36;
-    char ssid[33] = {0};
-    bool wps_found = false;
-    uint8_t bssid[6];
-    memcpy(bssid, hdr->addr3, 6);
-
-    
-    while (index + 1 < len) {
-        uint8_t id = payload[index];
-        uint8_t ie_len = payload[index + 1];
-
-       
-        if (index + 2 + ie_len > len) {
-            break;
-        }
-
-
-        if (id == 0 && ie_len <= 32) {
-            memcpy(ssid, &payload[index + 2], ie_len);
-            ssid[ie_len] = '\0';
-        }
-
-
-        if (is_network_duplicate(ssid, bssid)) {
-            return;
-        }
-
-
-        if (id == 221 && ie_len >= 4) {
-            uint32_t oui = (payload[index + 2] << 16) | (payload[index + 3] << 8) | payload[index + 4];
-            uint8_t oui_type = payload[index + 5];
-
-           
-            if (oui == 0x0050f2 && oui_type == 0x04) {
-                wps_found = true;
-
-                
-                int attr_index = index + 6;
-                int wps_ie_end = index + 2 + ie_len;
-
-                while (attr_index + 4 <= wps_ie_end) {
-                    uint16_t attr_id = (payload[attr_index] << 8) | payload[attr_index + 1];
-                    uint16_t attr_len = (payload[attr_index + 2] << 8) | payload[attr_index + 3];
-
-                    
-                    if (attr_len > (wps_ie_end - (attr_index + 4))) {
-                        break;
-                    }
-
-                    
-                    if (attr_id == 0x1008 && attr_len == 2) {
-                        uint16_t config_methods = (payload[attr_index + 4] << 8) | payload[attr_index + 5];
-
-                       
-                        printf("Configuration Methods found: 0x%04x", config_methods);
-
-                        
-                        if (config_methods & WPS_CONF_METHODS_PBC) {
-                            printf("WPS Push Button detected for network: %s", ssid);
-                        } else if (config_methods & (WPS_CONF_METHODS_PIN_DISPLAY | WPS_CONF_METHODS_PIN_KEYPAD)) {
-                            printf("WPS PIN detected for network: %s", ssid);
-                        } else {
-                            printf("WPS mode not detected (unknown config method) for network: %s", ssid);
-                        }
-
-
-                        if (should_store_wps == 1)
-                        {
-                            wps_network_t new_network;
-                            strncpy(new_network.ssid, ssid, sizeof(new_network.ssid) - 1);
-                            new_network.ssid[sizeof(new_network.ssid) - 1] = '\0';  // Ensure null termination
-                            memcpy(new_network.bssid, bssid, sizeof(new_network.bssid));
-                            new_network.wps_enabled = true;
-                            new_network.wps_mode = config_methods & (WPS_CONF_METHODS_PIN_DISPLAY | WPS_CONF_METHODS_PIN_KEYPAD) ? WPS_MODE_PIN : WPS_MODE_PBC;
-
-                            detected_wps_networks[detected_network_count++] = new_network;
-                        }
-                        else 
-                        {
-                            pcap_write_packet_to_buffer(pkt->payload, pkt->rx_ctrl.sig_len);
-                        }
-                        
-                        if (detected_network_count >= MAX_WPS_NETWORKS) {
-                            printf("Maximum number of WPS networks detected. Stopping monitor mode.");
-                            wifi_manager_stop_monitor_mode();
-                        }     
-
-                    }
-
-
-                    attr_index += (4 + attr_len);
-                }
-            }
-        }
+    // Known BSSIDs cost one hash lookup; each network is parsed and written to the pcap once
+    wps_survey_entry_t entry;
+    if (wps_survey_observe(payload, len, pkt->rx_ctrl.rssi, pkt->rx_ctrl.channel, &entry) != WPS_SURVEY_NEW) {
+        return;
+    }
 
+    printf("WPS %s (%s) detected for network: %s\n", wps_survey_mode_str(entry.mode),
+           entry.ap_setup_locked ? "locked" : "unlocked", entry.ssid);
+    TERMINAL_VIEW_ADD_TEXT("WPS %s: %s\n", wps_survey_mode_str(entry.mode), entry.ssid);
 
-        index += (2 + ie_len);
-    }
+    pcap_write_packet_to_buffer(pkt->payload, pkt->rx_ctrl.sig_len);
 }
\ No newline at end of file
@@ -0,0 +1,216 @@
+#include "core/cbor_writer.h"
+#include <string.h>
+#include <math.h>
+
+_Static_assert(CBOR_WRITER_MAX_DEPTH <= 16, "nesting bits are kept in a 16-bit mask");
+
+#define MAJOR_UINT 0
+#define MAJOR_NEGINT 1
+#define MAJOR_BYTES 2
+#define MAJOR_TEXT 3
+#define MAJOR_ARRAY 4
+#define MAJOR_MAP 5
+#define MAJOR_SIMPLE 7
+
+#define INDEFINITE 31
+#define SIMPLE_FALSE 20
+#define SIMPLE_TRUE 21
+#define SIMPLE_NULL 22
+#define FLOAT32 26
+#define FLOAT64 27
+#define BREAK 0xff
+
+void cbor_writer_init(cbor_writer_t* w, void* buf, size_t cap, cbor_writer_sink_fn sink, void* ctx) {
+    memset(w, 0, sizeof(*w));
+    w->buf = cap > 0 ? buf : NULL;
+    w->cap = cap;
+    w->sink = sink;
+    w->ctx = ctx;
+    w->err = cap > 0 ? ESP_OK : ESP_ERR_INVALID_SIZE;
+}
+
+static void put(cbor_writer_t* w, const void* data, size_t len) {
+    const uint8_t* p = data;
+    while (len > 0 && w->err == ESP_OK) {
+        size_t room = w->cap - w->len;
+        if (room == 0) {
+            if (w->sink == NULL) {
+                w->err = ESP_ERR_INVALID_SIZE;
+                return;
+            }
+            w->err = w->sink(w->ctx, (const char*)w->buf, w->len);
+            w->len = 0;
+            continue;
+        }
+        size_t n = len < room ? len : room;
+        memcpy(w->buf + w->len, p, n);
+        w->len += n;
+        w->total += n;
+        p += n;
+        len -= n;
+    }
+}
+
+// Major type and argument in the shortest form
+static void put_head(cbor_writer_t* w, uint8_t major, uint64_t value) {
+    uint8_t head[9];
+    size_t n;
+    if (value < 24) {
+        head[0] = (uint8_t)(major << 5 | value);
+        n = 1;
+    } else if (value <= UINT8_MAX) {
+        head[0] = (uint8_t)(major << 5 | 24);
+        head[1] = (uint8_t)value;
+        n = 2;
+    } else if (value <= UINT16_MAX) {
+        head[0] = (uint8_t)(major << 5 | 25);
+        n = 3;
+    } else if (value <= UINT32_MAX) {
+        head[0] = (uint8_t)(major << 5 | 26);
+        n = 5;
+    } else {
+        head[0] = (uint8_t)(major << 5 | 27);
+        n = 9;
+    }
+    if (n > 2) {
+        for (size_t i = n - 1; i >= 1; i--) {
+            head[i] = (uint8_t)value;
+            value >>= 8;
+        }
+    }
+    put(w, head, n);
+}
+
+static void put_text(cbor_writer_t* w, const char* s, size_t len) {
+    put_head(w, MAJOR_TEXT, len);
+    put(w, s, len);
+}
+
+// Key before a value inside a map
+static void begin_value(cbor_writer_t* w, const char* key) {
+    if (w->depth == 0 || (w->in_array & (1u << (w->depth - 1)))) {
+        return;
+    }
+    if (key == NULL) {
+        w->err = w->err == ESP_OK ? ESP_ERR_INVALID_ARG : w->err;
+        return;
+    }
+    put_text(w, key, strlen(key));
+}
+
+static void open_level(cbor_writer_t* w, const char* key, bool array) {
+    begin_value(w, key);
+    uint8_t head = (uint8_t)((array ? MAJOR_ARRAY : MAJOR_MAP) << 5 | INDEFINITE);
+    put(w, &head, 1);
+    if (w->depth == CBOR_WRITER_MAX_DEPTH) {
+        w->err = w->err == ESP_OK ? ESP_ERR_INVALID_STATE : w->err;
+        return;
+    }
+    w->depth++;
+    uint16_t bit = (uint16_t)(1u << (w->depth - 1));
+    w->in_array = array ? (uint16_t)(w->in_array | bit) : (uint16_t)(w->in_array & ~bit);
+}
+
+void cbor_writer_map(cbor_writer_t* w, const char* key) {
+    open_level(w, key, false);
+}
+
+void cbor_writer_array(cbor_writer_t* w, const char* key) {
+    open_level(w, key, true);
+}
+
+void cbor_writer_end(cbor_writer_t* w) {
+    if (w->depth == 0) {
+        w->err = w->err == ESP_OK ? ESP_ERR_INVALID_STATE : w->err;
+        return;
+    }
+    uint8_t brk = BREAK;
+    put(w, &brk, 1);
+    w->depth--;
+}
+
+void cbor_writer_string_len(cbor_writer_t* w, const char* key, const char* value, size_t len) {
+    begin_value(w, key);
+    put_text(w, value, len);
+}
+
+void cbor_writer_string(cbor_writer_t* w, const char* key, const char* value) {
+    if (value == NULL) {
+        cbor_writer_null(w, key);
+        return;
+    }
+    cbor_writer_string_len(w, key, value, strlen(value));
+}
+
+void cbor_writer_bytes(cbor_writer_t* w, const char* key, const void* data, size_t len) {
+    begin_value(w, key);
+    put_head(w, MAJOR_BYTES, len);
+    put(w, data, len);
+}
+
+void cbor_writer_uint(cbor_writer_t* w, const char* key, uint64_t value) {
+    begin_value(w, key);
+    put_head(w, MAJOR_UINT, value);
+}
+
+void cbor_writer_int(cbor_writer_t* w, const char* key, int64_t value) {
+    begin_value(w, key);
+    if (value < 0) {
+        // -1 - n is encoded as n
+        put_head(w, MAJOR_NEGINT, (uint64_t)(-(value + 1)));
+    } else {
+        put_head(w, MAJOR_UINT, (uint64_t)value);
+    }
+}
+
+void cbor_writer_double(cbor_writer_t* w, const char* key, double value) {
+    if (isfinite(value) && fabs(value) < 9007199254740992.0 && value == (double)(int64_t)value) {
+        cbor_writer_int(w, key, (int64_t)value);
+        return;
+    }
+    begin_value(w, key);
+    uint8_t out[9];
+    float f = (float)value;
+    if ((double)f == value || isnan(value)) {
+        uint32_t bits;
+        memcpy(&bits, &f, sizeof(bits));
+        out[0] = MAJOR_SIMPLE << 5 | FLOAT32;
+        for (int i = 4; i >= 1; i--) {
+            out[i] = (uint8_t)bits;
+            bits >>= 8;
+        }
+        put(w, out, 5);
+        return;
+    }
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    out[0] = MAJOR_SIMPLE << 5 | FLOAT64;
+    for (int i = 8; i >= 1; i--) {
+        out[i] = (uint8_t)bits;
+        bits >>= 8;
+    }
+    put(w, out, 9);
+}
+
+void cbor_writer_bool(cbor_writer_t* w, const char* key, bool value) {
+    begin_value(w, key);
+    uint8_t b = (uint8_t)(MAJOR_SIMPLE << 5 | (value ? SIMPLE_TRUE : SIMPLE_FALSE));
+    put(w, &b, 1);
+}
+
+void cbor_writer_null(cbor_writer_t* w, const char* key) {
+    begin_value(w, key);
+    uint8_t b = MAJOR_SIMPLE << 5 | SIMPLE_NULL;
+    put(w, &b, 1);
+}
+
+esp_err_t cbor_writer_finish(cbor_writer_t* w) {
+    if (w->sink == NULL) {
+        return w->err;
+    }
+    if (w->len > 0 && w->err == ESP_OK) {
+        w->err = w->sink(w->ctx, (const char*)w->buf, w->len);
+    }
+    w->len = 0;
+    return w->err;
+}
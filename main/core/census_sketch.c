@@ -0,0 +1,108 @@
+#include "core/census_sketch.h"
+#include <string.h>
+#include <math.h>
+
+#define FNV_OFFSET_BASIS 0xcbf29ce484222325ULL
+#define FNV_PRIME 0x100000001b3ULL
+
+void hll_reset(hll_sketch_t *sketch) {
+    memset(sketch->registers, 0, sizeof(sketch->registers));
+}
+
+void hll_add_hash(hll_sketch_t *sketch, uint64_t hash) {
+    uint32_t index = (uint32_t)(hash >> (64 - PROBE_CENSUS_HLL_PRECISION));
+    uint64_t rest = hash << PROBE_CENSUS_HLL_PRECISION;
+    uint8_t rank = rest == 0 ? (64 - PROBE_CENSUS_HLL_PRECISION + 1) : (uint8_t)(__builtin_clzll(rest) + 1);
+
+    if (rank > sketch->registers[index]) {
+        sketch->registers[index] = rank;
+    }
+}
+
+void hll_merge(hll_sketch_t *dst, const hll_sketch_t *src) {
+    for (int i = 0; i < PROBE_CENSUS_HLL_REGISTERS; i++) {
+        if (src->registers[i] > dst->registers[i]) {
+            dst->registers[i] = src->registers[i];
+        }
+    }
+}
+
+uint32_t hll_estimate(const hll_sketch_t *sketch) {
+    const float m = (float)PROBE_CENSUS_HLL_REGISTERS;
+    const float alpha = 0.7213f / (1.0f + 1.079f / m);
+    float sum = 0.0f;
+    int zeros = 0;
+
+    for (int i = 0; i < PROBE_CENSUS_HLL_REGISTERS; i++) {
+        sum += ldexpf(1.0f, -sketch->registers[i]);
+        if (sketch->registers[i] == 0) {
+            zeros++;
+        }
+    }
+
+    float estimate = alpha * m * m / sum;
+
+    // Linear counting is far more accurate while most registers are still empty
+    if (estimate <= 2.5f * m && zeros > 0) {
+        estimate = m * logf(m / (float)zeros);
+    }
+
+    return (uint32_t)(estimate + 0.5f);
+}
+
+static uint64_t fnv1a_update(uint64_t hash, const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        hash ^= data[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+// FNV alone leaves the high bits poorly mixed, and HLL takes its register index from them
+static uint64_t hash_finalize(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+uint64_t probe_census_fingerprint(const uint8_t *frame, size_t len) {
+    const uint8_t *sa = frame + 10;
+    uint64_t hash = FNV_OFFSET_BASIS;
+
+    // A globally administered MAC already identifies the device
+    if (!(sa[0] & 0x02)) {
+        return hash_finalize(fnv1a_update(hash, sa, 6));
+    }
+
+    // Random MACs rotate, but the IE set, its order and the capability contents are a property of
+    // the chipset and driver. Fields that change between probes (SSID, channel) only contribute their ID.
+    for (size_t i = 24; i + 2 <= len; ) {
+        uint8_t id = frame[i];
+        uint8_t ie_len = frame[i + 1];
+        const uint8_t *body = &frame[i + 2];
+        if (i + 2 + ie_len > len) {
+            break;
+        }
+
+        hash = fnv1a_update(hash, &id, 1);
+        switch (id) {
+            case 0:     // SSID
+            case 3:     // DS parameter set
+                break;
+            case 221:   // Vendor specific: OUI and type only, the payload can carry per-probe state
+                hash = fnv1a_update(hash, body, ie_len < 4 ? ie_len : 4);
+                break;
+            default:    // Rates, extended rates, HT/VHT/HE capabilities, extended capabilities, ...
+                hash = fnv1a_update(hash, &ie_len, 1);
+                hash = fnv1a_update(hash, body, ie_len);
+                break;
+        }
+
+        i += 2 + ie_len;
+    }
+
+    return hash_finalize(hash);
+}
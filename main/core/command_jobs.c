@@ -0,0 +1,250 @@
+#include "core/command_jobs.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+typedef struct {
+    uint32_t id;                 // 0 while the slot has never been used
+    command_job_state_t state;
+    int result;
+    uint32_t produced;
+    bool collected;              // Its sink saw the end, or a read returned all of the finished output
+    uint32_t done_ms;
+    command_job_sink_fn sink;
+    void* sink_ctx;
+    char* output;                // COMMAND_JOB_OUTPUT_MAX byte window, followed by the command text
+} command_job_t;
+
+static pthread_mutex_t jobs_lock = PTHREAD_MUTEX_INITIALIZER;
+static command_job_t jobs[COMMAND_JOB_SLOTS];
+static uint32_t next_id = 1;
+static int running = -1;
+static command_jobs_stats_t stats;
+
+static uint32_t now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+static bool id_before(uint32_t a, uint32_t b) {
+    return (int32_t)(a - b) < 0;
+}
+
+static command_job_t* find_job(uint32_t id) {
+    for (int i = 0; i < COMMAND_JOB_SLOTS; i++) {
+        if (jobs[i].id == id && id != 0) {
+            return &jobs[i];
+        }
+    }
+    return NULL;
+}
+
+// An unused slot, else the oldest finished job whose output was collected, else the oldest finished job
+// nobody collected within COMMAND_JOB_KEEP_MS
+static command_job_t* free_slot(void) {
+    command_job_t* best = NULL;
+    uint32_t now = now_ms();
+    for (int i = 0; i < COMMAND_JOB_SLOTS; i++) {
+        command_job_t* job = &jobs[i];
+        if (job->id == 0) {
+            return job;
+        }
+        if (job->state != COMMAND_JOB_DONE || (!job->collected && now - job->done_ms < COMMAND_JOB_KEEP_MS)) {
+            continue;
+        }
+        if (best == NULL || (job->collected && !best->collected) ||
+            (job->collected == best->collected && id_before(job->id, best->id))) {
+            best = job;
+        }
+    }
+    return best;
+}
+
+esp_err_t command_jobs_submit(const char* command, command_job_sink_fn sink, void* sink_ctx, uint32_t* id) {
+    size_t len = strlen(command);
+    if (len == 0 || len >= COMMAND_JOB_TEXT_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    char* buf = malloc(COMMAND_JOB_OUTPUT_MAX + len + 1);
+    if (buf == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    memcpy(buf + COMMAND_JOB_OUTPUT_MAX, command, len + 1);
+
+    pthread_mutex_lock(&jobs_lock);
+    command_job_t* job = free_slot();
+    if (job == NULL) {
+        stats.rejected_busy++;
+        pthread_mutex_unlock(&jobs_lock);
+        free(buf);
+        return ESP_ERR_NO_MEM;
+    }
+    char* old = job->output;
+    job->id = next_id++;
+    if (next_id == 0) {
+        next_id = 1;
+    }
+    job->state = COMMAND_JOB_QUEUED;
+    job->result = 0;
+    job->produced = 0;
+    job->collected = false;
+    job->sink = sink;
+    job->sink_ctx = sink_ctx;
+    job->output = buf;
+    *id = job->id;
+    stats.submitted++;
+    pthread_mutex_unlock(&jobs_lock);
+
+    free(old);
+    return ESP_OK;
+}
+
+bool command_jobs_next(char* command, size_t command_len, uint32_t* id) {
+    pthread_mutex_lock(&jobs_lock);
+    command_job_t* job = NULL;
+    for (int i = 0; i < COMMAND_JOB_SLOTS; i++) {
+        if (jobs[i].id != 0 && jobs[i].state == COMMAND_JOB_QUEUED &&
+            (job == NULL || id_before(jobs[i].id, job->id))) {
+            job = &jobs[i];
+        }
+    }
+    if (job != NULL) {
+        job->state = COMMAND_JOB_RUNNING;
+        running = (int)(job - jobs);
+        *id = job->id;
+        strncpy(command, job->output + COMMAND_JOB_OUTPUT_MAX, command_len - 1);
+        command[command_len - 1] = '\0';
+    }
+    pthread_mutex_unlock(&jobs_lock);
+    return job != NULL;
+}
+
+void command_jobs_output(const char* data, size_t len) {
+    pthread_mutex_lock(&jobs_lock);
+    if (running < 0 || len == 0) {
+        pthread_mutex_unlock(&jobs_lock);
+        return;
+    }
+    command_job_t* job = &jobs[running];
+
+    // Only the last window's worth of a long write can survive
+    const char* src = data;
+    size_t n = len;
+    if (n > COMMAND_JOB_OUTPUT_MAX) {
+        src += n - COMMAND_JOB_OUTPUT_MAX;
+        n = COMMAND_JOB_OUTPUT_MAX;
+    }
+    uint32_t pos = (job->produced + (uint32_t)(len - n)) % COMMAND_JOB_OUTPUT_MAX;
+    size_t first = n < COMMAND_JOB_OUTPUT_MAX - pos ? n : COMMAND_JOB_OUTPUT_MAX - pos;
+    memcpy(job->output + pos, src, first);
+    memcpy(job->output, src + first, n - first);
+
+    uint32_t kept_before = job->produced < COMMAND_JOB_OUTPUT_MAX ? job->produced : COMMAND_JOB_OUTPUT_MAX;
+    if (kept_before + len > COMMAND_JOB_OUTPUT_MAX) {
+        stats.output_skipped += kept_before + len - COMMAND_JOB_OUTPUT_MAX;
+    }
+    job->produced += (uint32_t)len;
+    stats.output_bytes += (uint32_t)len;
+
+    command_job_sink_fn sink = job->sink;
+    void* ctx = job->sink_ctx;
+    uint32_t id = job->id;
+    pthread_mutex_unlock(&jobs_lock);
+
+    if (sink != NULL) {
+        sink(ctx, id, data, len, false, 0);
+    }
+}
+
+void command_jobs_finish(uint32_t id, int result) {
+    pthread_mutex_lock(&jobs_lock);
+    command_job_t* job = find_job(id);
+    if (job == NULL || job->state != COMMAND_JOB_RUNNING) {
+        pthread_mutex_unlock(&jobs_lock);
+        return;
+    }
+    // Anything the sink itself prints no longer belongs to the job
+    running = -1;
+    job->result = result;
+    command_job_sink_fn sink = job->sink;
+    void* ctx = job->sink_ctx;
+    pthread_mutex_unlock(&jobs_lock);
+
+    if (sink != NULL) {
+        sink(ctx, id, NULL, 0, true, result);
+    }
+
+    pthread_mutex_lock(&jobs_lock);
+    job->state = COMMAND_JOB_DONE;
+    job->collected = sink != NULL;
+    job->done_ms = now_ms();
+    job->sink = NULL;
+    job->sink_ctx = NULL;
+    stats.completed++;
+    pthread_mutex_unlock(&jobs_lock);
+}
+
+esp_err_t command_jobs_read(uint32_t id, uint32_t offset, char* out, size_t out_len, size_t* copied,
+                            command_job_info_t* info) {
+    pthread_mutex_lock(&jobs_lock);
+    command_job_t* job = find_job(id);
+    if (job == NULL) {
+        pthread_mutex_unlock(&jobs_lock);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    uint32_t oldest = job->produced > COMMAND_JOB_OUTPUT_MAX ? job->produced - COMMAND_JOB_OUTPUT_MAX : 0;
+    uint32_t start = offset;
+    uint32_t skipped = 0;
+    if (start > job->produced) {
+        start = job->produced;
+    }
+    if (start < oldest) {
+        skipped = oldest - start;
+        start = oldest;
+    }
+    size_t n = job->produced - start;
+    if (n > out_len) {
+        n = out_len;
+    }
+    uint32_t pos = start % COMMAND_JOB_OUTPUT_MAX;
+    size_t first = n < COMMAND_JOB_OUTPUT_MAX - pos ? n : COMMAND_JOB_OUTPUT_MAX - pos;
+    if (n > 0) {
+        memcpy(out, job->output + pos, first);
+        memcpy(out + first, job->output, n - first);
+    }
+
+    if (job->state == COMMAND_JOB_DONE && start + n == job->produced) {
+        job->collected = true;
+    }
+
+    info->id = id;
+    info->state = job->state;
+    info->result = job->result;
+    info->produced = job->produced;
+    info->skipped = skipped;
+    info->next = start + (uint32_t)n;
+    *copied = n;
+    pthread_mutex_unlock(&jobs_lock);
+    return ESP_OK;
+}
+
+void command_jobs_get_stats(command_jobs_stats_t* out) {
+    pthread_mutex_lock(&jobs_lock);
+    *out = stats;
+    out->queued = 0;
+    for (int i = 0; i < COMMAND_JOB_SLOTS; i++) {
+        out->queued += jobs[i].id != 0 && jobs[i].state == COMMAND_JOB_QUEUED;
+    }
+    pthread_mutex_unlock(&jobs_lock);
+}
+
+const char* command_jobs_state_name(command_job_state_t state) {
+    switch (state) {
+        case COMMAND_JOB_QUEUED: return "queued";
+        case COMMAND_JOB_RUNNING: return "running";
+        default: return "done";
+    }
+}
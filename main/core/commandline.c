@@ -13,6 +13,14 @@
 #include "core/callbacks.h"
 #include <esp_timer.h>
 #include "vendor/pcap.h"
+#include "core/eapol_tracker.h"
+#include "core/probe_census.h"
+#include "core/watchlist.h"
+#include "core/wps_survey.h"
+#include "managers/sd_bench.h"
+#include "managers/capture_journal.h"
+#include "core/gzip_stream.h"
+#include "core/lz4_stream.h"
 #include <sys/socket.h>
 #include <netdb.h>
 #include <managers/gps_manager.h>
@@ -528,6 +536,8 @@ void handle_tp_link_test(int argc, char **argv)
     }
 }
 
+static bool wps_survey_active = false;
+
 void handle_capture_scan(int argc, char** argv)
 {
     if (argc != 2) {
@@ -599,6 +609,12 @@ void handle_capture_scan(int argc, char** argv)
             printf("Error: pcap failed to open\n");
             return;
         }
+        if (eapol_tracker_start() != ESP_OK)
+        {
+            printf("Error: EAPOL tracker failed to start\n");
+            pcap_file_close();
+            return;
+        }
         wifi_manager_start_monitor_mode(wifi_eapol_scan_callback);
     }
 
@@ -618,7 +634,8 @@ void handle_capture_scan(int argc, char** argv)
     {
         int err = pcap_file_open("wpsscan");
 
-        should_store_wps = 0;
+        wps_survey_reset();
+        wps_survey_active = true;
         
         if (err != ESP_OK)
         {
@@ -628,10 +645,37 @@ void handle_capture_scan(int argc, char** argv)
         wifi_manager_start_monitor_mode(wifi_wps_detection_callback);
     }
 
+    if (strcmp(capturetype, "-census") == 0)
+    {
+        if (probe_census_start() != ESP_OK)
+        {
+            printf("Error: probe census failed to start\n");
+            return;
+        }
+        wifi_manager_start_monitor_mode(wifi_probe_census_callback);
+    }
+
     if (strcmp(capturetype, "-stop") == 0)
     {
         wifi_manager_stop_monitor_mode();
+        probe_census_stop();
+        eapol_tracker_stop();
         pcap_file_close();
+
+        if (wps_survey_active) {
+            char path[64];
+            wps_survey_active = false;
+            wps_survey_stats_t wps_stats;
+            wps_survey_get_stats(&wps_stats);
+            printf("WPS survey found %lu networks\n", (unsigned long)wps_stats.count);
+            if (wps_stats.dropped_new > 0) {
+                printf("%lu more were not stored: the table reached its limit of %lu\n",
+                       (unsigned long)wps_stats.dropped_new, (unsigned long)wps_stats.max_entries);
+            }
+            if (wps_survey_count() > 0 && wps_survey_export_file(WPS_SURVEY_FORMAT_CSV, path, sizeof(path)) == ESP_OK) {
+                printf("WPS survey saved to %s\n", path);
+            }
+        }
     }
 }
 
@@ -671,6 +715,210 @@ void handle_startwd(int argc, char **argv) {
     }
 }
 
+void handle_capture_config(int argc, char **argv) {
+    pcap_capture_policy_t policy;
+    pcap_get_capture_policy(&policy);
+    uint8_t level;
+    sd_writer_codec_t codec = capture_get_compression(&level);
+
+    for (int i = 1; i < argc; i++) {
+        const char *opt = argv[i];
+        bool has_value = i + 1 < argc;
+
+        if (strcmp(opt, "-reset") == 0) {
+            memset(&policy, 0, sizeof(policy));
+            policy.sample_every[0] = policy.sample_every[1] = policy.sample_every[2] = 1;
+        } else if (strcmp(opt, "-snaplen") == 0 && has_value) {
+            policy.snaplen = strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(opt, "-headers") == 0) {
+            policy.headers_only = true;
+        } else if (strcmp(opt, "-full") == 0) {
+            policy.headers_only = false;
+            policy.snaplen = 0;
+        } else if (strcmp(opt, "-flow") == 0) {
+            policy.per_flow = true;
+        } else if (strcmp(opt, "-count") == 0) {
+            policy.per_flow = false;
+        } else if (strcmp(opt, "-every") == 0 && has_value) {
+            uint16_t n = (uint16_t)strtoul(argv[++i], NULL, 10);
+            policy.sample_every[0] = policy.sample_every[1] = policy.sample_every[2] = n;
+        } else if (strcmp(opt, "-mgmt") == 0 && has_value) {
+            policy.sample_every[0] = (uint16_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(opt, "-ctrl") == 0 && has_value) {
+            policy.sample_every[1] = (uint16_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(opt, "-data") == 0 && has_value) {
+            policy.sample_every[2] = (uint16_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(opt, "-compress") == 0 && has_value) {
+            const char *name = argv[++i];
+            if (strcmp(name, "none") == 0) {
+                codec = SD_WRITER_CODEC_NONE;
+            } else if (strcmp(name, "lz4") == 0) {
+                codec = SD_WRITER_CODEC_LZ4;
+            } else if (strcmp(name, "gzip") == 0 || strcmp(name, "gz") == 0) {
+                codec = SD_WRITER_CODEC_GZIP;
+            } else {
+                printf("Unknown compression: %s (none, lz4 or gzip)\n", name);
+                return;
+            }
+        } else if (strcmp(opt, "-level") == 0 && has_value) {
+            level = (uint8_t)strtoul(argv[++i], NULL, 10);
+        } else {
+            printf("Unknown capturecfg option: %s\n", opt);
+            return;
+        }
+    }
+
+    pcap_set_capture_policy(&policy);
+    capture_set_compression(codec, level);
+    printf("Capture policy (applies to the next capture): snaplen=%lu%s, %s sampling, mgmt 1/%u, ctrl 1/%u, data 1/%u\n",
+           (unsigned long)policy.snaplen, policy.headers_only ? " headers-only" : "",
+           policy.per_flow ? "per-flow" : "1-in-N", policy.sample_every[0], policy.sample_every[1],
+           policy.sample_every[2]);
+    printf("Compression: %s", sd_writer_codec_name(codec));
+    if (codec != SD_WRITER_CODEC_NONE) {
+        printf(" level %u", level ? level : (codec == SD_WRITER_CODEC_LZ4 ? LZ4_STREAM_DEFAULT_LEVEL : GZIP_STREAM_DEFAULT_LEVEL));
+    }
+    printf("\n");
+}
+
+void handle_wps(int argc, char **argv) {
+    if (argc < 2 || strcmp(argv[1], "-list") == 0) {
+        wps_survey_entry_t entry;
+        wps_survey_stats_t stats;
+        wps_survey_get_stats(&stats);
+        printf("%lu WPS networks (limit %lu, %lu not stored)\n", (unsigned long)stats.count,
+               (unsigned long)stats.max_entries, (unsigned long)stats.dropped_new);
+        for (size_t i = 0; wps_survey_get(i, &entry); i++) {
+            printf("[%u] %s %02X:%02X:%02X:%02X:%02X:%02X v%u.%u %s%s %s %s\n", (unsigned)i, entry.ssid,
+                   entry.bssid[0], entry.bssid[1], entry.bssid[2], entry.bssid[3], entry.bssid[4], entry.bssid[5],
+                   entry.version >> 4, entry.version & 0x0F, wps_survey_mode_str(entry.mode),
+                   entry.ap_setup_locked ? " (locked)" : "", entry.manufacturer, entry.model_name);
+        }
+        return;
+    }
+
+    if (strcmp(argv[1], "-export") == 0) {
+        wps_survey_format_t format = (argc > 2 && strcmp(argv[2], "json") == 0) ? WPS_SURVEY_FORMAT_JSON
+                                                                                : WPS_SURVEY_FORMAT_CSV;
+        char path[64];
+        if (wps_survey_export_file(format, path, sizeof(path)) == ESP_OK) {
+            printf("WPS survey saved to %s\n", path);
+            TERMINAL_VIEW_ADD_TEXT("WPS survey saved to %s\n", path);
+        } else {
+            printf("Failed to export WPS survey\n");
+        }
+        return;
+    }
+
+    printf("Usage: wps [-list | -export [csv|json]]\n");
+}
+
+void handle_watchlist(int argc, char **argv) {
+    if (argc < 2) {
+        printf("Usage: watchlist -load [path] | -clear | -status\n");
+        return;
+    }
+
+    if (strcmp(argv[1], "-load") == 0) {
+        const char *path = argc > 2 ? argv[2] : WATCHLIST_DEFAULT_PATH;
+        if (watchlist_load(path) != ESP_OK) {
+            TERMINAL_VIEW_ADD_TEXT("Failed to load watchlist.\n");
+        }
+    } else if (strcmp(argv[1], "-clear") == 0) {
+        watchlist_clear();
+    } else if (strcmp(argv[1], "-status") == 0) {
+        watchlist_stats_t stats;
+        watchlist_get_stats(&stats);
+        printf("Watchlist: %lu MACs, %lu OUIs, %lu SSIDs\n", (unsigned long)stats.macs,
+               (unsigned long)stats.ouis, (unsigned long)stats.ssids);
+        printf("Frames checked: %lu, bloom hits: %lu, confirmed: %lu, alerts dropped: %lu\n",
+               (unsigned long)stats.frames_checked, (unsigned long)stats.bloom_hits,
+               (unsigned long)stats.confirmed_hits, (unsigned long)stats.events_dropped);
+    } else {
+        printf("Unknown watchlist option: %s\n", argv[1]);
+    }
+}
+
+void handle_sdbench(int argc, char **argv) {
+    sd_bench_config_t cfg;
+    sd_bench_default_config(&cfg);
+
+    for (int i = 1; i < argc; i++) {
+        const char *opt = argv[i];
+        bool has_value = i + 1 < argc;
+
+        if (strcmp(opt, "-status") == 0) {
+            sd_bench_result_t *result = malloc(sizeof(*result));
+            if (!result) return;
+            sd_bench_state_t state = sd_bench_get(result);
+            if (state == SD_BENCH_DONE) {
+                sd_bench_print(result);
+            } else {
+                printf("SD benchmark %s\n", state == SD_BENCH_RUNNING ? "running" :
+                       (state == SD_BENCH_FAILED ? "failed" : "not run yet"));
+            }
+            free(result);
+            return;
+        } else if (strcmp(opt, "-size") == 0 && has_value) {
+            cfg.file_bytes = strtoul(argv[++i], NULL, 10) * 1024;
+            cfg.capture_bytes = cfg.file_bytes * 2;
+        } else if (strcmp(opt, "-dir") == 0 && has_value) {
+            cfg.dir = argv[++i];
+        } else {
+            printf("Usage: sdbench [-size KB] [-dir path] | -status\n");
+            return;
+        }
+    }
+
+    if (cfg.file_bytes == 0) {
+        printf("Invalid size\n");
+        return;
+    }
+    esp_err_t ret = sd_bench_start(&cfg);
+    if (ret == ESP_ERR_INVALID_STATE) {
+        printf("SD benchmark already running\n");
+    } else if (ret != ESP_OK) {
+        printf("Failed to start SD benchmark\n");
+    } else {
+        printf("SD benchmark started on %s (%lu KB per block size); results print when done\n",
+               cfg.dir, (unsigned long)(cfg.file_bytes / 1024));
+        TERMINAL_VIEW_ADD_TEXT("SD benchmark started\n");
+    }
+}
+
+void handle_sdstats(int argc, char **argv) {
+    static const uint32_t bounds[] = SD_WRITER_LATENCY_BOUNDS_MS;
+    sd_writer_metrics_t m;
+    sd_writer_get_metrics(&m);
+
+    printf("SD writer: %llu bytes written, %llu dropped, %lu writes (%lu errors), avg %lu us, max %lu us\n",
+           (unsigned long long)m.bytes_written, (unsigned long long)m.bytes_dropped, (unsigned long)m.writes,
+           (unsigned long)m.write_errors, (unsigned long)(m.writes ? m.write_us_total / m.writes : 0),
+           (unsigned long)m.write_us_max);
+    printf("Syncs: %lu, max %lu us; queue high water %lu, backpressure %lu; preallocated extents %lu, max %lu us\n",
+           (unsigned long)m.fsyncs, (unsigned long)m.fsync_us_max, (unsigned long)m.queue_high_water,
+           (unsigned long)m.backpressure_events, (unsigned long)m.prealloc_extents, (unsigned long)m.prealloc_us_max);
+    printf("Write latency:");
+    for (int i = 0; i < SD_WRITER_LATENCY_BUCKETS; i++) {
+        if (i < SD_WRITER_LATENCY_BUCKETS - 1) {
+            printf(" <%lums %lu", (unsigned long)bounds[i], (unsigned long)m.write_latency_hist[i]);
+        } else {
+            printf(" >=%lums %lu", (unsigned long)bounds[i - 1], (unsigned long)m.write_latency_hist[i]);
+        }
+    }
+    printf("\n");
+    if (m.codec_bytes_in > 0) {
+        printf("Compression: %llu -> %llu bytes (%lu%%), %llu ms CPU\n", (unsigned long long)m.codec_bytes_in,
+               (unsigned long long)m.codec_bytes_out, (unsigned long)(m.codec_bytes_out * 100 / m.codec_bytes_in),
+               (unsigned long long)(m.codec_us_total / 1000));
+    }
+
+    if (argc > 1 && strcmp(argv[1], "-reset") == 0) {
+        sd_writer_reset_metrics();
+        printf("SD writer counters reset\n");
+    }
+}
+
 
 void handle_crash(int argc, char **argv)
 {
@@ -771,9 +1019,35 @@ void handle_help(int argc, char **argv) {
     printf("        -raw   :   Start Capturing Raw Packets\n");
     printf("        -wps   :   Start Capturing WPS Packets and there Auth Type");
     printf("        -pwn   :   Start Capturing Pwnagotchi Packets");
+    printf("        -census :  Estimate distinct nearby devices per minute from probe requests\n");
     printf("        -stop   : Stops the active capture\n\n");
 
 
+    printf("capturecfg\n");
+    printf("    Description: Reduce long captures (probe, beacon, deauth, raw, pwn) before frames are copied\n");
+    printf("    Usage: capturecfg [-snaplen N] [-headers | -full] [-every N] [-mgmt N] [-ctrl N] [-data N] [-flow | -count] [-reset]\n");
+    printf("                      [-compress none|lz4|gzip] [-level 1-9]\n");
+    printf("    Sampling keeps 1 in N frames per type (0 drops the type); -flow keeps whole address-pair flows\n");
+    printf("    -compress writes .pcap.lz4 / .pcap.gz (and .csv.*) files; lz4 is cheap on CPU, gzip smaller\n\n");
+
+    printf("wps\n");
+    printf("    Description: List or export networks found by capture -wps\n");
+    printf("    Usage: wps [-list | -export [csv|json]]\n\n");
+
+    printf("watchlist\n");
+    printf("    Description: Alert when a listed MAC, OUI or SSID is seen during any capture\n");
+    printf("    Usage: watchlist -load [path] | -clear | -status\n");
+    printf("    Default path: %s (one MAC, OUI or ssid:<name> per line)\n\n", WATCHLIST_DEFAULT_PATH);
+
+    printf("sdbench\n");
+    printf("    Description: Benchmark the SD card (throughput per block size, append latency, metadata, free space)\n");
+    printf("    Usage: sdbench [-size KB] [-dir path] | -status\n");
+    printf("    Runs in the background and recommends an SD writer buffer size\n\n");
+
+    printf("sdstats\n");
+    printf("    Description: Show SD writer counters and the write latency histogram\n");
+    printf("    Usage: sdstats [-reset]\n\n");
+
     printf("connect\n");
     printf("    Description: Connects to Specific WiFi Network\n");
     printf("    Usage: connect <SSID> <Password>\n");
@@ -810,6 +1084,11 @@ void register_commands() {
     register_command("stop", handle_stop_flipper);
     register_command("reboot", handle_reboot);
     register_command("startwd", handle_startwd);
+    register_command("watchlist", handle_watchlist);
+    register_command("wps", handle_wps);
+    register_command("capturecfg", handle_capture_config);
+    register_command("sdbench", handle_sdbench);
+    register_command("sdstats", handle_sdstats);
 #ifdef DEBUG
     register_command("crash", handle_crash); // For Debugging
 #endif
@@ -0,0 +1,732 @@
+#include "core/eapol_tracker.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#ifdef ESP_PLATFORM
+#include "vendor/pcap.h"
+#include "managers/views/terminal_screen.h"
+#include <esp_log.h>
+#include "esp_pthread.h"
+#else
+// Host builds (scripts/host/eapol_replay) provide the two pcap calls
+#define ESP_LOGE(tag, fmt, ...) fprintf(stderr, "E %s: " fmt "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...) fprintf(stderr, "W %s: " fmt "\n", tag, ##__VA_ARGS__)
+#define TERMINAL_VIEW_ADD_TEXT(...) ((void)0)
+#define MAX_FILE_NAME_LENGTH 528
+esp_err_t pcap_write_packet_with_time(const void* packet, size_t length, const struct timeval* tv);
+const char* pcap_get_file_name(void);
+#endif
+
+static const char *TAG = "EAPOL_TRACKER";
+
+#define IEEE80211_HDR_LEN 24
+#define LLC_SNAP_LEN 8
+#define EAPOL_KEY_MIN_LEN 99   // EAPOL header + key descriptor up to (and including) key data length
+#define EAPOL_TYPE_KEY 3
+#define EAPOL_DESC_RSN 2
+#define EAPOL_DESC_WPA 254
+
+// Offsets inside the EAPOL PDU (starting at the protocol version byte)
+#define EAPOL_OFF_KEY_INFO 5
+#define EAPOL_OFF_REPLAY 9
+#define EAPOL_OFF_NONCE 17
+#define EAPOL_OFF_MIC 81
+#define EAPOL_OFF_KEY_DATA_LEN 97
+#define EAPOL_OFF_KEY_DATA 99
+#define EAPOL_NONCE_LEN 32
+#define EAPOL_MIC_LEN 16
+
+#define KEY_INFO_PAIRWISE 0x0008
+#define KEY_INFO_INSTALL 0x0040
+#define KEY_INFO_ACK 0x0080
+#define KEY_INFO_MIC 0x0100
+#define KEY_INFO_SECURE 0x0200
+
+enum { MSG_M1 = 0, MSG_M2, MSG_M3, MSG_M4, MSG_COUNT };
+
+typedef struct {
+    bool present;
+    uint64_t replay;
+    struct timeval ts;
+    uint16_t frame_len;
+    uint16_t eapol_off;   // Offset of the EAPOL PDU inside frame
+    uint16_t eapol_len;
+    uint8_t frame[EAPOL_TRACKER_MAX_FRAME_LEN];
+} eapol_msg_t;
+
+typedef struct {
+    bool in_use;
+    bool emitted;          // A usable pair of this exchange has been written
+    bool pmkid_emitted;
+    uint8_t written_mask;  // Messages of this exchange already in the pcap
+    uint32_t last_seen;
+    uint8_t bssid[6];
+    uint8_t sta[6];
+    eapol_msg_t msg[MSG_COUNT];
+} eapol_session_t;
+
+typedef struct {
+    bool in_use;
+    bool beacon_written;
+    uint8_t bssid[6];
+    uint8_t ssid[32];
+    uint8_t ssid_len;
+    uint32_t last_seen;
+    struct timeval beacon_ts;
+    uint16_t beacon_len;
+    uint8_t beacon[EAPOL_TRACKER_MAX_BEACON_LEN];
+} eapol_ap_t;
+
+// What a 22000 line needs, copied out of the session so the output thread never touches tracker state
+typedef struct {
+    uint8_t type;          // 1 PMKID, 2 EAPOL (the WPA*0n field)
+    uint8_t pair;
+    uint8_t bssid[6];
+    uint8_t sta[6];
+    uint8_t ssid_len;
+    uint8_t ssid[32];
+    uint8_t mic[EAPOL_MIC_LEN];           // Or the PMKID
+    uint8_t anonce[EAPOL_NONCE_LEN];
+    uint16_t eapol_len;
+    uint8_t eapol[EAPOL_TRACKER_MAX_EAPOL_LEN];  // MIC field zeroed
+} eapol_hash_t;
+
+#define HASH_LINE_SIZE (128 + 2 * (EAPOL_MIC_LEN + 32 + EAPOL_NONCE_LEN + EAPOL_TRACKER_MAX_EAPOL_LEN))
+
+typedef struct {
+    eapol_session_t sessions[EAPOL_TRACKER_MAX_SESSIONS];
+    eapol_ap_t aps[EAPOL_TRACKER_MAX_APS];
+    uint32_t clock;
+    FILE *hash_file;       // Owned by the output thread while it runs
+
+    // Finished hashes on their way from the RX callback to the output thread
+    pthread_mutex_t lock;
+    pthread_cond_t ready;
+    pthread_t thread;
+    bool stopping;
+    unsigned queue_head;
+    unsigned queue_count;
+    eapol_hash_t queue[EAPOL_TRACKER_HASH_QUEUE];
+} eapol_tracker_t;
+
+static eapol_tracker_t *tracker = NULL;
+
+// Outside the tracker so /api/state can read them while a capture starts or stops
+static eapol_tracker_stats_t stats;
+
+static uint16_t read_be16(const uint8_t *p) {
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static uint64_t read_be64(const uint8_t *p) {
+    uint64_t v = 0;
+    for (int i = 0; i < 8; i++) {
+        v = (v << 8) | p[i];
+    }
+    return v;
+}
+
+static bool is_all_zero(const uint8_t *p, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if (p[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void hex_append(char *out, size_t *pos, size_t out_size, const uint8_t *data, size_t len) {
+    static const char digits[] = "0123456789abcdef";
+    for (size_t i = 0; i < len && *pos + 2 < out_size; i++) {
+        out[(*pos)++] = digits[data[i] >> 4];
+        out[(*pos)++] = digits[data[i] & 0x0F];
+    }
+    out[*pos] = '\0';
+}
+
+// Locate the EAPOL PDU of a data frame. Returns the PDU length (from the EAPOL header, so a trailing FCS
+// is ignored) or 0 if the frame is not an unencrypted EAPOL data frame.
+static size_t locate_eapol(const uint8_t *frame, size_t len, size_t *eapol_off) {
+    if (len < IEEE80211_HDR_LEN) {
+        return 0;
+    }
+
+    uint8_t fc0 = frame[0];
+    uint8_t fc1 = frame[1];
+    if (((fc0 >> 2) & 0x03) != 2 || (fc1 & 0x40)) {
+        return 0;  // Not a data frame, or protected
+    }
+
+    size_t hdr_len = IEEE80211_HDR_LEN;
+    if ((fc1 & 0x03) == 0x03) {
+        hdr_len += 6;  // Four address frame
+    }
+    if (fc0 & 0x80) {
+        hdr_len += 2;  // QoS control
+        if (fc1 & 0x80) {
+            hdr_len += 4;  // HT control
+        }
+    }
+
+    if (len < hdr_len + LLC_SNAP_LEN + 4) {
+        return 0;
+    }
+
+    static const uint8_t llc_eapol[LLC_SNAP_LEN] = {0xAA, 0xAA, 0x03, 0x00, 0x00, 0x00, 0x88, 0x8E};
+    if (memcmp(frame + hdr_len, llc_eapol, LLC_SNAP_LEN) != 0) {
+        return 0;
+    }
+
+    size_t off = hdr_len + LLC_SNAP_LEN;
+    size_t pdu_len = 4 + read_be16(frame + off + 2);
+    if (pdu_len > len - off) {
+        return 0;
+    }
+
+    *eapol_off = off;
+    return pdu_len;
+}
+
+bool eapol_tracker_is_eapol_frame(const uint8_t *frame, size_t len) {
+    size_t off;
+    return frame != NULL && locate_eapol(frame, len, &off) > 0;
+}
+
+static eapol_ap_t *find_ap(const uint8_t *bssid) {
+    for (int i = 0; i < EAPOL_TRACKER_MAX_APS; i++) {
+        if (tracker->aps[i].in_use && memcmp(tracker->aps[i].bssid, bssid, 6) == 0) {
+            return &tracker->aps[i];
+        }
+    }
+    return NULL;
+}
+
+static eapol_ap_t *alloc_ap(const uint8_t *bssid) {
+    eapol_ap_t *victim = &tracker->aps[0];
+    for (int i = 0; i < EAPOL_TRACKER_MAX_APS; i++) {
+        eapol_ap_t *ap = &tracker->aps[i];
+        if (!ap->in_use) {
+            victim = ap;
+            break;
+        }
+        if (ap->last_seen < victim->last_seen) {
+            victim = ap;
+        }
+    }
+
+    memset(victim, 0, sizeof(*victim));
+    victim->in_use = true;
+    memcpy(victim->bssid, bssid, 6);
+    return victim;
+}
+
+static eapol_session_t *find_session(const uint8_t *bssid, const uint8_t *sta, bool create) {
+    eapol_session_t *free_slot = NULL;
+    eapol_session_t *oldest_done = NULL;
+    eapol_session_t *oldest = NULL;
+
+    for (int i = 0; i < EAPOL_TRACKER_MAX_SESSIONS; i++) {
+        eapol_session_t *s = &tracker->sessions[i];
+        if (!s->in_use) {
+            if (free_slot == NULL) {
+                free_slot = s;
+            }
+            continue;
+        }
+        if (memcmp(s->bssid, bssid, 6) == 0 && memcmp(s->sta, sta, 6) == 0) {
+            return s;
+        }
+        if (s->emitted && (oldest_done == NULL || s->last_seen < oldest_done->last_seen)) {
+            oldest_done = s;
+        }
+        if (oldest == NULL || s->last_seen < oldest->last_seen) {
+            oldest = s;
+        }
+    }
+
+    if (!create) {
+        return NULL;
+    }
+
+    // Prefer dropping exchanges we already wrote out over ones still being assembled
+    eapol_session_t *s = free_slot ? free_slot : (oldest_done ? oldest_done : oldest);
+    if (s->in_use && !s->emitted) {
+        stats.sessions_evicted++;
+    }
+    memset(s, 0, sizeof(*s));
+    s->in_use = true;
+    memcpy(s->bssid, bssid, 6);
+    memcpy(s->sta, sta, 6);
+    return s;
+}
+
+static void reset_exchange(eapol_session_t *s) {
+    for (int i = 0; i < MSG_COUNT; i++) {
+        s->msg[i].present = false;
+    }
+    s->emitted = false;
+    s->pmkid_emitted = false;
+    s->written_mask = 0;
+}
+
+static const uint8_t *msg_eapol(const eapol_msg_t *m) {
+    return m->frame + m->eapol_off;
+}
+
+static void write_pcap_messages(eapol_session_t *s) {
+    for (int i = 0; i < MSG_COUNT; i++) {
+        eapol_msg_t *m = &s->msg[i];
+        if (m->present && !(s->written_mask & (1 << i))) {
+            pcap_write_packet_with_time(m->frame, m->frame_len, &m->ts);
+            s->written_mask |= (1 << i);
+        }
+    }
+}
+
+// Hand a finished hash to the output thread. The RX path only copies; formatting, the SD card and the
+// console are the thread's business.
+static void queue_hash(const eapol_hash_t *hash) {
+    pthread_mutex_lock(&tracker->lock);
+    if (tracker->queue_count == EAPOL_TRACKER_HASH_QUEUE) {
+        pthread_mutex_unlock(&tracker->lock);
+        stats.hashes_dropped++;
+        return;
+    }
+    unsigned tail = (tracker->queue_head + tracker->queue_count) % EAPOL_TRACKER_HASH_QUEUE;
+    tracker->queue[tail] = *hash;
+    tracker->queue_count++;
+    pthread_cond_signal(&tracker->ready);
+    pthread_mutex_unlock(&tracker->lock);
+}
+
+// Only the RX callback emits, and the queue takes a copy
+static eapol_hash_t scratch;
+
+static void emit_pmkid(eapol_session_t *s, const eapol_ap_t *ap, const uint8_t *pmkid) {
+    memset(&scratch, 0, sizeof(scratch));
+    scratch.type = 1;
+    scratch.ssid_len = ap->ssid_len;
+    memcpy(scratch.bssid, s->bssid, 6);
+    memcpy(scratch.sta, s->sta, 6);
+    memcpy(scratch.ssid, ap->ssid, ap->ssid_len);
+    memcpy(scratch.mic, pmkid, 16);
+
+    s->pmkid_emitted = true;
+    stats.pmkids_emitted++;
+    queue_hash(&scratch);
+}
+
+static void emit_handshake(eapol_session_t *s, eapol_ap_t *ap, eapol_message_pair_t pair) {
+    const eapol_msg_t *nonce_msg;
+    const eapol_msg_t *mic_msg;
+
+    switch (pair) {
+        case EAPOL_PAIR_M1M2_M2: nonce_msg = &s->msg[MSG_M1]; mic_msg = &s->msg[MSG_M2]; break;
+        case EAPOL_PAIR_M1M4_M4: nonce_msg = &s->msg[MSG_M1]; mic_msg = &s->msg[MSG_M4]; break;
+        case EAPOL_PAIR_M2M3_M2: nonce_msg = &s->msg[MSG_M3]; mic_msg = &s->msg[MSG_M2]; break;
+        default: return;
+    }
+
+    if (ap->beacon_len > 0 && !ap->beacon_written) {
+        pcap_write_packet_with_time(ap->beacon, ap->beacon_len, &ap->beacon_ts);
+        ap->beacon_written = true;
+    }
+    write_pcap_messages(s);
+    s->emitted = true;
+    stats.handshakes_emitted++;
+
+    if (mic_msg->eapol_len > EAPOL_TRACKER_MAX_EAPOL_LEN) {
+        stats.hashes_dropped++;  // In the pcap, but too long for a 22000 line
+        return;
+    }
+
+    // The MIC is computed over the EAPOL PDU with the MIC field zeroed
+    memset(&scratch, 0, sizeof(scratch));
+    scratch.type = 2;
+    scratch.pair = (uint8_t)pair;
+    memcpy(scratch.bssid, s->bssid, 6);
+    memcpy(scratch.sta, s->sta, 6);
+    scratch.ssid_len = ap->ssid_len;
+    memcpy(scratch.ssid, ap->ssid, ap->ssid_len);
+    memcpy(scratch.mic, msg_eapol(mic_msg) + EAPOL_OFF_MIC, EAPOL_MIC_LEN);
+    memcpy(scratch.anonce, msg_eapol(nonce_msg) + EAPOL_OFF_NONCE, EAPOL_NONCE_LEN);
+    scratch.eapol_len = mic_msg->eapol_len;
+    memcpy(scratch.eapol, msg_eapol(mic_msg), mic_msg->eapol_len);
+    memset(scratch.eapol + EAPOL_OFF_MIC, 0, EAPOL_MIC_LEN);
+    queue_hash(&scratch);
+}
+
+static eapol_message_pair_t usable_pair(const eapol_session_t *s) {
+    const eapol_msg_t *m1 = &s->msg[MSG_M1];
+    const eapol_msg_t *m2 = &s->msg[MSG_M2];
+    const eapol_msg_t *m3 = &s->msg[MSG_M3];
+    const eapol_msg_t *m4 = &s->msg[MSG_M4];
+
+    if (m1->present && m2->present && m2->replay == m1->replay) {
+        return EAPOL_PAIR_M1M2_M2;
+    }
+    if (m2->present && m3->present && m3->replay == m2->replay + 1) {
+        return EAPOL_PAIR_M2M3_M2;
+    }
+    if (m1->present && m4->present && m4->replay == m1->replay + 1 &&
+        !is_all_zero(msg_eapol(m4) + EAPOL_OFF_NONCE, EAPOL_NONCE_LEN)) {
+        return EAPOL_PAIR_M1M4_M4;
+    }
+    return EAPOL_PAIR_NONE;
+}
+
+// Emit whatever became writable for this session now that a message or the network name arrived
+static void try_emit(eapol_session_t *s) {
+    eapol_ap_t *ap = find_ap(s->bssid);
+    if (ap == NULL || ap->ssid_len == 0) {
+        return;  // Hold until the network is identified
+    }
+
+    if (!s->pmkid_emitted && s->msg[MSG_M1].present) {
+        const eapol_msg_t *m1 = &s->msg[MSG_M1];
+        const uint8_t *eapol = msg_eapol(m1);
+        size_t kd_len = read_be16(eapol + EAPOL_OFF_KEY_DATA_LEN);
+        const uint8_t *kd = eapol + EAPOL_OFF_KEY_DATA;
+
+        // PMKID KDE: dd 14 00 0f ac 04 <PMKID>
+        for (size_t i = 0; i + 2 <= kd_len; i += 2 + kd[i + 1]) {
+            if (kd[i] == 0xDD && kd[i + 1] >= 20 && i + 2 + 20 <= kd_len &&
+                kd[i + 2] == 0x00 && kd[i + 3] == 0x0F && kd[i + 4] == 0xAC && kd[i + 5] == 0x04) {
+                if (!is_all_zero(&kd[i + 6], 16)) {
+                    emit_pmkid(s, ap, &kd[i + 6]);
+                }
+                break;
+            }
+        }
+    }
+
+    if (s->emitted) {
+        write_pcap_messages(s);  // Later messages of an exchange we already wrote complete it
+        return;
+    }
+
+    eapol_message_pair_t pair = usable_pair(s);
+    if (pair != EAPOL_PAIR_NONE) {
+        emit_handshake(s, ap, pair);
+    }
+}
+
+static void observe_beacon(const uint8_t *frame, size_t len, bool is_beacon, const struct timeval *ts) {
+    if (len < 36) {
+        return;
+    }
+
+    const uint8_t *bssid = frame + 16;
+    uint8_t ssid[32];
+    uint8_t ssid_len = 0;
+
+    for (size_t i = 36; i + 2 <= len; i += 2 + frame[i + 1]) {
+        uint8_t id = frame[i];
+        uint8_t ie_len = frame[i + 1];
+        if (i + 2 + ie_len > len) {
+            break;
+        }
+        if (id == 0) {
+            if (ie_len <= sizeof(ssid) && !is_all_zero(&frame[i + 2], ie_len)) {
+                memcpy(ssid, &frame[i + 2], ie_len);
+                ssid_len = ie_len;
+            }
+            break;
+        }
+    }
+
+    eapol_ap_t *ap = find_ap(bssid);
+    bool learned_ssid = false;
+    if (ap == NULL) {
+        if (ssid_len == 0 && !is_beacon) {
+            return;
+        }
+        ap = alloc_ap(bssid);
+    }
+    ap->last_seen = ++tracker->clock;
+
+    if (ap->ssid_len == 0 && ssid_len > 0) {
+        memcpy(ap->ssid, ssid, ssid_len);
+        ap->ssid_len = ssid_len;
+        learned_ssid = true;
+    }
+
+    // Keep the first beacon; fall back to a probe response for hidden networks
+    if (ap->beacon_len == 0 && (is_beacon || ssid_len > 0)) {
+        ap->beacon_len = len > EAPOL_TRACKER_MAX_BEACON_LEN ? EAPOL_TRACKER_MAX_BEACON_LEN : len;
+        memcpy(ap->beacon, frame, ap->beacon_len);
+        ap->beacon_ts = *ts;
+    }
+
+    if (learned_ssid) {
+        for (int i = 0; i < EAPOL_TRACKER_MAX_SESSIONS; i++) {
+            eapol_session_t *s = &tracker->sessions[i];
+            if (s->in_use && !s->emitted && memcmp(s->bssid, bssid, 6) == 0) {
+                try_emit(s);
+            }
+        }
+    }
+}
+
+static void observe_eapol(const uint8_t *frame, size_t eapol_off, size_t eapol_len,
+                          const struct timeval *ts) {
+    const uint8_t *eapol = frame + eapol_off;
+
+    if (eapol[1] != EAPOL_TYPE_KEY) {
+        return;  // EAP identity etc.
+    }
+    if (eapol_len < EAPOL_KEY_MIN_LEN || (eapol[4] != EAPOL_DESC_RSN && eapol[4] != EAPOL_DESC_WPA) ||
+        EAPOL_KEY_MIN_LEN + (size_t)read_be16(eapol + EAPOL_OFF_KEY_DATA_LEN) > eapol_len) {
+        stats.frames_malformed++;
+        return;
+    }
+
+    stats.frames_seen++;
+
+    uint16_t key_info = read_be16(eapol + EAPOL_OFF_KEY_INFO);
+    if (!(key_info & KEY_INFO_PAIRWISE)) {
+        return;  // Group key handshake
+    }
+
+    const uint8_t *nonce = eapol + EAPOL_OFF_NONCE;
+    int idx;
+    if (key_info & KEY_INFO_ACK) {
+        idx = (key_info & KEY_INFO_MIC) ? MSG_M3 : MSG_M1;
+    } else if (!(key_info & KEY_INFO_MIC)) {
+        return;
+    } else {
+        // WPA1 M4 lacks the secure bit, but unlike M2 it never carries an SNonce
+        idx = (!(key_info & KEY_INFO_SECURE) && !is_all_zero(nonce, EAPOL_NONCE_LEN)) ? MSG_M2 : MSG_M4;
+    }
+
+    uint8_t fc1 = frame[1];
+    const uint8_t *bssid;
+    const uint8_t *sta;
+    if ((fc1 & 0x03) == 0x02) {         // From DS: AP -> STA
+        bssid = frame + 10;
+        sta = frame + 4;
+    } else if ((fc1 & 0x03) == 0x01) {  // To DS: STA -> AP
+        bssid = frame + 4;
+        sta = frame + 10;
+    } else {
+        return;
+    }
+
+    if (eapol_off + eapol_len > EAPOL_TRACKER_MAX_FRAME_LEN) {
+        stats.frames_malformed++;
+        return;
+    }
+
+    eapol_session_t *s = find_session(bssid, sta, true);
+    s->last_seen = ++tracker->clock;
+    uint64_t replay = read_be64(eapol + EAPOL_OFF_REPLAY);
+    eapol_msg_t *m = &s->msg[idx];
+
+    // A different ANonce means the AP started a new exchange
+    if (idx == MSG_M1 || idx == MSG_M3) {
+        const eapol_msg_t *anonce_src = s->msg[MSG_M1].present ? &s->msg[MSG_M1]
+                                      : (s->msg[MSG_M3].present ? &s->msg[MSG_M3] : NULL);
+        if (anonce_src && memcmp(msg_eapol(anonce_src) + EAPOL_OFF_NONCE, nonce, EAPOL_NONCE_LEN) != 0) {
+            if (idx == MSG_M1) {
+                reset_exchange(s);
+            } else {
+                s->msg[MSG_M1].present = false;  // Stale M1; M2 may still pair with this M3
+            }
+        }
+    }
+
+    if (m->present && m->replay == replay) {
+        stats.duplicates_dropped++;
+        return;
+    }
+
+    m->present = true;
+    m->replay = replay;
+    m->ts = *ts;
+    m->frame_len = eapol_off + eapol_len;
+    m->eapol_off = eapol_off;
+    m->eapol_len = eapol_len;
+    memcpy(m->frame, frame, m->frame_len);
+    s->written_mask &= ~(1 << idx);
+
+    try_emit(s);
+}
+
+void eapol_tracker_process_frame(const uint8_t *frame, size_t len, const struct timeval *ts) {
+    if (tracker == NULL || frame == NULL || len < IEEE80211_HDR_LEN) {
+        return;
+    }
+
+    uint8_t type = (frame[0] >> 2) & 0x03;
+    uint8_t subtype = frame[0] >> 4;
+
+    if (type == 0 && (subtype == 0x08 || subtype == 0x05)) {
+        observe_beacon(frame, len, subtype == 0x08, ts);
+        return;
+    }
+
+    size_t eapol_off;
+    size_t eapol_len = locate_eapol(frame, len, &eapol_off);
+    if (eapol_len > 0) {
+        observe_eapol(frame, eapol_off, eapol_len, ts);
+    }
+}
+
+// WPA*01*PMKID*MAC_AP*MAC_CLIENT*ESSID***
+// WPA*02*MIC*MAC_AP*MAC_CLIENT*ESSID*ANONCE*EAPOL*MESSAGEPAIR
+static void format_hash_line(const eapol_hash_t *hash, char *line, size_t size) {
+    size_t pos = snprintf(line, size, "WPA*%02u*", (unsigned)hash->type);
+    hex_append(line, &pos, size, hash->mic, EAPOL_MIC_LEN);
+    line[pos++] = '*';
+    hex_append(line, &pos, size, hash->bssid, 6);
+    line[pos++] = '*';
+    hex_append(line, &pos, size, hash->sta, 6);
+    line[pos++] = '*';
+    hex_append(line, &pos, size, hash->ssid, hash->ssid_len);
+    if (hash->type == 1) {
+        snprintf(line + pos, size - pos, "***");
+        return;
+    }
+    line[pos++] = '*';
+    hex_append(line, &pos, size, hash->anonce, EAPOL_NONCE_LEN);
+    line[pos++] = '*';
+    hex_append(line, &pos, size, hash->eapol, hash->eapol_len);
+    snprintf(line + pos, size - pos, "*%02x", (unsigned)hash->pair);
+}
+
+static void *output_thread(void *arg) {
+    static char line[HASH_LINE_SIZE];
+    eapol_hash_t out;
+
+    pthread_mutex_lock(&tracker->lock);
+    for (;;) {
+        while (tracker->queue_count == 0 && !tracker->stopping) {
+            pthread_cond_wait(&tracker->ready, &tracker->lock);
+        }
+        if (tracker->queue_count == 0) {
+            break;  // Stopping, and everything queued is written
+        }
+        out = tracker->queue[tracker->queue_head];
+        tracker->queue_head = (tracker->queue_head + 1) % EAPOL_TRACKER_HASH_QUEUE;
+        tracker->queue_count--;
+        pthread_mutex_unlock(&tracker->lock);
+
+        format_hash_line(&out, line, sizeof(line));
+        if (tracker->hash_file != NULL) {
+            fputs(line, tracker->hash_file);
+            fputc('\n', tracker->hash_file);
+            fflush(tracker->hash_file);
+        } else {
+            printf("%s\n", line);
+        }
+        if (out.type == 2) {
+            printf("Handshake captured for %.*s (%02x:%02x:%02x:%02x:%02x:%02x)\n", out.ssid_len,
+                   (const char *)out.ssid, out.sta[0], out.sta[1], out.sta[2], out.sta[3], out.sta[4],
+                   out.sta[5]);
+            TERMINAL_VIEW_ADD_TEXT("Handshake captured for %.*s\n", out.ssid_len, (const char *)out.ssid);
+        }
+
+        pthread_mutex_lock(&tracker->lock);
+    }
+    pthread_mutex_unlock(&tracker->lock);
+    return NULL;
+}
+
+esp_err_t eapol_tracker_start(void) {
+    if (tracker != NULL) {
+        eapol_tracker_stop();
+    }
+
+    tracker = calloc(1, sizeof(eapol_tracker_t));
+    if (tracker == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate %u bytes for the EAPOL tracker", (unsigned)sizeof(eapol_tracker_t));
+        return ESP_ERR_NO_MEM;
+    }
+    memset(&stats, 0, sizeof(stats));
+
+    const char *pcap_name = pcap_get_file_name();
+    if (pcap_name != NULL) {
+        char hash_name[MAX_FILE_NAME_LENGTH];
+        strncpy(hash_name, pcap_name, sizeof(hash_name) - 1);
+        hash_name[sizeof(hash_name) - 1] = '\0';
+
+        char *ext = strrchr(hash_name, '.');
+        if (ext != NULL && (size_t)(ext - hash_name) + sizeof(".22000") <= sizeof(hash_name)) {
+            strcpy(ext, ".22000");
+            tracker->hash_file = fopen(hash_name, "w");
+        }
+        if (tracker->hash_file == NULL) {
+            ESP_LOGW(TAG, "Failed to open hash file, hashes will be printed to serial");
+        } else {
+            printf("Writing hashcat 22000 lines to %s\n", hash_name);
+        }
+    }
+
+    pthread_mutex_init(&tracker->lock, NULL);
+    pthread_cond_init(&tracker->ready, NULL);
+
+#ifdef ESP_PLATFORM
+    esp_pthread_cfg_t pthread_cfg = esp_pthread_get_default_config();
+    pthread_cfg.stack_size = 4096;
+    pthread_cfg.thread_name = "eapol_out";
+    esp_pthread_set_cfg(&pthread_cfg);
+#endif
+
+    int err = pthread_create(&tracker->thread, NULL, output_thread, NULL);
+
+#ifdef ESP_PLATFORM
+    pthread_cfg = esp_pthread_get_default_config();
+    esp_pthread_set_cfg(&pthread_cfg);
+#endif
+
+    if (err != 0) {
+        ESP_LOGE(TAG, "Failed to start the hash output thread");
+        if (tracker->hash_file != NULL) {
+            fclose(tracker->hash_file);
+        }
+        pthread_cond_destroy(&tracker->ready);
+        pthread_mutex_destroy(&tracker->lock);
+        free(tracker);
+        tracker = NULL;
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+void eapol_tracker_stop(void) {
+    if (tracker == NULL) {
+        return;
+    }
+
+    // Monitor mode is off by now; let the thread write what is still queued
+    pthread_mutex_lock(&tracker->lock);
+    tracker->stopping = true;
+    pthread_cond_signal(&tracker->ready);
+    pthread_mutex_unlock(&tracker->lock);
+    pthread_join(tracker->thread, NULL);
+
+    printf("EAPOL tracker: %lu key frames, %lu handshakes, %lu PMKIDs, %lu duplicates dropped\n",
+           (unsigned long)stats.frames_seen, (unsigned long)stats.handshakes_emitted,
+           (unsigned long)stats.pmkids_emitted, (unsigned long)stats.duplicates_dropped);
+    if (stats.hashes_dropped > 0) {
+        ESP_LOGW(TAG, "%lu hashes were not written", (unsigned long)stats.hashes_dropped);
+    }
+
+    if (tracker->hash_file != NULL) {
+        fclose(tracker->hash_file);
+    }
+    pthread_cond_destroy(&tracker->ready);
+    pthread_mutex_destroy(&tracker->lock);
+    free(tracker);
+    tracker = NULL;
+}
+
+void eapol_tracker_get_stats(eapol_tracker_stats_t *out) {
+    if (out == NULL) {
+        return;
+    }
+    // Never touches the tracker; the counters of the last capture stay readable after it stops
+    *out = stats;
+}
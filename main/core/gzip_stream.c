@@ -0,0 +1,382 @@
+#include "core/gzip_stream.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_rom_crc.h"
+#endif
+
+#define WSIZE (1u << GZIP_STREAM_WINDOW_BITS)
+#define WMASK (WSIZE - 1)
+#define HSIZE (1u << GZIP_STREAM_HASH_BITS)
+#define MIN_MATCH 3
+#define MAX_MATCH 258
+#define MIN_LOOKAHEAD (MAX_MATCH + MIN_MATCH + 1)
+#define NIL 0xFFFF
+
+static const uint16_t len_base[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const uint8_t len_extra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+static const uint16_t dist_base[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+static const uint8_t dist_extra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+// Search effort per level: hash chain length, length that ends the search early, and the longest
+// match whose inner positions are still added to the hash table
+static const struct {
+    uint16_t max_chain;
+    uint16_t nice_len;
+    uint16_t insert_limit;
+} levels[10] = {
+    {0, 0, 0},
+    {4, 16, 8}, {6, 24, 16}, {8, 32, 32}, {16, 64, 258}, {32, 96, 258},
+    {64, 128, 258}, {96, 192, 258}, {128, 258, 258}, {256, 258, 258},
+};
+
+struct gzip_stream {
+    gzip_stream_write_fn write_fn;
+    void *ctx;
+    esp_err_t err;
+    uint16_t max_chain;
+    uint16_t nice_len;
+    uint16_t insert_limit;
+    uint32_t crc;
+    uint32_t member_len;         // Input bytes of the current member, mod 2^32 like ISIZE
+    uint64_t bytes_in;
+    uint64_t bytes_out;
+    uint32_t bitbuf;
+    int bitcount;
+    size_t fill;                 // Bytes held in window
+    size_t pos;                  // Next byte to code
+    size_t out_len;
+    uint16_t lit_code[288];      // Fixed Huffman codes, bit-reversed for LSB-first output
+    uint8_t dist_rev[30];
+    uint8_t len_code[MAX_MATCH - MIN_MATCH + 1];
+    uint8_t dist_code[512];
+    uint16_t head[HSIZE];
+    uint16_t prev[WSIZE];
+    uint8_t window[2 * WSIZE];
+    uint8_t out[GZIP_STREAM_OUT_SIZE];
+};
+
+uint32_t gzip_crc32(uint32_t crc, const void *data, size_t len) {
+#ifdef ESP_PLATFORM
+    return esp_rom_crc32_le(crc, (const uint8_t *)data, len);
+#else
+    static const uint32_t table[16] = {
+        0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+        0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c};
+    const uint8_t *p = data;
+    crc = ~crc;
+    while (len--) {
+        crc ^= *p++;
+        crc = (crc >> 4) ^ table[crc & 0x0F];
+        crc = (crc >> 4) ^ table[crc & 0x0F];
+    }
+    return ~crc;
+#endif
+}
+
+static uint32_t reverse_bits(uint32_t code, int len) {
+    uint32_t out = 0;
+    while (len--) {
+        out = (out << 1) | (code & 1);
+        code >>= 1;
+    }
+    return out;
+}
+
+static void flush_out(gzip_stream_t *gz) {
+    if (gz->out_len == 0) {
+        return;
+    }
+    if (gz->err == ESP_OK) {
+        gz->err = gz->write_fn(gz->ctx, gz->out, gz->out_len);
+        gz->bytes_out += gz->out_len;
+    }
+    gz->out_len = 0;
+}
+
+static inline void put_byte(gzip_stream_t *gz, uint8_t b) {
+    gz->out[gz->out_len++] = b;
+    if (gz->out_len == sizeof(gz->out)) {
+        flush_out(gz);
+    }
+}
+
+static inline void put_bits(gzip_stream_t *gz, uint32_t value, int count) {
+    gz->bitbuf |= value << gz->bitcount;
+    gz->bitcount += count;
+    while (gz->bitcount >= 8) {
+        put_byte(gz, gz->bitbuf & 0xFF);
+        gz->bitbuf >>= 8;
+        gz->bitcount -= 8;
+    }
+}
+
+static inline void put_symbol(gzip_stream_t *gz, int sym) {
+    int len = sym < 144 ? 8 : sym < 256 ? 9 : sym < 280 ? 7 : 8;
+    put_bits(gz, gz->lit_code[sym], len);
+}
+
+static void put_match(gzip_stream_t *gz, int len, int dist) {
+    int lc = gz->len_code[len - MIN_MATCH];
+    put_symbol(gz, 257 + lc);
+    if (len_extra[lc]) {
+        put_bits(gz, len - len_base[lc], len_extra[lc]);
+    }
+
+    int dc = dist <= 256 ? gz->dist_code[dist - 1] : gz->dist_code[256 + ((dist - 1) >> 7)];
+    put_bits(gz, gz->dist_rev[dc], 5);
+    if (dist_extra[dc]) {
+        put_bits(gz, dist - dist_base[dc], dist_extra[dc]);
+    }
+}
+
+static void init_tables(gzip_stream_t *gz) {
+    for (int sym = 0; sym < 288; sym++) {
+        uint32_t code;
+        int len;
+        if (sym < 144) {
+            code = 0x30 + sym;
+            len = 8;
+        } else if (sym < 256) {
+            code = 0x190 + sym - 144;
+            len = 9;
+        } else if (sym < 280) {
+            code = sym - 256;
+            len = 7;
+        } else {
+            code = 0xC0 + sym - 280;
+            len = 8;
+        }
+        gz->lit_code[sym] = reverse_bits(code, len);
+    }
+
+    for (int i = 0; i < 29; i++) {
+        int last = i == 28 ? MAX_MATCH : len_base[i + 1] - 1;
+        for (int len = len_base[i]; len <= last; len++) {
+            gz->len_code[len - MIN_MATCH] = i;
+        }
+    }
+
+    for (int i = 0; i < 30; i++) {
+        gz->dist_rev[i] = reverse_bits(i, 5);
+        int last = dist_base[i] + (1 << dist_extra[i]) - 1;
+        for (int dist = dist_base[i]; dist <= last && dist <= 32768; dist++) {
+            if (dist <= 256) {
+                gz->dist_code[dist - 1] = i;
+            } else {
+                gz->dist_code[256 + ((dist - 1) >> 7)] = i;
+            }
+        }
+    }
+}
+
+static inline uint32_t hash3(const uint8_t *p) {
+    uint32_t v = p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16);
+    return (v * 2654435761u) >> (32 - GZIP_STREAM_HASH_BITS);
+}
+
+// Add pos to its hash chain and return the previous head of that chain
+static inline uint16_t insert_hash(gzip_stream_t *gz, size_t pos) {
+    uint32_t h = hash3(gz->window + pos);
+    uint16_t old = gz->head[h];
+    gz->prev[pos & WMASK] = old;
+    gz->head[h] = (uint16_t)pos;
+    return old;
+}
+
+static int longest_match(gzip_stream_t *gz, size_t pos, uint16_t cand, size_t avail, int *dist_out) {
+    const uint8_t *s = gz->window + pos;
+    int max_len = avail < MAX_MATCH ? (int)avail : MAX_MATCH;
+    int best = 0;
+    int chain = gz->max_chain;
+
+    while (chain-- > 0 && pos - cand < WSIZE) {
+        const uint8_t *m = gz->window + cand;
+        if (m[best] == s[best] && m[0] == s[0] && m[1] == s[1]) {
+            int len = 2;
+            while (len < max_len && m[len] == s[len]) {
+                len++;
+            }
+            if (len > best) {
+                best = len;
+                *dist_out = (int)(pos - cand);
+                if (len >= gz->nice_len || len >= max_len) {
+                    break;
+                }
+            }
+        }
+        uint16_t next = gz->prev[cand & WMASK];
+        if (next == NIL || next >= cand) {
+            break;
+        }
+        cand = next;
+    }
+    return best;
+}
+
+static void deflate_run(gzip_stream_t *gz, bool finishing) {
+    while (gz->err == ESP_OK) {
+        size_t avail = gz->fill - gz->pos;
+        if (avail == 0 || (!finishing && avail < MIN_LOOKAHEAD)) {
+            break;
+        }
+
+        int len = 0;
+        int dist = 0;
+        if (avail >= MIN_MATCH) {
+            uint16_t cand = insert_hash(gz, gz->pos);
+            if (cand != NIL && cand < gz->pos) {
+                len = longest_match(gz, gz->pos, cand, avail, &dist);
+            }
+        }
+
+        if (len >= MIN_MATCH) {
+            put_match(gz, len, dist);
+            size_t end = gz->pos + len;
+            if (len <= gz->insert_limit) {
+                for (size_t p = gz->pos + 1; p < end && p + MIN_MATCH <= gz->fill; p++) {
+                    insert_hash(gz, p);
+                }
+            }
+            gz->pos = end;
+        } else {
+            put_symbol(gz, gz->window[gz->pos]);
+            gz->pos++;
+        }
+    }
+}
+
+// Drop the oldest half of the window once it is full; hash positions move down with it
+static void slide_window(gzip_stream_t *gz) {
+    memmove(gz->window, gz->window + WSIZE, gz->fill - WSIZE);
+    gz->fill -= WSIZE;
+    gz->pos -= WSIZE;
+    for (size_t i = 0; i < HSIZE; i++) {
+        uint16_t h = gz->head[i];
+        gz->head[i] = (h == NIL || h < WSIZE) ? NIL : h - WSIZE;
+    }
+    for (size_t i = 0; i < WSIZE; i++) {
+        uint16_t p = gz->prev[i];
+        gz->prev[i] = (p == NIL || p < WSIZE) ? NIL : p - WSIZE;
+    }
+}
+
+static void begin_member(gzip_stream_t *gz) {
+    // gzip member header: deflate, no name, no mtime, Unix
+    static const uint8_t header[10] = {0x1F, 0x8B, 0x08, 0x00, 0, 0, 0, 0, 0x00, 0x03};
+    for (size_t i = 0; i < sizeof(header); i++) {
+        put_byte(gz, header[i]);
+    }
+
+    // One open-ended fixed-Huffman block carries the whole member
+    put_bits(gz, 0, 1);
+    put_bits(gz, 1, 2);
+}
+
+static void end_member(gzip_stream_t *gz) {
+    deflate_run(gz, true);
+
+    // End the open block, then an empty final block
+    put_symbol(gz, 256);
+    put_bits(gz, 1, 1);
+    put_bits(gz, 1, 2);
+    put_symbol(gz, 256);
+    if (gz->bitcount > 0) {
+        put_bits(gz, 0, 8 - gz->bitcount);
+    }
+
+    for (int i = 0; i < 4; i++) {
+        put_byte(gz, (gz->crc >> (8 * i)) & 0xFF);
+    }
+    for (int i = 0; i < 4; i++) {
+        put_byte(gz, (gz->member_len >> (8 * i)) & 0xFF);
+    }
+    flush_out(gz);
+}
+
+gzip_stream_t *gzip_stream_create(int level, gzip_stream_write_fn write_fn, void *ctx) {
+    if (!write_fn) {
+        return NULL;
+    }
+    gzip_stream_t *gz = malloc(sizeof(*gz));
+    if (!gz) {
+        return NULL;
+    }
+    memset(gz, 0, offsetof(gzip_stream_t, head));
+    memset(gz->head, 0xFF, sizeof(gz->head));
+    memset(gz->prev, 0xFF, sizeof(gz->prev));
+
+    if (level < 1) level = 1;
+    if (level > 9) level = 9;
+    gz->max_chain = levels[level].max_chain;
+    gz->nice_len = levels[level].nice_len;
+    gz->insert_limit = levels[level].insert_limit;
+    gz->write_fn = write_fn;
+    gz->ctx = ctx;
+    init_tables(gz);
+    begin_member(gz);
+    return gz;
+}
+
+esp_err_t gzip_stream_write(gzip_stream_t *gz, const void *data, size_t len) {
+    const uint8_t *src = data;
+    gz->crc = gzip_crc32(gz->crc, data, len);
+    gz->member_len += (uint32_t)len;
+    gz->bytes_in += len;
+
+    while (len > 0 && gz->err == ESP_OK) {
+        if (gz->fill == sizeof(gz->window)) {
+            slide_window(gz);
+        }
+        size_t n = sizeof(gz->window) - gz->fill;
+        if (n > len) {
+            n = len;
+        }
+        memcpy(gz->window + gz->fill, src, n);
+        gz->fill += n;
+        src += n;
+        len -= n;
+        deflate_run(gz, false);
+    }
+    return gz->err;
+}
+
+esp_err_t gzip_stream_finish(gzip_stream_t *gz) {
+    end_member(gz);
+    return gz->err;
+}
+
+esp_err_t gzip_stream_new_member(gzip_stream_t *gz) {
+    end_member(gz);
+
+    // The next member can't refer back into this one
+    gz->crc = 0;
+    gz->member_len = 0;
+    gz->fill = 0;
+    gz->pos = 0;
+    memset(gz->head, 0xFF, sizeof(gz->head));
+    memset(gz->prev, 0xFF, sizeof(gz->prev));
+    begin_member(gz);
+    return gz->err;
+}
+
+void gzip_stream_destroy(gzip_stream_t *gz) {
+    free(gz);
+}
+
+uint64_t gzip_stream_bytes_in(const gzip_stream_t *gz) {
+    return gz->bytes_in;
+}
+
+uint64_t gzip_stream_bytes_out(const gzip_stream_t *gz) {
+    return gz->bytes_out + gz->out_len;
+}
@@ -0,0 +1,139 @@
+#include "core/http_metrics.h"
+#include <pthread.h>
+#include <string.h>
+#include <stdio.h>
+
+static const uint32_t bounds_ms[] = HTTP_METRICS_LATENCY_BOUNDS_MS;
+
+static pthread_mutex_t metrics_lock = PTHREAD_MUTEX_INITIALIZER;
+static http_metrics_endpoint_t endpoints[HTTP_METRICS_MAX_ENDPOINTS];
+static int endpoint_count;
+
+int http_metrics_endpoint(const char* method, const char* uri, bool async) {
+    pthread_mutex_lock(&metrics_lock);
+    int slot = -1;
+    for (int i = 0; i < endpoint_count; i++) {
+        if (strcmp(endpoints[i].method, method) == 0 && strncmp(endpoints[i].uri, uri, HTTP_METRICS_URI_MAX - 1) == 0) {
+            slot = i;
+            break;
+        }
+    }
+    if (slot < 0 && endpoint_count < HTTP_METRICS_MAX_ENDPOINTS) {
+        slot = endpoint_count++;
+        snprintf(endpoints[slot].method, sizeof(endpoints[slot].method), "%s", method);
+        snprintf(endpoints[slot].uri, sizeof(endpoints[slot].uri), "%s", uri);
+    }
+    if (slot >= 0) {
+        endpoints[slot].async = async;
+    }
+    pthread_mutex_unlock(&metrics_lock);
+    return slot;
+}
+
+void http_metrics_begin(int endpoint) {
+    if (endpoint < 0 || endpoint >= HTTP_METRICS_MAX_ENDPOINTS) {
+        return;
+    }
+    pthread_mutex_lock(&metrics_lock);
+    http_metrics_endpoint_t* e = &endpoints[endpoint];
+    if (++e->active > e->max_active) {
+        e->max_active = e->active;
+    }
+    pthread_mutex_unlock(&metrics_lock);
+}
+
+void http_metrics_end(int endpoint, uint32_t elapsed_us, uint32_t wait_us, bool ok) {
+    if (endpoint < 0 || endpoint >= HTTP_METRICS_MAX_ENDPOINTS) {
+        return;
+    }
+    size_t bucket = 0;
+    while (bucket < sizeof(bounds_ms) / sizeof(bounds_ms[0]) && elapsed_us > bounds_ms[bucket] * 1000) {
+        bucket++;
+    }
+
+    pthread_mutex_lock(&metrics_lock);
+    http_metrics_endpoint_t* e = &endpoints[endpoint];
+    if (e->active > 0) {
+        e->active--;
+    }
+    e->requests++;
+    e->errors += !ok;
+    e->total_us += elapsed_us;
+    if (elapsed_us > e->max_us) {
+        e->max_us = elapsed_us;
+    }
+    e->wait_total_us += wait_us;
+    if (wait_us > e->wait_max_us) {
+        e->wait_max_us = wait_us;
+    }
+    e->latency_hist[bucket]++;
+    pthread_mutex_unlock(&metrics_lock);
+}
+
+void http_metrics_rejected(int endpoint) {
+    if (endpoint < 0 || endpoint >= HTTP_METRICS_MAX_ENDPOINTS) {
+        return;
+    }
+    pthread_mutex_lock(&metrics_lock);
+    http_metrics_endpoint_t* e = &endpoints[endpoint];
+    if (e->active > 0) {
+        e->active--;
+    }
+    e->rejected_busy++;
+    pthread_mutex_unlock(&metrics_lock);
+}
+
+bool http_metrics_get(int endpoint, http_metrics_endpoint_t* out) {
+    pthread_mutex_lock(&metrics_lock);
+    bool found = endpoint >= 0 && endpoint < endpoint_count;
+    if (found) {
+        *out = endpoints[endpoint];
+    }
+    pthread_mutex_unlock(&metrics_lock);
+    return found;
+}
+
+uint32_t http_metrics_percentile_ms(const http_metrics_endpoint_t* e, unsigned pct) {
+    uint32_t total = 0;
+    for (int i = 0; i < HTTP_METRICS_LATENCY_BUCKETS; i++) {
+        total += e->latency_hist[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+    // Rank of the sample at pct, counting from 1
+    uint64_t rank = ((uint64_t)total * (pct > 100 ? 100 : pct) + 99) / 100;
+    if (rank == 0) {
+        rank = 1;
+    }
+    // Spread the samples of the bucket holding that rank evenly between its bounds, the top one capped
+    // at the largest time seen
+    uint32_t max_ms = (e->max_us + 999) / 1000;
+    uint64_t seen = 0;
+    for (int i = 0; i < HTTP_METRICS_LATENCY_BUCKETS; i++) {
+        uint32_t count = e->latency_hist[i];
+        if (seen + count < rank) {
+            seen += count;
+            continue;
+        }
+        uint32_t lower = i > 0 ? bounds_ms[i - 1] : 0;
+        uint32_t upper = i < HTTP_METRICS_LATENCY_BUCKETS - 1 && bounds_ms[i] < max_ms ? bounds_ms[i] : max_ms;
+        if (upper <= lower) {
+            return upper;
+        }
+        return lower + (uint32_t)((uint64_t)(upper - lower) * (rank - seen) / count);
+    }
+    return max_ms;
+}
+
+void http_metrics_reset(void) {
+    pthread_mutex_lock(&metrics_lock);
+    for (int i = 0; i < endpoint_count; i++) {
+        http_metrics_endpoint_t* e = &endpoints[i];
+        uint32_t active = e->active;
+        memset(&e->requests, 0, sizeof(*e) - offsetof(http_metrics_endpoint_t, requests));
+        e->active = active;  // Requests still in their handler will end
+        e->max_active = active;
+    }
+    pthread_mutex_unlock(&metrics_lock);
+}
@@ -0,0 +1,221 @@
+#include "core/json_writer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+_Static_assert(JSON_WRITER_MAX_DEPTH <= 16, "nesting bits are kept in 16-bit masks");
+
+void json_writer_init(json_writer_t* w, char* buf, size_t cap, json_writer_sink_fn sink, void* ctx) {
+    memset(w, 0, sizeof(*w));
+    // Without a sink, keep room for the terminator json_writer_finish() adds
+    w->buf = cap > 0 ? buf : NULL;
+    w->cap = sink == NULL && cap > 0 ? cap - 1 : cap;
+    w->sink = sink;
+    w->ctx = ctx;
+    w->err = cap > 0 ? ESP_OK : ESP_ERR_INVALID_SIZE;
+}
+
+static void put(json_writer_t* w, const char* data, size_t len) {
+    while (len > 0 && w->err == ESP_OK) {
+        size_t room = w->cap - w->len;
+        if (room == 0) {
+            if (w->sink == NULL) {
+                w->err = ESP_ERR_INVALID_SIZE;
+                return;
+            }
+            w->err = w->sink(w->ctx, w->buf, w->len);
+            w->len = 0;
+            continue;
+        }
+        size_t n = len < room ? len : room;
+        memcpy(w->buf + w->len, data, n);
+        w->len += n;
+        w->total += n;
+        data += n;
+        len -= n;
+    }
+}
+
+static void put_char(json_writer_t* w, char c) {
+    if (w->len < w->cap && w->err == ESP_OK) {
+        w->buf[w->len++] = c;
+        w->total++;
+    } else {
+        put(w, &c, 1);
+    }
+}
+
+static uint16_t level_bit(const json_writer_t* w) {
+    return (uint16_t)(1u << (w->depth - 1));
+}
+
+// Comma and key before a value
+static void begin_value(json_writer_t* w, const char* key) {
+    if (w->depth == 0) {
+        return;
+    }
+    uint16_t bit = level_bit(w);
+    if (w->has_items & bit) {
+        put_char(w, ',');
+    }
+    w->has_items |= bit;
+    if (w->in_array & bit) {
+        return;
+    }
+    if (key == NULL) {
+        w->err = w->err == ESP_OK ? ESP_ERR_INVALID_ARG : w->err;
+        return;
+    }
+    put_char(w, '"');
+    put(w, key, strlen(key));
+    put(w, "\":", 2);
+}
+
+static void open_level(json_writer_t* w, const char* key, bool array) {
+    begin_value(w, key);
+    put_char(w, array ? '[' : '{');
+    if (w->depth == JSON_WRITER_MAX_DEPTH) {
+        w->err = w->err == ESP_OK ? ESP_ERR_INVALID_STATE : w->err;
+        return;
+    }
+    w->depth++;
+    uint16_t bit = level_bit(w);
+    w->has_items &= (uint16_t)~bit;
+    w->in_array = array ? (uint16_t)(w->in_array | bit) : (uint16_t)(w->in_array & ~bit);
+}
+
+void json_writer_object(json_writer_t* w, const char* key) {
+    open_level(w, key, false);
+}
+
+void json_writer_array(json_writer_t* w, const char* key) {
+    open_level(w, key, true);
+}
+
+void json_writer_end(json_writer_t* w) {
+    if (w->depth == 0) {
+        w->err = w->err == ESP_OK ? ESP_ERR_INVALID_STATE : w->err;
+        return;
+    }
+    put_char(w, (w->in_array & level_bit(w)) ? ']' : '}');
+    w->depth--;
+}
+
+static void put_escaped(json_writer_t* w, const char* s, size_t len) {
+    static const char hex[] = "0123456789abcdef";
+    put_char(w, '"');
+    size_t run = 0;
+    for (size_t i = 0; i < len; i++) {
+        unsigned char c = (unsigned char)s[i];
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        // Copy the plain run before this character in one go
+        put(w, s + run, i - run);
+        run = i + 1;
+        switch (c) {
+            case '"': put(w, "\\\"", 2); break;
+            case '\\': put(w, "\\\\", 2); break;
+            case '\n': put(w, "\\n", 2); break;
+            case '\r': put(w, "\\r", 2); break;
+            case '\t': put(w, "\\t", 2); break;
+            case '\b': put(w, "\\b", 2); break;
+            case '\f': put(w, "\\f", 2); break;
+            default: {
+                char esc[6] = { '\\', 'u', '0', '0', hex[c >> 4], hex[c & 15] };
+                put(w, esc, sizeof(esc));
+            }
+        }
+    }
+    put(w, s + run, len - run);
+    put_char(w, '"');
+}
+
+void json_writer_string_len(json_writer_t* w, const char* key, const char* value, size_t len) {
+    begin_value(w, key);
+    put_escaped(w, value, len);
+}
+
+void json_writer_string(json_writer_t* w, const char* key, const char* value) {
+    if (value == NULL) {
+        json_writer_null(w, key);
+        return;
+    }
+    json_writer_string_len(w, key, value, strlen(value));
+}
+
+static void put_decimal(json_writer_t* w, uint64_t value, bool negative) {
+    char tmp[21];
+    char* p = tmp + sizeof(tmp);
+    do {
+        *--p = (char)('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    if (negative) {
+        *--p = '-';
+    }
+    put(w, p, (size_t)(tmp + sizeof(tmp) - p));
+}
+
+void json_writer_int(json_writer_t* w, const char* key, int64_t value) {
+    begin_value(w, key);
+    put_decimal(w, value < 0 ? (uint64_t)0 - (uint64_t)value : (uint64_t)value, value < 0);
+}
+
+void json_writer_uint(json_writer_t* w, const char* key, uint64_t value) {
+    begin_value(w, key);
+    put_decimal(w, value, false);
+}
+
+void json_writer_double(json_writer_t* w, const char* key, double value) {
+    if (!isfinite(value)) {
+        json_writer_null(w, key);
+        return;
+    }
+    if (fabs(value) < 9007199254740992.0 && value == (double)(int64_t)value) {
+        json_writer_int(w, key, (int64_t)value);
+        return;
+    }
+    // Shortest of 15 or 17 significant digits that reads back the same, as cJSON does
+    char tmp[32];
+    int n = snprintf(tmp, sizeof(tmp), "%.15g", value);
+    if (strtod(tmp, NULL) != value) {
+        n = snprintf(tmp, sizeof(tmp), "%.17g", value);
+    }
+    begin_value(w, key);
+    put(w, tmp, (size_t)n);
+}
+
+void json_writer_bool(json_writer_t* w, const char* key, bool value) {
+    begin_value(w, key);
+    put(w, value ? "true" : "false", value ? 4 : 5);
+}
+
+void json_writer_null(json_writer_t* w, const char* key) {
+    begin_value(w, key);
+    put(w, "null", 4);
+}
+
+void json_writer_raw(json_writer_t* w, const char* key, const char* json, size_t len) {
+    begin_value(w, key);
+    put(w, json, len);
+}
+
+esp_err_t json_writer_finish(json_writer_t* w) {
+    if (w->sink == NULL) {
+        if (w->buf != NULL) {
+            w->buf[w->len] = '\0';
+        }
+        return w->err;
+    }
+    if (w->len > 0 && w->err == ESP_OK) {
+        w->err = w->sink(w->ctx, w->buf, w->len);
+    }
+    w->len = 0;
+    return w->err;
+}
+
+esp_err_t json_writer_file_sink(void* ctx, const char* data, size_t len) {
+    return fwrite(data, 1, len, (FILE*)ctx) == len ? ESP_OK : ESP_FAIL;
+}
@@ -0,0 +1,533 @@
+#include "core/live_state.h"
+#include "core/json_writer.h"
+#include "core/cbor_writer.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#define CHUNK_SIZE 512
+#define COPY_BATCH 8                 // Rows copied per lock
+
+enum { TABLE_APS, TABLE_STATIONS };
+
+typedef struct {
+    uint32_t version;                // 0 while the slot is free
+    uint32_t round;                  // Scan that last reported it
+    uint8_t bssid[6];
+    char ssid[33];
+    uint8_t channel;
+    int8_t rssi;
+    uint8_t auth;
+} ap_row_t;
+
+typedef struct {
+    uint32_t version;                // 0 while the slot is free
+    uint32_t frames;
+    uint32_t last_seen_ms;
+    uint32_t stamped_ms;             // When the version was taken
+    uint8_t mac[6];
+    uint8_t bssid[6];
+    int8_t rssi;                     // As of the version, so a client's copy matches what it was sent
+    uint8_t channel;
+} station_row_t;
+
+typedef struct {
+    uint32_t version;
+    uint8_t table;
+    uint8_t key[6];
+} removed_t;
+
+static pthread_mutex_t state_lock = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t version;
+static uint32_t boot_id;
+static uint32_t floor_version;       // Removals up to this version have left the log
+static ap_row_t aps[LIVE_STATE_MAX_APS];
+static uint32_t ap_round;
+static station_row_t stations[LIVE_STATE_MAX_STATIONS];
+static removed_t removed_log[LIVE_STATE_REMOVED_LOG];
+static uint32_t removed_count;       // Removals ever logged; the newest is at (removed_count - 1) % size
+static live_state_capture_fn capture_fn;
+static live_state_capture_t capture;
+static uint32_t capture_version;
+static live_state_gps_t gps;
+static uint32_t gps_version;
+static live_state_stats_t stats;
+
+static uint32_t now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+void live_state_init(uint32_t boot, live_state_capture_fn capture_source) {
+    pthread_mutex_lock(&state_lock);
+    boot_id = boot;
+    capture_fn = capture_source;
+    pthread_mutex_unlock(&state_lock);
+}
+
+// Caller holds the lock
+static void log_removal(uint8_t table, const uint8_t key[6]) {
+    removed_t* entry = &removed_log[removed_count % LIVE_STATE_REMOVED_LOG];
+    if (removed_count >= LIVE_STATE_REMOVED_LOG) {
+        floor_version = entry->version;
+    }
+    entry->version = ++version;
+    entry->table = table;
+    memcpy(entry->key, key, 6);
+    removed_count++;
+}
+
+void live_state_aps_begin(void) {
+    pthread_mutex_lock(&state_lock);
+    ap_round++;
+    pthread_mutex_unlock(&state_lock);
+}
+
+void live_state_aps_put(const uint8_t bssid[6], const char* ssid, uint8_t channel, int8_t rssi, uint8_t auth) {
+    pthread_mutex_lock(&state_lock);
+    ap_row_t* row = NULL;
+    ap_row_t* free_row = NULL;
+    for (int i = 0; i < LIVE_STATE_MAX_APS; i++) {
+        if (aps[i].version == 0) {
+            free_row = free_row ? free_row : &aps[i];
+        } else if (memcmp(aps[i].bssid, bssid, 6) == 0) {
+            row = &aps[i];
+            break;
+        }
+    }
+    if (row == NULL) {
+        if (free_row == NULL) {
+            stats.aps_dropped++;
+            pthread_mutex_unlock(&state_lock);
+            return;
+        }
+        row = free_row;
+        memcpy(row->bssid, bssid, 6);
+        row->ssid[0] = '\0';
+        row->version = 0;
+    }
+    row->round = ap_round;
+    if (row->version == 0 || strncmp(row->ssid, ssid, sizeof(row->ssid) - 1) != 0 || row->channel != channel ||
+        row->rssi != rssi || row->auth != auth) {
+        strncpy(row->ssid, ssid, sizeof(row->ssid) - 1);
+        row->ssid[sizeof(row->ssid) - 1] = '\0';
+        row->channel = channel;
+        row->rssi = rssi;
+        row->auth = auth;
+        row->version = ++version;
+    }
+    pthread_mutex_unlock(&state_lock);
+}
+
+void live_state_aps_commit(void) {
+    pthread_mutex_lock(&state_lock);
+    for (int i = 0; i < LIVE_STATE_MAX_APS; i++) {
+        if (aps[i].version != 0 && aps[i].round != ap_round) {
+            log_removal(TABLE_APS, aps[i].bssid);
+            aps[i].version = 0;
+        }
+    }
+    pthread_mutex_unlock(&state_lock);
+}
+
+void live_state_station_seen(const uint8_t mac[6], const uint8_t bssid[6], int8_t rssi, uint8_t channel) {
+    uint32_t now = now_ms();
+    pthread_mutex_lock(&state_lock);
+    station_row_t* row = NULL;
+    station_row_t* spare = NULL;     // A free slot, else the least recently seen station
+    for (int i = 0; i < LIVE_STATE_MAX_STATIONS; i++) {
+        station_row_t* s = &stations[i];
+        if (s->version == 0) {
+            if (spare == NULL || spare->version != 0) {
+                spare = s;
+            }
+        } else if (memcmp(s->mac, mac, 6) == 0) {
+            row = s;
+            break;
+        } else if (spare == NULL || (spare->version != 0 && now - s->last_seen_ms > now - spare->last_seen_ms)) {
+            spare = s;
+        }
+    }
+
+    if (row == NULL) {
+        row = spare;
+        if (row->version != 0 && now - row->last_seen_ms < LIVE_STATE_STATION_EXPIRE_MS) {
+            stats.stations_dropped++;
+            pthread_mutex_unlock(&state_lock);
+            return;
+        }
+        if (row->version != 0) {
+            log_removal(TABLE_STATIONS, row->mac);
+            stats.stations_evicted++;
+        }
+        memcpy(row->mac, mac, 6);
+        memcpy(row->bssid, bssid, 6);
+        row->frames = 1;
+        row->last_seen_ms = now;
+        row->rssi = rssi;
+        row->channel = channel;
+        row->stamped_ms = now;
+        row->version = ++version;
+        pthread_mutex_unlock(&state_lock);
+        return;
+    }
+
+    row->frames++;
+    row->last_seen_ms = now;
+    int moved = rssi - row->rssi;
+    if (memcmp(row->bssid, bssid, 6) != 0 || row->channel != channel || moved >= LIVE_STATE_STATION_RSSI_STEP ||
+        moved <= -LIVE_STATE_STATION_RSSI_STEP || now - row->stamped_ms >= LIVE_STATE_STATION_REFRESH_MS) {
+        memcpy(row->bssid, bssid, 6);
+        row->channel = channel;
+        row->rssi = rssi;
+        row->stamped_ms = now;
+        row->version = ++version;
+    }
+    pthread_mutex_unlock(&state_lock);
+}
+
+void live_state_clear_stations(void) {
+    pthread_mutex_lock(&state_lock);
+    for (int i = 0; i < LIVE_STATE_MAX_STATIONS; i++) {
+        if (stations[i].version != 0) {
+            log_removal(TABLE_STATIONS, stations[i].mac);
+            stations[i].version = 0;
+        }
+    }
+    pthread_mutex_unlock(&state_lock);
+}
+
+static bool gps_equal(const live_state_gps_t* a, const live_state_gps_t* b) {
+    return a->valid == b->valid && a->fix == b->fix && a->fix_mode == b->fix_mode &&
+           a->sats_in_use == b->sats_in_use && a->sats_in_view == b->sats_in_view && a->latitude == b->latitude &&
+           a->longitude == b->longitude && a->altitude == b->altitude && a->speed == b->speed &&
+           a->course == b->course && a->dop_h == b->dop_h && a->utc_date == b->utc_date &&
+           a->utc_time == b->utc_time;
+}
+
+void live_state_update_gps(const live_state_gps_t* fix) {
+    pthread_mutex_lock(&state_lock);
+    if (gps_version == 0 || !gps_equal(&gps, fix)) {
+        gps = *fix;
+        gps_version = ++version;
+    }
+    pthread_mutex_unlock(&state_lock);
+}
+
+// ---- encoding ----
+
+// One set of calls for both encoders
+typedef struct {
+    live_state_format_t format;
+    json_writer_t json;
+    cbor_writer_t cbor;
+} out_t;
+
+static void out_map(out_t* o, const char* key) {
+    if (o->format == LIVE_STATE_CBOR) {
+        cbor_writer_map(&o->cbor, key);
+    } else {
+        json_writer_object(&o->json, key);
+    }
+}
+
+static void out_array(out_t* o, const char* key) {
+    if (o->format == LIVE_STATE_CBOR) {
+        cbor_writer_array(&o->cbor, key);
+    } else {
+        json_writer_array(&o->json, key);
+    }
+}
+
+static void out_end(out_t* o) {
+    if (o->format == LIVE_STATE_CBOR) {
+        cbor_writer_end(&o->cbor);
+    } else {
+        json_writer_end(&o->json);
+    }
+}
+
+static void out_uint(out_t* o, const char* key, uint64_t value) {
+    if (o->format == LIVE_STATE_CBOR) {
+        cbor_writer_uint(&o->cbor, key, value);
+    } else {
+        json_writer_uint(&o->json, key, value);
+    }
+}
+
+static void out_int(out_t* o, const char* key, int64_t value) {
+    if (o->format == LIVE_STATE_CBOR) {
+        cbor_writer_int(&o->cbor, key, value);
+    } else {
+        json_writer_int(&o->json, key, value);
+    }
+}
+
+static void out_bool(out_t* o, const char* key, bool value) {
+    if (o->format == LIVE_STATE_CBOR) {
+        cbor_writer_bool(&o->cbor, key, value);
+    } else {
+        json_writer_bool(&o->json, key, value);
+    }
+}
+
+static void out_string(out_t* o, const char* key, const char* value) {
+    if (o->format == LIVE_STATE_CBOR) {
+        cbor_writer_string(&o->cbor, key, value);
+    } else {
+        json_writer_string(&o->json, key, value);
+    }
+}
+
+static void out_mac(out_t* o, const char* key, const uint8_t mac[6]) {
+    if (o->format == LIVE_STATE_CBOR) {
+        cbor_writer_bytes(&o->cbor, key, mac, 6);
+        return;
+    }
+    char text[18];
+    snprintf(text, sizeof(text), "%02X:%02X:%02X:%02X:%02X:%02X", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+    json_writer_string_len(&o->json, key, text, 17);
+}
+
+// Float fields travel as float32 in CBOR; JSON gets the shortest decimal that reads back as the same float
+static void out_float(out_t* o, const char* key, float value) {
+    if (o->format == LIVE_STATE_CBOR) {
+        cbor_writer_double(&o->cbor, key, value);
+        return;
+    }
+    if (!isfinite(value)) {
+        json_writer_null(&o->json, key);
+        return;
+    }
+    char text[24];
+    int n = 0;
+    for (int digits = 7; digits <= 9; digits++) {
+        n = snprintf(text, sizeof(text), "%.*g", digits, (double)value);
+        if (strtof(text, NULL) == value) {
+            break;
+        }
+    }
+    json_writer_raw(&o->json, key, text, (size_t)n);
+}
+
+// Copy up to max rows changed after since, starting at slot *cursor
+static size_t copy_aps(uint32_t since, int* cursor, ap_row_t* out, size_t max) {
+    size_t n = 0;
+    pthread_mutex_lock(&state_lock);
+    for (; *cursor < LIVE_STATE_MAX_APS && n < max; (*cursor)++) {
+        if (aps[*cursor].version > since) {
+            out[n++] = aps[*cursor];
+        }
+    }
+    pthread_mutex_unlock(&state_lock);
+    return n;
+}
+
+static size_t copy_stations(uint32_t since, int* cursor, station_row_t* out, size_t max) {
+    size_t n = 0;
+    pthread_mutex_lock(&state_lock);
+    for (; *cursor < LIVE_STATE_MAX_STATIONS && n < max; (*cursor)++) {
+        if (stations[*cursor].version > since) {
+            out[n++] = stations[*cursor];
+        }
+    }
+    pthread_mutex_unlock(&state_lock);
+    return n;
+}
+
+// Removals from one table after since; *cursor counts log entries, starting from the oldest kept
+static size_t copy_removed(uint8_t table, uint32_t since, uint32_t* cursor, removed_t* out, size_t max) {
+    size_t n = 0;
+    pthread_mutex_lock(&state_lock);
+    uint32_t oldest = removed_count > LIVE_STATE_REMOVED_LOG ? removed_count - LIVE_STATE_REMOVED_LOG : 0;
+    if (*cursor < oldest) {
+        *cursor = oldest;            // Overwritten meanwhile; the floor check at the end catches it
+    }
+    for (; *cursor < removed_count && n < max; (*cursor)++) {
+        const removed_t* entry = &removed_log[*cursor % LIVE_STATE_REMOVED_LOG];
+        if (entry->table == table && entry->version > since) {
+            out[n++] = *entry;
+        }
+    }
+    pthread_mutex_unlock(&state_lock);
+    return n;
+}
+
+static void write_removed(out_t* o, uint8_t table, uint32_t since) {
+    removed_t batch[COPY_BATCH];
+    uint32_t cursor = 0;
+    size_t n;
+    out_array(o, "removed");
+    while ((n = copy_removed(table, since, &cursor, batch, COPY_BATCH)) > 0) {
+        for (size_t i = 0; i < n; i++) {
+            out_mac(o, NULL, batch[i].key);
+        }
+    }
+    out_end(o);
+}
+
+static void write_aps(out_t* o, uint32_t since, bool reset) {
+    ap_row_t batch[COPY_BATCH];
+    int cursor = 0;
+    size_t n;
+    out_map(o, "aps");
+    if (!reset) {
+        write_removed(o, TABLE_APS, since);
+    }
+    out_array(o, "changed");
+    while ((n = copy_aps(since, &cursor, batch, COPY_BATCH)) > 0) {
+        for (size_t i = 0; i < n; i++) {
+            const ap_row_t* ap = &batch[i];
+            out_map(o, NULL);
+            out_mac(o, "bssid", ap->bssid);
+            out_string(o, "ssid", ap->ssid);
+            out_uint(o, "channel", ap->channel);
+            out_int(o, "rssi", ap->rssi);
+            out_uint(o, "auth", ap->auth);
+            out_uint(o, "v", ap->version);
+            out_end(o);
+        }
+    }
+    out_end(o);
+    out_end(o);
+}
+
+static void write_stations(out_t* o, uint32_t since, bool reset) {
+    station_row_t batch[COPY_BATCH];
+    int cursor = 0;
+    size_t n;
+    out_map(o, "stations");
+    if (!reset) {
+        write_removed(o, TABLE_STATIONS, since);
+    }
+    out_array(o, "changed");
+    while ((n = copy_stations(since, &cursor, batch, COPY_BATCH)) > 0) {
+        uint32_t now = now_ms();
+        for (size_t i = 0; i < n; i++) {
+            const station_row_t* sta = &batch[i];
+            out_map(o, NULL);
+            out_mac(o, "mac", sta->mac);
+            out_mac(o, "bssid", sta->bssid);
+            out_uint(o, "channel", sta->channel);
+            out_int(o, "rssi", sta->rssi);
+            out_uint(o, "frames", sta->frames);
+            out_uint(o, "age_ms", now - sta->last_seen_ms);
+            out_uint(o, "v", sta->version);
+            out_end(o);
+        }
+    }
+    out_end(o);
+    out_end(o);
+}
+
+static void write_capture(out_t* o, const live_state_capture_t* c, uint32_t v) {
+    out_map(o, "capture");
+    out_uint(o, "frames_seen", c->frames_seen);
+    out_uint(o, "frames_written", c->frames_written);
+    out_uint(o, "frames_sampled_out", c->frames_sampled_out);
+    out_uint(o, "write_errors", c->write_errors);
+    out_uint(o, "handshakes", c->handshakes);
+    out_uint(o, "pmkids", c->pmkids);
+    out_uint(o, "sd_bytes_written", c->sd_bytes_written);
+    out_uint(o, "sd_bytes_dropped", c->sd_bytes_dropped);
+    out_uint(o, "v", v);
+    out_end(o);
+}
+
+static void write_gps(out_t* o, const live_state_gps_t* g, uint32_t v) {
+    out_map(o, "gps");
+    out_bool(o, "valid", g->valid);
+    out_uint(o, "fix", g->fix);
+    out_uint(o, "fix_mode", g->fix_mode);
+    out_uint(o, "sats_in_use", g->sats_in_use);
+    out_uint(o, "sats_in_view", g->sats_in_view);
+    out_float(o, "lat", g->latitude);
+    out_float(o, "lon", g->longitude);
+    out_float(o, "alt", g->altitude);
+    out_float(o, "speed", g->speed);
+    out_float(o, "course", g->course);
+    out_float(o, "hdop", g->dop_h);
+    out_uint(o, "date", g->utc_date);
+    out_uint(o, "time", g->utc_time);
+    out_uint(o, "v", v);
+    out_end(o);
+}
+
+esp_err_t live_state_write(const live_state_query_t* q, live_state_sink_fn sink, void* ctx) {
+    // Counters are pulled here, so a poll is what turns a counter change into a version
+    if ((q->sections & LIVE_STATE_CAPTURE) && capture_fn != NULL) {
+        live_state_capture_t current;
+        capture_fn(&current);
+        pthread_mutex_lock(&state_lock);
+        if (capture_version == 0 || memcmp(&current, &capture, sizeof(current)) != 0) {
+            capture = current;
+            capture_version = ++version;
+        }
+        pthread_mutex_unlock(&state_lock);
+    }
+
+    pthread_mutex_lock(&state_lock);
+    uint32_t snapshot = version;
+    bool reset = q->since == 0 || q->boot != boot_id || q->since > snapshot || q->since < floor_version;
+    uint32_t since = reset ? 0 : q->since;
+    uint32_t boot = boot_id;
+    live_state_capture_t cap = capture;
+    uint32_t cap_version = capture_version;
+    live_state_gps_t fix = gps;
+    uint32_t fix_version = gps_version;
+    stats.queries++;
+    stats.resets += reset;
+    pthread_mutex_unlock(&state_lock);
+
+    char chunk[CHUNK_SIZE];
+    out_t o = { .format = q->format };
+    if (o.format == LIVE_STATE_CBOR) {
+        cbor_writer_init(&o.cbor, chunk, sizeof(chunk), sink, ctx);
+    } else {
+        json_writer_init(&o.json, chunk, sizeof(chunk), sink, ctx);
+    }
+
+    out_map(&o, NULL);
+    out_uint(&o, "boot", boot);
+    out_bool(&o, "reset", reset);
+    if (q->sections & LIVE_STATE_APS) {
+        write_aps(&o, since, reset);
+    }
+    if (q->sections & LIVE_STATE_STATIONS) {
+        write_stations(&o, since, reset);
+    }
+    if ((q->sections & LIVE_STATE_CAPTURE) && cap_version > since) {
+        write_capture(&o, &cap, cap_version);
+    }
+    if ((q->sections & LIVE_STATE_GPS) && fix_version > since) {
+        write_gps(&o, &fix, fix_version);
+    }
+
+    // Written last: if removals this reply needed left the log while it was sent, version 0 makes the
+    // client start over instead of missing them
+    pthread_mutex_lock(&state_lock);
+    bool lost = !reset && floor_version > since;
+    pthread_mutex_unlock(&state_lock);
+    out_uint(&o, "version", lost ? 0 : snapshot);
+    out_end(&o);
+    return o.format == LIVE_STATE_CBOR ? cbor_writer_finish(&o.cbor) : json_writer_finish(&o.json);
+}
+
+void live_state_get_stats(live_state_stats_t* out) {
+    pthread_mutex_lock(&state_lock);
+    *out = stats;
+    out->version = version;
+    out->aps = 0;
+    out->stations = 0;
+    for (int i = 0; i < LIVE_STATE_MAX_APS; i++) {
+        out->aps += aps[i].version != 0;
+    }
+    for (int i = 0; i < LIVE_STATE_MAX_STATIONS; i++) {
+        out->stations += stations[i].version != 0;
+    }
+    pthread_mutex_unlock(&state_lock);
+}
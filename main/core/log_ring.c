@@ -0,0 +1,113 @@
+#include "core/log_ring.h"
+#include <string.h>
+
+#define SLOT_MASK (LOG_RING_SLOTS - 1)
+
+_Static_assert((LOG_RING_SLOTS & SLOT_MASK) == 0, "LOG_RING_SLOTS must be a power of two");
+_Static_assert(LOG_RING_LINE_MAX <= 255, "line length is stored in a byte");
+
+static void put_line(log_ring_t *ring, const char *text, size_t len) {
+    uint32_t seq = atomic_fetch_add_explicit(&ring->head, 1, memory_order_relaxed);
+    log_ring_slot_t *slot = &ring->slots[seq & SLOT_MASK];
+
+    // Odd stamp first, so a reader that sees the new text also sees the slot is being rewritten
+    atomic_store_explicit(&slot->stamp, 2 * seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    memcpy(slot->text, text, len);
+    slot->len = (uint8_t)len;
+    atomic_store_explicit(&slot->stamp, 2 * seq + 2, memory_order_release);
+}
+
+uint32_t log_ring_append(log_ring_t *ring, const char *text, size_t len) {
+    const char *end = text + len;
+    while (text < end) {
+        const char *nl = memchr(text, '\n', (size_t)(end - text));
+        const char *stop = nl ? nl : end;
+        if (stop > text && stop[-1] == '\r') {
+            stop--;
+        }
+        while (text < stop) {
+            size_t n = (size_t)(stop - text) < LOG_RING_LINE_MAX ? (size_t)(stop - text) : LOG_RING_LINE_MAX;
+            put_line(ring, text, n);
+            text += n;
+        }
+        text = nl ? nl + 1 : end;
+    }
+    return atomic_load_explicit(&ring->head, memory_order_relaxed);
+}
+
+uint32_t log_ring_head(log_ring_t *ring) {
+    return atomic_load_explicit(&ring->head, memory_order_acquire);
+}
+
+// The clear point, if it still lies inside the lines the ring holds
+static bool floor_in_window(uint32_t floor, uint32_t first, uint32_t head) {
+    return (int32_t)(floor - first) > 0 && (int32_t)(head - floor) >= 0;
+}
+
+uint32_t log_ring_oldest(log_ring_t *ring) {
+    uint32_t head = log_ring_head(ring);
+    uint32_t floor = atomic_load_explicit(&ring->floor, memory_order_relaxed);
+    uint32_t first = head - LOG_RING_SLOTS;
+    return floor_in_window(floor, first, head) ? floor : first;
+}
+
+void log_ring_clear(log_ring_t *ring) {
+    atomic_store_explicit(&ring->floor, log_ring_head(ring), memory_order_relaxed);
+}
+
+// Distance from cursor to the sequence a stamp belongs to: < 0 older, 0 same, > 0 newer. Stamps count
+// in halves, so the difference is taken over 31 bits.
+static int32_t stamp_distance(uint32_t stamp, uint32_t cursor) {
+    uint32_t seq = (stamp - 1) >> 1;
+    return (int32_t)((seq - cursor) << 1) >> 1;
+}
+
+uint32_t log_ring_read(log_ring_t *ring, uint32_t *cursor, log_ring_visit_fn visit, void *ctx) {
+    uint32_t head = log_ring_head(ring);
+    uint32_t floor = atomic_load_explicit(&ring->floor, memory_order_relaxed);
+    uint32_t first = head - LOG_RING_SLOTS;
+    uint32_t c = *cursor;
+    uint32_t lost = 0;
+
+    if ((int32_t)(c - head) > 0) {
+        c = head;                      // From another boot or ring; start over at the live end
+    }
+    if (floor_in_window(floor, first, head) && (int32_t)(floor - c) > 0) {
+        c = floor;                     // Cleared lines are skipped, not lost
+    }
+    if ((int32_t)(first - c) > 0) {
+        lost = first - c;
+        c = first;
+    }
+
+    char text[LOG_RING_LINE_MAX];
+    while (c != head) {
+        log_ring_slot_t *slot = &ring->slots[c & SLOT_MASK];
+        uint32_t stamp = atomic_load_explicit(&slot->stamp, memory_order_acquire);
+        int32_t distance = stamp_distance(stamp, c);
+        if (distance < 0 || (distance == 0 && (stamp & 1))) {
+            break;                     // Not written yet
+        }
+        if (distance > 0) {
+            lost++;                    // Overwritten since head was read
+            c++;
+            continue;
+        }
+
+        size_t len = slot->len;
+        memcpy(text, slot->text, len);
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&slot->stamp, memory_order_relaxed) != stamp) {
+            lost++;                    // Rewritten while it was copied
+            c++;
+            continue;
+        }
+        if (!visit(ctx, c, text, len)) {
+            break;
+        }
+        c++;
+    }
+    *cursor = c;
+    return lost;
+}
@@ -0,0 +1,238 @@
+#include "core/lz4_stream.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define MIN_MATCH 4
+#define LAST_LITERALS 5              // The last bytes of a block are always literals
+#define MF_LIMIT 12                  // No match may start closer than this to the end of a block
+#define MAX_OFFSET 65535
+#define HSIZE (1u << LZ4_STREAM_HASH_BITS)
+#define SKIP_SHIFT 6                 // Step grows by one every 64 positions without a match
+
+#define FRAME_MAGIC 0x184D2204u
+#define BLOCK_UNCOMPRESSED 0x80000000u
+
+// Frame descriptor: version 01, independent blocks, no checksums, no content size; 64 KB max block.
+// The last byte is the descriptor checksum, (XXH32(FLG BD) >> 8) & 0xFF.
+static const uint8_t frame_header[7] = {0x04, 0x22, 0x4D, 0x18, 0x60, 0x40, 0x82};
+
+_Static_assert(LZ4_STREAM_BLOCK_SIZE <= 65536, "blocks must fit the 64 KB maximum the frame declares");
+
+struct lz4_stream {
+    lz4_stream_write_fn write_fn;
+    void *ctx;
+    esp_err_t err;
+    uint32_t accel;
+    bool started;
+    uint64_t bytes_in;
+    uint64_t bytes_out;
+    size_t in_len;
+    uint16_t table[HSIZE];           // Last position per hash; stale entries from older blocks are harmless
+    uint8_t in[LZ4_STREAM_BLOCK_SIZE];
+    uint8_t out[4 + LZ4_STREAM_BLOCK_SIZE];
+};
+
+static inline uint32_t read32(const uint8_t *p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint32_t hash4(uint32_t v) {
+    return (v * 2654435761u) >> (32 - LZ4_STREAM_HASH_BITS);
+}
+
+static inline void put_le32(uint8_t *p, uint32_t v) {
+    p[0] = v & 0xFF;
+    p[1] = (v >> 8) & 0xFF;
+    p[2] = (v >> 16) & 0xFF;
+    p[3] = v >> 24;
+}
+
+static void emit(lz4_stream_t *lz, const uint8_t *data, size_t len) {
+    if (lz->err == ESP_OK) {
+        lz->err = lz->write_fn(lz->ctx, data, len);
+        lz->bytes_out += len;
+    }
+}
+
+static void emit_header(lz4_stream_t *lz) {
+    if (!lz->started) {
+        lz->started = true;
+        emit(lz, frame_header, sizeof(frame_header));
+    }
+}
+
+// Append a length continuation (runs of 255 plus the remainder); false when it would pass end
+static inline bool put_length(uint8_t **op, const uint8_t *end, size_t len) {
+    if (*op + len / 255 + 1 > end) {
+        return false;
+    }
+    while (len >= 255) {
+        *(*op)++ = 255;
+        len -= 255;
+    }
+    *(*op)++ = (uint8_t)len;
+    return true;
+}
+
+// One sequence: literals from anchor, then a match (or none for the last literals of the block)
+static bool put_sequence(uint8_t **op, const uint8_t *end, const uint8_t *lit, size_t lit_len,
+                         size_t offset, size_t match_len) {
+    if (*op + 1 + lit_len > end) {
+        return false;
+    }
+    uint8_t *token = (*op)++;
+    *token = (uint8_t)((lit_len < 15 ? lit_len : 15) << 4);
+    if (lit_len >= 15 && !put_length(op, end, lit_len - 15)) {
+        return false;
+    }
+    if (*op + lit_len > end) {
+        return false;
+    }
+    memcpy(*op, lit, lit_len);
+    *op += lit_len;
+
+    if (match_len == 0) {
+        return true;
+    }
+    if (*op + 2 > end) {
+        return false;
+    }
+    *(*op)++ = offset & 0xFF;
+    *(*op)++ = (uint8_t)(offset >> 8);
+    size_t ml = match_len - MIN_MATCH;
+    *token |= (uint8_t)(ml < 15 ? ml : 15);
+    return ml < 15 || put_length(op, end, ml - 15);
+}
+
+// Compress src into dst; returns 0 when the result would not be smaller than the input
+static size_t compress_block(lz4_stream_t *lz, const uint8_t *src, size_t n, uint8_t *dst) {
+    uint8_t *op = dst;
+    const uint8_t *end = dst + n - 1;
+    size_t anchor = 0;
+
+    if (n > MF_LIMIT) {
+        size_t mf_limit = n - MF_LIMIT;
+        size_t match_limit = n - LAST_LITERALS;
+        size_t ip = 1;
+        uint32_t misses = 0;
+        lz->table[hash4(read32(src))] = 0;
+
+        while (ip <= mf_limit) {
+            uint32_t seq = read32(src + ip);
+            uint32_t h = hash4(seq);
+            size_t cand = lz->table[h];
+            lz->table[h] = (uint16_t)ip;
+
+            if (cand >= ip || ip - cand > MAX_OFFSET || read32(src + cand) != seq) {
+                ip += lz->accel + (misses++ >> SKIP_SHIFT);
+                continue;
+            }
+
+            while (ip > anchor && cand > 0 && src[ip - 1] == src[cand - 1]) {
+                ip--;
+                cand--;
+            }
+            size_t len = MIN_MATCH;
+            while (ip + len < match_limit && src[cand + len] == src[ip + len]) {
+                len++;
+            }
+            if (!put_sequence(&op, end, src + anchor, ip - anchor, ip - cand, len)) {
+                return 0;
+            }
+            ip += len;
+            anchor = ip;
+            misses = 0;
+            if (ip <= mf_limit) {
+                lz->table[hash4(read32(src + ip - 2))] = (uint16_t)(ip - 2);
+            }
+        }
+    }
+
+    if (!put_sequence(&op, end, src + anchor, n - anchor, 0, 0)) {
+        return 0;
+    }
+    return (size_t)(op - dst);
+}
+
+static void emit_block(lz4_stream_t *lz) {
+    if (lz->in_len == 0) {
+        return;
+    }
+    emit_header(lz);
+
+    size_t n = compress_block(lz, lz->in, lz->in_len, lz->out + 4);
+    if (n == 0) {
+        memcpy(lz->out + 4, lz->in, lz->in_len);
+        put_le32(lz->out, BLOCK_UNCOMPRESSED | (uint32_t)lz->in_len);
+        n = lz->in_len;
+    } else {
+        put_le32(lz->out, (uint32_t)n);
+    }
+    emit(lz, lz->out, 4 + n);
+    lz->in_len = 0;
+}
+
+lz4_stream_t *lz4_stream_create(int level, lz4_stream_write_fn write_fn, void *ctx) {
+    if (!write_fn) {
+        return NULL;
+    }
+    lz4_stream_t *lz = malloc(sizeof(*lz));
+    if (!lz) {
+        return NULL;
+    }
+    memset(lz, 0, offsetof(lz4_stream_t, in));
+
+    if (level < 1) level = 1;
+    if (level > 9) level = 9;
+    lz->accel = 10 - level;
+    lz->write_fn = write_fn;
+    lz->ctx = ctx;
+    return lz;
+}
+
+esp_err_t lz4_stream_write(lz4_stream_t *lz, const void *data, size_t len) {
+    const uint8_t *src = data;
+    lz->bytes_in += len;
+
+    while (len > 0 && lz->err == ESP_OK) {
+        size_t n = sizeof(lz->in) - lz->in_len;
+        if (n > len) {
+            n = len;
+        }
+        memcpy(lz->in + lz->in_len, src, n);
+        lz->in_len += n;
+        src += n;
+        len -= n;
+        if (lz->in_len == sizeof(lz->in)) {
+            emit_block(lz);
+        }
+    }
+    return lz->err;
+}
+
+esp_err_t lz4_stream_flush(lz4_stream_t *lz) {
+    emit_block(lz);
+    return lz->err;
+}
+
+esp_err_t lz4_stream_finish(lz4_stream_t *lz) {
+    emit_block(lz);
+    emit_header(lz);
+    static const uint8_t end_mark[LZ4_STREAM_END_MARK_LEN] = {0};
+    emit(lz, end_mark, sizeof(end_mark));
+    return lz->err;
+}
+
+void lz4_stream_destroy(lz4_stream_t *lz) {
+    free(lz);
+}
+
+uint64_t lz4_stream_bytes_in(const lz4_stream_t *lz) {
+    return lz->bytes_in;
+}
+
+uint64_t lz4_stream_bytes_out(const lz4_stream_t *lz) {
+    return lz->bytes_out;
+}
@@ -0,0 +1,326 @@
+#include "core/multipart_parser.h"
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/types.h>
+
+#define DELIM_MAX (4 + MULTIPART_BOUNDARY_MAX)
+
+typedef enum {
+    STATE_PREAMBLE = 0,
+    STATE_AFTER_DELIM,          // "--" ends the body, CRLF starts the next part's headers
+    STATE_HEADERS,
+    STATE_BODY,
+    STATE_EPILOGUE,
+} parser_state_t;
+
+struct multipart_parser {
+    multipart_callbacks_t callbacks;
+    void *ctx;
+    parser_state_t state;
+    esp_err_t err;
+    uint8_t delim[DELIM_MAX];   // CRLF "--" boundary
+    size_t delim_len;
+    uint8_t skip[256];          // Horspool shift per byte value
+    uint8_t tail[DELIM_MAX];    // End of the previous piece that may begin a delimiter
+    size_t tail_len;
+    char after_delim;           // Character seen after a delimiter, 0 when none yet
+    char header[MULTIPART_HEADER_MAX + 1];
+    size_t header_len;
+    size_t line_start;
+    multipart_part_t part;
+};
+
+bool multipart_parse_boundary(const char *content_type, char *out, size_t out_len) {
+    if (!content_type || strncasecmp(content_type, "multipart/form-data", 19) != 0) {
+        return false;
+    }
+    const char *p = content_type;
+    while (*p && strncasecmp(p, "boundary=", 9) != 0) {
+        p++;
+    }
+    if (!*p) {
+        return false;
+    }
+    p += 9;
+
+    size_t len = 0;
+    if (*p == '"') {
+        p++;
+        while (p[len] && p[len] != '"') len++;
+    } else {
+        while (p[len] && p[len] != ';' && p[len] != ' ') len++;
+    }
+    if (len == 0 || len > MULTIPART_BOUNDARY_MAX || len >= out_len) {
+        return false;
+    }
+    memcpy(out, p, len);
+    out[len] = '\0';
+    return true;
+}
+
+multipart_parser_t *multipart_parser_create(const char *boundary, const multipart_callbacks_t *callbacks, void *ctx) {
+    size_t boundary_len = boundary ? strlen(boundary) : 0;
+    if (boundary_len == 0 || boundary_len > MULTIPART_BOUNDARY_MAX || !callbacks) {
+        return NULL;
+    }
+    multipart_parser_t *p = calloc(1, sizeof(*p));
+    if (!p) {
+        return NULL;
+    }
+    p->callbacks = *callbacks;
+    p->ctx = ctx;
+
+    memcpy(p->delim, "\r\n--", 4);
+    memcpy(p->delim + 4, boundary, boundary_len);
+    p->delim_len = 4 + boundary_len;
+    memset(p->skip, (int)p->delim_len, sizeof(p->skip));
+    for (size_t i = 0; i + 1 < p->delim_len; i++) {
+        p->skip[p->delim[i]] = p->delim_len - 1 - i;
+    }
+
+    // The first delimiter may open the body without a CRLF in front of it
+    p->state = STATE_PREAMBLE;
+    memcpy(p->tail, "\r\n", 2);
+    p->tail_len = 2;
+    return p;
+}
+
+void multipart_parser_destroy(multipart_parser_t *p) {
+    free(p);
+}
+
+// Offset of the first delimiter in buf, or -1 with *pending set to the length of the longest suffix
+// of buf that is a proper prefix of the delimiter
+static ssize_t find_delim(const multipart_parser_t *p, const uint8_t *buf, size_t n, size_t *pending) {
+    size_t m = p->delim_len;
+    uint8_t last = p->delim[m - 1];
+    size_t i = 0;
+    while (i + m <= n) {
+        uint8_t c = buf[i + m - 1];
+        if (c == last && buf[i] == '\r' && memcmp(buf + i, p->delim, m - 1) == 0) {
+            return (ssize_t)i;
+        }
+        i += p->skip[c];
+    }
+
+    size_t k = m - 1 < n ? m - 1 : n;
+    for (; k > 0; k--) {
+        if (buf[n - k] == '\r' && memcmp(buf + n - k, p->delim, k) == 0) {
+            break;
+        }
+    }
+    *pending = k;
+    return -1;
+}
+
+static void emit(multipart_parser_t *p, const uint8_t *data, size_t len) {
+    if (len > 0 && p->state == STATE_BODY && p->err == ESP_OK && p->callbacks.on_part_data) {
+        p->err = p->callbacks.on_part_data(p->ctx, data, len);
+    }
+}
+
+static void delimiter_found(multipart_parser_t *p) {
+    if (p->state == STATE_BODY && p->err == ESP_OK && p->callbacks.on_part_end) {
+        p->err = p->callbacks.on_part_end(p->ctx);
+    }
+    p->state = STATE_AFTER_DELIM;
+    p->after_delim = 0;
+}
+
+// Preamble or body: pass data through up to the next delimiter. Returns the bytes consumed.
+static size_t scan_section(multipart_parser_t *p, const uint8_t *data, size_t len) {
+    size_t pending = 0;
+
+    if (p->tail_len > 0) {
+        // Check whether the held-back bytes and the start of this piece form a delimiter
+        uint8_t stitch[2 * DELIM_MAX];
+        size_t extra = len < p->delim_len - 1 ? len : p->delim_len - 1;
+        memcpy(stitch, p->tail, p->tail_len);
+        memcpy(stitch + p->tail_len, data, extra);
+        size_t stitch_len = p->tail_len + extra;
+
+        ssize_t pos = find_delim(p, stitch, stitch_len, &pending);
+        if (pos >= 0 && (size_t)pos < p->tail_len) {
+            emit(p, p->tail, pos);
+            size_t consumed = pos + p->delim_len - p->tail_len;
+            p->tail_len = 0;
+            delimiter_found(p);
+            return consumed;
+        }
+        if (pos < 0 && stitch_len - pending < p->tail_len) {
+            // Still undecided; only possible when the whole piece fit in the stitch
+            size_t safe = stitch_len - pending;
+            emit(p, p->tail, safe);
+            memmove(p->tail, stitch + safe, pending);
+            p->tail_len = pending;
+            return len;
+        }
+        emit(p, p->tail, p->tail_len);
+        p->tail_len = 0;
+    }
+
+    ssize_t pos = find_delim(p, data, len, &pending);
+    if (pos >= 0) {
+        emit(p, data, pos);
+        delimiter_found(p);
+        return pos + p->delim_len;
+    }
+    emit(p, data, len - pending);
+    memcpy(p->tail, data + len - pending, pending);
+    p->tail_len = pending;
+    return len;
+}
+
+static void copy_value(char *out, const char *value, size_t len) {
+    if (len >= MULTIPART_FIELD_MAX) {
+        len = MULTIPART_FIELD_MAX - 1;
+    }
+    memcpy(out, value, len);
+    out[len] = '\0';
+}
+
+// Content-Disposition: form-data; name="field"; filename="capture.pcap"
+static void parse_disposition(multipart_part_t *part, const char *value) {
+    const char *s = strchr(value, ';');
+    while (s && *s) {
+        s++;
+        while (*s == ' ' || *s == '\t') s++;
+        const char *key = s;
+        while (*s && *s != '=' && *s != ';') s++;
+        size_t key_len = s - key;
+        if (*s != '=') {
+            continue;
+        }
+        s++;
+
+        char buf[MULTIPART_FIELD_MAX];
+        size_t len = 0;
+        if (*s == '"') {
+            s++;
+            while (*s && *s != '"') {
+                if (*s == '\\' && s[1]) s++;
+                if (len < sizeof(buf) - 1) buf[len++] = *s;
+                s++;
+            }
+            if (*s == '"') s++;
+        } else {
+            while (*s && *s != ';' && *s != ' ') {
+                if (len < sizeof(buf) - 1) buf[len++] = *s;
+                s++;
+            }
+        }
+        while (*s && *s != ';') s++;
+
+        if (key_len == 4 && strncasecmp(key, "name", 4) == 0) {
+            copy_value(part->name, buf, len);
+        } else if (key_len == 8 && strncasecmp(key, "filename", 8) == 0) {
+            copy_value(part->filename, buf, len);
+            part->is_file = true;
+        }
+    }
+}
+
+static void parse_headers(multipart_parser_t *p) {
+    memset(&p->part, 0, sizeof(p->part));
+    char *line = p->header;
+    while (*line) {
+        char *end = strstr(line, "\r\n");
+        if (end) *end = '\0';
+
+        char *colon = strchr(line, ':');
+        if (colon) {
+            char *value = colon + 1;
+            while (*value == ' ' || *value == '\t') value++;
+            size_t name_len = colon - line;
+            if (name_len == 19 && strncasecmp(line, "Content-Disposition", 19) == 0) {
+                parse_disposition(&p->part, value);
+            } else if (name_len == 12 && strncasecmp(line, "Content-Type", 12) == 0) {
+                copy_value(p->part.content_type, value, strlen(value));
+            }
+        }
+        if (!end) break;
+        line = end + 2;
+    }
+}
+
+// Collect header lines until the empty line; returns the bytes consumed
+static size_t scan_headers(multipart_parser_t *p, const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if (p->header_len == MULTIPART_HEADER_MAX) {
+            p->err = ESP_ERR_INVALID_ARG;
+            return i;
+        }
+        p->header[p->header_len++] = data[i];
+        if (data[i] != '\n') {
+            continue;
+        }
+        if (p->header_len - p->line_start == 2 && p->header[p->line_start] == '\r') {
+            p->header[p->line_start] = '\0';
+            parse_headers(p);
+            p->state = STATE_BODY;
+            p->tail_len = 0;
+            if (p->callbacks.on_part_begin) {
+                p->err = p->callbacks.on_part_begin(p->ctx, &p->part);
+            }
+            return i + 1;
+        }
+        p->line_start = p->header_len;
+    }
+    return len;
+}
+
+static size_t scan_after_delim(multipart_parser_t *p, char c) {
+    if (p->after_delim == 0) {
+        if (c == '-' || c == '\r') {
+            p->after_delim = c;
+        } else if (c != ' ' && c != '\t') {
+            p->err = ESP_ERR_INVALID_ARG;
+        }
+    } else if (p->after_delim == '-') {
+        if (c == '-') {
+            p->state = STATE_EPILOGUE;
+        } else {
+            p->err = ESP_ERR_INVALID_ARG;
+        }
+    } else if (c == '\n') {
+        p->state = STATE_HEADERS;
+        p->header_len = 0;
+        p->line_start = 0;
+    } else {
+        p->err = ESP_ERR_INVALID_ARG;
+    }
+    return 1;
+}
+
+esp_err_t multipart_parser_feed(multipart_parser_t *p, const void *data, size_t len) {
+    const uint8_t *d = data;
+    while (len > 0 && p->err == ESP_OK) {
+        size_t n;
+        switch (p->state) {
+            case STATE_PREAMBLE:
+            case STATE_BODY:
+                n = scan_section(p, d, len);
+                break;
+            case STATE_AFTER_DELIM:
+                n = scan_after_delim(p, (char)d[0]);
+                break;
+            case STATE_HEADERS:
+                n = scan_headers(p, d, len);
+                break;
+            default:
+                n = len;          // Epilogue is ignored
+                break;
+        }
+        d += n;
+        len -= n;
+    }
+    return p->err;
+}
+
+esp_err_t multipart_parser_finish(multipart_parser_t *p) {
+    if (p->err != ESP_OK) {
+        return p->err;
+    }
+    return p->state == STATE_EPILOGUE ? ESP_OK : ESP_ERR_INVALID_STATE;
+}
@@ -0,0 +1,239 @@
+#include "core/probe_census.h"
+#include "managers/sd_card_manager.h"
+#include "managers/capture_index.h"
+#include "managers/views/terminal_screen.h"
+#include "core/utils.h"
+#include <stdio.h>
+#include <string.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+static const char *TAG = "PROBE_CENSUS";
+
+static hll_sketch_t minute_sketches[2];   // Active bucket and the one being exported
+static hll_sketch_t session_sketch;
+static int active_sketch = 0;
+static probe_census_bucket_t current_bucket;
+static probe_census_bucket_t history[PROBE_CENSUS_HISTORY_LEN];
+static size_t history_head = 0;
+static size_t history_count = 0;
+
+static volatile bool census_running = false;
+static TaskHandle_t census_task_handle = NULL;
+static FILE *census_file = NULL;
+static char census_file_name[64];
+static uint32_t census_rows = 0;
+static portMUX_TYPE census_lock = portMUX_INITIALIZER_UNLOCKED;
+
+void probe_census_process_frame(const uint8_t *frame, size_t len) {
+    if (!census_running || frame == NULL || len < 24 || frame[0] != 0x40) {
+        return;
+    }
+
+    uint64_t hash = probe_census_fingerprint(frame, len);
+    bool randomized = (frame[10] & 0x02) != 0;
+
+    taskENTER_CRITICAL(&census_lock);
+    hll_add_hash(&minute_sketches[active_sketch], hash);
+    hll_add_hash(&session_sketch, hash);
+    current_bucket.probes++;
+    if (randomized) {
+        current_bucket.randomized++;
+    }
+    taskEXIT_CRITICAL(&census_lock);
+}
+
+static time_t census_wall_clock(void) {
+    time_t now = time(NULL);
+    return now > 1577836800 ? now : 0;  // Treat anything before 2020 as an unset clock
+}
+
+static void census_new_bucket(probe_census_bucket_t *bucket) {
+    memset(bucket, 0, sizeof(*bucket));
+    bucket->start = census_wall_clock();
+    bucket->uptime_s = (uint32_t)(esp_timer_get_time() / 1000000);
+}
+
+static void census_export(const probe_census_bucket_t *bucket) {
+    char line[96];
+    snprintf(line, sizeof(line), "%lld,%lu,%lu,%lu,%lu\n", (long long)bucket->start,
+             (unsigned long)bucket->uptime_s, (unsigned long)bucket->devices,
+             (unsigned long)bucket->probes, (unsigned long)bucket->randomized);
+
+    if (census_file != NULL) {
+        fputs(line, census_file);
+        fflush(census_file);
+        census_rows++;
+    } else {
+        printf("[CENSUS] %s", line);
+    }
+
+    TERMINAL_VIEW_ADD_TEXT("Census: ~%lu devices, %lu probes\n", (unsigned long)bucket->devices,
+                           (unsigned long)bucket->probes);
+}
+
+static void census_rollover(void) {
+    probe_census_bucket_t finished;
+    int finished_sketch;
+
+    taskENTER_CRITICAL(&census_lock);
+    finished_sketch = active_sketch;
+    active_sketch ^= 1;
+    finished = current_bucket;
+    taskEXIT_CRITICAL(&census_lock);
+
+    probe_census_bucket_t next;
+    census_new_bucket(&next);
+
+    finished.devices = hll_estimate(&minute_sketches[finished_sketch]);
+    hll_reset(&minute_sketches[finished_sketch]);
+
+    taskENTER_CRITICAL(&census_lock);
+    // Counts that landed between the swap and here belong to the new bucket
+    next.probes = current_bucket.probes - finished.probes;
+    next.randomized = current_bucket.randomized - finished.randomized;
+    current_bucket = next;
+    history[history_head] = finished;
+    history_head = (history_head + 1) % PROBE_CENSUS_HISTORY_LEN;
+    if (history_count < PROBE_CENSUS_HISTORY_LEN) {
+        history_count++;
+    }
+    taskEXIT_CRITICAL(&census_lock);
+
+    census_export(&finished);
+}
+
+static void census_task(void *pvParameters) {
+    const TickType_t period = pdMS_TO_TICKS(PROBE_CENSUS_BUCKET_SECONDS * 1000);
+    TickType_t next_rollover = xTaskGetTickCount() + period;
+
+    for (;;) {
+        TickType_t now = xTaskGetTickCount();
+        TickType_t wait = (int32_t)(next_rollover - now) > 0 ? next_rollover - now : 0;
+        bool stopping = ulTaskNotifyTake(pdTRUE, wait) > 0;
+
+        census_rollover();
+        if (stopping) {
+            break;
+        }
+        next_rollover += period;
+    }
+
+    if (census_file != NULL) {
+        long size = ftell(census_file);
+        fclose(census_file);
+        census_file = NULL;
+        capture_index_update(census_file_name, size > 0 ? (uint64_t)size : 0, census_rows);
+    }
+
+    printf("Probe census stopped, ~%lu distinct devices this session\n",
+           (unsigned long)hll_estimate(&session_sketch));
+    census_task_handle = NULL;
+    vTaskDelete(NULL);
+}
+
+static void census_open_file(void) {
+    if (!sd_card_exists("/mnt/ghostesp")) {
+        return;
+    }
+    if (!sd_card_exists(PROBE_CENSUS_DIR) && sd_card_create_directory(PROBE_CENSUS_DIR) != ESP_OK) {
+        return;
+    }
+
+    // Named through the capture index like pcaps and GPS logs, so starting a census doesn't scan the directory
+    if (capture_index_create(PROBE_CENSUS_DIR, "census", "csv", census_file_name, sizeof(census_file_name)) < 0) {
+        int next_index = get_next_census_file_index("census");
+        if (next_index < 0) {
+            ESP_LOGW(TAG, "No free census file name, counts will be printed to serial");
+            return;
+        }
+        snprintf(census_file_name, sizeof(census_file_name), PROBE_CENSUS_DIR "/census_%d.csv", next_index);
+    }
+    census_rows = 0;
+    census_file = fopen(census_file_name, "w");
+    if (census_file == NULL) {
+        ESP_LOGW(TAG, "Failed to open %s, counts will be printed to serial", census_file_name);
+        capture_index_remove(census_file_name);
+        return;
+    }
+
+    fputs("start_epoch,uptime_s,devices,probes,randomized\n", census_file);
+    printf("Writing census to %s\n", census_file_name);
+}
+
+esp_err_t probe_census_start(void) {
+    if (census_running || census_task_handle != NULL) {
+        printf("Probe census is already running\n");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    hll_reset(&minute_sketches[0]);
+    hll_reset(&minute_sketches[1]);
+    hll_reset(&session_sketch);
+    active_sketch = 0;
+    history_head = 0;
+    history_count = 0;
+    census_new_bucket(&current_bucket);
+
+    census_open_file();
+
+    census_running = true;
+    if (xTaskCreate(census_task, "census_task", 3072, NULL, 3, &census_task_handle) != pdPASS) {
+        census_running = false;
+        census_task_handle = NULL;
+        if (census_file != NULL) {
+            fclose(census_file);
+            census_file = NULL;
+        }
+        ESP_LOGE(TAG, "Failed to create census task");
+        return ESP_FAIL;
+    }
+
+    return ESP_OK;
+}
+
+void probe_census_stop(void) {
+    if (!census_running) {
+        return;
+    }
+
+    census_running = false;
+    if (census_task_handle != NULL) {
+        xTaskNotifyGive(census_task_handle);
+    }
+}
+
+bool probe_census_is_running(void) {
+    return census_running;
+}
+
+void probe_census_get_current(probe_census_bucket_t *current, uint32_t *session_devices) {
+    // Frames keep landing in both sketches, so estimate on a copy taken under the lock (1 KB each)
+    hll_sketch_t copy;
+    if (current != NULL) {
+        taskENTER_CRITICAL(&census_lock);
+        *current = current_bucket;
+        copy = minute_sketches[active_sketch];
+        taskEXIT_CRITICAL(&census_lock);
+        current->devices = hll_estimate(&copy);
+    }
+    if (session_devices != NULL) {
+        taskENTER_CRITICAL(&census_lock);
+        copy = session_sketch;
+        taskEXIT_CRITICAL(&census_lock);
+        *session_devices = hll_estimate(&copy);
+    }
+}
+
+size_t probe_census_get_history(probe_census_bucket_t *out, size_t max) {
+    taskENTER_CRITICAL(&census_lock);
+    size_t count = history_count < max ? history_count : max;
+    size_t start = (history_head + PROBE_CENSUS_HISTORY_LEN - count) % PROBE_CENSUS_HISTORY_LEN;
+    for (size_t i = 0; i < count; i++) {
+        out[i] = history[(start + i) % PROBE_CENSUS_HISTORY_LEN];
+    }
+    taskEXIT_CRITICAL(&census_lock);
+    return count;
+}
@@ -0,0 +1,259 @@
+#include "core/screen_capture.h"
+#include "core/screen_codec.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+static pthread_mutex_t capture_lock = PTHREAD_MUTEX_INITIALIZER;
+static atomic_bool running;
+static int screen_w, screen_h;
+static bool pixels_swapped;
+static size_t buf_size;
+
+static uint8_t* bufs[2];
+static int fill_index;            // bufs[fill_index] is being filled, the other one sent
+static size_t fill_len;
+static bool armed;
+static bool ready;                // Frame in the fill buffer is complete
+
+static screen_capture_area_t pending[SCREEN_CAPTURE_PENDING_AREAS];
+static int pending_count;
+static size_t budget;             // Pixels left to invalidate for this capture
+
+static screen_capture_stats_t stats;
+
+static inline void put_u16(uint8_t* p, unsigned v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static inline long area_size(const screen_capture_area_t* a) {
+    return (long)(a->x2 - a->x1 + 1) * (a->y2 - a->y1 + 1);
+}
+
+static inline screen_capture_area_t area_union(const screen_capture_area_t* a, const screen_capture_area_t* b) {
+    screen_capture_area_t u = *a;
+    if (b->x1 < u.x1) u.x1 = b->x1;
+    if (b->y1 < u.y1) u.y1 = b->y1;
+    if (b->x2 > u.x2) u.x2 = b->x2;
+    if (b->y2 > u.y2) u.y2 = b->y2;
+    return u;
+}
+
+static inline bool area_contains(const screen_capture_area_t* outer, const screen_capture_area_t* inner) {
+    return inner->x1 >= outer->x1 && inner->y1 >= outer->y1 && inner->x2 <= outer->x2 && inner->y2 <= outer->y2;
+}
+
+static void remove_pending(int i) {
+    memmove(&pending[i], &pending[i + 1], (size_t)(pending_count - i - 1) * sizeof(pending[0]));
+    pending_count--;
+}
+
+// Add to the pending areas the way LVGL joins invalidated areas: merged with one where that costs no
+// more than keeping both, otherwise kept apart while there is room
+static void add_pending(int x1, int y1, int x2, int y2) {
+    if (x1 < 0) x1 = 0;
+    if (y1 < 0) y1 = 0;
+    if (x2 >= screen_w) x2 = screen_w - 1;
+    if (y2 >= screen_h) y2 = screen_h - 1;
+    if (x1 > x2 || y1 > y2) {
+        return;
+    }
+    screen_capture_area_t a = {x1, y1, x2, y2};
+    for (int i = pending_count - 1; i >= 0; i--) {
+        if (area_contains(&pending[i], &a)) {
+            return;
+        }
+        if (area_contains(&a, &pending[i])) {
+            remove_pending(i);
+        }
+    }
+    int best = -1;
+    long best_growth = 0;
+    for (int i = 0; i < pending_count; i++) {
+        screen_capture_area_t u = area_union(&pending[i], &a);
+        long growth = area_size(&u) - area_size(&pending[i]) - area_size(&a);
+        if (best < 0 || growth < best_growth) {
+            best = i;
+            best_growth = growth;
+        }
+    }
+    if (best >= 0 && (best_growth <= 0 || pending_count == SCREEN_CAPTURE_PENDING_AREAS)) {
+        pending[best] = area_union(&pending[best], &a);
+    } else {
+        pending[pending_count++] = a;
+    }
+}
+
+void screen_capture_init(int width, int height, size_t buffer_size, bool swapped) {
+    pthread_mutex_lock(&capture_lock);
+    screen_w = width;
+    screen_h = height;
+    pixels_swapped = swapped;
+    if (buffer_size != buf_size) {
+        free(bufs[0]);
+        free(bufs[1]);
+        bufs[0] = bufs[1] = NULL;
+        buf_size = buffer_size;
+    }
+    pthread_mutex_unlock(&capture_lock);
+}
+
+esp_err_t screen_capture_start(void) {
+    pthread_mutex_lock(&capture_lock);
+    if (bufs[0] == NULL) {
+        bufs[0] = malloc(buf_size);
+        bufs[1] = malloc(buf_size);
+        if (bufs[0] == NULL || bufs[1] == NULL) {
+            free(bufs[0]);
+            free(bufs[1]);
+            bufs[0] = bufs[1] = NULL;
+            pthread_mutex_unlock(&capture_lock);
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    fill_len = 0;
+    armed = ready = false;
+    pending_count = 0;
+    add_pending(0, 0, screen_w - 1, screen_h - 1);
+    atomic_store(&running, true);
+    pthread_mutex_unlock(&capture_lock);
+    return ESP_OK;
+}
+
+void screen_capture_stop(void) {
+    pthread_mutex_lock(&capture_lock);
+    atomic_store(&running, false);
+    fill_len = 0;
+    armed = ready = false;
+    pending_count = 0;
+    pthread_mutex_unlock(&capture_lock);
+}
+
+bool screen_capture_running(void) {
+    return atomic_load_explicit(&running, memory_order_relaxed);
+}
+
+void screen_capture_request_full(void) {
+    pthread_mutex_lock(&capture_lock);
+    add_pending(0, 0, screen_w - 1, screen_h - 1);
+    pthread_mutex_unlock(&capture_lock);
+}
+
+void screen_capture_tee(int x1, int y1, int x2, int y2, const uint16_t* pixels, bool last) {
+    if (!atomic_load_explicit(&running, memory_order_relaxed)) {
+        return;
+    }
+    pthread_mutex_lock(&capture_lock);
+    if (!armed) {
+        add_pending(x1, y1, x2, y2);
+        stats.deferred++;
+        pthread_mutex_unlock(&capture_lock);
+        return;
+    }
+
+    int w = x2 - x1 + 1;
+    int h = y2 - y1 + 1;
+    int rows = 0;
+    size_t len = 0;
+    if (buf_size - fill_len > SCREEN_CAPTURE_RECT_HEADER) {
+        uint8_t* header = bufs[fill_index] + fill_len;
+        len = screen_codec_encode(pixels, w, h, w, pixels_swapped, header + SCREEN_CAPTURE_RECT_HEADER,
+                                  buf_size - fill_len - SCREEN_CAPTURE_RECT_HEADER, &rows);
+        if (rows > 0) {
+            header[0] = SCREEN_CAPTURE_RECT;
+            put_u16(header + 1, (unsigned)x1);
+            put_u16(header + 3, (unsigned)y1);
+            put_u16(header + 5, (unsigned)w);
+            put_u16(header + 7, (unsigned)rows);
+            put_u16(header + 9, (unsigned)len);
+            put_u16(header + 11, (unsigned)(len >> 16));
+            fill_len += SCREEN_CAPTURE_RECT_HEADER + len;
+            stats.rects++;
+            stats.pixels += (uint64_t)w * rows;
+            // Pending areas it covers are sent now; without this an animation would be redrawn for
+            // every capture on top of its own redraws
+            screen_capture_area_t sent = {x1, y1, x2, y1 + rows - 1};
+            for (int i = pending_count - 1; i >= 0; i--) {
+                if (area_contains(&sent, &pending[i])) {
+                    remove_pending(i);
+                }
+            }
+        }
+    }
+    if (rows < h) {
+        add_pending(x1, y1 + rows, x2, y2);
+        stats.deferred++;
+    }
+    if (last) {
+        armed = false;
+        ready = fill_len > 0;
+    }
+    pthread_mutex_unlock(&capture_lock);
+}
+
+bool screen_capture_next_invalidation(screen_capture_area_t* area) {
+    if (!atomic_load_explicit(&running, memory_order_relaxed)) {
+        return false;
+    }
+    pthread_mutex_lock(&capture_lock);
+    bool found = armed && budget > 0 && pending_count > 0;
+    if (found) {
+        screen_capture_area_t* p = &pending[0];
+        size_t w = (size_t)(p->x2 - p->x1 + 1);
+        size_t rows = budget / w;
+        *area = *p;
+        if (rows > (size_t)(p->y2 - p->y1)) {
+            budget -= (size_t)area_size(p);
+            remove_pending(0);
+        } else {
+            // The first band of a large area; at least one row so the mirror always moves on
+            rows = rows ? rows : 1;
+            area->y2 = p->y1 + (int)rows - 1;
+            p->y1 += (int)rows;
+            budget = 0;
+        }
+    }
+    pthread_mutex_unlock(&capture_lock);
+    return found;
+}
+
+void screen_capture_arm(void) {
+    pthread_mutex_lock(&capture_lock);
+    if (atomic_load_explicit(&running, memory_order_relaxed) && !ready) {
+        armed = true;
+        // About a buffer's worth at 1 byte per pixel; menus and text usually take far less, and rows
+        // that do not fit go back to pending
+        budget = buf_size;
+    }
+    pthread_mutex_unlock(&capture_lock);
+}
+
+size_t screen_capture_take(const uint8_t** data) {
+    size_t len = 0;
+    pthread_mutex_lock(&capture_lock);
+    if (ready) {
+        *data = bufs[fill_index];
+        len = fill_len;
+        fill_index ^= 1;
+        fill_len = 0;
+        ready = false;
+        stats.frames++;
+        stats.bytes += len;
+    }
+    pthread_mutex_unlock(&capture_lock);
+    return len;
+}
+
+void screen_capture_hello(uint8_t out[SCREEN_CAPTURE_HELLO_LEN]) {
+    out[0] = SCREEN_CAPTURE_HELLO;
+    put_u16(out + 1, (unsigned)screen_w);
+    put_u16(out + 3, (unsigned)screen_h);
+}
+
+void screen_capture_get_stats(screen_capture_stats_t* out) {
+    pthread_mutex_lock(&capture_lock);
+    *out = stats;
+    pthread_mutex_unlock(&capture_lock);
+}
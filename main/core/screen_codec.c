@@ -0,0 +1,168 @@
+#include "core/screen_codec.h"
+#include <string.h>
+
+#define OP_INDEX 0x00
+#define OP_DIFF 0x40
+#define OP_RUN 0x80
+#define OP_LUMA 0xC0
+#define OP_LONG_RUN 0xFE
+#define OP_RAW 0xFF
+
+#define SHORT_RUN_MAX 64
+
+static inline unsigned slot_of(uint16_t px) {
+    return ((px >> 11) * 3 + ((px >> 5) & 0x3F) * 5 + (px & 0x1F) * 7) & 63;
+}
+
+static inline size_t put_run(uint8_t* out, size_t pos, int run) {
+    if (run <= SHORT_RUN_MAX) {
+        out[pos++] = OP_RUN | (uint8_t)(run - 1);
+    } else {
+        out[pos++] = OP_LONG_RUN;
+        out[pos++] = (uint8_t)(run - 1);
+        out[pos++] = (uint8_t)((run - 1) >> 8);
+    }
+    return pos;
+}
+
+size_t screen_codec_encode(const uint16_t* pixels, int w, int h, int stride, bool swapped, uint8_t* out,
+                           size_t cap, int* rows) {
+    uint16_t index[64];
+    memset(index, 0, sizeof(index));
+    uint16_t prev = 0;
+    size_t pos = 0;
+    int done = 0;
+
+    for (int y = 0; y < h; y++) {
+        const uint16_t* row = pixels + (size_t)y * stride;
+        size_t row_start = pos;
+        int run = 0;
+        bool full = false;
+
+        for (int x = 0; x < w; x++) {
+            uint16_t px = swapped ? (uint16_t)((row[x] >> 8) | (row[x] << 8)) : row[x];
+            if (px == prev) {
+                run++;
+                continue;
+            }
+            // Room for a pending run and the widest pixel op
+            if (cap - pos < 6) {
+                full = true;
+                break;
+            }
+            if (run) {
+                pos = put_run(out, pos, run);
+                run = 0;
+            }
+
+            unsigned slot = slot_of(px);
+            if (index[slot] == px) {
+                out[pos++] = OP_INDEX | (uint8_t)slot;
+            } else {
+                index[slot] = px;
+                int dr = (int)(px >> 11) - (int)(prev >> 11);
+                int dg = (int)((px >> 5) & 0x3F) - (int)((prev >> 5) & 0x3F);
+                int db = (int)(px & 0x1F) - (int)(prev & 0x1F);
+                int dr_dg = dr - dg;
+                int db_dg = db - dg;
+                if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+                    out[pos++] = OP_DIFF | (uint8_t)((dr + 2) << 4 | (dg + 2) << 2 | (db + 2));
+                } else if (dg >= -16 && dg <= 15 && dr_dg >= -8 && dr_dg <= 7 && db_dg >= -8 && db_dg <= 7) {
+                    out[pos++] = OP_LUMA | (uint8_t)(dg + 16);
+                    out[pos++] = (uint8_t)((dr_dg + 8) << 4 | (db_dg + 8));
+                } else {
+                    out[pos++] = OP_RAW;
+                    out[pos++] = (uint8_t)px;
+                    out[pos++] = (uint8_t)(px >> 8);
+                }
+            }
+            prev = px;
+        }
+
+        if (!full && run) {
+            if (cap - pos < 3) {
+                full = true;
+            } else {
+                pos = put_run(out, pos, run);
+            }
+        }
+        if (full) {
+            pos = row_start;
+            break;
+        }
+        done++;
+    }
+
+    *rows = done;
+    return done ? pos : 0;
+}
+
+size_t screen_codec_decode(const uint8_t* in, size_t len, int w, int h, uint16_t* out, int stride) {
+    uint16_t index[64];
+    memset(index, 0, sizeof(index));
+    uint16_t prev = 0;
+    size_t pos = 0;
+
+    for (int y = 0; y < h; y++) {
+        uint16_t* row = out + (size_t)y * stride;
+        int x = 0;
+        while (x < w) {
+            if (pos >= len) {
+                return 0;
+            }
+            uint8_t op = in[pos++];
+            int run = 0;
+            uint16_t px;
+
+            if (op < OP_DIFF) {
+                px = index[op];
+            } else if (op < OP_RUN) {
+                int r = (int)(prev >> 11) + ((op >> 4) & 3) - 2;
+                int g = (int)((prev >> 5) & 0x3F) + ((op >> 2) & 3) - 2;
+                int b = (int)(prev & 0x1F) + (op & 3) - 2;
+                px = (uint16_t)((r & 0x1F) << 11 | (g & 0x3F) << 5 | (b & 0x1F));
+            } else if (op < OP_LUMA) {
+                run = (op & 0x3F) + 1;
+            } else if (op < 0xE0) {
+                if (pos >= len) {
+                    return 0;
+                }
+                int dg = (op & 0x1F) - 16;
+                int dr = dg + (in[pos] >> 4) - 8;
+                int db = dg + (in[pos] & 0x0F) - 8;
+                pos++;
+                int r = (int)(prev >> 11) + dr;
+                int g = (int)((prev >> 5) & 0x3F) + dg;
+                int b = (int)(prev & 0x1F) + db;
+                px = (uint16_t)((r & 0x1F) << 11 | (g & 0x3F) << 5 | (b & 0x1F));
+            } else if (op == OP_LONG_RUN || op == OP_RAW) {
+                if (len - pos < 2) {
+                    return 0;
+                }
+                uint16_t v = (uint16_t)(in[pos] | in[pos + 1] << 8);
+                pos += 2;
+                if (op == OP_RAW) {
+                    px = v;
+                } else {
+                    run = v + 1;
+                }
+            } else {
+                return 0;
+            }
+
+            if (run) {
+                if (run > w - x) {
+                    return 0;
+                }
+                for (int i = 0; i < run; i++) {
+                    row[x++] = prev;
+                }
+                continue;
+            }
+            index[slot_of(px)] = px;
+            prev = px;
+            row[x++] = px;
+        }
+    }
+    return pos;
+}
@@ -11,6 +11,8 @@
 #include <ctype.h>
 #include <core/commandline.h>
 #include "managers/gps_manager.h"
+#include "managers/console_stream.h"
+#include "core/command_jobs.h"
 #include "driver/usb_serial_jtag.h"
 
 #if defined(CONFIG_IDF_TARGET_ESP32S3) || defined(CONFIG_IDF_TARGET_ESP32C3) || defined(CONFIG_IDF_TARGET_ESP32C6)
@@ -32,6 +34,9 @@ void serial_task(void *pvParameter) {
     uint8_t *data = (uint8_t *)malloc(BUF_SIZE);
     int index = 0;
 
+    // Commands run on this task, so their output also reaches the web console and the job that ran them
+    console_stream_capture_stdout(command_jobs_output);
+
     while (1) {
         int length = 0;
 
@@ -69,6 +74,14 @@ void serial_task(void *pvParameter) {
             handle_serial_command(command.command);
         }
 
+        // Commands from the web API, with their output bound to the request
+        uint32_t job_id;
+        if (command_jobs_next(command.command, sizeof(command.command), &job_id)) {
+            int result = handle_serial_command(command.command);
+            fflush(stdout);
+            command_jobs_finish(job_id, result);
+        }
+
         vTaskDelay(10 / portTICK_PERIOD_MS);
     }
 
@@ -172,9 +185,14 @@ int handle_serial_command(const char *input) {
     }
 }
 
-void simulateCommand(const char *commandString) {
+esp_err_t simulateCommand(const char *commandString) {
     SerialCommand command;
     strncpy(command.command, commandString, sizeof(command.command) - 1);
     command.command[sizeof(command.command) - 1] = '\0';
-    xQueueSend(commandQueue, &command, portMAX_DELAY);
+    // Callers include the UI task, which must not hang behind a long-running command
+    if (xQueueSend(commandQueue, &command, 0) != pdTRUE) {
+        printf("Command queue full, dropped: %s\n", command.command);
+        return ESP_ERR_TIMEOUT;
+    }
+    return ESP_OK;
 }
\ No newline at end of file
@@ -2,8 +2,8 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include <string.h>
-#include <sys/dirent.h>
 #include <esp_log.h>
+#include "managers/capture_index.h"
 
 #define TAG "Utils"
 
@@ -55,60 +55,29 @@ int get_query_param_value(const char *query, const char *key, char *value, size_
 
 
 
+// Both lookups are answered from the per-directory capture index instead of a readdir walk
 int get_next_pcap_file_index(const char* base_name) {
-    char path[128];
-    int max_index = -1;
-
-
-    DIR *dir = opendir("/mnt/ghostesp/pcaps");
-    if (!dir) {
-        ESP_LOGE(TAG, "Failed to open directory /mnt/ghostesp/pcaps");
-        return -1;
-    }
-
-    
-    struct dirent *entry;
-    while ((entry = readdir(dir)) != NULL) {
-        
-        if (strncmp(entry->d_name, base_name, strlen(base_name)) == 0) {
-            
-            int index;
-            if (sscanf(entry->d_name + strlen(base_name), "_%d.pcap", &index) == 1) {
-                
-                if (index > max_index) {
-                    max_index = index;
-                }
-            }
-        }
+    int index = capture_index_peek_seq("/mnt/ghostesp/pcaps", base_name, "pcap");
+    if (index < 0) {
+        ESP_LOGE(TAG, "Failed to index directory /mnt/ghostesp/pcaps");
     }
-
-    closedir(dir);
-    return max_index + 1;
+    return index;
 }
 
 
 int get_next_csv_file_index(const char* base_name) {
-    char path[128];
-    int max_index = -1;
-
-    DIR *dir = opendir("/mnt/ghostesp/wardriving");
-    if (!dir) {
-        ESP_LOGE(TAG, "Failed to open directory /mnt/ghostesp/wardriving");
-        return -1;
+    int index = capture_index_peek_seq("/mnt/ghostesp/gps", base_name, "csv");
+    if (index < 0) {
+        ESP_LOGE(TAG, "Failed to index directory /mnt/ghostesp/gps");
     }
+    return index;
+}
 
-    struct dirent *entry;
-    while ((entry = readdir(dir)) != NULL) {
-        if (strncmp(entry->d_name, base_name, strlen(base_name)) == 0) {
-            int index;
-            if (sscanf(entry->d_name + strlen(base_name), "_%d.csv", &index) == 1) {
-                if (index > max_index) {
-                    max_index = index;
-                }
-            }
-        }
-    }
 
-    closedir(dir);
-    return max_index + 1;
-}
\ No newline at end of file
+int get_next_census_file_index(const char* base_name) {
+    int index = capture_index_peek_seq("/mnt/ghostesp/census", base_name, "csv");
+    if (index < 0) {
+        ESP_LOGE(TAG, "Failed to index directory /mnt/ghostesp/census");
+    }
+    return index;
+}
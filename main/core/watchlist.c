@@ -0,0 +1,338 @@
+#include "core/watchlist.h"
+#include "managers/rgb_manager.h"
+#include "managers/console_stream.h"
+#include "managers/views/terminal_screen.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+
+static const char *TAG = "WATCHLIST";
+
+#define ALERT_QUEUE_LEN 16
+#define COOLDOWN_SLOTS 16
+
+typedef struct {
+    uint8_t key[33];
+    uint8_t key_len;
+    uint32_t last_alert_s;
+} cooldown_slot_t;
+
+// Readers (the RX callback, web and console lookups) count themselves in the slot of the current
+// epoch while they use the list. Replacing it flips the epoch twice and waits for each slot to
+// drain, so the old list is freed only once nobody can still hold it.
+static _Atomic(watchlist_set_t *) active_list;
+static atomic_uint list_epoch;
+static atomic_uint list_readers[2];
+static pthread_mutex_t swap_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static QueueHandle_t alert_queue = NULL;
+static TaskHandle_t alert_task_handle = NULL;
+static portMUX_TYPE events_lock = portMUX_INITIALIZER_UNLOCKED;
+static watchlist_event_t events[WATCHLIST_EVENT_HISTORY];
+static uint32_t next_seq = 1;
+static cooldown_slot_t cooldown[COOLDOWN_SLOTS];
+static watchlist_stats_t stats;
+
+static const watchlist_set_t *list_acquire(unsigned *slot) {
+    *slot = atomic_load(&list_epoch) & 1;
+    atomic_fetch_add(&list_readers[*slot], 1);
+    return atomic_load(&active_list);
+}
+
+static void list_release(unsigned slot) {
+    atomic_fetch_sub(&list_readers[slot], 1);
+}
+
+// Install list and free the one it replaces once its readers are gone. A reader that sampled the
+// epoch just before a flip may still count itself in the old slot, hence the second flip: new
+// readers go to the other slot, so each wait only sees readers that were already running.
+static void list_swap(watchlist_set_t *list) {
+    pthread_mutex_lock(&swap_lock);
+    watchlist_set_t *old = atomic_exchange(&active_list, list);
+    for (int i = 0; i < 2; i++) {
+        unsigned slot = atomic_fetch_add(&list_epoch, 1) & 1;
+        while (atomic_load(&list_readers[slot]) != 0) {
+            vTaskDelay(1);
+        }
+    }
+    pthread_mutex_unlock(&swap_lock);
+    watchlist_set_free(old);
+}
+
+static void alert_task(void *pvParameters) {
+    watchlist_event_t event;
+
+    for (;;) {
+        if (xQueueReceive(alert_queue, &event, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+
+        // Suppress repeats of the same entry so a device that is always nearby doesn't flood the console
+        uint8_t key[33];
+        uint8_t key_len;
+        if (event.type == WATCHLIST_MATCH_SSID) {
+            key_len = (uint8_t)strlen(event.ssid);
+            memcpy(key, event.ssid, key_len);
+        } else {
+            key_len = 6;
+            memcpy(key, event.mac, 6);
+        }
+
+        cooldown_slot_t *slot = NULL;
+        cooldown_slot_t *oldest = &cooldown[0];
+        for (int i = 0; i < COOLDOWN_SLOTS; i++) {
+            if (cooldown[i].key_len == key_len && memcmp(cooldown[i].key, key, key_len) == 0) {
+                slot = &cooldown[i];
+                break;
+            }
+            if (cooldown[i].last_alert_s < oldest->last_alert_s) {
+                oldest = &cooldown[i];
+            }
+        }
+        if (slot != NULL && slot->last_alert_s != 0 &&
+            event.uptime_s - slot->last_alert_s < WATCHLIST_ALERT_COOLDOWN_S) {
+            continue;
+        }
+        if (slot == NULL) {
+            slot = oldest;
+            memcpy(slot->key, key, key_len);
+            slot->key_len = key_len;
+        }
+        slot->last_alert_s = event.uptime_s ? event.uptime_s : 1;
+
+        taskENTER_CRITICAL(&events_lock);
+        event.seq = next_seq++;
+        events[event.seq % WATCHLIST_EVENT_HISTORY] = event;
+        taskEXIT_CRITICAL(&events_lock);
+
+        const char *kind = event.type == WATCHLIST_MATCH_MAC ? "MAC" : (event.type == WATCHLIST_MATCH_OUI ? "OUI" : "SSID");
+        char alert[96];
+        bool by_ssid = event.type == WATCHLIST_MATCH_SSID;
+        snprintf(alert, sizeof(alert), "%s match %02X:%02X:%02X:%02X:%02X:%02X%s%s%s RSSI %d CH %u", kind,
+                 event.mac[0], event.mac[1], event.mac[2], event.mac[3], event.mac[4], event.mac[5],
+                 by_ssid ? " \"" : "", by_ssid ? event.ssid : "", by_ssid ? "\"" : "", event.rssi, event.channel);
+        console_stream_alert(alert);
+        if (event.type == WATCHLIST_MATCH_SSID) {
+            printf("[WATCHLIST] %s match \"%s\" from %02X:%02X:%02X:%02X:%02X:%02X RSSI %d CH %u\n", kind, event.ssid,
+                   event.mac[0], event.mac[1], event.mac[2], event.mac[3], event.mac[4], event.mac[5],
+                   event.rssi, event.channel);
+            TERMINAL_VIEW_ADD_TEXT("Watchlist: SSID %s (RSSI %d)\n", event.ssid, event.rssi);
+        } else {
+            printf("[WATCHLIST] %s match %02X:%02X:%02X:%02X:%02X:%02X RSSI %d CH %u\n", kind,
+                   event.mac[0], event.mac[1], event.mac[2], event.mac[3], event.mac[4], event.mac[5],
+                   event.rssi, event.channel);
+            TERMINAL_VIEW_ADD_TEXT("Watchlist: %s %02X:%02X:%02X:%02X:%02X:%02X (RSSI %d)\n", kind,
+                                   event.mac[0], event.mac[1], event.mac[2], event.mac[3], event.mac[4],
+                                   event.mac[5], event.rssi);
+        }
+
+        rgb_manager_set_color(&rgb_manager, 0, 255, 0, 0, false);
+        vTaskDelay(pdMS_TO_TICKS(250));
+        rgb_manager_set_color(&rgb_manager, 0, 0, 0, 0, false);
+    }
+}
+
+static esp_err_t watchlist_start_alert_task(void) {
+    if (alert_queue == NULL) {
+        alert_queue = xQueueCreate(ALERT_QUEUE_LEN, sizeof(watchlist_event_t));
+        if (alert_queue == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    if (alert_task_handle == NULL &&
+        xTaskCreate(alert_task, "watchlist_alert", 3072, NULL, 3, &alert_task_handle) != pdPASS) {
+        alert_task_handle = NULL;
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+esp_err_t watchlist_load(const char *path) {
+    watchlist_set_t *list;
+    esp_err_t ret = watchlist_set_load(path, &list);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    ret = watchlist_start_alert_task();
+    if (ret != ESP_OK) {
+        watchlist_set_free(list);
+        ESP_LOGE(TAG, "Failed to start alert task");
+        return ret;
+    }
+
+    // Reported before the swap: once installed, another load may replace and free the list
+    printf("Watchlist loaded: %lu MACs, %lu OUIs, %lu SSIDs (%lu lines rejected), %lu KB bloom filter\n",
+           (unsigned long)list->mac_count, (unsigned long)list->oui_count, (unsigned long)list->ssid_count,
+           (unsigned long)list->rejected_lines, (unsigned long)((list->bloom_mask + 1) / 8 / 1024));
+    TERMINAL_VIEW_ADD_TEXT("Watchlist loaded: %lu entries\n",
+                           (unsigned long)(list->mac_count + list->oui_count + list->ssid_count));
+    list_swap(list);
+    memset(&stats, 0, sizeof(stats));
+    return ESP_OK;
+}
+
+void watchlist_clear(void) {
+    if (atomic_load(&active_list) != NULL) {
+        list_swap(NULL);
+        printf("Watchlist cleared\n");
+    }
+}
+
+bool watchlist_is_loaded(void) {
+    return atomic_load_explicit(&active_list, memory_order_relaxed) != NULL;
+}
+
+static void raise_event(watchlist_match_type_t type, const uint8_t *mac, const uint8_t *ssid, size_t ssid_len,
+                        int8_t rssi, uint8_t channel) {
+    watchlist_event_t event = {0};
+    event.type = type;
+    event.uptime_s = (uint32_t)(esp_timer_get_time() / 1000000);
+    memcpy(event.mac, mac, 6);
+    if (ssid != NULL) {
+        memcpy(event.ssid, ssid, ssid_len);
+    }
+    event.rssi = rssi;
+    event.channel = channel;
+
+    stats.confirmed_hits++;
+    if (xQueueSend(alert_queue, &event, 0) != pdTRUE) {
+        stats.events_dropped++;
+    }
+}
+
+static void check_address(const watchlist_set_t *list, const uint8_t *mac, int8_t rssi, uint8_t channel) {
+    if (mac[0] & 0x01) {
+        return;  // Broadcast / multicast
+    }
+    if (list->mac_count && watchlist_set_maybe(list, WATCHLIST_MATCH_MAC, mac, 6)) {
+        stats.bloom_hits++;
+        if (watchlist_set_has_mac(list, mac)) {
+            raise_event(WATCHLIST_MATCH_MAC, mac, NULL, 0, rssi, channel);
+            return;
+        }
+    }
+    if (list->oui_count && watchlist_set_maybe(list, WATCHLIST_MATCH_OUI, mac, 3)) {
+        stats.bloom_hits++;
+        if (watchlist_set_has_oui(list, mac)) {
+            raise_event(WATCHLIST_MATCH_OUI, mac, NULL, 0, rssi, channel);
+        }
+    }
+}
+
+static void check_frame(const watchlist_set_t *list, const uint8_t *frame, size_t len, int8_t rssi, uint8_t channel) {
+    stats.frames_checked++;
+
+    uint8_t type = (frame[0] >> 2) & 0x03;
+    uint8_t subtype = frame[0] >> 4;
+
+    // Control frames carry one or two addresses, management and data frames at least three
+    check_address(list, frame + 4, rssi, channel);
+    if (len >= 16) {
+        check_address(list, frame + 10, rssi, channel);
+    }
+    if (len >= 24 && type != 1) {
+        const uint8_t *addr3 = frame + 16;
+        if (memcmp(addr3, frame + 4, 6) != 0 && memcmp(addr3, frame + 10, 6) != 0) {
+            check_address(list, addr3, rssi, channel);
+        }
+    }
+
+    if (list->ssid_count == 0 || type != 0) {
+        return;
+    }
+
+    // SSID element of beacons, probe requests and probe responses
+    size_t ie_start;
+    if (subtype == 0x08 || subtype == 0x05) {
+        ie_start = 36;
+    } else if (subtype == 0x04) {
+        ie_start = 24;
+    } else {
+        return;
+    }
+    if (len < ie_start + 2 || frame[ie_start] != 0) {
+        return;
+    }
+
+    size_t ssid_len = frame[ie_start + 1];
+    const uint8_t *ssid = frame + ie_start + 2;
+    if (ssid_len == 0 || ssid_len > 32 || ie_start + 2 + ssid_len > len) {
+        return;
+    }
+
+    if (watchlist_set_maybe(list, WATCHLIST_MATCH_SSID, ssid, ssid_len)) {
+        stats.bloom_hits++;
+        if (watchlist_set_has_ssid(list, (const char *)ssid, ssid_len)) {
+            raise_event(WATCHLIST_MATCH_SSID, frame + 10, ssid, ssid_len, rssi, channel);
+        }
+    }
+}
+
+void watchlist_check_frame(const uint8_t *frame, size_t len, int8_t rssi, uint8_t channel) {
+    if (frame == NULL || len < 10) {
+        return;
+    }
+    unsigned slot;
+    const watchlist_set_t *list = list_acquire(&slot);
+    if (list != NULL) {
+        check_frame(list, frame, len, rssi, channel);
+    }
+    list_release(slot);
+}
+
+bool watchlist_contains_mac(const uint8_t mac[6]) {
+    unsigned slot;
+    const watchlist_set_t *list = list_acquire(&slot);
+    bool found = list != NULL && (watchlist_set_has_mac(list, mac) || watchlist_set_has_oui(list, mac));
+    list_release(slot);
+    return found;
+}
+
+bool watchlist_contains_ssid(const char *ssid, size_t len) {
+    unsigned slot;
+    const watchlist_set_t *list = list_acquire(&slot);
+    bool found = list != NULL && watchlist_set_has_ssid(list, ssid, len);
+    list_release(slot);
+    return found;
+}
+
+void watchlist_get_stats(watchlist_stats_t *out) {
+    if (out == NULL) {
+        return;
+    }
+    *out = stats;
+    unsigned slot;
+    const watchlist_set_t *list = list_acquire(&slot);
+    if (list != NULL) {
+        out->macs = list->mac_count;
+        out->ouis = list->oui_count;
+        out->ssids = list->ssid_count;
+        out->rejected_lines = list->rejected_lines;
+        out->bloom_bits = list->bloom_mask + 1;
+    }
+    list_release(slot);
+}
+
+size_t watchlist_get_events(uint32_t since_seq, watchlist_event_t *out, size_t max) {
+    size_t count = 0;
+
+    taskENTER_CRITICAL(&events_lock);
+    uint32_t first = next_seq > WATCHLIST_EVENT_HISTORY ? next_seq - WATCHLIST_EVENT_HISTORY : 1;
+    if (since_seq + 1 > first) {
+        first = since_seq + 1;
+    }
+    for (uint32_t seq = first; seq < next_seq && count < max; seq++) {
+        out[count++] = events[seq % WATCHLIST_EVENT_HISTORY];
+    }
+    taskEXIT_CRITICAL(&events_lock);
+
+    return count;
+}
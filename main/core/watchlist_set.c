@@ -0,0 +1,295 @@
+#include "core/watchlist_set.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#ifdef ESP_PLATFORM
+#include <esp_heap_caps.h>
+#endif
+
+#define BLOOM_BITS_PER_ENTRY 10     // ~1% false positive rate with BLOOM_HASHES probes
+#define BLOOM_HASHES 7
+
+static void *watchlist_alloc(size_t size) {
+#ifdef ESP_PLATFORM
+    // Large lists only fit in PSRAM; boards without it fall back to internal RAM
+    void *ptr = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    return ptr ? ptr : malloc(size);
+#else
+    return malloc(size);
+#endif
+}
+
+void watchlist_set_free(watchlist_set_t *list) {
+    if (list == NULL) {
+        return;
+    }
+    free(list->bloom);
+    free(list->macs);
+    free(list->ouis);
+    free(list->ssids);
+    free(list->ssid_pool);
+    free(list);
+}
+
+static uint64_t watchlist_hash(uint8_t tag, const uint8_t *data, size_t len) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    h = (h ^ tag) * 0x100000001b3ULL;
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ data[i]) * 0x100000001b3ULL;
+    }
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+static void bloom_add(watchlist_set_t *list, uint8_t tag, const uint8_t *data, size_t len) {
+    uint64_t h = watchlist_hash(tag, data, len);
+    uint32_t h1 = (uint32_t)h;
+    uint32_t h2 = (uint32_t)(h >> 32) | 1;
+    for (int i = 0; i < BLOOM_HASHES; i++) {
+        uint32_t bit = (h1 + i * h2) & list->bloom_mask;
+        list->bloom[bit >> 3] |= (uint8_t)(1 << (bit & 7));
+    }
+}
+
+bool watchlist_set_maybe(const watchlist_set_t *list, watchlist_match_type_t type, const uint8_t *data, size_t len) {
+    uint64_t h = watchlist_hash((uint8_t)type, data, len);
+    uint32_t h1 = (uint32_t)h;
+    uint32_t h2 = (uint32_t)(h >> 32) | 1;
+    for (int i = 0; i < BLOOM_HASHES; i++) {
+        uint32_t bit = (h1 + i * h2) & list->bloom_mask;
+        if (!(list->bloom[bit >> 3] & (1 << (bit & 7)))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int cmp_mac(const void *a, const void *b) {
+    return memcmp(a, b, 6);
+}
+
+static int cmp_oui(const void *a, const void *b) {
+    return memcmp(a, b, 3);
+}
+
+static int cmp_ssid_key(const char *a, size_t a_len, const char *b, size_t b_len) {
+    if (a_len != b_len) {
+        return a_len < b_len ? -1 : 1;
+    }
+    return memcmp(a, b, a_len);
+}
+
+static int cmp_ssid(const void *a, const void *b) {
+    const char *sa = *(const char *const *)a;
+    const char *sb = *(const char *const *)b;
+    return cmp_ssid_key(sa, strlen(sa), sb, strlen(sb));
+}
+
+static bool search_bytes(const uint8_t *array, uint32_t count, size_t width, const uint8_t *key) {
+    uint32_t lo = 0;
+    uint32_t hi = count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        int c = memcmp(array + (size_t)mid * width, key, width);
+        if (c == 0) {
+            return true;
+        }
+        if (c < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return false;
+}
+
+bool watchlist_set_has_mac(const watchlist_set_t *list, const uint8_t *mac) {
+    return search_bytes(list->macs, list->mac_count, 6, mac);
+}
+
+bool watchlist_set_has_oui(const watchlist_set_t *list, const uint8_t *mac) {
+    return search_bytes(list->ouis, list->oui_count, 3, mac);
+}
+
+bool watchlist_set_has_ssid(const watchlist_set_t *list, const char *ssid, size_t len) {
+    uint32_t lo = 0;
+    uint32_t hi = list->ssid_count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        const char *entry = list->ssids[mid];
+        int c = cmp_ssid_key(entry, strlen(entry), ssid, len);
+        if (c == 0) {
+            return true;
+        }
+        if (c < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return false;
+}
+
+// Sort and drop duplicates in place; returns the new count
+static uint32_t sort_unique(uint8_t *array, uint32_t count, size_t width, int (*cmp)(const void *, const void *)) {
+    if (count == 0) {
+        return 0;
+    }
+    qsort(array, count, width, cmp);
+    uint32_t out = 1;
+    for (uint32_t i = 1; i < count; i++) {
+        if (memcmp(array + (size_t)i * width, array + (size_t)(out - 1) * width, width) != 0) {
+            memmove(array + (size_t)out * width, array + (size_t)i * width, width);
+            out++;
+        }
+    }
+    return out;
+}
+
+static char *trim(char *line) {
+    while (isspace((unsigned char)*line)) {
+        line++;
+    }
+    char *end = line + strlen(line);
+    while (end > line && isspace((unsigned char)end[-1])) {
+        *--end = '\0';
+    }
+    return line;
+}
+
+// Parse hex digits ignoring ':' '-' '.' separators; returns the number of bytes or -1
+static int parse_hex_address(const char *text, uint8_t *out) {
+    int nibbles = 0;
+    for (const char *p = text; *p; p++) {
+        if (*p == ':' || *p == '-' || *p == '.') {
+            continue;
+        }
+        if (!isxdigit((unsigned char)*p) || nibbles >= 12) {
+            return -1;
+        }
+        int v = isdigit((unsigned char)*p) ? *p - '0' : (tolower((unsigned char)*p) - 'a' + 10);
+        if (nibbles % 2 == 0) {
+            out[nibbles / 2] = (uint8_t)(v << 4);
+        } else {
+            out[nibbles / 2] |= (uint8_t)v;
+        }
+        nibbles++;
+    }
+    return (nibbles == 12 || nibbles == 6) ? nibbles / 2 : -1;
+}
+
+static bool is_ssid_line(const char *line) {
+    return strncasecmp(line, "ssid:", 5) == 0;
+}
+
+esp_err_t watchlist_set_load(const char *path, watchlist_set_t **out) {
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        printf("Failed to open watchlist %s\n", path);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    // First pass sizes every array so the second pass never reallocates
+    char line[128];
+    uint32_t mac_count = 0, oui_count = 0, ssid_count = 0;
+    size_t ssid_bytes = 0;
+    while (fgets(line, sizeof(line), f)) {
+        char *entry = trim(line);
+        uint8_t addr[6];
+        if (*entry == '\0' || *entry == '#') {
+            continue;
+        }
+        if (is_ssid_line(entry)) {
+            size_t len = strlen(entry + 5);
+            if (len > 0 && len <= 32) {
+                ssid_count++;
+                ssid_bytes += len + 1;
+            }
+            continue;
+        }
+        int n = parse_hex_address(entry, addr);
+        if (n == 6) {
+            mac_count++;
+        } else if (n == 3) {
+            oui_count++;
+        }
+    }
+
+    uint32_t total = mac_count + oui_count + ssid_count;
+    if (total == 0) {
+        fclose(f);
+        printf("Watchlist %s has no valid entries\n", path);
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    uint32_t bloom_bits = 1024;
+    while (bloom_bits < total * BLOOM_BITS_PER_ENTRY) {
+        bloom_bits <<= 1;
+    }
+
+    watchlist_set_t *list = calloc(1, sizeof(watchlist_set_t));
+    if (list != NULL) {
+        list->bloom = watchlist_alloc(bloom_bits / 8);
+        list->macs = mac_count ? watchlist_alloc((size_t)mac_count * 6) : NULL;
+        list->ouis = oui_count ? watchlist_alloc((size_t)oui_count * 3) : NULL;
+        list->ssids = ssid_count ? watchlist_alloc(ssid_count * sizeof(char *)) : NULL;
+        list->ssid_pool = ssid_count ? watchlist_alloc(ssid_bytes) : NULL;
+    }
+    if (list == NULL || list->bloom == NULL || (mac_count && !list->macs) || (oui_count && !list->ouis) ||
+        (ssid_count && (!list->ssids || !list->ssid_pool))) {
+        fclose(f);
+        watchlist_set_free(list);
+        printf("Not enough memory for a watchlist of %lu entries\n", (unsigned long)total);
+        return ESP_ERR_NO_MEM;
+    }
+    memset(list->bloom, 0, bloom_bits / 8);
+    list->bloom_mask = bloom_bits - 1;
+
+    rewind(f);
+    size_t pool_used = 0;
+    while (fgets(line, sizeof(line), f)) {
+        char *entry = trim(line);
+        uint8_t addr[6];
+        if (*entry == '\0' || *entry == '#') {
+            continue;
+        }
+        if (is_ssid_line(entry)) {
+            size_t len = strlen(entry + 5);
+            if (len > 0 && len <= 32 && list->ssid_count < ssid_count) {
+                char *dst = list->ssid_pool + pool_used;
+                memcpy(dst, entry + 5, len + 1);
+                pool_used += len + 1;
+                list->ssids[list->ssid_count++] = dst;
+                bloom_add(list, WATCHLIST_MATCH_SSID, (const uint8_t *)dst, len);
+            } else {
+                list->rejected_lines++;
+            }
+            continue;
+        }
+        int n = parse_hex_address(entry, addr);
+        if (n == 6 && list->mac_count < mac_count) {
+            memcpy(list->macs + (size_t)list->mac_count++ * 6, addr, 6);
+            bloom_add(list, WATCHLIST_MATCH_MAC, addr, 6);
+        } else if (n == 3 && list->oui_count < oui_count) {
+            memcpy(list->ouis + (size_t)list->oui_count++ * 3, addr, 3);
+            bloom_add(list, WATCHLIST_MATCH_OUI, addr, 3);
+        } else {
+            list->rejected_lines++;
+        }
+    }
+    fclose(f);
+
+    list->mac_count = sort_unique(list->macs, list->mac_count, 6, cmp_mac);
+    list->oui_count = sort_unique(list->ouis, list->oui_count, 3, cmp_oui);
+    if (list->ssid_count > 0) {
+        qsort(list->ssids, list->ssid_count, sizeof(char *), cmp_ssid);
+    }
+    *out = list;
+    return ESP_OK;
+}
@@ -0,0 +1,632 @@
+#include "core/wps_survey.h"
+#include "managers/sd_card_manager.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <esp_heap_caps.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+static const char *TAG = "WPS_SURVEY";
+
+#define WPS_CONF_METHODS_PBC         0x0080
+#define WPS_CONF_METHODS_PIN_DISPLAY 0x0004
+#define WPS_CONF_METHODS_PIN_KEYPAD  0x0008
+
+#define WPS_ATTR_CONFIG_METHODS      0x1008
+#define WPS_ATTR_DEVICE_NAME         0x1011
+#define WPS_ATTR_MANUFACTURER        0x1021
+#define WPS_ATTR_MODEL_NAME          0x1023
+#define WPS_ATTR_MODEL_NUMBER        0x1024
+#define WPS_ATTR_SELECTED_REGISTRAR  0x1041
+#define WPS_ATTR_STATE               0x1044
+#define WPS_ATTR_VENDOR_EXTENSION    0x1049
+#define WPS_ATTR_VERSION             0x104A
+#define WPS_ATTR_SR_CONFIG_METHODS   0x1053
+#define WPS_ATTR_AP_SETUP_LOCKED     0x1057
+
+#define WPS_MAX_ATTR_BYTES 512   // WPS data split over several vendor IEs is reassembled up to this size
+#define HASH_EMPTY UINT32_MAX
+
+typedef struct {
+    wps_survey_entry_t *entries;   // Dense, insertion order
+    uint32_t count;
+    uint32_t capacity;
+    uint32_t *slots;               // Open addressing over entry indices, at least twice the entry capacity
+    uint32_t slot_mask;
+    bool *details_complete;        // Probe responses can still fill in device strings beacons leave out
+} wps_table_t;
+
+static wps_table_t table = {0};
+static SemaphoreHandle_t table_mutex = NULL;
+static TaskHandle_t grower_task = NULL;
+static uint32_t max_entries = WPS_SURVEY_INITIAL_CAPACITY;
+static uint32_t generation = 0;    // Bumped by reset, so a grow prepared for an older table is thrown away
+static bool grow_requested = false;
+static uint32_t dropped_new = 0;
+// One bit per BSSID hash of the networks counted in dropped_new, so a network beaconing every 100 ms
+// is counted once. Two networks sharing a bit count as one, so the figure is a lower bound.
+static uint8_t dropped_seen[512];
+
+static uint32_t bssid_hash(const uint8_t *bssid) {
+    // The low bytes of a BSSID vary the most; FNV over all six keeps vendor blocks from clustering
+    uint32_t h = 2166136261u;
+    for (int i = 0; i < 6; i++) {
+        h = (h ^ bssid[i]) * 16777619u;
+    }
+    return h;
+}
+
+static bool table_lock(TickType_t wait) {
+    return table_mutex != NULL && xSemaphoreTake(table_mutex, wait) == pdTRUE;
+}
+
+static void table_unlock(void) {
+    xSemaphoreGive(table_mutex);
+}
+
+static int32_t table_find(const uint8_t *bssid) {
+    if (table.slots == NULL) {
+        return -1;
+    }
+    for (uint32_t i = bssid_hash(bssid) & table.slot_mask;; i = (i + 1) & table.slot_mask) {
+        uint32_t idx = table.slots[i];
+        if (idx == HASH_EMPTY) {
+            return -1;
+        }
+        if (memcmp(table.entries[idx].bssid, bssid, 6) == 0) {
+            return (int32_t)idx;
+        }
+    }
+}
+
+static void table_insert_slot(uint32_t idx) {
+    uint32_t i = bssid_hash(table.entries[idx].bssid) & table.slot_mask;
+    while (table.slots[i] != HASH_EMPTY) {
+        i = (i + 1) & table.slot_mask;
+    }
+    table.slots[i] = idx;
+}
+
+// Bytes a table of n entries takes
+static size_t table_bytes(uint32_t n) {
+    uint32_t slot_count = 1;
+    while (slot_count < n * 2) {
+        slot_count <<= 1;
+    }
+    return n * (sizeof(wps_survey_entry_t) + sizeof(bool)) + slot_count * sizeof(uint32_t);
+}
+
+// Largest table the survey may grow to: WPS_SURVEY_HEAP_PERCENT of the free heap (PSRAM included where
+// malloc can use it), counting the old and the new table that coexist while it is doubled
+static uint32_t limit_from_heap(void) {
+    size_t budget = heap_caps_get_free_size(MALLOC_CAP_8BIT) / 100 * WPS_SURVEY_HEAP_PERCENT;
+    uint32_t limit = WPS_SURVEY_INITIAL_CAPACITY;
+    while (table_bytes(limit * 2) + table_bytes(limit) <= budget) {
+        limit *= 2;
+    }
+    // The last step from limit may stop short of doubling
+    uint32_t last = limit;
+    for (uint32_t step = limit / 2; step >= WPS_SURVEY_INITIAL_CAPACITY; step /= 2) {
+        if (table_bytes(limit + step) + table_bytes(last) <= budget) {
+            limit += step;
+        }
+    }
+    return limit;
+}
+
+// Build a table of new_capacity outside the lock, then copy the entries over and swap it in. Runs on the
+// grower task (and in reset), never on the RX path, which only ever waits for the lock with a zero timeout.
+static bool table_grow(uint32_t new_capacity, uint32_t for_generation) {
+    uint32_t slot_count = 1;
+    while (slot_count < new_capacity * 2) {
+        slot_count <<= 1;
+    }
+    wps_survey_entry_t *entries = malloc(new_capacity * sizeof(wps_survey_entry_t));
+    bool *complete = malloc(new_capacity * sizeof(bool));
+    uint32_t *slots = malloc(slot_count * sizeof(uint32_t));
+    if (entries == NULL || complete == NULL || slots == NULL) {
+        free(entries);
+        free(complete);
+        free(slots);
+        return false;
+    }
+
+    if (!table_lock(portMAX_DELAY)) {
+        free(entries);
+        free(complete);
+        free(slots);
+        return false;
+    }
+    if (generation != for_generation || table.capacity >= new_capacity) {
+        table_unlock();
+        free(entries);
+        free(complete);
+        free(slots);
+        return true;
+    }
+    memcpy(entries, table.entries, table.count * sizeof(wps_survey_entry_t));
+    memcpy(complete, table.details_complete, table.count * sizeof(bool));
+    wps_table_t old = table;
+    table.entries = entries;
+    table.details_complete = complete;
+    table.slots = slots;
+    table.slot_mask = slot_count - 1;
+    table.capacity = new_capacity;
+    memset(table.slots, 0xFF, slot_count * sizeof(uint32_t));
+    for (uint32_t i = 0; i < table.count; i++) {
+        table_insert_slot(i);
+    }
+    table_unlock();
+
+    free(old.entries);
+    free(old.details_complete);
+    free(old.slots);
+    return true;
+}
+
+static void grower_main(void *arg) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (!table_lock(portMAX_DELAY)) {
+            continue;
+        }
+        uint32_t capacity = table.capacity;
+        uint32_t limit = max_entries;
+        uint32_t gen = generation;
+        table_unlock();
+
+        uint32_t target = capacity ? capacity * 2 : WPS_SURVEY_INITIAL_CAPACITY;
+        if (target > limit) {
+            target = limit;
+        }
+        bool ok = target <= capacity || table_grow(target, gen);
+
+        table_lock(portMAX_DELAY);
+        if (!ok && generation == gen) {
+            // The heap went elsewhere since the survey started; stop where we are
+            ESP_LOGW(TAG, "No memory to grow the WPS table past %lu networks", (unsigned long)table.capacity);
+            max_entries = table.capacity;
+        }
+        grow_requested = false;
+        table_unlock();
+    }
+}
+
+esp_err_t wps_survey_init(void) {
+    if (table_mutex == NULL) {
+        table_mutex = xSemaphoreCreateMutex();
+    }
+    if (table_mutex != NULL && grower_task == NULL) {
+        xTaskCreate(grower_main, "wps_grow", 3072, NULL, tskIDLE_PRIORITY + 2, &grower_task);
+    }
+    return table_mutex != NULL && grower_task != NULL ? ESP_OK : ESP_ERR_NO_MEM;
+}
+
+void wps_survey_reset(void) {
+    if (!table_lock(portMAX_DELAY)) {
+        return;
+    }
+    free(table.entries);
+    free(table.slots);
+    free(table.details_complete);
+    memset(&table, 0, sizeof(table));
+    dropped_new = 0;
+    memset(dropped_seen, 0, sizeof(dropped_seen));
+    generation++;
+    uint32_t gen = generation;
+    table_unlock();
+
+    // Sized while the survey's own table is empty; the first block is allocated here, not on the RX path
+    uint32_t limit = limit_from_heap();
+    table_lock(portMAX_DELAY);
+    max_entries = limit;
+    table_unlock();
+    table_grow(WPS_SURVEY_INITIAL_CAPACITY, gen);
+    ESP_LOGI(TAG, "WPS survey table can hold up to %lu networks", (unsigned long)limit);
+}
+
+static void copy_attr_string(char *dst, size_t dst_size, const uint8_t *src, uint16_t len) {
+    size_t n = len < dst_size - 1 ? len : dst_size - 1;
+    for (size_t i = 0; i < n; i++) {
+        // Exports are CSV/JSON; keep them printable rather than trusting vendor strings
+        dst[i] = (src[i] >= 0x20 && src[i] < 0x7F) ? (char)src[i] : '?';
+    }
+    dst[n] = '\0';
+}
+
+// Walk the information elements once, pulling out the SSID and reassembling the WPS attributes.
+// Returns the number of WPS attribute bytes, 0 if the frame carries no WPS element.
+static size_t collect_wps(const uint8_t *frame, size_t len, char *ssid, uint8_t *attrs) {
+    size_t attr_len = 0;
+    bool found = false;
+
+    ssid[0] = '\0';
+    for (size_t i = 36; i + 2 <= len; ) {
+        uint8_t id = frame[i];
+        uint8_t ie_len = frame[i + 1];
+        const uint8_t *body = &frame[i + 2];
+        if (i + 2 + ie_len > len) {
+            break;
+        }
+
+        if (id == 0 && ie_len <= 32) {
+            copy_attr_string(ssid, 33, body, ie_len);
+        } else if (id == 221 && ie_len >= 4 && body[0] == 0x00 && body[1] == 0x50 && body[2] == 0xF2 &&
+                   body[3] == 0x04) {
+            found = true;
+            size_t n = ie_len - 4;
+            if (attr_len + n > WPS_MAX_ATTR_BYTES) {
+                n = WPS_MAX_ATTR_BYTES - attr_len;
+            }
+            memcpy(attrs + attr_len, body + 4, n);
+            attr_len += n;
+        }
+
+        i += 2 + ie_len;
+    }
+
+    return found ? (attr_len ? attr_len : 1) : 0;
+}
+
+static void parse_wps_attrs(wps_survey_entry_t *e, const uint8_t *attrs, size_t len) {
+    uint16_t sr_config_methods = 0;
+
+    for (size_t i = 0; i + 4 <= len; ) {
+        uint16_t id = (attrs[i] << 8) | attrs[i + 1];
+        uint16_t alen = (attrs[i + 2] << 8) | attrs[i + 3];
+        const uint8_t *v = &attrs[i + 4];
+        if (i + 4 + alen > len) {
+            break;
+        }
+
+        switch (id) {
+            case WPS_ATTR_VERSION:
+                if (alen == 1 && e->version == 0) e->version = v[0];
+                break;
+            case WPS_ATTR_STATE:
+                if (alen == 1) e->state = v[0];
+                break;
+            case WPS_ATTR_AP_SETUP_LOCKED:
+                if (alen == 1) e->ap_setup_locked = v[0] != 0;
+                break;
+            case WPS_ATTR_SELECTED_REGISTRAR:
+                if (alen == 1) e->selected_registrar = v[0] != 0;
+                break;
+            case WPS_ATTR_CONFIG_METHODS:
+                if (alen == 2) e->config_methods = (v[0] << 8) | v[1];
+                break;
+            case WPS_ATTR_SR_CONFIG_METHODS:
+                if (alen == 2) sr_config_methods = (v[0] << 8) | v[1];
+                break;
+            case WPS_ATTR_DEVICE_NAME:
+                copy_attr_string(e->device_name, sizeof(e->device_name), v, alen);
+                break;
+            case WPS_ATTR_MANUFACTURER:
+                copy_attr_string(e->manufacturer, sizeof(e->manufacturer), v, alen);
+                break;
+            case WPS_ATTR_MODEL_NAME:
+                copy_attr_string(e->model_name, sizeof(e->model_name), v, alen);
+                break;
+            case WPS_ATTR_MODEL_NUMBER:
+                copy_attr_string(e->model_number, sizeof(e->model_number), v, alen);
+                break;
+            case WPS_ATTR_VENDOR_EXTENSION:
+                // WFA extension (00:37:2A) subelement 0 carries Version2
+                if (alen >= 3 && v[0] == 0x00 && v[1] == 0x37 && v[2] == 0x2A) {
+                    for (size_t j = 3; j + 2 <= alen; j += 2 + v[j + 1]) {
+                        if (v[j] == 0x00 && v[j + 1] == 1 && j + 3 <= alen) {
+                            e->version = v[j + 2];
+                            break;
+                        }
+                    }
+                }
+                break;
+            default:
+                break;
+        }
+
+        i += 4 + alen;
+    }
+
+    // Beacons only advertise the registrar's methods while a WPS session is armed
+    uint16_t methods = e->config_methods ? e->config_methods : sr_config_methods;
+    if (methods & (WPS_CONF_METHODS_PIN_DISPLAY | WPS_CONF_METHODS_PIN_KEYPAD)) {
+        e->mode = WPS_MODE_PIN;
+    } else if (methods & WPS_CONF_METHODS_PBC) {
+        e->mode = WPS_MODE_PBC;
+    } else {
+        e->mode = WPS_MODE_NONE;
+    }
+}
+
+wps_survey_result_t wps_survey_observe(const uint8_t *frame, size_t len, int8_t rssi, uint8_t channel,
+                                       wps_survey_entry_t *out) {
+    if (frame == NULL || len < 36) {
+        return WPS_SURVEY_NOT_WPS;
+    }
+
+    const uint8_t *bssid = frame + 16;
+    bool is_probe_resp = (frame[0] & 0xFC) == 0x50;
+    uint32_t now = (uint32_t)(esp_timer_get_time() / 1000000);
+
+    // Never block the RX path; a busy table just means this beacon is skipped, another follows in 100 ms
+    if (!table_lock(0)) {
+        return WPS_SURVEY_SKIPPED;
+    }
+
+    int32_t idx = table_find(bssid);
+    if (idx >= 0 && (table.details_complete[idx] || !is_probe_resp)) {
+        wps_survey_entry_t *e = &table.entries[idx];
+        e->last_seen_s = now;
+        e->seen_count++;
+        if (rssi > e->rssi) {
+            e->rssi = rssi;
+        }
+        if (out != NULL) {
+            *out = *e;
+        }
+        table_unlock();
+        return WPS_SURVEY_UPDATED;
+    }
+    table_unlock();
+
+    // Only the promiscuous callback parses frames, so one scratch buffer is enough
+    static uint8_t attrs[WPS_MAX_ATTR_BYTES];
+    char ssid[33];
+    size_t attr_len = collect_wps(frame, len, ssid, attrs);
+    if (attr_len == 0) {
+        return WPS_SURVEY_NOT_WPS;
+    }
+
+    if (!table_lock(0)) {
+        return WPS_SURVEY_SKIPPED;
+    }
+
+    wps_survey_result_t result;
+    idx = table_find(bssid);
+    if (idx >= 0) {
+        // Probe response for a BSSID first seen in a beacon: fill in the device strings
+        wps_survey_entry_t *e = &table.entries[idx];
+        parse_wps_attrs(e, attrs, attr_len);
+        if (e->ssid[0] == '\0') {
+            memcpy(e->ssid, ssid, sizeof(e->ssid));
+        }
+        e->last_seen_s = now;
+        e->seen_count++;
+        table.details_complete[idx] = true;
+        result = WPS_SURVEY_UPDATED;
+    } else if (table.count == table.capacity) {
+        // The grower is behind (a burst of new networks); this one is stored from its next beacon. At
+        // the limit it is counted instead.
+        if (table.capacity >= max_entries) {
+            uint32_t bit = bssid_hash(bssid) % (sizeof(dropped_seen) * 8);
+            if (!(dropped_seen[bit / 8] & (1u << (bit % 8)))) {
+                dropped_seen[bit / 8] |= (uint8_t)(1u << (bit % 8));
+                dropped_new++;
+            }
+        }
+        result = WPS_SURVEY_SKIPPED;
+    } else {
+        idx = (int32_t)table.count++;
+        wps_survey_entry_t *e = &table.entries[idx];
+        memset(e, 0, sizeof(*e));
+        memcpy(e->bssid, bssid, 6);
+        memcpy(e->ssid, ssid, sizeof(e->ssid));
+        parse_wps_attrs(e, attrs, attr_len);
+        e->rssi = rssi;
+        e->channel = channel;
+        e->first_seen_s = now;
+        e->last_seen_s = now;
+        e->seen_count = 1;
+        table.details_complete[idx] = is_probe_resp || e->manufacturer[0] != '\0';
+        table_insert_slot((uint32_t)idx);
+        result = WPS_SURVEY_NEW;
+    }
+    if (out != NULL && idx >= 0 && result != WPS_SURVEY_SKIPPED) {
+        *out = table.entries[idx];
+    }
+
+    // Grow ahead of need: at three quarters full the grower doubles the table while beacons still fit
+    if (table.count >= table.capacity - table.capacity / 4 && table.capacity < max_entries && !grow_requested &&
+        grower_task != NULL) {
+        grow_requested = true;
+        xTaskNotifyGive(grower_task);
+    }
+
+    table_unlock();
+    return result;
+}
+
+size_t wps_survey_count(void) {
+    return table.count;
+}
+
+void wps_survey_get_stats(wps_survey_stats_t *out) {
+    memset(out, 0, sizeof(*out));
+    if (!table_lock(portMAX_DELAY)) {
+        return;
+    }
+    out->count = table.count;
+    out->capacity = table.capacity;
+    out->max_entries = max_entries;
+    out->dropped_new = dropped_new;
+    table_unlock();
+}
+
+bool wps_survey_get(size_t index, wps_survey_entry_t *out) {
+    bool ok = false;
+    if (!table_lock(portMAX_DELAY)) {
+        return false;
+    }
+    if (index < table.count) {
+        *out = table.entries[index];
+        ok = true;
+    }
+    table_unlock();
+    return ok;
+}
+
+const char *wps_survey_mode_str(wps_modes_t mode) {
+    switch (mode) {
+        case WPS_MODE_PIN: return "PIN";
+        case WPS_MODE_PBC: return "PBC";
+        default: return "None";
+    }
+}
+
+static size_t csv_field(char *out, size_t size, const char *value) {
+    size_t pos = 0;
+    if (pos + 1 < size) out[pos++] = '"';
+    for (const char *p = value; *p && pos + 3 < size; p++) {
+        if (*p == '"') {
+            out[pos++] = '"';
+        }
+        out[pos++] = *p;
+    }
+    if (pos + 1 < size) out[pos++] = '"';
+    out[pos] = '\0';
+    return pos;
+}
+
+static size_t json_string(char *out, size_t size, const char *value) {
+    size_t pos = 0;
+    if (pos + 1 < size) out[pos++] = '"';
+    for (const char *p = value; *p && pos + 3 < size; p++) {
+        if (*p == '"' || *p == '\\') {
+            out[pos++] = '\\';
+        }
+        out[pos++] = *p;
+    }
+    if (pos + 1 < size) out[pos++] = '"';
+    out[pos] = '\0';
+    return pos;
+}
+
+static int format_entry(wps_survey_format_t format, const wps_survey_entry_t *e, bool first, char *buf,
+                        size_t size) {
+    char bssid[18];
+    snprintf(bssid, sizeof(bssid), "%02X:%02X:%02X:%02X:%02X:%02X",
+             e->bssid[0], e->bssid[1], e->bssid[2], e->bssid[3], e->bssid[4], e->bssid[5]);
+
+    // Strings are escaped into fixed scratch space sized for the worst case of each field
+    char ssid[70], device[70], manufacturer[134], model[70], number[70];
+    size_t (*quote)(char *, size_t, const char *) = format == WPS_SURVEY_FORMAT_CSV ? csv_field : json_string;
+    quote(ssid, sizeof(ssid), e->ssid);
+    quote(device, sizeof(device), e->device_name);
+    quote(manufacturer, sizeof(manufacturer), e->manufacturer);
+    quote(model, sizeof(model), e->model_name);
+    quote(number, sizeof(number), e->model_number);
+
+    if (format == WPS_SURVEY_FORMAT_CSV) {
+        return snprintf(buf, size, "%s,%s,%u.%u,%u,0x%04x,%s,%d,%d,%s,%s,%s,%s,%d,%u,%lu,%lu,%lu\n",
+                        bssid, ssid, e->version >> 4, e->version & 0x0F, e->state, e->config_methods,
+                        wps_survey_mode_str(e->mode), e->ap_setup_locked, e->selected_registrar, device,
+                        manufacturer, model, number, e->rssi, e->channel, (unsigned long)e->first_seen_s,
+                        (unsigned long)e->last_seen_s, (unsigned long)e->seen_count);
+    }
+
+    return snprintf(buf, size,
+                    "%s{\"bssid\":\"%s\",\"ssid\":%s,\"version\":\"%u.%u\",\"state\":%u,\"config_methods\":%u,"
+                    "\"mode\":\"%s\",\"ap_setup_locked\":%s,\"selected_registrar\":%s,\"device_name\":%s,"
+                    "\"manufacturer\":%s,\"model_name\":%s,\"model_number\":%s,\"rssi\":%d,\"channel\":%u,"
+                    "\"first_seen\":%lu,\"last_seen\":%lu,\"seen\":%lu}",
+                    first ? "" : ",", bssid, ssid, e->version >> 4, e->version & 0x0F, e->state,
+                    e->config_methods, wps_survey_mode_str(e->mode), e->ap_setup_locked ? "true" : "false",
+                    e->selected_registrar ? "true" : "false", device, manufacturer, model, number, e->rssi,
+                    e->channel, (unsigned long)e->first_seen_s, (unsigned long)e->last_seen_s,
+                    (unsigned long)e->seen_count);
+}
+
+esp_err_t wps_survey_export(wps_survey_format_t format, wps_survey_write_fn write_fn, void *ctx) {
+    static const char *csv_header = "BSSID,SSID,Version,State,ConfigMethods,Mode,Locked,SelectedRegistrar,"
+                                    "DeviceName,Manufacturer,ModelName,ModelNumber,RSSI,Channel,FirstSeen,"
+                                    "LastSeen,Seen\n";
+    const size_t buf_size = 768;
+    char *buf = malloc(buf_size);
+    if (buf == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    esp_err_t ret = format == WPS_SURVEY_FORMAT_CSV ? write_fn(ctx, csv_header, strlen(csv_header))
+                                                    : write_fn(ctx, "{\"networks\":[", 13);
+
+    // Copy one entry at a time so a slow sink never holds the table lock against the RX path
+    wps_survey_entry_t entry;
+    for (size_t i = 0; ret == ESP_OK && wps_survey_get(i, &entry); i++) {
+        int n = format_entry(format, &entry, i == 0, buf, buf_size);
+        if (n > 0) {
+            ret = write_fn(ctx, buf, (size_t)n < buf_size ? (size_t)n : buf_size - 1);
+        }
+    }
+
+    // Networks the table had no room for are not in the rows; say how many there were
+    wps_survey_stats_t stats;
+    wps_survey_get_stats(&stats);
+    if (ret == ESP_OK) {
+        int n = format == WPS_SURVEY_FORMAT_CSV
+                    ? snprintf(buf, buf_size, "# %lu networks, limit %lu, %lu not stored\n",
+                               (unsigned long)stats.count, (unsigned long)stats.max_entries,
+                               (unsigned long)stats.dropped_new)
+                    : snprintf(buf, buf_size, "],\"count\":%lu,\"max_entries\":%lu,\"dropped_new\":%lu}",
+                               (unsigned long)stats.count, (unsigned long)stats.max_entries,
+                               (unsigned long)stats.dropped_new);
+        ret = write_fn(ctx, buf, (size_t)n);
+    }
+
+    free(buf);
+    return ret;
+}
+
+static esp_err_t file_write(void *ctx, const char *data, size_t len) {
+    return fwrite(data, 1, len, (FILE *)ctx) == len ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t wps_survey_export_file(wps_survey_format_t format, char *path_out, size_t path_out_len) {
+    const char *ext = format == WPS_SURVEY_FORMAT_CSV ? "csv" : "json";
+
+    if (!sd_card_exists(WPS_SURVEY_EXPORT_DIR)) {
+        printf("No SD card directory %s for the WPS export\n", WPS_SURVEY_EXPORT_DIR);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    int max_index = -1;
+    DIR *dir = opendir(WPS_SURVEY_EXPORT_DIR);
+    if (dir) {
+        struct dirent *entry;
+        while ((entry = readdir(dir)) != NULL) {
+            int index;
+            char entry_ext[8];
+            if (sscanf(entry->d_name, "wps_%d.%7s", &index, entry_ext) == 2 && strcmp(entry_ext, ext) == 0 &&
+                index > max_index) {
+                max_index = index;
+            }
+        }
+        closedir(dir);
+    }
+
+    char path[64];
+    snprintf(path, sizeof(path), WPS_SURVEY_EXPORT_DIR "/wps_%d.%s", max_index + 1, ext);
+    FILE *f = fopen(path, "w");
+    if (f == NULL) {
+        ESP_LOGE(TAG, "Failed to open %s", path);
+        return ESP_FAIL;
+    }
+
+    esp_err_t ret = wps_survey_export(format, file_write, f);
+    fclose(f);
+
+    if (ret == ESP_OK && path_out != NULL) {
+        strncpy(path_out, path, path_out_len - 1);
+        path_out[path_out_len - 1] = '\0';
+    }
+    if (dropped_new > 0) {
+        ESP_LOGW(TAG, "WPS frames of %lu networks were not stored: the table reached its limit of %lu",
+                 (unsigned long)dropped_new, (unsigned long)max_entries);
+    }
+    return ret;
+}
@@ -5,8 +5,10 @@
 #include "managers/settings_manager.h"
 #include "managers/wifi_manager.h"
 #include "managers/ap_manager.h"
+#include "managers/ota_manager.h"
 #include "managers/sd_card_manager.h"
 #include "managers/display_manager.h"
+#include "core/watchlist.h"
 #ifndef CONFIG_IDF_TARGET_ESP32S2
 #include "managers/ble_manager.h"
 #endif
@@ -47,10 +49,14 @@ void app_main(void) {
 
   settings_init(&G_Settings);
 
-  ap_manager_init();
+  esp_err_t web_err = ap_manager_init();
 
   esp_err_t err = sd_card_init();
 
+  if (err == ESP_OK && sd_card_exists(WATCHLIST_DEFAULT_PATH)) {
+    watchlist_load(WATCHLIST_DEFAULT_PATH);
+  }
+
 #ifdef CONFIG_WITH_SCREEN
 
 #ifdef CONFIG_USE_JOYSTICK
@@ -90,5 +96,8 @@ void app_main(void) {
   }
 #endif
 
+  // Confirms an image that was just installed over the web, or rolls back to the previous one
+  ota_manager_boot_check(web_err == ESP_OK);
+
   printf("Ghost ESP Ready ;)\n");
 }
\ No newline at end of file
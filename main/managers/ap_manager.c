@@ -3,10 +3,13 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <stdarg.h>
 #include <esp_wifi.h>
 #include <esp_event.h>
 #include <esp_log.h>
+#include <esp_timer.h>
 #include "managers/ghost_esp_site.h"
+#include "miniz.h"
 #include <esp_http_server.h>
 #include <esp_netif.h>
 #include <nvs_flash.h>
@@ -18,14 +21,30 @@
 #include <sys/stat.h>
 #include <ctype.h>
 #include <errno.h>
+#include "core/probe_census.h"
+#include "core/watchlist.h"
+#include "core/wps_survey.h"
+#include "managers/capture_index.h"
+#include "managers/sd_listing.h"
+#include "managers/file_download.h"
+#include "managers/sd_upload.h"
+#include "managers/sd_bench.h"
+#include "managers/pcap_sidecar.h"
+#include "managers/console_stream.h"
+#include "core/command_jobs.h"
+#include "core/json_writer.h"
+#include "core/live_state.h"
+#include "managers/ota_manager.h"
+#include "managers/http_dispatch.h"
+#include "core/http_metrics.h"
+#include "managers/display_mirror.h"
+#include <esp_ota_ops.h>
+#include <esp_system.h>
 
-#define MAX_LOG_BUFFER_SIZE 4096 // Adjust as needed
 #define MAX_FILE_SIZE (5 * 1024 * 1024) // 5 MB
-#define BUFFER_SIZE (1024) // 1 KB buffer size for reading chunks
+#define BUFFER_SIZE (4096) // Receive size for uploads
 #define MIN_(a,b) ((a) < (b) ? (a) : (b))
-static char log_buffer[MAX_LOG_BUFFER_SIZE];
-static size_t log_buffer_index = 0;
-
+#define MAX_PATH_LENGTH 512
 static const char* TAG = "AP_MANAGER";
 static httpd_handle_t server = NULL;
 static esp_netif_t* netif = NULL;
@@ -37,213 +56,316 @@ static esp_err_t api_logs_handler(httpd_req_t* req);
 static esp_err_t api_clear_logs_handler(httpd_req_t* req);
 static esp_err_t api_settings_handler(httpd_req_t* req);
 static esp_err_t api_command_handler(httpd_req_t *req);
+static esp_err_t api_command_get_handler(httpd_req_t* req);
 static esp_err_t api_settings_get_handler(httpd_req_t* req);
+static esp_err_t api_census_handler(httpd_req_t* req);
+static esp_err_t api_watchlist_handler(httpd_req_t* req);
+static esp_err_t api_wps_handler(httpd_req_t* req);
+static esp_err_t api_sdbench_get_handler(httpd_req_t* req);
+static esp_err_t api_sdbench_start_handler(httpd_req_t* req);
+static esp_err_t api_sdwriter_handler(httpd_req_t* req);
+static esp_err_t api_console_handler(httpd_req_t* req);
+static esp_err_t api_console_stats_handler(httpd_req_t* req);
+static esp_err_t api_state_handler(httpd_req_t* req);
+static esp_err_t api_ota_get_handler(httpd_req_t* req);
+static esp_err_t api_ota_upload_handler(httpd_req_t* req);
+static esp_err_t api_metrics_handler(httpd_req_t* req);
 
 static void event_handler(void* arg, esp_event_base_t event_base,
                           int32_t event_id, void* event_data);
 
 
 
-static esp_err_t scan_directory(const char *base_path, cJSON *json_array) {
-    DIR *dir = opendir(base_path);
-    if (!dir) {
-        ESP_LOGE(TAG, "Failed to open directory: %s", base_path);
-        return ESP_FAIL;
+// Trim trailing slashes and accept only paths inside /mnt
+static bool sd_path_is_valid(char *path) {
+    size_t path_len = strlen(path);
+    while (path_len > 1 && path[path_len - 1] == '/') {
+        path[--path_len] = '\0';
     }
+    return strncmp(path, "/mnt", 4) == 0 && (path[4] == '\0' || path[4] == '/') && strstr(path, "..") == NULL;
+}
 
-    struct dirent *entry;
-    while ((entry = readdir(dir)) != NULL) {
-        // Dynamically allocate memory for full_path
-        size_t full_path_len = strlen(base_path) + strlen(entry->d_name) + 2; // +2 for '/' and '\0'
-        char *full_path = malloc(full_path_len);
-        if (!full_path) {
-            ESP_LOGE(TAG, "Failed to allocate memory for full path.");
-            closedir(dir);
-            return ESP_ERR_NO_MEM;
-        }
-
-        snprintf(full_path, full_path_len, "%s/%s", base_path, entry->d_name);
-
-        struct stat entry_stat;
-        if (stat(full_path, &entry_stat) != 0) {
-            ESP_LOGE(TAG, "Failed to stat file: %s", full_path);
-            free(full_path);
-            continue;
-        }
-
-        if (S_ISDIR(entry_stat.st_mode)) {
-            // Add folder
-            cJSON *folder = cJSON_CreateObject();
-            cJSON_AddStringToObject(folder, "name", entry->d_name);
-            cJSON_AddStringToObject(folder, "type", "folder");
+#define JSON_CHUNK_SIZE 512
 
-            // Recursively scan children
-            cJSON *children = cJSON_CreateArray();
-            if (scan_directory(full_path, children) == ESP_OK) {
-                cJSON_AddItemToObject(folder, "children", children);
-            } else {
-                cJSON_Delete(children);
-            }
+static esp_err_t resp_chunk_sink(void *ctx, const char *data, size_t len) {
+    return httpd_resp_send_chunk((httpd_req_t *)ctx, data, len);
+}
 
-            cJSON_AddItemToArray(json_array, folder);
-        } else if (S_ISREG(entry_stat.st_mode)) {
-            // Add file
-            cJSON *file = cJSON_CreateObject();
-            cJSON_AddStringToObject(file, "name", entry->d_name);
-            cJSON_AddStringToObject(file, "type", "file");
-            cJSON_AddStringToObject(file, "path", full_path);
-            cJSON_AddItemToArray(json_array, file);
-        }
+// JSON responses are written straight into a stack buffer that goes out as a chunk whenever it fills
+static void json_resp_begin(httpd_req_t *req, json_writer_t *w, char *buf, size_t len) {
+    httpd_resp_set_type(req, "application/json");
+    json_writer_init(w, buf, len, resp_chunk_sink, req);
+}
 
-        // Free dynamically allocated memory
-        free(full_path);
+static esp_err_t json_resp_finish(httpd_req_t *req, json_writer_t *w) {
+    esp_err_t ret = json_writer_finish(w);
+    if (ret != ESP_OK) {
+        return ret;
     }
-
-    closedir(dir);
-    return ESP_OK;
+    return httpd_resp_send_chunk(req, NULL, 0);
 }
 
-
+// GET /api/sdcard?path=&offset=&limit=&sort=name|size|time&order=asc|desc&after=<cursor>
+// Lists one directory level and streams it; the browser fetches folders as they are opened.
 static esp_err_t api_sd_card_get_handler(httpd_req_t *req) {
-    ESP_LOGI(TAG, "Received request for SD card structure.");
-
+    char query[320] = {0};
+    char path[MAX_PATH_LENGTH] = "/mnt";
+    char value[SD_LISTING_CURSOR_LEN + 32];
+    char decoded[SD_LISTING_CURSOR_LEN + 32];
+    char after[SD_LISTING_CURSOR_LEN + 32] = {0};
+    sd_listing_query_t listing = {
+        .path = path,
+        .limit = SD_LISTING_DEFAULT_LIMIT,
+        .sort = SD_LISTING_SORT_NAME,
+        .after = after,
+    };
 
-    const char *base_path = "/mnt";
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
+        if (httpd_query_key_value(query, "path", value, sizeof(value)) == ESP_OK) {
+            url_decode(path, value);
+        }
+        if (httpd_query_key_value(query, "offset", value, sizeof(value)) == ESP_OK) {
+            listing.offset = strtoul(value, NULL, 10);
+        }
+        if (httpd_query_key_value(query, "limit", value, sizeof(value)) == ESP_OK) {
+            listing.limit = strtoul(value, NULL, 10);
+        }
+        if (httpd_query_key_value(query, "sort", value, sizeof(value)) == ESP_OK) {
+            listing.sort = sd_listing_parse_sort(value);
+        }
+        if (httpd_query_key_value(query, "order", value, sizeof(value)) == ESP_OK) {
+            listing.descending = strcmp(value, "desc") == 0;
+        }
+        if (httpd_query_key_value(query, "after", value, sizeof(value)) == ESP_OK) {
+            url_decode(decoded, value);
+            strlcpy(after, decoded, sizeof(after));
+        }
+        // refresh=1 picks up files copied onto the card from a computer
+        if (httpd_query_key_value(query, "refresh", value, sizeof(value)) == ESP_OK && value[0] == '1' &&
+            capture_index_is_indexed(path)) {
+            capture_index_rebuild(path);
+        }
+    }
 
+    if (!sd_path_is_valid(path)) {
+        httpd_resp_set_status(req, "400 Bad Request");
+        httpd_resp_set_type(req, "application/json");
+        httpd_resp_sendstr(req, "{\"error\": \"Path must be inside /mnt.\"}");
+        return ESP_FAIL;
+    }
 
     struct stat st;
-    if (stat(base_path, &st) != 0) {
+    if (stat("/mnt", &st) != 0) {
         ESP_LOGE(TAG, "SD card not mounted or inaccessible.");
         httpd_resp_set_status(req, "500 Internal Server Error");
         httpd_resp_sendstr(req, "{\"error\": \"SD card not supported or not mounted.\"}");
         return ESP_FAIL;
     }
-
-    
-    cJSON *response_json = cJSON_CreateArray();
-    if (scan_directory(base_path, response_json) != ESP_OK) {
-        cJSON_Delete(response_json);
-        httpd_resp_set_status(req, "500 Internal Server Error");
-        httpd_resp_sendstr(req, "{\"error\": \"Failed to scan SD card.\"}");
+    if (stat(path, &st) != 0 || !S_ISDIR(st.st_mode)) {
+        httpd_resp_set_status(req, "404 Not Found");
+        httpd_resp_set_type(req, "application/json");
+        httpd_resp_sendstr(req, "{\"error\": \"Folder not found.\"}");
         return ESP_FAIL;
     }
-
-    
-    char *response_string = cJSON_Print(response_json);
-    if (!response_string) {
-        ESP_LOGE(TAG, "Failed to serialize JSON.");
-        cJSON_Delete(response_json);
-        httpd_resp_set_status(req, "500 Internal Server Error");
-        httpd_resp_sendstr(req, "{\"error\": \"Failed to serialize SD card data.\"}");
+    if (listing.sort != SD_LISTING_SORT_NONE && listing.offset + MIN_(listing.limit, SD_LISTING_MAX_LIMIT) > SD_LISTING_MAX_WINDOW) {
+        httpd_resp_set_status(req, "400 Bad Request");
+        httpd_resp_set_type(req, "application/json");
+        httpd_resp_sendstr(req, "{\"error\": \"Offset too deep for a sorted listing, page with the 'next' cursor.\"}");
         return ESP_FAIL;
     }
 
-    
     httpd_resp_set_type(req, "application/json");
-    httpd_resp_sendstr(req, response_string);
-
-    
-    cJSON_Delete(response_json);
-    free(response_string);
+    esp_err_t ret = sd_listing_stream(&listing, resp_chunk_sink, req);
+    if (ret != ESP_OK) {
+        // Headers are already out; a truncated body is all the client can get
+        ESP_LOGE(TAG, "Listing %s failed: %s", path, esp_err_to_name(ret));
+    }
+    httpd_resp_send_chunk(req, NULL, 0);
+    return ret;
+}
 
+// Raw writes: file_download builds the status line and headers itself so the body keeps a Content-Length
+static esp_err_t download_send(void *ctx, const char *data, size_t len) {
+    httpd_req_t *req = (httpd_req_t *)ctx;
+    while (len > 0) {
+        int sent = httpd_send(req, data, len);
+        if (sent <= 0) {
+            return ESP_FAIL;
+        }
+        data += sent;
+        len -= sent;
+    }
     return ESP_OK;
 }
 
-static esp_err_t api_sd_card_post_handler(httpd_req_t *req) {
-    char buf[512];
-    int received = httpd_req_recv(req, buf, sizeof(buf));
-    if (received <= 0) {
-        ESP_LOGE(TAG, "Failed to receive request payload.");
-        httpd_resp_set_status(req, "400 Bad Request");
-        httpd_resp_sendstr(req, "{\"error\": \"Invalid request payload.\"}");
-        return ESP_FAIL;
+static esp_err_t send_sd_file(httpd_req_t *req, const char *file_path) {
+    char range[64] = {0};
+    char if_range[64] = {0};
+    char if_none_match[96] = {0};
+    char if_modified_since[40] = {0};
+    char accept_encoding[96] = {0};
+    file_download_request_t download = {.path = file_path};
+
+    if (httpd_req_get_hdr_value_str(req, "Range", range, sizeof(range)) == ESP_OK) {
+        download.range = range;
+    }
+    if (httpd_req_get_hdr_value_str(req, "If-Range", if_range, sizeof(if_range)) == ESP_OK) {
+        download.if_range = if_range;
+    }
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", if_none_match, sizeof(if_none_match)) == ESP_OK) {
+        download.if_none_match = if_none_match;
+    }
+    if (httpd_req_get_hdr_value_str(req, "If-Modified-Since", if_modified_since, sizeof(if_modified_since)) == ESP_OK) {
+        download.if_modified_since = if_modified_since;
+    }
+    if (httpd_req_get_hdr_value_str(req, "Accept-Encoding", accept_encoding, sizeof(accept_encoding)) == ESP_OK) {
+        download.accept_encoding = accept_encoding;
     }
 
-    // Parse JSON payload
-    buf[received] = '\0';  // Null-terminate the received string
-    cJSON *json = cJSON_Parse(buf);
-    if (!json) {
-        ESP_LOGE(TAG, "Failed to parse JSON payload.");
+    file_download_result_t result;
+    esp_err_t ret = file_download_serve(&download, download_send, req, &result);
+    if (ret == ESP_OK && result.status < 300) {
+        ESP_LOGI(TAG, "Sent %s: %d, %llu bytes%s", file_path, result.status,
+                 (unsigned long long)result.body_bytes, result.gzip ? " gzip" : "");
+    }
+    return ret;
+}
+
+// GET /api/sdcard/download?path=<file>
+// Plain links can be resumed by the browser (Range) and revalidated (ETag / Last-Modified).
+static esp_err_t api_sd_card_download_handler(httpd_req_t *req) {
+    char query[MAX_PATH_LENGTH] = {0};
+    char value[MAX_PATH_LENGTH];
+    char path[MAX_PATH_LENGTH] = {0};
+
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "path", value, sizeof(value)) == ESP_OK) {
+        url_decode(path, value);
+    }
+    if (!sd_path_is_valid(path)) {
         httpd_resp_set_status(req, "400 Bad Request");
-        httpd_resp_sendstr(req, "{\"error\": \"Invalid JSON payload.\"}");
+        httpd_resp_set_type(req, "application/json");
+        httpd_resp_sendstr(req, "{\"error\": \"Path must be inside /mnt.\"}");
         return ESP_FAIL;
     }
+    return send_sd_file(req, path);
+}
 
-    cJSON *path_item = cJSON_GetObjectItem(json, "path");
-    if (!cJSON_IsString(path_item) || !path_item->valuestring) {
-        ESP_LOGE(TAG, "Missing or invalid 'path' in request payload.");
-        cJSON_Delete(json);
+static esp_err_t extract_send_chunk(void *ctx, const uint8_t *data, size_t len) {
+    return httpd_resp_send_chunk((httpd_req_t *)ctx, (const char *)data, len);
+}
+
+// GET /api/sdcard/extract?path=<pcap>&bssid=<mac>&from=<epoch>&to=<epoch>&type=<names>
+// Streams a pcap holding only the matching frames, reading just the blocks the capture's sidecar
+// index says can hold them.
+static esp_err_t api_sd_card_extract_handler(httpd_req_t *req) {
+    char query[MAX_PATH_LENGTH + 160] = {0};
+    char value[MAX_PATH_LENGTH];
+    char path[MAX_PATH_LENGTH] = {0};
+    pcap_filter_t filter = {0};
+    bool valid = true;
+
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
+        if (httpd_query_key_value(query, "path", value, sizeof(value)) == ESP_OK) {
+            url_decode(path, value);
+        }
+        if (httpd_query_key_value(query, "bssid", value, sizeof(value)) == ESP_OK && value[0]) {
+            char mac[32];
+            url_decode(mac, value);
+            filter.has_bssid = true;
+            valid = pcap_filter_parse_bssid(mac, filter.bssid);
+        }
+        if (httpd_query_key_value(query, "from", value, sizeof(value)) == ESP_OK) {
+            filter.from_sec = strtoul(value, NULL, 10);
+        }
+        if (httpd_query_key_value(query, "to", value, sizeof(value)) == ESP_OK) {
+            filter.to_sec = strtoul(value, NULL, 10);
+        }
+        if (httpd_query_key_value(query, "type", value, sizeof(value)) == ESP_OK && value[0]) {
+            char types[96];
+            url_decode(types, value);
+            valid = valid && pcap_filter_parse_types(types, &filter.type_mask);
+        }
+    }
+    if (!sd_path_is_valid(path) || !valid) {
         httpd_resp_set_status(req, "400 Bad Request");
-        httpd_resp_sendstr(req, "{\"error\": \"'path' is required and must be a string.\"}");
+        httpd_resp_set_type(req, "application/json");
+        httpd_resp_sendstr(req, "{\"error\": \"Expected a capture inside /mnt and a valid bssid/type filter.\"}");
         return ESP_FAIL;
     }
 
-    const char *file_path = path_item->valuestring;
-
-    // Open the file
-    FILE *file = fopen(file_path, "rb");
-    if (!file) {
-        ESP_LOGE(TAG, "Failed to open file: %s", file_path);
+    struct stat st;
+    if (stat(path, &st) != 0) {
         httpd_resp_set_status(req, "404 Not Found");
         httpd_resp_sendstr(req, "{\"error\": \"File not found.\"}");
         return ESP_FAIL;
     }
 
-    // Get file size
-    struct stat file_stat;
-    if (stat(file_path, &file_stat) != 0) {
-        ESP_LOGE(TAG, "Failed to get file stats: %s", file_path);
-        fclose(file);
-        httpd_resp_set_status(req, "500 Internal Server Error");
-        httpd_resp_sendstr(req, "{\"error\": \"Failed to get file size.\"}");
+    const char *name = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+    const char *dot = strrchr(name, '.');
+    char disposition[128];
+    snprintf(disposition, sizeof(disposition), "attachment; filename=\"%.*s_filtered.pcap\"",
+             (int)(dot ? dot - name : (int)strlen(name)), name);
+    httpd_resp_set_type(req, "application/vnd.tcpdump.pcap");
+    httpd_resp_set_hdr(req, "Content-Disposition", disposition);
+
+    pcap_extract_stats_t stats;
+    int64_t start = esp_timer_get_time();
+    esp_err_t ret = pcap_sidecar_extract(path, &filter, extract_send_chunk, req, &stats);
+    if (ret == ESP_ERR_INVALID_ARG) {
+        httpd_resp_set_status(req, "415 Unsupported Media Type");
+        httpd_resp_sendstr(req, "Not an uncompressed pcap capture");
         return ESP_FAIL;
     }
-
-    size_t file_size = file_stat.st_size;
-
-    // Allocate memory for the buffer
-    char *file_buf = malloc(file_size);
-    if (!file_buf) {
-        ESP_LOGE(TAG, "Failed to allocate memory for file buffer.");
-        fclose(file);
-        httpd_resp_set_status(req, "500 Internal Server Error");
-        httpd_resp_sendstr(req, "{\"error\": \"Failed to allocate memory for file.\"}");
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Extract from %s aborted: %s", path, esp_err_to_name(ret));
+        httpd_resp_send_chunk(req, NULL, 0);
         return ESP_FAIL;
     }
+    ESP_LOGI(TAG, "Extracted %llu/%llu records from %s in %lld ms (%s, %lu/%lu blocks, %llu bytes read)",
+             (unsigned long long)stats.records_matched, (unsigned long long)stats.records_scanned, path,
+             (long long)((esp_timer_get_time() - start) / 1000), stats.used_index ? "indexed" : "linear",
+             (unsigned long)stats.blocks_read, (unsigned long)stats.blocks_total, (unsigned long long)stats.bytes_read);
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
 
-    // Read the file into the buffer
-    size_t bytes_read = fread(file_buf, 1, file_size, file);
-    fclose(file);
-
-    if (bytes_read != file_size) {
-        ESP_LOGE(TAG, "Failed to read entire file: %s", file_path);
-        free(file_buf);
-        httpd_resp_set_status(req, "500 Internal Server Error");
-        httpd_resp_sendstr(req, "{\"error\": \"Failed to read file.\"}");
+// POST /api/sdcard/download {"path": "<file>"}, kept for older pages
+static esp_err_t api_sd_card_post_handler(httpd_req_t *req) {
+    char buf[512];
+    int received = httpd_req_recv(req, buf, sizeof(buf) - 1);
+    if (received <= 0) {
+        ESP_LOGE(TAG, "Failed to receive request payload.");
+        httpd_resp_set_status(req, "400 Bad Request");
+        httpd_resp_sendstr(req, "{\"error\": \"Invalid request payload.\"}");
         return ESP_FAIL;
     }
 
-    // Set response headers
-    httpd_resp_set_type(req, "application/octet-stream");
-    httpd_resp_set_hdr(req, "Content-Disposition", "attachment");
-
-    // Send the file content
-    if (httpd_resp_send(req, file_buf, file_size) != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to send file.");
-        free(file_buf);
+    // Parse JSON payload
+    buf[received] = '\0';  // Null-terminate the received string
+    cJSON *json = cJSON_Parse(buf);
+    if (!json) {
+        ESP_LOGE(TAG, "Failed to parse JSON payload.");
+        httpd_resp_set_status(req, "400 Bad Request");
+        httpd_resp_sendstr(req, "{\"error\": \"Invalid JSON payload.\"}");
         return ESP_FAIL;
     }
 
-    ESP_LOGI(TAG, "File sent successfully: %s", file_path);
-
-    // Free allocated memory
-    free(file_buf);
+    cJSON *path_item = cJSON_GetObjectItem(json, "path");
+    char path[MAX_PATH_LENGTH] = {0};
+    if (cJSON_IsString(path_item) && path_item->valuestring) {
+        strlcpy(path, path_item->valuestring, sizeof(path));
+    }
     cJSON_Delete(json);
 
-    return ESP_OK;
+    if (!sd_path_is_valid(path)) {
+        ESP_LOGE(TAG, "Missing or invalid 'path' in request payload.");
+        httpd_resp_set_status(req, "400 Bad Request");
+        httpd_resp_sendstr(req, "{\"error\": \"'path' is required and must be inside /mnt.\"}");
+        return ESP_FAIL;
+    }
+    return send_sd_file(req, path);
 }
 
-#define MAX_PATH_LENGTH 512
 
 esp_err_t get_query_param(httpd_req_t *req, const char *key, char *value, size_t max_len) {
     size_t query_len = httpd_req_get_url_query_len(req) + 1;
@@ -297,6 +419,11 @@ esp_err_t api_sd_card_delete_file_handler(httpd_req_t *req) {
             int res = _unlink_r(&r, filepath);
             if (res == 0) {
                 ESP_LOGI(TAG, "File deleted successfully");
+                capture_index_remove(filepath);
+                // Drop the capture's seek index along with it
+                char idx_path[sizeof(filepath) + sizeof(PCAP_SIDECAR_SUFFIX)];
+                snprintf(idx_path, sizeof(idx_path), "%s%s", filepath, PCAP_SIDECAR_SUFFIX);
+                remove(idx_path);
                 httpd_resp_set_status(req, "200 OK");
                 httpd_resp_send(req, "File deleted successfully", HTTPD_RESP_USE_STRLEN);
                 return ESP_OK;
@@ -315,184 +442,88 @@ esp_err_t api_sd_card_delete_file_handler(httpd_req_t *req) {
     return ESP_FAIL;
 }
 
-// Handler for uploading files to SD card
+static esp_err_t send_upload_error(httpd_req_t *req, const char *status, const char *message) {
+    char body[128];
+    snprintf(body, sizeof(body), "{\"error\": \"%s\"}", message);
+    httpd_resp_set_status(req, status);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_sendstr(req, body);
+    return ESP_FAIL;
+}
+
+// Handler for uploading files to SD card. The body is streamed through the multipart parser, so
+// boundaries split across receives are handled and any number of files can be sent in one request.
 static esp_err_t api_sd_card_upload_handler(httpd_req_t *req) {
     ESP_LOGI(TAG, "Received file upload request.");
 
-    // 1. Retrieve 'path' query parameter
     char path_param[MAX_PATH_LENGTH] = {0};
-    if (get_query_param(req, "path", path_param, sizeof(path_param)) != ESP_OK) {
+    if (get_query_param(req, "path", path_param, sizeof(path_param)) != ESP_OK || !sd_path_is_valid(path_param)) {
         ESP_LOGE(TAG, "Failed to get 'path' from query parameters.");
-        httpd_resp_set_status(req, "400 Bad Request");
-        httpd_resp_set_type(req, "application/json");
-        httpd_resp_sendstr(req, "{\"error\": \"Missing or invalid 'path' query parameter.\"}");
-        return ESP_FAIL;
+        return send_upload_error(req, "400 Bad Request", "Missing or invalid 'path' query parameter.");
     }
     ESP_LOGI(TAG, "Upload path: %s", path_param);
 
-    // 2. Retrieve Content-Type header and boundary
-    char content_type[128] = {0};
+    char content_type[160] = {0};
     if (httpd_req_get_hdr_value_str(req, "Content-Type", content_type, sizeof(content_type)) != ESP_OK) {
         ESP_LOGE(TAG, "Failed to get Content-Type header.");
-        httpd_resp_set_status(req, "400 Bad Request");
-        httpd_resp_set_type(req, "application/json");
-        httpd_resp_sendstr(req, "{\"error\": \"Missing Content-Type header.\"}");
-        return ESP_FAIL;
-    }
-
-    const char *boundary_prefix = "boundary=";
-    char *boundary_start = strstr(content_type, boundary_prefix);
-    if (!boundary_start) {
-        ESP_LOGE(TAG, "Failed to parse boundary.");
-        httpd_resp_set_status(req, "400 Bad Request");
-        httpd_resp_set_type(req, "application/json");
-        httpd_resp_sendstr(req, "{\"error\": \"Boundary missing.\"}");
-        return ESP_FAIL;
+        return send_upload_error(req, "400 Bad Request", "Missing Content-Type header.");
     }
-    boundary_start += strlen(boundary_prefix);
 
-    // Allocate memory for the boundary
-    size_t boundary_len = strlen(boundary_start) + 3; // +3 for "--" and null terminator
-    char *boundary = malloc(boundary_len);
-    if (!boundary) {
-        ESP_LOGE(TAG, "Failed to allocate memory for boundary.");
-        httpd_resp_set_status(req, "500 Internal Server Error");
-        httpd_resp_set_type(req, "application/json");
-        httpd_resp_sendstr(req, "{\"error\": \"Memory allocation failed.\"}");
-        return ESP_FAIL;
+    sd_upload_t *upload = NULL;
+    esp_err_t ret = sd_upload_begin(path_param, content_type, &upload);
+    if (ret == ESP_ERR_INVALID_ARG) {
+        return send_upload_error(req, "400 Bad Request", "Expected multipart/form-data with a boundary.");
+    } else if (ret != ESP_OK) {
+        return send_upload_error(req, "500 Internal Server Error", "Memory allocation failed.");
     }
-    snprintf(boundary, boundary_len, "--%s", boundary_start);
-    ESP_LOGD(TAG, "Parsed boundary: %s", boundary);
 
-    // Allocate memory for the buffer
-    char *buf = malloc(BUFFER_SIZE + 1); // +1 for null-terminator
+    char *buf = malloc(BUFFER_SIZE);
     if (!buf) {
-        ESP_LOGE(TAG, "Failed to allocate memory for request buffer.");
-        free(boundary);
-        httpd_resp_set_status(req, "500 Internal Server Error");
-        httpd_resp_set_type(req, "application/json");
-        httpd_resp_sendstr(req, "{\"error\": \"Memory allocation failed.\"}");
-        return ESP_FAIL;
+        sd_upload_abort(upload);
+        return send_upload_error(req, "500 Internal Server Error", "Memory allocation failed.");
     }
 
-    FILE *file = NULL;
-    char *file_path = malloc(MAX_PATH_LENGTH + 128); // Allocate heap memory for file_path
-    if (!file_path) {
-        ESP_LOGE(TAG, "Failed to allocate memory for file path.");
-        free(buf);
-        free(boundary);
-        httpd_resp_set_status(req, "500 Internal Server Error");
-        httpd_resp_set_type(req, "application/json");
-        httpd_resp_sendstr(req, "{\"error\": \"Memory allocation failed.\"}");
-        return ESP_FAIL;
-    }
+    size_t remaining = req->content_len;
+    while (remaining > 0) {
+        int received = httpd_req_recv(req, buf, remaining < BUFFER_SIZE ? remaining : BUFFER_SIZE);
+        if (received == HTTPD_SOCK_ERR_TIMEOUT) {
+            continue;
+        }
+        if (received <= 0) {
+            ESP_LOGE(TAG, "Error receiving file data.");
+            free(buf);
+            sd_upload_abort(upload);
+            return send_upload_error(req, "500 Internal Server Error", "Failed to receive file data.");
+        }
+        remaining -= received;
 
-    size_t total_received = 0;
-    int received;
-
-    // 4. Process the multipart form-data
-    while ((received = httpd_req_recv(req, buf, BUFFER_SIZE)) > 0) {
-        buf[received] = '\0'; // Null-terminate for string operations
-
-        char *boundary_ptr = strstr(buf, boundary);
-        if (boundary_ptr) {
-            char *headers_end = strstr(boundary_ptr, "\r\n\r\n");
-            if (!headers_end) {
-                ESP_LOGE(TAG, "Malformed part headers.");
-                free(buf);
-                free(boundary);
-                free(file_path);
-                if (file) fclose(file);
-                httpd_resp_set_status(req, "400 Bad Request");
-                httpd_resp_set_type(req, "application/json");
-                httpd_resp_sendstr(req, "{\"error\": \"Malformed part headers.\"}");
-                return ESP_FAIL;
-            }
-            headers_end += 4;
-
-            if (strstr(boundary_ptr, "Content-Disposition: form-data; name=\"file\"")) {
-                char *filename_start = strstr(boundary_ptr, "filename=\"");
-                char original_filename[128] = {0};
-                if (filename_start) {
-                    filename_start += strlen("filename=\"");
-                    char *filename_end = strstr(filename_start, "\"");
-                    if (filename_end && (filename_end - filename_start) < sizeof(original_filename)) {
-                        strncpy(original_filename, filename_start, filename_end - filename_start);
-                        original_filename[filename_end - filename_start] = '\0';
-                        ESP_LOGI(TAG, "Original filename: %s", original_filename);
-                    }
-                }
-
-                if (strlen(original_filename) > 0) {
-                    snprintf(file_path, MAX_PATH_LENGTH + 128, "%s/%s", path_param, original_filename);
-                } else {
-                    snprintf(file_path, MAX_PATH_LENGTH + 128, "%s/received_file", path_param);
-                }
-
-                file = fopen(file_path, "wb");
-                if (!file) {
-                    ESP_LOGE(TAG, "Failed to open file for writing: %s", file_path);
-                    free(buf);
-                    free(boundary);
-                    free(file_path);
-                    httpd_resp_set_status(req, "500 Internal Server Error");
-                    httpd_resp_set_type(req, "application/json");
-                    httpd_resp_sendstr(req, "{\"error\": \"Failed to open file.\"}");
-                    return ESP_FAIL;
-                }
-                ESP_LOGI(TAG, "Opened file for writing: %s", file_path);
-
-                size_t data_len = received - (headers_end - buf);
-                if (data_len > 0 && fwrite(headers_end, 1, data_len, file) != data_len) {
-                    ESP_LOGE(TAG, "Failed to write file data.");
-                    fclose(file);
-                    free(buf);
-                    free(boundary);
-                    free(file_path);
-                    httpd_resp_set_status(req, "500 Internal Server Error");
-                    httpd_resp_set_type(req, "application/json");
-                    httpd_resp_sendstr(req, "{\"error\": \"Failed to write file data.\"}");
-                    return ESP_FAIL;
-                }
-                total_received += data_len;
-            }
-        } else if (file) {
-            if (fwrite(buf, 1, received, file) != received) {
-                ESP_LOGE(TAG, "Failed to write file data.");
-                fclose(file);
-                free(buf);
-                free(boundary);
-                free(file_path);
-                httpd_resp_set_status(req, "500 Internal Server Error");
-                httpd_resp_set_type(req, "application/json");
-                httpd_resp_sendstr(req, "{\"error\": \"Failed to write file data.\"}");
-                return ESP_FAIL;
+        ret = sd_upload_feed(upload, buf, received);
+        if (ret != ESP_OK) {
+            free(buf);
+            sd_upload_abort(upload);
+            if (ret == ESP_ERR_INVALID_ARG) {
+                return send_upload_error(req, "400 Bad Request", "Malformed multipart body.");
             }
-            total_received += received;
+            return send_upload_error(req, "500 Internal Server Error", "Failed to write file data.");
         }
     }
+    free(buf);
 
-    if (received < 0) {
-        ESP_LOGE(TAG, "Error receiving file data.");
-        free(buf);
-        free(boundary);
-        free(file_path);
-        if (file) fclose(file);
-        httpd_resp_set_status(req, "500 Internal Server Error");
-        httpd_resp_set_type(req, "application/json");
-        httpd_resp_sendstr(req, "{\"error\": \"Failed to receive file data.\"}");
-        return ESP_FAIL;
+    sd_upload_result_t result = {0};
+    ret = sd_upload_finish(upload, &result);
+    if (ret == ESP_ERR_INVALID_STATE || ret == ESP_ERR_INVALID_ARG) {
+        return send_upload_error(req, "400 Bad Request", "Incomplete multipart body.");
+    } else if (ret != ESP_OK) {
+        return send_upload_error(req, "500 Internal Server Error", "Failed to write file data.");
     }
 
-    free(buf);
-    free(boundary);
-    free(file_path);
-    if (file) fclose(file);
-
+    char response[128];
+    snprintf(response, sizeof(response), "{\"message\": \"File uploaded successfully.\", \"files\": %u, \"bytes\": %llu}",
+             (unsigned)result.files, (unsigned long long)result.bytes);
     httpd_resp_set_status(req, "200 OK");
     httpd_resp_set_type(req, "application/json");
-    httpd_resp_sendstr(req, "{\"message\": \"File uploaded successfully.\"}");
-    ESP_LOGI(TAG, "File uploaded successfully: %zu bytes received.", total_received);
+    httpd_resp_sendstr(req, response);
+    ESP_LOGI(TAG, "Upload complete: %u files, %llu bytes.", (unsigned)result.files, (unsigned long long)result.bytes);
 
     return ESP_OK;
 }
@@ -501,6 +532,7 @@ esp_err_t ap_manager_init(void) {
     esp_err_t ret;
     wifi_mode_t mode;
 
+    console_stream_init();
 
     ret = esp_wifi_get_mode(&mode);
     if (ret == ESP_ERR_WIFI_NOT_INIT) {
@@ -631,6 +663,7 @@ esp_err_t ap_manager_init(void) {
     config.server_port = 80;
     config.ctrl_port = 32768; // Control port (use default)
     config.max_uri_handlers = 30;
+    http_dispatch_config(&config);
 
 
     ret = httpd_start(&server, &config);
@@ -638,6 +671,9 @@ esp_err_t ap_manager_init(void) {
         printf("Error starting HTTP server!\n");
         return ret;
     }
+    if (http_dispatch_start() != ESP_OK) {
+        printf("HTTP workers not started; downloads and uploads run on the server task\n");
+    }
 
      // Register URI handlers
     httpd_uri_t uri_get = {
@@ -706,71 +742,268 @@ esp_err_t ap_manager_init(void) {
         .user_ctx  = NULL
     };
 
-    ret = httpd_register_uri_handler(server, &uri_delete_command);
+    httpd_uri_t uri_get_census = {
+        .uri       = "/api/census",
+        .method    = HTTP_GET,
+        .handler   = api_census_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_get_watchlist = {
+        .uri       = "/api/watchlist",
+        .method    = HTTP_GET,
+        .handler   = api_watchlist_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_get_wps = {
+        .uri       = "/api/wps",
+        .method    = HTTP_GET,
+        .handler   = api_wps_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_sd_card_download = {
+        .uri       = "/api/sdcard/download",
+        .method    = HTTP_GET,
+        .handler   = api_sd_card_download_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_get_sdbench = {
+        .uri       = "/api/sdbench",
+        .method    = HTTP_GET,
+        .handler   = api_sdbench_get_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_post_sdbench = {
+        .uri       = "/api/sdbench",
+        .method    = HTTP_POST,
+        .handler   = api_sdbench_start_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_get_sdwriter = {
+        .uri       = "/api/sdwriter",
+        .method    = HTTP_GET,
+        .handler   = api_sdwriter_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_sd_extract = {
+        .uri       = "/api/sdcard/extract",
+        .method    = HTTP_GET,
+        .handler   = api_sd_card_extract_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_console = {
+        .uri       = "/api/console",
+        .method    = HTTP_GET,
+        .handler   = api_console_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_console_stats = {
+        .uri       = "/api/console/stats",
+        .method    = HTTP_GET,
+        .handler   = api_console_stats_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_get_command = {
+        .uri       = "/api/command",
+        .method    = HTTP_GET,
+        .handler   = api_command_get_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_api_state = {
+        .uri       = "/api/state",
+        .method    = HTTP_GET,
+        .handler   = api_state_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_api_ota_get = {
+        .uri       = "/api/ota",
+        .method    = HTTP_GET,
+        .handler   = api_ota_get_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_api_ota_post = {
+        .uri       = "/api/ota",
+        .method    = HTTP_POST,
+        .handler   = api_ota_upload_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_api_metrics = {
+        .uri       = "/api/metrics",
+        .method    = HTTP_GET,
+        .handler   = api_metrics_handler,
+        .user_ctx  = NULL
+    };
+
+#ifdef CONFIG_DISPLAY_MIRROR
+    httpd_uri_t uri_ws_display = {
+        .uri          = "/ws/display",
+        .method       = HTTP_GET,
+        .handler      = display_mirror_ws_handler,
+        .user_ctx     = NULL,
+        .is_websocket = true
+    };
+#endif
+
+    ret = http_dispatch_register(server, &uri_delete_command, 0);
         if (ret != ESP_OK) {
         printf("Error registering URI\n");
     }
 
-    ret = httpd_register_uri_handler(server, &uri_sd_card_post_upload);
+    ret = http_dispatch_register(server, &uri_sd_card_post_upload, HTTP_DISPATCH_ASYNC);
         if (ret != ESP_OK) {
         printf("Error registering URI\n");
     }
 
-    ret = httpd_register_uri_handler(server, &uri_sd_card_post);
+    ret = http_dispatch_register(server, &uri_sd_card_post, HTTP_DISPATCH_ASYNC);
         if (ret != ESP_OK) {
         printf("Error registering URI\n");
     }
 
-    ret = httpd_register_uri_handler(server, &uri_sd_card_get);
+    ret = http_dispatch_register(server, &uri_sd_card_get, HTTP_DISPATCH_ASYNC);
         if (ret != ESP_OK) {
         printf("Error registering URI\n");
     }
 
-    ret = httpd_register_uri_handler(server, &uri_post_logs);
+    ret = http_dispatch_register(server, &uri_post_logs, 0);
         if (ret != ESP_OK) {
         printf("Error registering URI\n");
     }
 
-    ret = httpd_register_uri_handler(server, &uri_get_settings);
+    ret = http_dispatch_register(server, &uri_get_settings, 0);
     if (ret != ESP_OK) {
         printf("Error registering URI\n");
     }
 
 
-    ret = httpd_register_uri_handler(server, &uri_post_settings);
+    ret = http_dispatch_register(server, &uri_post_settings, 0);
 
         if (ret != ESP_OK) {
         printf("Error registering URI\n");
     }
-    ret = httpd_register_uri_handler(server, &uri_get);
+    ret = http_dispatch_register(server, &uri_get, 0);
 
         if (ret != ESP_OK) {
         printf("Error registering URI\n");
     }
 
-    ret = httpd_register_uri_handler(server, &uri_post_command);
+    ret = http_dispatch_register(server, &uri_post_command, 0);
 
         if (ret != ESP_OK) {
         printf("Error registering URI\n");
     }
 
-    printf("HTTP server started\n");
+    ret = http_dispatch_register(server, &uri_get_census, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
 
-    esp_wifi_set_ps(WIFI_PS_NONE);
+    ret = http_dispatch_register(server, &uri_get_watchlist, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
 
-    esp_netif_ip_info_t ip_info;
-    if (esp_netif_get_ip_info(ap_netif, &ip_info) == ESP_OK) {
-        printf("ESP32 AP IP Address: \n" IPSTR, IP2STR(&ip_info.ip));
-    } else {
-        printf("Failed to get IP address\n");
+    ret = http_dispatch_register(server, &uri_get_wps, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
     }
 
-    return ESP_OK;
-}
+    ret = http_dispatch_register(server, &uri_sd_card_download, HTTP_DISPATCH_ASYNC);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
 
-// Deinitialize and stop the servers
-void ap_manager_deinit(void) {
-    if (server) {
+    ret = http_dispatch_register(server, &uri_get_sdbench, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_post_sdbench, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_get_sdwriter, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_sd_extract, HTTP_DISPATCH_ASYNC);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_console, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_console_stats, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_get_command, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_api_state, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_api_ota_get, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_api_ota_post, HTTP_DISPATCH_ASYNC);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_api_metrics, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+#ifdef CONFIG_DISPLAY_MIRROR
+    ret = http_dispatch_register(server, &uri_ws_display, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+#endif
+
+    printf("HTTP server started\n");
+
+    esp_wifi_set_ps(WIFI_PS_NONE);
+
+    esp_netif_ip_info_t ip_info;
+    if (esp_netif_get_ip_info(ap_netif, &ip_info) == ESP_OK) {
+        printf("ESP32 AP IP Address: \n" IPSTR, IP2STR(&ip_info.ip));
+    } else {
+        printf("Failed to get IP address\n");
+    }
+
+    return ESP_OK;
+}
+
+// Deinitialize and stop the servers
+void ap_manager_deinit(void) {
+    if (server) {
         httpd_stop(server);
         server = NULL;
     }
@@ -786,22 +1019,8 @@ void ap_manager_deinit(void) {
 
 
 void ap_manager_add_log(const char* log_message) {
-    size_t message_length = strlen(log_message);
-    if (log_buffer_index + message_length < MAX_LOG_BUFFER_SIZE) {
-        strcpy(&log_buffer[log_buffer_index], log_message);
-        log_buffer_index += message_length;
-    } else {
-        printf("Log buffer full, clearing buffer and adding new log\n");
-
-        memset(log_buffer, 0, MAX_LOG_BUFFER_SIZE);
-        log_buffer_index = 0;
-
-
-        strcpy(&log_buffer[log_buffer_index], log_message);
-        log_buffer_index += message_length;
-    }
-
-    printf(log_message);
+    // Never blocks; readers that fall more than LOG_RING_SLOTS lines behind are told how many they missed
+    console_stream_log(log_message);
 }
 
 esp_err_t ap_manager_start_services() {
@@ -838,12 +1057,16 @@ esp_err_t ap_manager_start_services() {
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
     config.server_port = 80;
     config.max_uri_handlers = 30;
+    http_dispatch_config(&config);
 
     ret = httpd_start(&server, &config);
     if (ret != ESP_OK) {
         printf("Error starting HTTP server!\n");
         return ret;
     }
+    if (http_dispatch_start() != ESP_OK) {
+        printf("HTTP workers not started; downloads and uploads run on the server task\n");
+    }
 
      httpd_uri_t uri_get = {
         .uri       = "/",
@@ -902,6 +1125,27 @@ esp_err_t ap_manager_start_services() {
         .user_ctx  = NULL
     };
 
+    httpd_uri_t uri_get_census = {
+        .uri       = "/api/census",
+        .method    = HTTP_GET,
+        .handler   = api_census_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_get_watchlist = {
+        .uri       = "/api/watchlist",
+        .method    = HTTP_GET,
+        .handler   = api_watchlist_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_get_wps = {
+        .uri       = "/api/wps",
+        .method    = HTTP_GET,
+        .handler   = api_wps_handler,
+        .user_ctx  = NULL
+    };
+
 
     httpd_uri_t uri_post_command = {
         .uri       = "/api/command",
@@ -910,53 +1154,229 @@ esp_err_t ap_manager_start_services() {
         .user_ctx  = NULL
     };
 
-    ret = httpd_register_uri_handler(server, &uri_delete_command);
+    httpd_uri_t uri_sd_card_download = {
+        .uri       = "/api/sdcard/download",
+        .method    = HTTP_GET,
+        .handler   = api_sd_card_download_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_get_sdbench = {
+        .uri       = "/api/sdbench",
+        .method    = HTTP_GET,
+        .handler   = api_sdbench_get_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_post_sdbench = {
+        .uri       = "/api/sdbench",
+        .method    = HTTP_POST,
+        .handler   = api_sdbench_start_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_get_sdwriter = {
+        .uri       = "/api/sdwriter",
+        .method    = HTTP_GET,
+        .handler   = api_sdwriter_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_sd_extract = {
+        .uri       = "/api/sdcard/extract",
+        .method    = HTTP_GET,
+        .handler   = api_sd_card_extract_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_console = {
+        .uri       = "/api/console",
+        .method    = HTTP_GET,
+        .handler   = api_console_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_console_stats = {
+        .uri       = "/api/console/stats",
+        .method    = HTTP_GET,
+        .handler   = api_console_stats_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_get_command = {
+        .uri       = "/api/command",
+        .method    = HTTP_GET,
+        .handler   = api_command_get_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_api_state = {
+        .uri       = "/api/state",
+        .method    = HTTP_GET,
+        .handler   = api_state_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_api_ota_get = {
+        .uri       = "/api/ota",
+        .method    = HTTP_GET,
+        .handler   = api_ota_get_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_api_ota_post = {
+        .uri       = "/api/ota",
+        .method    = HTTP_POST,
+        .handler   = api_ota_upload_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uri_api_metrics = {
+        .uri       = "/api/metrics",
+        .method    = HTTP_GET,
+        .handler   = api_metrics_handler,
+        .user_ctx  = NULL
+    };
+
+#ifdef CONFIG_DISPLAY_MIRROR
+    httpd_uri_t uri_ws_display = {
+        .uri          = "/ws/display",
+        .method       = HTTP_GET,
+        .handler      = display_mirror_ws_handler,
+        .user_ctx     = NULL,
+        .is_websocket = true
+    };
+#endif
+
+    ret = http_dispatch_register(server, &uri_delete_command, 0);
         if (ret != ESP_OK) {
         printf("Error registering URI\n");
     }
 
-    ret = httpd_register_uri_handler(server, &uri_sd_card_post_upload);
+    ret = http_dispatch_register(server, &uri_sd_card_post_upload, HTTP_DISPATCH_ASYNC);
         if (ret != ESP_OK) {
         printf("Error registering URI\n");
     }
 
-    ret = httpd_register_uri_handler(server, &uri_sd_card_post);
+    ret = http_dispatch_register(server, &uri_sd_card_post, HTTP_DISPATCH_ASYNC);
         if (ret != ESP_OK) {
         printf("Error registering URI\n");
     }
 
-    ret = httpd_register_uri_handler(server, &uri_sd_card_get);
+    ret = http_dispatch_register(server, &uri_sd_card_get, HTTP_DISPATCH_ASYNC);
         if (ret != ESP_OK) {
         printf("Error registering URI\n");
     }
 
-    ret = httpd_register_uri_handler(server, &uri_post_logs);
+    ret = http_dispatch_register(server, &uri_post_logs, 0);
         if (ret != ESP_OK) {
         printf("Error registering URI \n");
     }
 
-    ret = httpd_register_uri_handler(server, &uri_get_settings);
+    ret = http_dispatch_register(server, &uri_get_settings, 0);
         if (ret != ESP_OK) {
         printf("Error registering URI \n");
     }
 
-    ret = httpd_register_uri_handler(server, &uri_post_settings);
+    ret = http_dispatch_register(server, &uri_post_settings, 0);
 
         if (ret != ESP_OK) {
         printf("Error registering URI \n");
     }
-    ret = httpd_register_uri_handler(server, &uri_get);
+    ret = http_dispatch_register(server, &uri_get, 0);
 
         if (ret != ESP_OK) {
         printf("Error registering URI \n");
     }
 
-    ret = httpd_register_uri_handler(server, &uri_post_command);
+    ret = http_dispatch_register(server, &uri_post_command, 0);
 
         if (ret != ESP_OK) {
          printf("Error registering URI \n");
     }
 
+    ret = http_dispatch_register(server, &uri_get_census, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_get_watchlist, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_get_wps, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_sd_card_download, HTTP_DISPATCH_ASYNC);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_get_sdbench, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_post_sdbench, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_get_sdwriter, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_sd_extract, HTTP_DISPATCH_ASYNC);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_console, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_console_stats, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_get_command, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_api_state, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_api_ota_get, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_api_ota_post, HTTP_DISPATCH_ASYNC);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+    ret = http_dispatch_register(server, &uri_api_metrics, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+
+#ifdef CONFIG_DISPLAY_MIRROR
+    ret = http_dispatch_register(server, &uri_ws_display, 0);
+    if (ret != ESP_OK) {
+        printf("Error registering URI\n");
+    }
+#endif
+
     printf("HTTP server started\n");
 
     esp_netif_t* ap_netif = esp_netif_get_handle_from_ifkey("WIFI_AP_DEF");
@@ -1005,30 +1425,191 @@ void ap_manager_stop_services() {
 
 
 // Handler for GET requests (serves the HTML page)
+#define SITE_GZIP_HEADER_LEN 10     // embed_site.py writes no optional gzip fields
+
+// Inflate the embedded page into a TINFL_LZ_DICT_SIZE ring and send it chunk by chunk, for clients
+// without gzip support
+static esp_err_t send_site_inflated(httpd_req_t* req) {
+    tinfl_decompressor* inflator = malloc(sizeof(tinfl_decompressor));
+    uint8_t* dict = malloc(TINFL_LZ_DICT_SIZE);
+    if (!inflator || !dict) {
+        free(inflator);
+        free(dict);
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        return httpd_resp_sendstr(req, "Out of memory; use a browser that accepts gzip");
+    }
+
+    tinfl_init(inflator);
+    const uint8_t* in = ghost_site_html_gz + SITE_GZIP_HEADER_LEN;
+    size_t in_left = ghost_site_html_gz_size - SITE_GZIP_HEADER_LEN;
+    size_t out_pos = 0;
+    esp_err_t ret = ESP_OK;
+    tinfl_status status;
+    do {
+        size_t in_bytes = in_left;
+        size_t out_bytes = TINFL_LZ_DICT_SIZE - out_pos;
+        status = tinfl_decompress(inflator, in, &in_bytes, dict, dict + out_pos, &out_bytes, 0);
+        in += in_bytes;
+        in_left -= in_bytes;
+        if (out_bytes > 0) {
+            ret = httpd_resp_send_chunk(req, (const char*)dict + out_pos, out_bytes);
+        }
+        out_pos = (out_pos + out_bytes) & (TINFL_LZ_DICT_SIZE - 1);
+    } while (ret == ESP_OK && status > TINFL_STATUS_DONE);
+
+    free(inflator);
+    free(dict);
+    if (ret == ESP_OK && status != TINFL_STATUS_DONE) {
+        ESP_LOGE(TAG, "Embedded page failed to inflate (%d)", (int)status);
+        ret = ESP_FAIL;
+    }
+    return ret == ESP_OK ? httpd_resp_send_chunk(req, NULL, 0) : ret;
+}
+
+static bool accepts_gzip(httpd_req_t* req) {
+    // A truncated value is parsed as far as it goes
+    char accept[128];
+    esp_err_t err = httpd_req_get_hdr_value_str(req, "Accept-Encoding", accept, sizeof(accept));
+    if (err != ESP_OK && err != ESP_ERR_HTTPD_RESULT_TRUNC) {
+        return false;
+    }
+    return file_download_accepts_gzip(accept);
+}
+
+// The page is embedded gzipped with content-hash ETags, one per encoding as for SD downloads. The URL
+// isn't versioned, so the page is cached for a day and then revalidated; an unchanged page costs a
+// bodiless 304.
 static esp_err_t http_get_handler(httpd_req_t* req) {
     printf("Received HTTP GET request: %s\n", req->uri);
+    bool gzip = accepts_gzip(req);
+    const char* etag = gzip ? GHOST_SITE_ETAG_GZ : GHOST_SITE_ETAG;
+    httpd_resp_set_hdr(req, "ETag", etag);
+    httpd_resp_set_hdr(req, "Cache-Control", "public, max-age=86400");
+    httpd_resp_set_hdr(req, "Vary", "Accept-Encoding");
+
+    char if_none_match[96];
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", if_none_match, sizeof(if_none_match)) == ESP_OK &&
+        file_download_etag_matches(if_none_match, etag)) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, NULL, 0);
+    }
+
     httpd_resp_set_type(req, "text/html");
-     return httpd_resp_send(req, (const char*)ghost_site_html, ghost_site_html_size);
+    if (!gzip) {
+        return send_site_inflated(req);
+    }
+    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+    return httpd_resp_send(req, (const char*)ghost_site_html_gz, ghost_site_html_gz_size);
 }
 
+// Job state and output from offset on, as JSON. A reply sent while the job finishes passes done and the
+// result, since the job only counts as done once its sink has returned. Nothing is written for an
+// unknown id.
+static esp_err_t command_job_write(json_writer_t* w, uint32_t id, uint32_t offset, bool done, int result) {
+    char* output = malloc(COMMAND_JOB_OUTPUT_MAX);
+    if (output == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    size_t len = 0;
+    command_job_info_t info;
+    esp_err_t ret = command_jobs_read(id, offset, output, COMMAND_JOB_OUTPUT_MAX, &len, &info);
+    if (ret != ESP_OK) {
+        free(output);
+        return ret;
+    }
+    if (done) {
+        info.state = COMMAND_JOB_DONE;
+        info.result = result;
+    }
+
+    json_writer_object(w, NULL);
+    json_writer_uint(w, "id", info.id);
+    json_writer_string(w, "status", command_jobs_state_name(info.state));
+    if (info.state == COMMAND_JOB_DONE) {
+        json_writer_int(w, "result", info.result);
+    }
+    json_writer_string_len(w, "output", output, len);
+    json_writer_uint(w, "skipped", info.skipped);
+    json_writer_uint(w, "next", info.next);
+    json_writer_end(w);
+    free(output);
+    return ESP_OK;
+}
+
+typedef struct {
+    httpd_req_t* req;            // Async copy of the request, completed once the command returns
+    bool stream;
+    bool started;
+    bool sending;
+    esp_err_t err;
+    char id[12];
+} command_reply_t;
+
+// Runs on the serial task while the command runs. Anything httpd logs while sending comes back here as
+// command output, hence the sending guard.
+static void command_reply_sink(void* ctx, uint32_t id, const char* data, size_t len, bool done, int result) {
+    command_reply_t* reply = ctx;
+    if (reply->sending) {
+        return;
+    }
+    reply->sending = true;
+    if (!reply->started) {
+        reply->started = true;
+        snprintf(reply->id, sizeof(reply->id), "%lu", (unsigned long)id);
+        httpd_resp_set_hdr(reply->req, "X-Command-Id", reply->id);
+        httpd_resp_set_type(reply->req, reply->stream ? "text/plain" : "application/json");
+    }
+
+    if (reply->stream && reply->err == ESP_OK && (len > 0 || done)) {
+        reply->err = httpd_resp_send_chunk(reply->req, data, done ? 0 : len);
+    } else if (!reply->stream && done) {
+        char chunk[JSON_CHUNK_SIZE];
+        json_writer_t w;
+        json_writer_init(&w, chunk, sizeof(chunk), resp_chunk_sink, reply->req);
+        if (command_job_write(&w, id, 0, true, result) == ESP_OK) {
+            json_resp_finish(reply->req, &w);
+        } else {
+            httpd_resp_send_500(reply->req);
+        }
+    }
+    reply->sending = false;
+
+    if (done) {
+        httpd_req_async_handler_complete(reply->req);
+        free(reply);
+    }
+}
+
+static esp_err_t send_command_rejected(httpd_req_t* req, esp_err_t err) {
+    httpd_resp_set_type(req, "application/json");
+    if (err == ESP_ERR_INVALID_ARG) {
+        httpd_resp_set_status(req, "400 Bad Request");
+        return httpd_resp_sendstr(req, "{\"status\":\"invalid\",\"error\":\"empty or too long\"}");
+    }
+    httpd_resp_set_status(req, "503 Service Unavailable");
+    httpd_resp_set_hdr(req, "Retry-After", "1");
+    return httpd_resp_sendstr(req, "{\"status\":\"busy\"}");
+}
+
+// POST /api/command {"command": "...", "mode": "queue" | "sync" | "stream"}
+// queue (default) answers 202 with the job id right away; the output can be fetched from
+// GET /api/command?id=. sync answers with the output once the command returns, and stream sends the
+// output as it is printed. Nothing waits for a free slot: a full queue is answered 503 "busy".
 static esp_err_t api_command_handler(httpd_req_t *req)
 {
-    char content[500];
+    char content[COMMAND_JOB_TEXT_MAX + 64];
     int ret, command_len;
 
-    
-    command_len = MIN_(req->content_len, sizeof(content) - 1); 
+    command_len = MIN_(req->content_len, sizeof(content) - 1);
 
-    
     ret = httpd_req_recv(req, content, command_len);
     if (ret <= 0) {
         if (ret == HTTPD_SOCK_ERR_TIMEOUT) {
-            httpd_resp_send_408(req);  
+            httpd_resp_send_408(req);
         }
         return ESP_FAIL;
     }
 
-    
     content[command_len] = '\0';
 
     cJSON *json = cJSON_Parse(content);
@@ -1038,7 +1619,6 @@ static esp_err_t api_command_handler(httpd_req_t *req)
         return ESP_FAIL;
     }
 
-
     cJSON *command_json = cJSON_GetObjectItem(json, "command");
     if (command_json == NULL || !cJSON_IsString(command_json)) {
         httpd_resp_set_status(req, "400 Bad Request");
@@ -1047,53 +1627,204 @@ static esp_err_t api_command_handler(httpd_req_t *req)
         return ESP_FAIL;
     }
 
-    
     const char *command = command_json->valuestring;
+    cJSON *mode_json = cJSON_GetObjectItem(json, "mode");
+    const char *mode = cJSON_IsString(mode_json) ? mode_json->valuestring : "queue";
+    uint32_t id = 0;
 
+    if (strcmp(mode, "sync") != 0 && strcmp(mode, "stream") != 0) {
+        esp_err_t err = command_jobs_submit(command, NULL, NULL, &id);
+        cJSON_Delete(json);
+        if (err != ESP_OK) {
+            return send_command_rejected(req, err);
+        }
+        char body[48];
+        snprintf(body, sizeof(body), "{\"id\":%lu,\"status\":\"queued\"}", (unsigned long)id);
+        httpd_resp_set_status(req, "202 Accepted");
+        httpd_resp_set_type(req, "application/json");
+        return httpd_resp_sendstr(req, body);
+    }
 
-    simulateCommand(command);
-   
-    httpd_resp_send(req, "Command executed", strlen("Command executed"));
-
+    // The reply is sent from the serial task, so the server task is free while the command runs
+    command_reply_t *reply = calloc(1, sizeof(command_reply_t));
+    if (reply == NULL || httpd_req_async_handler_begin(req, &reply->req) != ESP_OK) {
+        free(reply);
+        cJSON_Delete(json);
+        return httpd_resp_send_500(req);
+    }
+    reply->stream = strcmp(mode, "stream") == 0;
+    esp_err_t err = command_jobs_submit(command, command_reply_sink, reply, &id);
     cJSON_Delete(json);
+    if (err != ESP_OK) {
+        send_command_rejected(reply->req, err);
+        httpd_req_async_handler_complete(reply->req);
+        free(reply);
+    }
     return ESP_OK;
 }
 
+// GET /api/command?id=<id>&offset=<bytes>
+// A job's state and output from offset on; "next" is the offset to poll with. Without an id, queue counters.
+static esp_err_t api_command_get_handler(httpd_req_t* req) {
+    char query[64];
+    char value[16];
+    uint32_t id = 0;
+    uint32_t offset = 0;
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
+        if (httpd_query_key_value(query, "id", value, sizeof(value)) == ESP_OK) {
+            id = strtoul(value, NULL, 10);
+        }
+        if (httpd_query_key_value(query, "offset", value, sizeof(value)) == ESP_OK) {
+            offset = strtoul(value, NULL, 10);
+        }
+    }
+    httpd_resp_set_type(req, "application/json");
 
-static esp_err_t api_logs_handler(httpd_req_t* req) {
-    httpd_resp_set_type(req, "text/event-stream");
-    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
-    httpd_resp_set_hdr(req, "Connection", "keep-alive");
+    if (id == 0) {
+        command_jobs_stats_t stats;
+        command_jobs_get_stats(&stats);
+        char body[192];
+        snprintf(body, sizeof(body),
+                 "{\"submitted\":%lu,\"completed\":%lu,\"queued\":%lu,\"rejected_busy\":%lu,"
+                 "\"output_bytes\":%lu,\"output_skipped\":%lu}",
+                 (unsigned long)stats.submitted, (unsigned long)stats.completed, (unsigned long)stats.queued,
+                 (unsigned long)stats.rejected_busy, (unsigned long)stats.output_bytes,
+                 (unsigned long)stats.output_skipped);
+        return httpd_resp_sendstr(req, body);
+    }
+
+    char chunk[JSON_CHUNK_SIZE];
+    json_writer_t w;
+    json_resp_begin(req, &w, chunk, sizeof(chunk));
+    esp_err_t ret = command_job_write(&w, id, offset, false, 0);
+    if (ret == ESP_ERR_NOT_FOUND) {
+        httpd_resp_set_status(req, "404 Not Found");
+        return httpd_resp_sendstr(req, "{\"error\":\"unknown or expired command id\"}");
+    }
+    if (ret != ESP_OK) {
+        return httpd_resp_send_500(req);
+    }
+    return json_resp_finish(req, &w);
+}
 
-    if (log_buffer_index > 0) {
-        char sse_event[2046];
-        size_t log_offset = 0;
 
-        while (log_offset < log_buffer_index) {
-            size_t chunk_size = log_buffer_index - log_offset;
-            if (chunk_size > 2046) {
-                chunk_size = 2046;
-            }
+typedef struct {
+    httpd_req_t* req;
+    char buf[1024];
+    size_t len;
+    esp_err_t err;
+} log_sse_t;
 
-            snprintf(sse_event, sizeof(sse_event), "data: %.*s\n\n", (int)chunk_size, log_buffer + log_offset);
-            httpd_resp_sendstr_chunk(req, sse_event);
+static void log_sse_flush(log_sse_t* sse) {
+    if (sse->len > 0 && sse->err == ESP_OK) {
+        sse->err = httpd_resp_send_chunk(sse->req, sse->buf, sse->len);
+    }
+    sse->len = 0;
+}
 
-            log_offset += chunk_size;
+static void log_sse_printf(log_sse_t* sse, const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+
+static void log_sse_printf(log_sse_t* sse, const char* fmt, ...) {
+    for (int attempt = 0; attempt < 2; attempt++) {
+        va_list args;
+        va_start(args, fmt);
+        int n = vsnprintf(sse->buf + sse->len, sizeof(sse->buf) - sse->len, fmt, args);
+        va_end(args);
+        if (n >= 0 && (size_t)n < sizeof(sse->buf) - sse->len) {
+            sse->len += n;
+            return;
         }
+        log_sse_flush(sse);
+    }
+}
 
-        log_buffer_index = 0;
-    } else {
-        httpd_resp_sendstr_chunk(req, "data: [No new logs]\n\n");
+// One event per line; the id is the cursor to resume from, which EventSource sends back on reconnect
+static bool log_sse_line(void* ctx, uint32_t seq, const char* text, size_t len) {
+    log_sse_printf(ctx, "id: %lu\ndata: %.*s\n\n", (unsigned long)(seq + 1), (int)len, text);
+    return ((log_sse_t*)ctx)->err == ESP_OK;
+}
+
+// Cursor from the Last-Event-ID an EventSource reconnects with, or ?since=; the oldest line held otherwise
+static uint32_t log_cursor_from_request(httpd_req_t* req) {
+    char value[16];
+    char query[48];
+    if (httpd_req_get_hdr_value_str(req, "Last-Event-ID", value, sizeof(value)) == ESP_OK ||
+        (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+         httpd_query_key_value(query, "since", value, sizeof(value)) == ESP_OK)) {
+        return strtoul(value, NULL, 10);
     }
+    return log_ring_oldest(console_stream_ring());
+}
 
-    httpd_resp_sendstr_chunk(req, NULL);
-    return ESP_OK;
+// GET /api/logs?since=<seq>
+// One-shot: sends the lines from since on without consuming them, so any number of tabs can follow the
+// log. Lines the client was too slow for are reported as a "gap" event with the count.
+static esp_err_t api_logs_handler(httpd_req_t* req) {
+    httpd_resp_set_type(req, "text/event-stream");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+
+    log_sse_t* sse = malloc(sizeof(log_sse_t));
+    if (!sse) {
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+    sse->req = req;
+    sse->len = 0;
+    sse->err = ESP_OK;
+
+    uint32_t cursor = log_cursor_from_request(req);
+    uint32_t start = cursor;
+    uint32_t lost = log_ring_read(console_stream_ring(), &cursor, log_sse_line, sse);
+    if (lost > 0) {
+        log_sse_printf(sse, "event: gap\ndata: %lu\n\n", (unsigned long)lost);
+    }
+    if (cursor == start && lost == 0) {
+        log_sse_printf(sse, "id: %lu\ndata: [No new logs]\n\n", (unsigned long)cursor);
+    }
+    log_sse_flush(sse);
+    esp_err_t ret = sse->err;
+    free(sse);
+
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+// GET /api/console?since=<seq>
+// Same events as /api/logs, but the connection stays open and new lines, alerts and capture counters
+// are pushed as they happen
+static esp_err_t api_console_handler(httpd_req_t* req) {
+    esp_err_t ret = console_stream_attach(req, log_cursor_from_request(req));
+    if (ret == ESP_ERR_NO_MEM) {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        httpd_resp_set_hdr(req, "Retry-After", "5");
+        return httpd_resp_sendstr(req, "Too many console clients");
+    }
+    return ret;
+}
+
+// GET /api/console/stats
+static esp_err_t api_console_stats_handler(httpd_req_t* req) {
+    console_stream_stats_t stats;
+    console_stream_get_stats(&stats);
+    char json[384];
+    snprintf(json, sizeof(json),
+             "{\"clients\":%lu,\"clients_dropped\":%lu,\"lines_sent\":%lu,\"lines_lost\":%lu,"
+             "\"chunks_sent\":%lu,\"bytes_sent\":%llu,\"latency_us_last\":%lu,\"latency_us_max\":%lu,"
+             "\"latency_us_avg\":%lu,\"task_us_total\":%llu,\"uptime_us\":%lld}",
+             (unsigned long)stats.clients, (unsigned long)stats.clients_dropped, (unsigned long)stats.lines_sent,
+             (unsigned long)stats.lines_lost, (unsigned long)stats.chunks_sent, (unsigned long long)stats.bytes_sent,
+             (unsigned long)stats.latency_us_last, (unsigned long)stats.latency_us_max,
+             (unsigned long)(stats.latency_samples ? stats.latency_us_total / stats.latency_samples : 0),
+             (unsigned long long)stats.task_us_total, (long long)esp_timer_get_time());
+    httpd_resp_set_type(req, "application/json");
+    return httpd_resp_sendstr(req, json);
 }
 
-// Handler for /api/clear_logs (clears the log buffer)
+// Handler for /api/clear_logs. Hides the current lines from every reader; cursors stay valid.
 static esp_err_t api_clear_logs_handler(httpd_req_t* req) {
-    log_buffer_index = 0;
-    memset(log_buffer, 0, sizeof(log_buffer));
+    log_ring_clear(console_stream_ring());
     httpd_resp_set_type(req, "application/json");
     httpd_resp_sendstr(req, "{\"status\":\"logs_cleared\"}");
     return ESP_OK;
@@ -1237,10 +1968,11 @@ static esp_err_t api_settings_handler(httpd_req_t* req) {
     }
 
     cJSON* gps_rx_pin = cJSON_GetObjectItem(root, "gps_rx_pin");
-    if (rgb_speed) {
+    if (gps_rx_pin) {
         settings_set_gps_rx_pin(settings, gps_rx_pin->valueint);
     }
 
+    // Only schedules the NVS write, so a burst of changes from the page costs one commit
     settings_save(settings);
 
     httpd_resp_set_type(req, "application/json");
@@ -1254,65 +1986,555 @@ static esp_err_t api_settings_handler(httpd_req_t* req) {
 
 static esp_err_t api_settings_get_handler(httpd_req_t* req) {
     FSettings* settings = &G_Settings;
+    char chunk[JSON_CHUNK_SIZE];
+    json_writer_t w;
+    json_resp_begin(req, &w, chunk, sizeof(chunk));
+    json_writer_object(&w, NULL);
+
+    json_writer_int(&w, "broadcast_speed", settings_get_broadcast_speed(settings));
+    json_writer_string(&w, "ap_ssid", settings_get_ap_ssid(settings));
+    json_writer_string(&w, "ap_password", settings_get_ap_password(settings));
+    json_writer_int(&w, "rgb_mode", settings_get_rgb_mode(settings));
+    json_writer_int(&w, "rgb_speed", settings_get_rgb_speed(settings));
+    json_writer_double(&w, "channel_delay", settings_get_channel_delay(settings));
+
+    json_writer_string(&w, "portal_url", settings_get_portal_url(settings));
+    json_writer_string(&w, "portal_ssid", settings_get_portal_ssid(settings));
+    json_writer_string(&w, "portal_password", settings_get_portal_password(settings));
+    json_writer_string(&w, "portal_ap_ssid", settings_get_portal_ap_ssid(settings));
+    json_writer_string(&w, "portal_domain", settings_get_portal_domain(settings));
+    json_writer_bool(&w, "portal_offline_mode", settings_get_portal_offline_mode(settings));
+
+    json_writer_string(&w, "printer_ip", settings_get_printer_ip(settings));
+    json_writer_string(&w, "printer_text", settings_get_printer_text(settings));
+    json_writer_int(&w, "printer_font_size", settings_get_printer_font_size(settings));
+    json_writer_int(&w, "printer_alignment", settings_get_printer_alignment(settings));
+    json_writer_string(&w, "hex_accent_color", settings_get_accent_color_str(settings));
+    json_writer_string(&w, "timezone_str", settings_get_timezone_str(settings));
+    json_writer_int(&w, "gps_rx_pin", settings_get_gps_rx_pin(settings));
 
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        printf("Failed to create JSON object\n");
-        return ESP_FAIL;
-    }
-
-    
-    cJSON_AddNumberToObject(root, "broadcast_speed", settings_get_broadcast_speed(settings));
-    cJSON_AddStringToObject(root, "ap_ssid", settings_get_ap_ssid(settings));
-    cJSON_AddStringToObject(root, "ap_password", settings_get_ap_password(settings));
-    cJSON_AddNumberToObject(root, "rgb_mode", settings_get_rgb_mode(settings));
-    cJSON_AddNumberToObject(root, "rgb_speed", settings_get_rgb_speed(settings));
-    cJSON_AddNumberToObject(root, "channel_delay", settings_get_channel_delay(settings));
-
-    
-    cJSON_AddStringToObject(root, "portal_url", settings_get_portal_url(settings));
-    cJSON_AddStringToObject(root, "portal_ssid", settings_get_portal_ssid(settings));
-    cJSON_AddStringToObject(root, "portal_password", settings_get_portal_password(settings));
-    cJSON_AddStringToObject(root, "portal_ap_ssid", settings_get_portal_ap_ssid(settings));
-    cJSON_AddStringToObject(root, "portal_domain", settings_get_portal_domain(settings));
-    cJSON_AddBoolToObject(root, "portal_offline_mode", settings_get_portal_offline_mode(settings));
-
-    
-    cJSON_AddStringToObject(root, "printer_ip", settings_get_printer_ip(settings));
-    cJSON_AddStringToObject(root, "printer_text", settings_get_printer_text(settings));
-    cJSON_AddNumberToObject(root, "printer_font_size", settings_get_printer_font_size(settings));
-    cJSON_AddNumberToObject(root, "printer_alignment", settings_get_printer_alignment(settings));
-    cJSON_AddStringToObject(root, "hex_accent_color", settings_get_accent_color_str(settings));
-    cJSON_AddStringToObject(root, "timezone_str", settings_get_timezone_str(settings));
-    cJSON_AddNumberToObject(root, "gps_rx_pin", settings_get_gps_rx_pin(settings));
-
-    
     esp_netif_ip_info_t ip_info;
     esp_netif_t* netif = esp_netif_get_handle_from_ifkey("WIFI_STA_DEF");
     if (netif && esp_netif_get_ip_info(netif, &ip_info) == ESP_OK) {
         if (ip_info.ip.addr != 0) {
             char ip_str[16];
             esp_ip4addr_ntoa(&ip_info.ip, ip_str, sizeof(ip_str));
-            cJSON_AddStringToObject(root, "station_ip", ip_str);
+            json_writer_string(&w, "station_ip", ip_str);
         }
     }
 
-    
-    const char* json_response = cJSON_Print(root);
-    if (!json_response) {
-        cJSON_Delete(root);
-        printf("Failed to print JSON object\n");
-        return ESP_FAIL;
+    json_writer_end(&w);
+    return json_resp_finish(req, &w);
+}
+
+static void census_bucket_to_json(json_writer_t* w, const char* key, const probe_census_bucket_t* bucket) {
+    json_writer_object(w, key);
+    json_writer_int(w, "start", (int64_t)bucket->start);
+    json_writer_uint(w, "uptime", bucket->uptime_s);
+    json_writer_uint(w, "devices", bucket->devices);
+    json_writer_uint(w, "probes", bucket->probes);
+    json_writer_uint(w, "randomized", bucket->randomized);
+    json_writer_end(w);
+}
+
+static esp_err_t api_census_handler(httpd_req_t* req) {
+    probe_census_bucket_t current;
+    uint32_t session_devices;
+    probe_census_get_current(&current, &session_devices);
+
+    probe_census_bucket_t* history = malloc(sizeof(probe_census_bucket_t) * PROBE_CENSUS_HISTORY_LEN);
+    if (!history) {
+        httpd_resp_send_500(req);
+        return ESP_ERR_NO_MEM;
+    }
+    size_t count = probe_census_get_history(history, PROBE_CENSUS_HISTORY_LEN);
+
+    char chunk[JSON_CHUNK_SIZE];
+    json_writer_t w;
+    json_resp_begin(req, &w, chunk, sizeof(chunk));
+    json_writer_object(&w, NULL);
+    json_writer_bool(&w, "running", probe_census_is_running());
+    json_writer_uint(&w, "bucket_seconds", PROBE_CENSUS_BUCKET_SECONDS);
+    json_writer_uint(&w, "session_devices", session_devices);
+    census_bucket_to_json(&w, "current", &current);
+
+    json_writer_array(&w, "history");
+    for (size_t i = 0; i < count; i++) {
+        census_bucket_to_json(&w, NULL, &history[i]);
+    }
+    free(history);
+    json_writer_end(&w);
+    json_writer_end(&w);
+    return json_resp_finish(req, &w);
+}
+
+// GET /api/watchlist?since=<seq> returns list stats and any alerts newer than seq
+static esp_err_t api_watchlist_handler(httpd_req_t* req) {
+    char since_str[16];
+    uint32_t since = 0;
+    if (get_query_param(req, "since", since_str, sizeof(since_str)) == ESP_OK) {
+        since = strtoul(since_str, NULL, 10);
+    }
+
+    watchlist_event_t* events = malloc(sizeof(watchlist_event_t) * WATCHLIST_EVENT_HISTORY);
+    if (!events) {
+        httpd_resp_send_500(req);
+        return ESP_ERR_NO_MEM;
+    }
+    size_t count = watchlist_get_events(since, events, WATCHLIST_EVENT_HISTORY);
+
+    watchlist_stats_t stats;
+    watchlist_get_stats(&stats);
+
+    char chunk[JSON_CHUNK_SIZE];
+    json_writer_t w;
+    json_resp_begin(req, &w, chunk, sizeof(chunk));
+    json_writer_object(&w, NULL);
+    json_writer_bool(&w, "loaded", watchlist_is_loaded());
+    json_writer_uint(&w, "macs", stats.macs);
+    json_writer_uint(&w, "ouis", stats.ouis);
+    json_writer_uint(&w, "ssids", stats.ssids);
+    json_writer_uint(&w, "confirmed_hits", stats.confirmed_hits);
+
+    json_writer_array(&w, "events");
+    for (size_t i = 0; i < count; i++) {
+        const watchlist_event_t* ev = &events[i];
+        char mac_str[18];
+        snprintf(mac_str, sizeof(mac_str), "%02X:%02X:%02X:%02X:%02X:%02X",
+                 ev->mac[0], ev->mac[1], ev->mac[2], ev->mac[3], ev->mac[4], ev->mac[5]);
+
+        json_writer_object(&w, NULL);
+        json_writer_uint(&w, "seq", ev->seq);
+        json_writer_uint(&w, "uptime", ev->uptime_s);
+        json_writer_string(&w, "type", ev->type == WATCHLIST_MATCH_MAC ? "mac"
+                                       : (ev->type == WATCHLIST_MATCH_OUI ? "oui" : "ssid"));
+        json_writer_string(&w, "mac", mac_str);
+        if (ev->type == WATCHLIST_MATCH_SSID) {
+            json_writer_string(&w, "ssid", ev->ssid);
+        }
+        json_writer_int(&w, "rssi", ev->rssi);
+        json_writer_uint(&w, "channel", ev->channel);
+        json_writer_end(&w);
+    }
+    free(events);
+    json_writer_end(&w);
+    json_writer_end(&w);
+    return json_resp_finish(req, &w);
+}
+
+// GET /api/state?since=<version>&boot=<id>&tables=aps,stations,capture,gps&format=json|cbor
+// Live AP/station tables, capture counters and GPS fix; with since and boot from the last reply, only what
+// changed after it (see core/live_state.h for how a client applies a reply)
+static esp_err_t api_state_handler(httpd_req_t* req) {
+    char value[48];
+    live_state_query_t q = { .sections = LIVE_STATE_ALL, .format = LIVE_STATE_JSON };
+    if (get_query_param(req, "since", value, sizeof(value)) == ESP_OK) {
+        q.since = strtoul(value, NULL, 10);
+    }
+    if (get_query_param(req, "boot", value, sizeof(value)) == ESP_OK) {
+        q.boot = strtoul(value, NULL, 10);
+    }
+    if (get_query_param(req, "tables", value, sizeof(value)) == ESP_OK) {
+        q.sections = (strstr(value, "aps") ? LIVE_STATE_APS : 0) |
+                     (strstr(value, "stations") ? LIVE_STATE_STATIONS : 0) |
+                     (strstr(value, "capture") ? LIVE_STATE_CAPTURE : 0) |
+                     (strstr(value, "gps") ? LIVE_STATE_GPS : 0);
+    }
+    if (get_query_param(req, "format", value, sizeof(value)) == ESP_OK && strcmp(value, "cbor") == 0) {
+        q.format = LIVE_STATE_CBOR;
     }
 
-    
+    httpd_resp_set_type(req, q.format == LIVE_STATE_CBOR ? "application/cbor" : "application/json");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    esp_err_t ret = live_state_write(&q, resp_chunk_sink, req);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+// Hex query value into out; false unless it is exactly 2 * *len digits, or up to max bytes when *len is 0
+static bool parse_hex(const char* hex, uint8_t* out, size_t* len, size_t max) {
+    size_t digits = strlen(hex);
+    if (digits % 2 != 0 || digits / 2 > max || (*len != 0 && digits / 2 != *len)) {
+        return false;
+    }
+    for (size_t i = 0; i < digits / 2; i++) {
+        char byte[3] = { hex[2 * i], hex[2 * i + 1], '\0' };
+        if (!isxdigit((unsigned char)byte[0]) || !isxdigit((unsigned char)byte[1])) {
+            return false;
+        }
+        out[i] = (uint8_t)strtoul(byte, NULL, 16);
+    }
+    *len = digits / 2;
+    return true;
+}
+
+static const char* ota_state_name(ota_state_t state) {
+    switch (state) {
+    case OTA_STATE_RECEIVING: return "receiving";
+    case OTA_STATE_READY: return "ready";
+    case OTA_STATE_FAILED: return "failed";
+    default: return "idle";
+    }
+}
+
+// GET /api/ota: running image, trial state, rollback and progress of the current or last update
+static esp_err_t api_ota_get_handler(httpd_req_t* req) {
+    ota_status_t st;
+    ota_manager_get_status(&st);
+
+    char sha_hex[2 * OTA_SHA256_LEN + 1] = "";
+    if (st.state == OTA_STATE_READY) {
+        for (int i = 0; i < OTA_SHA256_LEN; i++) {
+            snprintf(sha_hex + 2 * i, 3, "%02x", st.sha256[i]);
+        }
+    }
+
+    char chunk[JSON_CHUNK_SIZE];
+    json_writer_t w;
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    json_resp_begin(req, &w, chunk, sizeof(chunk));
+    json_writer_object(&w, NULL);
+    json_writer_string(&w, "version", st.version);
+    json_writer_string(&w, "partition", st.partition);
+    json_writer_bool(&w, "pending_verify", st.pending_verify);
+    json_writer_string(&w, "rolled_back_version", st.rolled_back_version);
+    json_writer_uint(&w, "slot_size", st.slot_size);
+    json_writer_bool(&w, "signature_required", st.signature_required);
+    json_writer_string(&w, "state", ota_state_name(st.state));
+    json_writer_uint(&w, "received", st.received);
+    json_writer_uint(&w, "total", st.total);
+    json_writer_string(&w, "new_version", st.new_version);
+    json_writer_string(&w, "sha256", sha_hex);
+    json_writer_string(&w, "error", st.error);
+    json_writer_end(&w);
+    return json_resp_finish(req, &w);
+}
+
+// POST /api/ota?sha256=<hex>&sig=<hex DER ECDSA>&reboot=0|1 with the raw application image as the body
+// (build/<project>.bin, not the merged flash image). sha256 is required. The image goes straight into
+// the spare slot; the device restarts into it a second after the reply unless reboot=0.
+static esp_err_t api_ota_upload_handler(httpd_req_t* req) {
+    char value[2 * OTA_MAX_SIGNATURE_LEN + 1];
+    uint8_t sha256[OTA_SHA256_LEN];
+    uint8_t signature[OTA_MAX_SIGNATURE_LEN];
+    size_t sha_len = OTA_SHA256_LEN, sig_len = 0;
+
+    if (get_query_param(req, "sha256", value, sizeof(value)) != ESP_OK) {
+        return send_upload_error(req, "400 Bad Request", "Send the image's SHA-256 as sha256=.");
+    }
+    if (!parse_hex(value, sha256, &sha_len, OTA_SHA256_LEN)) {
+        return send_upload_error(req, "400 Bad Request", "sha256 must be 64 hex digits.");
+    }
+    if (get_query_param(req, "sig", value, sizeof(value)) == ESP_OK &&
+        !parse_hex(value, signature, &sig_len, OTA_MAX_SIGNATURE_LEN)) {
+        return send_upload_error(req, "400 Bad Request", "sig must be the DER signature in hex.");
+    }
+    bool reboot = !(get_query_param(req, "reboot", value, sizeof(value)) == ESP_OK && value[0] == '0');
+    if (req->content_len == 0) {
+        return send_upload_error(req, "400 Bad Request", "Send the image as the request body.");
+    }
+
+    esp_err_t ret = ota_manager_begin(req->content_len, sha256, sig_len ? signature : NULL, sig_len);
+    if (ret == ESP_ERR_INVALID_STATE) {
+        return send_upload_error(req, "409 Conflict", "Another update is in progress.");
+    } else if (ret == ESP_ERR_INVALID_SIZE) {
+        return send_upload_error(req, "413 Payload Too Large", "Image does not fit the update slot.");
+    } else if (ret == ESP_ERR_NOT_SUPPORTED) {
+        return send_upload_error(req, "403 Forbidden", "This firmware only accepts signed images.");
+    } else if (ret == ESP_ERR_NOT_FOUND) {
+        return send_upload_error(req, "501 Not Implemented", "No update slot in this board's partition table; flash it over USB.");
+    } else if (ret != ESP_OK) {
+        return send_upload_error(req, "500 Internal Server Error", "Could not start the update.");
+    }
+
+    char *buf = malloc(BUFFER_SIZE);
+    if (!buf) {
+        ota_manager_abort("out of memory");
+        return send_upload_error(req, "500 Internal Server Error", "Memory allocation failed.");
+    }
+
+    size_t remaining = req->content_len;
+    while (remaining > 0) {
+        int received = httpd_req_recv(req, buf, remaining < BUFFER_SIZE ? remaining : BUFFER_SIZE);
+        if (received == HTTPD_SOCK_ERR_TIMEOUT) {
+            continue;
+        }
+        if (received <= 0) {
+            free(buf);
+            ota_manager_abort("connection lost during upload");
+            return send_upload_error(req, "500 Internal Server Error", "Failed to receive the image.");
+        }
+        remaining -= received;
+
+        ret = ota_manager_write(buf, received);
+        if (ret != ESP_OK) {
+            free(buf);
+            if (ret == ESP_ERR_INVALID_ARG) {
+                return send_upload_error(req, "400 Bad Request", "Not an application image for this device.");
+            }
+            return send_upload_error(req, "500 Internal Server Error", "Failed to write the image to flash.");
+        }
+    }
+    free(buf);
+
+    ret = ota_manager_finish();
+    if (ret == ESP_ERR_INVALID_CRC) {
+        return send_upload_error(req, "400 Bad Request", "SHA-256 of the received image does not match.");
+    } else if (ret == ESP_ERR_NOT_ALLOWED) {
+        return send_upload_error(req, "403 Forbidden", "Signature check failed.");
+    } else if (ret == ESP_ERR_OTA_VALIDATE_FAILED) {
+        return send_upload_error(req, "400 Bad Request", "Image failed validation.");
+    } else if (ret != ESP_OK) {
+        return send_upload_error(req, "500 Internal Server Error", "Could not activate the image.");
+    }
+
+    ota_status_t st;
+    ota_manager_get_status(&st);
+    char sha_hex[2 * OTA_SHA256_LEN + 1];
+    for (int i = 0; i < OTA_SHA256_LEN; i++) {
+        snprintf(sha_hex + 2 * i, 3, "%02x", st.sha256[i]);
+    }
+    char chunk[JSON_CHUNK_SIZE];
+    json_writer_t w;
+    json_resp_begin(req, &w, chunk, sizeof(chunk));
+    json_writer_object(&w, NULL);
+    json_writer_string(&w, "message", "Update stored.");
+    json_writer_string(&w, "version", st.new_version);
+    json_writer_string(&w, "sha256", sha_hex);
+    json_writer_bool(&w, "rebooting", reboot);
+    json_writer_end(&w);
+    ret = json_resp_finish(req, &w);
+
+    if (reboot) {
+        ota_manager_restart_after(1000);
+    }
+    return ret;
+}
+
+// GET /api/wps?format=csv|json streams the WPS survey table without building it in memory
+static esp_err_t api_wps_handler(httpd_req_t* req) {
+    char format_str[8] = {0};
+    get_query_param(req, "format", format_str, sizeof(format_str));
+    wps_survey_format_t format = strcmp(format_str, "csv") == 0 ? WPS_SURVEY_FORMAT_CSV : WPS_SURVEY_FORMAT_JSON;
+
+    httpd_resp_set_type(req, format == WPS_SURVEY_FORMAT_CSV ? "text/csv" : "application/json");
+    esp_err_t ret = wps_survey_export(format, resp_chunk_sink, req);
+    httpd_resp_send_chunk(req, NULL, 0);
+    return ret;
+}
+
+// {"latency_ms": [upper bounds...], "latency_hist": [counts...]}; the last count has no upper bound
+static void add_latency_histogram(json_writer_t* w, const uint32_t* hist) {
+    static const uint32_t bounds[] = SD_WRITER_LATENCY_BOUNDS_MS;
+    json_writer_array(w, "latency_ms");
+    for (size_t i = 0; i < sizeof(bounds) / sizeof(bounds[0]); i++) {
+        json_writer_uint(w, NULL, bounds[i]);
+    }
+    json_writer_end(w);
+    json_writer_array(w, "latency_hist");
+    for (int i = 0; i < SD_WRITER_LATENCY_BUCKETS; i++) {
+        json_writer_uint(w, NULL, hist[i]);
+    }
+    json_writer_end(w);
+}
+
+// GET /api/sdwriter returns the SD writer counters since boot or the last ?reset=1
+static esp_err_t api_sdwriter_handler(httpd_req_t* req) {
+    sd_writer_metrics_t m;
+    sd_writer_get_metrics(&m);
+
+    char reset[4];
+    if (get_query_param(req, "reset", reset, sizeof(reset)) == ESP_OK && reset[0] == '1') {
+        sd_writer_reset_metrics();
+    }
+
+    char chunk[JSON_CHUNK_SIZE];
+    json_writer_t w;
+    json_resp_begin(req, &w, chunk, sizeof(chunk));
+    json_writer_object(&w, NULL);
+    json_writer_uint(&w, "bytes_written", m.bytes_written);
+    json_writer_uint(&w, "bytes_dropped", m.bytes_dropped);
+    json_writer_uint(&w, "writes", m.writes);
+    json_writer_uint(&w, "write_errors", m.write_errors);
+    json_writer_uint(&w, "write_us_avg", m.writes ? m.write_us_total / m.writes : 0);
+    json_writer_uint(&w, "write_us_max", m.write_us_max);
+    json_writer_uint(&w, "fsyncs", m.fsyncs);
+    json_writer_uint(&w, "fsync_us_max", m.fsync_us_max);
+    json_writer_uint(&w, "queue_high_water", m.queue_high_water);
+    json_writer_uint(&w, "backpressure_events", m.backpressure_events);
+    json_writer_uint(&w, "prealloc_extents", m.prealloc_extents);
+    json_writer_uint(&w, "prealloc_us_max", m.prealloc_us_max);
+    json_writer_uint(&w, "codec_bytes_in", m.codec_bytes_in);
+    json_writer_uint(&w, "codec_bytes_out", m.codec_bytes_out);
+    json_writer_uint(&w, "codec_us_total", m.codec_us_total);
+    add_latency_histogram(&w, m.write_latency_hist);
+    json_writer_end(&w);
+    return json_resp_finish(req, &w);
+}
+
+// GET /api/metrics returns per-endpoint handler times since boot or the last ?reset=1. Times run from
+// the request reaching its handler to the response being sent; p50/p99 are estimated from the histogram.
+static esp_err_t api_metrics_handler(httpd_req_t* req) {
+    static const uint32_t bounds[] = HTTP_METRICS_LATENCY_BOUNDS_MS;
+    char reset[4];
+    bool do_reset = get_query_param(req, "reset", reset, sizeof(reset)) == ESP_OK && reset[0] == '1';
+
+    http_dispatch_stats_t dispatch;
+    http_dispatch_get_stats(&dispatch);
+    int fds[CONFIG_LWIP_MAX_SOCKETS];
+    size_t open_sockets = sizeof(fds) / sizeof(fds[0]);
+    if (httpd_get_client_list(server, &open_sockets, fds) != ESP_OK) {
+        open_sockets = 0;
+    }
+
+    char chunk[JSON_CHUNK_SIZE];
+    json_writer_t w;
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    json_resp_begin(req, &w, chunk, sizeof(chunk));
+    json_writer_object(&w, NULL);
+    json_writer_uint(&w, "uptime_ms", (uint64_t)(esp_timer_get_time() / 1000));
+    json_writer_uint(&w, "open_sockets", open_sockets);
+    json_writer_uint(&w, "free_heap", esp_get_free_heap_size());
+    json_writer_uint(&w, "workers", HTTP_DISPATCH_WORKERS);
+    json_writer_uint(&w, "workers_busy", dispatch.workers_busy);
+    json_writer_uint(&w, "dispatched", dispatch.dispatched);
+    json_writer_uint(&w, "ran_inline", dispatch.ran_inline);
+    json_writer_uint(&w, "rejected_busy", dispatch.rejected_busy);
+    json_writer_array(&w, "latency_ms");
+    for (size_t i = 0; i < sizeof(bounds) / sizeof(bounds[0]); i++) {
+        json_writer_uint(&w, NULL, bounds[i]);
+    }
+    json_writer_end(&w);
+
+    json_writer_array(&w, "endpoints");
+    http_metrics_endpoint_t e;
+    for (int i = 0; http_metrics_get(i, &e); i++) {
+        json_writer_object(&w, NULL);
+        json_writer_string(&w, "method", e.method);
+        json_writer_string(&w, "uri", e.uri);
+        json_writer_bool(&w, "async", e.async);
+        json_writer_uint(&w, "requests", e.requests);
+        json_writer_uint(&w, "errors", e.errors);
+        json_writer_uint(&w, "active", e.active);
+        json_writer_uint(&w, "max_active", e.max_active);
+        json_writer_uint(&w, "rejected_busy", e.rejected_busy);
+        json_writer_uint(&w, "us_avg", e.requests ? e.total_us / e.requests : 0);
+        json_writer_uint(&w, "us_max", e.max_us);
+        json_writer_uint(&w, "p50_ms", http_metrics_percentile_ms(&e, 50));
+        json_writer_uint(&w, "p99_ms", http_metrics_percentile_ms(&e, 99));
+        json_writer_uint(&w, "wait_us_avg", e.requests ? e.wait_total_us / e.requests : 0);
+        json_writer_uint(&w, "wait_us_max", e.wait_max_us);
+        json_writer_array(&w, "latency_hist");
+        for (int b = 0; b < HTTP_METRICS_LATENCY_BUCKETS; b++) {
+            json_writer_uint(&w, NULL, e.latency_hist[b]);
+        }
+        json_writer_end(&w);
+        json_writer_end(&w);
+    }
+    json_writer_end(&w);
+    json_writer_end(&w);
+
+    if (do_reset) {
+        http_metrics_reset();
+    }
+    return json_resp_finish(req, &w);
+}
+
+// GET /api/sdbench returns the state of the last benchmark and its results once done
+static esp_err_t api_sdbench_get_handler(httpd_req_t* req) {
+    sd_bench_result_t* r = malloc(sizeof(*r));
+    if (!r) {
+        httpd_resp_send_500(req);
+        return ESP_ERR_NO_MEM;
+    }
+    sd_bench_state_t state = sd_bench_get(r);
+
+    char chunk[JSON_CHUNK_SIZE];
+    json_writer_t w;
+    json_resp_begin(req, &w, chunk, sizeof(chunk));
+    json_writer_object(&w, NULL);
+    json_writer_string(&w, "state", state == SD_BENCH_RUNNING ? "running" : state == SD_BENCH_DONE ? "done"
+                                    : state == SD_BENCH_FAILED ? "failed" : "idle");
+    if (state == SD_BENCH_DONE) {
+        json_writer_array(&w, "sequential");
+        for (size_t i = 0; i < r->seq_count; i++) {
+            json_writer_object(&w, NULL);
+            json_writer_uint(&w, "block", r->seq[i].block_size);
+            json_writer_uint(&w, "write_kbps", r->seq[i].write_kbps);
+            json_writer_uint(&w, "read_kbps", r->seq[i].read_kbps);
+            json_writer_uint(&w, "write_us_max", r->seq[i].write_us_max);
+            json_writer_end(&w);
+        }
+        json_writer_end(&w);
+        json_writer_object(&w, "append_us");
+        json_writer_uint(&w, "p50", r->append_p50_us);
+        json_writer_uint(&w, "p90", r->append_p90_us);
+        json_writer_uint(&w, "p99", r->append_p99_us);
+        json_writer_uint(&w, "max", r->append_max_us);
+        json_writer_end(&w);
+        json_writer_uint(&w, "create_us", r->create_us);
+        json_writer_uint(&w, "readdir_us", r->readdir_us);
+        json_writer_uint(&w, "unlink_us", r->unlink_us);
+        json_writer_array(&w, "capture");
+        for (size_t i = 0; i < r->capture_count; i++) {
+            json_writer_object(&w, NULL);
+            json_writer_uint(&w, "prealloc_bytes", r->capture[i].prealloc_bytes);
+            json_writer_uint(&w, "kbps", r->capture[i].kbps);
+            json_writer_uint(&w, "prealloc_extents", r->capture[i].prealloc_extents);
+            add_latency_histogram(&w, r->capture[i].write_latency_hist);
+            json_writer_end(&w);
+        }
+        json_writer_end(&w);
+        if (r->fs_valid) {
+            json_writer_object(&w, "fs");
+            json_writer_uint(&w, "total_bytes", r->fs.total_bytes);
+            json_writer_uint(&w, "free_bytes", r->fs.free_bytes);
+            json_writer_uint(&w, "cluster_size", r->fs.cluster_size);
+            json_writer_uint(&w, "fat_type", r->fs.fat_type);
+            json_writer_uint(&w, "free_extents", r->fs.free_extents);
+            json_writer_uint(&w, "largest_free_extent", r->fs.largest_free_extent);
+            json_writer_end(&w);
+        }
+        json_writer_uint(&w, "recommended_buffer_size", r->recommended_buffer_size);
+        json_writer_uint(&w, "recommended_buffer_count", r->recommended_buffer_count);
+        json_writer_uint(&w, "duration_ms", r->duration_ms);
+    }
+    free(r);
+    json_writer_end(&w);
+    return json_resp_finish(req, &w);
+}
+
+// POST /api/sdbench?size_kb=<n> starts a benchmark in the background; poll GET for the results
+static esp_err_t api_sdbench_start_handler(httpd_req_t* req) {
+    sd_bench_config_t cfg;
+    sd_bench_default_config(&cfg);
     httpd_resp_set_type(req, "application/json");
-    httpd_resp_sendstr(req, json_response);
 
-    
-    cJSON_Delete(root);
-    free((void*)json_response);
+    char size_str[16];
+    if (get_query_param(req, "size_kb", size_str, sizeof(size_str)) == ESP_OK) {
+        size_t kb = strtoul(size_str, NULL, 10);
+        if (kb == 0 || kb > 256 * 1024) {
+            httpd_resp_set_status(req, "400 Bad Request");
+            httpd_resp_sendstr(req, "{\"error\": \"Invalid size_kb.\"}");
+            return ESP_OK;
+        }
+        cfg.file_bytes = kb * 1024;
+        cfg.capture_bytes = cfg.file_bytes * 2;
+    }
 
+    esp_err_t ret = sd_bench_start(&cfg);
+    if (ret == ESP_ERR_INVALID_STATE) {
+        httpd_resp_set_status(req, "409 Conflict");
+        httpd_resp_sendstr(req, "{\"error\": \"Benchmark already running.\"}");
+    } else if (ret != ESP_OK) {
+        httpd_resp_set_status(req, "500 Internal Server Error");
+        httpd_resp_sendstr(req, "{\"error\": \"Failed to start benchmark.\"}");
+    } else {
+        httpd_resp_set_status(req, "202 Accepted");
+        httpd_resp_sendstr(req, "{\"state\": \"running\"}");
+    }
     return ESP_OK;
 }
 
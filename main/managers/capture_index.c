@@ -0,0 +1,699 @@
+#include "managers/capture_index.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#define INDEX_MAGIC "GIDX"
+#define INDEX_VERSION 1
+#define INDEX_HEADER_LEN 16
+#define INDEX_SLOT_LEN 72
+#define INDEX_READ_SLOTS 16
+
+#define SLOT_USED 0x01
+#define SLOT_OPEN 0x02
+
+// Only a key and flags per slot stay in RAM; names and sizes are read back from the index file
+typedef struct {
+    bool loaded;
+    char dir[64];
+    int fd;                      // The index file, open read/write while loaded
+    uint64_t *keys;              // name_key() of the slot's name, 0 marks a free slot
+    uint8_t *flags;
+    size_t slot_count;
+    size_t capacity;
+    struct {
+        char base[24];
+        char ext[8];
+        uint32_t next;
+    } bases[CAPTURE_INDEX_MAX_BASES];
+    size_t base_count;
+} dir_index_t;
+
+static dir_index_t indexes[CAPTURE_INDEX_MAX_DIRS];
+static pthread_mutex_t index_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// 64 bits stand in for the name: two names of one directory share a key about once in 10^10 for
+// 50k files, so a matching key is taken as the file without reading its slot back
+static uint64_t name_key(const char *name) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    while (*name) {
+        h = (h ^ (uint8_t)*name++) * 0x100000001b3ULL;
+    }
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return h ? h : 1;
+}
+
+static void put_u32(uint8_t *p, uint32_t v) {
+    p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+}
+
+static uint32_t get_u32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void encode_slot(uint8_t *slot, const capture_index_entry_t *e) {
+    memset(slot, 0, INDEX_SLOT_LEN);
+    memcpy(slot, e->name, strnlen(e->name, CAPTURE_INDEX_NAME_LEN - 1));
+    slot[48] = (uint8_t)e->type;
+    slot[49] = SLOT_USED | (e->open ? SLOT_OPEN : 0);
+    put_u32(slot + 52, e->seq);
+    put_u32(slot + 56, e->start_time);
+    put_u32(slot + 60, e->records);
+    put_u32(slot + 64, (uint32_t)e->size);
+    put_u32(slot + 68, (uint32_t)(e->size >> 32));
+}
+
+static bool decode_slot(const uint8_t *slot, capture_index_entry_t *e) {
+    if (!(slot[49] & SLOT_USED)) {
+        return false;
+    }
+    memcpy(e->name, slot, CAPTURE_INDEX_NAME_LEN);
+    e->name[CAPTURE_INDEX_NAME_LEN - 1] = '\0';
+    e->type = (capture_file_type_t)slot[48];
+    e->open = (slot[49] & SLOT_OPEN) != 0;
+    e->seq = get_u32(slot + 52);
+    e->start_time = get_u32(slot + 56);
+    e->records = get_u32(slot + 60);
+    e->size = get_u32(slot + 64) | ((uint64_t)get_u32(slot + 68) << 32);
+    return true;
+}
+
+static bool is_codec_suffix(const char *s) {
+    return strcasecmp(s, "gz") == 0 || strcasecmp(s, "lz4") == 0;
+}
+
+// Length of ext without a compression suffix: "pcap.gz" and "pcap" are both the "pcap" family, so
+// compressed and plain captures share one sequence
+static size_t ext_stem_len(const char *ext) {
+    const char *dot = strrchr(ext, '.');
+    return dot != NULL && is_codec_suffix(dot + 1) ? (size_t)(dot - ext) : strlen(ext);
+}
+
+static bool ext_equal(const char *a, const char *b) {
+    size_t len = ext_stem_len(a);
+    return len == ext_stem_len(b) && strncmp(a, b, len) == 0;
+}
+
+// Extension of a file name, including a compression suffix ("pcap.lz4")
+static const char *name_ext(const char *name) {
+    const char *dot = strrchr(name, '.');
+    if (dot == NULL) {
+        return NULL;
+    }
+    if (is_codec_suffix(dot + 1)) {
+        for (const char *p = dot - 1; p > name; p--) {
+            if (*p == '.') {
+                return p + 1;
+            }
+        }
+    }
+    return dot + 1;
+}
+
+static capture_file_type_t type_from_ext(const char *ext) {
+    if (ext == NULL) {
+        return CAPTURE_FILE_OTHER;
+    }
+    size_t len = ext_stem_len(ext);
+    if (len == 4 && strncasecmp(ext, "pcap", 4) == 0) {
+        return CAPTURE_FILE_PCAP;
+    }
+    if (len == 3 && strncasecmp(ext, "csv", 3) == 0) {
+        return CAPTURE_FILE_CSV;
+    }
+    if ((len == 3 && strncasecmp(ext, "txt", 3) == 0) || (len == 5 && strncasecmp(ext, "22000", 5) == 0) ||
+        (len == 4 && strncasecmp(ext, "json", 4) == 0)) {
+        return CAPTURE_FILE_TEXT;
+    }
+    return CAPTURE_FILE_OTHER;
+}
+
+// Split "<base>_<n>.<ext>"; returns false for names that don't follow the pattern
+static bool parse_name(const char *name, char *base, size_t base_len, uint32_t *seq, const char **ext) {
+    *ext = name_ext(name);
+    const char *dot = *ext ? *ext - 1 : NULL;
+    const char *underscore = strrchr(name, '_');
+    if (dot == NULL || underscore == NULL || underscore > dot || underscore == name) {
+        return false;
+    }
+    if ((size_t)(underscore - name) >= base_len) {
+        return false;
+    }
+    char *end;
+    unsigned long n = strtoul(underscore + 1, &end, 10);
+    if (end != dot || end == underscore + 1) {
+        return false;
+    }
+    memcpy(base, name, underscore - name);
+    base[underscore - name] = '\0';
+    *seq = (uint32_t)n;
+    return true;
+}
+
+static void index_path(const dir_index_t *idx, char *out, size_t out_len) {
+    snprintf(out, out_len, "%s/%s", idx->dir, CAPTURE_INDEX_FILE);
+}
+
+static dir_index_t *find_index_locked(const char *dir) {
+    for (int i = 0; i < CAPTURE_INDEX_MAX_DIRS; i++) {
+        if (indexes[i].loaded && strcmp(indexes[i].dir, dir) == 0) {
+            return &indexes[i];
+        }
+    }
+    return NULL;
+}
+
+static void note_seq_locked(dir_index_t *idx, const char *base, const char *ext, uint32_t seq) {
+    for (size_t i = 0; i < idx->base_count; i++) {
+        if (strcmp(idx->bases[i].base, base) == 0 && ext_equal(idx->bases[i].ext, ext)) {
+            if (seq + 1 > idx->bases[i].next) {
+                idx->bases[i].next = seq + 1;
+            }
+            return;
+        }
+    }
+    size_t ext_len = ext_stem_len(ext);
+    if (idx->base_count < CAPTURE_INDEX_MAX_BASES && strlen(base) < sizeof(idx->bases[0].base) &&
+        ext_len < sizeof(idx->bases[0].ext)) {
+        strcpy(idx->bases[idx->base_count].base, base);
+        memcpy(idx->bases[idx->base_count].ext, ext, ext_len);
+        idx->bases[idx->base_count].ext[ext_len] = '\0';
+        idx->bases[idx->base_count].next = seq + 1;
+        idx->base_count++;
+    }
+}
+
+static bool reserve_slots_locked(dir_index_t *idx, size_t count) {
+    if (count <= idx->capacity) {
+        return true;
+    }
+    size_t cap = idx->capacity ? idx->capacity : 32;
+    while (cap < count) {
+        cap *= 2;
+    }
+    uint64_t *keys = realloc(idx->keys, cap * sizeof(uint64_t));
+    if (keys == NULL) {
+        return false;
+    }
+    idx->keys = keys;
+    uint8_t *flags = realloc(idx->flags, cap);
+    if (flags == NULL) {
+        return false;
+    }
+    idx->flags = flags;
+    idx->capacity = cap;
+    return true;
+}
+
+static esp_err_t write_slot_locked(dir_index_t *idx, size_t slot, const uint8_t *data) {
+    if (lseek(idx->fd, INDEX_HEADER_LEN + (off_t)slot * INDEX_SLOT_LEN, SEEK_SET) < 0 ||
+        write(idx->fd, data, INDEX_SLOT_LEN) != INDEX_SLOT_LEN) {
+        return ESP_FAIL;
+    }
+    // Committed per slot, as closing the file used to, so a power cut loses at most this one
+    return fsync(idx->fd) == 0 ? ESP_OK : ESP_FAIL;
+}
+
+static bool read_slot_locked(dir_index_t *idx, size_t slot, capture_index_entry_t *e) {
+    uint8_t data[INDEX_SLOT_LEN];
+    return lseek(idx->fd, INDEX_HEADER_LEN + (off_t)slot * INDEX_SLOT_LEN, SEEK_SET) >= 0 &&
+           read(idx->fd, data, INDEX_SLOT_LEN) == INDEX_SLOT_LEN && decode_slot(data, e);
+}
+
+static esp_err_t put_entry_locked(dir_index_t *idx, size_t slot, const capture_index_entry_t *e) {
+    uint8_t data[INDEX_SLOT_LEN];
+    encode_slot(data, e);
+    idx->keys[slot] = name_key(e->name);
+    idx->flags[slot] = SLOT_USED | (e->open ? SLOT_OPEN : 0);
+    return write_slot_locked(idx, slot, data);
+}
+
+static esp_err_t free_slot_locked(dir_index_t *idx, size_t slot) {
+    uint8_t data[INDEX_SLOT_LEN] = {0};
+    idx->keys[slot] = 0;
+    idx->flags[slot] = 0;
+    return write_slot_locked(idx, slot, data);
+}
+
+static long find_slot_locked(dir_index_t *idx, const char *name) {
+    uint64_t key = name_key(name);
+    for (size_t i = 0; i < idx->slot_count; i++) {
+        if (idx->keys[i] == key) {
+            return (long)i;
+        }
+    }
+    return -1;
+}
+
+static long alloc_slot_locked(dir_index_t *idx) {
+    for (size_t i = 0; i < idx->slot_count; i++) {
+        if (idx->keys[i] == 0) {
+            return (long)i;
+        }
+    }
+    if (!reserve_slots_locked(idx, idx->slot_count + 1)) {
+        return -1;
+    }
+    idx->keys[idx->slot_count] = 0;
+    idx->flags[idx->slot_count] = 0;
+    return (long)idx->slot_count++;
+}
+
+static void close_file_locked(dir_index_t *idx) {
+    if (idx->fd >= 0) {
+        close(idx->fd);
+        idx->fd = -1;
+    }
+}
+
+static void reset_index_locked(dir_index_t *idx) {
+    if (idx->dir[0]) {
+        close_file_locked(idx);     // fd is only meaningful once dir is set
+    }
+    free(idx->keys);
+    free(idx->flags);
+    memset(idx, 0, sizeof(*idx));
+}
+
+static esp_err_t rebuild_locked(dir_index_t *idx) {
+    char path[96];
+    index_path(idx, path, sizeof(path));
+    close_file_locked(idx);
+
+    DIR *dir = opendir(idx->dir);
+    if (dir == NULL) {
+        return ESP_FAIL;
+    }
+    idx->fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0666);
+    if (idx->fd < 0) {
+        closedir(dir);
+        return ESP_FAIL;
+    }
+
+    uint8_t header[INDEX_HEADER_LEN] = {0};
+    memcpy(header, INDEX_MAGIC, 4);
+    header[4] = INDEX_VERSION;
+    header[6] = INDEX_SLOT_LEN;
+    esp_err_t ret = write(idx->fd, header, sizeof(header)) == sizeof(header) ? ESP_OK : ESP_FAIL;
+
+    idx->slot_count = 0;
+    idx->base_count = 0;
+
+    struct dirent *de;
+    while (ret == ESP_OK && (de = readdir(dir)) != NULL) {
+        if (de->d_name[0] == '.' || strlen(de->d_name) >= CAPTURE_INDEX_NAME_LEN) {
+            continue;
+        }
+        char full[160];
+        snprintf(full, sizeof(full), "%s/%s", idx->dir, de->d_name);
+        struct stat st;
+        if (stat(full, &st) != 0 || !S_ISREG(st.st_mode)) {
+            continue;
+        }
+
+        capture_index_entry_t e = {0};
+        strcpy(e.name, de->d_name);
+        e.size = (uint64_t)st.st_size;
+        e.start_time = (uint32_t)st.st_mtime;
+
+        char base[24];
+        const char *ext;
+        if (parse_name(de->d_name, base, sizeof(base), &e.seq, &ext)) {
+            note_seq_locked(idx, base, ext, e.seq);
+        }
+        e.type = type_from_ext(ext);
+
+        if (!reserve_slots_locked(idx, idx->slot_count + 1)) {
+            ret = ESP_ERR_NO_MEM;
+            break;
+        }
+        uint8_t data[INDEX_SLOT_LEN];
+        encode_slot(data, &e);
+        if (write(idx->fd, data, sizeof(data)) != sizeof(data)) {
+            ret = ESP_FAIL;
+            break;
+        }
+        idx->keys[idx->slot_count] = name_key(e.name);
+        idx->flags[idx->slot_count] = SLOT_USED;
+        idx->slot_count++;
+    }
+    closedir(dir);
+
+    if (ret == ESP_OK && fsync(idx->fd) != 0) {
+        ret = ESP_FAIL;
+    }
+    if (ret != ESP_OK) {
+        // A short index would load as complete next boot; leave none so it is scanned again
+        close_file_locked(idx);
+        unlink(path);
+        printf("Failed to index %s (card full?)\n", idx->dir);
+        return ret;
+    }
+    printf("Indexed %u files in %s\n", (unsigned)idx->slot_count, idx->dir);
+    return ESP_OK;
+}
+
+// Returns false when the index file is missing or doesn't look like ours
+static bool load_file_locked(dir_index_t *idx) {
+    char path[96];
+    index_path(idx, path, sizeof(path));
+    int fd = open(path, O_RDWR);
+    if (fd < 0) {
+        return false;
+    }
+
+    uint8_t header[INDEX_HEADER_LEN];
+    if (read(fd, header, sizeof(header)) != sizeof(header) || memcmp(header, INDEX_MAGIC, 4) != 0 ||
+        header[4] != INDEX_VERSION || header[6] != INDEX_SLOT_LEN) {
+        close(fd);
+        return false;
+    }
+    idx->fd = fd;
+
+    uint8_t data[INDEX_SLOT_LEN];
+    size_t open_slots[8];
+    size_t open_count = 0;
+    bool ok = true;
+    while (read(fd, data, sizeof(data)) == sizeof(data)) {
+        if (!reserve_slots_locked(idx, idx->slot_count + 1)) {
+            ok = false;
+            break;
+        }
+        capture_index_entry_t e;
+        size_t slot = idx->slot_count++;
+        if (!decode_slot(data, &e)) {
+            idx->keys[slot] = 0;
+            idx->flags[slot] = 0;
+            continue;
+        }
+        idx->keys[slot] = name_key(e.name);
+        idx->flags[slot] = data[49];
+
+        char base[24];
+        const char *ext;
+        if (parse_name(e.name, base, sizeof(base), &e.seq, &ext)) {
+            note_seq_locked(idx, base, ext, e.seq);
+        }
+        if (e.open && open_count < sizeof(open_slots) / sizeof(open_slots[0])) {
+            open_slots[open_count++] = slot;
+        }
+    }
+    if (!ok) {
+        close_file_locked(idx);
+        return false;
+    }
+
+    // Files that were never closed (power loss); pick up the size crash recovery left behind
+    for (size_t i = 0; i < open_count; i++) {
+        capture_index_entry_t e;
+        if (!read_slot_locked(idx, open_slots[i], &e)) {
+            continue;
+        }
+        char full[160];
+        snprintf(full, sizeof(full), "%s/%s", idx->dir, e.name);
+        struct stat st;
+        if (stat(full, &st) != 0) {
+            free_slot_locked(idx, open_slots[i]);
+        } else {
+            e.size = (uint64_t)st.st_size;
+            e.open = false;
+            put_entry_locked(idx, open_slots[i], &e);
+        }
+    }
+    return true;
+}
+
+static dir_index_t *get_index_locked(const char *dir) {
+    dir_index_t *idx = find_index_locked(dir);
+    if (idx != NULL) {
+        return idx;
+    }
+    if (strlen(dir) >= sizeof(indexes[0].dir)) {
+        return NULL;
+    }
+    for (int i = 0; i < CAPTURE_INDEX_MAX_DIRS; i++) {
+        if (!indexes[i].loaded) {
+            idx = &indexes[i];
+            break;
+        }
+    }
+    if (idx == NULL) {
+        return NULL;
+    }
+
+    strcpy(idx->dir, dir);
+    idx->fd = -1;
+    if (!load_file_locked(idx)) {
+        free(idx->keys);
+        free(idx->flags);
+        idx->keys = NULL;
+        idx->flags = NULL;
+        idx->capacity = idx->slot_count = idx->base_count = 0;
+        if (rebuild_locked(idx) != ESP_OK) {
+            reset_index_locked(idx);
+            return NULL;
+        }
+    }
+    idx->loaded = true;
+    return idx;
+}
+
+// Split a full path into its directory index and file name
+static dir_index_t *index_for_path_locked(const char *path, const char **name) {
+    const char *slash = strrchr(path, '/');
+    if (slash == NULL || slash == path) {
+        return NULL;
+    }
+    char dir[64];
+    size_t len = slash - path;
+    if (len >= sizeof(dir)) {
+        return NULL;
+    }
+    memcpy(dir, path, len);
+    dir[len] = '\0';
+    *name = slash + 1;
+    return find_index_locked(dir);
+}
+
+esp_err_t capture_index_load(const char *dir) {
+    pthread_mutex_lock(&index_lock);
+    dir_index_t *idx = get_index_locked(dir);
+    pthread_mutex_unlock(&index_lock);
+    return idx ? ESP_OK : ESP_FAIL;
+}
+
+void capture_index_unload(void) {
+    pthread_mutex_lock(&index_lock);
+    for (int i = 0; i < CAPTURE_INDEX_MAX_DIRS; i++) {
+        reset_index_locked(&indexes[i]);
+    }
+    pthread_mutex_unlock(&index_lock);
+}
+
+static uint32_t next_seq_locked(dir_index_t *idx, const char *base, const char *ext) {
+    for (size_t i = 0; i < idx->base_count; i++) {
+        if (strcmp(idx->bases[i].base, base) == 0 && ext_equal(idx->bases[i].ext, ext)) {
+            return idx->bases[i].next;
+        }
+    }
+    if (idx->base_count < CAPTURE_INDEX_MAX_BASES) {
+        return 0;  // Every name in the directory went through note_seq_locked, so this base is unused
+    }
+
+    // Base table full: fall back to the catalog itself
+    uint32_t next = 0;
+    for (size_t i = 0; i < idx->slot_count; i++) {
+        capture_index_entry_t e;
+        char entry_base[24];
+        const char *entry_ext;
+        uint32_t seq;
+        if (idx->keys[i] && read_slot_locked(idx, i, &e) &&
+            parse_name(e.name, entry_base, sizeof(entry_base), &seq, &entry_ext) &&
+            strcmp(entry_base, base) == 0 && ext_equal(entry_ext, ext) && seq + 1 > next) {
+            next = seq + 1;
+        }
+    }
+    return next;
+}
+
+int capture_index_peek_seq(const char *dir, const char *base, const char *ext) {
+    pthread_mutex_lock(&index_lock);
+    dir_index_t *idx = get_index_locked(dir);
+    int seq = idx ? (int)next_seq_locked(idx, base, ext) : -1;
+    pthread_mutex_unlock(&index_lock);
+    return seq;
+}
+
+int capture_index_create(const char *dir, const char *base, const char *ext, char *path_out, size_t path_len) {
+    pthread_mutex_lock(&index_lock);
+    dir_index_t *idx = get_index_locked(dir);
+    if (idx == NULL) {
+        pthread_mutex_unlock(&index_lock);
+        return -1;
+    }
+
+    capture_index_entry_t e = {0};
+    uint32_t seq = next_seq_locked(idx, base, ext);
+    for (;;) {
+        int n = snprintf(e.name, sizeof(e.name), "%s_%lu.%s", base, (unsigned long)seq, ext);
+        if (n < 0 || (size_t)n >= sizeof(e.name)) {
+            pthread_mutex_unlock(&index_lock);
+            return -1;
+        }
+        snprintf(path_out, path_len, "%s/%s", dir, e.name);
+        // Files copied onto the card behind our back are skipped rather than overwritten
+        struct stat st;
+        if (stat(path_out, &st) != 0) {
+            break;
+        }
+        seq++;
+    }
+
+    e.seq = seq;
+    e.type = type_from_ext(ext);
+    e.open = true;
+    e.start_time = (uint32_t)time(NULL);
+    note_seq_locked(idx, base, ext, seq);
+
+    long slot = alloc_slot_locked(idx);
+    if (slot >= 0) {
+        put_entry_locked(idx, (size_t)slot, &e);
+    }
+    pthread_mutex_unlock(&index_lock);
+    return (int)seq;
+}
+
+esp_err_t capture_index_update(const char *path, uint64_t size, uint32_t records) {
+    const char *name;
+    pthread_mutex_lock(&index_lock);
+    dir_index_t *idx = index_for_path_locked(path, &name);
+    if (idx == NULL || strlen(name) >= CAPTURE_INDEX_NAME_LEN) {
+        pthread_mutex_unlock(&index_lock);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    capture_index_entry_t e = {0};
+    long slot = find_slot_locked(idx, name);
+    if (slot < 0 || !read_slot_locked(idx, (size_t)slot, &e)) {
+        slot = alloc_slot_locked(idx);
+        if (slot < 0) {
+            pthread_mutex_unlock(&index_lock);
+            return ESP_ERR_NO_MEM;
+        }
+        strcpy(e.name, name);
+        char base[24];
+        const char *ext;
+        if (parse_name(name, base, sizeof(base), &e.seq, &ext)) {
+            note_seq_locked(idx, base, ext, e.seq);
+        }
+        e.type = type_from_ext(ext);
+        e.start_time = (uint32_t)time(NULL);
+    }
+
+    e.size = size;
+    e.records = records;
+    e.open = false;
+    esp_err_t ret = put_entry_locked(idx, (size_t)slot, &e);
+    pthread_mutex_unlock(&index_lock);
+    return ret;
+}
+
+esp_err_t capture_index_remove(const char *path) {
+    const char *name;
+    pthread_mutex_lock(&index_lock);
+    dir_index_t *idx = index_for_path_locked(path, &name);
+    long slot = idx ? find_slot_locked(idx, name) : -1;
+    esp_err_t ret = slot >= 0 ? free_slot_locked(idx, (size_t)slot) : ESP_ERR_NOT_FOUND;
+    pthread_mutex_unlock(&index_lock);
+    return ret;
+}
+
+esp_err_t capture_index_rebuild(const char *dir) {
+    pthread_mutex_lock(&index_lock);
+    dir_index_t *idx = get_index_locked(dir);
+    esp_err_t ret = idx ? rebuild_locked(idx) : ESP_FAIL;
+    if (idx != NULL && ret != ESP_OK) {
+        reset_index_locked(idx);    // Back to readdir until a later load indexes it again
+    }
+    pthread_mutex_unlock(&index_lock);
+    return ret;
+}
+
+bool capture_index_is_indexed(const char *dir) {
+    pthread_mutex_lock(&index_lock);
+    bool indexed = find_index_locked(dir) != NULL;
+    pthread_mutex_unlock(&index_lock);
+    return indexed;
+}
+
+esp_err_t capture_index_foreach(const char *dir, capture_index_visit_fn fn, void *ctx) {
+    uint8_t *chunk = malloc(INDEX_SLOT_LEN * INDEX_READ_SLOTS);
+    capture_index_entry_t *batch = malloc(INDEX_READ_SLOTS * sizeof(capture_index_entry_t));
+    if (chunk == NULL || batch == NULL) {
+        free(chunk);
+        free(batch);
+        return ESP_ERR_NO_MEM;
+    }
+
+    // One sequential read of the index instead of a readdir + stat per file. Entries are copied out a
+    // batch at a time and visited with the lock released, so a slow consumer (an HTTP client) never
+    // holds up capture_index_create
+    esp_err_t ret = ESP_OK;
+    off_t offset = INDEX_HEADER_LEN;
+    for (bool first = true;; first = false) {
+        size_t count = 0;
+        ssize_t n = 0;
+        pthread_mutex_lock(&index_lock);
+        dir_index_t *idx = find_index_locked(dir);
+        if (idx == NULL) {
+            pthread_mutex_unlock(&index_lock);
+            ret = first ? ESP_ERR_NOT_FOUND : ESP_OK;   // Unloaded between batches
+            break;
+        }
+        // The shared fd is only moved under the lock, and the slot writes went through it, so no
+        // stale sector cache can be read back
+        if (lseek(idx->fd, offset, SEEK_SET) < 0) {
+            ret = ESP_FAIL;
+        } else {
+            n = read(idx->fd, chunk, INDEX_SLOT_LEN * INDEX_READ_SLOTS);
+            ret = n < 0 ? ESP_FAIL : ESP_OK;
+        }
+        pthread_mutex_unlock(&index_lock);
+
+        for (ssize_t off = 0; off + INDEX_SLOT_LEN <= n; off += INDEX_SLOT_LEN) {
+            if (decode_slot(chunk + off, &batch[count])) {
+                count++;
+            }
+        }
+        for (size_t i = 0; i < count; i++) {
+            fn(ctx, &batch[i]);
+        }
+        if (ret != ESP_OK || n < INDEX_SLOT_LEN * INDEX_READ_SLOTS) {
+            break;
+        }
+        offset += n;
+    }
+
+    free(chunk);
+    free(batch);
+    return ret;
+}
+
+const char *capture_index_type_str(capture_file_type_t type) {
+    switch (type) {
+        case CAPTURE_FILE_PCAP: return "pcap";
+        case CAPTURE_FILE_CSV: return "csv";
+        case CAPTURE_FILE_TEXT: return "text";
+        default: return "other";
+    }
+}
@@ -0,0 +1,402 @@
+#include "managers/capture_journal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#define PCAP_MAGIC 0xa1b2c3d4u
+#define PCAP_MAGIC_SWAPPED 0xd4c3b2a1u
+#define PCAP_GLOBAL_HEADER_LEN 24
+#define PCAP_RECORD_HEADER_LEN 16
+#define PCAP_MAX_SANE_RECORD 65535
+#define JOURNAL_FLAG_PREALLOCATED 0x100   // Or'ed into the kind field of a journal line
+#define JOURNAL_CODEC_SHIFT 9             // sd_writer_codec_t of compressed files, also in the kind field
+#define JOURNAL_CODEC_MASK 0x3
+
+typedef struct {
+    bool used;
+    capture_kind_t kind;
+    bool preallocated;
+    sd_writer_codec_t codec;
+    uint64_t committed;
+    char path[sizeof(((capture_checkpoint_t*)0)->path)];
+} journal_entry_t;
+
+static journal_entry_t journal[CAPTURE_JOURNAL_MAX_ENTRIES];
+static pthread_mutex_t journal_lock = PTHREAD_MUTEX_INITIALIZER;
+static sd_writer_codec_t capture_codec = CAPTURE_DEFAULT_CODEC;
+static uint8_t capture_codec_level = CAPTURE_DEFAULT_CODEC_LEVEL;
+
+static int64_t monotonic_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// Must hold journal_lock. The journal is a few lines, so it is rewritten whole and synced.
+static void journal_save_locked(void) {
+    char line[sizeof(journal[0].path) + 32];
+    int fd = open(CAPTURE_JOURNAL_PATH, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd < 0) {
+        return;
+    }
+    for (int i = 0; i < CAPTURE_JOURNAL_MAX_ENTRIES; i++) {
+        if (!journal[i].used) {
+            continue;
+        }
+        int kind = (int)journal[i].kind | (journal[i].preallocated ? JOURNAL_FLAG_PREALLOCATED : 0) |
+                   ((int)journal[i].codec << JOURNAL_CODEC_SHIFT);
+        int len = snprintf(line, sizeof(line), "%d %llu %s\n", kind,
+                           (unsigned long long)journal[i].committed, journal[i].path);
+        if (len > 0 && write(fd, line, (size_t)len) != len) {
+            break;
+        }
+    }
+    fsync(fd);
+    close(fd);
+}
+
+static journal_entry_t *journal_find_locked(const char *path) {
+    for (int i = 0; i < CAPTURE_JOURNAL_MAX_ENTRIES; i++) {
+        if (journal[i].used && strcmp(journal[i].path, path) == 0) {
+            return &journal[i];
+        }
+    }
+    return NULL;
+}
+
+// Runs on the writer thread once the checkpoint offset has been synced
+static void journal_checkpoint_cb(void *ctx, uint64_t offset) {
+    capture_checkpoint_t *cp = ctx;
+    pthread_mutex_lock(&journal_lock);
+    journal_entry_t *entry = journal_find_locked(cp->path);
+    if (entry != NULL && offset > entry->committed) {
+        entry->committed = offset;
+        journal_save_locked();
+    }
+    pthread_mutex_unlock(&journal_lock);
+}
+
+esp_err_t capture_journal_open(capture_checkpoint_t *cp, sd_writer_stream_t *stream, const char *path, capture_kind_t kind) {
+    if (cp == NULL || stream == NULL || path == NULL || strlen(path) >= sizeof(cp->path)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    cp->stream = stream;
+    strcpy(cp->path, path);
+    cp->last_us = monotonic_us();
+    cp->last_offset = 0;
+
+    pthread_mutex_lock(&journal_lock);
+    journal_entry_t *entry = journal_find_locked(path);
+    for (int i = 0; entry == NULL && i < CAPTURE_JOURNAL_MAX_ENTRIES; i++) {
+        if (!journal[i].used) {
+            entry = &journal[i];
+        }
+    }
+    if (entry == NULL) {
+        pthread_mutex_unlock(&journal_lock);
+        return ESP_ERR_NO_MEM;
+    }
+    entry->used = true;
+    entry->kind = kind;
+    entry->preallocated = sd_writer_stream_preallocated(stream);
+    entry->codec = sd_writer_stream_codec(stream);
+    entry->committed = 0;
+    strcpy(entry->path, path);
+    journal_save_locked();
+    pthread_mutex_unlock(&journal_lock);
+    return ESP_OK;
+}
+
+void capture_journal_tick(capture_checkpoint_t *cp) {
+    if (cp == NULL || cp->stream == NULL) {
+        return;
+    }
+
+    uint64_t offset = sd_writer_stream_size(cp->stream);
+    if (offset == cp->last_offset) {
+        return;
+    }
+
+    int64_t now = monotonic_us();
+    if (offset - cp->last_offset < CAPTURE_CHECKPOINT_BYTES &&
+        now - cp->last_us < (int64_t)CAPTURE_CHECKPOINT_INTERVAL_MS * 1000) {
+        return;
+    }
+
+    cp->last_offset = offset;
+    cp->last_us = now;
+    sd_writer_checkpoint(cp->stream, journal_checkpoint_cb, cp);
+}
+
+void capture_journal_close(capture_checkpoint_t *cp) {
+    if (cp == NULL || cp->stream == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&journal_lock);
+    journal_entry_t *entry = journal_find_locked(cp->path);
+    if (entry != NULL) {
+        entry->used = false;
+        journal_save_locked();
+    }
+    pthread_mutex_unlock(&journal_lock);
+    cp->stream = NULL;
+}
+
+static capture_recovery_result_t finish_recovery(const char *path, uint64_t size, uint64_t good_end,
+                                                 uint32_t records, bool remove_if_empty) {
+    capture_recovery_result_t result = {
+        .action = CAPTURE_RECOVERY_INTACT,
+        .original_size = size,
+        .recovered_size = good_end,
+        .records_checked = records,
+    };
+
+    if (good_end == 0 && remove_if_empty) {
+        result.action = unlink(path) == 0 ? CAPTURE_RECOVERY_REMOVED : CAPTURE_RECOVERY_ERROR;
+    } else if (good_end < size) {
+        result.action = truncate(path, (off_t)good_end) == 0 ? CAPTURE_RECOVERY_TRUNCATED : CAPTURE_RECOVERY_ERROR;
+    }
+    return result;
+}
+
+static uint32_t read_u32(const uint8_t *p, bool swapped) {
+    if (swapped) {
+        return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+    }
+    return ((uint32_t)p[3] << 24) | ((uint32_t)p[2] << 16) | ((uint32_t)p[1] << 8) | p[0];
+}
+
+// Walk record headers from offset; returns the end of the last complete, plausible record
+static uint64_t pcap_walk(FILE *f, uint64_t offset, uint64_t size, uint32_t max_record, bool swapped, uint32_t *records) {
+    uint8_t hdr[PCAP_RECORD_HEADER_LEN];
+    *records = 0;
+
+    while (offset + PCAP_RECORD_HEADER_LEN <= size) {
+        if (fseek(f, (long)offset, SEEK_SET) != 0 || fread(hdr, 1, sizeof(hdr), f) != sizeof(hdr)) {
+            break;
+        }
+        uint32_t incl_len = read_u32(hdr + 8, swapped);
+        uint32_t orig_len = read_u32(hdr + 12, swapped);
+        if (incl_len > orig_len || incl_len > max_record) {
+            break;
+        }
+        if (offset + PCAP_RECORD_HEADER_LEN + incl_len > size) {
+            break;
+        }
+        offset += PCAP_RECORD_HEADER_LEN + incl_len;
+        (*records)++;
+    }
+    return offset;
+}
+
+capture_recovery_result_t capture_recover_pcap(const char *path, uint64_t checkpoint) {
+    capture_recovery_result_t result = { .action = CAPTURE_RECOVERY_MISSING };
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        return result;
+    }
+    uint64_t size = (uint64_t)st.st_size;
+
+    // Header never made it to the card
+    if (size < PCAP_GLOBAL_HEADER_LEN) {
+        return finish_recovery(path, size, 0, 0, true);
+    }
+
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        result.action = CAPTURE_RECOVERY_ERROR;
+        return result;
+    }
+
+    uint8_t global[PCAP_GLOBAL_HEADER_LEN];
+    if (fread(global, 1, sizeof(global), f) != sizeof(global)) {
+        fclose(f);
+        result.action = CAPTURE_RECOVERY_ERROR;
+        return result;
+    }
+
+    uint32_t magic = read_u32(global, false);
+    if (magic != PCAP_MAGIC && magic != PCAP_MAGIC_SWAPPED) {
+        // Not something we wrote; leave it alone
+        fclose(f);
+        result.action = CAPTURE_RECOVERY_ERROR;
+        result.original_size = size;
+        return result;
+    }
+    bool swapped = magic == PCAP_MAGIC_SWAPPED;
+    uint32_t snaplen = read_u32(global + 16, swapped);
+    uint32_t max_record = snaplen > PCAP_MAX_SANE_RECORD ? snaplen : PCAP_MAX_SANE_RECORD;
+
+    uint64_t start = checkpoint >= PCAP_GLOBAL_HEADER_LEN && checkpoint <= size ? checkpoint : PCAP_GLOBAL_HEADER_LEN;
+    uint32_t records = 0;
+    uint64_t good_end = pcap_walk(f, start, size, max_record, swapped, &records);
+
+    // A stale or bogus checkpoint that doesn't land on a record; validate the whole file instead
+    if (records == 0 && good_end < size && start != PCAP_GLOBAL_HEADER_LEN) {
+        good_end = pcap_walk(f, PCAP_GLOBAL_HEADER_LEN, size, max_record, swapped, &records);
+    }
+    fclose(f);
+
+    return finish_recovery(path, size, good_end, records, false);
+}
+
+capture_recovery_result_t capture_recover_text(const char *path, uint64_t checkpoint) {
+    capture_recovery_result_t result = { .action = CAPTURE_RECOVERY_MISSING };
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        return result;
+    }
+    uint64_t size = (uint64_t)st.st_size;
+    uint64_t start = checkpoint <= size ? checkpoint : 0;
+
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        result.action = CAPTURE_RECOVERY_ERROR;
+        return result;
+    }
+
+    // Everything up to the checkpoint ends on a line; keep up to the last newline after it
+    char chunk[512];
+    uint64_t pos = start;
+    uint64_t good_end = start;
+    uint32_t lines = 0;
+    if (fseek(f, (long)start, SEEK_SET) == 0) {
+        size_t n;
+        while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+            for (size_t i = 0; i < n; i++) {
+                if (chunk[i] == '\n') {
+                    good_end = pos + i + 1;
+                    lines++;
+                }
+            }
+            pos += n;
+        }
+    }
+    fclose(f);
+
+    return finish_recovery(path, size, good_end, lines, true);
+}
+
+capture_recovery_result_t capture_recover_preallocated(const char *path, capture_kind_t kind, uint64_t checkpoint) {
+    capture_recovery_result_t result = { .action = CAPTURE_RECOVERY_MISSING };
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        return result;
+    }
+    uint64_t size = (uint64_t)st.st_size;
+    uint64_t good_end = checkpoint <= size ? checkpoint : size;
+
+    // Keep a pcap that never reached a checkpoint as an empty capture if its header made it
+    if (kind == CAPTURE_KIND_PCAP && good_end < PCAP_GLOBAL_HEADER_LEN) {
+        uint8_t global[PCAP_GLOBAL_HEADER_LEN];
+        FILE *f = fopen(path, "rb");
+        bool header_ok = f != NULL && fread(global, 1, sizeof(global), f) == sizeof(global) &&
+                         (read_u32(global, false) == PCAP_MAGIC || read_u32(global, false) == PCAP_MAGIC_SWAPPED);
+        if (f != NULL) {
+            fclose(f);
+        }
+        good_end = header_ok ? PCAP_GLOBAL_HEADER_LEN : 0;
+    }
+    return finish_recovery(path, size, good_end, 0, true);
+}
+
+capture_recovery_result_t capture_recover_compressed(const char *path, sd_writer_codec_t codec, uint64_t checkpoint) {
+    capture_recovery_result_t result = { .action = CAPTURE_RECOVERY_MISSING };
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        return result;
+    }
+    uint64_t size = (uint64_t)st.st_size;
+
+    // Compressed data can't be walked record by record; without a checkpoint there is nothing to keep
+    result = finish_recovery(path, size, checkpoint <= size ? checkpoint : size, 0, true);
+    if (codec == SD_WRITER_CODEC_LZ4 &&
+        (result.action == CAPTURE_RECOVERY_INTACT || result.action == CAPTURE_RECOVERY_TRUNCATED)) {
+        static const uint8_t end_mark[4] = {0};
+        int fd = open(path, O_WRONLY | O_APPEND);
+        if (fd < 0 || write(fd, end_mark, sizeof(end_mark)) != (ssize_t)sizeof(end_mark)) {
+            result.action = CAPTURE_RECOVERY_ERROR;
+        } else {
+            result.action = CAPTURE_RECOVERY_TRUNCATED;
+            result.recovered_size += sizeof(end_mark);
+        }
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+    return result;
+}
+
+int capture_journal_recover(void) {
+    FILE *f = fopen(CAPTURE_JOURNAL_PATH, "r");
+    if (f == NULL) {
+        return 0;
+    }
+
+    int repaired = 0;
+    char line[sizeof(journal[0].path) + 32];
+    while (fgets(line, sizeof(line), f) != NULL) {
+        int kind;
+        unsigned long long committed;
+        char path[sizeof(journal[0].path)];
+        if (sscanf(line, "%d %llu %159[^\n]", &kind, &committed, path) != 3) {
+            continue;  // Torn journal line; nothing reliable to act on
+        }
+
+        capture_recovery_result_t r;
+        sd_writer_codec_t codec = (sd_writer_codec_t)((kind >> JOURNAL_CODEC_SHIFT) & JOURNAL_CODEC_MASK);
+        kind &= ~(JOURNAL_CODEC_MASK << JOURNAL_CODEC_SHIFT);
+        if (codec != SD_WRITER_CODEC_NONE) {
+            r = capture_recover_compressed(path, codec, committed);
+        } else if (kind & JOURNAL_FLAG_PREALLOCATED) {
+            r = capture_recover_preallocated(path, (capture_kind_t)(kind & ~JOURNAL_FLAG_PREALLOCATED), committed);
+        } else if (kind == CAPTURE_KIND_PCAP) {
+            r = capture_recover_pcap(path, committed);
+        } else {
+            r = capture_recover_text(path, committed);
+        }
+        printf("Recovered %s: %s (%llu -> %llu bytes, %lu records checked)\n", path,
+               capture_recovery_action_str(r.action), (unsigned long long)r.original_size,
+               (unsigned long long)r.recovered_size, (unsigned long)r.records_checked);
+        if (r.action == CAPTURE_RECOVERY_TRUNCATED || r.action == CAPTURE_RECOVERY_REMOVED) {
+            repaired++;
+        }
+    }
+    fclose(f);
+
+    pthread_mutex_lock(&journal_lock);
+    memset(journal, 0, sizeof(journal));
+    unlink(CAPTURE_JOURNAL_PATH);
+    pthread_mutex_unlock(&journal_lock);
+    return repaired;
+}
+
+const char *capture_recovery_action_str(capture_recovery_action_t action) {
+    switch (action) {
+        case CAPTURE_RECOVERY_INTACT: return "intact";
+        case CAPTURE_RECOVERY_TRUNCATED: return "truncated";
+        case CAPTURE_RECOVERY_REMOVED: return "removed";
+        case CAPTURE_RECOVERY_MISSING: return "missing";
+        default: return "error";
+    }
+}
+
+void capture_set_compression(sd_writer_codec_t codec, uint8_t level) {
+    capture_codec = codec;
+    capture_codec_level = level > 9 ? 9 : level;
+}
+
+sd_writer_codec_t capture_get_compression(uint8_t *level) {
+    if (level != NULL) {
+        *level = capture_codec_level;
+    }
+    return capture_codec;
+}
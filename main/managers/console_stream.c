@@ -0,0 +1,340 @@
+#include "managers/console_stream.h"
+#include "managers/sd_writer.h"
+#include "vendor/pcap.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+
+#define CLIENT_BUF_SIZE 1024
+#define ROUND_BYTES 4096             // Per client and wakeup, so one busy client can't starve the other
+#define LOG_LINE_MAX 160             // ESP_LOG lines are formatted on the caller's stack
+
+static const char *TAG = "CONSOLE";
+
+typedef struct {
+    httpd_req_t *req;
+    uint32_t cursor;
+    uint32_t alert_cursor;
+    int64_t last_send_us;
+    size_t round_bytes;
+    size_t len;
+    esp_err_t err;
+    char buf[CLIENT_BUF_SIZE];
+} console_client_t;
+
+typedef struct {
+    httpd_req_t *req;
+    uint32_t cursor;
+} attach_request_t;
+
+static log_ring_t console_ring;
+static log_ring_t alert_ring;
+static TaskHandle_t stream_task = NULL;
+static QueueHandle_t attach_queue = NULL;
+static console_client_t *clients[CONSOLE_STREAM_MAX_CLIENTS];
+static _Atomic uint32_t active_clients;
+static _Atomic uint32_t pending_since_us;   // Low 32 bits of the time the oldest unsent line arrived, 0 if none
+static console_stream_stats_t stats;
+// Held for every stats update and for the snapshot: the 64-bit counters can't be read or written in one
+// access on this CPU, and the streaming task and the server task both update them
+static portMUX_TYPE stats_lock = portMUX_INITIALIZER_UNLOCKED;
+static vprintf_like_t default_log_vprintf = NULL;
+static FILE *serial_stdout = NULL;
+static FILE *tee_stdout = NULL;
+static console_stream_tee_fn tee_also = NULL;
+
+static void notify_stream(void) {
+    if (stream_task == NULL || atomic_load_explicit(&active_clients, memory_order_relaxed) == 0) {
+        return;
+    }
+    uint32_t expected = 0;
+    uint32_t now = (uint32_t)esp_timer_get_time() | 1;
+    atomic_compare_exchange_strong(&pending_since_us, &expected, now);
+    xTaskNotifyGive(stream_task);
+}
+
+void console_stream_write(const char *text, size_t len) {
+    log_ring_append(&console_ring, text, len);
+    notify_stream();
+}
+
+void console_stream_log(const char *text) {
+    console_stream_write(text, strlen(text));
+    fputs(text, serial_stdout ? serial_stdout : stdout);
+}
+
+void console_stream_alert(const char *text) {
+    log_ring_append(&alert_ring, text, strlen(text));
+    notify_stream();
+}
+
+log_ring_t *console_stream_ring(void) {
+    return &console_ring;
+}
+
+static int console_log_vprintf(const char *fmt, va_list args) {
+    char line[LOG_LINE_MAX];
+    va_list copy;
+    va_copy(copy, args);
+    int len = vsnprintf(line, sizeof(line), fmt, copy);
+    va_end(copy);
+    // On the mirrored task the default vprintf below reaches the ring through the tee
+    if (len > 0 && stdout != tee_stdout) {
+        console_stream_write(line, (size_t)len < sizeof(line) ? (size_t)len : sizeof(line) - 1);
+    }
+    return default_log_vprintf ? default_log_vprintf(fmt, args) : vprintf(fmt, args);
+}
+
+void console_stream_init(void) {
+    if (default_log_vprintf == NULL) {
+        default_log_vprintf = esp_log_set_vprintf(console_log_vprintf);
+    }
+}
+
+static int stdout_tee_write(void *cookie, const char *buf, int len) {
+    fwrite(buf, 1, len, (FILE *)cookie);
+    fflush((FILE *)cookie);
+    console_stream_write(buf, len);
+    if (tee_also != NULL) {
+        tee_also(buf, len);
+    }
+    return len;
+}
+
+void console_stream_capture_stdout(console_stream_tee_fn also) {
+    // stdout is per task in ESP-IDF, so only the calling task's output is mirrored
+    FILE *tee = fwopen(stdout, stdout_tee_write);
+    if (tee == NULL) {
+        ESP_LOGW(TAG, "Could not mirror stdout to the web console");
+        return;
+    }
+    setvbuf(tee, NULL, _IOLBF, 256);
+    tee_also = also;
+    serial_stdout = stdout;
+    tee_stdout = tee;
+    stdout = tee;
+}
+
+static void client_flush(console_client_t *c) {
+    if (c->len == 0 || c->err != ESP_OK) {
+        return;
+    }
+    c->err = httpd_resp_send_chunk(c->req, c->buf, c->len);
+    if (c->err == ESP_OK) {
+        taskENTER_CRITICAL(&stats_lock);
+        stats.chunks_sent++;
+        stats.bytes_sent += c->len;
+        taskEXIT_CRITICAL(&stats_lock);
+        c->round_bytes += c->len;
+        c->last_send_us = esp_timer_get_time();
+    }
+    c->len = 0;
+}
+
+static void client_printf(console_client_t *c, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+
+static void client_printf(console_client_t *c, const char *fmt, ...) {
+    for (int attempt = 0; attempt < 2 && c->err == ESP_OK; attempt++) {
+        va_list args;
+        va_start(args, fmt);
+        int n = vsnprintf(c->buf + c->len, sizeof(c->buf) - c->len, fmt, args);
+        va_end(args);
+        if (n >= 0 && (size_t)n < sizeof(c->buf) - c->len) {
+            c->len += n;
+            return;
+        }
+        client_flush(c);
+    }
+}
+
+static bool client_line(void *ctx, uint32_t seq, const char *text, size_t len) {
+    console_client_t *c = ctx;
+    if (c->round_bytes >= ROUND_BYTES) {
+        return false;  // Rest goes out next round
+    }
+    client_printf(c, "id: %lu\ndata: %.*s\n\n", (unsigned long)(seq + 1), (int)len, text);
+    taskENTER_CRITICAL(&stats_lock);
+    stats.lines_sent++;
+    taskEXIT_CRITICAL(&stats_lock);
+    return c->err == ESP_OK;
+}
+
+static bool client_alert(void *ctx, uint32_t seq, const char *text, size_t len) {
+    console_client_t *c = ctx;
+    client_printf(c, "event: alert\ndata: %.*s\n\n", (int)len, text);
+    return c->err == ESP_OK;
+}
+
+// Returns true when the client still has lines waiting
+static bool serve_client(console_client_t *c, const char *counters, int64_t now_us) {
+    c->round_bytes = 0;
+    uint32_t lost = log_ring_read(&console_ring, &c->cursor, client_line, c);
+    if (lost > 0) {
+        taskENTER_CRITICAL(&stats_lock);
+        stats.lines_lost += lost;
+        taskEXIT_CRITICAL(&stats_lock);
+        client_printf(c, "event: gap\ndata: %lu\n\n", (unsigned long)lost);
+    }
+    log_ring_read(&alert_ring, &c->alert_cursor, client_alert, c);
+    if (counters != NULL) {
+        client_printf(c, "event: counters\ndata: %s\n\n", counters);
+    }
+    if (c->len == 0 && now_us - c->last_send_us >= CONSOLE_STREAM_KEEPALIVE_MS * 1000LL) {
+        client_printf(c, ": keepalive\n\n");
+    }
+    client_flush(c);
+    return c->err == ESP_OK && c->cursor != log_ring_head(&console_ring);
+}
+
+static const char *format_counters(char *out, size_t out_len) {
+    const char *file = pcap_get_file_name();
+    if (file == NULL) {
+        return NULL;
+    }
+    pcap_capture_stats_t capture;
+    sd_writer_metrics_t writer;
+    pcap_get_capture_stats(&capture);
+    sd_writer_get_metrics(&writer);
+    snprintf(out, out_len,
+             "{\"file\":\"%s\",\"frames_seen\":%lu,\"frames_written\":%lu,\"sampled_out\":%lu,"
+             "\"write_errors\":%lu,\"bytes_written\":%llu,\"bytes_dropped\":%llu,\"queue_depth\":%lu}",
+             file, (unsigned long)capture.frames_seen, (unsigned long)capture.frames_written,
+             (unsigned long)capture.frames_sampled_out, (unsigned long)capture.write_errors,
+             (unsigned long long)writer.bytes_written, (unsigned long long)writer.bytes_dropped,
+             (unsigned long)writer.queue_depth);
+    return out;
+}
+
+static void drop_client(int i) {
+    httpd_req_async_handler_complete(clients[i]->req);
+    free(clients[i]);
+    clients[i] = NULL;
+    uint32_t remaining = atomic_fetch_sub(&active_clients, 1) - 1;
+    taskENTER_CRITICAL(&stats_lock);
+    stats.clients_dropped++;
+    stats.clients = remaining;
+    taskEXIT_CRITICAL(&stats_lock);
+}
+
+static void stream_task_main(void *arg) {
+    int64_t last_counters_us = 0;
+    char counters_buf[256];
+
+    for (;;) {
+        // Woken by new lines; otherwise once per counters interval for counters and keepalives
+        if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(CONSOLE_STREAM_COUNTERS_MS)) > 0) {
+            vTaskDelay(pdMS_TO_TICKS(CONSOLE_STREAM_BATCH_MS));  // Let a burst collect into one chunk
+        }
+        int64_t start_us = esp_timer_get_time();
+
+        attach_request_t attach;
+        while (xQueueReceive(attach_queue, &attach, 0) == pdTRUE) {
+            int slot = -1;
+            for (int i = 0; i < CONSOLE_STREAM_MAX_CLIENTS && slot < 0; i++) {
+                slot = clients[i] == NULL ? i : -1;
+            }
+            console_client_t *c = slot >= 0 ? calloc(1, sizeof(console_client_t)) : NULL;
+            if (c == NULL) {
+                httpd_req_async_handler_complete(attach.req);
+                uint32_t remaining = atomic_fetch_sub(&active_clients, 1) - 1;
+                taskENTER_CRITICAL(&stats_lock);
+                stats.clients = remaining;
+                taskEXIT_CRITICAL(&stats_lock);
+                continue;
+            }
+            c->req = attach.req;
+            c->cursor = attach.cursor;
+            c->alert_cursor = log_ring_head(&alert_ring);
+            c->last_send_us = start_us;
+            clients[slot] = c;
+        }
+
+        const char *counters = NULL;
+        if (start_us - last_counters_us >= CONSOLE_STREAM_COUNTERS_MS * 1000LL) {
+            last_counters_us = start_us;
+            counters = format_counters(counters_buf, sizeof(counters_buf));
+        }
+
+        uint32_t pending = atomic_exchange(&pending_since_us, 0);
+        bool more = false;
+        for (int i = 0; i < CONSOLE_STREAM_MAX_CLIENTS; i++) {
+            if (clients[i] == NULL) {
+                continue;
+            }
+            more |= serve_client(clients[i], counters, start_us);
+            if (clients[i]->err != ESP_OK) {
+                ESP_LOGI(TAG, "Console client dropped: %s", esp_err_to_name(clients[i]->err));
+                drop_client(i);
+            }
+        }
+
+        int64_t end_us = esp_timer_get_time();
+        taskENTER_CRITICAL(&stats_lock);
+        if (pending != 0) {
+            uint32_t latency = (uint32_t)end_us - pending;
+            stats.latency_us_last = latency;
+            stats.latency_us_total += latency;
+            stats.latency_samples++;
+            if (latency > stats.latency_us_max) {
+                stats.latency_us_max = latency;
+            }
+        }
+        stats.task_us_total += end_us - start_us;
+        taskEXIT_CRITICAL(&stats_lock);
+        if (more) {
+            xTaskNotifyGive(stream_task);  // Lines left over from the per-round cap
+        }
+    }
+}
+
+esp_err_t console_stream_attach(httpd_req_t *req, uint32_t cursor) {
+    if (stream_task == NULL) {
+        attach_queue = xQueueCreate(CONSOLE_STREAM_MAX_CLIENTS, sizeof(attach_request_t));
+        if (attach_queue == NULL ||
+            xTaskCreate(stream_task_main, "console_stream", 4096, NULL, 4, &stream_task) != pdPASS) {
+            stream_task = NULL;
+            return ESP_FAIL;
+        }
+    }
+    if (atomic_fetch_add(&active_clients, 1) >= CONSOLE_STREAM_MAX_CLIENTS) {
+        atomic_fetch_sub(&active_clients, 1);
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Headers and the reconnect delay go out from the server task, the rest from the streaming task
+    httpd_resp_set_type(req, "text/event-stream");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+    httpd_req_t *async = NULL;
+    esp_err_t ret = httpd_resp_send_chunk(req, "retry: 2000\n\n", HTTPD_RESP_USE_STRLEN);
+    if (ret == ESP_OK) {
+        ret = httpd_req_async_handler_begin(req, &async);
+    }
+    attach_request_t attach = { .req = async, .cursor = cursor };
+    if (ret == ESP_OK && xQueueSend(attach_queue, &attach, 0) != pdTRUE) {
+        httpd_req_async_handler_complete(async);
+        ret = ESP_FAIL;
+    }
+    if (ret != ESP_OK) {
+        atomic_fetch_sub(&active_clients, 1);
+        return ret;
+    }
+    uint32_t clients_now = atomic_load(&active_clients);
+    taskENTER_CRITICAL(&stats_lock);
+    stats.clients = clients_now;
+    taskEXIT_CRITICAL(&stats_lock);
+    xTaskNotifyGive(stream_task);
+    return ESP_OK;
+}
+
+void console_stream_get_stats(console_stream_stats_t *out) {
+    taskENTER_CRITICAL(&stats_lock);
+    *out = stats;
+    taskEXIT_CRITICAL(&stats_lock);
+}
@@ -10,6 +10,7 @@
 #include "managers/views/main_menu_screen.h"
 #include "managers/settings_manager.h"
 #include "driver/gpio.h"
+#include "managers/display_mirror.h"
 #ifdef CONFIG_USE_CARDPUTER
 #include "vendor/m5/m5gfx_wrapper.h"
 #include "vendor/keyboard_handler.h"
@@ -54,6 +55,9 @@ lv_obj_t *battery_label = NULL;
 Keyboard_t gkeyboard;
 
 void m5stack_lvgl_render_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p) {
+#ifdef CONFIG_DISPLAY_MIRROR
+    display_mirror_flush(drv, area, color_p);
+#endif
     int32_t x1 = area->x1;
     int32_t y1 = area->y1;
     int32_t x2 = area->x2;
@@ -66,6 +70,13 @@ void m5stack_lvgl_render_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_
 
 #endif
 
+#if defined(CONFIG_DISPLAY_MIRROR) && !defined(CONFIG_USE_CARDPUTER) && !defined(CONFIG_USE_7_INCHER)
+static void mirrored_disp_driver_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p) {
+    display_mirror_flush(drv, area, color_p);
+    disp_driver_flush(drv, area, color_p);
+}
+#endif
+
 
 void fade_out_cb(void *obj, int32_t v) {
     if (obj)
@@ -312,6 +323,8 @@ void display_manager_init(void) {
 
 #ifdef CONFIG_USE_CARDPUTER
     disp_drv.flush_cb = m5stack_lvgl_render_callback;
+#elif defined(CONFIG_DISPLAY_MIRROR)
+    disp_drv.flush_cb = mirrored_disp_driver_flush;
 #else 
     disp_drv.flush_cb = disp_driver_flush;
 #endif
@@ -345,6 +358,12 @@ void display_manager_init(void) {
         return;
     }
 
+#ifdef CONFIG_DISPLAY_MIRROR
+    if (display_mirror_init() != ESP_OK) {
+        printf("Failed to start display mirror\n");
+    }
+#endif
+
 #ifdef CONFIG_USE_CARDPUTER
     keyboard_init(&gkeyboard);
     keyboard_begin(&gkeyboard);
@@ -610,6 +629,9 @@ void lvgl_tick_task(void *arg) {
             }
         }
 
+#ifdef CONFIG_DISPLAY_MIRROR
+        display_mirror_poll();
+#endif
         lv_timer_handler();
         lv_tick_inc(tick_increment);
         vTaskDelay(tick_interval);
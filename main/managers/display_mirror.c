@@ -0,0 +1,215 @@
+#include "managers/display_mirror.h"
+#include "sdkconfig.h"
+
+#ifdef CONFIG_DISPLAY_MIRROR
+
+#include "core/screen_capture.h"
+#include "managers/display_manager.h"
+#include <string.h>
+#include <esp_log.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+#if LV_COLOR_DEPTH != 16
+#error "The display mirror sends RGB565 and needs LV_COLOR_DEPTH 16"
+#endif
+
+static const char* TAG = "Mirror";
+
+typedef struct {
+    httpd_handle_t server;
+    int fd;                  // -1 when free
+    bool needs_hello;
+} client_t;
+
+static client_t clients[DISPLAY_MIRROR_MAX_CLIENTS] = {
+    [0 ... DISPLAY_MIRROR_MAX_CLIENTS - 1] = { .fd = -1 },
+};
+static SemaphoreHandle_t clients_lock;
+
+static esp_err_t send_binary(httpd_handle_t server, int fd, const uint8_t* data, size_t len) {
+    httpd_ws_frame_t frame = {
+        .final = true,
+        .type = HTTPD_WS_TYPE_BINARY,
+        .payload = (uint8_t*)data,
+        .len = len,
+    };
+    return httpd_ws_send_frame_async(server, fd, &frame);
+}
+
+static void drop_client(int fd) {
+    xSemaphoreTake(clients_lock, portMAX_DELAY);
+    for (int i = 0; i < DISPLAY_MIRROR_MAX_CLIENTS; i++) {
+        if (clients[i].fd == fd) {
+            clients[i].fd = -1;
+        }
+    }
+    xSemaphoreGive(clients_lock);
+}
+
+// Copy of the clients still connected; forgets the ones that went away
+static int live_clients(client_t* out) {
+    int count = 0;
+    xSemaphoreTake(clients_lock, portMAX_DELAY);
+    for (int i = 0; i < DISPLAY_MIRROR_MAX_CLIENTS; i++) {
+        client_t* c = &clients[i];
+        if (c->fd < 0) {
+            continue;
+        }
+        if (httpd_ws_get_fd_info(c->server, c->fd) != HTTPD_WS_CLIENT_WEBSOCKET) {
+            c->fd = -1;
+            continue;
+        }
+        out[count++] = *c;
+        c->needs_hello = false;
+    }
+    xSemaphoreGive(clients_lock);
+    return count;
+}
+
+static void mirror_task(void* arg) {
+    const TickType_t period = pdMS_TO_TICKS(1000 / CONFIG_DISPLAY_MIRROR_FPS);
+    TickType_t wake = xTaskGetTickCount();
+    client_t live[DISPLAY_MIRROR_MAX_CLIENTS];
+
+    for (;;) {
+        vTaskDelayUntil(&wake, period);
+        int count = live_clients(live);
+        if (count == 0) {
+            if (screen_capture_running()) {
+                screen_capture_stats_t stats;
+                screen_capture_get_stats(&stats);
+                ESP_LOGI(TAG, "Last viewer left; %lu frames, %llu bytes sent so far", (unsigned long)stats.frames,
+                         (unsigned long long)stats.bytes);
+                screen_capture_stop();
+            }
+            continue;
+        }
+        if (!screen_capture_running() && screen_capture_start() != ESP_OK) {
+            ESP_LOGW(TAG, "No memory for the mirror buffers");
+            continue;
+        }
+
+        for (int i = 0; i < count; i++) {
+            if (live[i].needs_hello) {
+                uint8_t hello[SCREEN_CAPTURE_HELLO_LEN];
+                screen_capture_hello(hello);
+                if (send_binary(live[i].server, live[i].fd, hello, sizeof(hello)) == ESP_OK) {
+                    screen_capture_request_full();
+                }
+            }
+        }
+
+        // Sent from this task rather than queued to the server task, which only writes to these
+        // sockets to answer pings; the frame buffer stays ours until the next take
+        const uint8_t* data;
+        size_t len = screen_capture_take(&data);
+        for (int i = 0; len > 0 && i < count; i++) {
+            if (send_binary(live[i].server, live[i].fd, data, len) != ESP_OK) {
+                ESP_LOGW(TAG, "Dropping viewer on socket %d", live[i].fd);
+                drop_client(live[i].fd);
+                httpd_sess_trigger_close(live[i].server, live[i].fd);
+            }
+        }
+        screen_capture_arm();
+    }
+}
+
+esp_err_t display_mirror_init(void) {
+    clients_lock = xSemaphoreCreateMutex();
+    if (clients_lock == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    screen_capture_init(lv_disp_get_hor_res(NULL), lv_disp_get_ver_res(NULL), CONFIG_DISPLAY_MIRROR_BUFFER_KB * 1024,
+                        LV_COLOR_16_SWAP);
+    // Below the render task, so sending never delays drawing
+    if (xTaskCreate(mirror_task, "DisplayMirror", DISPLAY_MIRROR_TASK_STACK, NULL, tskIDLE_PRIORITY + 3, NULL) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+void display_mirror_flush(lv_disp_drv_t* drv, const lv_area_t* area, const lv_color_t* pixels) {
+    screen_capture_tee(area->x1, area->y1, area->x2, area->y2, (const uint16_t*)pixels, lv_disp_flush_is_last(drv));
+}
+
+void display_mirror_poll(void) {
+    screen_capture_area_t band;
+    while (screen_capture_next_invalidation(&band)) {
+        lv_area_t area = { .x1 = band.x1, .y1 = band.y1, .x2 = band.x2, .y2 = band.y2 };
+        _lv_inv_area(lv_disp_get_default(), &area);
+    }
+}
+
+static esp_err_t add_client(httpd_req_t* req) {
+    int fd = httpd_req_to_sockfd(req);
+    int slot = -1;
+    xSemaphoreTake(clients_lock, portMAX_DELAY);
+    for (int i = 0; i < DISPLAY_MIRROR_MAX_CLIENTS; i++) {
+        if (clients[i].fd == fd || (slot < 0 && clients[i].fd < 0)) {
+            slot = i;
+        }
+    }
+    if (slot >= 0) {
+        clients[slot] = (client_t){ .server = req->handle, .fd = fd, .needs_hello = true };
+    }
+    xSemaphoreGive(clients_lock);
+    if (slot < 0) {
+        ESP_LOGW(TAG, "Already %d viewers; refusing socket %d", DISPLAY_MIRROR_MAX_CLIENTS, fd);
+        return ESP_FAIL;
+    }
+    ESP_LOGI(TAG, "Viewer connected on socket %d", fd);
+    return ESP_OK;
+}
+
+static void queue_input(const uint8_t* msg, size_t len) {
+    InputEvent event;
+    memset(&event, 0, sizeof(event));
+    if (msg[0] == DISPLAY_MIRROR_INPUT_TOUCH && len >= 5) {
+        event.type = INPUT_TYPE_TOUCH;
+        event.data.touch_data.point.x = (lv_coord_t)(msg[1] | msg[2] << 8);
+        event.data.touch_data.point.y = (lv_coord_t)(msg[3] | msg[4] << 8);
+        event.data.touch_data.state = LV_INDEV_STATE_PR;
+    } else if (msg[0] == DISPLAY_MIRROR_INPUT_BUTTON && len >= 2 && msg[1] <= 4) {
+        event.type = INPUT_TYPE_JOYSTICK;
+        event.data.joystick_index = msg[1];
+    } else {
+        return;
+    }
+    if (input_queue == NULL || xQueueSend((QueueHandle_t)input_queue, &event, 0) != pdTRUE) {
+        ESP_LOGW(TAG, "Input queue full; dropped remote input");
+    }
+}
+
+esp_err_t display_mirror_ws_handler(httpd_req_t* req) {
+    if (req->method == HTTP_GET) {
+        // Handshake done
+        return add_client(req);
+    }
+
+    uint8_t msg[8];
+    httpd_ws_frame_t frame = { 0 };
+    esp_err_t ret = httpd_ws_recv_frame(req, &frame, 0);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (frame.len > sizeof(msg)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (frame.len == 0) {
+        return ESP_OK;
+    }
+    frame.payload = msg;
+    ret = httpd_ws_recv_frame(req, &frame, sizeof(msg));
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (frame.type == HTTPD_WS_TYPE_BINARY) {
+        queue_input(msg, frame.len);
+    }
+    return ESP_OK;
+}
+
+#endif // CONFIG_DISPLAY_MIRROR
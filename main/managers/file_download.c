@@ -0,0 +1,600 @@
+#include "managers/file_download.h"
+#include "core/gzip_stream.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_log.h"
+#include "esp_pthread.h"
+#include "esp_heap_caps.h"
+#else
+#define ESP_LOGE(tag, fmt, ...) fprintf(stderr, "E %s: " fmt "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...) fprintf(stderr, "W %s: " fmt "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, fmt, ...) fprintf(stderr, "I %s: " fmt "\n", tag, ##__VA_ARGS__)
+#endif
+
+static const char *TAG = "DOWNLOAD";
+
+#define MIN_CHUNK_SIZE 2048
+#define GZIP_MIN_SIZE 1024              // Not worth a compressor for less
+#define PREFETCH_STACK_SIZE 4096
+
+typedef esp_err_t (*block_sink_fn)(void *ctx, const uint8_t *data, size_t len);
+
+typedef struct {
+    int fd;
+    uint8_t *buf[2];
+    size_t len[2];
+    bool full[2];
+    size_t chunk;
+    uint64_t offset;
+    uint64_t remaining;
+    bool stop;                  // Consumer gave up
+    bool done;                  // Reader exited
+    bool failed;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+} prefetch_t;
+
+typedef struct {
+    file_download_send_fn send_fn;
+    void *ctx;
+} chunked_ctx_t;
+
+typedef struct {
+    char *buf;
+    size_t len;
+    size_t cap;
+} header_buf_t;
+
+static const char *month_names[12] = {
+    "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+static uint8_t *alloc_block(size_t size) {
+#ifdef ESP_PLATFORM
+    // DMA-capable internal RAM lets the SDMMC driver read whole sectors straight into the buffer
+    return heap_caps_malloc(size, MALLOC_CAP_DMA);
+#else
+    return malloc(size);
+#endif
+}
+
+static int64_t days_from_civil(int y, int m, int d) {
+    y -= m <= 2;
+    int era = (y >= 0 ? y : y - 399) / 400;
+    int yoe = y - era * 400;
+    int doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return (int64_t)era * 146097 + doe - 719468;
+}
+
+void file_download_http_date(time_t t, char *out, size_t out_len) {
+    struct tm tm;
+    gmtime_r(&t, &tm);
+    static const char *days[7] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+    snprintf(out, out_len, "%s, %02d %s %04d %02d:%02d:%02d GMT", days[tm.tm_wday], tm.tm_mday,
+             month_names[tm.tm_mon], tm.tm_year + 1900, tm.tm_hour, tm.tm_min, tm.tm_sec);
+}
+
+bool file_download_parse_http_date(const char *str, time_t *out) {
+    char wday[4], mon[4];
+    int day, year, hour, min, sec;
+    if (!str || sscanf(str, "%3s, %d %3s %d %d:%d:%d", wday, &day, mon, &year, &hour, &min, &sec) != 7) {
+        return false;
+    }
+    for (int m = 0; m < 12; m++) {
+        if (strcmp(mon, month_names[m]) == 0) {
+            *out = (time_t)(days_from_civil(year, m + 1, day) * 86400 + hour * 3600 + min * 60 + sec);
+            return true;
+        }
+    }
+    return false;
+}
+
+void file_download_etag(uint64_t size, time_t mtime, char *out, size_t out_len) {
+    snprintf(out, out_len, "\"%llx-%llx\"", (unsigned long long)size, (unsigned long long)mtime);
+}
+
+file_download_range_t file_download_parse_range(const char *header, uint64_t size, uint64_t *first, uint64_t *last) {
+    if (!header || strncmp(header, "bytes=", 6) != 0 || strchr(header, ',') != NULL) {
+        // Multiple ranges are legal to ignore; the client gets the whole file
+        return FILE_DOWNLOAD_RANGE_NONE;
+    }
+    const char *p = header + 6;
+    while (*p == ' ') p++;
+
+    char *end;
+    if (*p == '-') {
+        if (!isdigit((unsigned char)p[1])) {
+            return FILE_DOWNLOAD_RANGE_NONE;
+        }
+        uint64_t suffix = strtoull(p + 1, &end, 10);
+        if (*end != '\0' && *end != ' ') {
+            return FILE_DOWNLOAD_RANGE_NONE;
+        }
+        if (suffix == 0 || size == 0) {
+            return FILE_DOWNLOAD_RANGE_UNSATISFIABLE;
+        }
+        *first = suffix >= size ? 0 : size - suffix;
+        *last = size - 1;
+        return FILE_DOWNLOAD_RANGE_OK;
+    }
+
+    if (!isdigit((unsigned char)*p)) {
+        return FILE_DOWNLOAD_RANGE_NONE;
+    }
+    uint64_t start = strtoull(p, &end, 10);
+    if (*end != '-') {
+        return FILE_DOWNLOAD_RANGE_NONE;
+    }
+    p = end + 1;
+    uint64_t stop = size ? size - 1 : 0;
+    if (isdigit((unsigned char)*p)) {
+        stop = strtoull(p, &end, 10);
+        if (*end != '\0' && *end != ' ') {
+            return FILE_DOWNLOAD_RANGE_NONE;
+        }
+        if (stop < start) {
+            return FILE_DOWNLOAD_RANGE_NONE;
+        }
+    } else if (*p != '\0') {
+        return FILE_DOWNLOAD_RANGE_NONE;
+    }
+
+    if (start >= size) {
+        return FILE_DOWNLOAD_RANGE_UNSATISFIABLE;
+    }
+    *first = start;
+    *last = stop >= size ? size - 1 : stop;
+    return FILE_DOWNLOAD_RANGE_OK;
+}
+
+// If-None-Match uses weak comparison: W/ prefixes are ignored
+bool file_download_etag_matches(const char *list, const char *etag) {
+    size_t etag_len = strlen(etag);
+    const char *p = list;
+    while (*p) {
+        while (*p == ' ' || *p == ',') p++;
+        if (*p == '*') {
+            return true;
+        }
+        if (strncmp(p, "W/", 2) == 0) {
+            p += 2;
+        }
+        const char *start = p;
+        while (*p && *p != ',') p++;
+        const char *stop = p;
+        while (stop > start && stop[-1] == ' ') stop--;
+        if ((size_t)(stop - start) == etag_len && memcmp(start, etag, etag_len) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Weight of one Accept-Encoding entry from just after its name: 1 unless a q parameter says otherwise
+static double coding_weight(const char **pp) {
+    const char *p = *pp;
+    double q = 1.0;
+    while (*p && *p != ',') {
+        if (*p++ != ';') {
+            continue;
+        }
+        while (*p == ' ' || *p == '\t') p++;
+        if ((*p == 'q' || *p == 'Q') && p[1] == '=') {
+            q = strtod(p + 2, NULL);
+        }
+    }
+    *pp = p;
+    return q;
+}
+
+bool file_download_accepts_gzip(const char *accept_encoding) {
+    if (!accept_encoding) {
+        return false;
+    }
+    // An explicit gzip entry wins over "*", whichever comes first
+    double gzip_q = -1.0, any_q = -1.0;
+    const char *p = accept_encoding;
+    while (*p) {
+        while (*p == ' ' || *p == '\t' || *p == ',') p++;
+        const char *name = p;
+        while (*p && *p != ',' && *p != ';' && *p != ' ' && *p != '\t') p++;
+        size_t name_len = p - name;
+        double q = coding_weight(&p);
+        if (name_len == 4 && strncasecmp(name, "gzip", 4) == 0) {
+            gzip_q = q;
+        } else if (name_len == 1 && *name == '*') {
+            any_q = q;
+        }
+    }
+    return gzip_q >= 0.0 ? gzip_q > 0.0 : any_q > 0.0;
+}
+
+static bool is_text_file(const char *path) {
+    const char *ext = strrchr(path, '.');
+    if (!ext) {
+        return false;
+    }
+    return strcasecmp(ext, ".csv") == 0 || strcasecmp(ext, ".json") == 0 || strcasecmp(ext, ".txt") == 0 ||
+           strcasecmp(ext, ".log") == 0 || strcasecmp(ext, ".22000") == 0;
+}
+
+static const char *content_type(const char *path) {
+    const char *ext = strrchr(path, '.');
+    if (!ext) return "application/octet-stream";
+    if (strcasecmp(ext, ".pcap") == 0) return "application/vnd.tcpdump.pcap";
+    if (strcasecmp(ext, ".csv") == 0) return "text/csv";
+    if (strcasecmp(ext, ".json") == 0) return "application/json";
+    if (strcasecmp(ext, ".txt") == 0 || strcasecmp(ext, ".log") == 0) return "text/plain";
+    // Compressed captures are sent as stored; the browser must not undo the compression
+    if (strcasecmp(ext, ".gz") == 0) return "application/gzip";
+    if (strcasecmp(ext, ".lz4") == 0) return "application/x-lz4";
+    return "application/octet-stream";
+}
+
+static void header_add(header_buf_t *h, const char *fmt, ...) {
+    if (h->len >= h->cap) {
+        return;
+    }
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(h->buf + h->len, h->cap - h->len, fmt, args);
+    va_end(args);
+    if (n > 0) {
+        h->len += (size_t)n < h->cap - h->len ? (size_t)n : h->cap - h->len - 1;
+    }
+}
+
+static esp_err_t send_simple(file_download_send_fn send_fn, void *ctx, int status, const char *reason,
+                             const char *message) {
+    char body[96];
+    char head[192];
+    int body_len = snprintf(body, sizeof(body), "{\"error\": \"%s\"}", message);
+    int head_len = snprintf(head, sizeof(head),
+                            "HTTP/1.1 %d %s\r\nContent-Type: application/json\r\nContent-Length: %d\r\n\r\n",
+                            status, reason, body_len);
+    esp_err_t ret = send_fn(ctx, head, head_len);
+    if (ret == ESP_OK) {
+        ret = send_fn(ctx, body, body_len);
+    }
+    return ret;
+}
+
+static ssize_t read_full(int fd, uint8_t *buf, size_t len) {
+    size_t done = 0;
+    while (done < len) {
+        ssize_t n = read(fd, buf + done, len - done);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        if (n == 0) break;
+        done += n;
+    }
+    return done;
+}
+
+// First block ends on a cluster boundary so every later read is aligned and a whole chunk
+static size_t next_block_len(uint64_t offset, uint64_t remaining, size_t chunk) {
+    size_t n = chunk;
+    if (chunk > FILE_DOWNLOAD_ALIGN && offset % FILE_DOWNLOAD_ALIGN) {
+        n = chunk - offset % FILE_DOWNLOAD_ALIGN;
+    }
+    return remaining < n ? (size_t)remaining : n;
+}
+
+static void *prefetch_thread(void *arg) {
+    prefetch_t *pf = arg;
+    int idx = 0;
+
+    while (pf->remaining > 0) {
+        pthread_mutex_lock(&pf->lock);
+        while (pf->full[idx] && !pf->stop) {
+            pthread_cond_wait(&pf->cond, &pf->lock);
+        }
+        bool stop = pf->stop;
+        pthread_mutex_unlock(&pf->lock);
+        if (stop) {
+            break;
+        }
+
+        size_t want = next_block_len(pf->offset, pf->remaining, pf->chunk);
+        ssize_t n = read_full(pf->fd, pf->buf[idx], want);
+
+        pthread_mutex_lock(&pf->lock);
+        if (n != (ssize_t)want) {
+            pf->failed = true;
+        }
+        if (n > 0) {
+            pf->len[idx] = n;
+            pf->full[idx] = true;
+        }
+        pthread_cond_broadcast(&pf->cond);
+        pthread_mutex_unlock(&pf->lock);
+        if (pf->failed) {
+            break;
+        }
+        pf->offset += n;
+        pf->remaining -= n;
+        idx ^= 1;
+    }
+
+    pthread_mutex_lock(&pf->lock);
+    pf->done = true;
+    pthread_cond_broadcast(&pf->cond);
+    pthread_mutex_unlock(&pf->lock);
+    return NULL;
+}
+
+static esp_err_t stream_prefetched(prefetch_t *pf, block_sink_fn sink, void *ctx, uint64_t *read_bytes) {
+    pthread_t thread;
+    pthread_mutex_init(&pf->lock, NULL);
+    pthread_cond_init(&pf->cond, NULL);
+
+#ifdef ESP_PLATFORM
+    esp_pthread_cfg_t cfg = esp_pthread_get_default_config();
+    cfg.stack_size = PREFETCH_STACK_SIZE;
+    cfg.thread_name = "dl_read";
+    esp_pthread_set_cfg(&cfg);
+#endif
+    int rc = pthread_create(&thread, NULL, prefetch_thread, pf);
+#ifdef ESP_PLATFORM
+    cfg = esp_pthread_get_default_config();
+    esp_pthread_set_cfg(&cfg);
+#endif
+    if (rc != 0) {
+        pthread_cond_destroy(&pf->cond);
+        pthread_mutex_destroy(&pf->lock);
+        return ESP_ERR_NO_MEM;
+    }
+
+    esp_err_t ret = ESP_OK;
+    int idx = 0;
+    while (ret == ESP_OK) {
+        pthread_mutex_lock(&pf->lock);
+        while (!pf->full[idx] && !pf->done) {
+            pthread_cond_wait(&pf->cond, &pf->lock);
+        }
+        bool have = pf->full[idx];
+        size_t len = pf->len[idx];
+        pthread_mutex_unlock(&pf->lock);
+        if (!have) {
+            break;
+        }
+
+        ret = sink(ctx, pf->buf[idx], len);
+        *read_bytes += len;
+
+        pthread_mutex_lock(&pf->lock);
+        pf->full[idx] = false;
+        pthread_cond_broadcast(&pf->cond);
+        pthread_mutex_unlock(&pf->lock);
+        idx ^= 1;
+    }
+
+    pthread_mutex_lock(&pf->lock);
+    pf->stop = true;
+    pthread_cond_broadcast(&pf->cond);
+    pthread_mutex_unlock(&pf->lock);
+    pthread_join(thread, NULL);
+    pthread_cond_destroy(&pf->cond);
+    pthread_mutex_destroy(&pf->lock);
+
+    if (ret == ESP_OK && pf->failed) {
+        ret = ESP_FAIL;
+    }
+    return ret;
+}
+
+static esp_err_t stream_file(int fd, uint64_t offset, uint64_t length, size_t chunk, bool prefetch,
+                             block_sink_fn sink, void *ctx, uint64_t *read_bytes) {
+    if (length == 0) {
+        return ESP_OK;
+    }
+    if (lseek(fd, (off_t)offset, SEEK_SET) < 0) {
+        return ESP_FAIL;
+    }
+
+    // Fall back to smaller blocks, then to a single buffer, when RAM is short
+    prefetch_t pf = {.fd = fd, .offset = offset, .remaining = length};
+    size_t min_size = chunk < MIN_CHUNK_SIZE ? chunk : MIN_CHUNK_SIZE;
+    for (size_t size = chunk; size >= min_size; size /= 2) {
+        pf.buf[0] = alloc_block(size);
+        if (!pf.buf[0]) {
+            continue;
+        }
+        pf.buf[1] = prefetch && length > size ? alloc_block(size) : NULL;
+        pf.chunk = size;
+        break;
+    }
+    if (!pf.buf[0]) {
+        ESP_LOGE(TAG, "No memory for a %u byte read buffer", (unsigned)min_size);
+        return ESP_ERR_NO_MEM;
+    }
+
+    esp_err_t ret = ESP_ERR_NO_MEM;
+    if (pf.buf[1]) {
+        ret = stream_prefetched(&pf, sink, ctx, read_bytes);
+    }
+    if (ret == ESP_ERR_NO_MEM) {
+        ret = ESP_OK;
+        while (ret == ESP_OK && pf.remaining > 0) {
+            size_t want = next_block_len(pf.offset, pf.remaining, pf.chunk);
+            ssize_t n = read_full(fd, pf.buf[0], want);
+            if (n != (ssize_t)want) {
+                ret = ESP_FAIL;
+                break;
+            }
+            ret = sink(ctx, pf.buf[0], n);
+            *read_bytes += n;
+            pf.offset += n;
+            pf.remaining -= n;
+        }
+    }
+
+    free(pf.buf[0]);
+    free(pf.buf[1]);
+    return ret;
+}
+
+static esp_err_t identity_sink(void *ctx, const uint8_t *data, size_t len) {
+    chunked_ctx_t *c = ctx;
+    return c->send_fn(c->ctx, (const char *)data, len);
+}
+
+// Compressed blocks go out as HTTP chunks
+static esp_err_t chunked_sink(void *ctx, const uint8_t *data, size_t len) {
+    chunked_ctx_t *c = ctx;
+    char size_line[16];
+    int n = snprintf(size_line, sizeof(size_line), "%x\r\n", (unsigned)len);
+    esp_err_t ret = c->send_fn(c->ctx, size_line, n);
+    if (ret == ESP_OK) ret = c->send_fn(c->ctx, (const char *)data, len);
+    if (ret == ESP_OK) ret = c->send_fn(c->ctx, "\r\n", 2);
+    return ret;
+}
+
+static esp_err_t gzip_sink(void *ctx, const uint8_t *data, size_t len) {
+    return gzip_stream_write((gzip_stream_t *)ctx, data, len);
+}
+
+esp_err_t file_download_serve(const file_download_request_t *req, file_download_send_fn send_fn, void *ctx,
+                              file_download_result_t *result) {
+    file_download_result_t res = {0};
+    esp_err_t ret;
+
+    int fd = open(req->path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        if (fd >= 0) close(fd);
+        res.status = 404;
+        ret = send_simple(send_fn, ctx, 404, "Not Found", "File not found.");
+        if (result) *result = res;
+        return ret;
+    }
+    uint64_t size = st.st_size;
+
+    char etag[FILE_DOWNLOAD_ETAG_LEN];
+    char last_modified[FILE_DOWNLOAD_DATE_LEN];
+    file_download_etag(size, st.st_mtime, etag, sizeof(etag));
+    file_download_http_date(st.st_mtime, last_modified, sizeof(last_modified));
+
+    // A satisfiable Range is served as-is; compression is only applied to whole-file responses
+    uint64_t first = 0, last = size ? size - 1 : 0;
+    file_download_range_t range = FILE_DOWNLOAD_RANGE_NONE;
+    if (req->range) {
+        bool if_range_ok = true;
+        if (req->if_range) {
+            time_t since;
+            if (req->if_range[0] == '"') {
+                if_range_ok = strcmp(req->if_range, etag) == 0;
+            } else {
+                if_range_ok = file_download_parse_http_date(req->if_range, &since) && since == st.st_mtime;
+            }
+        }
+        if (if_range_ok) {
+            range = file_download_parse_range(req->range, size, &first, &last);
+        }
+    }
+
+    res.gzip = FILE_DOWNLOAD_GZIP && range == FILE_DOWNLOAD_RANGE_NONE && size >= GZIP_MIN_SIZE &&
+               is_text_file(req->path) && file_download_accepts_gzip(req->accept_encoding);
+    if (res.gzip) {
+        snprintf(etag + strlen(etag) - 1, sizeof(etag) - strlen(etag) + 1, "-gz\"");
+    }
+
+    bool not_modified = false;
+    if (req->if_none_match) {
+        not_modified = file_download_etag_matches(req->if_none_match, etag);
+    } else if (req->if_modified_since) {
+        time_t since;
+        not_modified = file_download_parse_http_date(req->if_modified_since, &since) && st.st_mtime <= since;
+    }
+
+    char disposition[96];
+    const char *base = strrchr(req->path, '/');
+    base = base ? base + 1 : req->path;
+    size_t d = 0;
+    for (; base[d] && d < sizeof(disposition) - 1; d++) {
+        char c = base[d];
+        disposition[d] = (c == '"' || c == '\\' || (unsigned char)c < 0x20) ? '_' : c;
+    }
+    disposition[d] = '\0';
+
+    char head_buf[512];
+    header_buf_t head = {.buf = head_buf, .cap = sizeof(head_buf)};
+    uint64_t length = last - first + 1;
+
+    if (not_modified) {
+        res.status = 304;
+        header_add(&head, "HTTP/1.1 304 Not Modified\r\n");
+    } else if (range == FILE_DOWNLOAD_RANGE_UNSATISFIABLE) {
+        res.status = 416;
+        header_add(&head, "HTTP/1.1 416 Range Not Satisfiable\r\nContent-Range: bytes */%llu\r\nContent-Length: 0\r\n",
+                   (unsigned long long)size);
+    } else if (range == FILE_DOWNLOAD_RANGE_OK) {
+        res.status = 206;
+        header_add(&head, "HTTP/1.1 206 Partial Content\r\nContent-Range: bytes %llu-%llu/%llu\r\n",
+                   (unsigned long long)first, (unsigned long long)last, (unsigned long long)size);
+    } else {
+        res.status = 200;
+        header_add(&head, "HTTP/1.1 200 OK\r\n");
+        length = size;
+    }
+
+    header_add(&head, "ETag: %s\r\nLast-Modified: %s\r\nCache-Control: no-cache\r\n", etag, last_modified);
+    if (res.status == 200 || res.status == 206) {
+        header_add(&head, "Content-Type: %s\r\nContent-Disposition: attachment; filename=\"%s\"\r\nAccept-Ranges: bytes\r\n",
+                   content_type(req->path), disposition);
+        if (res.gzip) {
+            header_add(&head, "Content-Encoding: gzip\r\nVary: Accept-Encoding\r\nTransfer-Encoding: chunked\r\n");
+        } else {
+            header_add(&head, "Content-Length: %llu\r\n", (unsigned long long)length);
+        }
+    }
+    header_add(&head, "\r\n");
+
+    ret = send_fn(ctx, head.buf, head.len);
+    if (ret != ESP_OK || req->head_only || (res.status != 200 && res.status != 206)) {
+        close(fd);
+        if (result) *result = res;
+        return ret;
+    }
+
+    size_t chunk = req->chunk_size ? req->chunk_size : FILE_DOWNLOAD_CHUNK_SIZE;
+    chunked_ctx_t out = {.send_fn = send_fn, .ctx = ctx};
+    if (res.gzip) {
+        gzip_stream_t *gz = gzip_stream_create(GZIP_STREAM_DEFAULT_LEVEL, chunked_sink, &out);
+        if (!gz) {
+            // Headers already promised gzip; dropping the connection is all that is left
+            ESP_LOGE(TAG, "No memory for the compressor");
+            close(fd);
+            if (result) *result = res;
+            return ESP_ERR_NO_MEM;
+        }
+        ret = stream_file(fd, 0, size, chunk, !req->no_prefetch, gzip_sink, gz, &res.file_bytes);
+        if (ret == ESP_OK) ret = gzip_stream_finish(gz);
+        if (ret == ESP_OK) ret = send_fn(ctx, "0\r\n\r\n", 5);
+        res.body_bytes = gzip_stream_bytes_out(gz);
+        gzip_stream_destroy(gz);
+    } else {
+        ret = stream_file(fd, first, length, chunk, !req->no_prefetch, identity_sink, &out, &res.file_bytes);
+        res.body_bytes = res.file_bytes;
+    }
+    close(fd);
+
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Download of %s stopped after %llu bytes", req->path, (unsigned long long)res.file_bytes);
+    }
+    if (result) *result = res;
+    return ret;
+}
@@ -0,0 +1,197 @@
+#include "managers/http_dispatch.h"
+#include "core/http_metrics.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "sdkconfig.h"
+
+static const char* TAG = "HTTP";
+
+// Sockets left for the DNS server, the printer and DIAL clients; httpd itself keeps three more
+#define RESERVED_SOCKETS 3
+
+typedef struct {
+    esp_err_t (*handler)(httpd_req_t* req);
+    void* user_ctx;
+    int metric;
+    bool async;
+} endpoint_t;
+
+typedef struct {
+    httpd_req_t* req;            // Async copy, owned by the worker
+    endpoint_t* endpoint;
+    int64_t arrived_us;
+} job_t;
+
+static endpoint_t endpoints[HTTP_METRICS_MAX_ENDPOINTS];     // Indexed by metrics slot
+static QueueHandle_t job_queue;
+static SemaphoreHandle_t idle_workers;
+static _Atomic uint32_t workers_busy;
+static _Atomic uint32_t dispatched;
+static _Atomic uint32_t ran_inline;
+static _Atomic uint32_t rejected_busy;
+
+void http_dispatch_config(httpd_config_t* config) {
+    int sockets = CONFIG_LWIP_MAX_SOCKETS - 3 - RESERVED_SOCKETS;
+    if (sockets > config->max_open_sockets) {
+        config->max_open_sockets = sockets;
+    }
+    // A new client takes the socket of the one idle the longest instead of being refused
+    config->lru_purge_enable = true;
+    config->backlog_conn = 8;
+    // Drop connections of clients that went away (left the AP) without closing them
+    config->keep_alive_enable = true;
+    config->keep_alive_idle = 10;
+    config->keep_alive_interval = 5;
+    config->keep_alive_count = 3;
+}
+
+static void worker_main(void* arg) {
+    job_t job;
+    for (;;) {
+        if (xQueueReceive(job_queue, &job, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        atomic_fetch_add(&workers_busy, 1);
+        int64_t start = esp_timer_get_time();
+        httpd_handle_t server = job.req->handle;
+        int fd = httpd_req_to_sockfd(job.req);
+
+        job.req->user_ctx = job.endpoint->user_ctx;
+        esp_err_t ret = job.endpoint->handler(job.req);
+        httpd_req_async_handler_complete(job.req);
+        if (ret != ESP_OK) {
+            // As for a failing handler on the server task: the connection is closed
+            httpd_sess_trigger_close(server, fd);
+        }
+
+        int64_t end = esp_timer_get_time();
+        http_metrics_end(job.endpoint->metric, (uint32_t)(end - job.arrived_us), (uint32_t)(start - job.arrived_us),
+                         ret == ESP_OK);
+        atomic_fetch_sub(&workers_busy, 1);
+        xSemaphoreGive(idle_workers);
+    }
+}
+
+esp_err_t http_dispatch_start(void) {
+    if (job_queue != NULL) {
+        return ESP_OK;
+    }
+    QueueHandle_t queue = xQueueCreate(HTTP_DISPATCH_QUEUE_LEN, sizeof(job_t));
+    SemaphoreHandle_t idle = xSemaphoreCreateCounting(HTTP_DISPATCH_WORKERS, 0);
+    if (queue == NULL || idle == NULL) {
+        ESP_LOGE(TAG, "Could not create the worker queue");
+        if (queue != NULL) vQueueDelete(queue);
+        if (idle != NULL) vSemaphoreDelete(idle);
+        return ESP_ERR_NO_MEM;
+    }
+    job_queue = queue;
+    int started = 0;
+    for (int i = 0; i < HTTP_DISPATCH_WORKERS; i++) {
+        char name[16];
+        snprintf(name, sizeof(name), "httpd_worker%d", i);
+        // Below the server task, so the API keeps answering while workers stream
+        if (xTaskCreate(worker_main, name, HTTP_DISPATCH_WORKER_STACK, NULL, tskIDLE_PRIORITY + 4, NULL) != pdPASS) {
+            ESP_LOGW(TAG, "Started %d of %d workers", i, HTTP_DISPATCH_WORKERS);
+            break;
+        }
+        xSemaphoreGive(idle);
+        started++;
+    }
+    if (started == 0) {
+        // Without a worker every async request would be turned away; leave them on the server task
+        job_queue = NULL;
+        vQueueDelete(queue);
+        vSemaphoreDelete(idle);
+        return ESP_ERR_NO_MEM;
+    }
+    // Published last: dispatch_handler hands requests to workers once it sees this
+    idle_workers = idle;
+    return ESP_OK;
+}
+
+// Every worker is taken: answer 503 right away rather than run a long transfer on the server task
+static esp_err_t reject_busy(httpd_req_t* req, endpoint_t* endpoint) {
+    atomic_fetch_add(&rejected_busy, 1);
+    http_metrics_rejected(endpoint->metric);
+    httpd_resp_set_status(req, "503 Service Unavailable");
+    httpd_resp_set_hdr(req, "Retry-After", "1");
+    httpd_resp_set_type(req, "application/json");
+    if (req->content_len == 0) {
+        httpd_resp_sendstr(req, "{\"status\":\"busy\"}");
+        return ESP_OK;
+    }
+    // httpd would read and discard an unread body (an upload, an image) on the server task; close the
+    // connection instead
+    httpd_resp_set_hdr(req, "Connection", "close");
+    httpd_resp_sendstr(req, "{\"status\":\"busy\"}");
+    return ESP_FAIL;
+}
+
+static esp_err_t dispatch_handler(httpd_req_t* req) {
+    endpoint_t* endpoint = req->user_ctx;
+    int64_t arrived = esp_timer_get_time();
+    http_metrics_begin(endpoint->metric);
+
+    if (endpoint->async && idle_workers != NULL) {
+        // Only take a worker that is free now; waiting for one would hold up the server task anyway
+        if (xSemaphoreTake(idle_workers, 0) != pdTRUE) {
+            return reject_busy(req, endpoint);
+        }
+        job_t job = { .endpoint = endpoint, .arrived_us = arrived };
+        if (httpd_req_async_handler_begin(req, &job.req) != ESP_OK) {
+            xSemaphoreGive(idle_workers);
+            return reject_busy(req, endpoint);
+        }
+        if (xQueueSend(job_queue, &job, 0) != pdTRUE) {
+            httpd_req_async_handler_complete(job.req);
+            xSemaphoreGive(idle_workers);
+            return reject_busy(req, endpoint);
+        }
+        atomic_fetch_add(&dispatched, 1);
+        return ESP_OK;
+    }
+
+    // Workers not started (http_dispatch_start failed): async endpoints run here as before
+    if (endpoint->async) {
+        atomic_fetch_add(&ran_inline, 1);
+    }
+    req->user_ctx = endpoint->user_ctx;
+    esp_err_t ret = endpoint->handler(req);
+    http_metrics_end(endpoint->metric, (uint32_t)(esp_timer_get_time() - arrived), 0, ret == ESP_OK);
+    return ret;
+}
+
+esp_err_t http_dispatch_register(httpd_handle_t server, const httpd_uri_t* uri, uint32_t flags) {
+    bool async = (flags & HTTP_DISPATCH_ASYNC) != 0;
+    int metric = http_metrics_endpoint(http_method_str(uri->method), uri->uri, async);
+    if (metric < 0) {
+        ESP_LOGW(TAG, "No metrics slot left for %s; registered untimed", uri->uri);
+        return httpd_register_uri_handler(server, uri);
+    }
+
+    endpoint_t* endpoint = &endpoints[metric];
+    endpoint->handler = uri->handler;
+    endpoint->user_ctx = uri->user_ctx;
+    endpoint->metric = metric;
+    endpoint->async = async;
+
+    httpd_uri_t wrapped = *uri;
+    wrapped.handler = dispatch_handler;
+    wrapped.user_ctx = endpoint;
+    return httpd_register_uri_handler(server, &wrapped);
+}
+
+void http_dispatch_get_stats(http_dispatch_stats_t* out) {
+    out->workers_busy = atomic_load(&workers_busy);
+    out->queued = job_queue != NULL ? (uint32_t)uxQueueMessagesWaiting(job_queue) : 0;
+    out->dispatched = atomic_load(&dispatched);
+    out->ran_inline = atomic_load(&ran_inline);
+    out->rejected_busy = atomic_load(&rejected_busy);
+}
@@ -0,0 +1,350 @@
+#include "managers/ota_manager.h"
+#include <string.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <esp_log.h>
+#include <esp_ota_ops.h>
+#include <esp_app_desc.h>
+#include <esp_app_format.h>
+#include <esp_partition.h>
+#include <esp_system.h>
+#include <esp_timer.h>
+#include <esp_heap_caps.h>
+#include <mbedtls/sha256.h>
+#ifdef CONFIG_OTA_REQUIRE_SIGNATURE
+#include <mbedtls/pk.h>
+#endif
+#include "sdkconfig.h"
+
+static const char* TAG = "OTA";
+
+#ifdef CONFIG_OTA_REQUIRE_SIGNATURE
+// Embedded from ota_signing_key.pem in the project root (main/CMakeLists.txt), NUL-terminated
+extern const char ota_signing_key_pem_start[] asm("_binary_ota_signing_key_pem_start");
+extern const char ota_signing_key_pem_end[] asm("_binary_ota_signing_key_pem_end");
+#endif
+
+// Enough of the image to check it before anything is written: image header, first segment header, app description
+#define HEAD_LEN (sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t) + sizeof(esp_app_desc_t))
+
+static struct {
+    ota_status_t status;
+    const esp_partition_t* target;
+    esp_ota_handle_t handle;
+    mbedtls_sha256_context sha;
+    uint8_t expected[OTA_SHA256_LEN];
+    uint8_t signature[OTA_MAX_SIGNATURE_LEN];
+    size_t signature_len;
+    uint8_t head[HEAD_LEN];
+    size_t head_len;
+    esp_timer_handle_t restart_timer;
+    esp_timer_handle_t confirm_timer;
+} ota;
+
+// Uploads are handled on the async HTTP workers, so two can arrive at once; the lock makes the
+// check-and-claim in begin atomic and keeps status reads away from a running update
+static pthread_mutex_t ota_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void fail(const char* reason) {
+    ESP_LOGE(TAG, "Update failed: %s", reason);
+    ota.status.state = OTA_STATE_FAILED;
+    snprintf(ota.status.error, sizeof(ota.status.error), "%s", reason);
+}
+
+// Drop the handle and hash of a running update
+static void release(void) {
+    if (ota.handle != 0) {
+        esp_ota_abort(ota.handle);
+        ota.handle = 0;
+    }
+    mbedtls_sha256_free(&ota.sha);
+}
+
+static esp_err_t begin_locked(size_t image_size, const uint8_t* sha256, const uint8_t* signature, size_t signature_len) {
+    if (ota.status.state == OTA_STATE_RECEIVING) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (sha256 == NULL) {
+        fail("SHA-256 of the image required");
+        return ESP_ERR_INVALID_ARG;
+    }
+#ifdef CONFIG_OTA_REQUIRE_SIGNATURE
+    if (signature == NULL || signature_len == 0) {
+        fail("signature required");
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+#endif
+    if (signature_len > sizeof(ota.signature)) {
+        fail("signature too long");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    ota.target = esp_ota_get_next_update_partition(NULL);
+    if (ota.target == NULL) {
+        fail("no update slot in the partition table");
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (image_size < HEAD_LEN || image_size > ota.target->size) {
+        fail("image does not fit the update slot");
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    // Sequential writes erase each sector just before it is written, so the first receive is not held
+    // up behind erasing the whole slot
+    esp_err_t err = esp_ota_begin(ota.target, OTA_WITH_SEQUENTIAL_WRITES, &ota.handle);
+    if (err != ESP_OK) {
+        ota.handle = 0;
+        fail("could not open the update slot");
+        return err;
+    }
+
+    mbedtls_sha256_init(&ota.sha);
+    mbedtls_sha256_starts(&ota.sha, 0);
+    memcpy(ota.expected, sha256, OTA_SHA256_LEN);
+    ota.signature_len = signature_len;
+    if (signature_len > 0) {
+        memcpy(ota.signature, signature, signature_len);
+    }
+    ota.head_len = 0;
+    ota.status.state = OTA_STATE_RECEIVING;
+    ota.status.received = 0;
+    ota.status.total = (uint32_t)image_size;
+    ota.status.error[0] = '\0';
+    ota.status.new_version[0] = '\0';
+    ESP_LOGI(TAG, "Receiving %u byte image into %s", (unsigned)image_size, ota.target->label);
+    return ESP_OK;
+}
+
+esp_err_t ota_manager_begin(size_t image_size, const uint8_t* sha256, const uint8_t* signature, size_t signature_len) {
+    pthread_mutex_lock(&ota_lock);
+    esp_err_t err = begin_locked(image_size, sha256, signature, signature_len);
+    pthread_mutex_unlock(&ota_lock);
+    return err;
+}
+
+static esp_err_t check_head(void) {
+    const esp_image_header_t* image = (const esp_image_header_t*)ota.head;
+    const esp_app_desc_t* app =
+        (const esp_app_desc_t*)(ota.head + sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t));
+    if (image->magic != ESP_IMAGE_HEADER_MAGIC || app->magic_word != ESP_APP_DESC_MAGIC_WORD) {
+        fail("not an application image");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (image->chip_id != CONFIG_IDF_FIRMWARE_CHIP_ID) {
+        fail("image is built for another chip");
+        return ESP_ERR_INVALID_ARG;
+    }
+    snprintf(ota.status.new_version, sizeof(ota.status.new_version), "%.*s", (int)sizeof(app->version), app->version);
+    ESP_LOGI(TAG, "Image %.*s version %s", (int)sizeof(app->project_name), app->project_name, ota.status.new_version);
+    return ESP_OK;
+}
+
+static esp_err_t write_locked(const void* data, size_t len) {
+    if (ota.status.state != OTA_STATE_RECEIVING) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (len > ota.status.total - ota.status.received) {
+        release();
+        fail("more data than announced");
+        return ESP_ERR_INVALID_ARG;
+    }
+    const uint8_t* p = data;
+    mbedtls_sha256_update(&ota.sha, p, len);
+    ota.status.received += (uint32_t)len;
+
+    // Hold the first bytes back until the header has been checked
+    if (ota.head_len < HEAD_LEN) {
+        size_t n = HEAD_LEN - ota.head_len < len ? HEAD_LEN - ota.head_len : len;
+        memcpy(ota.head + ota.head_len, p, n);
+        ota.head_len += n;
+        p += n;
+        len -= n;
+        if (ota.head_len < HEAD_LEN) {
+            return ESP_OK;
+        }
+        esp_err_t err = check_head();
+        if (err == ESP_OK) {
+            err = esp_ota_write(ota.handle, ota.head, HEAD_LEN);
+        }
+        if (err != ESP_OK) {
+            release();
+            if (ota.status.state != OTA_STATE_FAILED) {
+                fail("flash write failed");
+            }
+            return err;
+        }
+    }
+
+    if (len > 0) {
+        esp_err_t err = esp_ota_write(ota.handle, p, len);
+        if (err != ESP_OK) {
+            release();
+            fail("flash write failed");
+            return err;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t ota_manager_write(const void* data, size_t len) {
+    pthread_mutex_lock(&ota_lock);
+    esp_err_t err = write_locked(data, len);
+    pthread_mutex_unlock(&ota_lock);
+    return err;
+}
+
+#ifdef CONFIG_OTA_REQUIRE_SIGNATURE
+static bool signature_ok(const uint8_t* digest) {
+    mbedtls_pk_context pk;
+    mbedtls_pk_init(&pk);
+    int rc = mbedtls_pk_parse_public_key(&pk, (const unsigned char*)ota_signing_key_pem_start,
+                                         ota_signing_key_pem_end - ota_signing_key_pem_start);
+    if (rc == 0) {
+        rc = mbedtls_pk_verify(&pk, MBEDTLS_MD_SHA256, digest, OTA_SHA256_LEN, ota.signature, ota.signature_len);
+    } else {
+        ESP_LOGE(TAG, "Built-in signing key does not parse (-0x%x)", -rc);
+    }
+    mbedtls_pk_free(&pk);
+    return rc == 0;
+}
+#endif
+
+static esp_err_t finish_locked(void) {
+    if (ota.status.state != OTA_STATE_RECEIVING) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (ota.status.received != ota.status.total) {
+        release();
+        fail("image is incomplete");
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    uint8_t digest[OTA_SHA256_LEN];
+    mbedtls_sha256_finish(&ota.sha, digest);
+    memcpy(ota.status.sha256, digest, sizeof(digest));
+    if (memcmp(digest, ota.expected, sizeof(digest)) != 0) {
+        release();
+        fail("SHA-256 does not match");
+        return ESP_ERR_INVALID_CRC;
+    }
+#ifdef CONFIG_OTA_REQUIRE_SIGNATURE
+    if (!signature_ok(digest)) {
+        release();
+        fail("signature check failed");
+        return ESP_ERR_NOT_ALLOWED;
+    }
+#endif
+
+    // Checks every segment and the digest appended by the build
+    esp_err_t err = esp_ota_end(ota.handle);
+    ota.handle = 0;
+    mbedtls_sha256_free(&ota.sha);
+    if (err != ESP_OK) {
+        fail(err == ESP_ERR_OTA_VALIDATE_FAILED ? "image failed validation" : "could not close the update slot");
+        return err;
+    }
+    err = esp_ota_set_boot_partition(ota.target);
+    if (err != ESP_OK) {
+        fail("could not select the new image");
+        return err;
+    }
+    ota.status.state = OTA_STATE_READY;
+    ESP_LOGI(TAG, "Version %s stored in %s; it runs after the next restart", ota.status.new_version, ota.target->label);
+    return ESP_OK;
+}
+
+esp_err_t ota_manager_finish(void) {
+    pthread_mutex_lock(&ota_lock);
+    esp_err_t err = finish_locked();
+    pthread_mutex_unlock(&ota_lock);
+    return err;
+}
+
+void ota_manager_abort(const char* reason) {
+    pthread_mutex_lock(&ota_lock);
+    if (ota.status.state == OTA_STATE_RECEIVING) {
+        release();
+        fail(reason);
+    }
+    pthread_mutex_unlock(&ota_lock);
+}
+
+static void restart_cb(void* arg) {
+    esp_restart();
+}
+
+void ota_manager_restart_after(uint32_t delay_ms) {
+    if (ota.restart_timer == NULL) {
+        const esp_timer_create_args_t args = { .callback = restart_cb, .name = "ota_restart" };
+        if (esp_timer_create(&args, &ota.restart_timer) != ESP_OK) {
+            esp_restart();
+        }
+    }
+    esp_timer_stop(ota.restart_timer);
+    esp_timer_start_once(ota.restart_timer, (uint64_t)delay_ms * 1000);
+}
+
+static void confirm_cb(void* arg) {
+    if (esp_ota_mark_app_valid_cancel_rollback() == ESP_OK) {
+        pthread_mutex_lock(&ota_lock);
+        ota.status.pending_verify = false;
+        ESP_LOGI(TAG, "Image %s confirmed", ota.status.version);
+        pthread_mutex_unlock(&ota_lock);
+    }
+}
+
+void ota_manager_boot_check(bool web_server_ok) {
+    const esp_partition_t* running = esp_ota_get_running_partition();
+    esp_ota_img_states_t state;
+    if (running == NULL || esp_ota_get_state_partition(running, &state) != ESP_OK ||
+        state != ESP_OTA_IMG_PENDING_VERIFY) {
+        return;
+    }
+
+    // The web server is how the next update arrives, so an image without it must not stay
+    size_t free_heap = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    if (!web_server_ok || free_heap < OTA_MIN_FREE_HEAP) {
+        ESP_LOGE(TAG, "Self-test failed (web server %s, %u bytes free); rolling back",
+                 web_server_ok ? "up" : "down", (unsigned)free_heap);
+        esp_ota_mark_app_invalid_rollback_and_reboot();
+        return;
+    }
+
+    // A crash or reset before this fires also rolls back
+    pthread_mutex_lock(&ota_lock);
+    ota.status.pending_verify = true;
+    pthread_mutex_unlock(&ota_lock);
+    const esp_timer_create_args_t args = { .callback = confirm_cb, .name = "ota_confirm" };
+    if (esp_timer_create(&args, &ota.confirm_timer) != ESP_OK ||
+        esp_timer_start_once(ota.confirm_timer, (uint64_t)OTA_CONFIRM_DELAY_MS * 1000) != ESP_OK) {
+        confirm_cb(NULL);
+        return;
+    }
+    ESP_LOGI(TAG, "Self-test passed; confirming in %d s", OTA_CONFIRM_DELAY_MS / 1000);
+}
+
+void ota_manager_get_status(ota_status_t* out) {
+    pthread_mutex_lock(&ota_lock);
+    const esp_app_desc_t* app = esp_app_get_description();
+    snprintf(ota.status.version, sizeof(ota.status.version), "%.*s", (int)sizeof(app->version), app->version);
+
+    const esp_partition_t* running = esp_ota_get_running_partition();
+    snprintf(ota.status.partition, sizeof(ota.status.partition), "%s", running ? running->label : "");
+
+    const esp_partition_t* next = esp_ota_get_next_update_partition(NULL);
+    ota.status.slot_size = next ? (uint32_t)next->size : 0;
+
+    ota.status.rolled_back_version[0] = '\0';
+    const esp_partition_t* invalid = esp_ota_get_last_invalid_partition();
+    esp_app_desc_t desc;
+    if (invalid != NULL && esp_ota_get_partition_description(invalid, &desc) == ESP_OK) {
+        snprintf(ota.status.rolled_back_version, sizeof(ota.status.rolled_back_version), "%.*s",
+                 (int)sizeof(desc.version), desc.version);
+    }
+
+#ifdef CONFIG_OTA_REQUIRE_SIGNATURE
+    ota.status.signature_required = true;
+#endif
+    *out = ota.status;
+    pthread_mutex_unlock(&ota_lock);
+}
@@ -0,0 +1,511 @@
+#include "managers/pcap_sidecar.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#define SIDECAR_MAGIC "GIDX"
+#define SIDECAR_VERSION 1
+#define SIDECAR_HEADER_LEN 16
+#define BLOCK_ENTRY_LEN 44           // 'K' entry without its id list
+#define BSSID_ENTRY_LEN 9
+#define END_ENTRY_LEN 17
+#define PENDING_SIZE 2048            // Entries waiting for room in the SD writer
+#define SLOT_COUNT (2 * PCAP_SIDECAR_MAX_BSSIDS)
+
+#define BLOCK_FLAG_ID_OVERFLOW 0x01  // Some BSSIDs in the block are not listed
+#define BLOCK_FLAG_UNTRACKED 0x02    // Holds BSSIDs seen after the id table filled up
+
+#define PCAP_MAGIC 0xa1b2c3d4u
+#define PCAP_GLOBAL_HEADER_LEN 24
+#define PCAP_RECORD_HEADER_LEN 16
+#define PCAP_MAX_RECORD 65535
+
+struct pcap_sidecar_writer {
+    sd_writer_stream_t *stream;
+    char path[192];
+    bool failed;
+    size_t pending_len;
+    uint8_t pending[PENDING_SIZE];
+
+    bool block_open;
+    uint32_t block_seq;              // Number of the open block, from 1
+    uint64_t offset;
+    uint32_t length;
+    uint32_t records;
+    uint32_t first_sec, first_usec, last_sec, last_usec;
+    uint64_t type_mask;
+    uint8_t flags;
+    uint16_t id_count;
+    uint16_t ids[PCAP_SIDECAR_BLOCK_IDS];
+
+    uint32_t blocks;
+    uint64_t records_total;
+    uint16_t bssid_count;
+    uint16_t slots[SLOT_COUNT];      // id + 1, 0 when free
+    struct {
+        uint8_t mac[6];
+        uint32_t last_block;         // Block the id was last listed in
+    } bssids[PCAP_SIDECAR_MAX_BSSIDS];
+};
+
+static void put_le(uint8_t *p, uint64_t v, int bytes) {
+    for (int i = 0; i < bytes; i++) {
+        p[i] = (uint8_t)(v >> (8 * i));
+    }
+}
+
+static uint64_t get_le(const uint8_t *p, int bytes) {
+    uint64_t v = 0;
+    for (int i = 0; i < bytes; i++) {
+        v |= (uint64_t)p[i] << (8 * i);
+    }
+    return v;
+}
+
+// Reserve len bytes of pending output; NULL (and the sidecar given up) when the writer fell too far behind
+static uint8_t *pending_reserve(pcap_sidecar_writer_t *w, size_t len) {
+    if (w->pending_len + len > sizeof(w->pending)) {
+        w->failed = true;
+        return NULL;
+    }
+    uint8_t *p = w->pending + w->pending_len;
+    w->pending_len += len;
+    return p;
+}
+
+static void pending_flush(pcap_sidecar_writer_t *w, uint32_t timeout_ms) {
+    if (w->pending_len > 0 && sd_writer_write(w->stream, w->pending, w->pending_len, timeout_ms) == ESP_OK) {
+        w->pending_len = 0;
+    }
+}
+
+pcap_sidecar_writer_t *pcap_sidecar_open(const char *pcap_path) {
+    pcap_sidecar_writer_t *w = calloc(1, sizeof(*w));
+    if (w == NULL) {
+        return NULL;
+    }
+    int n = snprintf(w->path, sizeof(w->path), "%s%s", pcap_path, PCAP_SIDECAR_SUFFIX);
+    if (n < 0 || (size_t)n >= sizeof(w->path)) {
+        free(w);
+        return NULL;
+    }
+
+    // Small entries; the writer still coalesces them into cluster-sized writes
+    sd_writer_stream_config_t config = { .sync_on_close = true };
+    w->stream = sd_writer_open(w->path, "w", &config);
+    if (w->stream == NULL) {
+        free(w);
+        return NULL;
+    }
+
+    uint8_t *p = pending_reserve(w, SIDECAR_HEADER_LEN);
+    memcpy(p, SIDECAR_MAGIC, 4);
+    put_le(p + 4, SIDECAR_VERSION, 2);
+    put_le(p + 6, 0, 2);
+    put_le(p + 8, PCAP_SIDECAR_BLOCK_BYTES, 4);
+    put_le(p + 12, PCAP_SIDECAR_BLOCK_MS, 4);
+    return w;
+}
+
+static void close_block(pcap_sidecar_writer_t *w) {
+    if (!w->block_open) {
+        return;
+    }
+    w->block_open = false;
+    w->blocks++;
+
+    uint8_t *p = pending_reserve(w, BLOCK_ENTRY_LEN + 2 * (size_t)w->id_count);
+    if (p == NULL) {
+        return;
+    }
+    p[0] = 'K';
+    put_le(p + 1, w->offset, 8);
+    put_le(p + 9, w->length, 4);
+    put_le(p + 13, w->records, 4);
+    put_le(p + 17, w->first_sec, 4);
+    put_le(p + 21, w->first_usec, 4);
+    put_le(p + 25, w->last_sec, 4);
+    put_le(p + 29, w->last_usec, 4);
+    put_le(p + 33, w->type_mask, 8);
+    p[41] = w->flags;
+    put_le(p + 42, w->id_count, 2);
+    for (uint16_t i = 0; i < w->id_count; i++) {
+        put_le(p + 44 + 2 * i, w->ids[i], 2);
+    }
+    pending_flush(w, 0);
+}
+
+// Id of a BSSID, defining it on first sight; -1 once the table is full
+static int bssid_id(pcap_sidecar_writer_t *w, const uint8_t *mac) {
+    uint32_t h = 2166136261u;
+    for (int i = 0; i < 6; i++) {
+        h = (h ^ mac[i]) * 16777619u;
+    }
+    for (uint32_t probe = 0; probe < SLOT_COUNT; probe++) {
+        uint32_t slot = (h + probe) % SLOT_COUNT;
+        uint16_t v = w->slots[slot];
+        if (v == 0) {
+            if (w->bssid_count >= PCAP_SIDECAR_MAX_BSSIDS) {
+                return -1;
+            }
+            uint16_t id = w->bssid_count;
+            uint8_t *p = pending_reserve(w, BSSID_ENTRY_LEN);
+            if (p == NULL) {
+                return -1;
+            }
+            p[0] = 'B';
+            put_le(p + 1, id, 2);
+            memcpy(p + 3, mac, 6);
+            memcpy(w->bssids[id].mac, mac, 6);
+            w->bssids[id].last_block = 0;
+            w->bssid_count++;
+            w->slots[slot] = id + 1;
+            return id;
+        }
+        if (memcmp(w->bssids[v - 1].mac, mac, 6) == 0) {
+            return v - 1;
+        }
+    }
+    return -1;
+}
+
+void pcap_sidecar_add(pcap_sidecar_writer_t *w, uint64_t offset, uint32_t ts_sec, uint32_t ts_usec,
+                      const uint8_t *frame, size_t frame_len, size_t record_len) {
+    if (w == NULL || w->failed) {
+        return;
+    }
+
+    if (w->block_open) {
+        int64_t span_us = ((int64_t)ts_sec - w->first_sec) * 1000000 + ((int64_t)ts_usec - w->first_usec);
+        if (w->length + record_len > PCAP_SIDECAR_BLOCK_BYTES || span_us >= (int64_t)PCAP_SIDECAR_BLOCK_MS * 1000 ||
+            offset != w->offset + w->length) {
+            close_block(w);
+        }
+    }
+    if (!w->block_open) {
+        w->block_open = true;
+        w->block_seq++;
+        w->offset = offset;
+        w->length = 0;
+        w->records = 0;
+        w->first_sec = ts_sec;
+        w->first_usec = ts_usec;
+        w->type_mask = 0;
+        w->flags = 0;
+        w->id_count = 0;
+    }
+
+    if (frame_len >= 2) {
+        uint8_t type = (frame[0] >> 2) & 0x3;
+        if (type < 3) {
+            w->type_mask |= PCAP_TYPE_BIT(type, frame[0] >> 4);
+        }
+    }
+    const uint8_t *bssid = pcap_frame_bssid(frame, frame_len);
+    if (bssid != NULL) {
+        int id = bssid_id(w, bssid);
+        if (id < 0) {
+            w->flags |= BLOCK_FLAG_UNTRACKED;
+        } else if (w->bssids[id].last_block != w->block_seq) {
+            w->bssids[id].last_block = w->block_seq;
+            if (w->id_count < PCAP_SIDECAR_BLOCK_IDS) {
+                w->ids[w->id_count++] = (uint16_t)id;
+            } else {
+                w->flags |= BLOCK_FLAG_ID_OVERFLOW;
+            }
+        }
+    }
+
+    w->length += (uint32_t)record_len;
+    w->records++;
+    w->records_total++;
+    w->last_sec = ts_sec;
+    w->last_usec = ts_usec;
+}
+
+void pcap_sidecar_close(pcap_sidecar_writer_t *w) {
+    if (w == NULL) {
+        return;
+    }
+    close_block(w);
+    uint8_t *p = pending_reserve(w, END_ENTRY_LEN);
+    if (p != NULL) {
+        p[0] = 'E';
+        put_le(p + 1, w->blocks, 4);
+        put_le(p + 5, w->bssid_count, 4);
+        put_le(p + 9, w->records_total, 8);
+    }
+    pending_flush(w, 1000);
+    bool complete = !w->failed && w->pending_len == 0;
+    sd_writer_close(w->stream);
+    if (!complete) {
+        unlink(w->path);
+    }
+    free(w);
+}
+
+bool pcap_filter_parse_bssid(const char *text, uint8_t bssid[6]) {
+    unsigned int b[6];
+    if (text == NULL || sscanf(text, "%2x:%2x:%2x:%2x:%2x:%2x", &b[0], &b[1], &b[2], &b[3], &b[4], &b[5]) != 6) {
+        return false;
+    }
+    for (int i = 0; i < 6; i++) {
+        bssid[i] = (uint8_t)b[i];
+    }
+    return true;
+}
+
+bool pcap_filter_parse_types(const char *text, uint64_t *mask) {
+    static const struct {
+        const char *name;
+        uint64_t mask;
+    } names[] = {
+        {"mgmt", PCAP_TYPE_MGMT},
+        {"ctrl", PCAP_TYPE_CTRL},
+        {"data", PCAP_TYPE_DATA},
+        {"beacon", PCAP_TYPE_BIT(0, 8)},
+        {"probe", PCAP_TYPE_BIT(0, 4) | PCAP_TYPE_BIT(0, 5)},
+        {"probereq", PCAP_TYPE_BIT(0, 4)},
+        {"proberesp", PCAP_TYPE_BIT(0, 5)},
+        {"auth", PCAP_TYPE_BIT(0, 11)},
+        {"deauth", PCAP_TYPE_BIT(0, 12)},
+        {"assoc", PCAP_TYPE_BIT(0, 0) | PCAP_TYPE_BIT(0, 1) | PCAP_TYPE_BIT(0, 2) | PCAP_TYPE_BIT(0, 3)},
+        {"disassoc", PCAP_TYPE_BIT(0, 10)},
+        {"action", PCAP_TYPE_BIT(0, 13)},
+    };
+
+    *mask = 0;
+    const char *p = text;
+    while (p != NULL && *p) {
+        const char *end = strchr(p, ',');
+        size_t len = end ? (size_t)(end - p) : strlen(p);
+        bool found = false;
+        for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+            if (strlen(names[i].name) == len && strncasecmp(p, names[i].name, len) == 0) {
+                *mask |= names[i].mask;
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            return false;
+        }
+        p = end ? end + 1 : NULL;
+    }
+    return true;
+}
+
+const uint8_t *pcap_frame_bssid(const uint8_t *frame, size_t len) {
+    if (len < 24) {
+        return NULL;
+    }
+    uint8_t type = (frame[0] >> 2) & 0x3;
+    if (type == 0) {
+        return frame + 16;
+    }
+    if (type != 2) {
+        return NULL;
+    }
+    switch (frame[1] & 0x3) {
+        case 0: return frame + 16;   // IBSS / direct link
+        case 1: return frame + 4;    // To the AP
+        case 2: return frame + 10;   // From the AP
+        default: return NULL;        // WDS
+    }
+}
+
+bool pcap_filter_match(const pcap_filter_t *filter, const uint8_t *frame, size_t len, uint32_t ts_sec) {
+    if ((filter->from_sec && ts_sec < filter->from_sec) || (filter->to_sec && ts_sec > filter->to_sec)) {
+        return false;
+    }
+    if (filter->type_mask) {
+        uint8_t type = len >= 1 ? (frame[0] >> 2) & 0x3 : 3;
+        if (type == 3 || !(filter->type_mask & PCAP_TYPE_BIT(type, frame[0] >> 4))) {
+            return false;
+        }
+    }
+    if (filter->has_bssid) {
+        const uint8_t *bssid = pcap_frame_bssid(frame, len);
+        if (bssid == NULL || memcmp(bssid, filter->bssid, 6) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+typedef struct {
+    FILE *pcap;
+    uint8_t *record;
+    size_t record_cap;
+    const pcap_filter_t *filter;
+    pcap_extract_write_fn write_fn;
+    void *ctx;
+    pcap_extract_stats_t *stats;
+} extract_t;
+
+// Copy the matching records in [start, end) of the pcap; stops early at a torn record
+static esp_err_t scan_range(extract_t *x, uint64_t start, uint64_t end) {
+    if (fseek(x->pcap, (long)start, SEEK_SET) != 0) {
+        return ESP_FAIL;
+    }
+    uint64_t pos = start;
+    while (pos + PCAP_RECORD_HEADER_LEN <= end) {
+        if (fread(x->record, 1, PCAP_RECORD_HEADER_LEN, x->pcap) != PCAP_RECORD_HEADER_LEN) {
+            break;
+        }
+        uint32_t incl = (uint32_t)get_le(x->record + 8, 4);
+        if (incl > x->record_cap - PCAP_RECORD_HEADER_LEN || pos + PCAP_RECORD_HEADER_LEN + incl > end ||
+            fread(x->record + PCAP_RECORD_HEADER_LEN, 1, incl, x->pcap) != incl) {
+            break;
+        }
+        pos += PCAP_RECORD_HEADER_LEN + incl;
+        x->stats->records_scanned++;
+
+        uint32_t ts_sec = (uint32_t)get_le(x->record, 4);
+        if (pcap_filter_match(x->filter, x->record + PCAP_RECORD_HEADER_LEN, incl, ts_sec)) {
+            x->stats->records_matched++;
+            esp_err_t err = x->write_fn(x->ctx, x->record, PCAP_RECORD_HEADER_LEN + incl);
+            if (err != ESP_OK) {
+                return err;
+            }
+        }
+    }
+    x->stats->bytes_read += pos - start;
+    return ESP_OK;
+}
+
+static bool block_may_match(const pcap_filter_t *filter, const uint8_t *k, const uint16_t *ids, uint16_t id_count,
+                            int want_id) {
+    uint32_t first_sec = (uint32_t)get_le(k + 17, 4);
+    uint32_t last_sec = (uint32_t)get_le(k + 25, 4);
+    uint64_t type_mask = get_le(k + 33, 8);
+    uint8_t flags = k[41];
+
+    if ((filter->to_sec && first_sec > filter->to_sec) || (filter->from_sec && last_sec < filter->from_sec)) {
+        return false;
+    }
+    if (filter->type_mask && !(filter->type_mask & type_mask)) {
+        return false;
+    }
+    if (!filter->has_bssid || (flags & BLOCK_FLAG_ID_OVERFLOW)) {
+        return true;
+    }
+    if (want_id < 0) {
+        return (flags & BLOCK_FLAG_UNTRACKED) != 0;
+    }
+    for (uint16_t i = 0; i < id_count; i++) {
+        if (ids[i] == want_id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Walk the sidecar and copy the blocks that may match. Returns the pcap offset the index covers up to,
+// or 0 when there is no usable sidecar.
+static uint64_t extract_indexed(extract_t *x, const char *pcap_path, uint64_t pcap_size, esp_err_t *err) {
+    char path[256];
+    snprintf(path, sizeof(path), "%s%s", pcap_path, PCAP_SIDECAR_SUFFIX);
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        return 0;
+    }
+
+    uint8_t header[SIDECAR_HEADER_LEN];
+    if (fread(header, 1, sizeof(header), f) != sizeof(header) || memcmp(header, SIDECAR_MAGIC, 4) != 0 ||
+        get_le(header + 4, 2) != SIDECAR_VERSION) {
+        fclose(f);
+        return 0;
+    }
+    x->stats->used_index = true;
+
+    uint64_t covered = PCAP_GLOBAL_HEADER_LEN;
+    int want_id = -1;
+    uint8_t entry[BLOCK_ENTRY_LEN];
+    uint16_t ids[PCAP_SIDECAR_BLOCK_IDS];
+    int tag;
+    while (*err == ESP_OK && (tag = fgetc(f)) != EOF) {
+        if (tag == 'B') {
+            if (fread(entry + 1, 1, BSSID_ENTRY_LEN - 1, f) != BSSID_ENTRY_LEN - 1) {
+                break;
+            }
+            if (x->filter->has_bssid && memcmp(entry + 3, x->filter->bssid, 6) == 0) {
+                want_id = (int)get_le(entry + 1, 2);
+            }
+        } else if (tag == 'K') {
+            if (fread(entry + 1, 1, 43, f) != 43) {
+                break;
+            }
+            uint16_t id_count = (uint16_t)get_le(entry + 42, 2);
+            if (id_count > PCAP_SIDECAR_BLOCK_IDS || fread(ids, 2, id_count, f) != id_count) {
+                break;
+            }
+            for (uint16_t i = 0; i < id_count; i++) {
+                ids[i] = (uint16_t)get_le((const uint8_t *)&ids[i], 2);
+            }
+
+            uint64_t offset = get_le(entry + 1, 8);
+            uint64_t end = offset + get_le(entry + 9, 4);
+            if (offset < covered || end > pcap_size) {
+                break;  // Written before a crash cut the pcap shorter; the tail scan covers the rest
+            }
+            x->stats->blocks_total++;
+            if (block_may_match(x->filter, entry, ids, id_count, want_id)) {
+                x->stats->blocks_read++;
+                *err = scan_range(x, offset, end);
+            }
+            covered = end;
+        } else {
+            break;  // 'E' or a torn entry
+        }
+    }
+    fclose(f);
+    return covered;
+}
+
+esp_err_t pcap_sidecar_extract(const char *pcap_path, const pcap_filter_t *filter, pcap_extract_write_fn write_fn,
+                               void *ctx, pcap_extract_stats_t *stats) {
+    pcap_extract_stats_t local_stats;
+    extract_t x = {
+        .filter = filter,
+        .write_fn = write_fn,
+        .ctx = ctx,
+        .stats = stats ? stats : &local_stats,
+    };
+    memset(x.stats, 0, sizeof(*x.stats));
+
+    x.pcap = fopen(pcap_path, "rb");
+    if (x.pcap == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    setvbuf(x.pcap, NULL, _IOFBF, 4096);
+
+    struct stat st;
+    uint8_t global[PCAP_GLOBAL_HEADER_LEN];
+    if (fstat(fileno(x.pcap), &st) != 0 || fread(global, 1, sizeof(global), x.pcap) != sizeof(global) ||
+        get_le(global, 4) != PCAP_MAGIC) {
+        fclose(x.pcap);
+        return ESP_ERR_INVALID_ARG;
+    }
+    uint32_t snaplen = (uint32_t)get_le(global + 16, 4);
+    x.record_cap = PCAP_RECORD_HEADER_LEN + (snaplen && snaplen < PCAP_MAX_RECORD ? snaplen : PCAP_MAX_RECORD);
+    x.record = malloc(x.record_cap);
+    if (x.record == NULL) {
+        fclose(x.pcap);
+        return ESP_ERR_NO_MEM;
+    }
+
+    esp_err_t err = write_fn(ctx, global, sizeof(global));
+    uint64_t size = (uint64_t)st.st_size;
+    uint64_t covered = err == ESP_OK ? extract_indexed(&x, pcap_path, size, &err) : 0;
+    if (err == ESP_OK) {
+        err = scan_range(&x, covered ? covered : PCAP_GLOBAL_HEADER_LEN, size);
+    }
+
+    free(x.record);
+    fclose(x.pcap);
+    return err;
+}
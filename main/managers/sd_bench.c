@@ -0,0 +1,473 @@
+#include "managers/sd_bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_log.h"
+#include "esp_pthread.h"
+#include "esp_heap_caps.h"
+#include "managers/sd_card_manager.h"
+#else
+#include <sys/statvfs.h>
+#define ESP_LOGE(tag, fmt, ...) fprintf(stderr, "E %s: " fmt "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...) fprintf(stderr, "W %s: " fmt "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, fmt, ...) fprintf(stderr, "I %s: " fmt "\n", tag, ##__VA_ARGS__)
+#endif
+
+static const char *TAG = "SD_BENCH";
+
+#define BENCH_STACK_SIZE 6144
+#define RECOMMEND_MIN 4096            // Same range as CONFIG_SD_WRITER_BUFFER_SIZE
+#define RECOMMEND_MAX 32768
+#define RECOMMEND_SHARE 90            // Smallest block within this % of the best write rate wins
+
+static const size_t block_sizes[SD_BENCH_MAX_BLOCKS] = {512, 4096, 8192, 16384, 32768, 65536};
+
+static struct {
+    pthread_mutex_t lock;
+    sd_bench_state_t state;
+    sd_bench_config_t config;
+    char dir[128];
+    sd_bench_result_t result;
+} bench = { .lock = PTHREAD_MUTEX_INITIALIZER, .state = SD_BENCH_IDLE };
+
+static int64_t now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static uint8_t *alloc_block(size_t size) {
+#ifdef ESP_PLATFORM
+    return heap_caps_malloc(size, MALLOC_CAP_DMA);
+#else
+    return malloc(size);
+#endif
+}
+
+static uint32_t kbps(uint64_t bytes, int64_t us) {
+    return us > 0 ? (uint32_t)(bytes * 1000000 / 1024 / (uint64_t)us) : 0;
+}
+
+void sd_bench_default_config(sd_bench_config_t *cfg) {
+    memset(cfg, 0, sizeof(*cfg));
+    cfg->dir = "/mnt";
+#ifdef ESP_PLATFORM
+    cfg->file_bytes = 2 * 1024 * 1024;
+#else
+    cfg->file_bytes = 64 * 1024 * 1024;
+#endif
+    cfg->append_count = 1000;
+    cfg->append_size = 64;
+    cfg->create_count = 100;
+    cfg->capture_bytes = cfg->file_bytes * 2;
+}
+
+static esp_err_t fs_stats(const char *dir, sd_bench_fs_t *out) {
+#ifdef ESP_PLATFORM
+    (void)dir;
+    return sd_card_get_fs_stats(true, out);
+#else
+    struct statvfs st;
+    if (statvfs(dir, &st) != 0) {
+        return ESP_FAIL;
+    }
+    memset(out, 0, sizeof(*out));
+    out->cluster_size = st.f_frsize;
+    out->total_bytes = (uint64_t)st.f_blocks * st.f_frsize;
+    out->free_bytes = (uint64_t)st.f_bavail * st.f_frsize;
+    out->free_clusters = st.f_bavail;
+    return ESP_OK;
+#endif
+}
+
+static esp_err_t bench_sequential(const char *dir, size_t block, size_t file_bytes, sd_bench_seq_t *out) {
+    uint8_t *buf = alloc_block(block);
+    if (!buf) {
+        return ESP_ERR_NO_MEM;
+    }
+    for (size_t i = 0; i < block; i++) buf[i] = (uint8_t)(i * 31 + block);
+
+    char path[192];
+    snprintf(path, sizeof(path), "%s/seq.bin", dir);
+    size_t blocks = file_bytes / block;
+    if (blocks == 0) blocks = 1;
+    esp_err_t ret = ESP_OK;
+    memset(out, 0, sizeof(*out));
+    out->block_size = block;
+
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        free(buf);
+        return ESP_FAIL;
+    }
+    int64_t start = now_us();
+    for (size_t i = 0; i < blocks; i++) {
+        int64_t t = now_us();
+        if (write(fd, buf, block) != (ssize_t)block) {
+            ret = ESP_FAIL;
+            break;
+        }
+        uint32_t took = (uint32_t)(now_us() - t);
+        if (took > out->write_us_max) out->write_us_max = took;
+    }
+    fsync(fd);
+    int64_t write_us = now_us() - start;
+    close(fd);
+
+    if (ret == ESP_OK) {
+        out->write_kbps = kbps((uint64_t)blocks * block, write_us);
+        fd = open(path, O_RDONLY);
+        if (fd < 0) {
+            ret = ESP_FAIL;
+        } else {
+#ifdef POSIX_FADV_DONTNEED
+            // Measure the device rather than the page cache
+            posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+#endif
+            uint64_t total = 0;
+            ssize_t n;
+            start = now_us();
+            while ((n = read(fd, buf, block)) > 0) {
+                total += n;
+            }
+            out->read_kbps = kbps(total, now_us() - start);
+            close(fd);
+        }
+    }
+    unlink(path);
+    free(buf);
+    return ret;
+}
+
+static int compare_u32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+static esp_err_t bench_appends(const char *dir, const sd_bench_config_t *cfg, sd_bench_result_t *result) {
+    if (cfg->append_count == 0) {
+        return ESP_OK;
+    }
+    uint32_t *lat = malloc(cfg->append_count * sizeof(uint32_t));
+    uint8_t *rec = malloc(cfg->append_size);
+    if (!lat || !rec) {
+        free(lat);
+        free(rec);
+        return ESP_ERR_NO_MEM;
+    }
+    memset(rec, 'a', cfg->append_size);
+
+    char path[192];
+    snprintf(path, sizeof(path), "%s/append.bin", dir);
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND, 0644);
+    esp_err_t ret = fd < 0 ? ESP_FAIL : ESP_OK;
+    uint32_t n = 0;
+    for (; ret == ESP_OK && n < cfg->append_count; n++) {
+        int64_t t = now_us();
+        if (write(fd, rec, cfg->append_size) != (ssize_t)cfg->append_size) {
+            ret = ESP_FAIL;
+            break;
+        }
+        lat[n] = (uint32_t)(now_us() - t);
+    }
+    if (fd >= 0) close(fd);
+    unlink(path);
+
+    if (n > 0) {
+        qsort(lat, n, sizeof(uint32_t), compare_u32);
+        result->append_p50_us = lat[n * 50 / 100];
+        result->append_p90_us = lat[n * 90 / 100];
+        result->append_p99_us = lat[n * 99 / 100];
+        result->append_max_us = lat[n - 1];
+    }
+    free(lat);
+    free(rec);
+    return ret;
+}
+
+static esp_err_t bench_metadata(const char *dir, uint32_t count, sd_bench_result_t *result) {
+    if (count == 0) {
+        return ESP_OK;
+    }
+    char path[192];
+    uint32_t created = 0;
+    int64_t start = now_us();
+    for (; created < count; created++) {
+        snprintf(path, sizeof(path), "%s/f%05lu.tmp", dir, (unsigned long)created);
+        int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) break;
+        close(fd);
+    }
+    if (created > 0) {
+        result->create_us = (uint32_t)((now_us() - start) / created);
+    }
+
+    uint32_t entries = 0;
+    start = now_us();
+    DIR *d = opendir(dir);
+    if (d) {
+        struct dirent *de;
+        while ((de = readdir(d)) != NULL) {
+            entries++;
+        }
+        closedir(d);
+    }
+    if (entries > 0) {
+        result->readdir_us = (uint32_t)((now_us() - start) / entries);
+    }
+
+    start = now_us();
+    for (uint32_t i = 0; i < created; i++) {
+        snprintf(path, sizeof(path), "%s/f%05lu.tmp", dir, (unsigned long)i);
+        unlink(path);
+    }
+    if (created > 0) {
+        result->unlink_us = (uint32_t)((now_us() - start) / created);
+    }
+    return created == count ? ESP_OK : ESP_FAIL;
+}
+
+// Capture-like traffic through the SD writer: frame sized records, each handed over separately
+static esp_err_t bench_capture(const char *dir, size_t bytes, uint32_t prealloc, sd_bench_capture_t *out) {
+    uint8_t *frame = malloc(1600);
+    if (!frame) {
+        return ESP_ERR_NO_MEM;
+    }
+    memset(frame, 0x5a, 1600);
+    memset(out, 0, sizeof(*out));
+    out->prealloc_bytes = prealloc;
+
+    char path[192];
+    snprintf(path, sizeof(path), "%s/capture.bin", dir);
+    sd_writer_stream_config_t stream_config = {
+        .sync_on_close = true,
+        .prealloc_bytes = prealloc,
+    };
+    sd_writer_metrics_t before, after;
+    sd_writer_get_metrics(&before);
+    sd_writer_stream_t *stream = sd_writer_open(path, "w", &stream_config);
+    if (!stream) {
+        free(frame);
+        return ESP_FAIL;
+    }
+
+    esp_err_t ret = ESP_OK;
+    uint32_t seed = 12345;
+    size_t written = 0;
+    int64_t start = now_us();
+    while (written < bytes && ret == ESP_OK) {
+        seed = seed * 1103515245 + 12345;
+        size_t len = 60 + (seed >> 16) % 1540;
+        ret = sd_writer_write(stream, frame, len, 1000);
+        written += len;
+    }
+    sd_writer_close(stream);
+    int64_t elapsed = now_us() - start;
+    sd_writer_get_metrics(&after);
+    unlink(path);
+    free(frame);
+
+    // Other streams writing meanwhile end up in these figures too
+    out->kbps = kbps(written, elapsed);
+    out->prealloc_extents = after.prealloc_extents - before.prealloc_extents;
+    for (int i = 0; i < SD_WRITER_LATENCY_BUCKETS; i++) {
+        out->write_latency_hist[i] = after.write_latency_hist[i] - before.write_latency_hist[i];
+    }
+    return ret;
+}
+
+// Smallest block size in the writer's range that gets close to the best write rate, and enough
+// buffers to keep accepting data through the slowest single write seen at that size.
+static void recommend(sd_bench_result_t *result) {
+    uint32_t best = 0;
+    for (size_t i = 0; i < result->seq_count; i++) {
+        const sd_bench_seq_t *s = &result->seq[i];
+        if (s->block_size >= RECOMMEND_MIN && s->block_size <= RECOMMEND_MAX && s->write_kbps > best) {
+            best = s->write_kbps;
+        }
+    }
+    result->recommended_buffer_size = SD_WRITER_DEFAULT_BUFFER_SIZE;
+    result->recommended_buffer_count = SD_WRITER_DEFAULT_BUFFER_COUNT;
+    if (best == 0) {
+        return;
+    }
+    for (size_t i = 0; i < result->seq_count; i++) {
+        const sd_bench_seq_t *s = &result->seq[i];
+        if (s->block_size < RECOMMEND_MIN || s->block_size > RECOMMEND_MAX ||
+            (uint64_t)s->write_kbps * 100 < (uint64_t)best * RECOMMEND_SHARE) {
+            continue;
+        }
+        result->recommended_buffer_size = s->block_size;
+        uint64_t block_us = (uint64_t)s->block_size * 1000000 / 1024 / (s->write_kbps ? s->write_kbps : 1);
+        uint32_t count = 1 + (uint32_t)((s->write_us_max + block_us - 1) / (block_us ? block_us : 1));
+        result->recommended_buffer_count = count < 2 ? 2 : (count > 8 ? 8 : count);
+        break;
+    }
+}
+
+esp_err_t sd_bench_run(const sd_bench_config_t *cfg, sd_bench_result_t *result) {
+    sd_bench_config_t defaults;
+    if (!cfg) {
+        sd_bench_default_config(&defaults);
+        cfg = &defaults;
+    }
+    memset(result, 0, sizeof(*result));
+
+    char dir[160];
+    snprintf(dir, sizeof(dir), "%s/.sdbench", cfg->dir ? cfg->dir : "/mnt");
+    if (mkdir(dir, 0755) != 0 && errno != EEXIST) {
+        ESP_LOGE(TAG, "Cannot create %s: errno %d", dir, errno);
+        return ESP_FAIL;
+    }
+
+    int64_t start = now_us();
+    esp_err_t ret = ESP_OK;
+    for (size_t i = 0; i < SD_BENCH_MAX_BLOCKS && ret == ESP_OK; i++) {
+        esp_err_t r = bench_sequential(dir, block_sizes[i], cfg->file_bytes, &result->seq[result->seq_count]);
+        if (r == ESP_ERR_NO_MEM) {
+            ESP_LOGW(TAG, "Skipping %u byte blocks, not enough RAM", (unsigned)block_sizes[i]);
+            continue;
+        }
+        ret = r;
+        if (r == ESP_OK) result->seq_count++;
+    }
+    if (ret == ESP_OK) ret = bench_appends(dir, cfg, result);
+    if (ret == ESP_OK) ret = bench_metadata(dir, cfg->create_count, result);
+    if (ret == ESP_OK && cfg->capture_bytes > 0) {
+        uint32_t prealloc = SD_WRITER_DEFAULT_PREALLOC ? SD_WRITER_DEFAULT_PREALLOC : 1024 * 1024;
+        ret = bench_capture(dir, cfg->capture_bytes, 0, &result->capture[0]);
+        if (ret == ESP_OK) ret = bench_capture(dir, cfg->capture_bytes, prealloc, &result->capture[1]);
+        if (ret == ESP_OK) result->capture_count = 2;
+    }
+    rmdir(dir);
+
+    result->fs_valid = fs_stats(cfg->dir ? cfg->dir : "/mnt", &result->fs) == ESP_OK;
+    recommend(result);
+    result->duration_ms = (uint32_t)((now_us() - start) / 1000);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Benchmark failed: errno %d", errno);
+    }
+    return ret;
+}
+
+void sd_bench_print(const sd_bench_result_t *r) {
+    printf("Sequential (KB/s):\n");
+    printf("  %8s %10s %10s %12s\n", "block", "write", "read", "worst write");
+    for (size_t i = 0; i < r->seq_count; i++) {
+        const sd_bench_seq_t *s = &r->seq[i];
+        printf("  %8u %10lu %10lu %10lu us\n", (unsigned)s->block_size, (unsigned long)s->write_kbps,
+               (unsigned long)s->read_kbps, (unsigned long)s->write_us_max);
+    }
+    printf("Small appends: p50 %lu us, p90 %lu us, p99 %lu us, max %lu us\n", (unsigned long)r->append_p50_us,
+           (unsigned long)r->append_p90_us, (unsigned long)r->append_p99_us, (unsigned long)r->append_max_us);
+    printf("Metadata: create %lu us, readdir %lu us/entry, unlink %lu us\n", (unsigned long)r->create_us,
+           (unsigned long)r->readdir_us, (unsigned long)r->unlink_us);
+    static const uint32_t bounds[] = SD_WRITER_LATENCY_BOUNDS_MS;
+    for (size_t i = 0; i < r->capture_count; i++) {
+        const sd_bench_capture_t *c = &r->capture[i];
+        if (c->prealloc_bytes) {
+            printf("Capture, %lu KB preallocation: %lu KB/s, %lu extents\n  writes:", (unsigned long)(c->prealloc_bytes / 1024),
+                   (unsigned long)c->kbps, (unsigned long)c->prealloc_extents);
+        } else {
+            printf("Capture, no preallocation: %lu KB/s\n  writes:", (unsigned long)c->kbps);
+        }
+        for (int b = 0; b < SD_WRITER_LATENCY_BUCKETS; b++) {
+            if (b < SD_WRITER_LATENCY_BUCKETS - 1) {
+                printf(" <%lums %lu", (unsigned long)bounds[b], (unsigned long)c->write_latency_hist[b]);
+            } else {
+                printf(" >=%lums %lu", (unsigned long)bounds[b - 1], (unsigned long)c->write_latency_hist[b]);
+            }
+        }
+        printf("\n");
+    }
+    if (r->fs_valid) {
+        printf("Filesystem: %llu of %llu MB free, %lu byte clusters", (unsigned long long)(r->fs.free_bytes >> 20),
+               (unsigned long long)(r->fs.total_bytes >> 20), (unsigned long)r->fs.cluster_size);
+        if (r->fs.fat_type) {
+            printf(", FAT%u", r->fs.fat_type);
+        }
+        printf("\n");
+        if (r->fs.free_extents > 0) {
+            printf("Free space: %lu extents, largest %lu clusters (%lu%% of free)\n", (unsigned long)r->fs.free_extents,
+                   (unsigned long)r->fs.largest_free_extent,
+                   (unsigned long)((uint64_t)r->fs.largest_free_extent * 100 / (r->fs.free_clusters ? r->fs.free_clusters : 1)));
+        }
+    }
+    printf("Recommended SD writer buffer: %u bytes x %lu (took %lu ms)\n", (unsigned)r->recommended_buffer_size,
+           (unsigned long)r->recommended_buffer_count, (unsigned long)r->duration_ms);
+}
+
+static void *bench_thread(void *arg) {
+    sd_bench_result_t *result = malloc(sizeof(*result));
+    esp_err_t ret = result ? sd_bench_run(&bench.config, result) : ESP_ERR_NO_MEM;
+
+    pthread_mutex_lock(&bench.lock);
+    if (result) bench.result = *result;
+    bench.state = ret == ESP_OK ? SD_BENCH_DONE : SD_BENCH_FAILED;
+    pthread_mutex_unlock(&bench.lock);
+
+    if (ret == ESP_OK) {
+        sd_bench_print(result);
+    } else {
+        printf("SD benchmark failed (%d)\n", ret);
+    }
+    free(result);
+    return NULL;
+}
+
+esp_err_t sd_bench_start(const sd_bench_config_t *cfg) {
+    pthread_mutex_lock(&bench.lock);
+    if (bench.state == SD_BENCH_RUNNING) {
+        pthread_mutex_unlock(&bench.lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (cfg) {
+        bench.config = *cfg;
+    } else {
+        sd_bench_default_config(&bench.config);
+    }
+    snprintf(bench.dir, sizeof(bench.dir), "%s", bench.config.dir ? bench.config.dir : "/mnt");
+    bench.config.dir = bench.dir;
+    bench.state = SD_BENCH_RUNNING;
+    pthread_mutex_unlock(&bench.lock);
+
+#ifdef ESP_PLATFORM
+    esp_pthread_cfg_t pcfg = esp_pthread_get_default_config();
+    pcfg.stack_size = BENCH_STACK_SIZE;
+    pcfg.thread_name = "sd_bench";
+    esp_pthread_set_cfg(&pcfg);
+#endif
+    pthread_t thread;
+    int rc = pthread_create(&thread, NULL, bench_thread, NULL);
+#ifdef ESP_PLATFORM
+    pcfg = esp_pthread_get_default_config();
+    esp_pthread_set_cfg(&pcfg);
+#endif
+    if (rc != 0) {
+        pthread_mutex_lock(&bench.lock);
+        bench.state = SD_BENCH_FAILED;
+        pthread_mutex_unlock(&bench.lock);
+        return ESP_ERR_NO_MEM;
+    }
+    pthread_detach(thread);
+    return ESP_OK;
+}
+
+sd_bench_state_t sd_bench_get(sd_bench_result_t *result) {
+    pthread_mutex_lock(&bench.lock);
+    sd_bench_state_t state = bench.state;
+    if (result && state == SD_BENCH_DONE) {
+        *result = bench.result;
+    }
+    pthread_mutex_unlock(&bench.lock);
+    return state;
+}
@@ -4,6 +4,9 @@
 #include <sys/unistd.h>
 #include "esp_log.h"
 #include "esp_vfs_fat.h"
+#include "ff.h"
+#include "diskio_impl.h"
+#include "diskio_sdmmc.h"
 #include <dirent.h>
 #include "driver/sdmmc_host.h"
 #include "driver/sdmmc_defs.h"
@@ -15,9 +18,17 @@
 #include "core/utils.h"
 #include "vendor/pcap.h"
 #include "vendor/drivers/CH422G.h"
+#include "managers/sd_writer.h"
+#include "managers/capture_journal.h"
+#include "managers/capture_index.h"
+#include <stdlib.h>
 
 static const char *SD_TAG = "SD_Card_Manager";
 
+// Repeated appends to the same file reuse one writer stream instead of reopening the file each time
+static sd_writer_stream_t *append_stream = NULL;
+static char append_path[MAX_FILE_NAME_LENGTH];
+
 
 sd_card_manager_t sd_card_manager = { // Change this based on board config
     .card = NULL,
@@ -135,7 +146,7 @@ esp_err_t sd_card_init(void) {
    
     esp_vfs_fat_sdmmc_mount_config_t mount_config = {
         .format_if_mount_failed = false,
-        .max_files = 5,
+        .max_files = 7,             // Two stay open for the capture indexes (pcaps, gps)
         .allocation_unit_size = 16 * 1024
     };
 
@@ -277,7 +288,7 @@ esp_err_t sd_card_init(void) {
 
     esp_vfs_fat_sdmmc_mount_config_t mount_config = {
         .format_if_mount_failed = false,
-        .max_files = 5,
+        .max_files = 7,             // Two stay open for the capture indexes (pcaps, gps)
         .allocation_unit_size = 16 * 1024
     };
 
@@ -304,11 +315,32 @@ esp_err_t sd_card_init(void) {
 
 #endif
 
+    // Repair captures that were still open when power was lost, before anything new is written
+    if (sd_card_manager.is_initialized) {
+        int repaired = capture_journal_recover();
+        if (repaired > 0) {
+            printf("Repaired %d capture file(s) from an unclean shutdown\n", repaired);
+        }
+
+        // Load after recovery so entries left open pick up the repaired sizes
+        capture_index_load("/mnt/ghostesp/pcaps");
+        capture_index_load("/mnt/ghostesp/gps");
+    }
+
+    if (sd_card_manager.is_initialized && sd_writer_init(NULL) != ESP_OK) {
+        printf("Failed to start SD writer, file logging will be unavailable\n");
+    }
+
     return ESP_OK;
 }
 
 
 void sd_card_unmount(void) {
+    // Drain queued writes while the filesystem is still mounted
+    append_stream = NULL;
+    sd_writer_deinit();
+    capture_index_unload();
+
 #if SOC_SDMMC_HOST_SUPPORTED && SOC_SDMMC_USE_GPIO_MATRIX
     if (sd_card_manager.is_initialized) {
         esp_vfs_fat_sdmmc_unmount();
@@ -330,15 +362,26 @@ esp_err_t sd_card_append_file(const char* path, const void* data, size_t size) {
         return ESP_FAIL;
     }
 
-    FILE* f = fopen(path, "ab");
-    if (f == NULL) {
-        printf("Failed to open file for appending\n");
-        return ESP_FAIL;
+    if (append_stream == NULL || strcmp(append_path, path) != 0) {
+        if (append_stream != NULL) {
+            sd_writer_close(append_stream);
+            append_stream = NULL;
+        }
+
+        sd_writer_stream_config_t stream_config = {
+            .sync_interval_ms = 5000,
+            .sync_on_close = true,
+        };
+        append_stream = sd_writer_open(path, "a", &stream_config);
+        if (append_stream == NULL) {
+            printf("Failed to open file for appending\n");
+            return ESP_FAIL;
+        }
+        strlcpy(append_path, path, sizeof(append_path));
     }
-    fwrite(data, 1, size, f);
-    fclose(f);
-    printf("Data appended to file: %s\n", path);
-    return ESP_OK;
+
+    // Data reaches the card within the writer's latency bound rather than on return
+    return sd_writer_write(append_stream, data, size, 1000);
 }
 
 esp_err_t sd_card_write_file(const char* path, const void* data, size_t size) {
@@ -526,4 +569,77 @@ esp_err_t sd_card_setup_directory_structure() {
 
     printf("Directory structure successfully set up.\n");
     return ESP_OK;
-}
\ No newline at end of file
+}
+
+// Walk the FAT counting runs of free clusters. Reads the table straight from the card, so blocks
+// still sitting dirty in FatFs' window can make the figures slightly stale.
+static esp_err_t scan_fat_free_extents(FATFS* fs, sd_bench_fs_t* out) {
+    if (fs->fs_type != FS_FAT16 && fs->fs_type != FS_FAT32) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+#if FF_MAX_SS != FF_MIN_SS
+    size_t sector_size = fs->ssize;
+#else
+    size_t sector_size = FF_MAX_SS;
+#endif
+    size_t entry_size = fs->fs_type == FS_FAT32 ? 4 : 2;
+    uint8_t* sector = malloc(sector_size);
+    if (!sector) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    uint32_t run = 0;
+    LBA_t loaded = (LBA_t)-1;
+    for (DWORD cl = 2; cl < fs->n_fatent; cl++) {
+        size_t offset = (size_t)cl * entry_size;
+        LBA_t lba = fs->fatbase + offset / sector_size;
+        if (lba != loaded) {
+            if (ff_disk_read(fs->pdrv, sector, lba, 1) != RES_OK) {
+                free(sector);
+                return ESP_FAIL;
+            }
+            loaded = lba;
+        }
+        const uint8_t* e = sector + offset % sector_size;
+        uint32_t value = entry_size == 4 ? ((e[0] | e[1] << 8 | e[2] << 16 | (uint32_t)e[3] << 24) & 0x0FFFFFFF)
+                                         : (uint32_t)(e[0] | e[1] << 8);
+        if (value == 0) {
+            if (run++ == 0) out->free_extents++;
+            if (run > out->largest_free_extent) out->largest_free_extent = run;
+        } else {
+            run = 0;
+        }
+    }
+    free(sector);
+    return ESP_OK;
+}
+
+esp_err_t sd_card_get_fs_stats(bool scan_fat, sd_bench_fs_t* out) {
+    if (!sd_card_manager.is_initialized || !sd_card_manager.card) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    memset(out, 0, sizeof(*out));
+
+    char drive[4];
+    snprintf(drive, sizeof(drive), "%u:", ff_diskio_get_pdrv_card(sd_card_manager.card));
+    FATFS* fs = NULL;
+    DWORD free_clusters = 0;
+    if (f_getfree(drive, &free_clusters, &fs) != FR_OK) {
+        return ESP_FAIL;
+    }
+#if FF_MAX_SS != FF_MIN_SS
+    uint32_t sector_size = fs->ssize;
+#else
+    uint32_t sector_size = FF_MAX_SS;
+#endif
+    out->cluster_size = fs->csize * sector_size;
+    out->free_clusters = free_clusters;
+    out->total_bytes = (uint64_t)(fs->n_fatent - 2) * out->cluster_size;
+    out->free_bytes = (uint64_t)free_clusters * out->cluster_size;
+    out->fat_type = fs->fs_type == FS_FAT12 ? 12 : (fs->fs_type == FS_FAT16 ? 16 : (fs->fs_type == FS_FAT32 ? 32 : 0));
+
+    if (scan_fat && scan_fat_free_extents(fs, out) != ESP_OK) {
+        ESP_LOGW(SD_TAG, "Could not scan the FAT for free extents");
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,364 @@
+#include "managers/sd_listing.h"
+#include "managers/capture_index.h"
+#include "core/json_writer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#define LISTING_OUT_BUFFER 1024
+
+typedef struct {
+    char *name;
+    uint64_t size;
+    uint32_t mtime;
+    uint32_t records;
+    capture_file_type_t kind;
+    bool is_dir;
+    bool has_meta;               // size and mtime are valid
+    bool indexed;
+    bool open;
+} list_item_t;
+
+typedef struct {
+    const sd_listing_query_t *query;
+    list_item_t *heap;           // Max-heap of the best offset + limit entries
+    size_t heap_len;
+    size_t window;
+    list_item_t cursor;
+    bool has_cursor;
+    char cursor_name[SD_LISTING_CURSOR_LEN];
+    uint32_t total;
+    uint32_t emitted;
+    json_writer_t json;
+    char out[LISTING_OUT_BUFFER];
+    esp_err_t err;               // Listing errors; output errors stay in json
+} list_state_t;
+
+static bool listing_ok(const list_state_t *st) {
+    return st->err == ESP_OK && st->json.err == ESP_OK;
+}
+
+static int compare_items(const list_item_t *a, const list_item_t *b, sd_listing_sort_t sort, bool descending) {
+    // Folders always come first, whatever the order
+    if (a->is_dir != b->is_dir) {
+        return a->is_dir ? -1 : 1;
+    }
+
+    int c = 0;
+    if (sort == SD_LISTING_SORT_SIZE && a->size != b->size) {
+        c = a->size < b->size ? -1 : 1;
+    } else if (sort == SD_LISTING_SORT_TIME && a->mtime != b->mtime) {
+        c = a->mtime < b->mtime ? -1 : 1;
+    } else {
+        c = strcmp(a->name, b->name);
+    }
+    return descending ? -c : c;
+}
+
+static int compare_for_query(list_state_t *st, const list_item_t *a, const list_item_t *b) {
+    return compare_items(a, b, st->query->sort, st->query->descending);
+}
+
+static void heap_sift_down(list_state_t *st, size_t i) {
+    for (;;) {
+        size_t largest = i;
+        size_t l = 2 * i + 1;
+        size_t r = l + 1;
+        if (l < st->heap_len && compare_for_query(st, &st->heap[l], &st->heap[largest]) > 0) {
+            largest = l;
+        }
+        if (r < st->heap_len && compare_for_query(st, &st->heap[r], &st->heap[largest]) > 0) {
+            largest = r;
+        }
+        if (largest == i) {
+            return;
+        }
+        list_item_t tmp = st->heap[i];
+        st->heap[i] = st->heap[largest];
+        st->heap[largest] = tmp;
+        i = largest;
+    }
+}
+
+static void heap_sift_up(list_state_t *st, size_t i) {
+    while (i > 0) {
+        size_t parent = (i - 1) / 2;
+        if (compare_for_query(st, &st->heap[i], &st->heap[parent]) <= 0) {
+            return;
+        }
+        list_item_t tmp = st->heap[i];
+        st->heap[i] = st->heap[parent];
+        st->heap[parent] = tmp;
+        i = parent;
+    }
+}
+
+static void fill_meta(list_state_t *st, list_item_t *item) {
+    if (item->has_meta) {
+        return;
+    }
+    char full[300];
+    snprintf(full, sizeof(full), "%s/%s", st->query->path, item->name);
+    struct stat s;
+    if (stat(full, &s) == 0) {
+        item->size = (uint64_t)s.st_size;
+        item->mtime = (uint32_t)s.st_mtime;
+        item->is_dir = S_ISDIR(s.st_mode);
+    }
+    item->has_meta = true;
+}
+
+static void emit_item(list_state_t *st, list_item_t *item) {
+    fill_meta(st, item);
+
+    json_writer_t *w = &st->json;
+    char full[300];
+    snprintf(full, sizeof(full), "%s/%s", st->query->path, item->name);
+    json_writer_object(w, NULL);
+    json_writer_string(w, "name", item->name);
+    json_writer_string(w, "path", full);
+
+    if (item->is_dir) {
+        json_writer_string(w, "type", "folder");
+    } else {
+        json_writer_string(w, "type", "file");
+        json_writer_uint(w, "size", item->size);
+        json_writer_uint(w, "mtime", item->mtime);
+        if (item->indexed) {
+            json_writer_string(w, "kind", capture_index_type_str(item->kind));
+            if (item->records) {
+                json_writer_uint(w, "records", item->records);
+            }
+            if (item->open) {
+                json_writer_bool(w, "open", true);
+            }
+        }
+    }
+    json_writer_end(w);
+    st->emitted++;
+}
+
+// Called once per directory entry from either source
+static void visit_item(list_state_t *st, list_item_t *item) {
+    const sd_listing_query_t *q = st->query;
+
+    if (q->sort == SD_LISTING_SORT_NONE) {
+        uint32_t position = st->total++;
+        if (position >= q->offset && st->emitted < q->limit) {
+            emit_item(st, item);
+        }
+        return;
+    }
+
+    if (q->sort == SD_LISTING_SORT_SIZE || q->sort == SD_LISTING_SORT_TIME) {
+        fill_meta(st, item);
+    }
+    if (st->has_cursor && compare_for_query(st, item, &st->cursor) <= 0) {
+        return;
+    }
+    st->total++;
+
+    if (st->heap_len < st->window) {
+        list_item_t copy = *item;
+        copy.name = strdup(item->name);
+        if (copy.name == NULL) {
+            st->err = ESP_ERR_NO_MEM;
+            return;
+        }
+        st->heap[st->heap_len++] = copy;
+        heap_sift_up(st, st->heap_len - 1);
+    } else if (compare_for_query(st, item, &st->heap[0]) < 0) {
+        char *name = strdup(item->name);
+        if (name == NULL) {
+            st->err = ESP_ERR_NO_MEM;
+            return;
+        }
+        free(st->heap[0].name);
+        st->heap[0] = *item;
+        st->heap[0].name = name;
+        heap_sift_down(st, 0);
+    }
+}
+
+static void visit_indexed(void *ctx, const capture_index_entry_t *entry) {
+    list_item_t item = {
+        .name = (char *)entry->name,
+        .size = entry->size,
+        .mtime = entry->start_time,
+        .records = entry->records,
+        .kind = entry->type,
+        .has_meta = true,
+        .indexed = true,
+        .open = entry->open,
+    };
+    visit_item(ctx, &item);
+}
+
+// With dirs_only, just the folders: in indexed directories the files come from the index
+static esp_err_t visit_directory(list_state_t *st, bool dirs_only) {
+    DIR *dir = opendir(st->query->path);
+    if (dir == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    struct dirent *de;
+    while ((de = readdir(dir)) != NULL && listing_ok(st)) {
+        // Dot files are our own bookkeeping (indexes, journals)
+        if (de->d_name[0] == '.') {
+            continue;
+        }
+        list_item_t item = { .name = de->d_name };
+#ifdef DT_DIR
+        if (de->d_type == DT_UNKNOWN) {
+            fill_meta(st, &item);
+        } else {
+            item.is_dir = de->d_type == DT_DIR;
+        }
+#else
+        fill_meta(st, &item);
+#endif
+        if (dirs_only && !item.is_dir) {
+            continue;
+        }
+        visit_item(st, &item);
+    }
+    closedir(dir);
+    return ESP_OK;
+}
+
+// Cursor: "<d|f>:<size or mtime>:<name>"
+static bool parse_cursor(list_state_t *st, const char *after) {
+    if (after == NULL || after[0] == '\0') {
+        return false;
+    }
+    char kind;
+    unsigned long long value;
+    int consumed = 0;
+    if (sscanf(after, "%c:%llu:%n", &kind, &value, &consumed) < 2 || consumed == 0 || (kind != 'd' && kind != 'f')) {
+        return false;
+    }
+    strncpy(st->cursor_name, after + consumed, sizeof(st->cursor_name) - 1);
+    st->cursor.name = st->cursor_name;
+    st->cursor.is_dir = kind == 'd';
+    st->cursor.size = value;
+    st->cursor.mtime = (uint32_t)value;
+    st->cursor.has_meta = true;
+    return true;
+}
+
+static void emit_cursor(list_state_t *st, const list_item_t *item) {
+    char cursor[SD_LISTING_CURSOR_LEN + 32];
+    unsigned long long value = st->query->sort == SD_LISTING_SORT_SIZE ? item->size
+                             : st->query->sort == SD_LISTING_SORT_TIME ? item->mtime : 0;
+    snprintf(cursor, sizeof(cursor), "%c:%llu:%s", item->is_dir ? 'd' : 'f', value, item->name);
+    json_writer_string(&st->json, "next", cursor);
+}
+
+esp_err_t sd_listing_stream(const sd_listing_query_t *query, sd_listing_write_fn write_fn, void *ctx) {
+    if (query == NULL || query->path == NULL || write_fn == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    sd_listing_query_t q = *query;
+    if (q.limit == 0 || q.limit > SD_LISTING_MAX_LIMIT) {
+        q.limit = q.limit == 0 ? SD_LISTING_DEFAULT_LIMIT : SD_LISTING_MAX_LIMIT;
+    }
+    if (q.sort != SD_LISTING_SORT_NONE && q.offset + q.limit > SD_LISTING_MAX_WINDOW) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    struct stat dir_stat;
+    if (stat(q.path, &dir_stat) != 0 || !S_ISDIR(dir_stat.st_mode)) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    list_state_t *st = calloc(1, sizeof(list_state_t));
+    if (st == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    st->query = &q;
+    st->err = ESP_OK;
+    json_writer_init(&st->json, st->out, sizeof(st->out), write_fn, ctx);
+
+    if (q.sort != SD_LISTING_SORT_NONE) {
+        st->window = q.offset + q.limit;
+        st->heap = calloc(st->window, sizeof(list_item_t));
+        if (st->heap == NULL) {
+            free(st);
+            return ESP_ERR_NO_MEM;
+        }
+        st->has_cursor = parse_cursor(st, q.after);
+    }
+
+    json_writer_t *w = &st->json;
+    json_writer_object(w, NULL);
+    json_writer_string(w, "path", q.path);
+    json_writer_array(w, "entries");
+
+    esp_err_t ret = ESP_OK;
+    if (capture_index_is_indexed(q.path)) {
+        // Folders first so an unsorted listing keeps them on top like a sorted one
+        ret = visit_directory(st, true);
+        if (ret == ESP_OK) {
+            ret = capture_index_foreach(q.path, visit_indexed, st);
+        }
+    } else {
+        ret = visit_directory(st, false);
+    }
+
+    if (q.sort != SD_LISTING_SORT_NONE && listing_ok(st)) {
+        // Heap sort in place: repeatedly move the largest remaining entry to the end
+        size_t count = st->heap_len;
+        while (st->heap_len > 1) {
+            list_item_t tmp = st->heap[0];
+            st->heap[0] = st->heap[st->heap_len - 1];
+            st->heap[st->heap_len - 1] = tmp;
+            st->heap_len--;
+            heap_sift_down(st, 0);
+        }
+        st->heap_len = count;
+        for (size_t i = q.offset; i < st->heap_len; i++) {
+            emit_item(st, &st->heap[i]);
+        }
+    }
+
+    json_writer_end(w);
+    json_writer_uint(w, "offset", q.offset);
+    json_writer_uint(w, "limit", q.limit);
+    json_writer_uint(w, "total", st->total);
+    if (q.sort != SD_LISTING_SORT_NONE && st->total > q.offset + q.limit && st->heap_len > 0) {
+        emit_cursor(st, &st->heap[st->heap_len - 1]);
+    } else {
+        json_writer_null(w, "next");
+    }
+    json_writer_end(w);
+    esp_err_t out_ret = json_writer_finish(w);
+
+    if (ret == ESP_OK) {
+        ret = st->err != ESP_OK ? st->err : out_ret;
+    }
+    for (size_t i = 0; i < st->heap_len; i++) {
+        free(st->heap[i].name);
+    }
+    free(st->heap);
+    free(st);
+    return ret;
+}
+
+sd_listing_sort_t sd_listing_parse_sort(const char *name) {
+    if (name == NULL) {
+        return SD_LISTING_SORT_NONE;
+    }
+    if (strcmp(name, "name") == 0) {
+        return SD_LISTING_SORT_NAME;
+    }
+    if (strcmp(name, "size") == 0) {
+        return SD_LISTING_SORT_SIZE;
+    }
+    if (strcmp(name, "time") == 0 || strcmp(name, "mtime") == 0) {
+        return SD_LISTING_SORT_TIME;
+    }
+    return SD_LISTING_SORT_NONE;
+}
@@ -0,0 +1,216 @@
+#include "managers/sd_upload.h"
+#include "managers/capture_index.h"
+#include "core/multipart_parser.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#else
+#define ESP_LOGE(tag, fmt, ...) fprintf(stderr, "E %s: " fmt "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, fmt, ...) fprintf(stderr, "I %s: " fmt "\n", tag, ##__VA_ARGS__)
+#endif
+
+static const char *TAG = "SD_UPLOAD";
+
+#define UPLOAD_PATH_LEN 320
+
+struct sd_upload {
+    multipart_parser_t *parser;
+    char dir[192];
+    int fd;                         // Open .part file, -1 while skipping a part
+    char path[UPLOAD_PATH_LEN];
+    char part_path[UPLOAD_PATH_LEN + 8];
+    uint8_t *buf;
+    size_t buf_len;
+    uint64_t file_bytes;
+    sd_upload_result_t result;
+};
+
+static esp_err_t write_all(int fd, const uint8_t *data, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, data, len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return ESP_FAIL;
+        }
+        data += n;
+        len -= n;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t flush_buffer(sd_upload_t *up) {
+    esp_err_t ret = write_all(up->fd, up->buf, up->buf_len);
+    up->buf_len = 0;
+    return ret;
+}
+
+static void discard_part(sd_upload_t *up) {
+    if (up->fd >= 0) {
+        close(up->fd);
+        unlink(up->part_path);
+        up->fd = -1;
+    }
+}
+
+// Keep only the last path component and replace characters FAT can't store
+static void sanitize_filename(const char *in, char *out, size_t out_len) {
+    const char *base = in;
+    for (const char *p = in; *p; p++) {
+        if (*p == '/' || *p == '\\') base = p + 1;
+    }
+    size_t len = 0;
+    for (; base[len] && len < out_len - 1; len++) {
+        char c = base[len];
+        out[len] = ((unsigned char)c < 0x20 || strchr(":*?\"<>|", c)) ? '_' : c;
+    }
+    out[len] = '\0';
+    if (len == 0 || strcmp(out, ".") == 0 || strcmp(out, "..") == 0) {
+        snprintf(out, out_len, "received_file");
+    }
+}
+
+static esp_err_t on_part_begin(void *ctx, const multipart_part_t *part) {
+    sd_upload_t *up = ctx;
+    if (!part->is_file || part->filename[0] == '\0') {
+        return ESP_OK;        // Form field or an empty file input
+    }
+
+    char name[MULTIPART_FIELD_MAX];
+    sanitize_filename(part->filename, name, sizeof(name));
+    snprintf(up->path, sizeof(up->path), "%s/%s", up->dir, name);
+    snprintf(up->part_path, sizeof(up->part_path), "%s.part", up->path);
+
+    up->fd = open(up->part_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (up->fd < 0) {
+        ESP_LOGE(TAG, "Failed to open %s: errno %d", up->part_path, errno);
+        return ESP_FAIL;
+    }
+    up->buf_len = 0;
+    up->file_bytes = 0;
+    ESP_LOGI(TAG, "Receiving %s", up->path);
+    return ESP_OK;
+}
+
+static esp_err_t on_part_data(void *ctx, const uint8_t *data, size_t len) {
+    sd_upload_t *up = ctx;
+    if (up->fd < 0) {
+        return ESP_OK;
+    }
+    up->file_bytes += len;
+
+    while (len > 0) {
+        // Large pieces skip the copy once the buffer is empty
+        if (up->buf_len == 0 && len >= SD_UPLOAD_BUFFER_SIZE) {
+            size_t direct = len - len % SD_UPLOAD_BUFFER_SIZE;
+            if (write_all(up->fd, data, direct) != ESP_OK) {
+                return ESP_FAIL;
+            }
+            data += direct;
+            len -= direct;
+            continue;
+        }
+        size_t n = SD_UPLOAD_BUFFER_SIZE - up->buf_len;
+        if (n > len) n = len;
+        memcpy(up->buf + up->buf_len, data, n);
+        up->buf_len += n;
+        data += n;
+        len -= n;
+        if (up->buf_len == SD_UPLOAD_BUFFER_SIZE && flush_buffer(up) != ESP_OK) {
+            return ESP_FAIL;
+        }
+    }
+    return ESP_OK;
+}
+
+static esp_err_t on_part_end(void *ctx) {
+    sd_upload_t *up = ctx;
+    if (up->fd < 0) {
+        return ESP_OK;
+    }
+    esp_err_t ret = flush_buffer(up);
+    if (close(up->fd) != 0) {
+        ret = ESP_FAIL;
+    }
+    up->fd = -1;
+    if (ret != ESP_OK) {
+        unlink(up->part_path);
+        return ret;
+    }
+
+    // FAT can't rename over an existing file
+    unlink(up->path);
+    if (rename(up->part_path, up->path) != 0) {
+        ESP_LOGE(TAG, "Failed to rename %s: errno %d", up->part_path, errno);
+        unlink(up->part_path);
+        return ESP_FAIL;
+    }
+    capture_index_update(up->path, up->file_bytes, 0);
+    up->result.files++;
+    up->result.bytes += up->file_bytes;
+    ESP_LOGI(TAG, "Stored %s (%llu bytes)", up->path, (unsigned long long)up->file_bytes);
+    return ESP_OK;
+}
+
+esp_err_t sd_upload_begin(const char *dir, const char *content_type, sd_upload_t **out) {
+    char boundary[MULTIPART_BOUNDARY_MAX + 1];
+    if (!dir || strlen(dir) >= sizeof(((sd_upload_t *)0)->dir) ||
+        !multipart_parse_boundary(content_type, boundary, sizeof(boundary))) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    sd_upload_t *up = calloc(1, sizeof(*up));
+    if (!up) {
+        return ESP_ERR_NO_MEM;
+    }
+#ifdef ESP_PLATFORM
+    up->buf = heap_caps_malloc(SD_UPLOAD_BUFFER_SIZE, MALLOC_CAP_DMA);
+#else
+    up->buf = malloc(SD_UPLOAD_BUFFER_SIZE);
+#endif
+    static const multipart_callbacks_t callbacks = {
+        .on_part_begin = on_part_begin,
+        .on_part_data = on_part_data,
+        .on_part_end = on_part_end,
+    };
+    up->parser = multipart_parser_create(boundary, &callbacks, up);
+    if (!up->buf || !up->parser) {
+        multipart_parser_destroy(up->parser);
+        free(up->buf);
+        free(up);
+        return ESP_ERR_NO_MEM;
+    }
+    up->fd = -1;
+    snprintf(up->dir, sizeof(up->dir), "%s", dir);
+    *out = up;
+    return ESP_OK;
+}
+
+esp_err_t sd_upload_feed(sd_upload_t *up, const void *data, size_t len) {
+    return multipart_parser_feed(up->parser, data, len);
+}
+
+void sd_upload_abort(sd_upload_t *up) {
+    if (!up) {
+        return;
+    }
+    discard_part(up);
+    multipart_parser_destroy(up->parser);
+    free(up->buf);
+    free(up);
+}
+
+esp_err_t sd_upload_finish(sd_upload_t *up, sd_upload_result_t *result) {
+    esp_err_t ret = multipart_parser_finish(up->parser);
+    if (result) {
+        *result = up->result;
+    }
+    sd_upload_abort(up);
+    return ret;
+}
@@ -0,0 +1,917 @@
+#include "managers/sd_writer.h"
+#include "core/gzip_stream.h"
+#include "core/lz4_stream.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <time.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_log.h"
+#include "esp_pthread.h"
+#include "managers/sd_card_manager.h"
+#else
+#include <sys/statvfs.h>
+#define ESP_LOGE(tag, fmt, ...) fprintf(stderr, "E %s: " fmt "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...) fprintf(stderr, "W %s: " fmt "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, fmt, ...) fprintf(stderr, "I %s: " fmt "\n", tag, ##__VA_ARGS__)
+#endif
+
+static const char *TAG = "SD_WRITER";
+
+static const uint32_t latency_bounds_ms[SD_WRITER_LATENCY_BUCKETS - 1] = SD_WRITER_LATENCY_BOUNDS_MS;
+
+#define WRITER_IDLE_POLL_MS 250
+
+typedef struct sd_buf {
+    uint8_t *data;
+    size_t len;
+    size_t limit;                // Bytes this buffer may hold so that its write ends on a cluster boundary
+    int64_t first_write_us;
+    sd_writer_stream_t *stream;
+    struct sd_buf *next;
+} sd_buf_t;
+
+struct sd_writer_stream {
+    int fd;
+    sd_writer_stream_config_t config;
+    sd_buf_t *filling;
+    size_t cluster;              // Alignment of writes: the configured size or the volume's cluster
+    uint64_t queued_offset;      // File size once everything accepted so far is written
+    uint32_t in_flight;          // Buffers queued or being written
+    uint64_t written_offset;     // Bytes handed to write() or the codec; only touched by the writer thread
+    uint64_t file_offset;        // Bytes on the card; equals written_offset unless compressing
+    uint64_t allocated_end;      // File size on the card including preallocated space
+    void *codec;                 // lz4_stream_t or gzip_stream_t when config.codec is set
+    uint8_t *stage;              // Codec output gathered into cluster-aligned writes
+    size_t stage_len;
+    int64_t io_us;               // Time spent in write() for the buffer being processed
+    bool io_failed;
+    bool extended;               // Grown past the data at least once; truncate on close
+    uint64_t bytes_since_sync;
+    int64_t last_sync_us;
+    bool sync_requested;
+    bool checkpoint_pending;
+    bool checkpoint_running;
+    uint64_t checkpoint_offset;
+    sd_writer_checkpoint_fn checkpoint_fn;
+    void *checkpoint_ctx;
+    sd_writer_stream_t *next;
+};
+
+static struct {
+    bool running;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t work;         // Signalled when a buffer is queued or on shutdown
+    pthread_cond_t done;         // Signalled when a buffer returns to the pool
+    clockid_t cond_clock;
+    sd_writer_config_t config;
+    sd_buf_t *pool;
+    sd_buf_t *free_list;
+    uint32_t free_count;
+    sd_buf_t *queue_head;
+    sd_buf_t *queue_tail;
+    sd_writer_stream_t *streams;
+    sd_writer_metrics_t metrics;
+} writer = { .running = false };
+
+static int64_t now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void deadline_after_ms(struct timespec *ts, uint32_t ms) {
+    clock_gettime(writer.cond_clock, ts);
+    ts->tv_sec += ms / 1000;
+    ts->tv_nsec += (long)(ms % 1000) * 1000000;
+    if (ts->tv_nsec >= 1000000000) {
+        ts->tv_sec++;
+        ts->tv_nsec -= 1000000000;
+    }
+}
+
+static size_t stream_cluster(const sd_writer_stream_t *stream) {
+    return stream->cluster <= writer.config.buffer_size ? stream->cluster : writer.config.buffer_size;
+}
+
+// Cluster size of the volume the file is on: sectors per cluster times the sector size of the mounted
+// card, as sd_bench reports it, or the filesystem's fragment size on a host. 0 when it can't be read.
+static size_t volume_cluster_size(int fd) {
+#ifdef ESP_PLATFORM
+    (void)fd;
+    sd_bench_fs_t fs;
+    return sd_card_get_fs_stats(false, &fs) == ESP_OK ? fs.cluster_size : 0;
+#else
+    struct statvfs st;
+    return fstatvfs(fd, &st) == 0 ? (size_t)st.f_frsize : 0;
+#endif
+}
+
+// Size the next buffer so its write ends on a cluster boundary; after one short write every
+// following full buffer starts and ends aligned
+static size_t buffer_limit_at(const sd_writer_stream_t *stream, uint64_t offset) {
+    size_t cluster = stream_cluster(stream);
+    size_t limit = writer.config.buffer_size - (size_t)(offset % cluster);
+    return limit ? limit : writer.config.buffer_size;
+}
+
+// Must hold writer.lock
+static void enqueue_buffer(sd_buf_t *buf) {
+    buf->next = NULL;
+    if (writer.queue_tail) {
+        writer.queue_tail->next = buf;
+    } else {
+        writer.queue_head = buf;
+    }
+    writer.queue_tail = buf;
+    buf->stream->in_flight++;
+
+    writer.metrics.queue_depth++;
+    if (writer.metrics.queue_depth > writer.metrics.queue_high_water) {
+        writer.metrics.queue_high_water = writer.metrics.queue_depth;
+    }
+    pthread_cond_signal(&writer.work);
+}
+
+// Must hold writer.lock
+static void queue_partial(sd_writer_stream_t *stream) {
+    sd_buf_t *buf = stream->filling;
+    if (buf == NULL) {
+        return;
+    }
+    stream->filling = NULL;
+    if (buf->len == 0) {
+        buf->next = writer.free_list;
+        writer.free_list = buf;
+        writer.free_count++;
+        pthread_cond_broadcast(&writer.done);
+        return;
+    }
+    writer.metrics.partial_writes++;
+    enqueue_buffer(buf);
+}
+
+static void stream_sync(sd_writer_stream_t *stream) {
+    int64_t start = now_us();
+    fsync(stream->fd);
+    int64_t elapsed = now_us() - start;
+
+    pthread_mutex_lock(&writer.lock);
+    writer.metrics.fsyncs++;
+    writer.metrics.fsync_us_total += elapsed;
+    if (elapsed > writer.metrics.fsync_us_max) {
+        writer.metrics.fsync_us_max = (uint32_t)elapsed;
+    }
+    pthread_mutex_unlock(&writer.lock);
+
+    stream->bytes_since_sync = 0;
+    stream->last_sync_us = now_us();
+}
+
+// Must hold writer.lock
+static void record_write_latency(int64_t elapsed_us) {
+    int i = 0;
+    while (i < SD_WRITER_LATENCY_BUCKETS - 1 && elapsed_us >= (int64_t)latency_bounds_ms[i] * 1000) {
+        i++;
+    }
+    writer.metrics.write_latency_hist[i]++;
+}
+
+// Grow the file to cover needed in whole extents before the data gets there. FAT then allocates the
+// cluster chain in one long run instead of one cluster per write, which is where cheap cards stall.
+// Only called from the writer thread.
+static void stream_extend(sd_writer_stream_t *stream, uint64_t needed) {
+    uint64_t target = stream->allocated_end;
+    while (target < needed) {
+        target += stream->config.prealloc_bytes;
+    }
+
+    int64_t start = now_us();
+    stream->extended = true;
+#ifdef ESP_PLATFORM
+    // FatFs allocates the whole chain when a writable file is seeked past its end; the byte written at
+    // the new end makes the size stick
+    static const uint8_t zero = 0;
+    bool ok = lseek(stream->fd, (off_t)(target - 1), SEEK_SET) >= 0 && write(stream->fd, &zero, 1) == 1;
+#else
+    int rc = posix_fallocate(stream->fd, (off_t)stream->allocated_end, (off_t)(target - stream->allocated_end));
+    if (rc != 0) {
+        errno = rc;
+    }
+    bool ok = rc == 0;
+#endif
+    lseek(stream->fd, (off_t)stream->file_offset, SEEK_SET);
+    int64_t elapsed = now_us() - start;
+
+    if (ok) {
+        stream->allocated_end = target;
+    } else {
+        // Card full or the filesystem can't do it; carry on growing per write
+        ESP_LOGW(TAG, "Preallocation failed at %llu bytes: %s", (unsigned long long)target, strerror(errno));
+        stream->config.prealloc_bytes = 0;
+    }
+
+    pthread_mutex_lock(&writer.lock);
+    writer.metrics.prealloc_extents++;
+    writer.metrics.prealloc_us_total += elapsed;
+    if (elapsed > writer.metrics.prealloc_us_max) {
+        writer.metrics.prealloc_us_max = (uint32_t)elapsed;
+    }
+    pthread_mutex_unlock(&writer.lock);
+}
+
+// Write to the card, growing a preallocated file first. Only called from the writer thread, or from
+// close once nothing of the stream is in flight. Returns the bytes written.
+static size_t stream_put(sd_writer_stream_t *stream, const uint8_t *data, size_t len) {
+    if (stream->config.prealloc_bytes && stream->file_offset + len > stream->allocated_end) {
+        stream_extend(stream, stream->file_offset + len);
+    }
+
+    int64_t start = now_us();
+    size_t done = 0;
+    while (done < len) {
+        ssize_t n = write(stream->fd, data + done, len - done);
+        if (n <= 0) {
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        done += (size_t)n;
+    }
+    stream->io_us += now_us() - start;
+    stream->file_offset += done;
+    stream->bytes_since_sync += done;
+    if (done < len) {
+        stream->io_failed = true;
+        ESP_LOGE(TAG, "Short write (%u of %u bytes): %s", (unsigned)done, (unsigned)len, strerror(errno));
+    }
+    return done;
+}
+
+// Codec output sink. Output is staged so the card sees cluster-sized writes on cluster boundaries,
+// the same shape as uncompressed buffers.
+static esp_err_t codec_sink(void *ctx, const uint8_t *data, size_t len) {
+    sd_writer_stream_t *stream = ctx;
+    size_t cluster = stream_cluster(stream);
+
+    while (len > 0) {
+        size_t room = cluster - (size_t)((stream->file_offset + stream->stage_len) % cluster);
+        if (stream->stage_len == 0 && len >= room) {
+            size_t n = room + (len - room) / cluster * cluster;
+            if (stream_put(stream, data, n) != n) {
+                return ESP_FAIL;
+            }
+            data += n;
+            len -= n;
+            continue;
+        }
+
+        size_t n = len < room ? len : room;
+        memcpy(stream->stage + stream->stage_len, data, n);
+        stream->stage_len += n;
+        data += n;
+        len -= n;
+        if (n == room) {
+            size_t staged = stream->stage_len;
+            stream->stage_len = 0;
+            if (stream_put(stream, stream->stage, staged) != staged) {
+                return ESP_FAIL;
+            }
+        }
+    }
+    return ESP_OK;
+}
+
+static esp_err_t codec_write(sd_writer_stream_t *stream, const uint8_t *data, size_t len) {
+    return stream->config.codec == SD_WRITER_CODEC_GZIP ? gzip_stream_write(stream->codec, data, len)
+                                                        : lz4_stream_write(stream->codec, data, len);
+}
+
+// Make everything compressed so far readable from the card: end the LZ4 block or gzip member and
+// write out the staged tail. With finish, end the stream for good.
+static esp_err_t codec_flush(sd_writer_stream_t *stream, bool finish) {
+    esp_err_t err;
+    if (stream->config.codec == SD_WRITER_CODEC_GZIP) {
+        err = finish ? gzip_stream_finish(stream->codec) : gzip_stream_new_member(stream->codec);
+    } else {
+        err = finish ? lz4_stream_finish(stream->codec) : lz4_stream_flush(stream->codec);
+    }
+    if (stream->stage_len > 0) {
+        size_t staged = stream->stage_len;
+        stream->stage_len = 0;
+        if (stream_put(stream, stream->stage, staged) != staged) {
+            err = ESP_FAIL;
+        }
+    }
+    return err;
+}
+
+static void codec_destroy(sd_writer_stream_t *stream) {
+    if (stream->config.codec == SD_WRITER_CODEC_GZIP) {
+        gzip_stream_destroy(stream->codec);
+    } else {
+        lz4_stream_destroy(stream->codec);
+    }
+    stream->codec = NULL;
+    free(stream->stage);
+    stream->stage = NULL;
+}
+
+// Must hold writer.lock
+static void record_codec(int64_t elapsed_us, uint64_t in, uint64_t out) {
+    writer.metrics.codec_us_total += elapsed_us > 0 ? (uint64_t)elapsed_us : 0;
+    writer.metrics.codec_bytes_in += in;
+    writer.metrics.codec_bytes_out += out;
+}
+
+// Must hold writer.lock; drops it while syncing. Returns true if a checkpoint ran.
+static bool run_checkpoint_locked(sd_writer_stream_t *stream) {
+    if (!stream->checkpoint_pending || stream->written_offset < stream->checkpoint_offset) {
+        return false;
+    }
+
+    uint64_t offset = stream->checkpoint_offset;
+    sd_writer_checkpoint_fn fn = stream->checkpoint_fn;
+    void *ctx = stream->checkpoint_ctx;
+    stream->checkpoint_pending = false;
+    stream->checkpoint_running = true;
+    pthread_mutex_unlock(&writer.lock);
+
+    int64_t codec_us = 0;
+    uint64_t file_before = stream->file_offset;
+    if (stream->codec) {
+        stream->io_us = 0;
+        int64_t start = now_us();
+        bool ok = codec_flush(stream, false) == ESP_OK;
+        codec_us = now_us() - start - stream->io_us;
+        // The journal must only ever point at a position the codec output is complete up to
+        offset = ok ? stream->file_offset : 0;
+    }
+    stream_sync(stream);
+    if (fn && (offset > 0 || stream->codec == NULL)) {
+        fn(ctx, offset);
+    }
+
+    pthread_mutex_lock(&writer.lock);
+    if (stream->codec) {
+        writer.metrics.bytes_written += stream->file_offset - file_before;
+        record_codec(codec_us, 0, stream->file_offset - file_before);
+    }
+    stream->checkpoint_running = false;
+    pthread_cond_broadcast(&writer.done);
+    return true;
+}
+
+static void *writer_thread(void *arg) {
+    (void)arg;
+    pthread_mutex_lock(&writer.lock);
+
+    while (writer.running || writer.queue_head != NULL) {
+        if (writer.queue_head == NULL) {
+            struct timespec deadline;
+            uint32_t poll_ms = writer.config.max_latency_ms < WRITER_IDLE_POLL_MS ? writer.config.max_latency_ms
+                                                                                   : WRITER_IDLE_POLL_MS;
+            deadline_after_ms(&deadline, poll_ms ? poll_ms : WRITER_IDLE_POLL_MS);
+            pthread_cond_timedwait(&writer.work, &writer.lock, &deadline);
+
+            // Slow producers still reach the card within max_latency_ms
+            int64_t now = now_us();
+            for (sd_writer_stream_t *s = writer.streams; s != NULL; s = s->next) {
+                if (s->filling && s->filling->len > 0 &&
+                    now - s->filling->first_write_us >= (int64_t)writer.config.max_latency_ms * 1000) {
+                    queue_partial(s);
+                }
+            }
+
+            // Checkpoints requested after their data was already written
+            for (sd_writer_stream_t *s = writer.streams; s != NULL; s = s->next) {
+                if (run_checkpoint_locked(s)) {
+                    break;
+                }
+            }
+            continue;
+        }
+
+        sd_buf_t *buf = writer.queue_head;
+        writer.queue_head = buf->next;
+        if (writer.queue_head == NULL) {
+            writer.queue_tail = NULL;
+        }
+        writer.metrics.queue_depth--;
+        pthread_mutex_unlock(&writer.lock);
+
+        sd_writer_stream_t *stream = buf->stream;
+        uint64_t file_before = stream->file_offset;
+        size_t done;
+        int64_t codec_us = 0;
+        stream->io_us = 0;
+        stream->io_failed = false;
+        if (stream->codec) {
+            int64_t start = now_us();
+            // A codec error sticks, so everything from here on is lost
+            done = codec_write(stream, buf->data, buf->len) == ESP_OK ? buf->len : 0;
+            codec_us = now_us() - start - stream->io_us;
+        } else {
+            done = stream_put(stream, buf->data, buf->len);
+        }
+        int64_t elapsed = stream->io_us;
+        uint64_t file_bytes = stream->file_offset - file_before;
+        stream->written_offset += done;
+
+        bool sync = false;
+        if (stream->config.sync_bytes && stream->bytes_since_sync >= stream->config.sync_bytes) {
+            sync = true;
+        }
+        if (stream->config.sync_interval_ms &&
+            now_us() - stream->last_sync_us >= (int64_t)stream->config.sync_interval_ms * 1000) {
+            sync = true;
+        }
+
+        pthread_mutex_lock(&writer.lock);
+        bool last_in_flight = stream->in_flight == 1;
+        if (last_in_flight && stream->sync_requested) {
+            sync = true;
+            stream->sync_requested = false;
+        }
+        pthread_mutex_unlock(&writer.lock);
+
+        pthread_mutex_lock(&writer.lock);
+        if (!run_checkpoint_locked(stream) && sync) {
+            pthread_mutex_unlock(&writer.lock);
+            stream_sync(stream);
+            pthread_mutex_lock(&writer.lock);
+        }
+        // Compressed buffers often only fill the stage; they count as a write once output reaches the card
+        if (file_bytes > 0 || stream->io_failed) {
+            writer.metrics.writes++;
+            writer.metrics.bytes_written += file_bytes;
+            writer.metrics.write_us_total += elapsed;
+            if (elapsed > writer.metrics.write_us_max) {
+                writer.metrics.write_us_max = (uint32_t)elapsed;
+            }
+            record_write_latency(elapsed);
+        }
+        if (stream->codec) {
+            record_codec(codec_us, buf->len, file_bytes);
+        }
+        if (done < buf->len || stream->io_failed) {
+            writer.metrics.write_errors++;
+            writer.metrics.bytes_dropped += buf->len - done;
+        }
+
+        stream->in_flight--;
+        buf->len = 0;
+        buf->stream = NULL;
+        buf->next = writer.free_list;
+        writer.free_list = buf;
+        writer.free_count++;
+        pthread_cond_broadcast(&writer.done);
+    }
+
+    pthread_mutex_unlock(&writer.lock);
+    return NULL;
+}
+
+esp_err_t sd_writer_init(const sd_writer_config_t *config) {
+    if (writer.running) {
+        return ESP_OK;
+    }
+
+    sd_writer_config_t cfg = {
+        .buffer_size = SD_WRITER_DEFAULT_BUFFER_SIZE,
+        .buffer_count = SD_WRITER_DEFAULT_BUFFER_COUNT,
+        .max_latency_ms = SD_WRITER_DEFAULT_MAX_LATENCY_MS,
+        .task_priority = 4,
+        .stack_size = 4096,
+    };
+    if (config != NULL) {
+        cfg = *config;
+    }
+    if (cfg.buffer_size < 512 || cfg.buffer_count < 2) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(&writer.metrics, 0, sizeof(writer.metrics));
+    writer.config = cfg;
+    writer.pool = calloc(cfg.buffer_count, sizeof(sd_buf_t));
+    if (writer.pool == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    writer.free_list = NULL;
+    writer.free_count = 0;
+    for (size_t i = 0; i < cfg.buffer_count; i++) {
+        writer.pool[i].data = malloc(cfg.buffer_size);
+        if (writer.pool[i].data == NULL) {
+            for (size_t j = 0; j < i; j++) {
+                free(writer.pool[j].data);
+            }
+            free(writer.pool);
+            writer.pool = NULL;
+            ESP_LOGE(TAG, "Failed to allocate %u x %u byte write buffers", (unsigned)cfg.buffer_count,
+                     (unsigned)cfg.buffer_size);
+            return ESP_ERR_NO_MEM;
+        }
+        writer.pool[i].next = writer.free_list;
+        writer.free_list = &writer.pool[i];
+        writer.free_count++;
+    }
+
+    pthread_mutex_init(&writer.lock, NULL);
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    writer.cond_clock = pthread_condattr_setclock(&attr, CLOCK_MONOTONIC) == 0 ? CLOCK_MONOTONIC : CLOCK_REALTIME;
+    pthread_cond_init(&writer.work, &attr);
+    pthread_cond_init(&writer.done, &attr);
+    pthread_condattr_destroy(&attr);
+
+    writer.queue_head = writer.queue_tail = NULL;
+    writer.streams = NULL;
+    writer.running = true;
+
+#ifdef ESP_PLATFORM
+    esp_pthread_cfg_t pthread_cfg = esp_pthread_get_default_config();
+    pthread_cfg.stack_size = cfg.stack_size;
+    pthread_cfg.prio = cfg.task_priority;
+    pthread_cfg.thread_name = "sd_writer";
+    esp_pthread_set_cfg(&pthread_cfg);
+#endif
+
+    if (pthread_create(&writer.thread, NULL, writer_thread, NULL) != 0) {
+        writer.running = false;
+        for (size_t i = 0; i < cfg.buffer_count; i++) {
+            free(writer.pool[i].data);
+        }
+        free(writer.pool);
+        writer.pool = NULL;
+        ESP_LOGE(TAG, "Failed to start writer thread");
+        return ESP_FAIL;
+    }
+
+#ifdef ESP_PLATFORM
+    pthread_cfg = esp_pthread_get_default_config();
+    esp_pthread_set_cfg(&pthread_cfg);
+#endif
+
+    return ESP_OK;
+}
+
+void sd_writer_deinit(void) {
+    if (!writer.running) {
+        return;
+    }
+
+    while (writer.streams != NULL) {
+        sd_writer_close(writer.streams);
+    }
+
+    pthread_mutex_lock(&writer.lock);
+    writer.running = false;
+    pthread_cond_signal(&writer.work);
+    pthread_mutex_unlock(&writer.lock);
+    pthread_join(writer.thread, NULL);
+
+    for (size_t i = 0; i < writer.config.buffer_count; i++) {
+        free(writer.pool[i].data);
+    }
+    free(writer.pool);
+    writer.pool = NULL;
+    writer.free_list = NULL;
+    writer.free_count = 0;
+
+    pthread_cond_destroy(&writer.work);
+    pthread_cond_destroy(&writer.done);
+    pthread_mutex_destroy(&writer.lock);
+}
+
+sd_writer_stream_t *sd_writer_open(const char *path, const char *mode, const sd_writer_stream_config_t *config) {
+    if (!writer.running && sd_writer_init(NULL) != ESP_OK) {
+        return NULL;
+    }
+
+    bool append = mode != NULL && mode[0] == 'a';
+    bool prealloc = config != NULL && config->prealloc_bytes > 0;
+    // With preallocation the end of the file is past the data, so appends track the offset themselves
+    int fd = open(path, O_WRONLY | O_CREAT | (append ? (prealloc ? 0 : O_APPEND) : O_TRUNC), 0666);
+    if (fd < 0) {
+        ESP_LOGE(TAG, "Failed to open %s: %s", path, strerror(errno));
+        return NULL;
+    }
+
+    sd_writer_stream_t *stream = calloc(1, sizeof(sd_writer_stream_t));
+    if (stream == NULL) {
+        close(fd);
+        return NULL;
+    }
+
+    stream->fd = fd;
+    if (config != NULL) {
+        stream->config = *config;
+    } else {
+        stream->config.sync_on_close = true;
+    }
+    stream->cluster = stream->config.cluster_size ? stream->config.cluster_size : volume_cluster_size(fd);
+    if (stream->cluster == 0) {
+        stream->cluster = SD_WRITER_DEFAULT_CLUSTER_SIZE;
+    }
+    if (append) {
+        off_t end = lseek(fd, 0, SEEK_END);
+        stream->queued_offset = end > 0 ? (uint64_t)end : 0;
+        stream->written_offset = stream->queued_offset;
+    }
+    stream->file_offset = stream->written_offset;
+    stream->allocated_end = stream->queued_offset;
+    stream->last_sync_us = now_us();
+
+    // Appending starts a new LZ4 frame or gzip member, which decompressors read as a continuation
+    if (stream->config.codec != SD_WRITER_CODEC_NONE) {
+        int level = stream->config.codec_level;
+        stream->stage = malloc(stream_cluster(stream));
+        if (stream->config.codec == SD_WRITER_CODEC_GZIP) {
+            stream->codec = gzip_stream_create(level ? level : GZIP_STREAM_DEFAULT_LEVEL, codec_sink, stream);
+        } else {
+            stream->codec = lz4_stream_create(level ? level : LZ4_STREAM_DEFAULT_LEVEL, codec_sink, stream);
+        }
+        if (stream->codec == NULL || stream->stage == NULL) {
+            ESP_LOGE(TAG, "No memory for %s compression of %s", sd_writer_codec_name(stream->config.codec), path);
+            if (stream->codec) {
+                codec_destroy(stream);
+            }
+            free(stream->stage);
+            close(fd);
+            free(stream);
+            return NULL;
+        }
+    }
+
+    pthread_mutex_lock(&writer.lock);
+    stream->next = writer.streams;
+    writer.streams = stream;
+    pthread_mutex_unlock(&writer.lock);
+
+    return stream;
+}
+
+// Must hold writer.lock. Bytes the stream can accept right now without waiting.
+static size_t stream_space(const sd_writer_stream_t *stream) {
+    size_t space = 0;
+    uint64_t offset = stream->queued_offset;
+    if (stream->filling) {
+        space = stream->filling->limit - stream->filling->len;
+        offset += space;
+    }
+    if (writer.free_count > 0) {
+        space += buffer_limit_at(stream, offset) + (size_t)(writer.free_count - 1) * writer.config.buffer_size;
+    }
+    return space;
+}
+
+esp_err_t sd_writer_writev(sd_writer_stream_t *stream, const sd_writer_iov_t *iov, int iovcnt, uint32_t timeout_ms) {
+    if (stream == NULL || (iov == NULL && iovcnt > 0)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    size_t total = 0;
+    for (int i = 0; i < iovcnt; i++) {
+        total += iov[i].len;
+    }
+    if (total == 0) {
+        return ESP_OK;
+    }
+    if (total > writer.config.buffer_size * (writer.config.buffer_count - 1)) {
+        return ESP_ERR_INVALID_ARG;  // Could never fit while another stream holds a buffer
+    }
+
+    pthread_mutex_lock(&writer.lock);
+    writer.metrics.bytes_submitted += total;
+
+    if (stream_space(stream) < total) {
+        writer.metrics.backpressure_events++;
+        if (timeout_ms > 0) {
+            struct timespec deadline;
+            deadline_after_ms(&deadline, timeout_ms);
+            while (stream_space(stream) < total) {
+                if (pthread_cond_timedwait(&writer.done, &writer.lock, &deadline) != 0) {
+                    break;
+                }
+            }
+        }
+        if (stream_space(stream) < total) {
+            writer.metrics.bytes_dropped += total;
+            pthread_mutex_unlock(&writer.lock);
+            return ESP_ERR_TIMEOUT;
+        }
+    }
+
+    for (int i = 0; i < iovcnt; i++) {
+        const uint8_t *src = iov[i].data;
+        size_t len = iov[i].len;
+
+        while (len > 0) {
+            sd_buf_t *buf = stream->filling;
+            if (buf == NULL) {
+                buf = writer.free_list;
+                writer.free_list = buf->next;
+                writer.free_count--;
+                buf->len = 0;
+                buf->limit = buffer_limit_at(stream, stream->queued_offset);
+                buf->stream = stream;
+                buf->first_write_us = now_us();
+                stream->filling = buf;
+            }
+
+            size_t n = buf->limit - buf->len;
+            if (n > len) {
+                n = len;
+            }
+            memcpy(buf->data + buf->len, src, n);
+            buf->len += n;
+            src += n;
+            len -= n;
+            stream->queued_offset += n;
+
+            if (buf->len == buf->limit) {
+                stream->filling = NULL;
+                enqueue_buffer(buf);
+            }
+        }
+    }
+
+    pthread_mutex_unlock(&writer.lock);
+    return ESP_OK;
+}
+
+esp_err_t sd_writer_write(sd_writer_stream_t *stream, const void *data, size_t len, uint32_t timeout_ms) {
+    sd_writer_iov_t iov = { .data = data, .len = len };
+    return sd_writer_writev(stream, &iov, 1, timeout_ms);
+}
+
+esp_err_t sd_writer_flush(sd_writer_stream_t *stream, bool wait, bool sync) {
+    if (stream == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&writer.lock);
+    queue_partial(stream);
+
+    if (!wait) {
+        if (sync) {
+            if (stream->in_flight > 0) {
+                stream->sync_requested = true;
+            } else {
+                pthread_mutex_unlock(&writer.lock);
+                stream_sync(stream);
+                return ESP_OK;
+            }
+        }
+        pthread_mutex_unlock(&writer.lock);
+        return ESP_OK;
+    }
+
+    while (stream->in_flight > 0 || stream->checkpoint_running) {
+        pthread_cond_wait(&writer.done, &writer.lock);
+    }
+    stream->sync_requested = false;
+    pthread_mutex_unlock(&writer.lock);
+
+    // Nothing of this stream is queued any more, so syncing here can't race the writer thread
+    if (sync) {
+        stream_sync(stream);
+    }
+    return ESP_OK;
+}
+
+esp_err_t sd_writer_checkpoint(sd_writer_stream_t *stream, sd_writer_checkpoint_fn fn, void *ctx) {
+    if (stream == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&writer.lock);
+    // A newer checkpoint supersedes one that hasn't been reached yet
+    stream->checkpoint_offset = stream->queued_offset;
+    stream->checkpoint_fn = fn;
+    stream->checkpoint_ctx = ctx;
+    stream->checkpoint_pending = true;
+    queue_partial(stream);
+    if (stream->in_flight == 0) {
+        pthread_cond_signal(&writer.work);
+    }
+    pthread_mutex_unlock(&writer.lock);
+    return ESP_OK;
+}
+
+esp_err_t sd_writer_close(sd_writer_stream_t *stream) {
+    if (stream == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // The close sync covers any checkpoint not reached yet
+    pthread_mutex_lock(&writer.lock);
+    stream->checkpoint_pending = false;
+    pthread_mutex_unlock(&writer.lock);
+
+    sd_writer_flush(stream, true, stream->config.sync_on_close && stream->codec == NULL);
+
+    pthread_mutex_lock(&writer.lock);
+    for (sd_writer_stream_t **p = &writer.streams; *p != NULL; p = &(*p)->next) {
+        if (*p == stream) {
+            *p = stream->next;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&writer.lock);
+
+    // Nothing of the stream is in flight any more, so the codec can be finished on this thread
+    esp_err_t codec_err = ESP_OK;
+    if (stream->codec) {
+        uint64_t file_before = stream->file_offset;
+        codec_err = codec_flush(stream, true);
+        pthread_mutex_lock(&writer.lock);
+        writer.metrics.bytes_written += stream->file_offset - file_before;
+        record_codec(0, 0, stream->file_offset - file_before);
+        pthread_mutex_unlock(&writer.lock);
+        codec_destroy(stream);
+    }
+
+    // Drop the preallocated tail; until here a crash leaves it for capture_journal_recover() to cut
+    if (stream->extended && ftruncate(stream->fd, (off_t)stream->file_offset) != 0) {
+        ESP_LOGW(TAG, "Failed to trim preallocated file: %s", strerror(errno));
+    }
+    if (codec_err == ESP_OK && stream->config.codec != SD_WRITER_CODEC_NONE && stream->config.sync_on_close) {
+        stream_sync(stream);
+    }
+
+    int ret = close(stream->fd);
+    free(stream);
+    return ret == 0 && codec_err == ESP_OK ? ESP_OK : ESP_FAIL;
+}
+
+uint64_t sd_writer_stream_size(const sd_writer_stream_t *stream) {
+    if (stream == NULL) {
+        return 0;
+    }
+    // A 64-bit load is two instructions on the ESP32, so read it under the lock writev updates it under
+    pthread_mutex_lock(&writer.lock);
+    uint64_t size = stream->queued_offset;
+    pthread_mutex_unlock(&writer.lock);
+    return size;
+}
+
+sd_writer_codec_t sd_writer_stream_codec(const sd_writer_stream_t *stream) {
+    return stream ? stream->config.codec : SD_WRITER_CODEC_NONE;
+}
+
+const char *sd_writer_codec_name(sd_writer_codec_t codec) {
+    switch (codec) {
+        case SD_WRITER_CODEC_LZ4: return "lz4";
+        case SD_WRITER_CODEC_GZIP: return "gzip";
+        default: return "none";
+    }
+}
+
+const char *sd_writer_codec_suffix(sd_writer_codec_t codec) {
+    switch (codec) {
+        case SD_WRITER_CODEC_LZ4: return ".lz4";
+        case SD_WRITER_CODEC_GZIP: return ".gz";
+        default: return "";
+    }
+}
+
+bool sd_writer_stream_preallocated(const sd_writer_stream_t *stream) {
+    return stream != NULL && stream->config.prealloc_bytes > 0;
+}
+
+bool sd_writer_backpressure(void) {
+    if (!writer.running) {
+        return false;
+    }
+    return writer.free_count * 4 < writer.config.buffer_count;
+}
+
+void sd_writer_get_metrics(sd_writer_metrics_t *out) {
+    if (!writer.running) {
+        *out = writer.metrics;
+        return;
+    }
+    pthread_mutex_lock(&writer.lock);
+    *out = writer.metrics;
+    pthread_mutex_unlock(&writer.lock);
+}
+
+void sd_writer_reset_metrics(void) {
+    if (!writer.running) {
+        memset(&writer.metrics, 0, sizeof(writer.metrics));
+        return;
+    }
+    pthread_mutex_lock(&writer.lock);
+    uint32_t depth = writer.metrics.queue_depth;
+    memset(&writer.metrics, 0, sizeof(writer.metrics));
+    writer.metrics.queue_depth = depth;
+    pthread_mutex_unlock(&writer.lock);
+}
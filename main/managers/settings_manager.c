@@ -1,34 +1,94 @@
 #include "managers/settings_manager.h"
 #include "managers/rgb_manager.h"
+#include "managers/settings_store.h"
+#include <stddef.h>
 #include <string.h>
 #include <esp_log.h>
+#include <esp_system.h>
 
 #define S_TAG "SETTINGS"
 
-// NVS Keys
-static const char* NVS_RGB_MODE_KEY = "rgb_mode";
-static const char* NVS_CHANNEL_DELAY_KEY = "channel_delay";
-static const char* NVS_BROADCAST_SPEED_KEY = "broadcast_speed";
-static const char* NVS_AP_SSID_KEY = "ap_ssid";
-static const char* NVS_AP_PASSWORD_KEY = "ap_password";
-static const char* NVS_RGB_SPEED_KEY = "rgb_speed";
-static const char* NVS_PORTAL_URL_KEY = "portal_url";
-static const char* NVS_PORTAL_SSID_KEY = "portal_ssid";
-static const char* NVS_PORTAL_PASSWORD_KEY = "portal_password";
-static const char* NVS_PORTAL_AP_SSID_KEY = "portal_ap_ssid";
-static const char* NVS_PORTAL_DOMAIN_KEY = "portal_domain";
-static const char* NVS_PORTAL_OFFLINE_KEY = "portal_offline";
-static const char* NVS_PRINTER_IP_KEY = "printer_ip";
-static const char* NVS_PRINTER_TEXT_KEY = "printer_text";
-static const char* NVS_PRINTER_FONT_SIZE_KEY = "printer_font_size";
-static const char* NVS_PRINTER_ALIGNMENT_KEY = "printer_alignment";
-static const char* NVS_PRINTER_CONNECTED_KEY = "printer_connected";
-static const char* NVS_BOARD_TYPE_KEY = "board_type";
-static const char* NVS_CUSTOM_PIN_CONFIG_KEY = "custom_pin_config";
-static const char* NVS_FLAPPY_GHOST_NAME = "flap_name";
-static const char* NVS_TIMEZONE_NAME = "sel_tz";
-static const char* NVS_ACCENT_COLOR = "sel_ac";
-static const char* NVS_GPS_RX_PIN = "gps_rx_pin";
+// Fields of the settings record, by index. Append only: the index is what the record stores. The keys
+// are the ones each field had before the record and are only read to migrate, then erased.
+#define SETTING_RAW(member, key, legacy) \
+    { offsetof(FSettings, member), sizeof(((FSettings*)0)->member), SETTINGS_FIELD_RAW, key, legacy }
+#define SETTING_STR(member, key) \
+    { offsetof(FSettings, member), sizeof(((FSettings*)0)->member), SETTINGS_FIELD_STR, key, SETTINGS_LEGACY_STR }
+
+static const settings_field_t settings_fields[] = {
+    SETTING_RAW(rgb_mode, "rgb_mode", SETTINGS_LEGACY_U8),
+    SETTING_RAW(channel_delay, "channel_delay", SETTINGS_LEGACY_BLOB),
+    SETTING_RAW(broadcast_speed, "broadcast_speed", SETTINGS_LEGACY_U16),
+    SETTING_STR(ap_ssid, "ap_ssid"),
+    SETTING_STR(ap_password, "ap_password"),
+    SETTING_RAW(rgb_speed, "rgb_speed", SETTINGS_LEGACY_U8),
+    SETTING_STR(portal_url, "portal_url"),
+    SETTING_STR(portal_ssid, "portal_ssid"),
+    SETTING_STR(portal_password, "portal_password"),
+    SETTING_STR(portal_ap_ssid, "portal_ap_ssid"),
+    SETTING_STR(portal_domain, "portal_domain"),
+    SETTING_RAW(portal_offline_mode, "portal_offline", SETTINGS_LEGACY_U8),
+    SETTING_STR(printer_ip, "printer_ip"),
+    SETTING_STR(printer_text, "printer_text"),
+    // The old keys for these two were longer than NVS allows, so they were never stored
+    SETTING_RAW(printer_font_size, NULL, SETTINGS_LEGACY_NONE),
+    SETTING_RAW(printer_alignment, NULL, SETTINGS_LEGACY_NONE),
+    SETTING_STR(flappy_ghost_name, "flap_name"),
+    SETTING_STR(selected_timezone, "sel_tz"),
+    SETTING_STR(selected_hex_accent_color, "sel_ac"),
+    SETTING_RAW(gps_rx_pin, "gps_rx_pin", SETTINGS_LEGACY_U8),
+};
+
+#define SETTINGS_RECORD_KEY "settings"
+#define SETTINGS_SCHEMA 1
+
+static settings_store_t* store;
+
+// NVS calls for the store, on the handle opened in settings_init
+static esp_err_t nvs_store_get_blob(void* ctx, const char* key, void* out, size_t* len) {
+    return nvs_get_blob(nvsHandle, key, out, len);
+}
+
+static esp_err_t nvs_store_set_blob(void* ctx, const char* key, const void* data, size_t len) {
+    return nvs_set_blob(nvsHandle, key, data, len);
+}
+
+static esp_err_t nvs_store_get_u8(void* ctx, const char* key, uint8_t* out) {
+    return nvs_get_u8(nvsHandle, key, out);
+}
+
+static esp_err_t nvs_store_get_u16(void* ctx, const char* key, uint16_t* out) {
+    return nvs_get_u16(nvsHandle, key, out);
+}
+
+static esp_err_t nvs_store_get_u64(void* ctx, const char* key, uint64_t* out) {
+    return nvs_get_u64(nvsHandle, key, out);
+}
+
+static esp_err_t nvs_store_set_u64(void* ctx, const char* key, uint64_t value) {
+    return nvs_set_u64(nvsHandle, key, value);
+}
+
+static esp_err_t nvs_store_get_str(void* ctx, const char* key, char* out, size_t* len) {
+    return nvs_get_str(nvsHandle, key, out, len);
+}
+
+static esp_err_t nvs_store_set_str(void* ctx, const char* key, const char* value) {
+    return nvs_set_str(nvsHandle, key, value);
+}
+
+static esp_err_t nvs_store_erase_key(void* ctx, const char* key) {
+    return nvs_erase_key(nvsHandle, key);
+}
+
+static esp_err_t nvs_store_commit(void* ctx) {
+    return nvs_commit(nvsHandle);
+}
+
+// esp_restart() from anywhere still saves a change made within the debounce window
+static void settings_shutdown_handler(void) {
+    settings_flush();
+}
 
 void settings_init(FSettings* settings) {
     settings_set_defaults(settings);
@@ -39,15 +99,45 @@ void settings_init(FSettings* settings) {
     }
 
     err = nvs_open("storage", NVS_READWRITE, &nvsHandle);
-    if (err == ESP_OK) {
-        settings_load(settings);
-        printf("Settings loaded successfully.\n");
-    } else {
+    if (err != ESP_OK) {
         printf("Failed to open NVS handle: %s\n", esp_err_to_name(err));
-    }
+        return;
+    }
+
+    settings_store_config_t config = {
+        .key = SETTINGS_RECORD_KEY,
+        .schema = SETTINGS_SCHEMA,
+        .fields = settings_fields,
+        .field_count = sizeof(settings_fields) / sizeof(settings_fields[0]),
+        .data_size = sizeof(FSettings),
+        .nvs = {
+            .get_blob = nvs_store_get_blob,
+            .set_blob = nvs_store_set_blob,
+            .get_u8 = nvs_store_get_u8,
+            .get_u16 = nvs_store_get_u16,
+            .get_u64 = nvs_store_get_u64,
+            .set_u64 = nvs_store_set_u64,
+            .get_str = nvs_store_get_str,
+            .set_str = nvs_store_set_str,
+            .erase_key = nvs_store_erase_key,
+            .commit = nvs_store_commit,
+        },
+        .stack_size = 3072,
+    };
+    store = settings_store_create(&config);
+    if (store == NULL) {
+        printf("Failed to start settings store\n");
+        return;
+    }
+    settings_load(settings);
+    esp_register_shutdown_handler(settings_shutdown_handler);
+    printf("Settings loaded successfully.\n");
 }
 
 void settings_deinit(void) {
+    esp_unregister_shutdown_handler(settings_shutdown_handler);
+    settings_store_destroy(store);
+    store = NULL;
     nvs_close(nvsHandle);
 }
 
@@ -79,250 +169,28 @@ void settings_set_defaults(FSettings* settings) {
 }
 
 void settings_load(FSettings* settings) {
-    esp_err_t err;
-    uint8_t value_u8;
-    uint16_t value_u16;
-    float value_float;
-    size_t str_size;
-
-    // Load RGB Mode
-    err = nvs_get_u8(nvsHandle, NVS_RGB_MODE_KEY, &value_u8);
-    if (err == ESP_OK) {
-        settings->rgb_mode = (RGBMode)value_u8;
+    if (store == NULL) {
+        return;
     }
-
-    size_t required_size = sizeof(value_float); // Set the size of the buffer
-    err = nvs_get_blob(nvsHandle, NVS_CHANNEL_DELAY_KEY, &value_float, &required_size);
-    if (err == ESP_OK) {
-        settings->channel_delay = value_float;
-    } else {
-        printf("Failed to load Channel Delay: %s\n", esp_err_to_name(err));
-    }
-
-    // Load Broadcast Speed
-    err = nvs_get_u16(nvsHandle, NVS_BROADCAST_SPEED_KEY, &value_u16);
-    if (err == ESP_OK) {
-        settings->broadcast_speed = value_u16;
-    }
-
-    // Load AP SSID
-    str_size = sizeof(settings->ap_ssid);
-    err = nvs_get_str(nvsHandle, NVS_AP_SSID_KEY, settings->ap_ssid, &str_size);
-    if (err != ESP_OK) {
-        printf("Failed to load AP SSID\n");
-    }
-
-    // Load AP Password
-    str_size = sizeof(settings->ap_password);
-    err = nvs_get_str(nvsHandle, NVS_AP_PASSWORD_KEY, settings->ap_password, &str_size);
+    esp_err_t err = settings_store_load(store, settings);
     if (err != ESP_OK) {
-        printf("Failed to load AP Password\n");
+        printf("Failed to load settings: %s\n", esp_err_to_name(err));
+        return;
     }
 
-    // Load RGB Speed
-    err = nvs_get_u8(nvsHandle, NVS_RGB_SPEED_KEY, &value_u8);
-    if (err == ESP_OK) {
-        settings->rgb_speed = value_u8;
-    }
-
-    // Load Evil Portal settings
-    str_size = sizeof(settings->portal_url);
-    err = nvs_get_str(nvsHandle, NVS_PORTAL_URL_KEY, settings->portal_url, &str_size);
-    if (err != ESP_OK) {
-        printf("Failed to load Portal URL\n");
-    }
-
-    str_size = sizeof(settings->portal_ssid);
-    err = nvs_get_str(nvsHandle, NVS_PORTAL_SSID_KEY, settings->portal_ssid, &str_size);
-    if (err != ESP_OK) {
-        printf("Failed to load Portal SSID\n");
-    }
-
-    str_size = sizeof(settings->portal_password);
-    err = nvs_get_str(nvsHandle, NVS_PORTAL_PASSWORD_KEY, settings->portal_password, &str_size);
-    if (err != ESP_OK) {
-        printf("Failed to load Portal Password\n");
-    }
-
-    str_size = sizeof(settings->portal_ap_ssid);
-    err = nvs_get_str(nvsHandle, NVS_PORTAL_AP_SSID_KEY, settings->portal_ap_ssid, &str_size);
-    if (err != ESP_OK) {
-        printf("Failed to load Portal AP SSID\n");
-    }
-
-    str_size = sizeof(settings->portal_domain);
-    err = nvs_get_str(nvsHandle, NVS_PORTAL_DOMAIN_KEY, settings->portal_domain, &str_size);
-    if (err != ESP_OK) {
-        printf("Failed to load Portal Domain\n");
-    }
-
-    err = nvs_get_u8(nvsHandle, NVS_PORTAL_OFFLINE_KEY, &value_u8);
-    if (err == ESP_OK) {
-        settings->portal_offline_mode = value_u8;
-    }
-
-    // Load Power Printer settings
-    str_size = sizeof(settings->printer_ip);
-    err = nvs_get_str(nvsHandle, NVS_PRINTER_IP_KEY, settings->printer_ip, &str_size);
-    if (err != ESP_OK) {
-        printf("Failed to load Printer IP\n");
-    }
-
-    str_size = sizeof(settings->printer_text);
-    err = nvs_get_str(nvsHandle, NVS_PRINTER_TEXT_KEY, settings->printer_text, &str_size);
-    if (err != ESP_OK) {
-        printf("Failed to load Printer Text\n");
-    }
-
-    err = nvs_get_u8(nvsHandle, NVS_PRINTER_FONT_SIZE_KEY, &value_u8);
-    if (err == ESP_OK) {
-        settings->printer_font_size = value_u8;
-    }
-
-    err = nvs_get_u8(nvsHandle, NVS_PRINTER_ALIGNMENT_KEY, &value_u8);
-    if (err == ESP_OK) {
-        settings->printer_alignment = (PrinterAlignment)value_u8;
-    }
-
-    str_size = sizeof(settings->flappy_ghost_name);
-    err = nvs_get_str(nvsHandle, NVS_FLAPPY_GHOST_NAME, settings->flappy_ghost_name, &str_size);
-    if (err != ESP_OK) {
-        printf("Failed to load Flappy Ghost Name\n");
-    }
-
-#ifdef CONFIG_HAS_RTC_CLOCK
-    str_size = sizeof(settings->selected_timezone);
-    err = nvs_get_str(nvsHandle, NVS_TIMEZONE_NAME, settings->selected_timezone, &str_size);
-    if (err != ESP_OK) {
-        printf("Failed to load Timezone String\n");
-    }
-#endif
-    
-    str_size = sizeof(settings->selected_hex_accent_color);
-    err = nvs_get_str(nvsHandle, NVS_ACCENT_COLOR, settings->selected_hex_accent_color, &str_size);
-    if (err != ESP_OK) {
-        printf("Failed to load Hex Accent Color String\n");
-    }
-
-    err = nvs_get_u8(nvsHandle, NVS_GPS_RX_PIN, &value_u8);
-    if (err == ESP_OK) {
-        settings->gps_rx_pin = value_u8;
+    settings_store_stats_t stats;
+    settings_store_get_stats(store, &stats);
+    if (stats.source == SETTINGS_STORE_LOADED_RECORD) {
+        printf("Settings loaded from NVS (%u bytes).\n", (unsigned)stats.record_size);
+    } else if (stats.source == SETTINGS_STORE_LOADED_LEGACY) {
+        printf("Settings migrated to a single NVS record.\n");
+    } else {
+        printf("No saved settings, using defaults.\n");
     }
-
-    printf("Settings loaded from NVS.\n");
 }
 
+// Applies the RGB mode now; the NVS write follows once changes stop coming in
 void settings_save(const FSettings* settings) {
-    esp_err_t err;
-
-    // Save RGB Mode
-    err = nvs_set_u8(nvsHandle, NVS_RGB_MODE_KEY, (uint8_t)settings->rgb_mode);
-    if (err != ESP_OK) {
-        printf("Failed to save RGB Mode\n");
-    }
-
-    // Save Channel Delay
-    err = nvs_set_blob(nvsHandle, NVS_CHANNEL_DELAY_KEY, &settings->channel_delay, sizeof(settings->channel_delay));
-    if (err != ESP_OK) {
-        printf("Failed to save Channel Delay\n");
-    }
-
-    // Save Broadcast Speed
-    err = nvs_set_u16(nvsHandle, NVS_BROADCAST_SPEED_KEY, settings->broadcast_speed);
-    if (err != ESP_OK) {
-        printf("Failed to save Broadcast Speed\n");
-    }
-
-    // Save AP SSID
-    err = nvs_set_str(nvsHandle, NVS_AP_SSID_KEY, settings->ap_ssid);
-    if (err != ESP_OK) {
-        printf("Failed to save AP SSID\n");
-    }
-
-    // Save AP Password
-    err = nvs_set_str(nvsHandle, NVS_AP_PASSWORD_KEY, settings->ap_password);
-    if (err != ESP_OK) {
-        printf("Failed to save AP Password\n");
-    }
-
-    // Save RGB Speed
-    err = nvs_set_u8(nvsHandle, NVS_RGB_SPEED_KEY, settings->rgb_speed);
-    if (err != ESP_OK) {
-        printf("Failed to save RGB Speed\n");
-    }
-
-    // Save Evil Portal settings
-    err = nvs_set_str(nvsHandle, NVS_PORTAL_URL_KEY, settings->portal_url);
-    if (err != ESP_OK) {
-        printf("Failed to save Portal URL\n");
-    }
-
-    err = nvs_set_str(nvsHandle, NVS_PORTAL_SSID_KEY, settings->portal_ssid);
-    if (err != ESP_OK) {
-        printf("Failed to save Portal SSID\n");
-    }
-
-    err = nvs_set_str(nvsHandle, NVS_PORTAL_PASSWORD_KEY, settings->portal_password);
-    if (err != ESP_OK) {
-        printf("Failed to save Portal Password\n");
-    }
-
-    err = nvs_set_str(nvsHandle, NVS_PORTAL_AP_SSID_KEY, settings->portal_ap_ssid);
-    if (err != ESP_OK) {
-        printf("Failed to save Portal AP SSID\n");
-    }
-
-    err = nvs_set_str(nvsHandle, NVS_PORTAL_DOMAIN_KEY, settings->portal_domain);
-    if (err != ESP_OK) {
-        printf("Failed to save Portal Domain\n");
-    }
-
-    err = nvs_set_u8(nvsHandle, NVS_PORTAL_OFFLINE_KEY, settings->portal_offline_mode);
-    if (err != ESP_OK) {
-        printf("Failed to save Portal Offline Mode\n");
-    }
-
-    // Save Power Printer settings
-    err = nvs_set_str(nvsHandle, NVS_PRINTER_IP_KEY, settings->printer_ip);
-    if (err != ESP_OK) {
-        printf("Failed to save Printer IP\n");
-    }
-
-    err = nvs_set_str(nvsHandle, NVS_PRINTER_TEXT_KEY, settings->printer_text);
-    if (err != ESP_OK) {
-        printf("Failed to save Printer Text\n");
-    }
-
-    err = nvs_set_u8(nvsHandle, NVS_PRINTER_FONT_SIZE_KEY, settings->printer_font_size);
-    if (err != ESP_OK) {
-        printf("Failed to save Printer Font Size\n");
-    }
-
-    err = nvs_set_u8(nvsHandle, NVS_PRINTER_ALIGNMENT_KEY, (uint8_t)settings->printer_alignment);
-    if (err != ESP_OK) {
-        printf("Failed to save Printer Alignment\n");
-    }
-
-    err = nvs_set_str(nvsHandle, NVS_FLAPPY_GHOST_NAME, settings->flappy_ghost_name);
-    if (err != ESP_OK) {
-        printf("Failed to save Flappy Ghost Name\n");
-    }
-
-    err = nvs_set_str(nvsHandle, NVS_TIMEZONE_NAME, settings->selected_timezone);
-    if (err != ESP_OK) {
-        printf("Failed to Save Timezone String %s\n", esp_err_to_name(err));
-    }
-
-    err = nvs_set_str(nvsHandle, NVS_ACCENT_COLOR, settings->selected_hex_accent_color);
-    if (err != ESP_OK) {
-        printf("Failed to Save Hex Accent Color %s", esp_err_to_name(err));
-    }
-
-    err = nvs_set_u8(nvsHandle, NVS_GPS_RX_PIN, (uint8_t)settings->gps_rx_pin);
-    if (err != ESP_OK) {
-        printf("Failed to save Printer Alignment\n");
-    }
-
     if (settings_get_rgb_mode(&G_Settings) == 0)
     {
         if (rgb_effect_task_handle != NULL)
@@ -340,12 +208,22 @@ void settings_save(const FSettings* settings) {
         }
     }
 
-    // Commit all changes
-    err = nvs_commit(nvsHandle);
-    if (err != ESP_OK) {
-        printf("Failed to commit NVS changes\n");
-    } else {
-        printf("Settings saved to NVS.\n");
+    if (store != NULL) {
+        settings_store_update(store, settings);
+    }
+}
+
+esp_err_t settings_flush(void) {
+    if (store == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    return settings_store_flush(store);
+}
+
+void settings_get_store_stats(settings_store_stats_t* out) {
+    memset(out, 0, sizeof(*out));
+    if (store != NULL) {
+        settings_store_get_stats(store, out);
     }
 }
 
@@ -0,0 +1,662 @@
+#include "managers/settings_store.h"
+#include "core/gzip_stream.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_log.h"
+#include "esp_pthread.h"
+#else
+#define ESP_LOGE(tag, fmt, ...) fprintf(stderr, "E %s: " fmt "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...) fprintf(stderr, "W %s: " fmt "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, fmt, ...) fprintf(stderr, "I %s: " fmt "\n", tag, ##__VA_ARGS__)
+#endif
+
+static const char* TAG = "SETTINGS";
+
+// The record is spread over several keys so that a change rewrites only what it touches:
+//   <key>      header blob: "GSET", schema u16, field count u8, then per field the size of a packed
+//              scalar or 0 for a field with its own key, then a CRC-32 of all that
+//   <key>.wN   u64: scalars of up to 8 bytes packed in table order, none split across two words
+//   <key>.fN   string (or blob for a larger raw field) of the field at table index N
+// Only full writes (first save, schema change, after a failure) write the header. Appending fields
+// leaves the position of every earlier one unchanged, so a header from before an append still reads
+// the words right.
+#define RECORD_MAGIC "GSET"
+#define HEADER_FIXED_SIZE 7
+#define WORD_SIZE 8
+#define NO_WORD 0xFF
+
+struct settings_store {
+    settings_store_config_t config;
+    pthread_t thread;
+    pthread_mutex_t lock;        // Everything below
+    pthread_mutex_t write_lock;  // One flush at a time; owns snapshot[]
+    pthread_cond_t wake;
+    clockid_t cond_clock;
+    bool running;
+    uint8_t* pending;            // Latest copy from settings_store_update
+    uint8_t* persisted;          // What the stored record holds
+    uint8_t* snapshot;           // Copy of pending being written
+    uint8_t header[HEADER_FIXED_SIZE + SETTINGS_STORE_MAX_FIELDS + 4];
+    size_t header_len;
+    uint8_t word_of[SETTINGS_STORE_MAX_FIELDS];  // NO_WORD for a field with its own key
+    uint8_t pos_of[SETTINGS_STORE_MAX_FIELDS];   // Byte within its word
+    uint64_t dirty;
+    bool rewrite;                // Write every key even if no field differs: old schema, bad record, failed write
+    bool header_stored;
+    int64_t first_dirty_ms;
+    int64_t last_update_ms;
+    int64_t retry_at_ms;
+    settings_store_stats_t stats;
+};
+
+static int64_t now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static void deadline_after_ms(const settings_store_t* store, struct timespec* ts, int64_t ms) {
+    clock_gettime(store->cond_clock, ts);
+    ts->tv_sec += ms / 1000;
+    ts->tv_nsec += (long)(ms % 1000) * 1000000;
+    if (ts->tv_nsec >= 1000000000) {
+        ts->tv_sec++;
+        ts->tv_nsec -= 1000000000;
+    }
+}
+
+static void put_le16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put_le32(uint8_t* p, uint32_t v) {
+    for (int i = 0; i < 4; i++) {
+        p[i] = (uint8_t)(v >> (8 * i));
+    }
+}
+
+static uint16_t get_le16(const uint8_t* p) {
+    return (uint16_t)(p[0] | p[1] << 8);
+}
+
+static uint32_t get_le32(const uint8_t* p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static bool is_packed(const settings_field_t* f) {
+    return f->kind == SETTINGS_FIELD_RAW && f->size <= WORD_SIZE;
+}
+
+// Bytes of the field that are stored: a string up to its terminator, anything else whole
+static size_t field_len(const settings_field_t* f, const uint8_t* data) {
+    if (f->kind == SETTINGS_FIELD_STR) {
+        return strnlen((const char*)data + f->offset, f->size - 1);
+    }
+    return f->size;
+}
+
+static uint64_t changed_fields(const settings_store_t* store, const uint8_t* a, const uint8_t* b) {
+    uint64_t changed = 0;
+    for (size_t i = 0; i < store->config.field_count; i++) {
+        const settings_field_t* f = &store->config.fields[i];
+        size_t len = field_len(f, a);
+        if (len != field_len(f, b) || memcmp(a + f->offset, b + f->offset, len) != 0) {
+            changed |= 1ull << i;
+        }
+    }
+    return changed;
+}
+
+static void word_key(const settings_store_t* store, char* out, size_t word) {
+    snprintf(out, SETTINGS_STORE_KEY_MAX + 5, "%s.w%u", store->config.key, (unsigned)word);
+}
+
+static void field_key(const settings_store_t* store, char* out, size_t index) {
+    snprintf(out, SETTINGS_STORE_KEY_MAX + 5, "%s.f%u", store->config.key, (unsigned)index);
+}
+
+// Packs in table order, starting a new word when the next scalar does not fit the current one. The
+// same walk over a stored header gives the positions the record was written with.
+static size_t pack_next(uint8_t size, size_t* word, size_t* pos) {
+    if (*pos + size > WORD_SIZE) {
+        (*word)++;
+        *pos = 0;
+    }
+    size_t at = *pos;
+    *pos += size;
+    return at;
+}
+
+static void build_layout(settings_store_t* store) {
+    uint8_t* h = store->header;
+    size_t word = 0, pos = 0;
+    memcpy(h, RECORD_MAGIC, 4);
+    put_le16(h + 4, store->config.schema);
+    h[6] = (uint8_t)store->config.field_count;
+    for (size_t i = 0; i < store->config.field_count; i++) {
+        const settings_field_t* f = &store->config.fields[i];
+        if (is_packed(f)) {
+            store->pos_of[i] = (uint8_t)pack_next((uint8_t)f->size, &word, &pos);
+            store->word_of[i] = (uint8_t)word;
+            h[HEADER_FIXED_SIZE + i] = (uint8_t)f->size;
+        } else {
+            store->word_of[i] = NO_WORD;
+            h[HEADER_FIXED_SIZE + i] = 0;
+        }
+    }
+    size_t len = HEADER_FIXED_SIZE + store->config.field_count;
+    put_le32(h + len, gzip_crc32(0, h, len));
+    store->header_len = len + 4;
+}
+
+static uint64_t word_value(const settings_store_t* store, const uint8_t* data, size_t word) {
+    uint64_t v = 0;
+    for (size_t i = 0; i < store->config.field_count; i++) {
+        const settings_field_t* f = &store->config.fields[i];
+        if (store->word_of[i] != word) {
+            continue;
+        }
+        for (size_t k = 0; k < f->size; k++) {
+            v |= (uint64_t)data[f->offset + k] << (8 * (store->pos_of[i] + k));
+        }
+    }
+    return v;
+}
+
+// Header, words and each field's own value, as stored for data
+static size_t stored_size(const settings_store_t* store, const uint8_t* data) {
+    size_t size = store->header_len;
+    size_t words = 0;
+    for (size_t i = 0; i < store->config.field_count; i++) {
+        const settings_field_t* f = &store->config.fields[i];
+        if (store->word_of[i] != NO_WORD) {
+            words = store->word_of[i] + 1u > words ? store->word_of[i] + 1u : words;
+        } else {
+            size += field_len(f, data) + (f->kind == SETTINGS_FIELD_STR ? 1 : 0);
+        }
+    }
+    return size + words * WORD_SIZE;
+}
+
+static esp_err_t check_header(const uint8_t* h, size_t len) {
+    if (len < HEADER_FIXED_SIZE + 4 || memcmp(h, RECORD_MAGIC, 4) != 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (len != HEADER_FIXED_SIZE + (size_t)h[6] + 4) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (gzip_crc32(0, h, len - 4) != get_le32(h + len - 4)) {
+        return ESP_ERR_INVALID_CRC;
+    }
+    for (size_t i = 0; i < h[6]; i++) {
+        if (h[HEADER_FIXED_SIZE + i] > WORD_SIZE) {
+            return ESP_ERR_INVALID_SIZE;
+        }
+    }
+    return ESP_OK;
+}
+
+static esp_err_t read_own_key(settings_store_t* store, size_t index, uint8_t* data) {
+    const settings_store_nvs_t* nvs = &store->config.nvs;
+    const settings_field_t* f = &store->config.fields[index];
+    uint8_t* dst = data + f->offset;
+    char key[SETTINGS_STORE_KEY_MAX + 5];
+    field_key(store, key, index);
+    size_t len = 0;
+    esp_err_t err;
+    if (f->kind == SETTINGS_FIELD_RAW) {
+        err = nvs->get_blob(nvs->ctx, key, NULL, &len);
+        if (err == ESP_OK && len != f->size) {
+            return ESP_ERR_INVALID_SIZE;
+        }
+        return err == ESP_OK ? nvs->get_blob(nvs->ctx, key, dst, &len) : err;
+    }
+    if ((err = nvs->get_str(nvs->ctx, key, NULL, &len)) != ESP_OK) {
+        return err;
+    }
+    if (len <= f->size) {
+        return nvs->get_str(nvs->ctx, key, (char*)dst, &len);
+    }
+    // Stored by a table where the field was longer; keep what fits
+    char* tmp = malloc(len);
+    if (tmp == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    if ((err = nvs->get_str(nvs->ctx, key, tmp, &len)) == ESP_OK) {
+        memcpy(dst, tmp, f->size - 1u);
+        dst[f->size - 1u] = '\0';
+    }
+    free(tmp);
+    return err;
+}
+
+// Reads every field the stored header and this table agree on; a field that is missing, from a newer
+// table or whose size changed keeps its value in data
+static void read_values(settings_store_t* store, const uint8_t* h, uint8_t* data) {
+    const settings_store_nvs_t* nvs = &store->config.nvs;
+    size_t stored_count = h[6];
+    size_t word = 0, pos = 0, loaded = SIZE_MAX;
+    uint64_t value = 0;
+    bool have_word = false;
+    for (size_t i = 0; i < stored_count; i++) {
+        uint8_t size = h[HEADER_FIXED_SIZE + i];
+        const settings_field_t* f = i < store->config.field_count ? &store->config.fields[i] : NULL;
+        if (size == 0) {
+            if (f != NULL && !is_packed(f)) {
+                read_own_key(store, i, data);
+            }
+            continue;
+        }
+        size_t at = pack_next(size, &word, &pos);
+        if (f == NULL || !is_packed(f) || f->size != size) {
+            continue;
+        }
+        if (loaded != word) {
+            char key[SETTINGS_STORE_KEY_MAX + 5];
+            word_key(store, key, word);
+            have_word = nvs->get_u64(nvs->ctx, key, &value) == ESP_OK;
+            loaded = word;
+        }
+        for (size_t k = 0; have_word && k < size; k++) {
+            data[f->offset + k] = (uint8_t)(value >> (8 * (at + k)));
+        }
+    }
+}
+
+static void put_uint(uint8_t* dst, size_t size, uint32_t v) {
+    switch (size) {
+    case 1: { uint8_t x = (uint8_t)v; memcpy(dst, &x, 1); break; }
+    case 2: { uint16_t x = (uint16_t)v; memcpy(dst, &x, 2); break; }
+    case 4: { uint32_t x = v; memcpy(dst, &x, 4); break; }
+    default: break;
+    }
+}
+
+// Returns how many legacy keys were found
+static size_t load_legacy(settings_store_t* store, uint8_t* data) {
+    const settings_store_nvs_t* nvs = &store->config.nvs;
+    size_t found = 0;
+    for (size_t i = 0; i < store->config.field_count; i++) {
+        const settings_field_t* f = &store->config.fields[i];
+        uint8_t* dst = data + f->offset;
+        esp_err_t err = ESP_FAIL;
+        size_t len;
+        switch (f->legacy_type) {
+        case SETTINGS_LEGACY_U8: {
+            uint8_t v;
+            if ((err = nvs->get_u8(nvs->ctx, f->legacy_key, &v)) == ESP_OK) {
+                put_uint(dst, f->size, v);
+            }
+            break;
+        }
+        case SETTINGS_LEGACY_U16: {
+            uint16_t v;
+            if ((err = nvs->get_u16(nvs->ctx, f->legacy_key, &v)) == ESP_OK) {
+                put_uint(dst, f->size, v);
+            }
+            break;
+        }
+        case SETTINGS_LEGACY_BLOB:
+            len = 0;
+            err = nvs->get_blob(nvs->ctx, f->legacy_key, NULL, &len);
+            if (err == ESP_OK && len == f->size) {
+                err = nvs->get_blob(nvs->ctx, f->legacy_key, dst, &len);
+            } else if (err == ESP_OK) {
+                err = ESP_ERR_INVALID_SIZE;
+            }
+            break;
+        case SETTINGS_LEGACY_STR:
+            len = f->size;
+            err = nvs->get_str(nvs->ctx, f->legacy_key, (char*)dst, &len);
+            break;
+        case SETTINGS_LEGACY_NONE:
+            continue;
+        }
+        if (err == ESP_OK) {
+            found++;
+        }
+    }
+    return found;
+}
+
+static void erase_legacy(settings_store_t* store) {
+    const settings_store_nvs_t* nvs = &store->config.nvs;
+    for (size_t i = 0; i < store->config.field_count; i++) {
+        if (store->config.fields[i].legacy_type != SETTINGS_LEGACY_NONE) {
+            nvs->erase_key(nvs->ctx, store->config.fields[i].legacy_key);
+        }
+    }
+    if (nvs->commit(nvs->ctx) != ESP_OK) {
+        ESP_LOGW(TAG, "Failed to commit removal of the old settings keys");
+    }
+}
+
+// One word, string or blob; a word shared by several dirty fields is written once
+static esp_err_t write_field(settings_store_t* store, size_t index, uint64_t* words_written, size_t* bytes) {
+    const settings_store_nvs_t* nvs = &store->config.nvs;
+    const settings_field_t* f = &store->config.fields[index];
+    const uint8_t* data = store->snapshot;
+    char key[SETTINGS_STORE_KEY_MAX + 5];
+    size_t word = store->word_of[index];
+    if (word != NO_WORD) {
+        if (*words_written & (1ull << word)) {
+            return ESP_OK;
+        }
+        *words_written |= 1ull << word;
+        *bytes += WORD_SIZE;
+        word_key(store, key, word);
+        return nvs->set_u64(nvs->ctx, key, word_value(store, data, word));
+    }
+    field_key(store, key, index);
+    if (f->kind == SETTINGS_FIELD_STR) {
+        *bytes += field_len(f, data) + 1;
+        return nvs->set_str(nvs->ctx, key, (const char*)data + f->offset);
+    }
+    *bytes += f->size;
+    return nvs->set_blob(nvs->ctx, key, data + f->offset, f->size);
+}
+
+// Copy under the lock, write outside it so updates never wait on flash
+static esp_err_t write_record(settings_store_t* store) {
+    pthread_mutex_lock(&store->write_lock);
+    pthread_mutex_lock(&store->lock);
+    if (store->dirty == 0 && !store->rewrite) {
+        pthread_mutex_unlock(&store->lock);
+        pthread_mutex_unlock(&store->write_lock);
+        return ESP_OK;
+    }
+    // Without a header nothing already stored can be read back, so the first write is a full one
+    bool full = store->rewrite || !store->header_stored;
+    uint64_t dirty = store->dirty;
+    memcpy(store->snapshot, store->pending, store->config.data_size);
+    memcpy(store->persisted, store->pending, store->config.data_size);
+    store->dirty = 0;
+    store->rewrite = false;
+    pthread_mutex_unlock(&store->lock);
+
+    for (size_t i = 0; i < store->config.field_count; i++) {
+        const settings_field_t* f = &store->config.fields[i];
+        if (f->kind == SETTINGS_FIELD_STR) {
+            store->snapshot[f->offset + f->size - 1u] = '\0';
+        }
+    }
+
+    const settings_store_nvs_t* nvs = &store->config.nvs;
+    esp_err_t err = ESP_OK;
+    uint64_t words_written = 0;
+    size_t bytes = 0;
+    for (size_t i = 0; i < store->config.field_count && err == ESP_OK; i++) {
+        if (full || (dirty & (1ull << i))) {
+            err = write_field(store, i, &words_written, &bytes);
+        }
+    }
+    // Header last: until it is committed a load still reads the layout the values were written in
+    if (err == ESP_OK && full) {
+        err = nvs->set_blob(nvs->ctx, store->config.key, store->header, store->header_len);
+        bytes += store->header_len;
+    }
+    if (err == ESP_OK) {
+        err = nvs->commit(nvs->ctx);
+    }
+
+    pthread_mutex_lock(&store->lock);
+    if (err == ESP_OK) {
+        store->stats.flushes++;
+        store->stats.bytes_written += (uint32_t)bytes;
+        store->stats.record_size = (uint32_t)stored_size(store, store->snapshot);
+        store->header_stored = store->header_stored || full;
+        store->retry_at_ms = 0;
+    } else {
+        // persisted no longer matches flash, so force the next write whatever the diff says
+        store->stats.flush_errors++;
+        store->rewrite = true;
+        store->retry_at_ms = now_ms() + SETTINGS_STORE_RETRY_MS;
+        if (store->dirty == 0) {
+            store->first_dirty_ms = store->last_update_ms = now_ms();
+        }
+        pthread_cond_signal(&store->wake);
+    }
+    pthread_mutex_unlock(&store->lock);
+    pthread_mutex_unlock(&store->write_lock);
+
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to write settings record: 0x%x", err);
+    }
+    return err;
+}
+
+static void* flush_thread(void* arg) {
+    settings_store_t* store = arg;
+    uint32_t debounce = store->config.debounce_ms;
+    uint32_t max_delay = store->config.max_delay_ms;
+
+    pthread_mutex_lock(&store->lock);
+    while (store->running) {
+        if (store->dirty == 0 && !store->rewrite) {
+            pthread_cond_wait(&store->wake, &store->lock);
+            continue;
+        }
+        // Quiet for debounce_ms, but never later than max_delay_ms after the first unsaved change
+        int64_t due = store->last_update_ms + debounce;
+        if (store->first_dirty_ms + max_delay < due) {
+            due = store->first_dirty_ms + max_delay;
+        }
+        if (store->retry_at_ms > due) {
+            due = store->retry_at_ms;
+        }
+        int64_t now = now_ms();
+        if (now < due) {
+            struct timespec deadline;
+            deadline_after_ms(store, &deadline, due - now);
+            pthread_cond_timedwait(&store->wake, &store->lock, &deadline);
+            continue;
+        }
+        pthread_mutex_unlock(&store->lock);
+        write_record(store);
+        pthread_mutex_lock(&store->lock);
+    }
+    pthread_mutex_unlock(&store->lock);
+    return NULL;
+}
+
+settings_store_t* settings_store_create(const settings_store_config_t* config) {
+    if (config->field_count == 0 || config->field_count > SETTINGS_STORE_MAX_FIELDS || config->key == NULL ||
+        strlen(config->key) > SETTINGS_STORE_KEY_MAX) {
+        ESP_LOGE(TAG, "Bad settings table");
+        return NULL;
+    }
+    for (size_t i = 0; i < config->field_count; i++) {
+        const settings_field_t* f = &config->fields[i];
+        if (f->size == 0 || f->offset + f->size > config->data_size ||
+            (f->legacy_type != SETTINGS_LEGACY_NONE && f->legacy_key == NULL)) {
+            ESP_LOGE(TAG, "Bad settings field %u", (unsigned)i);
+            return NULL;
+        }
+    }
+
+    settings_store_t* store = calloc(1, sizeof(*store));
+    if (store == NULL) {
+        return NULL;
+    }
+    store->config = *config;
+    if (store->config.debounce_ms == 0) {
+        store->config.debounce_ms = SETTINGS_STORE_DEFAULT_DEBOUNCE_MS;
+    }
+    if (store->config.max_delay_ms == 0) {
+        store->config.max_delay_ms = SETTINGS_STORE_DEFAULT_MAX_DELAY_MS;
+    }
+    build_layout(store);
+    store->pending = calloc(1, config->data_size);
+    store->persisted = calloc(1, config->data_size);
+    store->snapshot = malloc(config->data_size);
+    if (store->pending == NULL || store->persisted == NULL || store->snapshot == NULL) {
+        free(store->pending);
+        free(store->persisted);
+        free(store->snapshot);
+        free(store);
+        return NULL;
+    }
+
+    pthread_mutex_init(&store->lock, NULL);
+    pthread_mutex_init(&store->write_lock, NULL);
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    store->cond_clock = pthread_condattr_setclock(&attr, CLOCK_MONOTONIC) == 0 ? CLOCK_MONOTONIC : CLOCK_REALTIME;
+    pthread_cond_init(&store->wake, &attr);
+    pthread_condattr_destroy(&attr);
+    store->running = true;
+
+#ifdef ESP_PLATFORM
+    esp_pthread_cfg_t pthread_cfg = esp_pthread_get_default_config();
+    if (config->stack_size > 0) {
+        pthread_cfg.stack_size = config->stack_size;
+    }
+    pthread_cfg.thread_name = "settings";
+    esp_pthread_set_cfg(&pthread_cfg);
+#endif
+
+    int rc = pthread_create(&store->thread, NULL, flush_thread, store);
+
+#ifdef ESP_PLATFORM
+    pthread_cfg = esp_pthread_get_default_config();
+    esp_pthread_set_cfg(&pthread_cfg);
+#endif
+
+    if (rc != 0) {
+        ESP_LOGE(TAG, "Failed to start settings thread");
+        pthread_cond_destroy(&store->wake);
+        pthread_mutex_destroy(&store->write_lock);
+        pthread_mutex_destroy(&store->lock);
+        free(store->pending);
+        free(store->persisted);
+        free(store->snapshot);
+        free(store);
+        return NULL;
+    }
+    return store;
+}
+
+void settings_store_destroy(settings_store_t* store) {
+    if (store == NULL) {
+        return;
+    }
+    settings_store_flush(store);
+
+    pthread_mutex_lock(&store->lock);
+    store->running = false;
+    pthread_cond_signal(&store->wake);
+    pthread_mutex_unlock(&store->lock);
+    pthread_join(store->thread, NULL);
+
+    pthread_cond_destroy(&store->wake);
+    pthread_mutex_destroy(&store->write_lock);
+    pthread_mutex_destroy(&store->lock);
+    free(store->pending);
+    free(store->persisted);
+    free(store->snapshot);
+    free(store);
+}
+
+esp_err_t settings_store_load(settings_store_t* store, void* data) {
+    const settings_store_nvs_t* nvs = &store->config.nvs;
+    size_t len = 0;
+    bool corrupt = false;
+
+    if (nvs->get_blob(nvs->ctx, store->config.key, NULL, &len) == ESP_OK && len > 0) {
+        uint8_t* header = malloc(len);
+        if (header == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+        esp_err_t err = nvs->get_blob(nvs->ctx, store->config.key, header, &len);
+        if (err == ESP_OK) {
+            err = check_header(header, len);
+        }
+        if (err == ESP_OK) {
+            read_values(store, header, data);
+            uint16_t schema = get_le16(header + 4);
+            bool same_layout = len == store->header_len && memcmp(header, store->header, len) == 0;
+            free(header);
+
+            pthread_mutex_lock(&store->lock);
+            memcpy(store->pending, data, store->config.data_size);
+            memcpy(store->persisted, data, store->config.data_size);
+            store->header_stored = true;
+            store->stats.source = SETTINGS_STORE_LOADED_RECORD;
+            store->stats.record_schema = schema;
+            store->stats.record_size = (uint32_t)stored_size(store, data);
+            if (!same_layout) {
+                store->rewrite = true;
+                store->first_dirty_ms = store->last_update_ms = now_ms();
+                pthread_cond_signal(&store->wake);
+            }
+            pthread_mutex_unlock(&store->lock);
+            return ESP_OK;
+        }
+        free(header);
+        ESP_LOGW(TAG, "Ignoring damaged settings record (0x%x)", err);
+        corrupt = true;
+    }
+
+    size_t found = load_legacy(store, data);
+
+    pthread_mutex_lock(&store->lock);
+    memcpy(store->pending, data, store->config.data_size);
+    memcpy(store->persisted, data, store->config.data_size);
+    store->stats.corrupt_records += corrupt ? 1 : 0;
+    store->stats.source = found > 0 ? SETTINGS_STORE_LOADED_LEGACY : SETTINGS_STORE_LOADED_DEFAULTS;
+    if (found > 0 || corrupt) {
+        store->rewrite = true;
+        store->first_dirty_ms = store->last_update_ms = now_ms();
+        pthread_cond_signal(&store->wake);
+    }
+    pthread_mutex_unlock(&store->lock);
+
+    if (found == 0) {
+        return ESP_OK;
+    }
+
+    // Old keys only go once the record that replaces them is committed
+    ESP_LOGI(TAG, "Moving %u settings keys into the record", (unsigned)found);
+    esp_err_t err = write_record(store);
+    if (err == ESP_OK) {
+        erase_legacy(store);
+    }
+    return ESP_OK;
+}
+
+void settings_store_update(settings_store_t* store, const void* data) {
+    int64_t now = now_ms();
+    pthread_mutex_lock(&store->lock);
+    memcpy(store->pending, data, store->config.data_size);
+    bool was_dirty = store->dirty != 0 || store->rewrite;
+    store->dirty = changed_fields(store, store->pending, store->persisted);
+    store->stats.updates++;
+    if (store->dirty == 0) {
+        store->stats.updates_unchanged++;
+    }
+    if (store->dirty != 0 || store->rewrite) {
+        if (!was_dirty) {
+            store->first_dirty_ms = now;
+        }
+        store->last_update_ms = now;
+        pthread_cond_signal(&store->wake);
+    }
+    pthread_mutex_unlock(&store->lock);
+}
+
+esp_err_t settings_store_flush(settings_store_t* store) {
+    return write_record(store);
+}
+
+void settings_store_get_stats(settings_store_t* store, settings_store_stats_t* out) {
+    pthread_mutex_lock(&store->lock);
+    *out = store->stats;
+    out->dirty = store->dirty;
+    pthread_mutex_unlock(&store->lock);
+}
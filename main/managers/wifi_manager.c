@@ -30,6 +30,10 @@
 
 // Include Outside so we have access to the Terminal View Macro
 #include "managers/views/terminal_screen.h"
+#include "core/watchlist.h"
+#include "core/live_state.h"
+#include "core/wps_survey.h"
+#include "core/callbacks.h"
 
 
 
@@ -261,6 +265,16 @@ static void add_station_ap_pair(const uint8_t *station_mac, const uint8_t *ap_bs
     }
 }
 
+// Hand the scan results to the /api/state AP table
+static void publish_scan_results(void) {
+    live_state_aps_begin();
+    for (uint16_t i = 0; i < ap_count && scanned_aps != NULL; i++) {
+        live_state_aps_put(scanned_aps[i].bssid, (const char*)scanned_aps[i].ssid, scanned_aps[i].primary,
+                           scanned_aps[i].rssi, (uint8_t)scanned_aps[i].authmode);
+    }
+    live_state_aps_commit();
+}
+
 // Function to match the BSSID to a company based on OUI
 ECompany match_bssid_to_company(const uint8_t *bssid) {
     char oui[7]; // First 3 bytes of the BSSID
@@ -332,6 +346,7 @@ void wifi_stations_sniffer_callback(void *buf, wifi_promiscuous_pkt_type_t type)
     const uint8_t *src_mac = hdr->addr2;  // Station MAC
     const uint8_t *dest_mac = hdr->addr1; // AP BSSID
 
+    live_state_station_seen(src_mac, dest_mac, packet->rx_ctrl.rssi, packet->rx_ctrl.channel);
 
     if (!station_exists(src_mac, dest_mac)) {
         add_station_ap_pair(src_mac, dest_mac);
@@ -903,6 +918,21 @@ void wifi_manager_stop_evil_portal()
 }
 
 
+static wifi_promiscuous_cb_t_t monitor_callback = NULL;
+
+// Every monitor mode capture goes through here so the watchlist sees all frames regardless of capture type
+static void wifi_monitor_rx_dispatch(void *buf, wifi_promiscuous_pkt_type_t type) {
+    if (watchlist_is_loaded() && type != WIFI_PKT_MISC) {
+        const wifi_promiscuous_pkt_t *pkt = (const wifi_promiscuous_pkt_t *)buf;
+        watchlist_check_frame(pkt->payload, pkt->rx_ctrl.sig_len, pkt->rx_ctrl.rssi, pkt->rx_ctrl.channel);
+    }
+
+    wifi_promiscuous_cb_t_t callback = monitor_callback;
+    if (callback) {
+        callback(buf, type);
+    }
+}
+
 void wifi_manager_start_monitor_mode(wifi_promiscuous_cb_t_t callback) {
     
     ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_NULL));
@@ -910,8 +940,8 @@ void wifi_manager_start_monitor_mode(wifi_promiscuous_cb_t_t callback) {
  
     ESP_ERROR_CHECK(esp_wifi_set_promiscuous(true));
 
-    
-    ESP_ERROR_CHECK(esp_wifi_set_promiscuous_rx_cb(callback));
+    monitor_callback = callback;
+    ESP_ERROR_CHECK(esp_wifi_set_promiscuous_rx_cb(wifi_monitor_rx_dispatch));
 
     printf("WiFi monitor mode started.\n");
     TERMINAL_VIEW_ADD_TEXT("WiFi monitor mode started.");
@@ -927,6 +957,8 @@ void wifi_manager_stop_monitor_mode() {
 void wifi_manager_init() {
 
     esp_wifi_set_ps(WIFI_PS_NONE);
+    live_state_init(esp_random(), wifi_capture_counters);
+    wps_survey_init();
 
     esp_err_t ret = nvs_flash_init();
     if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
@@ -1088,6 +1120,7 @@ void wifi_manager_stop_scan() {
         printf("No access points found\n");
         ap_count = 0;
     }
+    publish_scan_results();
 
     printf("WiFi scanning stopped.\n");
     TERMINAL_VIEW_ADD_TEXT("WiFi scanning stopped.\n");
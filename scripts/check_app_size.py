@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+"""Report how much of its app partition a firmware image uses, and fail when the margin is too small.
+
+    python scripts/check_app_size.py build/Ghost_ESP_IDF.bin partitions_ota_4mb.csv
+    python scripts/check_app_size.py build/Ghost_ESP_IDF.bin partitions.csv --margin 10
+
+The image is compared with the smallest app partition in the table, since with two update slots either
+may have to hold it. Run it on a build of a board before switching that board to a table with smaller
+slots: the build itself only fails once the image no longer fits at all.
+"""
+import argparse
+import os
+import sys
+
+
+def parse_size(text):
+    text = text.strip().upper()
+    scale = 1
+    if text.endswith("K"):
+        scale, text = 1024, text[:-1]
+    elif text.endswith("M"):
+        scale, text = 1024 * 1024, text[:-1]
+    return int(text, 0) * scale
+
+
+def app_partitions(path):
+    parts = []
+    with open(path) as f:
+        for line in f:
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            fields = [x.strip() for x in line.split(",")]
+            if len(fields) >= 5 and fields[1] == "app":
+                parts.append((fields[0], parse_size(fields[4])))
+    return parts
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("image", help="application image (build/<project>.bin)")
+    parser.add_argument("table", help="partition table CSV")
+    parser.add_argument("--margin", type=float, default=10.0,
+                        help="percentage of the slot that must stay free (default 10)")
+    args = parser.parse_args()
+
+    parts = app_partitions(args.table)
+    if not parts:
+        sys.exit("%s: no app partition" % args.table)
+    name, slot = min(parts, key=lambda p: p[1])
+    size = os.path.getsize(args.image)
+    free = 100.0 * (slot - size) / slot
+    print("%s: %d bytes in %s (%d bytes, %s): %d bytes free (%.1f%%)" % (
+        args.image, size, name, slot, os.path.basename(args.table), slot - size, free))
+    if free < args.margin:
+        print("less than %.0f%% of the slot free" % args.margin)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,240 @@
+"""Load generator for the Ghost ESP web API.
+
+Runs a number of clients against the device at once, each on its own keep-alive connection, picking
+requests from a weighted mix of endpoints, and reports p50/p90/p99 latencies per endpoint. The default
+mix is what the web UI sends while it is open (state and log polling, settings, command queue); add
+--download to keep a file download running at the same time and see whether it holds up the API.
+With --server-metrics, the device's own /api/metrics numbers for the same run are shown alongside.
+
+    python http_load.py 192.168.4.1
+    python http_load.py 192.168.4.1 -c 6 -d 60 --download /mnt/capture.pcap --server-metrics
+    python http_load.py 192.168.4.1 -e "3:GET /api/state" -e "GET /api/sdcard?path=/mnt" --json
+
+Only the standard library is used.
+"""
+
+import argparse
+import http.client
+import json
+import random
+import threading
+import time
+import urllib.parse
+
+DEFAULT_MIX = [
+    (4, "GET", "/api/state"),
+    (2, "GET", "/api/logs"),
+    (1, "GET", "/api/settings"),
+    (1, "GET", "/api/command"),
+    (1, "GET", "/api/ota"),
+]
+
+
+def parse_endpoint(spec):
+    """'[weight:]METHOD /path' -> (weight, method, path)"""
+    weight = 1
+    if ":" in spec.split(" ", 1)[0]:
+        w, spec = spec.split(":", 1)
+        weight = int(w)
+    method, path = spec.strip().split(" ", 1)
+    return weight, method.upper(), path.strip()
+
+
+def percentile(sorted_values, pct):
+    if not sorted_values:
+        return 0.0
+    rank = max(1, -(-len(sorted_values) * pct // 100))
+    return sorted_values[int(rank) - 1]
+
+
+class Stats:
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.latencies = {}       # name -> [seconds]
+        self.errors = {}          # name -> count
+        self.statuses = {}        # name -> {status: count}
+        self.bytes = {}
+
+    def record(self, name, seconds, status, nbytes, ok):
+        with self.lock:
+            self.latencies.setdefault(name, []).append(seconds)
+            self.statuses.setdefault(name, {}).setdefault(status, 0)
+            self.statuses[name][status] += 1
+            self.bytes[name] = self.bytes.get(name, 0) + nbytes
+            if not ok:
+                self.errors[name] = self.errors.get(name, 0) + 1
+
+
+class Client(threading.Thread):
+    def __init__(self, host, mix, stats, deadline, timeout, think, seed):
+        super().__init__(daemon=True)
+        self.host, self.mix, self.stats = host, mix, stats
+        self.deadline, self.timeout, self.think = deadline, timeout, think
+        self.rng = random.Random(seed)
+        self.weights = [w for w, _, _ in mix]
+        self.conn = None
+
+    def request(self, method, path):
+        if self.conn is None:
+            self.conn = http.client.HTTPConnection(self.host, timeout=self.timeout)
+        start = time.perf_counter()
+        try:
+            self.conn.request(method, path, body=b"" if method == "POST" else None)
+            resp = self.conn.getresponse()
+            body = resp.read()
+            status = resp.status
+            if resp.will_close:
+                self.conn.close()
+                self.conn = None
+        except (OSError, http.client.HTTPException) as e:
+            if self.conn is not None:
+                self.conn.close()
+            self.conn = None
+            return time.perf_counter() - start, type(e).__name__, 0
+        return time.perf_counter() - start, status, len(body)
+
+    def run(self):
+        while time.monotonic() < self.deadline:
+            _, method, path = self.rng.choices(self.mix, weights=self.weights)[0]
+            elapsed, status, nbytes = self.request(method, path)
+            ok = isinstance(status, int) and status < 400
+            self.stats.record("%s %s" % (method, path), elapsed, status, nbytes, ok)
+            if self.think:
+                time.sleep(self.think)
+        if self.conn is not None:
+            self.conn.close()
+
+
+class Downloader(threading.Thread):
+    """Downloads one SD card file over and over, to overlap the API requests with a long transfer."""
+
+    def __init__(self, host, path, stats, deadline, timeout):
+        super().__init__(daemon=True)
+        self.host, self.stats, self.deadline, self.timeout = host, stats, deadline, timeout
+        self.url = "/api/sdcard/download?path=" + urllib.parse.quote(path)
+
+    def run(self):
+        name = "GET /api/sdcard/download (background)"
+        while time.monotonic() < self.deadline:
+            conn = http.client.HTTPConnection(self.host, timeout=self.timeout)
+            start = time.perf_counter()
+            nbytes, status = 0, "error"
+            try:
+                conn.request("GET", self.url)
+                resp = conn.getresponse()
+                status = resp.status
+                while time.monotonic() < self.deadline:
+                    block = resp.read(16384)
+                    if not block:
+                        break
+                    nbytes += len(block)
+            except (OSError, http.client.HTTPException) as e:
+                status = type(e).__name__
+            finally:
+                conn.close()
+            ok = isinstance(status, int) and status < 400
+            self.stats.record(name, time.perf_counter() - start, status, nbytes, ok)
+            if not ok:
+                time.sleep(1)
+
+
+def get_json(host, path, timeout):
+    conn = http.client.HTTPConnection(host, timeout=timeout)
+    try:
+        conn.request("GET", path)
+        resp = conn.getresponse()
+        body = resp.read()
+        return json.loads(body) if resp.status == 200 else None
+    except (OSError, http.client.HTTPException, ValueError):
+        return None
+    finally:
+        conn.close()
+
+
+def summarize(stats, duration):
+    rows = []
+    for name, values in sorted(stats.latencies.items()):
+        values = sorted(values)
+        rows.append({
+            "endpoint": name,
+            "requests": len(values),
+            "errors": stats.errors.get(name, 0),
+            "statuses": {str(k): v for k, v in stats.statuses[name].items()},
+            "rps": len(values) / duration,
+            "kbps": stats.bytes.get(name, 0) / 1024 / duration,
+            "p50_ms": percentile(values, 50) * 1000,
+            "p90_ms": percentile(values, 90) * 1000,
+            "p99_ms": percentile(values, 99) * 1000,
+            "max_ms": values[-1] * 1000,
+        })
+    return rows
+
+
+def print_report(rows, server, duration, clients):
+    print("\n%d clients for %.0f s" % (clients, duration))
+    print("%-44s %7s %6s %7s %8s %8s %8s %8s" % ("endpoint", "reqs", "errs", "req/s", "p50 ms", "p90 ms",
+                                                 "p99 ms", "max ms"))
+    for r in rows:
+        print("%-44s %7d %6d %7.1f %8.1f %8.1f %8.1f %8.1f" % (r["endpoint"][:44], r["requests"], r["errors"],
+                                                             r["rps"], r["p50_ms"], r["p90_ms"], r["p99_ms"],
+                                                             r["max_ms"]))
+        if r["endpoint"].endswith("(background)"):
+            print("%-44s %.1f KB/s" % ("", r["kbps"]))
+    if not server:
+        return
+    print("\ndevice handler times (/api/metrics): %d workers, %d requests run on a worker, %d turned away busy, "
+          "%d sockets open, %d bytes free" % (server["workers"], server["dispatched"], server["rejected_busy"],
+                                              server["open_sockets"], server["free_heap"]))
+    print("%-44s %7s %6s %8s %8s %8s %10s" % ("endpoint", "reqs", "errs", "p50 ms", "p99 ms", "max ms", "max active"))
+    for e in server["endpoints"]:
+        if e["requests"] == 0:
+            continue
+        name = "%s %s%s" % (e["method"], e["uri"], " (worker)" if e["async"] else "")
+        print("%-44s %7d %6d %8d %8d %8.1f %10d" % (name[:44], e["requests"], e["errors"], e["p50_ms"], e["p99_ms"],
+                                                  e["us_max"] / 1000, e["max_active"]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Measure Ghost ESP web API latency under concurrent load")
+    parser.add_argument("host", help="device address, e.g. 192.168.4.1")
+    parser.add_argument("-c", "--clients", type=int, default=4, help="concurrent API clients (default 4)")
+    parser.add_argument("-d", "--duration", type=float, default=30, help="seconds to run (default 30)")
+    parser.add_argument("-e", "--endpoint", action="append", default=[],
+                        help="'[weight:]METHOD /path' to request instead of the UI mix; repeat for several")
+    parser.add_argument("--download", metavar="PATH", help="SD card file to keep downloading during the run")
+    parser.add_argument("--think", type=float, default=0, help="seconds each client waits between requests")
+    parser.add_argument("--timeout", type=float, default=10, help="socket timeout in seconds")
+    parser.add_argument("--server-metrics", action="store_true",
+                        help="reset /api/metrics before the run and report it afterwards")
+    parser.add_argument("--seed", type=int, default=1, help="seed for the request mix")
+    parser.add_argument("--json", action="store_true", help="print the results as JSON")
+    args = parser.parse_args()
+
+    mix = [parse_endpoint(e) for e in args.endpoint] or DEFAULT_MIX
+    if args.server_metrics:
+        get_json(args.host, "/api/metrics?reset=1", args.timeout)
+
+    stats = Stats()
+    start = time.monotonic()
+    deadline = start + args.duration
+    threads = [Client(args.host, mix, stats, deadline, args.timeout, args.think, args.seed + i)
+               for i in range(args.clients)]
+    if args.download:
+        threads.append(Downloader(args.host, args.download, stats, deadline, args.timeout))
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    duration = time.monotonic() - start
+
+    server = get_json(args.host, "/api/metrics", args.timeout) if args.server_metrics else None
+    rows = summarize(stats, duration)
+    if args.json:
+        print(json.dumps({"clients": args.clients, "duration_s": duration, "endpoints": rows, "device": server},
+                         indent=2))
+    else:
+        print_report(rows, server, duration, args.clients)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,211 @@
+"""Client for the firmware's /api/state endpoint.
+
+Keeps a copy of the device's AP table, station table, capture counters and GPS fix, fetching only what
+changed since the last poll. Replies are CBOR by default (about 40% smaller than the JSON form); the
+decoder below covers what the firmware sends, so nothing beyond the standard library is needed.
+
+    python live_state.py 192.168.4.1            # poll every 2 s and print the tables
+    python live_state.py 192.168.4.1 --json     # same over JSON
+"""
+
+import argparse
+import json
+import struct
+import time
+import urllib.request
+
+
+class CBORDecodeError(ValueError):
+    pass
+
+
+def decode_cbor(data):
+    """Decode one CBOR item (RFC 8949): integers, strings, arrays, maps, floats and simple values."""
+    value, pos = _decode_item(data, 0)
+    if pos != len(data):
+        raise CBORDecodeError("trailing bytes after item")
+    return value
+
+
+_BREAK = object()
+
+
+def _read_argument(data, pos, info):
+    if info < 24:
+        return info, pos
+    sizes = {24: 1, 25: 2, 26: 4, 27: 8}
+    if info not in sizes:
+        raise CBORDecodeError("bad additional info %d" % info)
+    n = sizes[info]
+    if pos + n > len(data):
+        raise CBORDecodeError("truncated")
+    return int.from_bytes(data[pos:pos + n], "big"), pos + n
+
+
+def _decode_item(data, pos):
+    if pos >= len(data):
+        raise CBORDecodeError("truncated")
+    initial = data[pos]
+    pos += 1
+    major, info = initial >> 5, initial & 31
+
+    if major == 7:
+        if info == 20:
+            return False, pos
+        if info == 21:
+            return True, pos
+        if info in (22, 23):
+            return None, pos
+        if info == 25:
+            return struct.unpack(">e", data[pos:pos + 2])[0], pos + 2
+        if info == 26:
+            return struct.unpack(">f", data[pos:pos + 4])[0], pos + 4
+        if info == 27:
+            return struct.unpack(">d", data[pos:pos + 8])[0], pos + 8
+        if info == 31:
+            return _BREAK, pos
+        raise CBORDecodeError("unsupported simple value %d" % info)
+
+    if info == 31:
+        if major in (2, 3):
+            chunks = []
+            while True:
+                chunk, pos = _decode_item(data, pos)
+                if chunk is _BREAK:
+                    break
+                chunks.append(chunk)
+            return (b"" if major == 2 else "").join(chunks), pos
+        if major == 4:
+            items = []
+            while True:
+                item, pos = _decode_item(data, pos)
+                if item is _BREAK:
+                    return items, pos
+                items.append(item)
+        if major == 5:
+            result = {}
+            while True:
+                key, pos = _decode_item(data, pos)
+                if key is _BREAK:
+                    return result, pos
+                result[key], pos = _decode_item(data, pos)
+        raise CBORDecodeError("indefinite length on major type %d" % major)
+
+    arg, pos = _read_argument(data, pos, info)
+    if major == 0:
+        return arg, pos
+    if major == 1:
+        return -1 - arg, pos
+    if major in (2, 3):
+        raw = bytes(data[pos:pos + arg])
+        if len(raw) != arg:
+            raise CBORDecodeError("truncated string")
+        return (raw if major == 2 else raw.decode("utf-8")), pos + arg
+    if major == 4:
+        items = []
+        for _ in range(arg):
+            item, pos = _decode_item(data, pos)
+            items.append(item)
+        return items, pos
+    if major == 5:
+        result = {}
+        for _ in range(arg):
+            key, pos = _decode_item(data, pos)
+            result[key], pos = _decode_item(data, pos)
+        return result, pos
+    if major == 6:
+        return _decode_item(data, pos)  # Tags are not used by the firmware; take the tagged item as is
+    raise CBORDecodeError("bad major type %d" % major)
+
+
+def format_mac(mac):
+    """CBOR replies carry MACs as 6 bytes, JSON replies as text."""
+    if isinstance(mac, (bytes, bytearray)):
+        return ":".join("%02X" % b for b in mac)
+    return mac
+
+
+class LiveState:
+    """Local copy of the device tables, updated from /api/state deltas."""
+
+    def __init__(self, host, use_cbor=True, timeout=5):
+        self.base_url = "http://%s/api/state" % host
+        self.use_cbor = use_cbor
+        self.timeout = timeout
+        self.boot = 0
+        self.version = 0
+        self.aps = {}
+        self.stations = {}
+        self.capture = None
+        self.gps = None
+        self.last_reply_bytes = 0
+
+    def poll(self):
+        url = "%s?since=%d&boot=%d" % (self.base_url, self.version, self.boot)
+        if self.use_cbor:
+            url += "&format=cbor"
+        with urllib.request.urlopen(url, timeout=self.timeout) as response:
+            body = response.read()
+        self.last_reply_bytes = len(body)
+        self.apply(decode_cbor(body) if self.use_cbor else json.loads(body))
+
+    def apply(self, state):
+        """Apply one reply: removals first, then changed rows, as the firmware documents."""
+        if state.get("reset"):
+            self.aps.clear()
+            self.stations.clear()
+            self.capture = None
+            self.gps = None
+        for name, table, key in (("aps", self.aps, "bssid"), ("stations", self.stations, "mac")):
+            part = state.get(name)
+            if not part:
+                continue
+            for mac in part.get("removed", []):
+                table.pop(format_mac(mac), None)
+            for row in part.get("changed", []):
+                row = dict(row)
+                for field in ("bssid", "mac"):
+                    if field in row:
+                        row[field] = format_mac(row[field])
+                table[row[key]] = row
+        if "capture" in state:
+            self.capture = state["capture"]
+        if "gps" in state:
+            self.gps = state["gps"]
+        self.boot = state["boot"]
+        self.version = state["version"]
+
+
+def print_tables(state):
+    print("\n%d APs, %d stations (version %d, last reply %d bytes)" %
+          (len(state.aps), len(state.stations), state.version, state.last_reply_bytes))
+    for ap in sorted(state.aps.values(), key=lambda r: -r["rssi"]):
+        print("  AP  %-32s %s ch%-3d %4d dBm" % (ap["ssid"] or "(hidden)", ap["bssid"], ap["channel"], ap["rssi"]))
+    for sta in sorted(state.stations.values(), key=lambda r: -r["rssi"]):
+        print("  STA %s -> %s ch%-3d %4d dBm %6d frames" %
+              (sta["mac"], sta["bssid"], sta["channel"], sta["rssi"], sta["frames"]))
+    if state.capture:
+        c = state.capture
+        print("  capture: %d/%d frames written, %d handshakes, %d PMKIDs, %d bytes to SD" %
+              (c["frames_written"], c["frames_seen"], c["handshakes"], c["pmkids"], c["sd_bytes_written"]))
+    if state.gps and state.gps["valid"]:
+        g = state.gps
+        print("  gps: %.6f, %.6f, %d sats" % (g["lat"], g["lon"], g["sats_in_use"]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Follow the Ghost ESP AP/station tables over the web API")
+    parser.add_argument("host", help="device address, e.g. 192.168.4.1")
+    parser.add_argument("--json", action="store_true", help="use the JSON encoding instead of CBOR")
+    parser.add_argument("--interval", type=float, default=2.0, help="seconds between polls")
+    args = parser.parse_args()
+
+    state = LiveState(args.host, use_cbor=not args.json)
+    while True:
+        state.poll()
+        print_tables(state)
+        time.sleep(args.interval)
+
+
+if __name__ == "__main__":
+    main()
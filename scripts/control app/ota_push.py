@@ -0,0 +1,179 @@
+"""Push a firmware image to one or more Ghost ESP boards over the web API (/api/ota).
+
+Each board receives the application image (build/Ghost_ESP_IDF.bin, not the merged flash image) as one
+streamed POST, checks it against the SHA-256 computed here, stores it in its spare slot and restarts.
+Boards are updated in parallel; with --wait the script also follows each one through its restart until
+the new version has confirmed itself or the board has rolled back.
+
+    python ota_push.py build/Ghost_ESP_IDF.bin 192.168.4.1
+    python ota_push.py build/Ghost_ESP_IDF.bin 10.0.0.21 10.0.0.22 10.0.0.23 --wait
+    python ota_push.py build/Ghost_ESP_IDF.bin --hosts boards.txt --sign-key ota_private.pem --wait
+
+Firmware built with CONFIG_OTA_REQUIRE_SIGNATURE only accepts images signed by the matching private key;
+pass it with --sign-key (needs the openssl command) or give a ready-made DER signature with --sig.
+Only the standard library is used.
+"""
+
+import argparse
+import concurrent.futures
+import hashlib
+import http.client
+import json
+import subprocess
+import sys
+import time
+
+CHUNK = 16 * 1024
+APP_DESC_OFFSET = 32          # image header (24) + first segment header (8)
+APP_DESC_MAGIC = 0xABCD5432
+
+
+def image_version(image):
+    """Version string from the image's app description, or None if it is not an application image."""
+    if len(image) < APP_DESC_OFFSET + 48 or image[0] != 0xE9:
+        return None
+    if int.from_bytes(image[APP_DESC_OFFSET:APP_DESC_OFFSET + 4], "little") != APP_DESC_MAGIC:
+        return None
+    return image[APP_DESC_OFFSET + 16:APP_DESC_OFFSET + 48].split(b"\0", 1)[0].decode(errors="replace")
+
+
+def sign_image(path, key):
+    return subprocess.run(["openssl", "dgst", "-sha256", "-sign", key, path],
+                          check=True, capture_output=True).stdout
+
+
+def get_status(host, timeout=5):
+    conn = http.client.HTTPConnection(host, timeout=timeout)
+    try:
+        conn.request("GET", "/api/ota")
+        resp = conn.getresponse()
+        if resp.status != 200:
+            raise RuntimeError("GET /api/ota returned %d" % resp.status)
+        return json.loads(resp.read())
+    finally:
+        conn.close()
+
+
+def push(host, image, digest, signature, reboot, timeout):
+    query = "?sha256=" + digest
+    if signature:
+        query += "&sig=" + signature.hex()
+    if not reboot:
+        query += "&reboot=0"
+
+    conn = http.client.HTTPConnection(host, timeout=timeout)
+    try:
+        conn.putrequest("POST", "/api/ota" + query)
+        conn.putheader("Content-Type", "application/octet-stream")
+        conn.putheader("Content-Length", str(len(image)))
+        conn.endheaders()
+        view = memoryview(image)
+        for pos in range(0, len(image), CHUNK):
+            conn.send(view[pos:pos + CHUNK])
+        resp = conn.getresponse()
+        body = resp.read()
+    finally:
+        conn.close()
+    try:
+        reply = json.loads(body)
+    except ValueError:
+        reply = {}
+    if resp.status != 200:
+        raise RuntimeError("%d %s" % (resp.status, reply.get("error") or reply.get("message") or resp.reason))
+    if reply.get("sha256") != digest:
+        raise RuntimeError("device reports SHA-256 %s" % reply.get("sha256"))
+    return reply
+
+
+def wait_for_version(host, version, deadline):
+    """Poll until the board runs `version` and has confirmed it; fails if it comes back on another image."""
+    time.sleep(3)
+    while time.monotonic() < deadline:
+        try:
+            st = get_status(host)
+        except (OSError, RuntimeError, ValueError):
+            time.sleep(2)
+            continue
+        if st["version"] != version:
+            if st.get("rolled_back_version") == version:
+                raise RuntimeError("new image failed its self-test; rolled back to %s" % st["version"])
+            # Still shutting down, or booted the old image after a reset during the trial
+            time.sleep(2)
+            continue
+        if not st["pending_verify"]:
+            return st
+        time.sleep(2)
+    raise RuntimeError("timed out waiting for %s to confirm" % version)
+
+
+def update(host, args, image, digest, signature, version):
+    # Boards on a single factory partition have nowhere to put the image; say so before sending it
+    slot = get_status(host).get("slot_size")
+    if slot == 0:
+        raise RuntimeError("no update slot in the partition table; flash this board over USB")
+    if slot is not None and len(image) > slot:
+        raise RuntimeError("image is %d bytes, the update slot %d" % (len(image), slot))
+    start = time.monotonic()
+    reply = push(host, image, digest, signature, not args.no_reboot, args.timeout)
+    sent = time.monotonic() - start
+    msg = "stored %s in %.1f s (%.0f KB/s)" % (reply.get("version", version), sent,
+                                               len(image) / 1024 / max(sent, 0.001))
+    if args.wait and not args.no_reboot:
+        st = wait_for_version(host, reply.get("version", version), time.monotonic() + args.wait_timeout)
+        msg += ", running from %s and confirmed" % st["partition"]
+    return msg
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Push a firmware image to Ghost ESP boards over Wi-Fi")
+    parser.add_argument("image", help="application image, e.g. build/Ghost_ESP_IDF.bin")
+    parser.add_argument("hosts", nargs="*", help="device addresses, e.g. 192.168.4.1")
+    parser.add_argument("--hosts", dest="hosts_file", help="file with one address per line")
+    parser.add_argument("--parallel", type=int, default=4, help="boards updated at once (default 4)")
+    parser.add_argument("--sign-key", help="private key PEM to sign the image with (openssl)")
+    parser.add_argument("--sig", help="DER signature file to send with the image")
+    parser.add_argument("--no-reboot", action="store_true", help="store the image but do not restart")
+    parser.add_argument("--wait", action="store_true", help="wait for each board to run and confirm the image")
+    parser.add_argument("--timeout", type=float, default=60, help="socket timeout in seconds")
+    parser.add_argument("--wait-timeout", type=float, default=120, help="seconds to wait for confirmation")
+    args = parser.parse_args()
+
+    hosts = list(args.hosts)
+    if args.hosts_file:
+        with open(args.hosts_file) as f:
+            hosts += [line.strip() for line in f if line.strip() and not line.startswith("#")]
+    if not hosts:
+        parser.error("no devices given")
+
+    with open(args.image, "rb") as f:
+        image = f.read()
+    version = image_version(image)
+    if version is None:
+        sys.exit("%s is not an application image (use build/<project>.bin, not the merged image)" % args.image)
+    digest = hashlib.sha256(image).hexdigest()
+    signature = None
+    if args.sig:
+        with open(args.sig, "rb") as f:
+            signature = f.read()
+    elif args.sign_key:
+        signature = sign_image(args.image, args.sign_key)
+    print("%s: version %s, %d bytes, sha256 %s%s" %
+          (args.image, version, len(image), digest, ", signed" if signature else ""))
+
+    failed = 0
+    with concurrent.futures.ThreadPoolExecutor(max_workers=max(1, args.parallel)) as pool:
+        jobs = {pool.submit(update, host, args, image, digest, signature, version): host for host in hosts}
+        for job in concurrent.futures.as_completed(jobs):
+            host = jobs[job]
+            try:
+                print("  %-21s ok: %s" % (host, job.result()))
+            except Exception as e:
+                failed += 1
+                print("  %-21s FAILED: %s" % (host, e))
+
+    print("%d of %d updated" % (len(hosts) - failed, len(hosts)))
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
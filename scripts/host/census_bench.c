@@ -0,0 +1,545 @@
+// Host benchmark and accuracy check for the probe census (core/census_sketch.c).
+//
+//   make -C scripts/host census_bench
+//   scripts/host/census_bench [-n devices] [-p probes] [-t trials]
+//   scripts/host/census_bench [-f] trace.pcap labels.txt
+//
+// Times what the RX path and the minute task spend per call: adding a hash to the sketch, fingerprinting
+// a probe request, merging two sketches and taking an estimate. Then checks the sketch against exact
+// counts: over many trials at 100 to 1M distinct hashes its bias and RMS error must stay near the
+// 1.04/sqrt(m) = 3.3% it is designed for, and a merged sketch must equal one fed both inputs.
+//
+// Last, a labelled probe trace is replayed frame by frame. Without arguments one is synthesized and
+// written as a pcap with a labels file next to it: n devices of 64 chipset models, 40% with their
+// global MAC and the rest rotating random MACs every few probes, each probe with its own SSID,
+// channel, sequence number and vendor IE payload. Every device must keep one fingerprint across all of
+// that, the distinct fingerprints must be exactly the global-MAC devices plus the models seen from
+// random MACs (identical chipsets can't be told apart), and the estimate must be within 10% of them.
+//
+// Given a trace (classic pcap of 802.11 or radiotap frames, -f if frames end in an FCS) and a labels
+// file holding the true device of each frame on its own line, it reports how many devices split over
+// several fingerprints, how many fingerprints several devices share, and the estimate against both.
+
+#define _GNU_SOURCE
+#include "core/census_sketch.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define MODELS 64
+
+static int device_count = 2000;
+static int probes_per_device = 20;
+static int trials = 40;
+static bool strip_fcs;
+static int failures;
+
+#define CHECK(cond, ...) do { \
+    if (!(cond)) { \
+        failures++; \
+        printf("  FAIL line %d: ", __LINE__); \
+        printf(__VA_ARGS__); \
+        printf("\n"); \
+    } \
+} while (0)
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint64_t rng_state = 0x9e3779b97f4a7c15ULL;
+
+// splitmix64: every output is a well mixed 64-bit value, as the fingerprint hash gives the sketch
+static uint64_t rng(void) {
+    uint64_t z = (rng_state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+static void put_u32(uint8_t* p, uint32_t v) {
+    p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+}
+
+static uint32_t get_u32(const uint8_t* p, bool swapped) {
+    return swapped ? ((uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3])
+                   : ((uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24);
+}
+
+// ---- speed ----
+
+static uint8_t sample_probe[160];
+static size_t sample_probe_len;
+static size_t build_probe(uint8_t* out, int model, const uint8_t* sa, uint16_t seq, int channel, const char* ssid);
+
+static void bench_speed(void) {
+    printf("speed (host CPU)\n");
+    hll_sketch_t sketch, other;
+    hll_reset(&sketch);
+    hll_reset(&other);
+
+    int adds = 20000000;
+    uint64_t h = 1;
+    double start = now_s();
+    for (int i = 0; i < adds; i++) {
+        h = h * 0x5851f42d4c957f2dULL + 0x14057b7ef767814fULL;
+        hll_add_hash(&sketch, h ^ (h >> 29));
+    }
+    double add_ns = (now_s() - start) * 1e9 / adds;
+
+    uint8_t sa[6] = {0x02, 0x11, 0x22, 0x33, 0x44, 0x55};
+    sample_probe_len = build_probe(sample_probe, 7, sa, 1, 6, "guest");
+    int prints = 2000000;
+    volatile uint64_t sink = 0;    // Keeps the calls from being optimized out
+    start = now_s();
+    for (int i = 0; i < prints; i++) {
+        sample_probe[22] = (uint8_t)i;  // Sequence number, as consecutive probes differ
+        sink += probe_census_fingerprint(sample_probe, sample_probe_len);
+    }
+    double print_ns = (now_s() - start) * 1e9 / prints;
+
+    int merges = 200000;
+    start = now_s();
+    for (int i = 0; i < merges; i++) {
+        other.registers[i & (PROBE_CENSUS_HLL_REGISTERS - 1)] = (uint8_t)(i & 31);
+        hll_merge(&sketch, &other);
+    }
+    double merge_us = (now_s() - start) * 1e6 / merges;
+
+    int estimates = 200000;
+    start = now_s();
+    for (int i = 0; i < estimates; i++) {
+        sketch.registers[i & (PROBE_CENSUS_HLL_REGISTERS - 1)] ^= 1;
+        sink += hll_estimate(&sketch);
+    }
+    double estimate_us = (now_s() - start) * 1e6 / estimates;
+
+    printf("  add %.1f ns, fingerprint %.0f ns (%zu byte random-MAC probe), merge %.2f us, estimate %.2f us\n",
+           add_ns, print_ns, sample_probe_len, merge_us, estimate_us);
+}
+
+// ---- sketch accuracy ----
+
+static void test_accuracy(void) {
+    printf("accuracy: %d trials per cardinality, design error %.1f%%\n", trials,
+           104.0 / sqrt(PROBE_CENSUS_HLL_REGISTERS));
+    static const uint32_t sizes[] = {100, 1000, 5000, 10000, 100000, 1000000};
+    double design = 1.04 / sqrt(PROBE_CENSUS_HLL_REGISTERS);
+    hll_sketch_t sketch;
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        uint32_t n = sizes[s];
+        int runs = n >= 1000000 ? (trials + 3) / 4 : trials;
+        double sum = 0, sum_sq = 0, worst = 0;
+        for (int t = 0; t < runs; t++) {
+            hll_reset(&sketch);
+            for (uint32_t i = 0; i < n; i++) {
+                uint64_t v = rng();
+                hll_add_hash(&sketch, v);
+                if (i % 3 == 0) {
+                    hll_add_hash(&sketch, v);   // Repeats must not count
+                }
+            }
+            double err = ((double)hll_estimate(&sketch) - n) / n;
+            sum += err;
+            sum_sq += err * err;
+            worst = fabs(err) > worst ? fabs(err) : worst;
+        }
+        double bias = sum / runs;
+        double rms = sqrt(sum_sq / runs);
+        printf("  %8u distinct: bias %+5.2f%%, rms %5.2f%%, worst %5.2f%% over %d runs\n", n, bias * 100, rms * 100,
+               worst * 100, runs);
+        // Linear counting is tighter than the design error below 2.5m; above, the raw estimate is at it.
+        // Both bounds leave room for the sampling error of runs trials.
+        CHECK(rms < design * (1 + 3 / sqrt(2.0 * runs)), "%u: rms error %.2f%% against a design %.2f%%", n,
+              rms * 100, design * 100);
+        CHECK(fabs(bias) < 4 * design / sqrt(runs), "%u: bias %.2f%%", n, bias * 100);
+    }
+
+    // A merge is the register-wise max, so it must equal a sketch fed both inputs
+    hll_sketch_t a, b, both;
+    hll_reset(&a);
+    hll_reset(&b);
+    hll_reset(&both);
+    for (int i = 0; i < 30000; i++) {
+        uint64_t v = rng();
+        hll_add_hash(i % 2 ? &a : &b, v);
+        hll_add_hash(&both, v);
+    }
+    hll_merge(&a, &b);
+    CHECK(memcmp(a.registers, both.registers, sizeof(a.registers)) == 0, "merged sketch differs");
+
+    hll_reset(&sketch);
+    CHECK(hll_estimate(&sketch) == 0, "empty sketch estimates %u", hll_estimate(&sketch));
+}
+
+// ---- synthesized trace ----
+
+static size_t put_ie(uint8_t* p, uint8_t id, const uint8_t* body, uint8_t len) {
+    p[0] = id;
+    p[1] = len;
+    memcpy(p + 2, body, len);
+    return 2 + (size_t)len;
+}
+
+// A probe request the way a chipset model sends it: the model fixes which IEs appear, their order and
+// the capability contents; SSID, channel, sequence and the vendor IE payload change from probe to probe
+static size_t build_probe(uint8_t* out, int model, const uint8_t* sa, uint16_t seq, int channel, const char* ssid) {
+    uint8_t* p = out;
+    static const uint8_t broadcast[6] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+    p[0] = 0x40;
+    p[1] = 0x00;
+    p[2] = p[3] = 0;
+    memcpy(p + 4, broadcast, 6);
+    memcpy(p + 10, sa, 6);
+    memcpy(p + 16, broadcast, 6);
+    p[22] = (uint8_t)(seq << 4);
+    p[23] = (uint8_t)(seq >> 4);
+    p += 24;
+
+    p += put_ie(p, 0, (const uint8_t*)ssid, (uint8_t)strlen(ssid));
+    static const uint8_t rates_a[] = {0x02, 0x04, 0x0b, 0x16, 0x0c, 0x12, 0x18, 0x24};
+    static const uint8_t rates_b[] = {0x82, 0x84, 0x8b, 0x96, 0x0c, 0x12, 0x18, 0x24};
+    static const uint8_t ext_rates[] = {0x30, 0x48, 0x60, 0x6c};
+    p += put_ie(p, 1, model & 1 ? rates_a : rates_b, 8);
+    uint8_t ds = (uint8_t)channel;
+    if (model & 2) {
+        p += put_ie(p, 3, &ds, 1);
+    }
+    p += put_ie(p, 50, ext_rates, sizeof(ext_rates));
+    if (!(model & 2)) {
+        p += put_ie(p, 3, &ds, 1);   // Some drivers put the channel after the extended rates
+    }
+
+    uint8_t ht[26] = {0};
+    ht[0] = (uint8_t)(0x2d | (model & 0x40));
+    ht[1] = (uint8_t)(0x01 + (model >> 3 & 3));
+    ht[2] = 0x17;
+    ht[3] = 0xff;
+    ht[4] = model & 4 ? 0xff : 0x00;   // Second spatial stream
+    p += put_ie(p, 45, ht, sizeof(ht));
+
+    uint8_t ext_caps[10] = {0x04, 0x00, 0x08, 0x84, 0, 0, 0, 0x40, (uint8_t)(model >> 5), 0x20};
+    p += put_ie(p, 127, ext_caps, (uint8_t)(model & 8 ? 10 : 8));
+    if (model & 16) {
+        uint8_t vht[12] = {0x32, 0x00, 0x80, 0x03, 0xfe, 0xff, 0, 0, 0xfe, 0xff, 0, 0};
+        vht[1] = (uint8_t)model;
+        p += put_ie(p, 191, vht, sizeof(vht));
+    }
+
+    // WPS (Microsoft OUI, type 4); its payload carries a per-probe request id here
+    uint8_t wps[14] = {0x00, 0x50, 0xf2, 0x04, 0x10, 0x4a, 0x00, 0x01, 0x10};
+    uint64_t r = rng();
+    memcpy(wps + 9, &r, 5);
+    p += put_ie(p, 221, wps, sizeof(wps));
+    if (model & 32) {
+        uint8_t vendor[7] = {0x00, 0x17, 0xf2, 0x0a, 0x00, 0x01, 0x04};   // Apple
+        vendor[6] = (uint8_t)rng();
+        p += put_ie(p, 221, vendor, sizeof(vendor));
+    }
+    return (size_t)(p - out);
+}
+
+typedef struct {
+    int model;
+    bool global;
+    uint8_t mac[6];
+    int probes_left;
+    int rotate_in;
+    uint16_t seq;
+} device_t;
+
+static void random_local_mac(uint8_t* mac) {
+    uint64_t r = rng();
+    memcpy(mac, &r, 6);
+    mac[0] = (uint8_t)((mac[0] & 0xfc) | 0x02);
+}
+
+// Writes the trace and its labels; returns the identities the census can tell apart
+static size_t build_trace(const char* pcap_path, const char* labels_path, size_t* global_devices,
+                          size_t* random_models) {
+    FILE* pcap = fopen(pcap_path, "wb");
+    FILE* labels = fopen(labels_path, "w");
+    if (pcap == NULL || labels == NULL) {
+        perror(pcap_path);
+        exit(1);
+    }
+    uint8_t header[24] = {0};
+    put_u32(header, 0xA1B2C3D4);
+    header[4] = 2;
+    header[6] = 4;
+    put_u32(header + 16, 65535);
+    put_u32(header + 20, 105);
+    fwrite(header, 1, sizeof(header), pcap);
+
+    device_t* devices = calloc((size_t)device_count, sizeof(device_t));
+    bool models_random[MODELS] = {false};
+    long total = 0;
+    *global_devices = 0;
+    for (int i = 0; i < device_count; i++) {
+        device_t* d = &devices[i];
+        d->model = (int)(rng() % MODELS);
+        d->global = rng() % 10 < 4;
+        if (d->global) {
+            uint64_t r = rng();
+            memcpy(d->mac, &r, 6);
+            d->mac[0] &= 0xfc;
+            d->mac[2] = (uint8_t)i;     // Keep global MACs apart
+            d->mac[3] = (uint8_t)(i >> 8);
+            (*global_devices)++;
+        } else {
+            random_local_mac(d->mac);
+            models_random[d->model] = true;
+        }
+        d->probes_left = 1 + (int)(rng() % (uint64_t)(2 * probes_per_device));
+        d->rotate_in = 1 + (int)(rng() % 8);
+        d->seq = (uint16_t)rng();
+        total += d->probes_left;
+    }
+    *random_models = 0;
+    for (int m = 0; m < MODELS; m++) {
+        *random_models += models_random[m];
+    }
+
+    // Devices take turns at random, as probes from many phones interleave on the air
+    static const char* ssids[] = {"", "", "", "home", "CoffeeShop", "eduroam", "Airport_Free_WiFi", "xfinitywifi"};
+    uint8_t frame[256];
+    uint32_t ts = 1700000000;
+    int alive = device_count;
+    while (alive > 0) {
+        int i = (int)(rng() % (uint64_t)device_count);
+        device_t* d = &devices[i];
+        if (d->probes_left == 0) {
+            continue;
+        }
+        if (!d->global && --d->rotate_in == 0) {
+            random_local_mac(d->mac);
+            d->rotate_in = 1 + (int)(rng() % 8);
+        }
+        d->seq = (uint16_t)((d->seq + 1) & 0xfff);
+        size_t len = build_probe(frame, d->model, d->mac, d->seq, 1 + (int)(rng() % 13),
+                                 ssids[rng() % (sizeof(ssids) / sizeof(ssids[0]))]);
+        uint8_t rec[16];
+        put_u32(rec, ts++);
+        put_u32(rec + 4, 0);
+        put_u32(rec + 8, (uint32_t)len);
+        put_u32(rec + 12, (uint32_t)len);
+        fwrite(rec, 1, sizeof(rec), pcap);
+        fwrite(frame, 1, len, pcap);
+        fprintf(labels, "device-%d\n", i);
+        if (--d->probes_left == 0) {
+            alive--;
+        }
+    }
+    fclose(pcap);
+    fclose(labels);
+    free(devices);
+    printf("  synthesized %ld probes from %d devices (%zu with a global MAC, %zu models behind random MACs)\n",
+           total, device_count, *global_devices, *random_models);
+    return *global_devices + *random_models;
+}
+
+// ---- replay ----
+
+typedef struct {
+    const char* label;
+    uint64_t fingerprint;
+} labelled_t;
+
+static int cmp_by_label(const void* a, const void* b) {
+    const labelled_t* x = a;
+    const labelled_t* y = b;
+    int c = strcmp(x->label, y->label);
+    return c ? c : (x->fingerprint < y->fingerprint ? -1 : x->fingerprint > y->fingerprint);
+}
+
+static int cmp_by_fingerprint(const void* a, const void* b) {
+    const labelled_t* x = a;
+    const labelled_t* y = b;
+    if (x->fingerprint != y->fingerprint) {
+        return x->fingerprint < y->fingerprint ? -1 : 1;
+    }
+    return strcmp(x->label, y->label);
+}
+
+typedef struct {
+    size_t probes;
+    size_t devices;          // Distinct labels
+    size_t identities;       // Distinct fingerprints
+    size_t split_devices;    // Labels seen with more than one fingerprint
+    size_t shared;           // Fingerprints seen with more than one label
+    uint32_t estimate;
+} replay_result_t;
+
+// Read the labels (one per frame) and feed every probe request of the pcap through the fingerprint and
+// a sketch, as probe_census_process_frame does
+static bool replay(const char* pcap_path, const char* labels_path, replay_result_t* r) {
+    memset(r, 0, sizeof(*r));
+    FILE* f = fopen(pcap_path, "rb");
+    FILE* lf = fopen(labels_path, "r");
+    uint8_t header[24];
+    if (f == NULL || lf == NULL || fread(header, 1, sizeof(header), f) != sizeof(header)) {
+        fprintf(stderr, "%s, %s: cannot read\n", pcap_path, labels_path);
+        if (f != NULL) fclose(f);
+        if (lf != NULL) fclose(lf);
+        return false;
+    }
+    uint32_t magic = get_u32(header, false);
+    bool swapped = magic == 0xD4C3B2A1 || magic == 0x4D3CB2A1;
+    uint32_t linktype = get_u32(header + 20, swapped);
+    if ((!swapped && magic != 0xA1B2C3D4 && magic != 0xA1B23C4D) || (linktype != 105 && linktype != 127)) {
+        fprintf(stderr, "%s: not a classic pcap of 802.11 or radiotap frames (convert with editcap -F pcap)\n",
+                pcap_path);
+        fclose(f);
+        fclose(lf);
+        return false;
+    }
+
+    hll_sketch_t sketch;
+    hll_reset(&sketch);
+    size_t cap = 4096;
+    labelled_t* seen = malloc(cap * sizeof(labelled_t));
+    static uint8_t frame[65536];
+    char label[128];
+    uint8_t rec[16];
+    bool ok = true;
+    while (fread(rec, 1, sizeof(rec), f) == sizeof(rec)) {
+        uint32_t incl = get_u32(rec + 8, swapped);
+        if (incl > sizeof(frame) || fread(frame, 1, incl, f) != incl) {
+            break;
+        }
+        if (fgets(label, sizeof(label), lf) == NULL) {
+            fprintf(stderr, "%s: fewer labels than frames\n", labels_path);
+            ok = false;
+            break;
+        }
+        label[strcspn(label, "\r\n")] = '\0';
+
+        size_t skip = linktype == 127 && incl >= 4 ? (size_t)(frame[2] | frame[3] << 8) : 0;
+        size_t len = incl > skip ? incl - skip : 0;
+        if (strip_fcs) {
+            len = len >= 4 ? len - 4 : 0;
+        }
+        const uint8_t* p = frame + skip;
+        if (len < 24 || p[0] != 0x40) {
+            continue;   // Same filter as probe_census_process_frame
+        }
+        uint64_t fp = probe_census_fingerprint(p, len);
+        hll_add_hash(&sketch, fp);
+        if (r->probes == cap) {
+            cap *= 2;
+            seen = realloc(seen, cap * sizeof(labelled_t));
+        }
+        seen[r->probes].label = strdup(label);
+        seen[r->probes].fingerprint = fp;
+        r->probes++;
+    }
+    fclose(f);
+    fclose(lf);
+    r->estimate = hll_estimate(&sketch);
+
+    // Devices and how many fingerprints each one showed
+    qsort(seen, r->probes, sizeof(labelled_t), cmp_by_label);
+    for (size_t i = 0; i < r->probes;) {
+        size_t j = i + 1, prints = 1;
+        for (; j < r->probes && strcmp(seen[j].label, seen[i].label) == 0; j++) {
+            prints += seen[j].fingerprint != seen[j - 1].fingerprint;
+        }
+        r->devices++;
+        r->split_devices += prints > 1;
+        i = j;
+    }
+    // Fingerprints and how many devices showed each one
+    qsort(seen, r->probes, sizeof(labelled_t), cmp_by_fingerprint);
+    for (size_t i = 0; i < r->probes;) {
+        size_t j = i + 1, labels = 1;
+        for (; j < r->probes && seen[j].fingerprint == seen[i].fingerprint; j++) {
+            labels += strcmp(seen[j].label, seen[j - 1].label) != 0;
+        }
+        r->identities++;
+        r->shared += labels > 1;
+        i = j;
+    }
+    for (size_t i = 0; i < r->probes; i++) {
+        free((void*)seen[i].label);
+    }
+    free(seen);
+    return ok;
+}
+
+static void report(const replay_result_t* r) {
+    printf("  %zu probe requests from %zu devices: %zu fingerprints, %zu devices split over several, "
+           "%zu shared by several devices\n", r->probes, r->devices, r->identities, r->split_devices, r->shared);
+    printf("  estimate %u: %+.1f%% against the fingerprints, %+.1f%% against the devices\n", r->estimate,
+           r->identities ? 100.0 * ((double)r->estimate - r->identities) / r->identities : 0.0,
+           r->devices ? 100.0 * ((double)r->estimate - r->devices) / r->devices : 0.0);
+}
+
+static void test_synthetic_trace(void) {
+    printf("labelled trace\n");
+    char dir[] = "/tmp/census_bench_XXXXXX";
+    if (mkdtemp(dir) == NULL) {
+        perror(dir);
+        exit(1);
+    }
+    char pcap_path[64], labels_path[64];
+    snprintf(pcap_path, sizeof(pcap_path), "%s/probes.pcap", dir);
+    snprintf(labels_path, sizeof(labels_path), "%s/labels.txt", dir);
+
+    size_t global_devices, random_models;
+    size_t expected = build_trace(pcap_path, labels_path, &global_devices, &random_models);
+    replay_result_t r;
+    CHECK(replay(pcap_path, labels_path, &r), "replay");
+    report(&r);
+
+    CHECK(r.devices == (size_t)device_count, "%zu devices replayed, expected %d", r.devices, device_count);
+    CHECK(r.split_devices == 0, "%zu devices changed fingerprint between probes", r.split_devices);
+    CHECK(r.identities == expected, "%zu fingerprints, expected %zu global MACs + %zu random-MAC models",
+          r.identities, global_devices, random_models);
+    double err = fabs((double)r.estimate - r.identities) / r.identities;
+    CHECK(err < 0.10, "estimate %u is %.1f%% off %zu fingerprints", r.estimate, err * 100, r.identities);
+
+    unlink(pcap_path);
+    unlink(labels_path);
+    rmdir(dir);
+}
+
+int main(int argc, char** argv) {
+    int opt;
+    while ((opt = getopt(argc, argv, "n:p:t:f")) != -1) {
+        switch (opt) {
+        case 'n': device_count = atoi(optarg); break;
+        case 'p': probes_per_device = atoi(optarg); break;
+        case 't': trials = atoi(optarg); break;
+        case 'f': strip_fcs = true; break;
+        default:
+            fprintf(stderr, "usage: %s [-n devices] [-p probes] [-t trials] | [-f] trace.pcap labels.txt\n",
+                    argv[0]);
+            return 2;
+        }
+    }
+    if (optind + 2 == argc) {
+        replay_result_t r;
+        if (!replay(argv[optind], argv[optind + 1], &r)) {
+            return 1;
+        }
+        report(&r);
+        return 0;
+    }
+    if (optind != argc || device_count < 1 || probes_per_device < 1 || trials < 4) {
+        fprintf(stderr, "usage: %s [-n devices] [-p probes] [-t trials] | [-f] trace.pcap labels.txt\n", argv[0]);
+        return 2;
+    }
+
+    bench_speed();
+    test_accuracy();
+    test_synthetic_trace();
+
+    printf(failures ? "FAILED (%d)\n" : "OK\n", failures);
+    return failures ? 1 : 0;
+}
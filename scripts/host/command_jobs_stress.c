@@ -0,0 +1,293 @@
+// Host stress test for the web command jobs (core/command_jobs.c).
+//
+//   make -C scripts/host command_jobs_stress
+//   scripts/host/command_jobs_stress [-c clients] [-n requests_per_client] [-l max_lines]
+//
+// One thread plays the serial task and runs jobs; each command prints numbered lines tagged with the
+// request's own token, some long enough to overflow the output window. Hundreds of client threads submit
+// at once, cycling through the three API modes: queue (poll GET /api/command?id=&offset= until done),
+// sync (reply built from the job when it finishes) and stream (output as it is printed). Every reply
+// must carry only its own request's output, in order and complete apart from reported skips; submitting
+// must never wait, a full queue must be answered busy, and the counters must add up.
+
+#define _GNU_SOURCE
+#include "core/command_jobs.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+enum { MODE_QUEUE, MODE_SYNC, MODE_STREAM };
+
+static int clients = 300;
+static int requests_per_client = 4;
+static int max_lines = 60;
+static atomic_int clients_done;
+
+static atomic_ulong busy;
+static atomic_ulong accepted;
+static atomic_ulong expired;
+static atomic_ulong failures;
+static atomic_ulong skipped_bytes;
+static atomic_ulong max_submit_ns;
+
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t done_cond;
+    bool done;
+    bool stream;
+    int result;
+    char* out;
+    size_t len;
+    size_t cap;
+    uint32_t skipped;
+    unsigned chunks_before_done;
+} reply_t;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// Output a command "run <token> <lines>" prints; the executor and the checks build it the same way
+static size_t expected_output(unsigned token, unsigned lines, char* out, size_t cap) {
+    size_t len = 0;
+    for (unsigned i = 0; i < lines && len < cap; i++) {
+        len += (size_t)snprintf(out + len, cap - len, "t%u line %u %.*s\n", token, i, (int)((token + i) % 30),
+                                "..............................");
+    }
+    return len < cap ? len : cap;
+}
+
+static void append(reply_t* r, const char* data, size_t len) {
+    if (r->len + len > r->cap) {
+        r->cap = (r->len + len) * 2;
+        r->out = realloc(r->out, r->cap);
+    }
+    memcpy(r->out + r->len, data, len);
+    r->len += len;
+}
+
+// Same shape as the firmware's reply sink: stream passes the output on, sync reads the job at the end
+static void reply_sink(void* ctx, uint32_t id, const char* data, size_t len, bool done, int result) {
+    reply_t* r = ctx;
+    pthread_mutex_lock(&r->lock);
+    if (r->stream && len > 0) {
+        append(r, data, len);
+        r->chunks_before_done++;
+    } else if (!r->stream && done) {
+        char buf[COMMAND_JOB_OUTPUT_MAX];
+        size_t n = 0;
+        command_job_info_t info;
+        if (command_jobs_read(id, 0, buf, sizeof(buf), &n, &info) == ESP_OK) {
+            append(r, buf, n);
+            r->skipped = info.skipped;
+        } else {
+            atomic_fetch_add(&failures, 1);
+            fprintf(stderr, "job %u vanished while its sink ran\n", id);
+        }
+    }
+    if (done) {
+        r->done = true;
+        r->result = result;
+        pthread_cond_signal(&r->done_cond);
+    }
+    pthread_mutex_unlock(&r->lock);
+}
+
+static void* executor_main(void* arg) {
+    char command[COMMAND_JOB_TEXT_MAX];
+    char line[160];
+    for (;;) {
+        uint32_t id;
+        if (!command_jobs_next(command, sizeof(command), &id)) {
+            if (atomic_load(&clients_done) == clients) {
+                return NULL;
+            }
+            usleep(100);
+            continue;
+        }
+        unsigned token = 0, lines = 0;
+        if (sscanf(command, "run %u %u", &token, &lines) != 2) {
+            command_jobs_finish(id, -1);
+            continue;
+        }
+        // One write per line, as the line-buffered stdout tee does
+        for (unsigned i = 0; i < lines; i++) {
+            int n = snprintf(line, sizeof(line), "t%u line %u %.*s\n", token, i, (int)((token + i) % 30),
+                             "..............................");
+            command_jobs_output(line, (size_t)n);
+            if (i % 16 == 15) {
+                sched_yield();
+            }
+        }
+        command_jobs_finish(id, (int)(token % 7));
+    }
+}
+
+static bool check(const char* label, unsigned token, unsigned lines, const char* out, size_t len, uint32_t skipped) {
+    size_t cap = (size_t)lines * 64 + 1;
+    char* want = malloc(cap);
+    size_t want_len = expected_output(token, lines, want, cap);
+    bool ok = skipped + len == want_len && (len == 0 || memcmp(want + skipped, out, len) == 0);
+    if (!ok) {
+        fprintf(stderr, "%s t%u: got %zu bytes (+%u skipped), want %zu\n", label, token, len, skipped, want_len);
+        atomic_fetch_add(&failures, 1);
+    }
+    free(want);
+    return ok;
+}
+
+static void run_request(unsigned token, int mode) {
+    unsigned lines = (unsigned)(rand() % (max_lines + 1));
+    char command[64];
+    snprintf(command, sizeof(command), "run %u %u", token, lines);
+
+    reply_t r = {.stream = mode == MODE_STREAM};
+    pthread_mutex_init(&r.lock, NULL);
+    pthread_cond_init(&r.done_cond, NULL);
+
+    uint32_t id;
+    for (;;) {
+        uint64_t start = now_ns();
+        esp_err_t err = command_jobs_submit(command, mode == MODE_QUEUE ? NULL : reply_sink, &r, &id);
+        uint64_t took = now_ns() - start;
+        unsigned long prev = atomic_load(&max_submit_ns);
+        while (took > prev && !atomic_compare_exchange_weak(&max_submit_ns, &prev, took)) {
+        }
+        if (err == ESP_OK) {
+            break;
+        }
+        if (err != ESP_ERR_NO_MEM) {
+            fprintf(stderr, "submit failed: %d\n", err);
+            atomic_fetch_add(&failures, 1);
+            return;
+        }
+        atomic_fetch_add(&busy, 1);
+        usleep(200 + rand() % 2000);  // What a client does with 503 + Retry-After, compressed
+    }
+    atomic_fetch_add(&accepted, 1);
+
+    if (mode == MODE_QUEUE) {
+        char buf[COMMAND_JOB_OUTPUT_MAX];
+        char* out = malloc((size_t)lines * 64 + 1);
+        size_t len = 0;
+        uint32_t offset = 0, skipped = 0;
+        for (;;) {
+            size_t n = 0;
+            command_job_info_t info;
+            if (command_jobs_read(id, offset, buf, sizeof(buf), &n, &info) != ESP_OK) {
+                atomic_fetch_add(&expired, 1);  // Finished and its slot reused before this poll
+                free(out);
+                return;
+            }
+            if (info.id != id) {
+                fprintf(stderr, "asked for job %u, got %u\n", id, info.id);
+                atomic_fetch_add(&failures, 1);
+            }
+            memcpy(out + len, buf, n);
+            len += n;
+            skipped += info.skipped;
+            offset = info.next;
+            if (info.state == COMMAND_JOB_DONE && info.next == info.produced) {
+                if (info.result != (int)(token % 7)) {
+                    fprintf(stderr, "t%u: result %d\n", token, info.result);
+                    atomic_fetch_add(&failures, 1);
+                }
+                break;
+            }
+            usleep(200);
+        }
+        // Skips in the middle mean lost bytes; check everything after the last one
+        if (skipped == 0) {
+            check("queue", token, lines, out, len, 0);
+        }
+        atomic_fetch_add(&skipped_bytes, skipped);
+        free(out);
+        return;
+    }
+
+    pthread_mutex_lock(&r.lock);
+    while (!r.done) {
+        pthread_cond_wait(&r.done_cond, &r.lock);
+    }
+    pthread_mutex_unlock(&r.lock);
+    if (r.result != (int)(token % 7)) {
+        fprintf(stderr, "t%u: result %d\n", token, r.result);
+        atomic_fetch_add(&failures, 1);
+    }
+    if (r.stream && r.chunks_before_done != lines) {
+        fprintf(stderr, "t%u: %u chunks streamed for %u lines\n", token, r.chunks_before_done, lines);
+        atomic_fetch_add(&failures, 1);
+    }
+    check(mode == MODE_SYNC ? "sync" : "stream", token, lines, r.out, r.len, r.skipped);
+    atomic_fetch_add(&skipped_bytes, r.skipped);
+    free(r.out);
+    pthread_mutex_destroy(&r.lock);
+    pthread_cond_destroy(&r.done_cond);
+}
+
+static void* client_main(void* arg) {
+    unsigned client = (unsigned)(uintptr_t)arg;
+    for (int i = 0; i < requests_per_client; i++) {
+        run_request(client * 1000u + (unsigned)i, (int)((client + (unsigned)i) % 3));
+    }
+    atomic_fetch_add(&clients_done, 1);
+    return NULL;
+}
+
+int main(int argc, char** argv) {
+    int opt;
+    while ((opt = getopt(argc, argv, "c:n:l:")) != -1) {
+        switch (opt) {
+            case 'c': clients = atoi(optarg); break;
+            case 'n': requests_per_client = atoi(optarg); break;
+            case 'l': max_lines = atoi(optarg); break;
+            default:
+                fprintf(stderr, "usage: %s [-c clients] [-n requests_per_client] [-l max_lines]\n", argv[0]);
+                return 2;
+        }
+    }
+    if (clients < 1 || requests_per_client < 1 || max_lines < 0) {
+        fprintf(stderr, "need at least one client and request\n");
+        return 2;
+    }
+    srand(1);
+
+    pthread_t executor;
+    pthread_t* threads = calloc((size_t)clients, sizeof(*threads));
+    pthread_create(&executor, NULL, executor_main, NULL);
+    for (int i = 0; i < clients; i++) {
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        pthread_attr_setstacksize(&attr, 64 * 1024);
+        pthread_create(&threads[i], &attr, client_main, (void*)(uintptr_t)i);
+        pthread_attr_destroy(&attr);
+    }
+    for (int i = 0; i < clients; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    pthread_join(executor, NULL);
+    free(threads);
+
+    command_jobs_stats_t stats;
+    command_jobs_get_stats(&stats);
+    unsigned long total = (unsigned long)clients * (unsigned long)requests_per_client;
+    printf("%lu requests: %lu accepted, %lu busy answers, %lu polls expired, %lu bytes skipped\n", total,
+           atomic_load(&accepted), atomic_load(&busy), atomic_load(&expired), atomic_load(&skipped_bytes));
+    printf("jobs: %u submitted, %u completed, %u rejected busy, %u output bytes, %u fell out of the window\n",
+           stats.submitted, stats.completed, stats.rejected_busy, stats.output_bytes, stats.output_skipped);
+    printf("slowest submit %.1f us\n", atomic_load(&max_submit_ns) / 1000.0);
+
+    if (stats.submitted != atomic_load(&accepted) || stats.completed != stats.submitted ||
+        stats.rejected_busy != atomic_load(&busy) || atomic_load(&accepted) != total) {
+        fprintf(stderr, "counters don't add up\n");
+        atomic_fetch_add(&failures, 1);
+    }
+    printf("%s\n", atomic_load(&failures) ? "FAIL" : "ok");
+    return atomic_load(&failures) ? 1 : 0;
+}
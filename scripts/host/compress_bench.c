@@ -0,0 +1,443 @@
+// Host benchmark for capture compression (core/lz4_stream.c and core/gzip_stream.c).
+//
+//   make -C scripts/host compress_bench
+//   scripts/host/compress_bench [-c checkpoint_kb] [-o dir] [trace.pcap ...]
+//
+// Each trace is compressed with LZ4 and gzip at several levels, ending a block/member every checkpoint
+// like the SD writer does, and the output is checked by decoding it again (LZ4 in process, gzip through
+// `gzip -dc`). Without arguments a synthetic beacon-heavy trace is generated; real captures from the
+// device compress differently, so pass a few of those for numbers worth quoting. With -o the traces
+// are also written through the SD writer as .pcap.lz4 / .pcap.gz for opening in Wireshark.
+
+#define _GNU_SOURCE
+#include "core/lz4_stream.h"
+#include "core/gzip_stream.h"
+#include "managers/sd_writer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <libgen.h>
+
+typedef struct {
+    uint8_t *data;
+    size_t len;
+    size_t cap;
+} buf_t;
+
+static void buf_put(buf_t *b, const void *data, size_t len) {
+    if (b->len + len > b->cap) {
+        b->cap = (b->len + len) * 2;
+        b->data = realloc(b->data, b->cap);
+        if (!b->data) {
+            perror("realloc");
+            exit(1);
+        }
+    }
+    memcpy(b->data + b->len, data, len);
+    b->len += len;
+}
+
+static esp_err_t sink(void *ctx, const uint8_t *data, size_t len) {
+    buf_put(ctx, data, len);
+    return ESP_OK;
+}
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint32_t rng_state = 0x12345678;
+
+static uint32_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static void put_u16(buf_t *b, uint16_t v) {
+    buf_put(b, &v, 2);
+}
+
+static void put_u32(buf_t *b, uint32_t v) {
+    buf_put(b, &v, 4);
+}
+
+static void put_record(buf_t *trace, uint64_t t_us, const uint8_t *frame, size_t len) {
+    put_u32(trace, (uint32_t)(t_us / 1000000));
+    put_u32(trace, (uint32_t)(t_us % 1000000));
+    put_u32(trace, (uint32_t)len);
+    put_u32(trace, (uint32_t)len);
+    buf_put(trace, frame, len);
+}
+
+// 40 APs beaconing every 102.4 ms, some probe requests and a share of encrypted data frames: roughly
+// what `capture -beacon` or `capture -raw` records in a busy place
+static void synthetic_trace(buf_t *trace, double seconds) {
+    enum { AP_COUNT = 40 };
+    struct {
+        uint8_t bssid[6];
+        char ssid[33];
+        uint8_t channel;
+        uint16_t seq;
+        uint64_t next_us;
+    } aps[AP_COUNT];
+
+    for (int i = 0; i < AP_COUNT; i++) {
+        for (int j = 0; j < 6; j++) {
+            aps[i].bssid[j] = (uint8_t)rng();
+        }
+        aps[i].bssid[0] &= 0xFC;
+        snprintf(aps[i].ssid, sizeof(aps[i].ssid), i % 3 ? "Network-%04X" : "HOME-%02X%02X-5G", rng() & 0xFFFF,
+                 (unsigned)(rng() & 0xFF));
+        aps[i].channel = 1 + rng() % 11;
+        aps[i].seq = rng() & 0xFFF;
+        aps[i].next_us = rng() % 102400;
+    }
+
+    put_u32(trace, 0xa1b2c3d4);
+    put_u16(trace, 2);
+    put_u16(trace, 4);
+    put_u32(trace, 0);
+    put_u32(trace, 0);
+    put_u32(trace, 4096);
+    put_u32(trace, 105);
+
+    uint64_t end_us = (uint64_t)(seconds * 1e6);
+    uint64_t t = 0;
+    uint8_t frame[1600];
+    while (t < end_us) {
+        int next = 0;
+        for (int i = 1; i < AP_COUNT; i++) {
+            if (aps[i].next_us < aps[next].next_us) next = i;
+        }
+        t = aps[next].next_us;
+        aps[next].next_us += 102400 + rng() % 200;
+
+        // Beacon: fixed header and IEs, only the TSF, sequence number and TIM change
+        size_t n = 0;
+        static const uint8_t fc[4] = {0x80, 0x00, 0x00, 0x00};
+        memcpy(frame, fc, 4);
+        memset(frame + 4, 0xFF, 6);
+        memcpy(frame + 10, aps[next].bssid, 6);
+        memcpy(frame + 16, aps[next].bssid, 6);
+        aps[next].seq = (aps[next].seq + 1) & 0xFFF;
+        frame[22] = (uint8_t)(aps[next].seq << 4);
+        frame[23] = (uint8_t)(aps[next].seq >> 4);
+        n = 24;
+        uint64_t tsf = t + next * 1000003ull;
+        memcpy(frame + n, &tsf, 8);
+        n += 8;
+        frame[n++] = 0x64;
+        frame[n++] = 0x00;
+        frame[n++] = 0x11;
+        frame[n++] = 0x04;
+        size_t ssid_len = strlen(aps[next].ssid);
+        frame[n++] = 0;
+        frame[n++] = (uint8_t)ssid_len;
+        memcpy(frame + n, aps[next].ssid, ssid_len);
+        n += ssid_len;
+        static const uint8_t rates[] = {1, 8, 0x82, 0x84, 0x8b, 0x96, 0x24, 0x30, 0x48, 0x6c};
+        memcpy(frame + n, rates, sizeof(rates));
+        n += sizeof(rates);
+        frame[n++] = 3;
+        frame[n++] = 1;
+        frame[n++] = aps[next].channel;
+        frame[n++] = 5;
+        frame[n++] = 4;
+        frame[n++] = (uint8_t)(aps[next].seq % 3);
+        frame[n++] = 3;
+        frame[n++] = 0;
+        frame[n++] = (uint8_t)(rng() & 1);
+        static const uint8_t tail[] = {
+            0x07, 0x06, 'U', 'S', ' ', 0x01, 0x0b, 0x1e,
+            0x30, 0x14, 0x01, 0x00, 0x00, 0x0f, 0xac, 0x04, 0x01, 0x00, 0x00, 0x0f, 0xac, 0x04, 0x01, 0x00,
+            0x00, 0x0f, 0xac, 0x02, 0x0c, 0x00,
+            0x2d, 0x1a, 0xad, 0x01, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x3d, 0x16, 0x01, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xdd, 0x18, 0x00, 0x50, 0xf2, 0x02, 0x01, 0x01, 0x80, 0x00, 0x03, 0xa4, 0x00, 0x00, 0x27, 0xa4,
+            0x00, 0x00, 0x42, 0x43, 0x5e, 0x00, 0x62, 0x32, 0x2f, 0x00};
+        memcpy(frame + n, tail, sizeof(tail));
+        n += sizeof(tail);
+        put_record(trace, t, frame, n);
+
+        uint32_t r = rng() % 100;
+        if (r < 8) {
+            // Probe request from a randomized MAC
+            static const uint8_t probe[] = {0x40, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+            memcpy(frame, probe, sizeof(probe));
+            for (int j = 10; j < 16; j++) frame[j] = (uint8_t)rng();
+            frame[10] = (frame[10] & 0xFC) | 0x02;
+            memset(frame + 16, 0xFF, 6);
+            frame[22] = (uint8_t)rng();
+            frame[23] = (uint8_t)rng();
+            n = 24;
+            frame[n++] = 0;
+            frame[n++] = 0;
+            memcpy(frame + n, rates, sizeof(rates));
+            n += sizeof(rates);
+            put_record(trace, t + 50, frame, n);
+        } else if (r < 20) {
+            // Encrypted data frame; the payload doesn't compress
+            static const uint8_t data_hdr[] = {0x88, 0x41, 0x2c, 0x00};
+            memcpy(frame, data_hdr, sizeof(data_hdr));
+            memcpy(frame + 4, aps[next].bssid, 6);
+            for (int j = 10; j < 16; j++) frame[j] = (uint8_t)rng();
+            memcpy(frame + 16, aps[next].bssid, 6);
+            n = 24 + 2 + 8 + 64 + rng() % 1200;
+            for (size_t j = 22; j < n; j++) frame[j] = (uint8_t)rng();
+            put_record(trace, t + 120, frame, n);
+        }
+    }
+}
+
+// LZ4 frame decoder, just enough to check what lz4_stream produces
+static bool lz4_decode(const uint8_t *src, size_t len, buf_t *out) {
+    static const uint8_t header[7] = {0x04, 0x22, 0x4D, 0x18, 0x60, 0x40, 0x82};
+    if (len < 11 || memcmp(src, header, sizeof(header)) != 0) {
+        return false;
+    }
+    size_t pos = sizeof(header);
+    while (pos + 4 <= len) {
+        uint32_t bsize = src[pos] | (src[pos + 1] << 8) | (src[pos + 2] << 16) | ((uint32_t)src[pos + 3] << 24);
+        pos += 4;
+        if (bsize == 0) {
+            return pos == len;
+        }
+        size_t n = bsize & 0x7FFFFFFF;
+        if (n > 65536 || pos + n > len) {
+            return false;
+        }
+        if (bsize & 0x80000000u) {
+            buf_put(out, src + pos, n);
+            pos += n;
+            continue;
+        }
+        size_t block_start = out->len;
+        const uint8_t *ip = src + pos;
+        const uint8_t *end = ip + n;
+        while (ip < end) {
+            uint8_t token = *ip++;
+            size_t lit = token >> 4;
+            if (lit == 15) {
+                uint8_t b;
+                do {
+                    if (ip >= end) return false;
+                    b = *ip++;
+                    lit += b;
+                } while (b == 255);
+            }
+            if (ip + lit > end) return false;
+            buf_put(out, ip, lit);
+            ip += lit;
+            if (ip == end) break;
+            if (ip + 2 > end) return false;
+            size_t offset = ip[0] | (ip[1] << 8);
+            ip += 2;
+            size_t ml = (token & 15) + 4;
+            if ((token & 15) == 15) {
+                uint8_t b;
+                do {
+                    if (ip >= end) return false;
+                    b = *ip++;
+                    ml += b;
+                } while (b == 255);
+            }
+            if (offset == 0 || offset > out->len - block_start) return false;
+            for (size_t i = 0; i < ml; i++) {
+                uint8_t c = out->data[out->len - offset];
+                buf_put(out, &c, 1);
+            }
+        }
+        pos += n;
+    }
+    return false;
+}
+
+static bool gzip_check(const buf_t *compressed, const buf_t *original) {
+    char path[] = "/tmp/compress_bench_XXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0 || write(fd, compressed->data, compressed->len) != (ssize_t)compressed->len) {
+        return false;
+    }
+    close(fd);
+
+    char cmd[64];
+    snprintf(cmd, sizeof(cmd), "gzip -dc < %s", path);
+    FILE *p = popen(cmd, "r");
+    bool ok = p != NULL;
+    size_t pos = 0;
+    uint8_t chunk[65536];
+    size_t n;
+    while (ok && (n = fread(chunk, 1, sizeof(chunk), p)) > 0) {
+        ok = pos + n <= original->len && memcmp(original->data + pos, chunk, n) == 0;
+        pos += n;
+    }
+    if (p != NULL && pclose(p) != 0) {
+        ok = false;
+    }
+    unlink(path);
+    return ok && pos == original->len;
+}
+
+typedef struct {
+    sd_writer_codec_t codec;
+    int level;
+} variant_t;
+
+static const variant_t variants[] = {
+    {SD_WRITER_CODEC_LZ4, 1}, {SD_WRITER_CODEC_LZ4, 5}, {SD_WRITER_CODEC_LZ4, 9},
+    {SD_WRITER_CODEC_GZIP, 1}, {SD_WRITER_CODEC_GZIP, 4}, {SD_WRITER_CODEC_GZIP, 6}, {SD_WRITER_CODEC_GZIP, 9},
+};
+
+static void bench(const char *name, const buf_t *trace, size_t checkpoint) {
+    printf("%s: %zu bytes, checkpoint every %zu KB\n", name, trace->len, checkpoint / 1024);
+    printf("  %-8s %5s %12s %7s %9s  %s\n", "codec", "level", "bytes", "ratio", "MB/s", "round trip");
+
+    // Records are fed one at a time like pcap_write_record() does
+    for (size_t v = 0; v < sizeof(variants) / sizeof(variants[0]); v++) {
+        buf_t out = {0};
+        bool lz4 = variants[v].codec == SD_WRITER_CODEC_LZ4;
+        lz4_stream_t *lz = lz4 ? lz4_stream_create(variants[v].level, sink, &out) : NULL;
+        gzip_stream_t *gz = lz4 ? NULL : gzip_stream_create(variants[v].level, sink, &out);
+
+        double start = now_s();
+        size_t pos = 24;
+        size_t since_checkpoint = 0;
+        if (lz4) lz4_stream_write(lz, trace->data, 24);
+        else gzip_stream_write(gz, trace->data, 24);
+        while (pos + 16 <= trace->len) {
+            uint32_t incl;
+            memcpy(&incl, trace->data + pos + 8, 4);
+            size_t rec = 16 + incl;
+            if (pos + rec > trace->len) {
+                break;
+            }
+            if (lz4) lz4_stream_write(lz, trace->data + pos, rec);
+            else gzip_stream_write(gz, trace->data + pos, rec);
+            pos += rec;
+            since_checkpoint += rec;
+            if (checkpoint && since_checkpoint >= checkpoint) {
+                if (lz4) lz4_stream_flush(lz);
+                else gzip_stream_new_member(gz);
+                since_checkpoint = 0;
+            }
+        }
+        if (lz4) {
+            lz4_stream_finish(lz);
+            lz4_stream_destroy(lz);
+        } else {
+            gzip_stream_finish(gz);
+            gzip_stream_destroy(gz);
+        }
+        double elapsed = now_s() - start;
+
+        buf_t check = {0};
+        buf_t original = {.data = trace->data, .len = pos};
+        bool ok = lz4 ? lz4_decode(out.data, out.len, &check) && check.len == pos &&
+                            memcmp(check.data, trace->data, pos) == 0
+                      : gzip_check(&out, &original);
+        printf("  %-8s %5d %12zu %6.1f%% %9.1f  %s\n", sd_writer_codec_name(variants[v].codec), variants[v].level,
+               out.len, 100.0 * out.len / pos, pos / elapsed / 1e6, ok ? "ok" : "FAILED");
+        free(out.data);
+        free(check.data);
+        if (!ok) {
+            exit(1);
+        }
+    }
+}
+
+// Write the trace through the SD writer with the device's stream settings and checkpoint policy
+static void write_through_sd_writer(const char *dir, const char *name, const buf_t *trace, size_t checkpoint) {
+    static const sd_writer_codec_t codecs[] = {SD_WRITER_CODEC_LZ4, SD_WRITER_CODEC_GZIP};
+    for (size_t c = 0; c < 2; c++) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s%s", dir, name, sd_writer_codec_suffix(codecs[c]));
+        sd_writer_stream_config_t config = {
+            .cluster_size = SD_WRITER_DEFAULT_CLUSTER_SIZE,
+            .sync_on_close = true,
+            .prealloc_bytes = SD_WRITER_DEFAULT_PREALLOC,
+            .codec = codecs[c],
+        };
+        sd_writer_stream_t *stream = sd_writer_open(path, "w", &config);
+        if (!stream) {
+            exit(1);
+        }
+        size_t written = 0;
+        size_t since_checkpoint = 0;
+        while (written < trace->len) {
+            size_t n = trace->len - written < 1500 ? trace->len - written : 1500;
+            while (sd_writer_write(stream, trace->data + written, n, 1000) != ESP_OK) {
+            }
+            written += n;
+            since_checkpoint += n;
+            if (since_checkpoint >= checkpoint) {
+                sd_writer_checkpoint(stream, NULL, NULL);
+                since_checkpoint = 0;
+            }
+        }
+        sd_writer_close(stream);
+        printf("  wrote %s\n", path);
+    }
+}
+
+static bool load(const char *path, buf_t *out) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    uint8_t chunk[65536];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+        buf_put(out, chunk, n);
+    }
+    fclose(f);
+    uint32_t magic = 0;
+    if (out->len >= 24) memcpy(&magic, out->data, 4);
+    if (magic != 0xa1b2c3d4) {
+        fprintf(stderr, "%s: not a little-endian classic pcap\n", path);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    size_t checkpoint = 64 * 1024;
+    const char *out_dir = NULL;
+    int opt;
+    while ((opt = getopt(argc, argv, "c:o:")) != -1) {
+        switch (opt) {
+            case 'c': checkpoint = strtoul(optarg, NULL, 10) * 1024; break;
+            case 'o': out_dir = optarg; break;
+            default:
+                fprintf(stderr, "usage: %s [-c checkpoint_kb] [-o dir] [trace.pcap ...]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    if (optind >= argc) {
+        buf_t trace = {0};
+        synthetic_trace(&trace, 120.0);
+        bench("synthetic (40 APs, 120 s)", &trace, checkpoint);
+        if (out_dir) write_through_sd_writer(out_dir, "synthetic.pcap", &trace, checkpoint);
+        free(trace.data);
+    }
+    for (int i = optind; i < argc; i++) {
+        buf_t trace = {0};
+        if (!load(argv[i], &trace)) {
+            return 1;
+        }
+        bench(argv[i], &trace, checkpoint);
+        if (out_dir) write_through_sd_writer(out_dir, basename(argv[i]), &trace, checkpoint);
+        free(trace.data);
+    }
+    if (out_dir) sd_writer_deinit();
+    return 0;
+}
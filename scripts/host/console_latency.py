@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+"""Compare the pushed /api/console stream with polling /api/logs.
+
+    python3 scripts/host/console_latency.py [--url http://192.168.4.1] [--count 20] [--poll 1.0]
+
+Each probe posts an unknown command named after a counter; the device answers it on the console with
+"Unknown command: <name>". The time from posting to seeing that line is measured once over the
+long-lived SSE stream and once by polling /api/logs?since=<cursor> every --poll seconds, along with
+the requests and bytes each approach needed. /api/console/stats is printed at the end for the
+device-side view (batching, send latency and time spent in the streaming task).
+"""
+
+import argparse
+import http.client
+import json
+import statistics
+import threading
+import time
+import urllib.parse
+
+
+def parse_events(lines):
+    """Yield (event, id, data) from an iterator of decoded SSE lines."""
+    event, ident, data = "message", None, []
+    for line in lines:
+        if line == "":
+            if data:
+                yield event, ident, "\n".join(data)
+            event, ident, data = "message", None, []
+        elif line.startswith(":"):
+            continue
+        else:
+            field, _, value = line.partition(":")
+            value = value[1:] if value.startswith(" ") else value
+            if field == "event":
+                event = value
+            elif field == "id":
+                ident = value
+            elif field == "data":
+                data.append(value)
+
+
+class Device:
+    def __init__(self, url):
+        parsed = urllib.parse.urlparse(url)
+        self.host = parsed.hostname
+        self.port = parsed.port or 80
+        self.requests = 0
+        self.bytes = 0
+
+    def request(self, method, path, body=None):
+        conn = http.client.HTTPConnection(self.host, self.port, timeout=10)
+        headers = {"Content-Type": "application/json"} if body is not None else {}
+        conn.request(method, path, body=body, headers=headers)
+        resp = conn.getresponse()
+        data = resp.read()
+        conn.close()
+        self.requests += 1
+        self.bytes += len(data)
+        return resp.status, data
+
+    def command(self, command):
+        return self.request("POST", "/api/command", json.dumps({"command": command}))
+
+
+class StreamReader(threading.Thread):
+    def __init__(self, device):
+        super().__init__(daemon=True)
+        self.conn = http.client.HTTPConnection(device.host, device.port, timeout=60)
+        self.conn.request("GET", "/api/console")
+        self.resp = self.conn.getresponse()
+        if self.resp.status != 200:
+            raise SystemExit("/api/console: HTTP %d" % self.resp.status)
+        self.seen = {}
+        self.bytes = 0
+        self.events = 0
+
+    def lines(self):
+        while True:
+            raw = self.resp.readline()
+            if not raw:
+                return
+            self.bytes += len(raw)
+            yield raw.decode("utf-8", "replace").rstrip("\r\n")
+
+    def run(self):
+        for event, _, data in parse_events(self.lines()):
+            self.events += 1
+            if event == "message" and "Unknown command: " in data:
+                self.seen.setdefault(data.split("Unknown command: ", 1)[1].strip(), time.monotonic())
+
+
+def wait_for(check, timeout):
+    deadline = time.monotonic() + timeout
+    while time.monotonic() < deadline:
+        found = check()
+        if found is not None:
+            return found
+        time.sleep(0.002)
+    return None
+
+
+def run_push(device, count, gap):
+    reader = StreamReader(device)
+    reader.start()
+    time.sleep(0.5)
+    latencies = []
+    for i in range(count):
+        name = "latency_push_%d_%d" % (int(time.time()), i)
+        sent = time.monotonic()
+        device.command(name)
+        seen = wait_for(lambda: reader.seen.get(name), 5.0)
+        if seen is not None:
+            latencies.append(seen - sent)
+        time.sleep(gap)
+    return latencies, reader.bytes, 1
+
+
+def run_poll(device, count, interval):
+    _, body = device.request("GET", "/api/logs")
+    cursor = 0
+    for _, ident, _ in parse_events(body.decode("utf-8", "replace").split("\n")):
+        cursor = int(ident) if ident else cursor
+    requests_before, bytes_before = device.requests, device.bytes
+
+    latencies = []
+    start = time.monotonic()
+    for i in range(count):
+        name = "latency_poll_%d_%d" % (int(time.time()), i)
+        # Probes land at varying points of a fixed poll schedule, as user actions would
+        time.sleep(interval * (1 + ((i * 7919) % 100) / 100.0))
+        sent = time.monotonic()
+        device.command(name)
+        found = False
+        while not found and time.monotonic() - sent < 5.0 + interval:
+            polls_done = int((time.monotonic() - start) / interval)
+            time.sleep(max(0.0, start + (polls_done + 1) * interval - time.monotonic()))
+            _, body = device.request("GET", "/api/logs?since=%d" % cursor)
+            for event, ident, data in parse_events(body.decode("utf-8", "replace").split("\n")):
+                cursor = int(ident) if ident else cursor
+                if event == "message" and data.strip().endswith(name):
+                    latencies.append(time.monotonic() - sent)
+                    found = True
+    return latencies, device.bytes - bytes_before, device.requests - requests_before
+
+
+def summary(label, latencies, nbytes, requests):
+    if not latencies:
+        print("%-6s no probes seen" % label)
+        return
+    latencies = sorted(latencies)
+    p95 = latencies[min(len(latencies) - 1, int(len(latencies) * 0.95))]
+    print("%-6s %3d probes  median %7.1f ms  p95 %7.1f ms  %5d requests  %8d bytes" %
+          (label, len(latencies), statistics.median(latencies) * 1000, p95 * 1000, requests, nbytes))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--url", default="http://192.168.4.1")
+    parser.add_argument("--count", type=int, default=20)
+    parser.add_argument("--poll", type=float, default=1.0, help="poll interval in seconds")
+    args = parser.parse_args()
+
+    device = Device(args.url)
+    summary("poll", *run_poll(device, args.count, args.poll))
+    summary("push", *run_push(device, args.count, args.poll / 2))
+
+    _, body = device.request("GET", "/api/console/stats")
+    print("device:", body.decode())
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""Throughput and conformance check for the /api/sdcard/download endpoint.
+
+Runs against the device (http://192.168.4.1) or the loopback server in this directory:
+
+    make -C scripts/host file_server
+    scripts/host/file_server -p 8080 /tmp/captures &
+    python3 scripts/host/download_bench.py --url http://127.0.0.1:8080 --local /tmp/captures \
+        /mnt/big.pcap /mnt/gps/wardriving_0.csv
+
+For every file it times full downloads, checks that two ranged halves reassemble the file, that
+If-None-Match revalidates with 304, that a stale If-Range falls back to 200, and that gzip
+responses decompress to the original bytes, carry their own ETag and are refused by q=0. With --local the bytes are compared against the
+copy on disk.
+"""
+
+import argparse
+import gzip
+import hashlib
+import http.client
+import os
+import sys
+import time
+import urllib.parse
+
+
+class Client:
+    def __init__(self, url):
+        parsed = urllib.parse.urlparse(url)
+        self.host = parsed.hostname
+        self.port = parsed.port or 80
+        self.conn = None
+
+    def get(self, path, headers=None):
+        target = "/api/sdcard/download?path=" + urllib.parse.quote(path)
+        for attempt in range(2):
+            if self.conn is None:
+                self.conn = http.client.HTTPConnection(self.host, self.port, timeout=30)
+            try:
+                self.conn.request("GET", target, headers=headers or {})
+                resp = self.conn.getresponse()
+                body = resp.read()
+                return resp.status, {k.lower(): v for k, v in resp.getheaders()}, body
+            except (http.client.HTTPException, ConnectionError):
+                self.conn.close()
+                self.conn = None
+                if attempt:
+                    raise
+
+
+def check(cond, what, failures):
+    if not cond:
+        failures.append(what)
+        print("    FAIL", what)
+
+
+def bench_file(client, path, local, repeat, failures):
+    print(path)
+    expected = None
+    if local:
+        with open(os.path.join(local, path[len("/mnt/"):]), "rb") as f:
+            expected = f.read()
+
+    best = None
+    body = b""
+    headers = {}
+    for _ in range(repeat):
+        start = time.perf_counter()
+        status, headers, body = client.get(path, {"Accept-Encoding": "identity"})
+        elapsed = time.perf_counter() - start
+        check(status == 200, "full GET status %d" % status, failures)
+        best = elapsed if best is None else min(best, elapsed)
+    size = len(body)
+    print("    full      %10d bytes  %8.1f MB/s" % (size, size / best / 1e6 if best else 0))
+    if expected is not None:
+        check(hashlib.sha256(body).digest() == hashlib.sha256(expected).digest(), "full body differs", failures)
+    check(headers.get("accept-ranges") == "bytes", "Accept-Ranges missing", failures)
+    etag = headers.get("etag")
+    check(etag is not None and headers.get("last-modified") is not None, "validators missing", failures)
+
+    if size >= 2:
+        half = size // 2
+        s1, h1, a = client.get(path, {"Range": "bytes=0-%d" % (half - 1)})
+        s2, h2, b = client.get(path, {"Range": "bytes=%d-" % len(a), "If-Range": etag})
+        check(s1 == 206 and s2 == 206, "range statuses %d/%d" % (s1, s2), failures)
+        check(a + b == body, "ranged halves do not reassemble", failures)
+        check(h2.get("content-range") == "bytes %d-%d/%d" % (len(a), size - 1, size),
+              "Content-Range %r" % h2.get("content-range"), failures)
+        s, _, tail = client.get(path, {"Range": "bytes=-10"})
+        check(s == 206 and tail == body[-10:], "suffix range", failures)
+
+    s, h, _ = client.get(path, {"Range": "bytes=%d-" % (size + 10)})
+    check(s == 416 and h.get("content-range") == "bytes */%d" % size, "unsatisfiable range gives %d" % s, failures)
+    s, _, b = client.get(path, {"If-None-Match": etag})
+    check(s == 304 and not b, "If-None-Match gives %d" % s, failures)
+    s, _, b = client.get(path, {"Range": "bytes=0-9", "If-Range": '"stale"'})
+    check(s == 200 and b == body, "stale If-Range gives %d" % s, failures)
+
+    start = time.perf_counter()
+    s, h, b = client.get(path, {"Accept-Encoding": "gzip"})
+    elapsed = time.perf_counter() - start
+    if h.get("content-encoding") == "gzip":
+        plain = gzip.decompress(b)
+        check(plain == body, "gzip body differs", failures)
+        print("    gzip      %10d bytes  %8.1f MB/s of file, ratio %.2f" %
+              (len(b), len(plain) / elapsed / 1e6, len(plain) / max(len(b), 1)))
+        s, _, _ = client.get(path, {"Accept-Encoding": "gzip", "If-None-Match": h.get("etag")})
+        check(s == 304, "gzip revalidation gives %d" % s, failures)
+        check(h.get("etag") != etag, "gzip and identity bodies share ETag %s" % etag, failures)
+        s, _, _ = client.get(path, {"Accept-Encoding": "identity", "If-None-Match": h.get("etag")})
+        check(s == 200, "identity request revalidated with the gzip ETag gives %d" % s, failures)
+        for refused in ("gzip;q=0", "gzip;q=0.0", "gzip; q=0", "deflate, gzip ; Q=0.000", "*, gzip;q=0"):
+            s, h2, _ = client.get(path, {"Accept-Encoding": refused})
+            check(h2.get("content-encoding") != "gzip", "gzip sent for %r" % refused, failures)
+        for accepted in ("gzip;q=0.5", "deflate, gzip; q=1", "*"):
+            s, h2, _ = client.get(path, {"Accept-Encoding": accepted})
+            check(h2.get("content-encoding") == "gzip", "gzip not sent for %r" % accepted, failures)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--url", default="http://192.168.4.1")
+    parser.add_argument("--local", help="directory that /mnt maps to, for byte comparison")
+    parser.add_argument("--repeat", type=int, default=3)
+    parser.add_argument("paths", nargs="+", help="file paths on the card, e.g. /mnt/ghostesp/pcaps/rawscan_0.pcap")
+    args = parser.parse_args()
+
+    client = Client(args.url)
+    failures = []
+    for path in args.paths:
+        bench_file(client, path, args.local, args.repeat, failures)
+    print("%d failure(s)" % len(failures))
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
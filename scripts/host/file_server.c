@@ -0,0 +1,243 @@
+// Loopback HTTP server around the device's SD transfer code, for measuring it on a PC.
+//
+//   make -C scripts/host file_server
+//   scripts/host/file_server [-p port] [-c chunk_bytes] [-s] <dir>
+//
+// Serves GET /api/sdcard/download?path=/mnt/<file> (file_download_serve) and
+// POST /api/sdcard/upload?path=/mnt/<dir> (sd_upload) from <dir>, the same way the device does.
+// -s disables the download read-ahead thread so single and double buffering can be compared.
+
+#include "managers/file_download.h"
+#include "managers/sd_upload.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+#define REQUEST_MAX 4096
+
+static const char *root_dir;
+static size_t chunk_size;
+static bool no_prefetch;
+
+static esp_err_t socket_send(void *ctx, const char *data, size_t len) {
+    int fd = *(int *)ctx;
+    while (len > 0) {
+        ssize_t n = send(fd, data, len, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return ESP_FAIL;
+        }
+        data += n;
+        len -= n;
+    }
+    return ESP_OK;
+}
+
+static void url_decode_into(char *dst, size_t dst_len, const char *src, size_t src_len) {
+    size_t o = 0;
+    for (size_t i = 0; i < src_len && o + 1 < dst_len; i++) {
+        if (src[i] == '%' && i + 2 < src_len) {
+            char hex[3] = {src[i + 1], src[i + 2], 0};
+            dst[o++] = (char)strtol(hex, NULL, 16);
+            i += 2;
+        } else {
+            dst[o++] = src[i] == '+' ? ' ' : src[i];
+        }
+    }
+    dst[o] = '\0';
+}
+
+// Copy the value of header name (case-insensitive) out of the request header block
+static bool find_header(const char *headers, const char *name, char *out, size_t out_len) {
+    size_t name_len = strlen(name);
+    for (const char *line = headers; *line; ) {
+        const char *next = strstr(line, "\r\n");
+        if (!next) next = line + strlen(line);
+        if (strncasecmp(line, name, name_len) == 0 && line[name_len] == ':') {
+            const char *value = line + name_len + 1;
+            while (*value == ' ') value++;
+            size_t len = next - value;
+            if (len >= out_len) len = out_len - 1;
+            memcpy(out, value, len);
+            out[len] = '\0';
+            return true;
+        }
+        line = *next ? next + 2 : next;
+    }
+    return false;
+}
+
+static esp_err_t send_json(int fd, int status, const char *reason, const char *body) {
+    char head[160];
+    int n = snprintf(head, sizeof(head), "HTTP/1.1 %d %s\r\nContent-Type: application/json\r\nContent-Length: %zu\r\n\r\n",
+                     status, reason, strlen(body));
+    esp_err_t ret = socket_send(&fd, head, n);
+    return ret == ESP_OK ? socket_send(&fd, body, strlen(body)) : ret;
+}
+
+// Feed the request body to sd_upload in the pieces recv() returns, like the device handler
+static esp_err_t handle_upload(int fd, const char *dir, const char *content_type, uint64_t length,
+                               const uint8_t *early, size_t early_len) {
+    sd_upload_t *up;
+    if (!dir[0] || sd_upload_begin(dir, content_type, &up) != ESP_OK) {
+        send_json(fd, 400, "Bad Request", "{\"error\": \"Bad upload request.\"}");
+        return ESP_FAIL;
+    }
+    esp_err_t ret = sd_upload_feed(up, early, early_len);
+    uint64_t remaining = length - early_len;
+    char buf[4096];
+    while (ret == ESP_OK && remaining > 0) {
+        ssize_t n = recv(fd, buf, remaining < sizeof(buf) ? remaining : sizeof(buf), 0);
+        if (n <= 0) {
+            sd_upload_abort(up);
+            return ESP_FAIL;
+        }
+        remaining -= n;
+        ret = sd_upload_feed(up, buf, n);
+    }
+    if (ret != ESP_OK) {
+        sd_upload_abort(up);
+        send_json(fd, 400, "Bad Request", "{\"error\": \"Upload failed.\"}");
+        return ESP_FAIL;
+    }
+    sd_upload_result_t result;
+    if (sd_upload_finish(up, &result) != ESP_OK) {
+        send_json(fd, 400, "Bad Request", "{\"error\": \"Malformed multipart body.\"}");
+        return ESP_FAIL;
+    }
+    char body[96];
+    snprintf(body, sizeof(body), "{\"files\": %u, \"bytes\": %llu}", result.files, (unsigned long long)result.bytes);
+    return send_json(fd, 200, "OK", body);
+}
+
+static void *connection_thread(void *arg) {
+    int fd = (int)(intptr_t)arg;
+    char buf[REQUEST_MAX + 1] = "";
+    size_t have = 0;
+
+    for (;;) {
+        char *end = NULL;
+        while (!(end = strstr(buf, "\r\n\r\n"))) {
+            if (have == REQUEST_MAX) goto out;
+            ssize_t n = recv(fd, buf + have, REQUEST_MAX - have, 0);
+            if (n <= 0) goto out;
+            have += n;
+            buf[have] = '\0';
+        }
+        size_t request_len = end + 4 - buf;
+        end[2] = '\0';
+
+        char method[8], target[1024];
+        if (sscanf(buf, "%7s %1023s", method, target) != 2) goto out;
+        char *headers = strstr(buf, "\r\n") + 2;
+
+        char path[1200] = "";
+        char *q = strstr(target, "path=");
+        if (q) {
+            char decoded[1024];
+            char *amp = strchr(q, '&');
+            url_decode_into(decoded, sizeof(decoded), q + 5, amp ? (size_t)(amp - q - 5) : strlen(q + 5));
+            if (strncmp(decoded, "/mnt", 4) == 0 && !strstr(decoded, "..")) {
+                snprintf(path, sizeof(path), "%s%s", root_dir, decoded + 4);
+            }
+        }
+
+        if (strcmp(method, "POST") == 0 && strncmp(target, "/api/sdcard/upload", 18) == 0) {
+            char content_type[256] = "", content_length[32] = "";
+            find_header(headers, "content-type", content_type, sizeof(content_type));
+            find_header(headers, "content-length", content_length, sizeof(content_length));
+            size_t body_have = have - request_len;
+            if (handle_upload(fd, path, content_type, strtoull(content_length, NULL, 10),
+                              (const uint8_t *)buf + request_len, body_have) != ESP_OK) {
+                goto out;
+            }
+            have = 0;
+            buf[0] = '\0';
+            continue;
+        }
+        if (strncmp(target, "/api/sdcard/download", 20) != 0) {
+            path[0] = '\0';
+        }
+
+        char range[128] = "", if_range[128] = "", inm[256] = "", ims[64] = "", ae[128] = "", conn[32] = "";
+        find_header(headers, "range", range, sizeof(range));
+        find_header(headers, "if-range", if_range, sizeof(if_range));
+        find_header(headers, "if-none-match", inm, sizeof(inm));
+        find_header(headers, "if-modified-since", ims, sizeof(ims));
+        find_header(headers, "accept-encoding", ae, sizeof(ae));
+        find_header(headers, "connection", conn, sizeof(conn));
+        bool close_after = strcasecmp(conn, "close") == 0;
+
+        file_download_request_t req = {
+            .path = path,
+            .range = range[0] ? range : NULL,
+            .if_range = if_range[0] ? if_range : NULL,
+            .if_none_match = inm[0] ? inm : NULL,
+            .if_modified_since = ims[0] ? ims : NULL,
+            .accept_encoding = ae[0] ? ae : NULL,
+            .head_only = strcmp(method, "HEAD") == 0,
+            .chunk_size = chunk_size,
+            .no_prefetch = no_prefetch,
+        };
+        if (file_download_serve(&req, socket_send, &fd, NULL) != ESP_OK || close_after) goto out;
+
+        memmove(buf, buf + request_len, have - request_len);
+        have -= request_len;
+        buf[have] = '\0';
+    }
+out:
+    close(fd);
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    int port = 8080;
+    int opt;
+    while ((opt = getopt(argc, argv, "p:c:s")) != -1) {
+        switch (opt) {
+            case 'p': port = atoi(optarg); break;
+            case 'c': chunk_size = strtoul(optarg, NULL, 0); break;
+            case 's': no_prefetch = true; break;
+            default:
+                fprintf(stderr, "usage: %s [-p port] [-c chunk_bytes] [-s] <dir>\n", argv[0]);
+                return 1;
+        }
+    }
+    if (optind >= argc) {
+        fprintf(stderr, "usage: %s [-p port] [-c chunk_bytes] [-s] <dir>\n", argv[0]);
+        return 1;
+    }
+    root_dir = argv[optind];
+    signal(SIGPIPE, SIG_IGN);
+
+    int server = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(server, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    struct sockaddr_in addr = {.sin_family = AF_INET, .sin_port = htons(port), .sin_addr.s_addr = htonl(INADDR_LOOPBACK)};
+    if (bind(server, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(server, 16) != 0) {
+        perror("bind");
+        return 1;
+    }
+    fprintf(stderr, "Serving %s as /mnt on http://127.0.0.1:%d\n", root_dir, port);
+
+    for (;;) {
+        int fd = accept(server, NULL, NULL);
+        if (fd < 0) continue;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, connection_thread, (void *)(intptr_t)fd) == 0) {
+            pthread_detach(thread);
+        } else {
+            close(fd);
+        }
+    }
+}
@@ -0,0 +1,207 @@
+// Host test for the web server's per-endpoint timing (core/http_metrics.c).
+//
+//   make -C scripts/host http_metrics_check
+//   scripts/host/http_metrics_check [-t threads] [-n requests_per_thread]
+//
+// Checks that endpoints keep their slot when registered again and that the table fills up cleanly,
+// that the p50/p99 estimates land in the histogram bucket of the true percentile of known samples, and
+// that reset keeps requests still in their handler. Then records from many threads at once, as the
+// server task and the workers do, and checks that every count adds up, requests turned away busy
+// included.
+
+#define _GNU_SOURCE
+#include "core/http_metrics.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static int threads = 8;
+static int requests_per_thread = 20000;
+static int failures;
+
+#define CHECK(cond, ...) do { \
+    if (!(cond)) { \
+        failures++; \
+        printf("  FAIL line %d: ", __LINE__); \
+        printf(__VA_ARGS__); \
+        printf("\n"); \
+    } \
+} while (0)
+
+static int cmp_u32(const void* a, const void* b) {
+    uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+    return x < y ? -1 : x > y;
+}
+
+// True percentile by the same rank rule as the firmware
+static uint32_t exact_percentile(uint32_t* sorted, int n, unsigned pct) {
+    int rank = (n * (int)pct + 99) / 100;
+    return sorted[(rank < 1 ? 1 : rank) - 1];
+}
+
+static void test_slots(void) {
+    printf("slots\n");
+    int state = http_metrics_endpoint("GET", "/api/state", false);
+    int download = http_metrics_endpoint("GET", "/api/sdcard/download", true);
+    int upload = http_metrics_endpoint("POST", "/api/sdcard/download", true);
+    CHECK(state == 0 && download == 1 && upload == 2, "slots %d %d %d", state, download, upload);
+    CHECK(http_metrics_endpoint("GET", "/api/state", false) == state, "same endpoint got a new slot");
+
+    http_metrics_endpoint_t e;
+    CHECK(http_metrics_get(download, &e) && e.async && strcmp(e.method, "GET") == 0, "download slot");
+    CHECK(!http_metrics_get(3, &e), "slot past the last endpoint");
+
+    char uri[HTTP_METRICS_URI_MAX];
+    int last = -1;
+    for (int i = 3; i < HTTP_METRICS_MAX_ENDPOINTS + 2; i++) {
+        snprintf(uri, sizeof(uri), "/api/filler%d", i);
+        last = http_metrics_endpoint("GET", uri, false);
+        if (i < HTTP_METRICS_MAX_ENDPOINTS) {
+            CHECK(last == i, "filler %d got slot %d", i, last);
+        }
+    }
+    CHECK(last == -1, "table over-filled");
+    http_metrics_begin(-1);
+    http_metrics_end(-1, 5, 0, true);
+    http_metrics_rejected(-1);
+}
+
+static void test_percentiles(void) {
+    printf("percentiles\n");
+    static const uint32_t bounds[] = HTTP_METRICS_LATENCY_BOUNDS_MS;
+    enum { N = 5000 };
+    static uint32_t samples[N];
+    unsigned seed = 1;
+
+    // Mostly fast polls, a tail of slow SD reads and a few multi-second downloads
+    for (int i = 0; i < N; i++) {
+        uint32_t us;
+        int r = rand_r(&seed) % 1000;
+        if (r < 900) {
+            us = 300 + rand_r(&seed) % 4000;
+        } else if (r < 995) {
+            us = 20000 + rand_r(&seed) % 200000;
+        } else {
+            us = 3000000 + rand_r(&seed) % 4000000;
+        }
+        samples[i] = us;
+        http_metrics_begin(0);
+        http_metrics_end(0, us, 0, i % 100 != 0);
+    }
+    qsort(samples, N, sizeof(samples[0]), cmp_u32);
+
+    http_metrics_endpoint_t e;
+    http_metrics_get(0, &e);
+    CHECK(e.requests == N && e.errors == N / 100 && e.active == 0, "counts %u %u %u", e.requests, e.errors,
+          e.active);
+    CHECK(e.max_us == samples[N - 1], "max %u, expected %u", e.max_us, samples[N - 1]);
+
+    unsigned pcts[] = {50, 90, 99, 100};
+    for (size_t i = 0; i < sizeof(pcts) / sizeof(pcts[0]); i++) {
+        uint32_t exact_ms = (exact_percentile(samples, N, pcts[i]) + 999) / 1000;
+        uint32_t est = http_metrics_percentile_ms(&e, pcts[i]);
+        // The estimate must fall inside the bucket holding the sample
+        size_t nb = sizeof(bounds) / sizeof(bounds[0]);
+        size_t b = 0;
+        while (b < nb && exact_ms > bounds[b]) {
+            b++;
+        }
+        uint32_t lower = b > 0 ? bounds[b - 1] : 0;
+        uint32_t upper = b < nb ? bounds[b] : (e.max_us + 999) / 1000;
+        CHECK(est >= lower && est <= upper, "p%u estimated %u ms, exact %u ms", pcts[i], est, exact_ms);
+        printf("  p%-3u exact %5u ms  estimated %5u ms\n", pcts[i], exact_ms, est);
+    }
+
+    http_metrics_endpoint_t empty = {0};
+    CHECK(http_metrics_percentile_ms(&empty, 99) == 0, "percentile without requests");
+
+    // A request still running across a reset must not drive the count below zero
+    http_metrics_begin(1);
+    http_metrics_reset();
+    http_metrics_get(0, &e);
+    CHECK(e.requests == 0 && e.max_us == 0 && e.latency_hist[0] == 0, "reset left counts");
+    http_metrics_get(1, &e);
+    CHECK(e.active == 1, "reset dropped an active request");
+    http_metrics_end(1, 1500, 200, true);
+    http_metrics_get(1, &e);
+    CHECK(e.active == 0 && e.requests == 1 && e.wait_max_us == 200, "request ending after reset");
+}
+
+static void* record_main(void* arg) {
+    int slot = (int)(intptr_t)arg % 3;
+    for (int i = 0; i < requests_per_thread; i++) {
+        http_metrics_begin(slot);
+        http_metrics_end(slot, (uint32_t)(i % 7000) * 1000, slot == 1 ? 50 : 0, i % 10 != 0);
+        if (slot == 2 && i % 2) {
+            // Turned away busy: counted apart from the requests that ran
+            http_metrics_begin(slot);
+            http_metrics_rejected(slot);
+        }
+    }
+    return NULL;
+}
+
+static void test_threads(void) {
+    printf("threads: %d x %d requests\n", threads, requests_per_thread);
+    http_metrics_reset();
+    pthread_t* tids = calloc((size_t)threads, sizeof(pthread_t));
+    for (int i = 0; i < threads; i++) {
+        pthread_create(&tids[i], NULL, record_main, (void*)(intptr_t)i);
+    }
+    for (int i = 0; i < threads; i++) {
+        pthread_join(tids[i], NULL);
+    }
+    free(tids);
+
+    uint64_t requests = 0, errors = 0, in_hist = 0, rejected = 0;
+    for (int slot = 0; slot < 3; slot++) {
+        http_metrics_endpoint_t e;
+        http_metrics_get(slot, &e);
+        requests += e.requests;
+        errors += e.errors;
+        rejected += e.rejected_busy;
+        for (int b = 0; b < HTTP_METRICS_LATENCY_BUCKETS; b++) {
+            in_hist += e.latency_hist[b];
+        }
+        CHECK(e.active == 0, "slot %d still has %u active", slot, e.active);
+        CHECK(e.max_active >= 1 && e.max_active <= (uint32_t)threads, "slot %d max_active %u", slot, e.max_active);
+    }
+    uint64_t expected = (uint64_t)threads * requests_per_thread;
+    uint64_t expected_errors = (uint64_t)threads * ((requests_per_thread + 9) / 10);
+    CHECK(requests == expected && in_hist == expected, "requests %llu, in histogram %llu, expected %llu",
+          (unsigned long long)requests, (unsigned long long)in_hist, (unsigned long long)expected);
+    uint64_t expected_rejected = 0;
+    for (int i = 0; i < threads; i++) {
+        expected_rejected += i % 3 == 2 ? (uint64_t)requests_per_thread / 2 : 0;
+    }
+    CHECK(rejected == expected_rejected, "rejected %llu, expected %llu", (unsigned long long)rejected,
+          (unsigned long long)expected_rejected);
+    CHECK(errors == expected_errors, "errors %llu, expected %llu", (unsigned long long)errors,
+          (unsigned long long)expected_errors);
+}
+
+int main(int argc, char** argv) {
+    int opt;
+    while ((opt = getopt(argc, argv, "t:n:")) != -1) {
+        switch (opt) {
+        case 't': threads = atoi(optarg); break;
+        case 'n': requests_per_thread = atoi(optarg); break;
+        default:
+            fprintf(stderr, "usage: %s [-t threads] [-n requests_per_thread]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (threads < 1 || requests_per_thread < 1) {
+        fprintf(stderr, "need at least one thread and one request\n");
+        return 2;
+    }
+
+    test_slots();
+    test_percentiles();
+    test_threads();
+
+    printf("%s\n", failures ? "FAIL" : "ok");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,266 @@
+// Host test for capture crash recovery (managers/capture_journal.c).
+//
+//   make -C scripts/host journal_recover_check
+//   scripts/host/journal_recover_check [-n records] [-d dir]
+//
+// Builds a pcap (in both byte orders) and a CSV capture, cuts each at every byte offset the way a power
+// loss between writes would leave it, and runs capture_recover_pcap() / capture_recover_text() on the
+// cut file with no checkpoint, with the last checkpoint before the cut and with a stale checkpoint past
+// the end. Checks that the file is cut back to the last complete record or line (or removed when there
+// is none), that the kept bytes are the original ones, that the result reports the right action and
+// sizes, and that only the records after the checkpoint were checked.
+
+#define _GNU_SOURCE
+#include "managers/capture_journal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+static int records = 40;
+static const char* dir = "/tmp";
+static char path[512];
+static int failures;
+
+#define CHECK(cond, ...) do { \
+    if (!(cond)) { \
+        failures++; \
+        printf("  FAIL line %d: ", __LINE__); \
+        printf(__VA_ARGS__); \
+        printf("\n"); \
+    } \
+} while (0)
+
+static uint32_t rng_state = 0x2545F491;
+
+static uint32_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+typedef struct {
+    uint8_t* data;
+    size_t len;
+    uint64_t* ends;          // Offset after each complete record or line, ascending
+    int count;
+} capture_t;
+
+static void put_u32(uint8_t* p, uint32_t v, bool swapped) {
+    for (int i = 0; i < 4; i++) {
+        p[swapped ? 3 - i : i] = (uint8_t)(v >> (8 * i));
+    }
+}
+
+// Global header, then records from a few bytes to a full frame; sizes vary so that every cut lands
+// in a header, a frame body or exactly on a boundary somewhere
+static void build_pcap(capture_t* c, bool swapped) {
+    c->data = malloc(24 + (size_t)records * (16 + 1600));
+    c->ends = malloc((size_t)(records + 1) * sizeof(uint64_t));
+    static const uint32_t global[6] = {0xa1b2c3d4, 0x00040002, 0, 0, 4096, 105};
+    for (int i = 0; i < 6; i++) {
+        put_u32(c->data + i * 4, global[i], swapped);
+    }
+    // The version halves swap as 16-bit fields
+    if (swapped) {
+        uint8_t version[4] = {0, 2, 0, 4};
+        memcpy(c->data + 4, version, 4);
+    }
+    c->len = 24;
+    c->count = 0;
+    for (int i = 0; i < records; i++) {
+        uint32_t len = i % 5 == 0 ? 1 + rng() % 16 : 24 + rng() % 1500;
+        uint8_t* rec = c->data + c->len;
+        put_u32(rec, 1700000000 + i, swapped);
+        put_u32(rec + 4, rng() % 1000000, swapped);
+        put_u32(rec + 8, len, swapped);
+        put_u32(rec + 12, len + (i % 3 == 0 ? rng() % 100 : 0), swapped);
+        for (uint32_t j = 0; j < len; j++) {
+            rec[16 + j] = (uint8_t)rng();
+        }
+        c->len += 16 + len;
+        c->ends[c->count++] = c->len;
+    }
+}
+
+// GPS CSV: a header line, then rows of varying length
+static void build_text(capture_t* c) {
+    c->data = malloc(128 + (size_t)records * 128);
+    c->ends = malloc((size_t)(records + 1) * sizeof(uint64_t));
+    c->len = (size_t)sprintf((char*)c->data, "MAC,SSID,AuthMode,FirstSeen,Channel,RSSI,Lat,Lon,Alt,Acc,Type\n");
+    c->count = 0;
+    c->ends[c->count++] = c->len;
+    for (int i = 1; i < records; i++) {
+        uint32_t r = rng();
+        c->len += (size_t)sprintf((char*)c->data + c->len,
+                                  "%02x:%02x:%02x:%02x:%02x:%02x,net-%u,[WPA2_PSK],2024-05-01 12:%02d:%02d,%u,-%u,"
+                                  "52.%06u,4.%06u,%u,%u,WIFI\n",
+                                  r & 0xFF, (r >> 8) & 0xFF, (r >> 16) & 0xFF, r >> 24, i & 0xFF, (i >> 8) & 0xFF,
+                                  rng() % (i * 100 + 1), i % 60, (i * 7) % 60, 1 + rng() % 13, 30 + rng() % 60,
+                                  rng() % 1000000, rng() % 1000000, rng() % 100, rng() % 50);
+        c->ends[c->count++] = c->len;
+    }
+}
+
+static void write_cut(const capture_t* c, size_t cut) {
+    FILE* f = fopen(path, "wb");
+    if (f == NULL || fwrite(c->data, 1, cut, f) != cut || fclose(f) != 0) {
+        perror(path);
+        exit(1);
+    }
+}
+
+static bool file_matches(const capture_t* c, uint64_t len) {
+    struct stat st;
+    if (stat(path, &st) != 0 || (uint64_t)st.st_size != len) {
+        return false;
+    }
+    uint8_t* buf = malloc(len + 1);
+    FILE* f = fopen(path, "rb");
+    bool ok = f != NULL && fread(buf, 1, len, f) == len && memcmp(buf, c->data, len) == 0;
+    if (f != NULL) {
+        fclose(f);
+    }
+    free(buf);
+    return ok;
+}
+
+// Last complete record or line end at or before cut, and how many come before it
+static uint64_t last_end(const capture_t* c, uint64_t cut, uint64_t base, int* index) {
+    uint64_t end = base;
+    *index = -1;
+    for (int i = 0; i < c->count && c->ends[i] <= cut; i++) {
+        end = c->ends[i];
+        *index = i;
+    }
+    return end;
+}
+
+static void check_cuts(const char* name, const capture_t* c, bool pcap) {
+    uint64_t base = pcap ? 24 : 0;
+    int bad = 0;
+    size_t first_bad = 0;
+    const char* what = "";
+    int runs = 0;
+
+    for (size_t cut = 0; cut <= c->len; cut++) {
+        int index;
+        uint64_t expect = last_end(c, cut, base, &index);
+        // No checkpoint, the last one the journal could hold for this cut, and one past the end
+        uint64_t checkpoints[3] = {0, index > 0 ? c->ends[index - 1] : base, c->len + 4096};
+        for (int k = 0; k < 3; k++) {
+            write_cut(c, cut);
+            capture_recovery_result_t r = pcap ? capture_recover_pcap(path, checkpoints[k])
+                                               : capture_recover_text(path, checkpoints[k]);
+            runs++;
+
+            capture_recovery_action_t action;
+            const char* fail = NULL;
+            if (pcap && cut < 24) {
+                action = CAPTURE_RECOVERY_REMOVED;
+            } else if (!pcap && expect == 0) {
+                action = CAPTURE_RECOVERY_REMOVED;
+            } else {
+                action = expect == cut ? CAPTURE_RECOVERY_INTACT : CAPTURE_RECOVERY_TRUNCATED;
+            }
+            // Records checked run from the checkpoint, or from the start when it is not usable
+            uint64_t from = checkpoints[k] <= cut && checkpoints[k] >= base ? checkpoints[k] : base;
+            uint32_t checked = 0;
+            for (int i = 0; i <= index; i++) {
+                checked += c->ends[i] > from;
+            }
+
+            if (r.action != action) {
+                fail = "action";
+            } else if (action == CAPTURE_RECOVERY_REMOVED) {
+                if (access(path, F_OK) == 0) fail = "file not removed";
+            } else if (r.original_size != cut || r.recovered_size != expect) {
+                fail = "sizes";
+            } else if (!file_matches(c, expect)) {
+                fail = "content";
+            } else if (r.records_checked != checked) {
+                fail = "records checked";
+            }
+            if (fail != NULL) {
+                if (bad++ == 0) {
+                    first_bad = cut;
+                    what = fail;
+                    printf("  %s cut at %zu, checkpoint %llu: %s %s (%llu -> %llu, %u checked), expected %s to "
+                           "%llu, %u checked\n", name, cut, (unsigned long long)checkpoints[k], fail,
+                           capture_recovery_action_str(r.action), (unsigned long long)r.original_size,
+                           (unsigned long long)r.recovered_size, r.records_checked,
+                           capture_recovery_action_str(action), (unsigned long long)expect, checked);
+                }
+            }
+            unlink(path);
+        }
+    }
+    CHECK(bad == 0, "%s: %d of %d recoveries wrong, first at offset %zu (%s)", name, bad, runs, first_bad, what);
+    printf("  %-12s %6zu bytes, %3d %s, %6d recoveries\n", name, c->len, c->count, pcap ? "records" : "lines",
+           runs);
+}
+
+static void test_missing(void) {
+    capture_recovery_result_t r = capture_recover_pcap(path, 0);
+    CHECK(r.action == CAPTURE_RECOVERY_MISSING, "pcap: missing file reported %s",
+          capture_recovery_action_str(r.action));
+    r = capture_recover_text(path, 0);
+    CHECK(r.action == CAPTURE_RECOVERY_MISSING, "text: missing file reported %s",
+          capture_recovery_action_str(r.action));
+}
+
+// A file that isn't a pcap is left as it is
+static void test_foreign(void) {
+    capture_t c;
+    build_text(&c);
+    write_cut(&c, c.len);
+    capture_recovery_result_t r = capture_recover_pcap(path, 0);
+    CHECK(r.action == CAPTURE_RECOVERY_ERROR && file_matches(&c, c.len), "foreign file: %s",
+          capture_recovery_action_str(r.action));
+    unlink(path);
+    free(c.data);
+    free(c.ends);
+}
+
+int main(int argc, char** argv) {
+    int opt;
+    while ((opt = getopt(argc, argv, "n:d:")) != -1) {
+        switch (opt) {
+        case 'n': records = atoi(optarg); break;
+        case 'd': dir = optarg; break;
+        default:
+            fprintf(stderr, "usage: %s [-n records] [-d dir]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (records < 2) {
+        fprintf(stderr, "need at least 2 records\n");
+        return 2;
+    }
+    snprintf(path, sizeof(path), "%s/journal_recover_check_%d", dir, (int)getpid());
+
+    printf("every cut, recovered with no, the last and a stale checkpoint\n");
+    capture_t c;
+    build_pcap(&c, false);
+    check_cuts("pcap", &c, true);
+    free(c.data);
+    free(c.ends);
+
+    build_pcap(&c, true);
+    check_cuts("pcap swapped", &c, true);
+    free(c.data);
+    free(c.ends);
+
+    build_text(&c);
+    check_cuts("csv", &c, false);
+    free(c.data);
+    free(c.ends);
+
+    test_missing();
+    test_foreign();
+
+    printf(failures ? "FAILED (%d)\n" : "OK\n", failures);
+    return failures ? 1 : 0;
+}
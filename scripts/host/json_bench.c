@@ -0,0 +1,487 @@
+// Host benchmark: streaming JSON writer (core/json_writer.c) against cJSON trees.
+//
+//   make -C scripts/host json_bench [CJSON_DIR=$IDF_PATH/components/json/cJSON]
+//   scripts/host/json_bench [-n iterations] [-o file]
+//
+// Builds the same documents the web API serves (settings, watchlist alerts, a directory page and SD
+// benchmark results) both ways. The cJSON side builds the tree, prints it unformatted and hands the
+// string to the sink in one go, as the handlers used to; the writer side formats into a 512-byte buffer
+// flushed to the sink. Reported per document: heap peak and allocations (counted through cJSON's hooks;
+// the writer allocates nothing), bytes produced and time per response. Both outputs must be identical.
+// -o also writes every writer document to a file through json_writer_file_sink.
+
+#include "core/json_writer.h"
+#include "cJSON.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define CHUNK_SIZE 512
+
+static size_t heap_live;
+static size_t heap_peak;
+static size_t heap_allocs;
+
+static void* counting_malloc(size_t size) {
+    size_t* p = malloc(size + sizeof(size_t));
+    if (p == NULL) {
+        return NULL;
+    }
+    *p = size;
+    heap_live += size;
+    heap_allocs++;
+    if (heap_live > heap_peak) {
+        heap_peak = heap_live;
+    }
+    return p + 1;
+}
+
+static void counting_free(void* ptr) {
+    if (ptr != NULL) {
+        size_t* p = (size_t*)ptr - 1;
+        heap_live -= *p;
+        free(p);
+    }
+}
+
+typedef struct {
+    size_t bytes;
+    size_t chunks;
+    char* copy;                  // Output kept for the comparison, when set up
+    size_t copy_len;
+    size_t copy_cap;
+} sink_t;
+
+static esp_err_t counting_sink(void* ctx, const char* data, size_t len) {
+    sink_t* s = ctx;
+    s->bytes += len;
+    s->chunks++;
+    if (s->copy_cap > 0) {
+        if (s->copy_len + len + 1 > s->copy_cap) {
+            s->copy_cap = (s->copy_len + len + 1) * 2;
+            s->copy = realloc(s->copy, s->copy_cap);
+        }
+        memcpy(s->copy + s->copy_len, data, len);
+        s->copy_len += len;
+        s->copy[s->copy_len] = '\0';
+    }
+    return ESP_OK;
+}
+
+static uint32_t rng_state = 1;
+
+static uint32_t rng(void) {
+    rng_state = rng_state * 1103515245u + 12345u;
+    return rng_state >> 8;
+}
+
+// ---- settings ----
+
+static cJSON* settings_cjson(void) {
+    cJSON* root = cJSON_CreateObject();
+    cJSON_AddNumberToObject(root, "broadcast_speed", 100);
+    cJSON_AddStringToObject(root, "ap_ssid", "GhostNet");
+    cJSON_AddStringToObject(root, "ap_password", "GhostNet");
+    cJSON_AddNumberToObject(root, "rgb_mode", 1);
+    cJSON_AddNumberToObject(root, "rgb_speed", 15);
+    cJSON_AddNumberToObject(root, "channel_delay", 1.5);
+    cJSON_AddStringToObject(root, "portal_url", "/mnt/ghostesp/evil_portal/portals/default.html");
+    cJSON_AddStringToObject(root, "portal_ssid", "Free \"Airport\" WiFi");
+    cJSON_AddStringToObject(root, "portal_password", "");
+    cJSON_AddStringToObject(root, "portal_ap_ssid", "Airport_Guest");
+    cJSON_AddStringToObject(root, "portal_domain", "login.airport.example");
+    cJSON_AddBoolToObject(root, "portal_offline_mode", 1);
+    cJSON_AddStringToObject(root, "printer_ip", "192.168.1.50");
+    cJSON_AddStringToObject(root, "printer_text", "Line one\nLine two\twith a tab");
+    cJSON_AddNumberToObject(root, "printer_font_size", 12);
+    cJSON_AddNumberToObject(root, "printer_alignment", 2);
+    cJSON_AddStringToObject(root, "hex_accent_color", "#ff6f00");
+    cJSON_AddStringToObject(root, "timezone_str", "EST5EDT,M3.2.0,M11.1.0");
+    cJSON_AddNumberToObject(root, "gps_rx_pin", 16);
+    cJSON_AddStringToObject(root, "station_ip", "192.168.1.23");
+    return root;
+}
+
+static void settings_writer(json_writer_t* w) {
+    json_writer_object(w, NULL);
+    json_writer_int(w, "broadcast_speed", 100);
+    json_writer_string(w, "ap_ssid", "GhostNet");
+    json_writer_string(w, "ap_password", "GhostNet");
+    json_writer_int(w, "rgb_mode", 1);
+    json_writer_int(w, "rgb_speed", 15);
+    json_writer_double(w, "channel_delay", 1.5);
+    json_writer_string(w, "portal_url", "/mnt/ghostesp/evil_portal/portals/default.html");
+    json_writer_string(w, "portal_ssid", "Free \"Airport\" WiFi");
+    json_writer_string(w, "portal_password", "");
+    json_writer_string(w, "portal_ap_ssid", "Airport_Guest");
+    json_writer_string(w, "portal_domain", "login.airport.example");
+    json_writer_bool(w, "portal_offline_mode", true);
+    json_writer_string(w, "printer_ip", "192.168.1.50");
+    json_writer_string(w, "printer_text", "Line one\nLine two\twith a tab");
+    json_writer_int(w, "printer_font_size", 12);
+    json_writer_int(w, "printer_alignment", 2);
+    json_writer_string(w, "hex_accent_color", "#ff6f00");
+    json_writer_string(w, "timezone_str", "EST5EDT,M3.2.0,M11.1.0");
+    json_writer_int(w, "gps_rx_pin", 16);
+    json_writer_string(w, "station_ip", "192.168.1.23");
+    json_writer_end(w);
+}
+
+// ---- watchlist alerts ----
+
+#define ALERTS 64
+
+typedef struct {
+    uint32_t seq, uptime;
+    int type;
+    char mac[18];
+    char ssid[33];
+    int rssi;
+    int channel;
+} alert_t;
+
+static alert_t alerts[ALERTS];
+
+static void make_alerts(void) {
+    static const char* types[] = {"mac", "oui", "ssid"};
+    for (int i = 0; i < ALERTS; i++) {
+        alert_t* a = &alerts[i];
+        a->seq = 1000 + (uint32_t)i;
+        a->uptime = 3600 + rng() % 100000;
+        a->type = (int)(rng() % 3);
+        snprintf(a->mac, sizeof(a->mac), "%02X:%02X:%02X:%02X:%02X:%02X", rng() & 255, rng() & 255, rng() & 255,
+                 rng() & 255, rng() & 255, rng() & 255);
+        snprintf(a->ssid, sizeof(a->ssid), "Net-%u %s", rng() % 10000, types[a->type]);
+        a->rssi = -30 - (int)(rng() % 60);
+        a->channel = 1 + (int)(rng() % 13);
+    }
+}
+
+static const char* alert_type(int type) {
+    return type == 0 ? "mac" : type == 1 ? "oui" : "ssid";
+}
+
+static cJSON* alerts_cjson(void) {
+    cJSON* root = cJSON_CreateObject();
+    cJSON_AddBoolToObject(root, "loaded", 1);
+    cJSON_AddNumberToObject(root, "macs", 120);
+    cJSON_AddNumberToObject(root, "ouis", 14);
+    cJSON_AddNumberToObject(root, "ssids", 9);
+    cJSON_AddNumberToObject(root, "confirmed_hits", 311);
+    cJSON* events = cJSON_AddArrayToObject(root, "events");
+    for (int i = 0; i < ALERTS; i++) {
+        const alert_t* a = &alerts[i];
+        cJSON* item = cJSON_CreateObject();
+        cJSON_AddNumberToObject(item, "seq", a->seq);
+        cJSON_AddNumberToObject(item, "uptime", a->uptime);
+        cJSON_AddStringToObject(item, "type", alert_type(a->type));
+        cJSON_AddStringToObject(item, "mac", a->mac);
+        if (a->type == 2) {
+            cJSON_AddStringToObject(item, "ssid", a->ssid);
+        }
+        cJSON_AddNumberToObject(item, "rssi", a->rssi);
+        cJSON_AddNumberToObject(item, "channel", a->channel);
+        cJSON_AddItemToArray(events, item);
+    }
+    return root;
+}
+
+static void alerts_writer(json_writer_t* w) {
+    json_writer_object(w, NULL);
+    json_writer_bool(w, "loaded", true);
+    json_writer_uint(w, "macs", 120);
+    json_writer_uint(w, "ouis", 14);
+    json_writer_uint(w, "ssids", 9);
+    json_writer_uint(w, "confirmed_hits", 311);
+    json_writer_array(w, "events");
+    for (int i = 0; i < ALERTS; i++) {
+        const alert_t* a = &alerts[i];
+        json_writer_object(w, NULL);
+        json_writer_uint(w, "seq", a->seq);
+        json_writer_uint(w, "uptime", a->uptime);
+        json_writer_string(w, "type", alert_type(a->type));
+        json_writer_string(w, "mac", a->mac);
+        if (a->type == 2) {
+            json_writer_string(w, "ssid", a->ssid);
+        }
+        json_writer_int(w, "rssi", a->rssi);
+        json_writer_uint(w, "channel", (uint64_t)a->channel);
+        json_writer_end(w);
+    }
+    json_writer_end(w);
+    json_writer_end(w);
+}
+
+// ---- directory page ----
+
+#define FILES 200
+
+typedef struct {
+    char name[40];
+    char path[64];
+    uint32_t size, mtime, records;
+} file_t;
+
+static file_t files[FILES];
+
+static void make_files(void) {
+    for (int i = 0; i < FILES; i++) {
+        file_t* f = &files[i];
+        snprintf(f->name, sizeof(f->name), "rawscan_%04d_%u.pcap", i, rng() % 100000);
+        snprintf(f->path, sizeof(f->path), "/mnt/ghostesp/pcaps/%.39s", f->name);
+        f->size = rng() % 50000000;
+        f->mtime = 1700000000 + rng() % 30000000;
+        f->records = rng() % 200000;
+    }
+}
+
+static cJSON* files_cjson(void) {
+    cJSON* root = cJSON_CreateObject();
+    cJSON_AddStringToObject(root, "path", "/mnt/ghostesp/pcaps");
+    cJSON* entries = cJSON_AddArrayToObject(root, "entries");
+    for (int i = 0; i < FILES; i++) {
+        const file_t* f = &files[i];
+        cJSON* item = cJSON_CreateObject();
+        cJSON_AddStringToObject(item, "name", f->name);
+        cJSON_AddStringToObject(item, "path", f->path);
+        cJSON_AddStringToObject(item, "type", "file");
+        cJSON_AddNumberToObject(item, "size", f->size);
+        cJSON_AddNumberToObject(item, "mtime", f->mtime);
+        cJSON_AddStringToObject(item, "kind", "rawscan");
+        cJSON_AddNumberToObject(item, "records", f->records);
+        cJSON_AddItemToArray(entries, item);
+    }
+    cJSON_AddNumberToObject(root, "offset", 0);
+    cJSON_AddNumberToObject(root, "limit", FILES);
+    cJSON_AddNumberToObject(root, "total", 5000);
+    cJSON_AddNullToObject(root, "next");
+    return root;
+}
+
+static void files_writer(json_writer_t* w) {
+    json_writer_object(w, NULL);
+    json_writer_string(w, "path", "/mnt/ghostesp/pcaps");
+    json_writer_array(w, "entries");
+    for (int i = 0; i < FILES; i++) {
+        const file_t* f = &files[i];
+        json_writer_object(w, NULL);
+        json_writer_string(w, "name", f->name);
+        json_writer_string(w, "path", f->path);
+        json_writer_string(w, "type", "file");
+        json_writer_uint(w, "size", f->size);
+        json_writer_uint(w, "mtime", f->mtime);
+        json_writer_string(w, "kind", "rawscan");
+        json_writer_uint(w, "records", f->records);
+        json_writer_end(w);
+    }
+    json_writer_end(w);
+    json_writer_uint(w, "offset", 0);
+    json_writer_uint(w, "limit", FILES);
+    json_writer_uint(w, "total", 5000);
+    json_writer_null(w, "next");
+    json_writer_end(w);
+}
+
+// ---- SD benchmark results ----
+
+static const uint32_t bounds[] = {1, 2, 5, 10, 20, 50, 100, 200, 500};
+static uint32_t hist[4][10];
+
+static void make_hist(void) {
+    for (int c = 0; c < 4; c++) {
+        for (int i = 0; i < 10; i++) {
+            hist[c][i] = rng() % 5000;
+        }
+    }
+}
+
+static void hist_cjson(cJSON* obj, const uint32_t* h) {
+    cJSON* b = cJSON_AddArrayToObject(obj, "latency_ms");
+    for (size_t i = 0; i < sizeof(bounds) / sizeof(bounds[0]); i++) {
+        cJSON_AddItemToArray(b, cJSON_CreateNumber(bounds[i]));
+    }
+    cJSON* l = cJSON_AddArrayToObject(obj, "latency_hist");
+    for (int i = 0; i < 10; i++) {
+        cJSON_AddItemToArray(l, cJSON_CreateNumber(h[i]));
+    }
+}
+
+static void hist_writer(json_writer_t* w, const uint32_t* h) {
+    json_writer_array(w, "latency_ms");
+    for (size_t i = 0; i < sizeof(bounds) / sizeof(bounds[0]); i++) {
+        json_writer_uint(w, NULL, bounds[i]);
+    }
+    json_writer_end(w);
+    json_writer_array(w, "latency_hist");
+    for (int i = 0; i < 10; i++) {
+        json_writer_uint(w, NULL, h[i]);
+    }
+    json_writer_end(w);
+}
+
+static cJSON* bench_cjson(void) {
+    cJSON* root = cJSON_CreateObject();
+    cJSON_AddStringToObject(root, "state", "done");
+    cJSON* seq = cJSON_AddArrayToObject(root, "sequential");
+    for (int i = 0; i < 5; i++) {
+        cJSON* item = cJSON_CreateObject();
+        cJSON_AddNumberToObject(item, "block", 512 << (2 * i));
+        cJSON_AddNumberToObject(item, "write_kbps", 400 + 300 * i);
+        cJSON_AddNumberToObject(item, "read_kbps", 900 + 400 * i);
+        cJSON_AddNumberToObject(item, "write_us_max", 20000 + 1000 * i);
+        cJSON_AddItemToArray(seq, item);
+    }
+    cJSON* capture = cJSON_AddArrayToObject(root, "capture");
+    for (int c = 0; c < 4; c++) {
+        cJSON* item = cJSON_CreateObject();
+        cJSON_AddNumberToObject(item, "prealloc_bytes", c * 1048576);
+        cJSON_AddNumberToObject(item, "kbps", 700 + c * 50);
+        hist_cjson(item, hist[c]);
+        cJSON_AddItemToArray(capture, item);
+    }
+    cJSON_AddNumberToObject(root, "duration_ms", 48211);
+    return root;
+}
+
+static void bench_writer(json_writer_t* w) {
+    json_writer_object(w, NULL);
+    json_writer_string(w, "state", "done");
+    json_writer_array(w, "sequential");
+    for (int i = 0; i < 5; i++) {
+        json_writer_object(w, NULL);
+        json_writer_uint(w, "block", 512u << (2 * i));
+        json_writer_uint(w, "write_kbps", 400 + 300 * i);
+        json_writer_uint(w, "read_kbps", 900 + 400 * i);
+        json_writer_uint(w, "write_us_max", 20000 + 1000 * i);
+        json_writer_end(w);
+    }
+    json_writer_end(w);
+    json_writer_array(w, "capture");
+    for (int c = 0; c < 4; c++) {
+        json_writer_object(w, NULL);
+        json_writer_uint(w, "prealloc_bytes", (uint64_t)c * 1048576);
+        json_writer_uint(w, "kbps", 700 + c * 50);
+        hist_writer(w, hist[c]);
+        json_writer_end(w);
+    }
+    json_writer_end(w);
+    json_writer_uint(w, "duration_ms", 48211);
+    json_writer_end(w);
+}
+
+// ---- driver ----
+
+typedef struct {
+    const char* name;
+    cJSON* (*build)(void);
+    void (*write)(json_writer_t* w);
+} doc_t;
+
+static const doc_t docs[] = {
+    {"settings", settings_cjson, settings_writer},
+    {"watchlist", alerts_cjson, alerts_writer},
+    {"listing", files_cjson, files_writer},
+    {"sdbench", bench_cjson, bench_writer},
+};
+
+static double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void run_cjson(const doc_t* d, sink_t* sink) {
+    cJSON* root = d->build();
+    char* text = cJSON_PrintUnformatted(root);
+    counting_sink(sink, text, strlen(text));
+    cJSON_Delete(root);
+    counting_free(text);
+}
+
+static esp_err_t run_writer(const doc_t* d, json_writer_sink_fn fn, void* ctx) {
+    char chunk[CHUNK_SIZE];
+    json_writer_t w;
+    json_writer_init(&w, chunk, sizeof(chunk), fn, ctx);
+    d->write(&w);
+    return json_writer_finish(&w);
+}
+
+int main(int argc, char** argv) {
+    int iterations = 2000;
+    const char* out_path = NULL;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:o:")) != -1) {
+        switch (opt) {
+            case 'n': iterations = atoi(optarg); break;
+            case 'o': out_path = optarg; break;
+            default:
+                fprintf(stderr, "usage: %s [-n iterations] [-o file]\n", argv[0]);
+                return 2;
+        }
+    }
+    if (iterations < 1) {
+        iterations = 1;
+    }
+
+    cJSON_Hooks hooks = { counting_malloc, counting_free };
+    cJSON_InitHooks(&hooks);
+    make_alerts();
+    make_files();
+    make_hist();
+
+    FILE* out = out_path ? fopen(out_path, "w") : NULL;
+    if (out_path && out == NULL) {
+        perror(out_path);
+        return 1;
+    }
+
+    int failures = 0;
+    printf("%-10s %7s | %-34s | %-30s\n", "", "bytes", "cJSON tree + print", "json_writer, 512 B buffer");
+    printf("%-10s %7s | %9s %7s %7s %8s | %9s %7s %10s\n", "document", "", "heap peak", "allocs", "us/resp",
+           "", "heap peak", "chunks", "us/resp");
+    for (size_t i = 0; i < sizeof(docs) / sizeof(docs[0]); i++) {
+        const doc_t* d = &docs[i];
+
+        sink_t check_c = { .copy_cap = 1 };
+        sink_t check_w = { .copy_cap = 1 };
+        heap_live = heap_peak = heap_allocs = 0;
+        run_cjson(d, &check_c);
+        size_t peak = heap_peak;
+        size_t allocs = heap_allocs;
+        run_writer(d, counting_sink, &check_w);
+        if (check_c.copy_len != check_w.copy_len || memcmp(check_c.copy, check_w.copy, check_c.copy_len) != 0) {
+            fprintf(stderr, "%s: outputs differ\n  cJSON:  %.200s\n  writer: %.200s\n", d->name, check_c.copy,
+                    check_w.copy);
+            failures++;
+        }
+        if (out != NULL) {
+            run_writer(d, json_writer_file_sink, out);
+            fputc('\n', out);
+        }
+
+        sink_t sink = {0};
+        double start = now_us();
+        for (int n = 0; n < iterations; n++) {
+            run_cjson(d, &sink);
+        }
+        double cjson_us = (now_us() - start) / iterations;
+
+        start = now_us();
+        for (int n = 0; n < iterations; n++) {
+            run_writer(d, counting_sink, &sink);
+        }
+        double writer_us = (now_us() - start) / iterations;
+
+        printf("%-10s %7zu | %9zu %7zu %7.2f %8s | %9d %7zu %10.2f\n", d->name, check_w.copy_len, peak, allocs,
+               cjson_us, "", 0, check_w.chunks, writer_us);
+        free(check_c.copy);
+        free(check_w.copy);
+    }
+    if (out != NULL) {
+        fclose(out);
+    }
+    printf("%s\n", failures ? "FAIL" : "ok, identical output");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,509 @@
+// Host check for the /api/state tables (core/live_state.c) and the CBOR encoder (core/cbor_writer.c).
+//
+//   make -C scripts/host live_state_check
+//   scripts/host/live_state_check [-n updates] [-p poll_us] [-o json_file]
+//
+// One thread plays the radio: scans that add, drop and change APs (more than the table holds), a station
+// sniffer with more MACs than the table holds, GPS fixes. Another plays a browser polling with
+// since=<last version>, decoding the CBOR replies and applying removals and changes to its own copy. When the radio stops, one
+// last delta poll must leave that copy equal to a fresh full query. Then the cost of a query is timed for
+// full tables and for a few changed rows, in both encodings. -o writes a full and a delta JSON reply, one
+// per line, for checking with a JSON parser.
+
+#include "core/live_state.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define MIRROR_ROWS 256
+#define TEXT_MAX 256
+
+static int updates = 200000;
+static int poll_us = 300;
+static atomic_bool radio_done;
+static int failures;
+
+typedef struct {
+    char* data;
+    size_t len;
+    size_t cap;
+} reply_t;
+
+static esp_err_t reply_sink(void* ctx, const char* data, size_t len) {
+    reply_t* r = ctx;
+    if (r->len + len > r->cap) {
+        r->cap = (r->len + len) * 2;
+        r->data = realloc(r->data, r->cap);
+    }
+    memcpy(r->data + r->len, data, len);
+    r->len += len;
+    return ESP_OK;
+}
+
+static esp_err_t null_sink(void* ctx, const char* data, size_t len) {
+    *(size_t*)ctx += len;
+    return ESP_OK;
+}
+
+// ---- minimal CBOR reader for what live_state writes ----
+
+typedef struct {
+    const uint8_t* p;
+    const uint8_t* end;
+    bool bad;
+} cursor_t;
+
+static bool read_head(cursor_t* c, int* major, uint64_t* value, bool* indefinite) {
+    if (c->p >= c->end) {
+        c->bad = true;
+        return false;
+    }
+    uint8_t b = *c->p++;
+    *major = b >> 5;
+    int info = b & 31;
+    *indefinite = info == 31;
+    *value = info;
+    if (info >= 24 && info <= 27) {
+        int n = 1 << (info - 24);
+        if (c->end - c->p < n) {
+            c->bad = true;
+            return false;
+        }
+        *value = 0;
+        for (int i = 0; i < n; i++) {
+            *value = *value << 8 | *c->p++;
+        }
+    } else if (info > 27 && info != 31) {
+        c->bad = true;
+        return false;
+    }
+    return true;
+}
+
+static bool at_break(cursor_t* c) {
+    if (c->p < c->end && *c->p == 0xff) {
+        c->p++;
+        return true;
+    }
+    return false;
+}
+
+// Render one item as text; keys in skip are left out of maps (fields that change without a version)
+static void item_text(cursor_t* c, char* out, size_t cap, const char* const* skip);
+
+static void append(char* out, size_t cap, const char* s) {
+    size_t len = strlen(out);
+    snprintf(out + len, cap - len, "%s", s);
+}
+
+static void item_text(cursor_t* c, char* out, size_t cap, const char* const* skip) {
+    int major;
+    uint64_t value;
+    bool indefinite;
+    char tmp[TEXT_MAX];
+    if (!read_head(c, &major, &value, &indefinite)) {
+        return;
+    }
+    switch (major) {
+        case 0: snprintf(tmp, sizeof(tmp), "%llu", (unsigned long long)value); append(out, cap, tmp); break;
+        case 1: snprintf(tmp, sizeof(tmp), "-%llu", (unsigned long long)value + 1); append(out, cap, tmp); break;
+        case 2:
+        case 3:
+            if ((uint64_t)(c->end - c->p) < value || indefinite) {
+                c->bad = true;
+                return;
+            }
+            for (uint64_t i = 0; i < value; i++) {
+                snprintf(tmp, sizeof(tmp), major == 2 ? "%02x" : "%c", c->p[i]);
+                append(out, cap, tmp);
+            }
+            c->p += value;
+            break;
+        case 4:
+        case 5:
+            if (!indefinite) {
+                c->bad = true;
+                return;
+            }
+            append(out, cap, major == 4 ? "[" : "{");
+            while (!c->bad && !at_break(c)) {
+                if (major == 4) {
+                    item_text(c, out, cap, skip);
+                    append(out, cap, ",");
+                    continue;
+                }
+                char key[64] = "";
+                item_text(c, key, sizeof(key), skip);
+                bool skipped = false;
+                for (const char* const* s = skip; s && *s; s++) {
+                    skipped |= strcmp(*s, key) == 0;
+                }
+                char val[TEXT_MAX] = "";
+                item_text(c, val, sizeof(val), skip);
+                if (!skipped) {
+                    snprintf(tmp, sizeof(tmp), "%s=%s,", key, val);
+                    append(out, cap, tmp);
+                }
+            }
+            append(out, cap, major == 4 ? "]" : "}");
+            break;
+        case 7:
+            if (value == 20 || value == 21) {
+                append(out, cap, value == 21 ? "true" : "false");
+            } else if (value == 22) {
+                append(out, cap, "null");
+            } else if (value <= UINT32_MAX) {
+                float f;
+                uint32_t bits = (uint32_t)value;
+                memcpy(&f, &bits, sizeof(f));
+                snprintf(tmp, sizeof(tmp), "%.9g", (double)f);
+                append(out, cap, tmp);
+            } else {
+                double d;
+                memcpy(&d, &value, sizeof(d));
+                snprintf(tmp, sizeof(tmp), "%.17g", d);
+                append(out, cap, tmp);
+            }
+            break;
+        default: c->bad = true;
+    }
+}
+
+// ---- the client's copy ----
+
+typedef struct {
+    bool used;
+    char key[16];                // Hex MAC
+    char text[TEXT_MAX];
+} mirror_row_t;
+
+typedef struct {
+    uint32_t boot;
+    uint32_t version;
+    mirror_row_t aps[MIRROR_ROWS];
+    mirror_row_t stations[MIRROR_ROWS];
+    char capture[TEXT_MAX];
+    char gps[TEXT_MAX];
+    unsigned resets;
+    unsigned polls;
+    size_t bytes;
+} mirror_t;
+
+static const char* const station_skip[] = {"frames", "age_ms", NULL};
+
+static mirror_row_t* find_row(mirror_row_t* rows, const char* key, bool create) {
+    mirror_row_t* free_row = NULL;
+    for (int i = 0; i < MIRROR_ROWS; i++) {
+        if (rows[i].used && strcmp(rows[i].key, key) == 0) {
+            return &rows[i];
+        }
+        if (!rows[i].used && free_row == NULL) {
+            free_row = &rows[i];
+        }
+    }
+    if (create && free_row != NULL) {
+        free_row->used = true;
+        snprintf(free_row->key, sizeof(free_row->key), "%s", key);
+        return free_row;
+    }
+    return NULL;
+}
+
+static uint64_t read_uint(cursor_t* c) {
+    int major;
+    uint64_t value;
+    bool indefinite;
+    read_head(c, &major, &value, &indefinite);
+    if (major != 0 && major != 7) {
+        c->bad = true;
+    }
+    return major == 7 ? value == 21 : value;
+}
+
+static void read_key(cursor_t* c, char* key, size_t cap) {
+    key[0] = '\0';
+    item_text(c, key, cap, NULL);
+}
+
+// "removed" then "changed", in that order, as live_state writes them
+static void apply_table(cursor_t* c, mirror_row_t* rows, const char* key_field, const char* const* skip) {
+    int major;
+    uint64_t value;
+    bool indefinite;
+    read_head(c, &major, &value, &indefinite);
+    while (!c->bad && !at_break(c)) {
+        char name[32];
+        read_key(c, name, sizeof(name));
+        read_head(c, &major, &value, &indefinite);
+        while (!c->bad && !at_break(c)) {
+            if (strcmp(name, "removed") == 0) {
+                char key[16] = "";
+                item_text(c, key, sizeof(key), NULL);
+                mirror_row_t* row = find_row(rows, key, false);
+                if (row != NULL) {
+                    row->used = false;
+                }
+                continue;
+            }
+            // Render the row, then pick its key out of the rendering
+            char text[TEXT_MAX] = "";
+            item_text(c, text, sizeof(text), skip);
+            char pattern[32];
+            snprintf(pattern, sizeof(pattern), "{%s=", key_field);
+            char key[16] = "";
+            if (strncmp(text, pattern, strlen(pattern)) == 0) {
+                snprintf(key, sizeof(key), "%.12s", text + strlen(pattern));
+            }
+            mirror_row_t* row = find_row(rows, key, true);
+            if (row == NULL) {
+                fprintf(stderr, "client copy full\n");
+                failures++;
+                return;
+            }
+            snprintf(row->text, sizeof(row->text), "%s", text);
+        }
+    }
+}
+
+static void apply_reply(mirror_t* m, const reply_t* r) {
+    cursor_t c = { (const uint8_t*)r->data, (const uint8_t*)r->data + r->len, false };
+    int major;
+    uint64_t value;
+    bool indefinite;
+    read_head(&c, &major, &value, &indefinite);
+    while (!c.bad && !at_break(&c)) {
+        char name[32];
+        read_key(&c, name, sizeof(name));
+        if (strcmp(name, "boot") == 0) {
+            m->boot = (uint32_t)read_uint(&c);
+        } else if (strcmp(name, "version") == 0) {
+            m->version = (uint32_t)read_uint(&c);
+        } else if (strcmp(name, "reset") == 0) {
+            if (read_uint(&c)) {
+                memset(m->aps, 0, sizeof(m->aps));
+                memset(m->stations, 0, sizeof(m->stations));
+                m->capture[0] = m->gps[0] = '\0';
+                m->resets++;
+            }
+        } else if (strcmp(name, "aps") == 0) {
+            apply_table(&c, m->aps, "bssid", NULL);
+        } else if (strcmp(name, "stations") == 0) {
+            apply_table(&c, m->stations, "mac", station_skip);
+        } else if (strcmp(name, "capture") == 0 || strcmp(name, "gps") == 0) {
+            char* dst = name[0] == 'c' ? m->capture : m->gps;
+            dst[0] = '\0';
+            item_text(&c, dst, TEXT_MAX, NULL);
+        } else {
+            fprintf(stderr, "unexpected field %s\n", name);
+            c.bad = true;
+        }
+    }
+    if (c.bad || c.p != c.end) {
+        fprintf(stderr, "malformed CBOR reply (%zu bytes)\n", r->len);
+        failures++;
+    }
+}
+
+static void poll(mirror_t* m, bool full) {
+    reply_t r = {0};
+    live_state_query_t q = { full ? 0 : m->boot, full ? 0 : m->version, LIVE_STATE_ALL, LIVE_STATE_CBOR };
+    if (live_state_write(&q, reply_sink, &r) != ESP_OK) {
+        fprintf(stderr, "query failed\n");
+        failures++;
+    }
+    apply_reply(m, &r);
+    m->polls++;
+    m->bytes += r.len;
+    free(r.data);
+}
+
+static int compare_rows(const char* table, const mirror_row_t* a, const mirror_row_t* b) {
+    int diffs = 0;
+    for (int i = 0; i < MIRROR_ROWS; i++) {
+        if (!a[i].used) {
+            continue;
+        }
+        const mirror_row_t* other = find_row((mirror_row_t*)b, a[i].key, false);
+        if (other == NULL || strcmp(other->text, a[i].text) != 0) {
+            fprintf(stderr, "%s %s: client has %s, device %s\n", table, a[i].key, a[i].text,
+                    other ? other->text : "nothing");
+            diffs++;
+        }
+    }
+    return diffs;
+}
+
+// ---- the radio ----
+
+static uint32_t rng_state = 7;
+
+static uint32_t rng(void) {
+    rng_state = rng_state * 1103515245u + 12345u;
+    return rng_state >> 8;
+}
+
+static void make_mac(uint8_t mac[6], uint32_t n, uint8_t prefix) {
+    mac[0] = prefix;
+    mac[1] = 0x11;
+    mac[2] = (uint8_t)(n >> 24);
+    mac[3] = (uint8_t)(n >> 16);
+    mac[4] = (uint8_t)(n >> 8);
+    mac[5] = (uint8_t)n;
+}
+
+static void scan(int population, int seen) {
+    live_state_aps_begin();
+    for (int i = 0; i < seen; i++) {
+        uint32_t n = rng() % (uint32_t)population;
+        uint8_t bssid[6];
+        char ssid[33];
+        make_mac(bssid, n, 0x02);
+        snprintf(ssid, sizeof(ssid), n % 5 ? "net-%u" : "caf\xc3\xa9 \"%u\"", n);
+        live_state_aps_put(bssid, ssid, (uint8_t)(1 + n % 13), (int8_t)(-40 - (int)(rng() % 8)), (uint8_t)(n % 8));
+    }
+    live_state_aps_commit();
+}
+
+static void* radio_main(void* arg) {
+    live_state_gps_t fix = { .valid = true, .fix = 1, .fix_mode = 3, .sats_in_use = 7, .sats_in_view = 11,
+                             .latitude = 40.7128f, .longitude = -74.0060f, .altitude = 10.5f, .dop_h = 0.9f,
+                             .utc_date = 20260101 };
+    for (int i = 0; i < updates; i++) {
+        if (i % 5000 == 0) {
+            scan(120, 20 + (int)(rng() % 60));
+        }
+        if (i % 2000 == 0) {
+            fix.latitude += 0.0001f;
+            fix.utc_time = (uint32_t)(i / 2000);
+            live_state_update_gps(&fix);
+        }
+        if (i == updates / 2) {
+            live_state_clear_stations();
+        }
+        if (i % 100 == 99) {
+            usleep(50);  // Frames arrive over time; a burst of evictions can still outrun the removal log
+        }
+        uint8_t mac[6], bssid[6];
+        uint32_t n = rng() % 90;
+        make_mac(mac, n, 0x06);
+        make_mac(bssid, n % 20, 0x02);
+        live_state_station_seen(mac, bssid, (int8_t)(-30 - (int)(rng() % 50)), (uint8_t)(1 + n % 11));
+    }
+    atomic_store(&radio_done, true);
+    return NULL;
+}
+
+static uint32_t frames_counter;
+
+static void capture_source(live_state_capture_t* out) {
+    memset(out, 0, sizeof(*out));
+    out->frames_seen = frames_counter / 3;  // Moves now and then, so the section comes and goes in deltas
+    out->frames_written = out->frames_seen / 2;
+    out->sd_bytes_written = (uint64_t)out->frames_written * 300;
+}
+
+static double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void time_query(const char* label, uint32_t boot, uint32_t since, live_state_format_t format) {
+    const int rounds = 2000;
+    size_t bytes = 0;
+    live_state_query_t q = { boot, since, LIVE_STATE_ALL, format };
+    double start = now_us();
+    for (int i = 0; i < rounds; i++) {
+        live_state_write(&q, null_sink, &bytes);
+    }
+    double us = (now_us() - start) / rounds;
+    printf("  %-28s %-4s %6zu bytes %8.2f us\n", label, format == LIVE_STATE_CBOR ? "cbor" : "json", bytes / rounds,
+           us);
+}
+
+int main(int argc, char** argv) {
+    const char* json_path = NULL;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:p:o:")) != -1) {
+        switch (opt) {
+            case 'n': updates = atoi(optarg); break;
+            case 'p': poll_us = atoi(optarg); break;
+            case 'o': json_path = optarg; break;
+            default:
+                fprintf(stderr, "usage: %s [-n updates] [-p poll_us] [-o json_file]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    live_state_init(0x5eed1234, capture_source);
+    static mirror_t client, fresh;
+    pthread_t radio;
+    pthread_create(&radio, NULL, radio_main, NULL);
+    while (!atomic_load(&radio_done)) {
+        frames_counter++;
+        poll(&client, false);
+        usleep((useconds_t)poll_us);
+    }
+    pthread_join(radio, NULL);
+    poll(&client, false);
+    poll(&fresh, true);
+
+    int diffs = compare_rows("ap", client.aps, fresh.aps) + compare_rows("ap", fresh.aps, client.aps) +
+                compare_rows("station", client.stations, fresh.stations) +
+                compare_rows("station", fresh.stations, client.stations);
+    if (strcmp(client.capture, fresh.capture) != 0 || strcmp(client.gps, fresh.gps) != 0) {
+        fprintf(stderr, "sections differ:\n  %s | %s\n  %s | %s\n", client.capture, fresh.capture, client.gps,
+                fresh.gps);
+        diffs++;
+    }
+    failures += diffs;
+
+    live_state_stats_t stats;
+    live_state_get_stats(&stats);
+    printf("%u polls, %u resets, %.0f bytes per poll; device at version %u with %u APs, %u stations "
+           "(%u scan results dropped, %u new stations dropped)\n",
+           client.polls, client.resets, (double)client.bytes / client.polls, stats.version, stats.aps,
+           stats.stations, stats.aps_dropped, stats.stations_dropped);
+
+    // A few stations that moved, for the delta timing
+    uint32_t before = stats.version;
+    int moved = 0;
+    for (uint32_t n = 0; n < 90 && moved < 3; n++) {
+        uint8_t mac[6], bssid[6];
+        make_mac(mac, n, 0x06);
+        make_mac(bssid, 1, 0x02);
+        live_state_station_seen(mac, bssid, -95, 14);
+        live_state_get_stats(&stats);
+        moved = (int)(stats.version - before);
+    }
+    printf("query cost:\n");
+    time_query("full tables", 0, 0, LIVE_STATE_JSON);
+    time_query("full tables", 0, 0, LIVE_STATE_CBOR);
+    time_query("3 changed rows since N", client.boot, before, LIVE_STATE_JSON);
+    time_query("3 changed rows since N", client.boot, before, LIVE_STATE_CBOR);
+
+    if (json_path != NULL) {
+        FILE* f = fopen(json_path, "w");
+        if (f == NULL) {
+            perror(json_path);
+            return 1;
+        }
+        reply_t r = {0};
+        live_state_query_t full = { 0, 0, LIVE_STATE_ALL, LIVE_STATE_JSON };
+        live_state_query_t delta = { client.boot, before, LIVE_STATE_ALL, LIVE_STATE_JSON };
+        live_state_write(&full, reply_sink, &r);
+        reply_sink(&r, "\n", 1);
+        live_state_write(&delta, reply_sink, &r);
+        reply_sink(&r, "\n", 1);
+        fwrite(r.data, 1, r.len, f);
+        fclose(f);
+        free(r.data);
+    }
+
+    printf("%s\n", failures ? "FAIL" : "ok, client copy matches the device");
+    return failures ? 1 : 0;
+}
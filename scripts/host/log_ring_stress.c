@@ -0,0 +1,142 @@
+// Host stress test for the lock-free log ring (core/log_ring.c).
+//
+//   make -C scripts/host log_ring_stress
+//   scripts/host/log_ring_stress [-p producers] [-r readers] [-n lines_per_producer] [-s first_seq]
+//
+// Producers append numbered, self-checking lines as fast as they can while readers poll with their
+// own cursors; -s starts the sequence numbers near a wrap. Every reader must see each producer's lines
+// in order, never a torn line, and end with delivered + lost equal to the number of lines written.
+
+#define _GNU_SOURCE
+#include "core/log_ring.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define MAX_PRODUCERS 16
+
+static log_ring_t ring;
+static int producers = 4;
+static int readers = 3;
+static unsigned lines_per_producer = 200000;
+static atomic_int producers_done;
+static uint32_t first_seq;
+
+typedef struct {
+    uint64_t delivered;
+    uint64_t lost;
+    uint64_t torn;
+    uint64_t out_of_order;
+    long next[MAX_PRODUCERS];
+} reader_t;
+
+static uint32_t check_of(unsigned p, unsigned n) {
+    return (p * 2654435761u) ^ (n * 40503u) ^ 0x5bd1e995u;
+}
+
+static void *producer_main(void *arg) {
+    unsigned p = (unsigned)(uintptr_t)arg;
+    char line[LOG_RING_LINE_MAX + 1];
+    for (unsigned n = 0; n < lines_per_producer; n++) {
+        // Variable padding so lines of different lengths share slots
+        int len = snprintf(line, sizeof(line), "p%u n%u c%08x %.*s", p, n, check_of(p, n), (int)(n % 40),
+                           "........................................");
+        log_ring_append(&ring, line, (size_t)len);
+        if ((n & 1023) == 0) {
+            sched_yield();
+        }
+    }
+    atomic_fetch_add(&producers_done, 1);
+    return NULL;
+}
+
+static bool visit(void *ctx, uint32_t seq, const char *text, size_t len) {
+    reader_t *r = ctx;
+    char buf[LOG_RING_LINE_MAX + 1];
+    memcpy(buf, text, len);
+    buf[len] = '\0';
+
+    unsigned p, n, check;
+    int pad_start = 0;
+    if (sscanf(buf, "p%u n%u c%x %n", &p, &n, &check, &pad_start) != 3 || p >= MAX_PRODUCERS ||
+        check != check_of(p, n) || strlen(buf + pad_start) != n % 40) {
+        r->torn++;
+        return true;
+    }
+    if ((long)n <= r->next[p] - 1) {
+        r->out_of_order++;
+    }
+    r->next[p] = (long)n + 1;
+    r->delivered++;
+    return true;
+}
+
+static void *reader_main(void *arg) {
+    reader_t *r = arg;
+    uint32_t cursor = first_seq;
+    for (;;) {
+        bool done = atomic_load(&producers_done) == producers;
+        r->lost += log_ring_read(&ring, &cursor, visit, r);
+        if (done && cursor == log_ring_head(&ring)) {
+            break;
+        }
+        if (rand() % 4 == 0) {
+            usleep(50);
+        }
+    }
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    int opt;
+    while ((opt = getopt(argc, argv, "p:r:n:s:")) != -1) {
+        switch (opt) {
+            case 'p': producers = atoi(optarg); break;
+            case 'r': readers = atoi(optarg); break;
+            case 'n': lines_per_producer = (unsigned)strtoul(optarg, NULL, 10); break;
+            case 's': first_seq = (uint32_t)strtoul(optarg, NULL, 0); break;
+            default:
+                fprintf(stderr, "usage: %s [-p producers] [-r readers] [-n lines_per_producer] [-s first_seq]\n",
+                        argv[0]);
+                return 2;
+        }
+    }
+    if (producers < 1 || producers > MAX_PRODUCERS || readers < 1) {
+        fprintf(stderr, "1..%d producers and at least one reader\n", MAX_PRODUCERS);
+        return 2;
+    }
+
+    atomic_store(&ring.head, first_seq);
+    atomic_store(&ring.floor, first_seq);
+
+    pthread_t pt[MAX_PRODUCERS];
+    pthread_t *rt = calloc((size_t)readers, sizeof(*rt));
+    reader_t *rs = calloc((size_t)readers, sizeof(*rs));
+    for (int i = 0; i < readers; i++) {
+        pthread_create(&rt[i], NULL, reader_main, &rs[i]);
+    }
+    for (int i = 0; i < producers; i++) {
+        pthread_create(&pt[i], NULL, producer_main, (void *)(uintptr_t)i);
+    }
+    for (int i = 0; i < producers; i++) {
+        pthread_join(pt[i], NULL);
+    }
+
+    uint64_t total = (uint64_t)producers * lines_per_producer;
+    int failures = 0;
+    for (int i = 0; i < readers; i++) {
+        pthread_join(rt[i], NULL);
+        bool ok = rs[i].torn == 0 && rs[i].out_of_order == 0 && rs[i].delivered + rs[i].lost == total;
+        printf("reader %d: %llu delivered, %llu lost, %llu torn, %llu out of order  %s\n", i,
+               (unsigned long long)rs[i].delivered, (unsigned long long)rs[i].lost,
+               (unsigned long long)rs[i].torn, (unsigned long long)rs[i].out_of_order, ok ? "ok" : "FAIL");
+        failures += !ok;
+    }
+    printf("%llu lines written, head %u\n", (unsigned long long)total, log_ring_head(&ring));
+    free(rt);
+    free(rs);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,466 @@
+// Host benchmark for the display mirror (core/screen_capture.c, core/screen_codec.c) with LVGL.
+//
+//   make -C scripts/host mirror_bench
+//   scripts/host/mirror_bench [-W width] [-H height] [-r buffer_rows] [-k buffer_kb] [-f fps] [-s seconds]
+//
+// Builds LVGL from components/lvgl with the firmware's colour format (RGB565, LV_COLOR_16_SWAP) and plays
+// the same scripted UI twice in a simulated render task: status bar, a menu moving its focus, a terminal
+// scrolling in new lines and a spinner that never stops. The flush callback copies each area into a
+// panel framebuffer, and in the second run tees it into the capture while a simulated viewer takes
+// frames at the mirror rate and decodes them into a framebuffer of its own.
+//
+// Reports the CPU time spent rendering with and without the mirror, how long the tee took, frame sizes
+// against raw RGB565 and plain run-length coding, and how long a new viewer waits for a whole screen.
+// Once the UI goes still the two framebuffers must match pixel for pixel. Also times the codec alone on
+// the final screen and on noise, and checks that a rectangle cut short by a full buffer decodes.
+
+#define _GNU_SOURCE
+#include "core/screen_capture.h"
+#include "core/screen_codec.h"
+#include "lvgl.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#define TICK_MS 5
+
+static int width = 240;
+static int height = 320;
+static int buffer_rows = 20;
+static int buffer_kb = 8;
+static int fps = 5;
+static int seconds = 20;
+static int failures;
+
+#define CHECK(cond, ...) do { \
+    if (!(cond)) { \
+        failures++; \
+        printf("  FAIL line %d: ", __LINE__); \
+        printf(__VA_ARGS__); \
+        printf("\n"); \
+    } \
+} while (0)
+
+typedef struct {
+    double render_ms;            // CPU time in lv_timer_handler, including flushes
+    double tee_ms;               // Of that, in screen_capture_tee
+    uint32_t refreshes;
+    uint64_t flushed_pixels;
+    uint32_t frames;
+    uint64_t frame_bytes;
+    uint32_t max_frame;
+    uint64_t rect_pixels;
+    uint64_t rle_bytes;
+    int sync_ms;                 // Simulated time until the viewer had every pixel; -1 never
+    int mismatched;              // Pixels differing from the panel once the UI is still
+    int failures;
+} run_result_t;
+
+static uint16_t* panel;          // What the display shows, RGB565
+static uint16_t* viewer;         // What the web UI would show
+static uint8_t* seen;            // Viewer pixels written at least once
+static int unseen;
+static bool mirror;
+static double tee_ns;
+static uint64_t flushed_pixels;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void bench_flush(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_p) {
+    if (mirror) {
+        double start = now_ns();
+        screen_capture_tee(area->x1, area->y1, area->x2, area->y2, (const uint16_t*)color_p,
+                           lv_disp_flush_is_last(drv));
+        tee_ns += now_ns() - start;
+    }
+    // The panel takes the pixels in display order, as the SPI drivers send them
+    int w = area->x2 - area->x1 + 1;
+    for (int y = area->y1; y <= area->y2; y++) {
+        const uint16_t* src = (const uint16_t*)color_p + (size_t)(y - area->y1) * w;
+        uint16_t* dst = panel + (size_t)y * width + area->x1;
+        for (int x = 0; x < w; x++) {
+            dst[x] = LV_COLOR_16_SWAP ? (uint16_t)(src[x] >> 8 | src[x] << 8) : src[x];
+        }
+    }
+    flushed_pixels += (uint64_t)w * (area->y2 - area->y1 + 1);
+    lv_disp_flush_ready(drv);
+}
+
+// Size of the rectangle as (u8 count, u16 pixel) runs, the simplest coding worth comparing against
+static size_t rle_size(const uint16_t* px, int w, int h, int stride) {
+    size_t bytes = 0;
+    for (int y = 0; y < h; y++) {
+        const uint16_t* row = px + (size_t)y * stride;
+        for (int x = 0; x < w;) {
+            int n = 1;
+            while (x + n < w && n < 255 && row[x + n] == row[x]) {
+                n++;
+            }
+            bytes += 3;
+            x += n;
+        }
+    }
+    return bytes;
+}
+
+static uint16_t get_u16(const uint8_t* p) {
+    return (uint16_t)(p[0] | p[1] << 8);
+}
+
+// The web UI's side: apply every rectangle of a frame
+static void apply_frame(const uint8_t* data, size_t len, run_result_t* r) {
+    size_t pos = 0;
+    while (pos < len) {
+        if (len - pos < SCREEN_CAPTURE_RECT_HEADER || data[pos] != SCREEN_CAPTURE_RECT) {
+            r->failures++;
+            printf("  FAIL: bad rectangle header at %zu of %zu\n", pos, len);
+            return;
+        }
+        int x = get_u16(data + pos + 1), y = get_u16(data + pos + 3);
+        int w = get_u16(data + pos + 5), h = get_u16(data + pos + 7);
+        size_t n = get_u16(data + pos + 9) | (size_t)get_u16(data + pos + 11) << 16;
+        pos += SCREEN_CAPTURE_RECT_HEADER;
+        if (x + w > width || y + h > height || n > len - pos ||
+            screen_codec_decode(data + pos, n, w, h, viewer + (size_t)y * width + x, width) != n) {
+            r->failures++;
+            printf("  FAIL: rectangle %dx%d at %d,%d does not decode\n", w, h, x, y);
+            return;
+        }
+        pos += n;
+        r->rect_pixels += (uint64_t)w * h;
+        r->rle_bytes += rle_size(viewer + (size_t)y * width + x, w, h, width);
+        for (int j = y; j < y + h; j++) {
+            for (int i = x; i < x + w; i++) {
+                unseen -= !seen[(size_t)j * width + i];
+                seen[(size_t)j * width + i] = 1;
+            }
+        }
+    }
+}
+
+// Scripted UI, close to the firmware's views in what it draws
+static lv_obj_t* menu_btns[4];
+static lv_obj_t* terminal;
+static lv_obj_t* spinner;
+static lv_obj_t* clock_label;
+
+static void build_ui(void) {
+    lv_obj_t* scr = lv_scr_act();
+    lv_obj_set_style_bg_color(scr, lv_color_black(), 0);
+
+    lv_obj_t* bar = lv_obj_create(scr);
+    lv_obj_set_size(bar, width, 20);
+    lv_obj_align(bar, LV_ALIGN_TOP_MID, 0, 0);
+    lv_obj_set_style_bg_color(bar, lv_color_hex(0x333333), 0);
+    lv_obj_set_style_border_width(bar, 0, 0);
+    lv_obj_set_style_radius(bar, 0, 0);
+    lv_obj_set_style_pad_all(bar, 0, 0);
+    lv_obj_clear_flag(bar, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_t* icons = lv_label_create(bar);
+    lv_label_set_text(icons, LV_SYMBOL_WIFI " " LV_SYMBOL_BLUETOOTH " " LV_SYMBOL_SD_CARD);
+    lv_obj_set_style_text_color(icons, lv_color_white(), 0);
+    lv_obj_align(icons, LV_ALIGN_LEFT_MID, 4, 0);
+    clock_label = lv_label_create(bar);
+    lv_obj_set_style_text_color(clock_label, lv_color_white(), 0);
+    lv_obj_align(clock_label, LV_ALIGN_RIGHT_MID, -4, 0);
+
+    static const char* names[] = {LV_SYMBOL_BLUETOOTH " BLE", LV_SYMBOL_WIFI " WiFi", LV_SYMBOL_GPS " GPS",
+                                  LV_SYMBOL_SETTINGS " Apps"};
+    int bw = (width - 30) / 2, bh = (height / 2 - 40) / 2;
+    for (int i = 0; i < 4; i++) {
+        lv_obj_t* btn = lv_btn_create(scr);
+        lv_obj_set_size(btn, bw, bh);
+        lv_obj_set_pos(btn, 10 + (i % 2) * (bw + 10), 30 + (i / 2) * (bh + 10));
+        lv_obj_t* label = lv_label_create(btn);
+        lv_label_set_text(label, names[i]);
+        lv_obj_center(label);
+        menu_btns[i] = btn;
+    }
+
+    terminal = lv_textarea_create(scr);
+    lv_obj_set_size(terminal, width - 20, height / 2 - 20);
+    lv_obj_align(terminal, LV_ALIGN_BOTTOM_MID, 0, -10);
+    lv_obj_set_style_bg_color(terminal, lv_color_black(), 0);
+    lv_obj_set_style_text_color(terminal, lv_color_hex(0x00FF00), 0);
+    lv_textarea_set_cursor_click_pos(terminal, false);
+
+    spinner = lv_spinner_create(scr, 1000, 60);
+    lv_obj_set_size(spinner, 30, 30);
+    lv_obj_align(spinner, LV_ALIGN_TOP_RIGHT, -10, 30 + bh * 2 + 20);
+}
+
+static void script_step(int t_ms, int still_after_ms) {
+    static int line;
+    if (t_ms < still_after_ms && t_ms % 1000 == 0) {
+        lv_label_set_text_fmt(clock_label, "%02d:%02d", t_ms / 60000, t_ms / 1000 % 60);
+    }
+    if (t_ms < still_after_ms && t_ms % 500 == 0) {
+        int focus = t_ms / 500 % 4;
+        for (int i = 0; i < 4; i++) {
+            if (i == focus) {
+                lv_obj_add_state(menu_btns[i], LV_STATE_PRESSED);
+            } else {
+                lv_obj_clear_state(menu_btns[i], LV_STATE_PRESSED);
+            }
+        }
+    }
+    if (t_ms < still_after_ms && t_ms % 100 == 0) {
+        char text[96];
+        snprintf(text, sizeof(text), "[%d] AP %02X:%02X:%02X:%02X:%02X:%02X ch %d rssi -%d\n", line, line & 0xFF,
+                 0x1A, 0x2B, line * 7 & 0xFF, 0x3C, 0x4D, 1 + line % 13, 40 + line % 50);
+        lv_textarea_add_text(terminal, text);
+        if (++line % 40 == 0) {
+            lv_textarea_set_text(terminal, "");
+        }
+    }
+    if (t_ms == still_after_ms) {
+        lv_obj_del(spinner);
+        for (int i = 0; i < 4; i++) {
+            lv_obj_clear_state(menu_btns[i], LV_STATE_PRESSED);
+        }
+    }
+}
+
+static run_result_t run(bool with_mirror) {
+    run_result_t r = {0};
+    r.sync_ms = -1;
+    mirror = with_mirror;
+    panel = calloc((size_t)width * height, sizeof(uint16_t));
+    viewer = calloc((size_t)width * height, sizeof(uint16_t));
+    seen = calloc((size_t)width * height, 1);
+    unseen = width * height;
+
+    lv_init();
+    lv_color_t* buf1 = malloc((size_t)width * buffer_rows * sizeof(lv_color_t));
+    lv_color_t* buf2 = malloc((size_t)width * buffer_rows * sizeof(lv_color_t));
+    static lv_disp_draw_buf_t draw_buf;
+    lv_disp_draw_buf_init(&draw_buf, buf1, buf2, (uint32_t)width * buffer_rows);
+    static lv_disp_drv_t drv;
+    lv_disp_drv_init(&drv);
+    drv.hor_res = (lv_coord_t)width;
+    drv.ver_res = (lv_coord_t)height;
+    drv.flush_cb = bench_flush;
+    drv.draw_buf = &draw_buf;
+    lv_disp_drv_register(&drv);
+    build_ui();
+
+    screen_capture_init(width, height, (size_t)buffer_kb * 1024, LV_COLOR_16_SWAP);
+    if (with_mirror) {
+        uint8_t hello[SCREEN_CAPTURE_HELLO_LEN];
+        if (screen_capture_start() != ESP_OK) {
+            printf("  FAIL: no memory for the capture buffers\n");
+            r.failures++;
+            return r;
+        }
+        screen_capture_hello(hello);
+        CHECK(hello[0] == SCREEN_CAPTURE_HELLO && get_u16(hello + 1) == width && get_u16(hello + 3) == height,
+              "hello");
+    }
+
+    // Scripted for the given time, then still for as long again so the mirror can catch up
+    int still_after = seconds * 1000;
+    int period = 1000 / fps, next_frame = 0;
+    for (int t = 0; t <= 2 * still_after; t += TICK_MS) {
+        script_step(t, still_after);
+        if (with_mirror && t >= next_frame) {
+            next_frame += period;
+            const uint8_t* data;
+            size_t len = screen_capture_take(&data);
+            if (len > 0) {
+                r.frames++;
+                r.frame_bytes += len;
+                if (len > r.max_frame) {
+                    r.max_frame = (uint32_t)len;
+                }
+                apply_frame(data, len, &r);
+                if (unseen == 0 && r.sync_ms < 0) {
+                    r.sync_ms = t;
+                }
+            }
+            screen_capture_arm();
+        }
+
+        double start = now_ns();
+        if (with_mirror) {
+            screen_capture_area_t band;
+            while (screen_capture_next_invalidation(&band)) {
+                lv_area_t area = {band.x1, band.y1, band.x2, band.y2};
+                _lv_inv_area(lv_disp_get_default(), &area);
+            }
+        }
+        uint64_t before = flushed_pixels;
+        lv_timer_handler();
+        r.refreshes += flushed_pixels != before;
+        r.render_ms += (now_ns() - start) / 1e6;
+        lv_tick_inc(TICK_MS);
+    }
+    r.tee_ms = tee_ns / 1e6;
+    r.flushed_pixels = flushed_pixels;
+
+    if (with_mirror) {
+        for (int i = 0; i < width * height; i++) {
+            r.mismatched += viewer[i] != panel[i];
+        }
+    }
+    r.failures += failures;
+    return r;
+}
+
+// Each run in a process of its own, so both start from a fresh LVGL
+static run_result_t run_forked(bool with_mirror) {
+    int fds[2];
+    run_result_t r = {0};
+    if (pipe(fds) != 0) {
+        perror("pipe");
+        exit(2);
+    }
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        r = run(with_mirror);
+        if (write(fds[1], &r, sizeof(r)) != sizeof(r)) {
+            _exit(2);
+        }
+        _exit(0);
+    }
+    close(fds[1]);
+    if (read(fds[0], &r, sizeof(r)) != sizeof(r)) {
+        printf("  FAIL: %s run did not finish\n", with_mirror ? "mirror" : "plain");
+        r.failures++;
+    }
+    close(fds[0]);
+    waitpid(pid, NULL, 0);
+    return r;
+}
+
+static void bench_codec(const char* name, const uint16_t* px, int w, int h) {
+    size_t cap = (size_t)w * h * SCREEN_CODEC_MAX_PIXEL_BYTES;
+    uint8_t* out = malloc(cap);
+    uint16_t* back = malloc((size_t)w * h * sizeof(uint16_t));
+    uint16_t* swapped = malloc((size_t)w * h * sizeof(uint16_t));
+    for (int i = 0; i < w * h; i++) {
+        swapped[i] = (uint16_t)(px[i] >> 8 | px[i] << 8);
+    }
+
+    int rows = 0, reps = 0;
+    size_t len = 0;
+    double start = now_ns(), enc_ns, dec_ns;
+    do {
+        len = screen_codec_encode(swapped, w, h, w, true, out, cap, &rows);
+        reps++;
+        enc_ns = now_ns() - start;
+    } while (enc_ns < 2e8);
+    CHECK(rows == h, "%s: encoded %d of %d rows", name, rows, h);
+
+    int dreps = 0;
+    size_t used = 0;
+    start = now_ns();
+    do {
+        used = screen_codec_decode(out, len, w, h, back, w);
+        dreps++;
+        dec_ns = now_ns() - start;
+    } while (dec_ns < 2e8);
+    CHECK(used == len && memcmp(back, px, (size_t)w * h * sizeof(uint16_t)) == 0, "%s: round trip", name);
+
+    printf("  %-14s %7zu bytes (%5.1f%% of raw, rle %5.1f%%)  encode %5.2f ns/px  decode %5.2f ns/px\n", name, len,
+           100.0 * len / ((size_t)w * h * 2), 100.0 * rle_size(px, w, h, w) / ((size_t)w * h * 2),
+           enc_ns / reps / (w * h), dec_ns / dreps / (w * h));
+
+    // Cut short: whole rows only, and what was written decodes on its own
+    size_t small = len / 3 + 8;
+    size_t cut = screen_codec_encode(swapped, w, h, w, true, out, small, &rows);
+    CHECK(cut <= small && rows > 0 && rows < h, "%s: cut at %zu bytes gave %d rows in %zu", name, small, rows, cut);
+    CHECK(screen_codec_decode(out, cut, w, rows, back, w) == cut &&
+          memcmp(back, px, (size_t)w * rows * sizeof(uint16_t)) == 0, "%s: cut rectangle round trip", name);
+    CHECK(screen_codec_decode(out, cut - 1, w, rows, back, w) == 0, "%s: truncated input accepted", name);
+    free(out);
+    free(back);
+    free(swapped);
+}
+
+int main(int argc, char** argv) {
+    int opt;
+    while ((opt = getopt(argc, argv, "W:H:r:k:f:s:")) != -1) {
+        switch (opt) {
+        case 'W': width = atoi(optarg); break;
+        case 'H': height = atoi(optarg); break;
+        case 'r': buffer_rows = atoi(optarg); break;
+        case 'k': buffer_kb = atoi(optarg); break;
+        case 'f': fps = atoi(optarg); break;
+        case 's': seconds = atoi(optarg); break;
+        default:
+            fprintf(stderr, "usage: %s [-W width] [-H height] [-r buffer_rows] [-k buffer_kb] [-f fps] [-s seconds]\n",
+                    argv[0]);
+            return 2;
+        }
+    }
+    if (width < 120 || height < 160 || buffer_rows < 1 || buffer_kb < 1 || fps < 1 || fps > 200 || seconds < 1) {
+        fprintf(stderr, "need at least 120x160, one buffer row, 1 KB, 1-200 fps and one second\n");
+        return 2;
+    }
+
+    printf("%dx%d, %d-row draw buffers, mirror %d fps into 2 x %d KB, %d s scripted + %d s still\n", width, height,
+           buffer_rows, fps, buffer_kb, seconds, seconds);
+    run_result_t plain = run_forked(false);
+    run_result_t mirrored = run_forked(true);
+    failures += plain.failures + mirrored.failures;
+
+    double sim_s = 2.0 * seconds;
+    printf("render: %u refreshes, %.1f Mpx flushed\n", plain.refreshes, plain.flushed_pixels / 1e6);
+    printf("  without mirror  %8.1f ms CPU  (%.3f ms per refresh)\n", plain.render_ms,
+           plain.render_ms / (plain.refreshes ? plain.refreshes : 1));
+    printf("  with mirror     %8.1f ms CPU  (%.3f ms per refresh, %+.1f%%; tee %.1f ms)\n", mirrored.render_ms,
+           mirrored.render_ms / (mirrored.refreshes ? mirrored.refreshes : 1),
+           100.0 * (mirrored.render_ms - plain.render_ms) / plain.render_ms, mirrored.tee_ms);
+    printf("mirror: %u frames, %.1f KB/s, %.1f KB average, %.1f KB largest\n", mirrored.frames,
+           mirrored.frame_bytes / 1024.0 / sim_s, mirrored.frame_bytes / 1024.0 / (mirrored.frames ? mirrored.frames : 1),
+           mirrored.max_frame / 1024.0);
+    printf("  %.2f Mpx sent: %.1f%% of raw RGB565, plain RLE would be %.1f%%\n", mirrored.rect_pixels / 1e6,
+           100.0 * mirrored.frame_bytes / (mirrored.rect_pixels * 2.0 + 1),
+           100.0 * mirrored.rle_bytes / (mirrored.rect_pixels * 2.0 + 1));
+    printf("  whole screen at the viewer after %d ms; %d pixels differ once still\n", mirrored.sync_ms,
+           mirrored.mismatched);
+    CHECK(mirrored.sync_ms >= 0, "the viewer never had the whole screen");
+    CHECK(mirrored.mismatched == 0, "viewer differs from the panel in %d pixels", mirrored.mismatched);
+
+    // The codec alone, on the last screen of a plain run and on noise
+    printf("codec:\n");
+    panel = calloc((size_t)width * height, sizeof(uint16_t));
+    viewer = calloc((size_t)width * height, sizeof(uint16_t));
+    seen = calloc((size_t)width * height, 1);
+    mirror = false;
+    lv_init();
+    lv_color_t* buf = malloc((size_t)width * height * sizeof(lv_color_t));
+    static lv_disp_draw_buf_t draw_buf;
+    lv_disp_draw_buf_init(&draw_buf, buf, NULL, (uint32_t)width * height);
+    static lv_disp_drv_t drv;
+    lv_disp_drv_init(&drv);
+    drv.hor_res = (lv_coord_t)width;
+    drv.ver_res = (lv_coord_t)height;
+    drv.flush_cb = bench_flush;
+    drv.draw_buf = &draw_buf;
+    lv_disp_drv_register(&drv);
+    build_ui();
+    for (int t = 0; t <= 3000; t += TICK_MS) {
+        script_step(t, 3000);
+        lv_timer_handler();
+        lv_tick_inc(TICK_MS);
+    }
+    bench_codec("UI screen", panel, width, height);
+    unsigned seed = 1;
+    for (int i = 0; i < width * height; i++) {
+        viewer[i] = (uint16_t)rand_r(&seed);
+    }
+    bench_codec("noise", viewer, width, height);
+
+    printf("%s\n", failures ? "FAIL" : "ok");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,301 @@
+#include "nvs_emul.h"
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+typedef enum {
+    TYPE_U8,
+    TYPE_U16,
+    TYPE_U64,
+    TYPE_STR,
+    TYPE_BLOB,
+} entry_type_t;
+
+typedef struct {
+    bool used;
+    char key[NVS_EMUL_KEY_MAX + 1];
+    entry_type_t type;
+    uint8_t* data;
+    size_t len;                  // Strings include the terminator, as in NVS
+} entry_t;
+
+struct nvs_emul {
+    pthread_mutex_t lock;
+    entry_t entries[NVS_EMUL_MAX_KEYS];
+    unsigned fail_next;
+    nvs_emul_stats_t stats;
+};
+
+nvs_emul_t* nvs_emul_create(void) {
+    nvs_emul_t* nvs = calloc(1, sizeof(*nvs));
+    if (nvs != NULL) {
+        pthread_mutex_init(&nvs->lock, NULL);
+    }
+    return nvs;
+}
+
+void nvs_emul_destroy(nvs_emul_t* nvs) {
+    for (size_t i = 0; i < NVS_EMUL_MAX_KEYS; i++) {
+        free(nvs->entries[i].data);
+    }
+    pthread_mutex_destroy(&nvs->lock);
+    free(nvs);
+}
+
+static entry_t* find(nvs_emul_t* nvs, const char* key) {
+    for (size_t i = 0; i < NVS_EMUL_MAX_KEYS; i++) {
+        if (nvs->entries[i].used && strcmp(nvs->entries[i].key, key) == 0) {
+            return &nvs->entries[i];
+        }
+    }
+    return NULL;
+}
+
+static bool take_failure(nvs_emul_t* nvs) {
+    if (nvs->fail_next == 0) {
+        return false;
+    }
+    nvs->fail_next--;
+    nvs->stats.failed++;
+    return true;
+}
+
+static esp_err_t set(nvs_emul_t* nvs, const char* key, entry_type_t type, const void* data, size_t len) {
+    if (strlen(key) > NVS_EMUL_KEY_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&nvs->lock);
+    if (take_failure(nvs)) {
+        pthread_mutex_unlock(&nvs->lock);
+        return ESP_FAIL;
+    }
+    entry_t* e = find(nvs, key);
+    if (e != NULL && e->type == type && e->len == len && memcmp(e->data, data, len) == 0) {
+        nvs->stats.writes_unchanged++;
+        pthread_mutex_unlock(&nvs->lock);
+        return ESP_OK;
+    }
+    if (e == NULL) {
+        for (size_t i = 0; i < NVS_EMUL_MAX_KEYS && e == NULL; i++) {
+            if (!nvs->entries[i].used) {
+                e = &nvs->entries[i];
+            }
+        }
+        if (e == NULL) {
+            pthread_mutex_unlock(&nvs->lock);
+            return ESP_ERR_NO_MEM;
+        }
+        e->used = true;
+        strcpy(e->key, key);
+        nvs->stats.keys++;
+    }
+    uint8_t* copy = malloc(len > 0 ? len : 1);
+    if (copy == NULL) {
+        pthread_mutex_unlock(&nvs->lock);
+        return ESP_ERR_NO_MEM;
+    }
+    memcpy(copy, data, len);
+    free(e->data);
+    e->data = copy;
+    e->len = len;
+    e->type = type;
+
+    nvs->stats.writes++;
+    if (type == TYPE_STR || type == TYPE_BLOB) {
+        nvs->stats.entries_written += 1 + (uint32_t)((len + NVS_EMUL_ENTRY_SIZE - 1) / NVS_EMUL_ENTRY_SIZE);
+    } else {
+        nvs->stats.entries_written += 1;
+    }
+    pthread_mutex_unlock(&nvs->lock);
+    return ESP_OK;
+}
+
+static esp_err_t get(nvs_emul_t* nvs, const char* key, entry_type_t type, void* out, size_t* len) {
+    pthread_mutex_lock(&nvs->lock);
+    nvs->stats.reads++;
+    entry_t* e = find(nvs, key);
+    if (e == NULL || e->type != type) {
+        pthread_mutex_unlock(&nvs->lock);
+        return ESP_ERR_NOT_FOUND;
+    }
+    esp_err_t err = ESP_OK;
+    if (out == NULL) {
+        *len = e->len;
+    } else if (*len < e->len) {
+        err = ESP_ERR_INVALID_SIZE;
+    } else {
+        memcpy(out, e->data, e->len);
+        *len = e->len;
+    }
+    pthread_mutex_unlock(&nvs->lock);
+    return err;
+}
+
+esp_err_t nvs_emul_set_u8(nvs_emul_t* nvs, const char* key, uint8_t value) {
+    return set(nvs, key, TYPE_U8, &value, sizeof(value));
+}
+
+esp_err_t nvs_emul_set_u16(nvs_emul_t* nvs, const char* key, uint16_t value) {
+    return set(nvs, key, TYPE_U16, &value, sizeof(value));
+}
+
+esp_err_t nvs_emul_set_u64(nvs_emul_t* nvs, const char* key, uint64_t value) {
+    return set(nvs, key, TYPE_U64, &value, sizeof(value));
+}
+
+esp_err_t nvs_emul_set_str(nvs_emul_t* nvs, const char* key, const char* value) {
+    return set(nvs, key, TYPE_STR, value, strlen(value) + 1);
+}
+
+esp_err_t nvs_emul_set_blob(nvs_emul_t* nvs, const char* key, const void* data, size_t len) {
+    return set(nvs, key, TYPE_BLOB, data, len);
+}
+
+esp_err_t nvs_emul_get_u8(nvs_emul_t* nvs, const char* key, uint8_t* out) {
+    size_t len = sizeof(*out);
+    return get(nvs, key, TYPE_U8, out, &len);
+}
+
+esp_err_t nvs_emul_get_u16(nvs_emul_t* nvs, const char* key, uint16_t* out) {
+    size_t len = sizeof(*out);
+    return get(nvs, key, TYPE_U16, out, &len);
+}
+
+esp_err_t nvs_emul_get_u64(nvs_emul_t* nvs, const char* key, uint64_t* out) {
+    size_t len = sizeof(*out);
+    return get(nvs, key, TYPE_U64, out, &len);
+}
+
+esp_err_t nvs_emul_get_str(nvs_emul_t* nvs, const char* key, char* out, size_t* len) {
+    return get(nvs, key, TYPE_STR, out, len);
+}
+
+esp_err_t nvs_emul_get_blob(nvs_emul_t* nvs, const char* key, void* out, size_t* len) {
+    return get(nvs, key, TYPE_BLOB, out, len);
+}
+
+esp_err_t nvs_emul_erase_key(nvs_emul_t* nvs, const char* key) {
+    pthread_mutex_lock(&nvs->lock);
+    if (take_failure(nvs)) {
+        pthread_mutex_unlock(&nvs->lock);
+        return ESP_FAIL;
+    }
+    entry_t* e = find(nvs, key);
+    if (e == NULL) {
+        pthread_mutex_unlock(&nvs->lock);
+        return ESP_ERR_NOT_FOUND;
+    }
+    free(e->data);
+    memset(e, 0, sizeof(*e));
+    nvs->stats.erases++;
+    nvs->stats.keys--;
+    pthread_mutex_unlock(&nvs->lock);
+    return ESP_OK;
+}
+
+esp_err_t nvs_emul_commit(nvs_emul_t* nvs) {
+    pthread_mutex_lock(&nvs->lock);
+    esp_err_t err = ESP_OK;
+    if (take_failure(nvs)) {
+        err = ESP_FAIL;
+    } else {
+        nvs->stats.commits++;
+    }
+    pthread_mutex_unlock(&nvs->lock);
+    return err;
+}
+
+bool nvs_emul_exists(nvs_emul_t* nvs, const char* key) {
+    pthread_mutex_lock(&nvs->lock);
+    bool found = find(nvs, key) != NULL;
+    pthread_mutex_unlock(&nvs->lock);
+    return found;
+}
+
+bool nvs_emul_corrupt(nvs_emul_t* nvs, const char* key, size_t byte) {
+    pthread_mutex_lock(&nvs->lock);
+    entry_t* e = find(nvs, key);
+    bool ok = e != NULL && byte < e->len;
+    if (ok) {
+        e->data[byte] ^= 0x10;
+    }
+    pthread_mutex_unlock(&nvs->lock);
+    return ok;
+}
+
+void nvs_emul_fail_next(nvs_emul_t* nvs, unsigned n) {
+    pthread_mutex_lock(&nvs->lock);
+    nvs->fail_next = n;
+    pthread_mutex_unlock(&nvs->lock);
+}
+
+void nvs_emul_get_stats(nvs_emul_t* nvs, nvs_emul_stats_t* out) {
+    pthread_mutex_lock(&nvs->lock);
+    *out = nvs->stats;
+    pthread_mutex_unlock(&nvs->lock);
+}
+
+void nvs_emul_reset_stats(nvs_emul_t* nvs) {
+    pthread_mutex_lock(&nvs->lock);
+    uint32_t keys = nvs->stats.keys;
+    memset(&nvs->stats, 0, sizeof(nvs->stats));
+    nvs->stats.keys = keys;
+    pthread_mutex_unlock(&nvs->lock);
+}
+
+static esp_err_t bind_get_blob(void* ctx, const char* key, void* out, size_t* len) {
+    return nvs_emul_get_blob(ctx, key, out, len);
+}
+
+static esp_err_t bind_set_blob(void* ctx, const char* key, const void* data, size_t len) {
+    return nvs_emul_set_blob(ctx, key, data, len);
+}
+
+static esp_err_t bind_get_u8(void* ctx, const char* key, uint8_t* out) {
+    return nvs_emul_get_u8(ctx, key, out);
+}
+
+static esp_err_t bind_get_u16(void* ctx, const char* key, uint16_t* out) {
+    return nvs_emul_get_u16(ctx, key, out);
+}
+
+static esp_err_t bind_get_u64(void* ctx, const char* key, uint64_t* out) {
+    return nvs_emul_get_u64(ctx, key, out);
+}
+
+static esp_err_t bind_set_u64(void* ctx, const char* key, uint64_t value) {
+    return nvs_emul_set_u64(ctx, key, value);
+}
+
+static esp_err_t bind_get_str(void* ctx, const char* key, char* out, size_t* len) {
+    return nvs_emul_get_str(ctx, key, out, len);
+}
+
+static esp_err_t bind_set_str(void* ctx, const char* key, const char* value) {
+    return nvs_emul_set_str(ctx, key, value);
+}
+
+static esp_err_t bind_erase_key(void* ctx, const char* key) {
+    return nvs_emul_erase_key(ctx, key);
+}
+
+static esp_err_t bind_commit(void* ctx) {
+    return nvs_emul_commit(ctx);
+}
+
+settings_store_nvs_t nvs_emul_bind(nvs_emul_t* nvs) {
+    settings_store_nvs_t ops = {
+        .ctx = nvs,
+        .get_blob = bind_get_blob,
+        .set_blob = bind_set_blob,
+        .get_u8 = bind_get_u8,
+        .get_u16 = bind_get_u16,
+        .get_u64 = bind_get_u64,
+        .set_u64 = bind_set_u64,
+        .get_str = bind_get_str,
+        .set_str = bind_set_str,
+        .erase_key = bind_erase_key,
+        .commit = bind_commit,
+    };
+    return ops;
+}
@@ -0,0 +1,62 @@
+#ifndef NVS_EMUL_H
+#define NVS_EMUL_H
+
+// In-memory stand-in for one NVS namespace, for host tests of code that persists settings.
+//
+// Keys are typed as in NVS (a u8 read of a string key is not found) and limited to 15 characters. Writes
+// are costed the way NVS lays them out in flash: one 32-byte entry for an integer, one header entry plus
+// the data rounded up to 32 bytes for a string or blob, nothing when the stored value is identical.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "managers/settings_store.h"
+
+#define NVS_EMUL_MAX_KEYS 64
+#define NVS_EMUL_KEY_MAX 15
+#define NVS_EMUL_ENTRY_SIZE 32
+
+typedef struct {
+    uint32_t reads;
+    uint32_t writes;             // set calls that changed something
+    uint32_t writes_unchanged;   // set calls with the value already stored
+    uint32_t entries_written;    // 32-byte flash entries used by those writes
+    uint32_t erases;
+    uint32_t commits;
+    uint32_t failed;             // Calls failed on purpose (nvs_emul_fail_next)
+    uint32_t keys;
+} nvs_emul_stats_t;
+
+typedef struct nvs_emul nvs_emul_t;
+
+nvs_emul_t* nvs_emul_create(void);
+void nvs_emul_destroy(nvs_emul_t* nvs);
+
+esp_err_t nvs_emul_set_u8(nvs_emul_t* nvs, const char* key, uint8_t value);
+esp_err_t nvs_emul_set_u16(nvs_emul_t* nvs, const char* key, uint16_t value);
+esp_err_t nvs_emul_set_u64(nvs_emul_t* nvs, const char* key, uint64_t value);
+esp_err_t nvs_emul_set_str(nvs_emul_t* nvs, const char* key, const char* value);
+esp_err_t nvs_emul_set_blob(nvs_emul_t* nvs, const char* key, const void* data, size_t len);
+esp_err_t nvs_emul_get_u8(nvs_emul_t* nvs, const char* key, uint8_t* out);
+esp_err_t nvs_emul_get_u16(nvs_emul_t* nvs, const char* key, uint16_t* out);
+esp_err_t nvs_emul_get_u64(nvs_emul_t* nvs, const char* key, uint64_t* out);
+esp_err_t nvs_emul_get_str(nvs_emul_t* nvs, const char* key, char* out, size_t* len);
+esp_err_t nvs_emul_get_blob(nvs_emul_t* nvs, const char* key, void* out, size_t* len);
+esp_err_t nvs_emul_erase_key(nvs_emul_t* nvs, const char* key);
+esp_err_t nvs_emul_commit(nvs_emul_t* nvs);
+
+bool nvs_emul_exists(nvs_emul_t* nvs, const char* key);
+
+// Flip one bit of a stored string or blob, as a torn or worn write would
+bool nvs_emul_corrupt(nvs_emul_t* nvs, const char* key, size_t byte);
+
+// The next n set/erase/commit calls fail with ESP_FAIL
+void nvs_emul_fail_next(nvs_emul_t* nvs, unsigned n);
+
+void nvs_emul_get_stats(nvs_emul_t* nvs, nvs_emul_stats_t* out);
+void nvs_emul_reset_stats(nvs_emul_t* nvs);
+
+// Calls for settings_store_config_t.nvs
+settings_store_nvs_t nvs_emul_bind(nvs_emul_t* nvs);
+
+#endif // NVS_EMUL_H
@@ -0,0 +1,277 @@
+// Host front end for capture sidecar indexes (managers/pcap_sidecar.c).
+//
+//   make -C scripts/host pcap_extract
+//   scripts/host/pcap_extract [-b bssid] [-t from-to] [-T types] [-v] capture.pcap out.pcap
+//   scripts/host/pcap_extract -g capture.pcap [-s seconds]
+//
+// Extraction writes the frames matching every given filter to out.pcap, reading only the blocks the
+// capture's .idx says can hold them; copy the .pcap and its .pcap.idx off the card together. Times are
+// Unix seconds. -v repeats the extraction with a plain scan of the whole file and checks both outputs
+// are identical. -g writes a synthetic capture and its index through the SD writer the way the
+// firmware does, for trying the tool without a device.
+
+#define _GNU_SOURCE
+#include "managers/pcap_sidecar.h"
+#include "managers/sd_writer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef struct {
+    uint8_t *data;
+    size_t len;
+    size_t cap;
+} buf_t;
+
+static esp_err_t buf_sink(void *ctx, const uint8_t *data, size_t len) {
+    buf_t *b = ctx;
+    if (b->len + len > b->cap) {
+        b->cap = (b->len + len) * 2;
+        b->data = realloc(b->data, b->cap);
+        if (!b->data) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    memcpy(b->data + b->len, data, len);
+    b->len += len;
+    return ESP_OK;
+}
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint32_t rng_state = 0x9E3779B9;
+
+static uint32_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// Reference result: read every record and apply the filter
+static int linear_extract(const char *path, const pcap_filter_t *filter, buf_t *out) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return -1;
+    }
+    uint8_t header[24];
+    uint8_t *frame = malloc(65536);
+    if (fread(header, 1, 24, f) == 24) {
+        buf_sink(out, header, 24);
+        while (fread(header, 1, 16, f) == 16) {
+            uint32_t incl;
+            uint32_t ts_sec;
+            memcpy(&ts_sec, header, 4);
+            memcpy(&incl, header + 8, 4);
+            if (incl > 65536 || fread(frame, 1, incl, f) != incl) {
+                break;
+            }
+            if (pcap_filter_match(filter, frame, incl, ts_sec)) {
+                buf_sink(out, header, 16);
+                buf_sink(out, frame, incl);
+            }
+        }
+    }
+    free(frame);
+    fclose(f);
+    return 0;
+}
+
+static void write_record(sd_writer_stream_t *stream, pcap_sidecar_writer_t *index, uint64_t t_us,
+                         const uint8_t *frame, size_t len) {
+    uint32_t header[4] = {(uint32_t)(t_us / 1000000), (uint32_t)(t_us % 1000000), (uint32_t)len, (uint32_t)len};
+    sd_writer_iov_t iov[2] = {
+        { .data = header, .len = sizeof(header) },
+        { .data = frame, .len = len },
+    };
+    uint64_t offset = sd_writer_stream_size(stream);
+    while (sd_writer_writev(stream, iov, 2, 1000) != ESP_OK) {
+    }
+    pcap_sidecar_add(index, offset, header[0], header[1], frame, len, sizeof(header) + len);
+}
+
+// 66 APs on 11 channels, hopping every 250 ms like a rawscan: beacons, clients exchanging data with
+// their AP, probe requests and the odd deauth
+static int generate(const char *path, double seconds) {
+    enum { AP_COUNT = 66, CHANNELS = 11 };
+    static const uint8_t broadcast[6] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+    struct {
+        uint8_t bssid[6];
+        uint8_t client[6];
+        uint16_t seq;
+    } aps[AP_COUNT];
+    for (int i = 0; i < AP_COUNT; i++) {
+        for (int j = 0; j < 6; j++) {
+            aps[i].bssid[j] = (uint8_t)rng();
+            aps[i].client[j] = (uint8_t)rng();
+        }
+        aps[i].bssid[0] &= 0xFC;
+        aps[i].client[0] &= 0xFC;
+        aps[i].seq = rng() & 0xFFF;
+    }
+
+    sd_writer_stream_config_t config = { .sync_on_close = true, .prealloc_bytes = SD_WRITER_DEFAULT_PREALLOC };
+    sd_writer_stream_t *stream = sd_writer_open(path, "w", &config);
+    if (!stream) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return -1;
+    }
+    uint32_t global[6] = {0xa1b2c3d4, 2 | (4 << 16), 0, 0, 4096, 105};
+    sd_writer_write(stream, global, sizeof(global), 1000);
+    pcap_sidecar_writer_t *index = pcap_sidecar_open(path);
+
+    uint64_t base_us = (uint64_t)time(NULL) * 1000000;
+    uint64_t end_us = (uint64_t)(seconds * 1e6);
+    uint8_t frame[1600];
+    uint32_t records = 0;
+    for (uint64_t t = 0; t < end_us; t += 1700) {
+        int ap = (int)((t / 250000) % CHANNELS) + CHANNELS * (rng() % (AP_COUNT / CHANNELS));
+        uint32_t kind = rng() % 100;
+        size_t len;
+        memset(frame, 0, 24);
+        if (kind < 55) {
+            frame[0] = 0x80;  // Beacon
+            memcpy(frame + 4, broadcast, 6);
+            memcpy(frame + 10, aps[ap].bssid, 6);
+            memcpy(frame + 16, aps[ap].bssid, 6);
+            len = 24 + 12 + 80 + rng() % 120;
+        } else if (kind < 90) {
+            bool to_ap = kind & 1;
+            frame[0] = 0x88;  // QoS data
+            frame[1] = to_ap ? 0x41 : 0x42;
+            memcpy(frame + 4, to_ap ? aps[ap].bssid : aps[ap].client, 6);
+            memcpy(frame + 10, to_ap ? aps[ap].client : aps[ap].bssid, 6);
+            memcpy(frame + 16, aps[ap].client, 6);
+            len = 26 + 60 + rng() % 1400;
+        } else if (kind < 98) {
+            frame[0] = 0x40;  // Probe request
+            memcpy(frame + 4, broadcast, 6);
+            memcpy(frame + 10, aps[ap].client, 6);
+            memcpy(frame + 16, broadcast, 6);
+            len = 24 + 40 + rng() % 60;
+        } else {
+            frame[0] = 0xC0;  // Deauth
+            memcpy(frame + 4, aps[ap].client, 6);
+            memcpy(frame + 10, aps[ap].bssid, 6);
+            memcpy(frame + 16, aps[ap].bssid, 6);
+            len = 26;
+        }
+        frame[22] = (uint8_t)(aps[ap].seq << 4);
+        frame[23] = (uint8_t)(aps[ap].seq++ >> 4);
+        for (size_t i = 24; i < len; i++) {
+            frame[i] = (uint8_t)rng();
+        }
+        write_record(stream, index, base_us + t, frame, len);
+        records++;
+    }
+
+    pcap_sidecar_close(index);
+    uint64_t size = sd_writer_stream_size(stream);
+    sd_writer_close(stream);
+    printf("Wrote %s: %u records, %llu bytes, first AP %02x:%02x:%02x:%02x:%02x:%02x\n", path, records,
+           (unsigned long long)size, aps[0].bssid[0], aps[0].bssid[1], aps[0].bssid[2], aps[0].bssid[3],
+           aps[0].bssid[4], aps[0].bssid[5]);
+    return 0;
+}
+
+static void usage(const char *argv0) {
+    fprintf(stderr,
+            "usage: %s [-b bssid] [-t from-to] [-T types] [-v] capture.pcap out.pcap\n"
+            "       %s -g capture.pcap [-s seconds]\n"
+            "types: mgmt,ctrl,data,beacon,probe,probereq,proberesp,auth,deauth,assoc,disassoc,action\n",
+            argv0, argv0);
+}
+
+int main(int argc, char **argv) {
+    pcap_filter_t filter = {0};
+    const char *generate_path = NULL;
+    double seconds = 600;
+    bool verify = false;
+    unsigned long from = 0, to = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "b:t:T:vg:s:")) != -1) {
+        switch (opt) {
+            case 'b':
+                filter.has_bssid = true;
+                if (!pcap_filter_parse_bssid(optarg, filter.bssid)) {
+                    fprintf(stderr, "bad bssid: %s\n", optarg);
+                    return 2;
+                }
+                break;
+            case 't':
+                if (sscanf(optarg, "%lu-%lu", &from, &to) < 1) {
+                    fprintf(stderr, "bad time range: %s\n", optarg);
+                    return 2;
+                }
+                filter.from_sec = (uint32_t)from;
+                filter.to_sec = (uint32_t)to;
+                break;
+            case 'T':
+                if (!pcap_filter_parse_types(optarg, &filter.type_mask)) {
+                    fprintf(stderr, "bad type list: %s\n", optarg);
+                    return 2;
+                }
+                break;
+            case 'v': verify = true; break;
+            case 'g': generate_path = optarg; break;
+            case 's': seconds = atof(optarg); break;
+            default: usage(argv[0]); return 2;
+        }
+    }
+
+    if (generate_path) {
+        sd_writer_init(NULL);
+        int ret = generate(generate_path, seconds);
+        sd_writer_deinit();
+        return ret ? 1 : 0;
+    }
+    if (argc - optind != 2) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    buf_t out = {0};
+    pcap_extract_stats_t stats;
+    double start = now_s();
+    esp_err_t err = pcap_sidecar_extract(argv[optind], &filter, buf_sink, &out, &stats);
+    double elapsed = now_s() - start;
+    if (err != ESP_OK) {
+        fprintf(stderr, "extract failed: %s\n", err == ESP_ERR_INVALID_ARG ? "not an uncompressed pcap" : "I/O error");
+        return 1;
+    }
+
+    FILE *f = fopen(argv[optind + 1], "wb");
+    if (!f || fwrite(out.data, 1, out.len, f) != out.len || fclose(f) != 0) {
+        perror(argv[optind + 1]);
+        return 1;
+    }
+    printf("%llu of %llu records scanned matched, %s: %u/%u blocks, %llu bytes read, %.1f ms\n",
+           (unsigned long long)stats.records_matched, (unsigned long long)stats.records_scanned,
+           stats.used_index ? "indexed" : "no index", stats.blocks_read, stats.blocks_total,
+           (unsigned long long)stats.bytes_read, elapsed * 1000);
+
+    if (verify) {
+        buf_t ref = {0};
+        start = now_s();
+        if (linear_extract(argv[optind], &filter, &ref) != 0) {
+            return 1;
+        }
+        bool same = ref.len == out.len && memcmp(ref.data, out.data, out.len) == 0;
+        printf("linear scan: %zu bytes out, %.1f ms, %s\n", ref.len, (now_s() - start) * 1000,
+               same ? "identical" : "MISMATCH");
+        free(ref.data);
+        if (!same) {
+            return 1;
+        }
+    }
+    free(out.data);
+    return 0;
+}
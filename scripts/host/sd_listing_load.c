@@ -0,0 +1,460 @@
+// Host load test for the web file browser's directory listing (managers/sd_listing.c).
+//
+//   make -C scripts/host sd_listing_load
+//   scripts/host/sd_listing_load [-n files] [-r repeats] [-d dir]
+//
+// Builds a synthetic card with n files in an indexed capture directory (plus two real subfolders) and
+// n more in a plain one, then times the pages the web UI asks for and records the peak heap each one
+// needs. Checks that totals are right, that subfolders of an indexed directory are listed ahead of its
+// files, that a cursor walk visits every entry exactly once in order, and that the heap a page needs
+// does not grow with the directory. Last, a client that reads slowly lists the capture directory while
+// new captures are created, and creating one must not wait for the listing. Then updates and removals
+// must read back the same through the open index file, after a reload and after a rebuild.
+
+#define _GNU_SOURCE
+#include "managers/sd_listing.h"
+#include "managers/capture_index.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+static int file_count = 50000;
+static int repeats = 5;
+static char root[256];
+static char pcaps[300];
+static char plain[300];
+static int failures;
+
+#define CHECK(cond, ...) do { \
+    if (!(cond)) { \
+        failures++; \
+        printf("  FAIL line %d: ", __LINE__); \
+        printf(__VA_ARGS__); \
+        printf("\n"); \
+    } \
+} while (0)
+
+// Peak heap: malloc and friends are replaced so every allocation, including libc's own (strdup,
+// opendir), is counted
+extern void* __libc_malloc(size_t size);
+extern void* __libc_calloc(size_t n, size_t size);
+extern void* __libc_realloc(void* p, size_t size);
+extern void __libc_free(void* p);
+
+static atomic_long heap_live;
+static atomic_long heap_peak;
+
+static void heap_add(void* p) {
+    if (p == NULL) {
+        return;
+    }
+    long live = atomic_fetch_add(&heap_live, (long)malloc_usable_size(p)) + (long)malloc_usable_size(p);
+    long peak = atomic_load(&heap_peak);
+    while (live > peak && !atomic_compare_exchange_weak(&heap_peak, &peak, live)) {
+    }
+}
+
+static void heap_sub(void* p) {
+    if (p != NULL) {
+        atomic_fetch_sub(&heap_live, (long)malloc_usable_size(p));
+    }
+}
+
+void* malloc(size_t size) {
+    void* p = __libc_malloc(size);
+    heap_add(p);
+    return p;
+}
+
+void* calloc(size_t n, size_t size) {
+    void* p = __libc_calloc(n, size);
+    heap_add(p);
+    return p;
+}
+
+void* realloc(void* old, size_t size) {
+    heap_sub(old);
+    void* p = __libc_realloc(old, size);
+    heap_add(p != NULL ? p : (size ? old : NULL));
+    return p;
+}
+
+void free(void* p) {
+    heap_sub(p);
+    __libc_free(p);
+}
+
+// Output sink; pages are kept in a static buffer so they don't count as heap
+typedef struct {
+    char data[512 * 1024];
+    size_t len;
+    int delay_us;                // Per write, to play a slow client
+} sink_t;
+
+static sink_t sink;
+
+static esp_err_t sink_write(void* ctx, const char* data, size_t len) {
+    sink_t* s = ctx;
+    if (s->len + len >= sizeof(s->data)) {
+        return ESP_FAIL;
+    }
+    memcpy(s->data + s->len, data, len);
+    s->len += len;
+    s->data[s->len] = '\0';
+    if (s->delay_us) {
+        usleep(s->delay_us);
+    }
+    return ESP_OK;
+}
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+// Copy the string value of "key" at or after *p; returns false at the end of the page
+static bool next_string(const char** p, const char* key, char* out, size_t out_len) {
+    char pattern[32];
+    snprintf(pattern, sizeof(pattern), "\"%s\":\"", key);
+    const char* s = strstr(*p, pattern);
+    if (s == NULL) {
+        return false;
+    }
+    s += strlen(pattern);
+    const char* end = strchr(s, '"');
+    size_t len = (size_t)(end - s) < out_len - 1 ? (size_t)(end - s) : out_len - 1;
+    memcpy(out, s, len);
+    out[len] = '\0';
+    *p = end + 1;
+    return true;
+}
+
+static unsigned long page_number(const char* key) {
+    char pattern[32];
+    snprintf(pattern, sizeof(pattern), "\"%s\":", key);
+    const char* s = strstr(sink.data, pattern);
+    return s ? strtoul(s + strlen(pattern), NULL, 10) : 0;
+}
+
+static int page_entries(void) {
+    int n = 0;
+    for (const char* p = sink.data; (p = strstr(p, "\"name\":")) != NULL; p++) {
+        n++;
+    }
+    return n;
+}
+
+static esp_err_t list(const sd_listing_query_t* q, long* peak) {
+    sink.len = 0;
+    sink.data[0] = '\0';
+    long base = atomic_load(&heap_live);
+    atomic_store(&heap_peak, base);
+    esp_err_t ret = sd_listing_stream(q, sink_write, &sink);
+    if (peak) {
+        *peak = atomic_load(&heap_peak) - base;
+    }
+    return ret;
+}
+
+static void make_file(const char* dir, int i, const char* ext) {
+    char path[400];
+    snprintf(path, sizeof(path), "%s/probe_%d.%s", dir, i, ext);
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0 || ftruncate(fd, (off_t)((i * 7919L) % 65536)) != 0) {
+        fprintf(stderr, "%s: %s\n", path, strerror(errno));
+        exit(1);
+    }
+    close(fd);
+    struct timeval times[2] = {{1700000000 + (i * 104729L) % 1000000, 0}, {1700000000 + (i * 104729L) % 1000000, 0}};
+    utimes(path, times);
+}
+
+static void build_tree(void) {
+    double start = now_ms();
+    snprintf(pcaps, sizeof(pcaps), "%s/pcaps", root);
+    snprintf(plain, sizeof(plain), "%s/misc", root);
+    mkdir(pcaps, 0755);
+    mkdir(plain, 0755);
+    char sub[400];
+    snprintf(sub, sizeof(sub), "%s/old", pcaps);
+    mkdir(sub, 0755);
+    snprintf(sub, sizeof(sub), "%s/2025", pcaps);
+    mkdir(sub, 0755);
+    for (int i = 0; i < file_count; i++) {
+        make_file(pcaps, i, "pcap");
+        make_file(plain, i, "csv");
+    }
+    printf("tree: 2 x %d files in %s (%.0f ms)\n", file_count, root, now_ms() - start);
+
+    start = now_ms();
+    CHECK(capture_index_load(pcaps) == ESP_OK, "index load");
+    printf("index: built in %.0f ms\n", now_ms() - start);
+}
+
+static int cmp_double(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return x < y ? -1 : x > y;
+}
+
+static void bench(const char* label, const char* path, sd_listing_sort_t sort, bool descending,
+                  uint32_t offset, uint32_t limit, uint32_t expect_total) {
+    sd_listing_query_t q = { .path = path, .offset = offset, .limit = limit, .sort = sort, .descending = descending };
+    double times[64];
+    int runs = repeats < 64 ? repeats : 64;
+    long peak = 0;
+    for (int i = 0; i < runs; i++) {
+        long run_peak;
+        double start = now_ms();
+        esp_err_t ret = list(&q, &run_peak);
+        times[i] = now_ms() - start;
+        CHECK(ret == ESP_OK, "%s: error %d", label, ret);
+        peak = run_peak > peak ? run_peak : peak;
+    }
+    qsort(times, runs, sizeof(times[0]), cmp_double);
+    printf("  %-24s %8.1f ms median %8.1f ms max  peak heap %6ld B  %7zu B out\n", label, times[runs / 2],
+           times[runs - 1], peak, sink.len);
+
+    CHECK(page_number("total") == expect_total, "%s: total %lu, expected %u", label, page_number("total"),
+          expect_total);
+    int expect_entries = expect_total > offset ? (int)(expect_total - offset) : 0;
+    expect_entries = expect_entries < (int)limit ? expect_entries : (int)limit;
+    CHECK(page_entries() == expect_entries, "%s: %d entries, expected %d", label, page_entries(), expect_entries);
+    // A sorted page holds offset + limit entries whatever the directory size; 64 KB is a lot more than that
+    CHECK(peak < 64 * 1024, "%s: peak heap %ld B", label, peak);
+}
+
+static void test_pages(void) {
+    uint32_t indexed_total = (uint32_t)file_count + 2;
+    printf("pages (%d runs each)\n", repeats);
+    bench("index unsorted", pcaps, SD_LISTING_SORT_NONE, false, 0, 100, indexed_total);
+    bench("index by name", pcaps, SD_LISTING_SORT_NAME, false, 0, 200, indexed_total);
+    bench("index by size, page 2", pcaps, SD_LISTING_SORT_SIZE, true, 200, 200, indexed_total);
+    bench("index by time", pcaps, SD_LISTING_SORT_TIME, true, 0, 100, indexed_total);
+    bench("readdir unsorted", plain, SD_LISTING_SORT_NONE, false, 0, 100, (uint32_t)file_count);
+    bench("readdir by name", plain, SD_LISTING_SORT_NAME, false, 0, 200, (uint32_t)file_count);
+    bench("readdir by size, page 2", plain, SD_LISTING_SORT_SIZE, true, 200, 200, (uint32_t)file_count);
+    bench("readdir by time", plain, SD_LISTING_SORT_TIME, true, 0, 100, (uint32_t)file_count);
+}
+
+static void test_folders(void) {
+    printf("folders in an indexed directory\n");
+    sd_listing_query_t q = { .path = pcaps, .limit = 5 };
+    CHECK(list(&q, NULL) == ESP_OK, "unsorted list");
+    const char* p = sink.data;
+    char type[16];
+    next_string(&p, "type", type, sizeof(type));
+    CHECK(strcmp(type, "folder") == 0, "unsorted: first entry is a %s", type);
+    next_string(&p, "type", type, sizeof(type));
+    CHECK(strcmp(type, "folder") == 0, "unsorted: second entry is a %s", type);
+    next_string(&p, "type", type, sizeof(type));
+    CHECK(strcmp(type, "file") == 0, "unsorted: third entry is a %s", type);
+
+    q.sort = SD_LISTING_SORT_NAME;
+    CHECK(list(&q, NULL) == ESP_OK, "sorted list");
+    p = sink.data;
+    char name[64];
+    next_string(&p, "name", name, sizeof(name));
+    CHECK(strcmp(name, "2025") == 0, "sorted: first entry %s", name);
+    next_string(&p, "name", name, sizeof(name));
+    CHECK(strcmp(name, "old") == 0, "sorted: second entry %s", name);
+}
+
+// Follow "next" from the first page to the last and check every entry comes once, in order
+static void walk(const char* label, const char* path, sd_listing_sort_t sort, uint32_t expect) {
+    char cursor[SD_LISTING_CURSOR_LEN + 32] = "";
+    char last[64] = "";
+    bool last_dir = true;
+    uint32_t seen = 0;
+    int pages = 0;
+    long peak = 0;
+    double start = now_ms();
+    for (;;) {
+        sd_listing_query_t q = { .path = path, .limit = SD_LISTING_MAX_LIMIT, .sort = sort, .after = cursor };
+        long page_peak;
+        if (list(&q, &page_peak) != ESP_OK) {
+            CHECK(false, "%s: page %d failed", label, pages);
+            return;
+        }
+        peak = page_peak > peak ? page_peak : peak;
+        pages++;
+
+        const char* p = sink.data + 1;   // Past the listing's own "path"
+        char name[64], type[16];
+        while (next_string(&p, "name", name, sizeof(name)) && next_string(&p, "type", type, sizeof(type))) {
+            bool dir = strcmp(type, "folder") == 0;
+            CHECK(seen == 0 || (last_dir && !dir) || (last_dir == dir && strcmp(last, name) < 0),
+                  "%s: %s after %s", label, name, last);
+            strcpy(last, name);
+            last_dir = dir;
+            seen++;
+        }
+        p = sink.data;
+        if (!next_string(&p, "next", cursor, sizeof(cursor))) {
+            break;
+        }
+    }
+    printf("  %-24s %d pages, %u entries in %.0f ms, peak heap %ld B\n", label, pages, seen, now_ms() - start, peak);
+    CHECK(seen == expect, "%s: %u entries, expected %u", label, seen, expect);
+}
+
+static void test_walk(void) {
+    printf("cursor walk\n");
+    walk("index by name", pcaps, SD_LISTING_SORT_NAME, (uint32_t)file_count + 2);
+    walk("readdir by name", plain, SD_LISTING_SORT_NAME, (uint32_t)file_count);
+}
+
+static atomic_bool listing_done;
+
+static void* slow_client(void* arg) {
+    sd_listing_query_t q = { .path = pcaps, .limit = SD_LISTING_MAX_LIMIT };
+    sink.delay_us = 5000;
+    double start = now_ms();
+    CHECK(list(&q, NULL) == ESP_OK, "slow listing");
+    *(double*)arg = now_ms() - start;
+    sink.delay_us = 0;
+    atomic_store(&listing_done, true);
+    return NULL;
+}
+
+static void test_slow_client(void) {
+    printf("slow client\n");
+    double listing_ms = 0;
+    pthread_t thread;
+    pthread_create(&thread, NULL, slow_client, &listing_ms);
+    usleep(20000);
+
+    double worst = 0;
+    int created = 0;
+    while (!atomic_load(&listing_done)) {
+        char path[400];
+        double start = now_ms();
+        CHECK(capture_index_create(pcaps, "live", "pcap", path, sizeof(path)) >= 0, "create");
+        double took = now_ms() - start;
+        worst = took > worst ? took : worst;
+        created++;
+        usleep(10000);
+    }
+    pthread_join(thread, NULL);
+    printf("  listing took %.0f ms, %d captures created meanwhile, slowest %.2f ms\n", listing_ms, created, worst);
+    CHECK(created > 0, "no capture created during the listing");
+    CHECK(worst < listing_ms / 4, "creating a capture waited %.1f ms on a %.0f ms listing", worst, listing_ms);
+}
+
+typedef struct {
+    const char* name;
+    capture_index_entry_t entry;
+    int seen;
+} find_ctx_t;
+
+static void find_visit(void* ctx, const capture_index_entry_t* e) {
+    find_ctx_t* f = ctx;
+    if (strcmp(e->name, f->name) == 0) {
+        f->entry = *e;
+        f->seen++;
+    }
+}
+
+// Number of entries named name, the last one in *out
+static int find_entry(const char* name, capture_index_entry_t* out) {
+    find_ctx_t f = { .name = name };
+    CHECK(capture_index_foreach(pcaps, find_visit, &f) == ESP_OK, "foreach");
+    if (out != NULL) {
+        *out = f.entry;
+    }
+    return f.seen;
+}
+
+static void test_updates(void) {
+    printf("index updates\n");
+    char path[400];
+    CHECK(capture_index_create(pcaps, "upd", "pcap", path, sizeof(path)) >= 0, "create");
+    const char* name = strrchr(path, '/') + 1;
+
+    // The slot is found from the key held in RAM; only the matching slot is read back
+    int rounds = 2000;
+    double start = now_ms();
+    for (int i = 0; i < rounds; i++) {
+        CHECK(capture_index_update(path, 1000 + i, i) == ESP_OK, "update %d", i);
+    }
+    double update_us = (now_ms() - start) * 1000 / rounds;
+
+    char last[400];
+    snprintf(last, sizeof(last), "%s/probe_%d.pcap", pcaps, file_count - 1);
+    start = now_ms();
+    CHECK(capture_index_remove(last) == ESP_OK, "remove");
+    double remove_us = (now_ms() - start) * 1000;
+    CHECK(capture_index_remove(last) == ESP_ERR_NOT_FOUND, "removed twice");
+    printf("  update %.1f us, remove %.1f us with %d entries\n", update_us, remove_us, file_count);
+
+    capture_index_entry_t e;
+    CHECK(find_entry(name, &e) == 1 && !e.open && e.size == 1000 + (uint64_t)rounds - 1 &&
+          e.records == (uint32_t)rounds - 1, "updated entry reads back as size %llu, %u records",
+          (unsigned long long)e.size, e.records);
+    CHECK(find_entry(strrchr(last, '/') + 1, NULL) == 0, "removed entry still listed");
+
+    // The same from the card after a reload
+    capture_index_unload();
+    CHECK(capture_index_load(pcaps) == ESP_OK, "reload");
+    CHECK(find_entry(name, &e) == 1 && e.size == 1000 + (uint64_t)rounds - 1, "update lost on reload");
+    CHECK(find_entry(strrchr(last, '/') + 1, NULL) == 0, "remove lost on reload");
+
+    // A rebuild starts over from the directory: the removed file is still there, the update is not
+    // (the file was never written)
+    CHECK(capture_index_rebuild(pcaps) == ESP_OK, "rebuild");
+    CHECK(find_entry(strrchr(last, '/') + 1, NULL) == 1, "rebuild missed a file");
+    CHECK(find_entry(name, NULL) == 0, "rebuild kept a file that does not exist");
+}
+
+static void remove_tree(void) {
+    char cmd[300];
+    snprintf(cmd, sizeof(cmd), "rm -rf '%s'", root);
+    if (system(cmd) != 0) {
+        fprintf(stderr, "could not remove %s\n", root);
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* dir = NULL;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:r:d:")) != -1) {
+        switch (opt) {
+        case 'n': file_count = atoi(optarg); break;
+        case 'r': repeats = atoi(optarg); break;
+        case 'd': dir = optarg; break;
+        default:
+            fprintf(stderr, "usage: %s [-n files] [-r repeats] [-d dir]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (file_count < 10 || repeats < 1) {
+        fprintf(stderr, "need at least 10 files and 1 repeat\n");
+        return 2;
+    }
+
+    snprintf(root, sizeof(root), "%s/sd_listing_XXXXXX", dir ? dir : "/tmp");
+    if (mkdtemp(root) == NULL) {
+        perror(root);
+        return 1;
+    }
+    build_tree();
+    test_pages();
+    test_folders();
+    test_walk();
+    test_slow_client();
+    test_updates();
+    capture_index_unload();
+    remove_tree();
+
+    printf(failures ? "FAILED (%d)\n" : "OK\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,44 @@
+// Host build of the on-device `sdbench` command (managers/sd_bench.c) for filesystem baselines.
+//
+//   make -C scripts/host sdbench
+//   scripts/host/sdbench [-s size_kb] [-a appends] [-n files] <dir>
+//
+// Run it against tmpfs, ext4 or a card in a USB reader to compare with what the device reports.
+
+#include "managers/sd_bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+int main(int argc, char **argv) {
+    sd_bench_config_t cfg;
+    sd_bench_default_config(&cfg);
+
+    int opt;
+    while ((opt = getopt(argc, argv, "s:a:n:")) != -1) {
+        switch (opt) {
+            case 's':
+                cfg.file_bytes = strtoul(optarg, NULL, 10) * 1024;
+                cfg.capture_bytes = cfg.file_bytes * 2;
+                break;
+            case 'a': cfg.append_count = strtoul(optarg, NULL, 10); break;
+            case 'n': cfg.create_count = strtoul(optarg, NULL, 10); break;
+            default:
+                fprintf(stderr, "usage: %s [-s size_kb] [-a appends] [-n files] <dir>\n", argv[0]);
+                return 2;
+        }
+    }
+    if (optind >= argc || cfg.file_bytes == 0) {
+        fprintf(stderr, "usage: %s [-s size_kb] [-a appends] [-n files] <dir>\n", argv[0]);
+        return 2;
+    }
+    cfg.dir = argv[optind];
+
+    sd_bench_result_t result;
+    if (sd_bench_run(&cfg, &result) != ESP_OK) {
+        return 1;
+    }
+    printf("%s\n", cfg.dir);
+    sd_bench_print(&result);
+    return 0;
+}
@@ -0,0 +1,623 @@
+// Host test for the settings record (managers/settings_store.c) against an NVS emulation (nvs_emul.c).
+//
+//   make -C scripts/host settings_store_check
+//   scripts/host/settings_store_check [-d debounce_ms] [-m max_delay_ms]
+//
+// Uses a copy of the firmware's settings struct and field table. Checks migration from the per-field
+// keys, reloading the record, that unchanged or reverted updates write nothing, that bursts collapse into
+// one commit and steady streams into one per max_delay_ms, recovery from a failed write and from a
+// damaged record, loading records written by an older or newer table, and that updates from several
+// threads end up stored. Then replays the same edits from the web UI through the old save path and the
+// record, prints the flash cost of each and checks the record never takes more NVS entries.
+
+#define _GNU_SOURCE
+#include "managers/settings_store.h"
+#include "nvs_emul.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <time.h>
+#include <unistd.h>
+
+// Same layout as FSettings in managers/settings_manager.h
+typedef enum { RGB_MODE_NORMAL, RGB_MODE_RAINBOW } rgb_mode_t;
+typedef enum { ALIGNMENT_CM, ALIGNMENT_TL, ALIGNMENT_TR, ALIGNMENT_BR, ALIGNMENT_BL } alignment_t;
+
+typedef struct {
+    rgb_mode_t rgb_mode;
+    float channel_delay;
+    uint16_t broadcast_speed;
+    char ap_ssid[33];
+    char ap_password[65];
+    uint8_t rgb_speed;
+    char portal_url[129];
+    char portal_ssid[33];
+    char portal_password[65];
+    char portal_ap_ssid[33];
+    char portal_domain[65];
+    bool portal_offline_mode;
+    char printer_ip[16];
+    char printer_text[257];
+    uint8_t printer_font_size;
+    alignment_t printer_alignment;
+    char flappy_ghost_name[65];
+    char selected_timezone[25];
+    char selected_hex_accent_color[25];
+    int gps_rx_pin;
+    uint32_t extra;              // Only in the "newer firmware" table below
+} settings_t;
+
+#define SETTING_RAW(member, key, legacy) \
+    { offsetof(settings_t, member), sizeof(((settings_t*)0)->member), SETTINGS_FIELD_RAW, key, legacy }
+#define SETTING_STR(member, key) \
+    { offsetof(settings_t, member), sizeof(((settings_t*)0)->member), SETTINGS_FIELD_STR, key, SETTINGS_LEGACY_STR }
+
+// settings_fields[] from settings_manager.c, plus one appended field for the schema checks
+static const settings_field_t fields[] = {
+    SETTING_RAW(rgb_mode, "rgb_mode", SETTINGS_LEGACY_U8),
+    SETTING_RAW(channel_delay, "channel_delay", SETTINGS_LEGACY_BLOB),
+    SETTING_RAW(broadcast_speed, "broadcast_speed", SETTINGS_LEGACY_U16),
+    SETTING_STR(ap_ssid, "ap_ssid"),
+    SETTING_STR(ap_password, "ap_password"),
+    SETTING_RAW(rgb_speed, "rgb_speed", SETTINGS_LEGACY_U8),
+    SETTING_STR(portal_url, "portal_url"),
+    SETTING_STR(portal_ssid, "portal_ssid"),
+    SETTING_STR(portal_password, "portal_password"),
+    SETTING_STR(portal_ap_ssid, "portal_ap_ssid"),
+    SETTING_STR(portal_domain, "portal_domain"),
+    SETTING_RAW(portal_offline_mode, "portal_offline", SETTINGS_LEGACY_U8),
+    SETTING_STR(printer_ip, "printer_ip"),
+    SETTING_STR(printer_text, "printer_text"),
+    SETTING_RAW(printer_font_size, NULL, SETTINGS_LEGACY_NONE),
+    SETTING_RAW(printer_alignment, NULL, SETTINGS_LEGACY_NONE),
+    SETTING_STR(flappy_ghost_name, "flap_name"),
+    SETTING_STR(selected_timezone, "sel_tz"),
+    SETTING_STR(selected_hex_accent_color, "sel_ac"),
+    SETTING_RAW(gps_rx_pin, "gps_rx_pin", SETTINGS_LEGACY_U8),
+    SETTING_RAW(extra, NULL, SETTINGS_LEGACY_NONE),
+};
+
+#define FIRMWARE_FIELDS (sizeof(fields) / sizeof(fields[0]) - 1)
+
+static uint32_t debounce_ms = 40;
+static uint32_t max_delay_ms = 300;
+static int failures;
+
+#define CHECK(cond, ...) do { \
+    if (!(cond)) { \
+        failures++; \
+        printf("  FAIL line %d: ", __LINE__); \
+        printf(__VA_ARGS__); \
+        printf("\n"); \
+    } \
+} while (0)
+
+static void sleep_ms(uint32_t ms) {
+    struct timespec ts = { ms / 1000, (long)(ms % 1000) * 1000000 };
+    nanosleep(&ts, NULL);
+}
+
+static int64_t now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static void set_defaults(settings_t* s) {
+    memset(s, 0, sizeof(*s));
+    s->rgb_mode = RGB_MODE_NORMAL;
+    s->channel_delay = 1.0f;
+    s->broadcast_speed = 5;
+    strcpy(s->ap_ssid, "GhostNet");
+    strcpy(s->ap_password, "GhostNet");
+    s->rgb_speed = 15;
+    strcpy(s->portal_url, "/default/path");
+    strcpy(s->portal_ssid, "EvilPortal");
+    strcpy(s->portal_password, "EvilPortalPass");
+    strcpy(s->portal_ap_ssid, "EvilAP");
+    strcpy(s->portal_domain, "portal.local");
+    s->portal_offline_mode = false;
+    strcpy(s->printer_ip, "192.168.1.100");
+    strcpy(s->printer_text, "Default Text");
+    s->printer_font_size = 12;
+    s->printer_alignment = ALIGNMENT_CM;
+    strcpy(s->flappy_ghost_name, "Bob");
+    strcpy(s->selected_hex_accent_color, "#ffffff");
+    strcpy(s->selected_timezone, "MST7MDT,M3.2.0,M11.1.0");
+    s->gps_rx_pin = 0;
+    s->extra = 77;
+}
+
+// Values that differ from every default
+static void set_custom(settings_t* s) {
+    set_defaults(s);
+    s->rgb_mode = RGB_MODE_RAINBOW;
+    s->channel_delay = 2.5f;
+    s->broadcast_speed = 300;
+    strcpy(s->ap_ssid, "Lab-AP");
+    strcpy(s->ap_password, "correct horse battery staple");
+    s->rgb_speed = 40;
+    strcpy(s->portal_url, "/sd/portals/login.html");
+    strcpy(s->portal_ssid, "Guest");
+    strcpy(s->portal_password, "guestguest");
+    strcpy(s->portal_ap_ssid, "Guest-AP");
+    strcpy(s->portal_domain, "login.example");
+    s->portal_offline_mode = true;
+    strcpy(s->printer_ip, "10.0.0.9");
+    memset(s->printer_text, 'x', sizeof(s->printer_text) - 1);
+    s->printer_text[sizeof(s->printer_text) - 1] = '\0';
+    s->printer_font_size = 20;
+    s->printer_alignment = ALIGNMENT_BR;
+    strcpy(s->flappy_ghost_name, "Casper");
+    strcpy(s->selected_timezone, "CET-1CEST,M3.5.0,M10.5.0");
+    strcpy(s->selected_hex_accent_color, "#00ff88");
+    s->gps_rx_pin = 17;
+}
+
+static bool same(const settings_t* a, const settings_t* b, size_t field_count) {
+    for (size_t i = 0; i < field_count; i++) {
+        const settings_field_t* f = &fields[i];
+        const uint8_t* pa = (const uint8_t*)a + f->offset;
+        const uint8_t* pb = (const uint8_t*)b + f->offset;
+        if (f->kind == SETTINGS_FIELD_STR ? strcmp((const char*)pa, (const char*)pb) != 0
+                                          : memcmp(pa, pb, f->size) != 0) {
+            printf("  field %u differs\n", (unsigned)i);
+            return false;
+        }
+    }
+    return true;
+}
+
+// What settings_save() did before the record: every key, then a commit. The two printer keys are longer
+// than NVS allows and fail, as they did on the device.
+static void legacy_save(nvs_emul_t* nvs, const settings_t* s) {
+    nvs_emul_set_u8(nvs, "rgb_mode", (uint8_t)s->rgb_mode);
+    nvs_emul_set_blob(nvs, "channel_delay", &s->channel_delay, sizeof(s->channel_delay));
+    nvs_emul_set_u16(nvs, "broadcast_speed", s->broadcast_speed);
+    nvs_emul_set_str(nvs, "ap_ssid", s->ap_ssid);
+    nvs_emul_set_str(nvs, "ap_password", s->ap_password);
+    nvs_emul_set_u8(nvs, "rgb_speed", s->rgb_speed);
+    nvs_emul_set_str(nvs, "portal_url", s->portal_url);
+    nvs_emul_set_str(nvs, "portal_ssid", s->portal_ssid);
+    nvs_emul_set_str(nvs, "portal_password", s->portal_password);
+    nvs_emul_set_str(nvs, "portal_ap_ssid", s->portal_ap_ssid);
+    nvs_emul_set_str(nvs, "portal_domain", s->portal_domain);
+    nvs_emul_set_u8(nvs, "portal_offline", s->portal_offline_mode);
+    nvs_emul_set_str(nvs, "printer_ip", s->printer_ip);
+    nvs_emul_set_str(nvs, "printer_text", s->printer_text);
+    nvs_emul_set_u8(nvs, "printer_font_size", s->printer_font_size);
+    nvs_emul_set_u8(nvs, "printer_alignment", (uint8_t)s->printer_alignment);
+    nvs_emul_set_str(nvs, "flap_name", s->flappy_ghost_name);
+    nvs_emul_set_str(nvs, "sel_tz", s->selected_timezone);
+    nvs_emul_set_str(nvs, "sel_ac", s->selected_hex_accent_color);
+    nvs_emul_set_u8(nvs, "gps_rx_pin", (uint8_t)s->gps_rx_pin);
+    nvs_emul_commit(nvs);
+}
+
+static settings_store_t* open_store(nvs_emul_t* nvs, size_t field_count, uint16_t schema) {
+    settings_store_config_t config = {
+        .key = "settings",
+        .schema = schema,
+        .fields = fields,
+        .field_count = field_count,
+        .data_size = sizeof(settings_t),
+        .nvs = nvs_emul_bind(nvs),
+        .debounce_ms = debounce_ms,
+        .max_delay_ms = max_delay_ms,
+    };
+    settings_store_t* store = settings_store_create(&config);
+    if (store == NULL) {
+        printf("settings_store_create failed\n");
+        exit(1);
+    }
+    return store;
+}
+
+static settings_store_t* open_and_load(nvs_emul_t* nvs, settings_t* s) {
+    settings_store_t* store = open_store(nvs, FIRMWARE_FIELDS, 1);
+    set_defaults(s);
+    CHECK(settings_store_load(store, s) == ESP_OK, "load failed");
+    return store;
+}
+
+static settings_store_stats_t stats_of(settings_store_t* store) {
+    settings_store_stats_t st;
+    settings_store_get_stats(store, &st);
+    return st;
+}
+
+// Wait out the debounce so any scheduled write has happened
+static void settle(void) {
+    sleep_ms(debounce_ms * 3 + 20);
+}
+
+static void test_migration(void) {
+    printf("migration from per-field keys\n");
+    nvs_emul_t* nvs = nvs_emul_create();
+    settings_t want, got;
+    set_custom(&want);
+    legacy_save(nvs, &want);
+    nvs_emul_reset_stats(nvs);
+
+    settings_store_t* store = open_and_load(nvs, &got);
+    settings_store_stats_t st = stats_of(store);
+    CHECK(st.source == SETTINGS_STORE_LOADED_LEGACY, "source %d", st.source);
+    CHECK(st.flushes == 1, "%u flushes", st.flushes);
+
+    // The two keys that never made it to NVS keep their defaults
+    settings_t expect = want;
+    expect.printer_font_size = 12;
+    expect.printer_alignment = ALIGNMENT_CM;
+    CHECK(same(&got, &expect, FIRMWARE_FIELDS), "migrated values differ");
+
+    nvs_emul_stats_t ns;
+    nvs_emul_get_stats(nvs, &ns);
+    CHECK(nvs_emul_exists(nvs, "settings"), "no record header");
+    for (size_t i = 0; i < FIRMWARE_FIELDS; i++) {
+        CHECK(fields[i].legacy_key == NULL || !nvs_emul_exists(nvs, fields[i].legacy_key), "%s left",
+              fields[i].legacy_key);
+    }
+    printf("  %u keys read, record %u bytes in %u keys, %u keys erased\n", ns.reads, st.record_size, ns.keys,
+           ns.erases);
+    settings_store_destroy(store);
+
+    // The second boot reads only the record
+    nvs_emul_reset_stats(nvs);
+    store = open_and_load(nvs, &got);
+    st = stats_of(store);
+    nvs_emul_get_stats(nvs, &ns);
+    CHECK(st.source == SETTINGS_STORE_LOADED_RECORD, "source %d", st.source);
+    CHECK(same(&got, &expect, FIRMWARE_FIELDS), "reloaded values differ");
+    CHECK(ns.writes == 0, "%u writes at boot", ns.writes);
+    printf("  reload: %u NVS reads\n", ns.reads);
+    settings_store_destroy(store);
+    nvs_emul_destroy(nvs);
+}
+
+static void test_dirty_tracking(void) {
+    printf("dirty tracking\n");
+    nvs_emul_t* nvs = nvs_emul_create();
+    settings_t s;
+    settings_store_t* store = open_and_load(nvs, &s);
+    CHECK(stats_of(store).source == SETTINGS_STORE_LOADED_DEFAULTS, "expected defaults");
+
+    // Defaults on a blank namespace, and saves that change nothing, write nothing
+    settings_store_update(store, &s);
+    settings_store_update(store, &s);
+    settle();
+    nvs_emul_stats_t ns;
+    nvs_emul_get_stats(nvs, &ns);
+    CHECK(ns.writes == 0 && ns.commits == 0, "%u writes for unchanged settings", ns.writes);
+
+    // A change reverted before the debounce ends writes nothing either
+    s.rgb_speed = 99;
+    settings_store_update(store, &s);
+    CHECK(stats_of(store).dirty == 1ull << 5, "dirty mask %llx", (unsigned long long)stats_of(store).dirty);
+    s.rgb_speed = 15;
+    settings_store_update(store, &s);
+    settle();
+    nvs_emul_get_stats(nvs, &ns);
+    CHECK(ns.writes == 0, "%u writes for a reverted change", ns.writes);
+
+    // Bytes past a string's terminator are not a change
+    memset(s.ap_ssid + strlen(s.ap_ssid) + 1, 'z', 4);
+    settings_store_update(store, &s);
+    CHECK(stats_of(store).dirty == 0, "tail of a string counted as a change");
+
+    // The first real change stores the whole record, since there is none yet; one commit
+    strcpy(s.portal_domain, "captive.test");
+    settings_store_update(store, &s);
+    settle();
+    nvs_emul_get_stats(nvs, &ns);
+    CHECK(ns.commits == 1 && nvs_emul_exists(nvs, "settings"), "%u commits, header %d", ns.commits,
+          nvs_emul_exists(nvs, "settings"));
+
+    // After that, one change is one write and one commit
+    nvs_emul_reset_stats(nvs);
+    strcpy(s.portal_domain, "captive2.test");
+    settings_store_update(store, &s);
+    settle();
+    nvs_emul_get_stats(nvs, &ns);
+    CHECK(ns.writes == 1 && ns.commits == 1, "%u writes, %u commits", ns.writes, ns.commits);
+    settings_store_stats_t st = stats_of(store);
+    CHECK(st.updates == 7 && st.updates_unchanged == 4, "%u updates, %u unchanged", st.updates,
+          st.updates_unchanged);
+    settings_store_destroy(store);
+    nvs_emul_destroy(nvs);
+}
+
+static void test_debounce(void) {
+    printf("debounce\n");
+    nvs_emul_t* nvs = nvs_emul_create();
+    settings_t s;
+    settings_store_t* store = open_and_load(nvs, &s);
+
+    // A burst, faster than the debounce: one commit, a debounce after the last update
+    int64_t last = 0;
+    for (int i = 0; i < 30; i++) {
+        snprintf(s.printer_text, sizeof(s.printer_text), "burst %d", i);
+        settings_store_update(store, &s);
+        last = now_ms();
+        sleep_ms(debounce_ms / 8 + 1);
+    }
+    int64_t flushed_at = 0;
+    while (now_ms() - last < 2000 && flushed_at == 0) {
+        if (stats_of(store).flushes > 0) {
+            flushed_at = now_ms();
+        }
+        sleep_ms(1);
+    }
+    settle();
+    settings_store_stats_t st = stats_of(store);
+    CHECK(st.flushes == 1, "%u flushes for one burst", st.flushes);
+    CHECK(flushed_at - last >= debounce_ms - 2 && flushed_at - last < debounce_ms + 50,
+          "written %lld ms after the last update", (long long)(flushed_at - last));
+    printf("  30 updates -> %u commit, %lld ms after the last one\n", st.flushes, (long long)(flushed_at - last));
+    settings_store_destroy(store);
+
+    // What was written is the last value
+    store = open_and_load(nvs, &s);
+    CHECK(strcmp(s.printer_text, "burst 29") == 0, "stored \"%s\"", s.printer_text);
+
+    // A steady stream never goes quiet; it is still written every max_delay_ms
+    int64_t start = now_ms();
+    uint32_t before = stats_of(store).flushes;
+    for (int i = 0; now_ms() - start < 3 * (int64_t)max_delay_ms; i++) {
+        s.rgb_speed = (uint8_t)i;
+        settings_store_update(store, &s);
+        sleep_ms(debounce_ms / 4 + 1);
+    }
+    uint32_t during = stats_of(store).flushes - before;
+    CHECK(during >= 2 && during <= 4, "%u commits over %u ms of constant changes", during, 3 * max_delay_ms);
+    printf("  constant changes for %u ms -> %u commits\n", 3 * max_delay_ms, during);
+    settings_store_destroy(store);
+    nvs_emul_destroy(nvs);
+}
+
+static void test_failures(void) {
+    printf("write failure and damaged record\n");
+    nvs_emul_t* nvs = nvs_emul_create();
+    settings_t s;
+    settings_store_t* store = open_and_load(nvs, &s);
+
+    // A failed write is kept and retried; here the retry is forced instead of waiting for it
+    strcpy(s.ap_ssid, "retry-me");
+    settings_store_update(store, &s);
+    nvs_emul_fail_next(nvs, 1);
+    CHECK(settings_store_flush(store) != ESP_OK, "write should have failed");
+    CHECK(!nvs_emul_exists(nvs, "settings"), "record written despite the failure");
+    CHECK(settings_store_flush(store) == ESP_OK, "retry failed");
+    settings_store_stats_t st = stats_of(store);
+    CHECK(st.flush_errors == 1 && st.flushes == 1, "%u errors, %u flushes", st.flush_errors, st.flushes);
+
+    settings_store_destroy(store);
+
+    store = open_and_load(nvs, &s);
+    CHECK(strcmp(s.ap_ssid, "retry-me") == 0, "stored \"%s\"", s.ap_ssid);
+    settings_store_destroy(store);
+
+    // A flipped bit anywhere in the record header: defaults, counted, and the record is replaced
+    for (size_t byte = 0;; byte += 5) {
+        nvs_emul_t* copy = nvs_emul_create();
+        settings_t custom;
+        set_custom(&custom);
+        store = open_and_load(copy, &s);
+        settings_store_update(store, &custom);
+        settings_store_destroy(store);
+        if (!nvs_emul_corrupt(copy, "settings", byte)) {
+            nvs_emul_destroy(copy);
+            break;
+        }
+
+        store = open_and_load(copy, &s);
+        st = stats_of(store);
+        settings_t defaults;
+        set_defaults(&defaults);
+        CHECK(st.corrupt_records == 1 && st.source == SETTINGS_STORE_LOADED_DEFAULTS,
+              "byte %u: corrupt %u, source %d", (unsigned)byte, st.corrupt_records, st.source);
+        CHECK(same(&s, &defaults, FIRMWARE_FIELDS), "byte %u: damaged record was applied", (unsigned)byte);
+        settle();
+        CHECK(stats_of(store).flushes == 1, "byte %u: damaged record not replaced", (unsigned)byte);
+        settings_store_destroy(store);
+        nvs_emul_destroy(copy);
+    }
+    nvs_emul_destroy(nvs);
+}
+
+static void test_schema(void) {
+    printf("schema changes\n");
+    nvs_emul_t* nvs = nvs_emul_create();
+    settings_t s, custom;
+    set_custom(&custom);
+    custom.extra = 1234;
+
+    // Newer firmware (one more field, schema 2) writes; this firmware still reads its fields
+    settings_store_t* store = open_store(nvs, FIRMWARE_FIELDS + 1, 2);
+    set_defaults(&s);
+    settings_store_load(store, &s);
+    settings_store_update(store, &custom);
+    settings_store_destroy(store);
+
+    store = open_and_load(nvs, &s);
+    settings_store_stats_t st = stats_of(store);
+    CHECK(st.source == SETTINGS_STORE_LOADED_RECORD && st.record_schema == 2, "source %d schema %u",
+          st.source, st.record_schema);
+    CHECK(same(&s, &custom, FIRMWARE_FIELDS), "fields from a newer record differ");
+    settle();
+    settings_store_destroy(store);
+
+    // That rewrote the record as schema 1; newer firmware gets its default for the field it added
+    store = open_store(nvs, FIRMWARE_FIELDS + 1, 2);
+    set_defaults(&s);
+    settings_store_load(store, &s);
+    st = stats_of(store);
+    CHECK(st.record_schema == 1, "record schema %u after downgrade", st.record_schema);
+    CHECK(same(&s, &custom, FIRMWARE_FIELDS) && s.extra == 77, "extra=%u", s.extra);
+    settle();
+    CHECK(stats_of(store).flushes == 1, "older record not upgraded");
+    settings_store_destroy(store);
+    nvs_emul_destroy(nvs);
+}
+
+typedef struct {
+    settings_store_t* store;
+    pthread_mutex_t* lock;
+    settings_t* live;
+    int id;
+} writer_arg_t;
+
+// Threads change their own field of a shared struct, as the web and serial tasks would
+static void* writer_thread(void* p) {
+    writer_arg_t* arg = p;
+    for (int i = 1; i <= 200; i++) {
+        pthread_mutex_lock(arg->lock);
+        if (arg->id == 0) {
+            snprintf(arg->live->flappy_ghost_name, sizeof(arg->live->flappy_ghost_name), "ghost %d", i);
+        } else if (arg->id == 1) {
+            arg->live->broadcast_speed = (uint16_t)i;
+        } else {
+            snprintf(arg->live->portal_ssid, sizeof(arg->live->portal_ssid), "ssid %d", i);
+        }
+        settings_t copy = *arg->live;
+        pthread_mutex_unlock(arg->lock);
+        settings_store_update(arg->store, &copy);
+        if (i % 20 == 0) {
+            settings_store_flush(arg->store);
+        }
+        usleep(300);
+    }
+    return NULL;
+}
+
+static void test_threads(void) {
+    printf("concurrent updates\n");
+    nvs_emul_t* nvs = nvs_emul_create();
+    settings_t live;
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    settings_store_t* store = open_and_load(nvs, &live);
+
+    pthread_t threads[3];
+    writer_arg_t args[3];
+    for (int i = 0; i < 3; i++) {
+        args[i] = (writer_arg_t){ store, &lock, &live, i };
+        pthread_create(&threads[i], NULL, writer_thread, &args[i]);
+    }
+    for (int i = 0; i < 3; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    settings_store_update(store, &live);
+    settings_store_stats_t st = stats_of(store);
+    settings_store_destroy(store);
+
+    settings_t s;
+    store = open_and_load(nvs, &s);
+    CHECK(same(&s, &live, FIRMWARE_FIELDS), "last values not stored");
+    printf("  %u updates -> %u commits\n", st.updates, st.flushes + 1);
+    settings_store_destroy(store);
+    nvs_emul_destroy(nvs);
+}
+
+typedef enum { EDIT_RGB_SPEED, EDIT_TOGGLES, EDIT_TEXT } edit_t;
+
+static void apply_edit(settings_t* s, edit_t edit, int i) {
+    switch (edit) {
+    case EDIT_RGB_SPEED:
+        s->rgb_speed = (uint8_t)(20 + i);
+        break;
+    case EDIT_TOGGLES:
+        s->rgb_mode = (rgb_mode_t)(i % 2 == 0);
+        s->broadcast_speed = (uint16_t)(100 + i);
+        s->portal_offline_mode = i % 2 == 0;
+        break;
+    case EDIT_TEXT:
+        snprintf(s->printer_text, sizeof(s->printer_text), "label %d: %.180s", i, "the quick brown fox jumps over "
+                 "the lazy dog, then does it again, and again, until the label is long enough to span a few "
+                 "NVS entries");
+        break;
+    }
+}
+
+// The settings page posts the whole form; model a session of edits with pauses between them. Both paths
+// start from the same stored values.
+static void report(void) {
+    static const struct {
+        const char* name;
+        edit_t edit;
+        int posts;
+        uint32_t gap_ms;
+    } sessions[] = {
+        { "one field changed", EDIT_RGB_SPEED, 1, 0 },
+        { "slider dragged (20 posts, 10 ms apart)", EDIT_RGB_SPEED, 20, 10 },
+        { "form saved 5 times with pauses", EDIT_RGB_SPEED, 5, 0 },
+        { "three toggles, saved 3 times", EDIT_TOGGLES, 3, 0 },
+        { "printer label edited 3 times", EDIT_TEXT, 3, 0 },
+    };
+
+    printf("\nflash cost per session            old save path           record\n");
+    printf("                                   entries  commits    entries  commits\n");
+    for (size_t k = 0; k < sizeof(sessions) / sizeof(sessions[0]); k++) {
+        nvs_emul_t* old = nvs_emul_create();
+        nvs_emul_t* nvs = nvs_emul_create();
+        settings_t s;
+        settings_store_t* store = open_and_load(nvs, &s);
+        strcpy(s.ap_ssid, "changed");
+        legacy_save(old, &s);
+        settings_store_update(store, &s);
+        settings_store_flush(store);
+        nvs_emul_reset_stats(old);
+        nvs_emul_reset_stats(nvs);
+
+        for (int i = 0; i < sessions[k].posts; i++) {
+            apply_edit(&s, sessions[k].edit, i);
+            legacy_save(old, &s);
+            settings_store_update(store, &s);
+            if (sessions[k].gap_ms) {
+                sleep_ms(sessions[k].gap_ms);
+            } else {
+                settle();
+            }
+        }
+        settle();
+        nvs_emul_stats_t a, b;
+        nvs_emul_get_stats(old, &a);
+        nvs_emul_get_stats(nvs, &b);
+        printf("  %-40s %6u %8u %10u %8u\n", sessions[k].name, a.entries_written, a.commits, b.entries_written,
+               b.commits);
+        CHECK(b.entries_written <= a.entries_written, "%s: record wrote %u entries, old path %u", sessions[k].name,
+              b.entries_written, a.entries_written);
+        settings_store_destroy(store);
+        nvs_emul_destroy(old);
+        nvs_emul_destroy(nvs);
+    }
+    printf("  (old path also did 20 key lookups per save to find the values to replace)\n");
+}
+
+int main(int argc, char** argv) {
+    int opt;
+    while ((opt = getopt(argc, argv, "d:m:")) != -1) {
+        switch (opt) {
+        case 'd': debounce_ms = (uint32_t)atoi(optarg); break;
+        case 'm': max_delay_ms = (uint32_t)atoi(optarg); break;
+        default:
+            fprintf(stderr, "usage: %s [-d debounce_ms] [-m max_delay_ms]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (debounce_ms < 8 || max_delay_ms < 2 * debounce_ms) {
+        fprintf(stderr, "need debounce_ms >= 8 and max_delay_ms >= 2 * debounce_ms\n");
+        return 2;
+    }
+
+    test_migration();
+    test_dirty_tracking();
+    test_debounce();
+    test_failures();
+    test_schema();
+    test_threads();
+    report();
+
+    printf("%s\n", failures ? "FAIL" : "ok");
+    return failures ? 1 : 0;
+}
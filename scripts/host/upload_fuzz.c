@@ -0,0 +1,324 @@
+// Fuzz and benchmark for the multipart upload path (core/multipart_parser.c + managers/sd_upload.c).
+//
+//   make -C scripts/host upload_fuzz
+//   scripts/host/upload_fuzz [iterations] [bench_mb]
+//
+// Builds multipart bodies holding several random binary files, with delimiter look-alikes planted
+// in the data, feeds them in random piece sizes down to one byte and checks every file lands intact.
+// Truncated bodies must fail without leaving files behind, and random garbage must not crash the
+// parser. The benchmark then uploads bench_mb MB files in typical receive sizes.
+
+#define _GNU_SOURCE
+#include "managers/sd_upload.h"
+#include "core/multipart_parser.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#define MAX_FILES 4
+
+typedef struct {
+    uint8_t *data;
+    size_t len;
+    size_t cap;
+} body_t;
+
+static void body_add(body_t *b, const void *data, size_t len) {
+    if (b->len + len > b->cap) {
+        b->cap = (b->len + len) * 2;
+        b->data = realloc(b->data, b->cap);
+    }
+    memcpy(b->data + b->len, data, len);
+    b->len += len;
+}
+
+static void body_str(body_t *b, const char *s) {
+    body_add(b, s, strlen(s));
+}
+
+static uint32_t rng_state = 1;
+static uint32_t rnd(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void clean_dir(const char *dir) {
+    DIR *d = opendir(dir);
+    struct dirent *e;
+    char path[512];
+    while (d && (e = readdir(d))) {
+        if (e->d_name[0] == '.' && (e->d_name[1] == '\0' || e->d_name[1] == '.')) continue;
+        snprintf(path, sizeof(path), "%s/%s", dir, e->d_name);
+        unlink(path);
+    }
+    if (d) closedir(d);
+}
+
+static int count_files(const char *dir) {
+    DIR *d = opendir(dir);
+    struct dirent *e;
+    int n = 0;
+    while (d && (e = readdir(d))) {
+        if (e->d_name[0] != '.') n++;
+    }
+    if (d) closedir(d);
+    return n;
+}
+
+static bool file_equals(const char *path, const uint8_t *data, size_t len) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+    uint8_t *buf = malloc(len + 1);
+    size_t n = fread(buf, 1, len + 1, f);
+    fclose(f);
+    bool ok = n == len && memcmp(buf, data, len) == 0;
+    free(buf);
+    return ok;
+}
+
+// Random bytes with CRLFs, dashes and cut-off copies of the delimiter mixed in
+static void fill_tricky(uint8_t *data, size_t len, const char *boundary) {
+    char delim[80];
+    int delim_len = snprintf(delim, sizeof(delim), "\r\n--%s", boundary);
+    for (size_t i = 0; i < len; i++) data[i] = rnd();
+    for (size_t i = 0; len > 0 && i < len / 64 + 1; i++) {
+        size_t at = rnd() % len;
+        switch (rnd() % 4) {
+            case 0: {
+                size_t n = rnd() % delim_len;      // never the full delimiter
+                if (at + n <= len) memcpy(data + at, delim, n);
+                break;
+            }
+            case 1:                                // boundary without the leading CRLF is plain data
+                if (at + delim_len - 2 <= len) memcpy(data + at, delim + 2, delim_len - 2);
+                break;
+            case 2:
+                if (at + 2 <= len) memcpy(data + at, "\r\n", 2);
+                break;
+            default:
+                data[at] = 0;
+                break;
+        }
+    }
+    // Planted pieces can line up into a real delimiter; break any that did
+    for (uint8_t *hit = data; (hit = memmem(hit, data + len - hit, delim, delim_len)) != NULL; hit++) {
+        hit[2] = 'x';
+    }
+}
+
+static void make_boundary(char *out, size_t len) {
+    static const char chars[] = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ'()+_,-./:=?";
+    size_t n = 1 + rnd() % (len - 1);
+    if (rnd() % 2) {
+        n = snprintf(out, len, "----WebKitFormBoundary");
+        for (int i = 0; i < 16; i++) out[n++] = chars[rnd() % 62];
+    } else {
+        for (size_t i = 0; i < n; i++) out[i] = chars[rnd() % (sizeof(chars) - 1)];
+        if (out[n - 1] == ' ') out[n - 1] = 'x';
+    }
+    out[n] = '\0';
+}
+
+static esp_err_t feed_split(sd_upload_t *up, const uint8_t *data, size_t len, size_t max_piece) {
+    size_t off = 0;
+    while (off < len) {
+        size_t n = 1 + rnd() % max_piece;
+        if (n > len - off) n = len - off;
+        esp_err_t ret = sd_upload_feed(up, data + off, n);
+        if (ret != ESP_OK) return ret;
+        off += n;
+    }
+    return ESP_OK;
+}
+
+static int fuzz_round(const char *dir, int iter) {
+    char boundary[MULTIPART_BOUNDARY_MAX + 1];
+    char content_type[160];
+    make_boundary(boundary, iter % 3 ? 24 : sizeof(boundary));
+    snprintf(content_type, sizeof(content_type), iter % 2 ? "multipart/form-data; boundary=%s" :
+             "multipart/form-data; boundary=\"%s\"", boundary);
+
+    int files = 1 + rnd() % MAX_FILES;
+    uint8_t *data[MAX_FILES];
+    size_t lens[MAX_FILES];
+    body_t body = {0};
+    char line[256];
+
+    if (rnd() % 3 == 0) body_str(&body, "preamble text\r\n");
+    for (int f = 0; f < files; f++) {
+        lens[f] = rnd() % 4 == 0 ? rnd() % 8 : rnd() % 70000;
+        data[f] = malloc(lens[f] + 1);
+        fill_tricky(data[f], lens[f], boundary);
+
+        if (rnd() % 2) {
+            snprintf(line, sizeof(line), "--%s\r\nContent-Disposition: form-data; name=\"note\"\r\n\r\nhello\r\n", boundary);
+            body_str(&body, line);
+        }
+        snprintf(line, sizeof(line), "--%s\r\nContent-Disposition: form-data; name=\"file\"; filename=\"f%d.bin\"\r\n"
+                 "Content-Type: application/octet-stream\r\n\r\n", boundary, f);
+        body_str(&body, line);
+        body_add(&body, data[f], lens[f]);
+        body_str(&body, "\r\n");
+    }
+    snprintf(line, sizeof(line), "--%s--\r\n", boundary);
+    body_str(&body, line);
+    size_t close_end = body.len - 2;        // Everything after the closing "--" is optional
+    if (rnd() % 3 == 0) body_str(&body, "epilogue");
+
+    int failures = 0;
+    size_t max_piece = rnd() % 4 == 0 ? 3 : 1 + rnd() % 5000;
+
+    // Whole body
+    clean_dir(dir);
+    sd_upload_t *up;
+    sd_upload_result_t res;
+    if (sd_upload_begin(dir, content_type, &up) != ESP_OK) {
+        printf("iter %d: begin failed for boundary '%s'\n", iter, boundary);
+        return 1;
+    }
+    esp_err_t ret = feed_split(up, body.data, body.len, max_piece);
+    esp_err_t fin = sd_upload_finish(up, &res);
+    if (ret != ESP_OK || fin != ESP_OK || res.files != (uint32_t)files) {
+        printf("iter %d: feed %d finish %d files %u/%d\n", iter, ret, fin, res.files, files);
+        failures++;
+    }
+    for (int f = 0; f < files; f++) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/f%d.bin", dir, f);
+        if (!file_equals(path, data[f], lens[f])) {
+            printf("iter %d: f%d.bin (%zu bytes) differs, boundary '%s', pieces <= %zu\n", iter, f, lens[f], boundary, max_piece);
+            failures++;
+        }
+    }
+    if (count_files(dir) != files) {
+        printf("iter %d: %d files in dir, expected %d\n", iter, count_files(dir), files);
+        failures++;
+    }
+
+    // Truncated body: must fail and must not leave a .part or an incomplete file
+    clean_dir(dir);
+    size_t cut = rnd() % close_end;
+    sd_upload_begin(dir, content_type, &up);
+    feed_split(up, body.data, cut, max_piece);
+    fin = sd_upload_finish(up, &res);
+    if (fin == ESP_OK) {
+        printf("iter %d: truncated body at %zu/%zu accepted\n", iter, cut, body.len);
+        failures++;
+    }
+    if (count_files(dir) != (int)res.files) {
+        printf("iter %d: truncated body left %d files, %u completed\n", iter, count_files(dir), res.files);
+        failures++;
+    }
+
+    for (int f = 0; f < files; f++) free(data[f]);
+    free(body.data);
+    return failures;
+}
+
+static esp_err_t null_data(void *ctx, const uint8_t *data, size_t len) {
+    *(size_t *)ctx += len;
+    return ESP_OK;
+}
+
+static void garbage_round(void) {
+    static const multipart_callbacks_t cb = {.on_part_data = null_data};
+    size_t seen = 0;
+    multipart_parser_t *p = multipart_parser_create("xyz", &cb, &seen);
+    static const char *tokens[] = {"\r\n--xyz", "--xyz", "\r\n", "--", "Content-Disposition: form-data; filename=\"",
+                                   "\r\n\r\n", ";", "\"", "=", "name", "x"};
+    for (int i = 0; i < 400; i++) {
+        const char *t = tokens[rnd() % (sizeof(tokens) / sizeof(*tokens))];
+        if (multipart_parser_feed(p, t, strlen(t)) != ESP_OK) break;
+    }
+    multipart_parser_finish(p);
+    multipart_parser_destroy(p);
+}
+
+static void bench(const char *dir, size_t mb) {
+    const char *boundary = "----WebKitFormBoundary7MA4YWxkTrZu0gW";
+    char content_type[128];
+    snprintf(content_type, sizeof(content_type), "multipart/form-data; boundary=%s", boundary);
+    size_t file_len = mb << 20;
+    body_t body = {0};
+    char line[256];
+    uint8_t *data = malloc(file_len);
+    for (size_t i = 0; i < file_len; i++) data[i] = rnd();
+    for (int f = 0; f < 3; f++) {
+        snprintf(line, sizeof(line), "--%s\r\nContent-Disposition: form-data; name=\"file\"; filename=\"b%d.bin\"\r\n"
+                 "Content-Type: application/octet-stream\r\n\r\n", boundary, f);
+        body_str(&body, line);
+        body_add(&body, data, file_len);
+        body_str(&body, "\r\n");
+    }
+    snprintf(line, sizeof(line), "--%s--\r\n", boundary);
+    body_str(&body, line);
+
+    static const size_t pieces[] = {1024, 1436, 4096, 16384};
+    for (size_t i = 0; i < sizeof(pieces) / sizeof(*pieces); i++) {
+        // Parser alone
+        static const multipart_callbacks_t cb = {.on_part_data = null_data};
+        size_t seen = 0;
+        multipart_parser_t *p = multipart_parser_create(boundary, &cb, &seen);
+        double t0 = now_s();
+        for (size_t off = 0; off < body.len; off += pieces[i]) {
+            size_t n = body.len - off < pieces[i] ? body.len - off : pieces[i];
+            multipart_parser_feed(p, body.data + off, n);
+        }
+        double parse_s = now_s() - t0;
+        multipart_parser_destroy(p);
+
+        // Parser plus buffered writes
+        clean_dir(dir);
+        sd_upload_t *up;
+        sd_upload_result_t res;
+        sd_upload_begin(dir, content_type, &up);
+        t0 = now_s();
+        for (size_t off = 0; off < body.len; off += pieces[i]) {
+            size_t n = body.len - off < pieces[i] ? body.len - off : pieces[i];
+            sd_upload_feed(up, body.data + off, n);
+        }
+        esp_err_t fin = sd_upload_finish(up, &res);
+        double total_s = now_s() - t0;
+        printf("pieces %5zu B: parse %7.0f MB/s, parse+write %6.0f MB/s, %u files %s\n", pieces[i],
+               body.len / parse_s / 1e6, body.len / total_s / 1e6, res.files, fin == ESP_OK ? "ok" : "FAILED");
+    }
+    free(data);
+    free(body.data);
+    clean_dir(dir);
+}
+
+int main(int argc, char **argv) {
+    int iterations = argc > 1 ? atoi(argv[1]) : 2000;
+    size_t bench_mb = argc > 2 ? strtoul(argv[2], NULL, 10) : 8;
+    char dir[] = "/tmp/upload_fuzz_XXXXXX";
+    if (!mkdtemp(dir)) {
+        perror("mkdtemp");
+        return 1;
+    }
+
+    int failures = 0;
+    for (int i = 0; i < iterations; i++) {
+        failures += fuzz_round(dir, i);
+        garbage_round();
+    }
+    printf("%d fuzz rounds, %d failures\n", iterations, failures);
+
+    if (bench_mb) {
+        bench(dir, bench_mb);
+    }
+    clean_dir(dir);
+    rmdir(dir);
+    return failures ? 1 : 0;
+}
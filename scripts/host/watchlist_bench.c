@@ -0,0 +1,236 @@
+// Host benchmark for the watchlist's lookup structure (core/watchlist_set.c).
+//
+//   make -C scripts/host watchlist_bench
+//   scripts/host/watchlist_bench [-n entries] [-l lookups]
+//
+// Writes watchlists of 1k, 10k and n entries (90% MACs, 8% OUIs, 2% SSIDs, plus a duplicate and junk
+// lines), loads each and reports load time, memory and the cost of a lookup the way the RX path makes
+// them: a bloom filter test, confirmed by binary search. Checks that every entry is found, that the
+// duplicate is stored once and the junk rejected, that no random address is reported as a match and
+// that the bloom filter's false positive rate stays near its 1% design point.
+
+#define _GNU_SOURCE
+#include "core/watchlist_set.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+static int max_entries = 100000;
+static int lookups = 2000000;
+static int failures;
+
+#define CHECK(cond, ...) do { \
+    if (!(cond)) { \
+        failures++; \
+        printf("  FAIL line %d: ", __LINE__); \
+        printf(__VA_ARGS__); \
+        printf("\n"); \
+    } \
+} while (0)
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint64_t rng_state = 0x9e3779b97f4a7c15ULL;
+
+static uint64_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+// Unicast addresses, as the RX path only looks those up
+static void random_mac(uint8_t* mac) {
+    uint64_t r = rng();
+    memcpy(mac, &r, 6);
+    mac[0] &= 0xFE;
+}
+
+typedef struct {
+    uint8_t* macs;
+    int mac_count;
+    uint8_t* ouis;
+    int oui_count;
+    char (*ssids)[33];
+    int ssid_count;
+} entries_t;
+
+static void write_list(const char* path, int total, entries_t* e) {
+    e->ssid_count = total / 50;
+    e->oui_count = total * 8 / 100;
+    e->mac_count = total - e->ssid_count - e->oui_count;
+    e->macs = malloc((size_t)e->mac_count * 6);
+    e->ouis = malloc((size_t)e->oui_count * 3);
+    e->ssids = malloc((size_t)e->ssid_count * sizeof(e->ssids[0]));
+
+    FILE* f = fopen(path, "w");
+    if (f == NULL || e->macs == NULL || e->ouis == NULL || e->ssids == NULL) {
+        perror(path);
+        exit(1);
+    }
+    fprintf(f, "# synthetic asset inventory\n\n");
+    for (int i = 0; i < e->mac_count; i++) {
+        uint8_t* m = e->macs + (size_t)i * 6;
+        random_mac(m);
+        // Separators and case vary the way hand-made lists do
+        if (i % 3 == 0) {
+            fprintf(f, "%02X:%02X:%02X:%02X:%02X:%02X\n", m[0], m[1], m[2], m[3], m[4], m[5]);
+        } else if (i % 3 == 1) {
+            fprintf(f, "%02x-%02x-%02x-%02x-%02x-%02x\n", m[0], m[1], m[2], m[3], m[4], m[5]);
+        } else {
+            fprintf(f, "  %02x%02x.%02x%02x.%02x%02x\n", m[0], m[1], m[2], m[3], m[4], m[5]);
+        }
+    }
+    for (int i = 0; i < e->oui_count; i++) {
+        uint8_t* o = e->ouis + (size_t)i * 3;
+        random_mac(o);
+        // Keep OUIs apart from the random misses below, which draw from the even first bytes
+        o[0] |= 0x02;
+        fprintf(f, "%02X:%02X:%02X\n", o[0], o[1], o[2]);
+    }
+    for (int i = 0; i < e->ssid_count; i++) {
+        snprintf(e->ssids[i], sizeof(e->ssids[i]), "asset-%08x-%d", (unsigned)rng(), i);
+        fprintf(f, "ssid:%s\n", e->ssids[i]);
+    }
+    // A duplicate, an over-long SSID and junk
+    fprintf(f, "%02X:%02X:%02X:%02X:%02X:%02X\n", e->macs[0], e->macs[1], e->macs[2], e->macs[3], e->macs[4],
+            e->macs[5]);
+    fprintf(f, "ssid:this-ssid-is-longer-than-thirty-two-bytes\n");
+    fprintf(f, "not an address\n");
+    fprintf(f, "AA:BB:CC:DD\n");
+    fclose(f);
+}
+
+static bool lookup_address(const watchlist_set_t* set, const uint8_t* mac, uint64_t* bloom_hits) {
+    bool hit = false;
+    if (set->mac_count && watchlist_set_maybe(set, WATCHLIST_MATCH_MAC, mac, 6)) {
+        (*bloom_hits)++;
+        hit = watchlist_set_has_mac(set, mac);
+    }
+    if (!hit && set->oui_count && watchlist_set_maybe(set, WATCHLIST_MATCH_OUI, mac, 3)) {
+        (*bloom_hits)++;
+        hit = watchlist_set_has_oui(set, mac);
+    }
+    return hit;
+}
+
+static void bench(int total) {
+    char path[] = "/tmp/watchlist_bench_XXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        perror(path);
+        exit(1);
+    }
+    close(fd);
+
+    entries_t e;
+    write_list(path, total, &e);
+
+    watchlist_set_t* set = NULL;
+    double start = now_s();
+    esp_err_t ret = watchlist_set_load(path, &set);
+    double load_ms = (now_s() - start) * 1000;
+    unlink(path);
+    CHECK(ret == ESP_OK && set != NULL, "load %d entries: %d", total, ret);
+    if (ret != ESP_OK) {
+        return;
+    }
+
+    size_t bytes = (set->bloom_mask + 1) / 8 + (size_t)set->mac_count * 6 + (size_t)set->oui_count * 3 +
+                   (size_t)set->ssid_count * sizeof(char*);
+    for (uint32_t i = 0; i < set->ssid_count; i++) {
+        bytes += strlen(set->ssids[i]) + 1;
+    }
+    CHECK(set->mac_count == (uint32_t)e.mac_count, "%u MACs, expected %d", set->mac_count, e.mac_count);
+    CHECK(set->oui_count <= (uint32_t)e.oui_count, "%u OUIs, expected at most %d", set->oui_count, e.oui_count);
+    CHECK(set->ssid_count == (uint32_t)e.ssid_count, "%u SSIDs, expected %d", set->ssid_count, e.ssid_count);
+    CHECK(set->rejected_lines == 3, "%u lines rejected, expected 3", set->rejected_lines);
+
+    // Every entry must be found
+    uint64_t bloom_hits = 0;
+    int missing = 0;
+    start = now_s();
+    for (int i = 0; i < e.mac_count; i++) {
+        missing += !lookup_address(set, e.macs + (size_t)i * 6, &bloom_hits);
+    }
+    double hit_ns = (now_s() - start) * 1e9 / e.mac_count;
+    for (int i = 0; i < e.oui_count; i++) {
+        uint8_t mac[6];
+        random_mac(mac);
+        memcpy(mac, e.ouis + (size_t)i * 3, 3);
+        missing += !lookup_address(set, mac, &bloom_hits);
+    }
+    for (int i = 0; i < e.ssid_count; i++) {
+        size_t len = strlen(e.ssids[i]);
+        missing += !(watchlist_set_maybe(set, WATCHLIST_MATCH_SSID, (const uint8_t*)e.ssids[i], len) &&
+                     watchlist_set_has_ssid(set, e.ssids[i], len));
+    }
+    CHECK(missing == 0, "%d entries not found", missing);
+
+    // Random unicast addresses with even first bytes can't match an OUI, and collide with a listed MAC
+    // about never; the bloom filter lets a few through to the binary search
+    uint8_t (*probes)[6] = malloc((size_t)lookups * 6);
+    for (int i = 0; i < lookups; i++) {
+        random_mac(probes[i]);
+        probes[i][0] &= 0xFC;
+    }
+    bloom_hits = 0;
+    int false_matches = 0;
+    start = now_s();
+    for (int i = 0; i < lookups; i++) {
+        false_matches += lookup_address(set, probes[i], &bloom_hits);
+    }
+    double miss_ns = (now_s() - start) * 1e9 / lookups;
+    free(probes);
+    double fp_rate = (double)bloom_hits / (2.0 * lookups);
+    CHECK(false_matches == 0, "%d random addresses matched", false_matches);
+    CHECK(fp_rate < 0.02, "bloom false positive rate %.2f%%", fp_rate * 100);
+
+    uint64_t ssid_fp = 0;
+    for (int i = 0; i < lookups / 10; i++) {
+        char ssid[33];
+        int len = snprintf(ssid, sizeof(ssid), "guest-%08x", (unsigned)rng());
+        ssid_fp += watchlist_set_maybe(set, WATCHLIST_MATCH_SSID, (const uint8_t*)ssid, (size_t)len);
+    }
+    CHECK(ssid_fp < (uint64_t)lookups / 10 / 50, "SSID bloom false positives %llu", (unsigned long long)ssid_fp);
+
+    printf("  %7d entries: load %7.1f ms, %7zu KB, hit %5.0f ns, miss %5.0f ns, bloom fp %.2f%%\n", total, load_ms,
+           bytes / 1024, hit_ns, miss_ns, fp_rate * 100);
+
+    watchlist_set_free(set);
+    free(e.macs);
+    free(e.ouis);
+    free(e.ssids);
+}
+
+int main(int argc, char** argv) {
+    int opt;
+    while ((opt = getopt(argc, argv, "n:l:")) != -1) {
+        switch (opt) {
+        case 'n': max_entries = atoi(optarg); break;
+        case 'l': lookups = atoi(optarg); break;
+        default:
+            fprintf(stderr, "usage: %s [-n entries] [-l lookups]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (max_entries < 100 || lookups < 1000) {
+        fprintf(stderr, "need at least 100 entries and 1000 lookups\n");
+        return 2;
+    }
+
+    printf("lookups per address: MAC bloom + search, then OUI bloom + search\n");
+    for (int total = 1000; total < max_entries; total *= 10) {
+        bench(total);
+    }
+    bench(max_entries);
+
+    printf(failures ? "FAILED (%d)\n" : "OK\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,394 @@
+// Host benchmark for the SD writer (managers/sd_writer.c): preallocated vs plain files, for each codec.
+//
+//   make -C scripts/host writer_bench
+//   scripts/host/writer_bench [-d dir] [-s size_mb] [-r runs] [-c checkpoint_kb]
+//
+// A synthetic capture (beacons from 40 APs with a share of encrypted data frames) is written to dir the
+// way pcap_write_record() does it: a gathered record header and frame per write, a checkpoint every
+// checkpoint_kb like the capture journal, and the pcap stream settings. Every codec is run with
+// preallocation in SD_WRITER_DEFAULT_PREALLOC extents and without, and the median of the runs is
+// reported: input MB/s, output size, the writes and their latency, the time spent growing the file and
+// compressing. Each file is checked afterwards: nothing dropped, the preallocated tail trimmed on close
+// and the content decoding back to the trace (LZ4 in process, gzip through `gzip -dc`).
+//
+// /tmp is often tmpfs, which says little about a card; point -d at a card in a USB reader (or at least
+// a real disk) for numbers worth quoting.
+
+#define _GNU_SOURCE
+#include "managers/sd_writer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+static const char* dir = "/tmp";
+static int size_mb = 32;
+static int runs = 3;
+static size_t checkpoint = 64 * 1024;     // CAPTURE_CHECKPOINT_BYTES
+static int failures;
+
+#define CHECK(cond, ...) do { \
+    if (!(cond)) { \
+        failures++; \
+        printf("  FAIL line %d: ", __LINE__); \
+        printf(__VA_ARGS__); \
+        printf("\n"); \
+    } \
+} while (0)
+
+typedef struct {
+    uint8_t* data;
+    size_t len;
+    size_t cap;
+} buf_t;
+
+static void buf_put(buf_t* b, const void* data, size_t len) {
+    if (b->len + len > b->cap) {
+        b->cap = (b->len + len) * 2;
+        b->data = realloc(b->data, b->cap);
+        if (!b->data) {
+            perror("realloc");
+            exit(1);
+        }
+    }
+    memcpy(b->data + b->len, data, len);
+    b->len += len;
+}
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint32_t rng_state = 0x12345678;
+
+static uint32_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static void put_u32(buf_t* b, uint32_t v) {
+    buf_put(b, &v, 4);
+}
+
+static void put_record(buf_t* trace, uint64_t t_us, const uint8_t* frame, size_t len) {
+    put_u32(trace, (uint32_t)(t_us / 1000000));
+    put_u32(trace, (uint32_t)(t_us % 1000000));
+    put_u32(trace, (uint32_t)len);
+    put_u32(trace, (uint32_t)len);
+    buf_put(trace, frame, len);
+}
+
+// pcap global header, then beacons round-robin from 40 APs where only the TSF and sequence number
+// change, and after every eighth beacon an encrypted data frame whose payload doesn't compress
+static void synthetic_trace(buf_t* trace, size_t bytes) {
+    enum { AP_COUNT = 40 };
+    uint8_t bssid[AP_COUNT][6];
+    char ssid[AP_COUNT][33];
+    for (int i = 0; i < AP_COUNT; i++) {
+        for (int j = 0; j < 6; j++) {
+            bssid[i][j] = (uint8_t)rng();
+        }
+        bssid[i][0] &= 0xFC;
+        snprintf(ssid[i], sizeof(ssid[i]), "Network-%04X", (unsigned)(rng() & 0xFFFF));
+    }
+
+    static const uint32_t global[6] = {0xa1b2c3d4, 0x00040002, 0, 0, 4096, 105};
+    buf_put(trace, global, sizeof(global));
+
+    static const uint8_t ies[] = {
+        0x01, 0x08, 0x82, 0x84, 0x8b, 0x96, 0x24, 0x30, 0x48, 0x6c, 0x03, 0x01, 0x06, 0x05, 0x04, 0x00,
+        0x03, 0x00, 0x00, 0x07, 0x06, 'U', 'S', ' ', 0x01, 0x0b, 0x1e, 0x30, 0x14, 0x01, 0x00, 0x00,
+        0x0f, 0xac, 0x04, 0x01, 0x00, 0x00, 0x0f, 0xac, 0x04, 0x01, 0x00, 0x00, 0x0f, 0xac, 0x02, 0x0c,
+        0x00, 0x2d, 0x1a, 0xad, 0x01, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    uint8_t frame[1600];
+    uint64_t t = 0;
+    uint16_t seq = 0;
+    for (int n = 0; trace->len < bytes; n++) {
+        int ap = n % AP_COUNT;
+        t += 2560 + rng() % 64;
+        seq = (seq + 1) & 0xFFF;
+        size_t len = 0;
+        static const uint8_t fc[10] = {0x80, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+        memcpy(frame, fc, sizeof(fc));
+        memcpy(frame + 10, bssid[ap], 6);
+        memcpy(frame + 16, bssid[ap], 6);
+        frame[22] = (uint8_t)(seq << 4);
+        frame[23] = (uint8_t)(seq >> 4);
+        len = 24;
+        uint64_t tsf = t + ap * 1000003ull;
+        memcpy(frame + len, &tsf, 8);
+        len += 8;
+        static const uint8_t fixed[4] = {0x64, 0x00, 0x11, 0x04};
+        memcpy(frame + len, fixed, sizeof(fixed));
+        len += sizeof(fixed);
+        size_t ssid_len = strlen(ssid[ap]);
+        frame[len++] = 0;
+        frame[len++] = (uint8_t)ssid_len;
+        memcpy(frame + len, ssid[ap], ssid_len);
+        len += ssid_len;
+        memcpy(frame + len, ies, sizeof(ies));
+        len += sizeof(ies);
+        put_record(trace, t, frame, len);
+
+        if (n % 8 == 7) {
+            static const uint8_t data_hdr[4] = {0x88, 0x41, 0x2c, 0x00};
+            memcpy(frame, data_hdr, sizeof(data_hdr));
+            memcpy(frame + 4, bssid[ap], 6);
+            memcpy(frame + 16, bssid[ap], 6);
+            len = 24 + 2 + 8 + 64 + rng() % 1200;
+            for (size_t j = 10; j < len; j++) {
+                if (j < 16 || j >= 22) frame[j] = (uint8_t)rng();
+            }
+            put_record(trace, t + 120, frame, len);
+        }
+    }
+}
+
+// LZ4 frame decoder, just enough to check what lz4_stream produces
+static bool lz4_decode(const uint8_t* src, size_t len, buf_t* out) {
+    static const uint8_t header[7] = {0x04, 0x22, 0x4D, 0x18, 0x60, 0x40, 0x82};
+    if (len < 11 || memcmp(src, header, sizeof(header)) != 0) {
+        return false;
+    }
+    size_t pos = sizeof(header);
+    while (pos + 4 <= len) {
+        uint32_t bsize = src[pos] | (src[pos + 1] << 8) | (src[pos + 2] << 16) | ((uint32_t)src[pos + 3] << 24);
+        pos += 4;
+        if (bsize == 0) {
+            return pos == len;
+        }
+        size_t n = bsize & 0x7FFFFFFF;
+        if (n > 65536 || pos + n > len) {
+            return false;
+        }
+        if (bsize & 0x80000000u) {
+            buf_put(out, src + pos, n);
+            pos += n;
+            continue;
+        }
+        size_t block_start = out->len;
+        const uint8_t* ip = src + pos;
+        const uint8_t* end = ip + n;
+        while (ip < end) {
+            uint8_t token = *ip++;
+            size_t lit = token >> 4;
+            if (lit == 15) {
+                uint8_t b;
+                do {
+                    if (ip >= end) return false;
+                    b = *ip++;
+                    lit += b;
+                } while (b == 255);
+            }
+            if (ip + lit > end) return false;
+            buf_put(out, ip, lit);
+            ip += lit;
+            if (ip == end) break;
+            if (ip + 2 > end) return false;
+            size_t offset = ip[0] | (ip[1] << 8);
+            ip += 2;
+            size_t ml = (token & 15) + 4;
+            if ((token & 15) == 15) {
+                uint8_t b;
+                do {
+                    if (ip >= end) return false;
+                    b = *ip++;
+                    ml += b;
+                } while (b == 255);
+            }
+            if (offset == 0 || offset > out->len - block_start) return false;
+            for (size_t i = 0; i < ml; i++) {
+                uint8_t c = out->data[out->len - offset];
+                buf_put(out, &c, 1);
+            }
+        }
+        pos += n;
+    }
+    return false;
+}
+
+static bool load(const char* path, buf_t* out) {
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        return false;
+    }
+    uint8_t chunk[65536];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+        buf_put(out, chunk, n);
+    }
+    fclose(f);
+    return true;
+}
+
+static bool gzip_matches(const char* path, const buf_t* original) {
+    char cmd[600];
+    snprintf(cmd, sizeof(cmd), "gzip -dc < '%s'", path);
+    FILE* p = popen(cmd, "r");
+    bool ok = p != NULL;
+    size_t pos = 0;
+    uint8_t chunk[65536];
+    size_t n;
+    while (ok && (n = fread(chunk, 1, sizeof(chunk), p)) > 0) {
+        ok = pos + n <= original->len && memcmp(original->data + pos, chunk, n) == 0;
+        pos += n;
+    }
+    if (p != NULL && pclose(p) != 0) {
+        ok = false;
+    }
+    return ok && pos == original->len;
+}
+
+static bool content_matches(const char* path, sd_writer_codec_t codec, const buf_t* trace) {
+    if (codec == SD_WRITER_CODEC_GZIP) {
+        return gzip_matches(path, trace);
+    }
+    buf_t file = {0};
+    buf_t decoded = {0};
+    bool ok = load(path, &file);
+    if (ok && codec == SD_WRITER_CODEC_LZ4) {
+        ok = lz4_decode(file.data, file.len, &decoded);
+        free(file.data);
+        file = decoded;
+    }
+    ok = ok && file.len == trace->len && memcmp(file.data, trace->data, trace->len) == 0;
+    free(file.data);
+    return ok;
+}
+
+typedef struct {
+    double seconds;
+    sd_writer_metrics_t m;
+    uint64_t file_size;
+} run_t;
+
+// Write the trace record by record as pcap_write_record() does; blocking writes, so the rate is what
+// the writer sustains rather than what a capture would drop
+static bool write_trace(const char* path, const buf_t* trace, sd_writer_codec_t codec, uint32_t prealloc,
+                        run_t* out) {
+    sd_writer_stream_config_t config = {
+        .sync_on_close = true,
+        .prealloc_bytes = prealloc,
+        .codec = codec,
+    };
+    sd_writer_reset_metrics();
+    double start = now_s();
+    sd_writer_stream_t* stream = sd_writer_open(path, "w", &config);
+    if (stream == NULL) {
+        perror(path);
+        return false;
+    }
+    bool ok = sd_writer_write(stream, trace->data, 24, 1000) == ESP_OK;
+    size_t pos = 24;
+    size_t since_checkpoint = 0;
+    while (ok && pos + 16 <= trace->len) {
+        uint32_t incl;
+        memcpy(&incl, trace->data + pos + 8, 4);
+        sd_writer_iov_t iov[2] = {
+            { .data = trace->data + pos, .len = 16 },
+            { .data = trace->data + pos + 16, .len = incl },
+        };
+        ok = sd_writer_writev(stream, iov, 2, 1000) == ESP_OK;
+        pos += 16 + incl;
+        since_checkpoint += 16 + incl;
+        if (checkpoint && since_checkpoint >= checkpoint) {
+            sd_writer_checkpoint(stream, NULL, NULL);
+            since_checkpoint = 0;
+        }
+    }
+    ok = sd_writer_close(stream) == ESP_OK && ok;
+    out->seconds = now_s() - start;
+    sd_writer_get_metrics(&out->m);
+
+    struct stat st;
+    out->file_size = stat(path, &st) == 0 ? (uint64_t)st.st_size : 0;
+    return ok;
+}
+
+static int cmp_seconds(const void* a, const void* b) {
+    double x = ((const run_t*)a)->seconds, y = ((const run_t*)b)->seconds;
+    return (x > y) - (x < y);
+}
+
+static double bench(const buf_t* trace, sd_writer_codec_t codec, uint32_t prealloc) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/writer_bench_%d.pcap%s", dir, (int)getpid(), sd_writer_codec_suffix(codec));
+
+    run_t* r = calloc((size_t)runs, sizeof(run_t));
+    for (int i = 0; i < runs; i++) {
+        bool ok = write_trace(path, trace, codec, prealloc, &r[i]);
+        CHECK(ok, "%s, prealloc %u: write or close failed", sd_writer_codec_name(codec), prealloc);
+        CHECK(r[i].m.bytes_dropped == 0, "%s, prealloc %u: %llu bytes dropped", sd_writer_codec_name(codec),
+              prealloc, (unsigned long long)r[i].m.bytes_dropped);
+        // Preallocated files are grown past the data and must be trimmed back on close
+        CHECK(r[i].file_size == r[i].m.bytes_written, "%s, prealloc %u: file is %llu bytes, %llu written",
+              sd_writer_codec_name(codec), prealloc, (unsigned long long)r[i].file_size,
+              (unsigned long long)r[i].m.bytes_written);
+        CHECK(prealloc == 0 || r[i].m.prealloc_extents > 0, "%s: no extent preallocated",
+              sd_writer_codec_name(codec));
+    }
+    // The last run's file is still there; decoding it is slow, so only that one is read back
+    CHECK(content_matches(path, codec, trace), "%s, prealloc %u: content differs from the trace",
+          sd_writer_codec_name(codec), prealloc);
+    unlink(path);
+
+    qsort(r, (size_t)runs, sizeof(run_t), cmp_seconds);
+    const run_t* m = &r[runs / 2];
+    double mbps = trace->len / m->seconds / 1e6;
+    double out_ratio = 100.0 * m->file_size / trace->len;
+    printf("  %-5s %8s %8.1f %11llu %6.1f%% %7u %7.0f %8u %5u %8.1f %8.1f\n", sd_writer_codec_name(codec),
+           prealloc ? "yes" : "no", mbps, (unsigned long long)m->file_size, out_ratio, m->m.writes,
+           m->m.writes ? (double)m->m.write_us_total / m->m.writes : 0.0, m->m.write_us_max, m->m.prealloc_extents,
+           m->m.prealloc_us_total / 1000.0, m->m.codec_us_total / 1000.0);
+    free(r);
+    return mbps;
+}
+
+int main(int argc, char** argv) {
+    int opt;
+    while ((opt = getopt(argc, argv, "d:s:r:c:")) != -1) {
+        switch (opt) {
+        case 'd': dir = optarg; break;
+        case 's': size_mb = atoi(optarg); break;
+        case 'r': runs = atoi(optarg); break;
+        case 'c': checkpoint = (size_t)atoi(optarg) * 1024; break;
+        default:
+            fprintf(stderr, "usage: %s [-d dir] [-s size_mb] [-r runs] [-c checkpoint_kb]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (size_mb < 1 || runs < 1) {
+        fprintf(stderr, "need at least 1 MB and 1 run\n");
+        return 2;
+    }
+
+    buf_t trace = {0};
+    synthetic_trace(&trace, (size_t)size_mb * 1024 * 1024);
+    if (sd_writer_init(NULL) != ESP_OK) {
+        fprintf(stderr, "sd_writer_init failed\n");
+        return 1;
+    }
+
+    printf("%s: %zu byte trace, %d runs (median shown), checkpoint every %zu KB, prealloc %u KB\n", dir, trace.len,
+           runs, checkpoint / 1024, SD_WRITER_DEFAULT_PREALLOC / 1024);
+    printf("  %-5s %8s %8s %11s %7s %7s %7s %8s %5s %8s %8s\n", "codec", "prealloc", "MB/s", "bytes", "ratio",
+           "writes", "avg us", "max us", "ext", "grow ms", "codec ms");
+    static const sd_writer_codec_t codecs[] = {SD_WRITER_CODEC_NONE, SD_WRITER_CODEC_LZ4, SD_WRITER_CODEC_GZIP};
+    for (size_t c = 0; c < sizeof(codecs) / sizeof(codecs[0]); c++) {
+        double plain = bench(&trace, codecs[c], 0);
+        double pre = bench(&trace, codecs[c], SD_WRITER_DEFAULT_PREALLOC);
+        printf("  %-5s preallocated at %.2fx the plain rate\n", sd_writer_codec_name(codecs[c]), pre / plain);
+    }
+
+    sd_writer_deinit();
+    free(trace.data);
+    printf(failures ? "FAILED (%d)\n" : "OK\n", failures);
+    return failures ? 1 : 0;
+}
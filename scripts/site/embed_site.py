@@ -0,0 +1,50 @@
+#!/usr/bin/env python3
+"""Regenerate include/managers/ghost_esp_site.h from ghost_site.html (same layout as bin2c).
+
+The page is embedded gzip-compressed only; ap_manager serves it as-is with Content-Encoding: gzip and
+inflates it on the fly for the rare client that doesn't accept gzip. GHOST_SITE_ETAG (inflated) and
+GHOST_SITE_ETAG_GZ (gzip, with the "-gz" suffix SD downloads use) are derived from the page contents,
+so browsers revalidate with a 304 until the page changes, and a cache never mixes up the two bodies.
+"""
+import gzip
+import hashlib
+import os
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SRC = os.path.join(HERE, "ghost_site.html")
+DST = os.path.join(HERE, "..", "..", "include", "managers", "ghost_esp_site.h")
+
+
+def render(name, raw, data):
+    rows = []
+    for i in range(0, len(data), 16):
+        rows.append("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]))
+    etag = hashlib.sha256(raw).hexdigest()[:16]
+    out = "/* Generated by bin2c, do not edit manually */\n\n"
+    out += "/* Contents of file %s, gzip -9 */\n" % os.path.basename(SRC)
+    out += "#define GHOST_SITE_ETAG \"\\\"%s\\\"\"\n" % etag
+    out += "#define GHOST_SITE_ETAG_GZ \"\\\"%s-gz\\\"\"\n" % etag
+    out += "const long int %s_size = %d;\n" % (name, len(raw))
+    out += "const long int %s_gz_size = %d;\n" % (name, len(data))
+    out += "const unsigned char %s_gz[%d] = {\n" % (name, len(data))
+    out += ",\n".join(rows)
+    out += "\n};"
+    return out
+
+
+def main():
+    src = sys.argv[1] if len(sys.argv) > 1 else SRC
+    dst = sys.argv[2] if len(sys.argv) > 2 else DST
+    with open(src, "rb") as f:
+        raw = f.read()
+    # mtime 0 and no file name keep the output reproducible
+    data = gzip.compress(raw, compresslevel=9, mtime=0)
+    with open(dst, "w", newline="\n") as f:
+        f.write(render("ghost_site_html", raw, data))
+    print("%s: %d bytes, %d gzipped (%.1f%%)" % (os.path.relpath(dst), len(raw), len(data),
+                                                100.0 * len(data) / len(raw)))
+
+
+if __name__ == "__main__":
+    main()